@@ -164,10 +164,135 @@ static HI_U16 Sqrt32(HI_U32 u32Arg)
     return u16Res;
 }
 
+#ifdef ISP_SNS_SHADOW
+static HI_VOID ISP_DRV_SnsShadowReset(ISP_DRV_CTX_S *pstDrvCtx)
+{
+    /* the sensor may have been re-initialised from user space, forget what we sent */
+    memset(pstDrvCtx->stSnsShadow.abValid, 0, sizeof(pstDrvCtx->stSnsShadow.abValid));
+    pstDrvCtx->stSnsShadow.u32PendNum = 0;
+}
+
+/* queue one register of the current frame, drop it if the bus already holds this value;
+ * the shadow itself is only updated by ISP_DRV_SnsI2cFlush once the write succeeded */
+static HI_VOID ISP_DRV_SnsI2cQueue(ISP_DRV_CTX_S *pstDrvCtx, HI_U32 u32Slot, ISP_I2C_DATA_S *pstI2cData)
+{
+    ISP_SNS_SHADOW_S *pstShadow = &pstDrvCtx->stSnsShadow;
+    ISP_I2C_DATA_S   *pstLast   = &pstShadow->astI2cData[u32Slot];
+
+    if ((HI_TRUE == pstShadow->abValid[u32Slot])
+        && (pstLast->u8DevAddr == pstI2cData->u8DevAddr)
+        && (pstLast->u32RegAddr == pstI2cData->u32RegAddr)
+        && (pstLast->u32AddrByteNum == pstI2cData->u32AddrByteNum)
+        && (pstLast->u32DataByteNum == pstI2cData->u32DataByteNum)
+        && (pstLast->u32Data == pstI2cData->u32Data))
+    {
+        pstDrvCtx->stDrvDbgInfo.u32SensorCfgSkip++;
+        return;
+    }
+
+    if (pstShadow->u32PendNum >= ISP_MAX_SNS_REGS)
+    {
+        return;
+    }
+
+    pstShadow->au8PendSlot[pstShadow->u32PendNum] = (HI_U8)u32Slot;
+    pstShadow->apstPend[pstShadow->u32PendNum]    = pstI2cData;
+    pstShadow->u32PendNum++;
+}
+
+/* send the queued registers, a run of consecutive addresses on the same device goes out as one burst */
+static HI_VOID ISP_DRV_SnsI2cFlush(ISP_DRV_CTX_S *pstDrvCtx)
+{
+    HI_U32 i, j, k, u32Len;
+    HI_S32 s32Ret;
+    HI_U8  au8Data[ISP_SNS_BURST_DATA_MAX];
+    ISP_I2C_DATA_S *pstHead = HI_NULL;
+    ISP_I2C_DATA_S *pstNext = HI_NULL;
+    ISP_SNS_SHADOW_S   *pstShadow = &pstDrvCtx->stSnsShadow;
+    ISP_BUS_CALLBACK_S *pstBusCb  = &pstDrvCtx->stBusCb;
+
+    for (i = 0; i < pstShadow->u32PendNum; i = j)
+    {
+        pstHead = pstShadow->apstPend[i];
+        u32Len  = pstHead->u32DataByteNum;
+        j = i + 1;
+
+        if (HI_NULL != pstBusCb->pfnISPWriteI2CBurst)
+        {
+            while (j < pstShadow->u32PendNum)
+            {
+                pstNext = pstShadow->apstPend[j];
+                if ((pstNext->u8DevAddr != pstHead->u8DevAddr)
+                    || (pstNext->u32AddrByteNum != pstHead->u32AddrByteNum)
+                    || (pstNext->u32DataByteNum != pstHead->u32DataByteNum)
+                    || (pstNext->u32RegAddr != pstHead->u32RegAddr + u32Len)
+                    || (u32Len + pstNext->u32DataByteNum > ISP_SNS_BURST_DATA_MAX))
+                {
+                    break;
+                }
+                u32Len += pstNext->u32DataByteNum;
+                j++;
+            }
+        }
+
+        if (j - i > 1)
+        {
+            u32Len = 0;
+            for (k = i; k < j; k++)
+            {
+                pstNext = pstShadow->apstPend[k];
+                if (2 == pstNext->u32DataByteNum)
+                {
+                    au8Data[u32Len++] = (pstNext->u32Data >> 8) & 0xFF;
+                }
+                au8Data[u32Len++] = pstNext->u32Data & 0xFF;
+            }
+            s32Ret = pstBusCb->pfnISPWriteI2CBurst(pstHead->u8DevAddr, pstHead->u32RegAddr,
+                pstHead->u32AddrByteNum, au8Data, u32Len);
+        }
+        else if (HI_NULL != pstBusCb->pfnISPWriteI2CData)
+        {
+            s32Ret = pstBusCb->pfnISPWriteI2CData(pstHead->u8DevAddr, pstHead->u32RegAddr,
+                pstHead->u32AddrByteNum, pstHead->u32Data, pstHead->u32DataByteNum);
+        }
+        else
+        {
+            s32Ret = HI_FAILURE;
+        }
+
+        if (HI_SUCCESS != s32Ret)
+        {
+            /* not on the bus, resend next frame */
+            for (k = i; k < j; k++)
+            {
+                pstShadow->abValid[pstShadow->au8PendSlot[k]] = HI_FALSE;
+            }
+            continue;
+        }
+
+        for (k = i; k < j; k++)
+        {
+            memcpy(&pstShadow->astI2cData[pstShadow->au8PendSlot[k]], pstShadow->apstPend[k],
+                sizeof(ISP_I2C_DATA_S));
+            pstShadow->abValid[pstShadow->au8PendSlot[k]] = HI_TRUE;
+        }
+
+        /* device address byte + register address + data */
+        pstDrvCtx->stDrvDbgInfo.u32SensorCfgBytes += 1 + pstHead->u32AddrByteNum + u32Len;
+        pstDrvCtx->stDrvDbgInfo.u32SensorCfgXfers++;
+    }
+
+    pstShadow->u32PendNum = 0;
+}
+#endif
+
 HI_S32 ISP_SetIntEnable(ISP_DEV IspDev, HI_BOOL bEn)
 {
     if (bEn)
     {
+#ifdef ISP_SNS_SHADOW
+        ISP_DRV_SnsShadowReset(ISP_DRV_GET_CTX(IspDev));
+#endif
         HW_REG(IO_ADDRESS_PORT(ISP_INT_MASK)) = 0x243;
         //HW_REG(IO_ADDRESS_PORT(ISP_INT_MASK)) = 0xf;
     }
@@ -1157,6 +1282,9 @@ HI_S32 ISP_DRV_SwitchMode(ISP_DRV_CTX_S *pstDrvCtx)
     pstSyncCfg = &pstDrvCtx->stSyncCfg;
 
     pstSyncCfg->u8WDRMode = pstDrvCtx->stWDRCfg.u8WDRMode;
+#ifdef ISP_SNS_SHADOW
+    ISP_DRV_SnsShadowReset(pstDrvCtx);
+#endif
 
     /* init cfg when modes change */
     //if (pstSyncCfg->u8WDRMode != pstSyncCfg->u8PreWDRMode)
@@ -1747,6 +1875,11 @@ HI_S32 ISP_DRV_RegConfigSensor(ISP_DRV_CTX_S *pstDrvCtx)
     ISP_I2C_DATA_S *pstI2cData = HI_NULL;
     ISP_SSP_DATA_S *pstSspData = HI_NULL;
 
+#ifdef ISP_SNS_SHADOW
+    /* queued entries point into sync cfg nodes, never carry them into another frame */
+    pstDrvCtx->stSnsShadow.u32PendNum = 0;
+#endif
+
     u8WDRMode = pstDrvCtx->stWDRCfg.u8WDRMode;
     pstCurNode = pstDrvCtx->stSyncCfg.apstNode[0];
     if (HI_NULL == pstCurNode)
@@ -1766,6 +1899,10 @@ HI_S32 ISP_DRV_RegConfigSensor(ISP_DRV_CTX_S *pstDrvCtx)
         return HI_SUCCESS;
     }
 
+    pstDrvCtx->stDrvDbgInfo.u32SensorCfgBytes = 0;
+    pstDrvCtx->stDrvDbgInfo.u32SensorCfgXfers = 0;
+    pstDrvCtx->stDrvDbgInfo.u32SensorCfgSkip  = 0;
+
     for (i=0; i<pstCurNode->stSnsRegsInfo.u32RegNum; i++)
     {
         /* config i2c */
@@ -1778,6 +1915,10 @@ HI_S32 ISP_DRV_RegConfigSensor(ISP_DRV_CTX_S *pstDrvCtx)
                 if (u8CfgNodeIdx > CFG2VLD_DLY_LIMIT-1)
                 {
                     ISP_TRACE(HI_DBG_WARN, "DelayFrmNum error!\n");
+#ifdef ISP_SNS_SHADOW
+                    /* the registers before this one are written, as without the shadow */
+                    ISP_DRV_SnsI2cFlush(pstDrvCtx);
+#endif
                     return HI_FAILURE;
                 }
                 
@@ -1809,12 +1950,19 @@ HI_S32 ISP_DRV_RegConfigSensor(ISP_DRV_CTX_S *pstDrvCtx)
                     pstI2cData = &pstCfgNode->stSnsRegsInfo.astI2cData[i];
                     if (pstI2cData->bUpdate == HI_TRUE)
                     {
+#ifdef ISP_SNS_SHADOW
+                        ISP_DRV_SnsI2cQueue(pstDrvCtx, i, pstI2cData);
+#else
                         if (HI_NULL != pstDrvCtx->stBusCb.pfnISPWriteI2CData)
                         {
                             pstDrvCtx->stBusCb.pfnISPWriteI2CData(pstI2cData->u8DevAddr,
                                 pstI2cData->u32RegAddr, pstI2cData->u32AddrByteNum,
                                 pstI2cData->u32Data, pstI2cData->u32DataByteNum);
+                            pstDrvCtx->stDrvDbgInfo.u32SensorCfgBytes += 1 + pstI2cData->u32AddrByteNum
+                                + pstI2cData->u32DataByteNum;
+                            pstDrvCtx->stDrvDbgInfo.u32SensorCfgXfers++;
                         }
+#endif
                     }
                 }
                 else
@@ -1833,6 +1981,9 @@ HI_S32 ISP_DRV_RegConfigSensor(ISP_DRV_CTX_S *pstDrvCtx)
                 if (u8CfgNodeIdx > CFG2VLD_DLY_LIMIT-1)
                 {
                     ISP_TRACE(HI_DBG_WARN, "DelayFrmNum error!\n");
+#ifdef ISP_SNS_SHADOW
+                    ISP_DRV_SnsI2cFlush(pstDrvCtx);
+#endif
                     return HI_FAILURE;
                 }
                 
@@ -1886,6 +2037,10 @@ HI_S32 ISP_DRV_RegConfigSensor(ISP_DRV_CTX_S *pstDrvCtx)
         }
     }
 
+#ifdef ISP_SNS_SHADOW
+    ISP_DRV_SnsI2cFlush(pstDrvCtx);
+#endif
+
     return HI_SUCCESS;
 }
 
@@ -1904,6 +2059,7 @@ HI_S32 ISP_RegisterBusCallBack (ISP_DEV IspDev,
     if (ISP_BUS_TYPE_I2C == enType)
     {
         pstDrvCtx->stBusCb.pfnISPWriteI2CData = pstBusCb->pfnISPWriteI2CData;
+        pstDrvCtx->stBusCb.pfnISPWriteI2CBurst = pstBusCb->pfnISPWriteI2CBurst;
     }
     else if (ISP_BUS_TYPE_SSP == enType)
     {
@@ -2544,6 +2700,16 @@ static long ISP_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
             }   
             return HI_SUCCESS;
         }	
+        case ISP_SNS_SHADOW_RESET:
+        {
+#ifdef ISP_SNS_SHADOW
+            /* the sensor lib wrote the sensor behind the sync cfg, e.g. for pixel detect */
+            spin_lock_irqsave(&g_stIspLock, u32Flags);
+            ISP_DRV_SnsShadowReset(&g_astIspDrvCtx[IspDev]);
+            spin_unlock_irqrestore(&g_stIspLock, u32Flags);
+#endif
+            return 0;
+        }
         default:
         {
             return VREG_DRV_ioctl(file, cmd, arg);
@@ -3070,6 +3236,17 @@ static int ISP_ProcShow(struct seq_file *s, void *pArg)
 
     seq_printf(s, "\n");
 
+    seq_printf(s, "%12s" "%12s" "%12s" "%12s\n"
+            ,"","SnsCfgByte","SnsCfgXfer","SnsCfgSkip");
+
+    seq_printf(s, "%12s" "%12d" "%12d" "%12d\n",
+            "",
+            pstDrvCtx->stDrvDbgInfo.u32SensorCfgBytes,
+            pstDrvCtx->stDrvDbgInfo.u32SensorCfgXfers,
+            pstDrvCtx->stDrvDbgInfo.u32SensorCfgSkip);
+
+    seq_printf(s, "\n");
+
     /* TODO: show isp attribute here. width/height/bayer_format, etc..
       * Read parameter from memory directly.
       */
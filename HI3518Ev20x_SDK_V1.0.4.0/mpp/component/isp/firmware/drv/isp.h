@@ -86,6 +86,21 @@ typedef struct hiISP_SYNC_CFG_S
     ISP_SYNC_CFG_BUF_S   stSyncCfgBuf;
 } ISP_SYNC_CFG_S;
 
+#ifdef ISP_SNS_SHADOW
+#define ISP_SNS_BURST_DATA_MAX  16  /* max data bytes coalesced into one i2c write */
+
+/* Last value sent to each sensor register slot, and the writes queued in the current frame */
+typedef struct hiISP_SNS_SHADOW_S
+{
+    HI_BOOL         abValid[ISP_MAX_SNS_REGS];
+    ISP_I2C_DATA_S  astI2cData[ISP_MAX_SNS_REGS];
+
+    HI_U32          u32PendNum;
+    HI_U8           au8PendSlot[ISP_MAX_SNS_REGS];
+    ISP_I2C_DATA_S  *apstPend[ISP_MAX_SNS_REGS];
+} ISP_SNS_SHADOW_S;
+#endif
+
 typedef struct hiISP_DRV_DBG_INFO_S
 {
     HI_U64 u64IspLastIntTime;           /* Time of last interrupt, for debug */
@@ -110,6 +125,9 @@ typedef struct hiISP_DRV_DBG_INFO_S
     
     HI_U32 u32SensorCfgTime;            /* Time of sensor config, for debug */    
     HI_U32 u32SensorCfgTimeMax;         /* Maximal time of sensor config, for debug */    
+    HI_U32 u32SensorCfgBytes;           /* I2C bytes sent by the last sensor config, for debug */
+    HI_U32 u32SensorCfgXfers;           /* I2C transfers issued by the last sensor config, for debug */
+    HI_U32 u32SensorCfgSkip;            /* Unchanged registers dropped by the last sensor config, for debug */
     
     HI_U32 u32IspResetCnt;              /* Count of ISP reset when vi width or height changed */
 } ISP_DRV_DBG_INFO_S;
@@ -131,6 +149,9 @@ typedef struct hiISP_DRV_CTX_S
     
     ISP_WDR_CFG_S       stWDRCfg;
     ISP_SYNC_CFG_S      stSyncCfg;
+#ifdef ISP_SNS_SHADOW
+    ISP_SNS_SHADOW_S    stSnsShadow;
+#endif
 
     ISP_STAT_BUF_S      stStatisticsBuf;
     ISP_STAT_SHADOW_MEM_S stStatShadowMem;
@@ -39,6 +39,9 @@ typedef struct hiISP_BUS_CALLBACK_S
         HI_U32 u32RegAddrByteNum, HI_U32 u32Data, HI_U32 u32DataByteNum);
     HI_S32  (*pfnISPWriteSSPData) (HI_U32 u32DevAddr, HI_U32 u32DevAddrByteNum,
         HI_U32 u32RegAddr, HI_U32 u32RegAddrByteNum, HI_U32 u32Data, HI_U32 u32DataByteNum);
+    /* optional, write u32DataLen bytes from u32RegAddr in one transfer, data is MSB first */
+    HI_S32  (*pfnISPWriteI2CBurst) (HI_U8 u8DevAddr, HI_U32 u32RegAddr,
+        HI_U32 u32RegAddrByteNum, HI_U8 *pu8Data, HI_U32 u32DataLen);
 } ISP_BUS_CALLBACK_S;
 
 typedef struct hiISP_EXPORT_FUNC_S
@@ -68,6 +68,7 @@ typedef enum hiIOC_NR_ISP_E
     IOC_NR_ISP_SET_MOD_PARAM,
     IOC_NR_ISP_GET_MOD_PARAM,
 	IOC_NR_LSC_UPDATE_MODE_GET,
+    IOC_NR_ISP_SNS_SHADOW_RESET,
 
     IOC_NR_ISP_BUTT,
 } IOC_NR_ISP_E;
@@ -596,6 +597,8 @@ typedef struct hiISP_PROC_MEM_S
 
 #define ISP_LSC_UPDATE_MODE_GET _IOR(IOC_TYPE_ISP, IOC_NR_LSC_UPDATE_MODE_GET, HI_U32)
 
+#define ISP_SNS_SHADOW_RESET    _IO(IOC_TYPE_ISP, IOC_NR_ISP_SNS_SHADOW_RESET)
+
 #define ISP_GET_DEV(f)          ((HI_U32)((f)->private_data))
 
 #define ISP_CHECK_DEV(dev)\
@@ -17,6 +17,8 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <sys/ioctl.h>
+#include "mkp_isp.h"
 #include "isp_sensor.h"
 
 #ifdef __cplusplus
@@ -36,6 +38,7 @@ typedef struct hiISP_SENSOR_S
 } ISP_SENSOR_S;
 
 ISP_SENSOR_S g_astSensorCtx[ISP_MAX_DEV_NUM] = {{0}};
+extern HI_S32 g_as32IspFd[ISP_MAX_DEV_NUM];
 #define SENSOR_GET_CTX(dev, pstCtx)   pstCtx = &g_astSensorCtx[dev]
 
 HI_S32 ISP_SensorRegCallBack(ISP_DEV IspDev, SENSOR_ID SensorId, ISP_SENSOR_REGISTER_S *pstRegister)
@@ -227,6 +230,13 @@ HI_S32 ISP_SensorSetPixelDetect(ISP_DEV IspDev, HI_BOOL bEnable)
     if (HI_NULL != pstSensor->stRegister.stSnsExp.pfn_cmos_set_pixel_detect)
     {
         pstSensor->stRegister.stSnsExp.pfn_cmos_set_pixel_detect(bEnable);
+
+        /* exposure and gains went to the sensor directly, the driver must not drop
+         * the next sync writes as unchanged */
+        if (ioctl(g_as32IspFd[IspDev], ISP_SNS_SHADOW_RESET))
+        {
+            printf("reset sensor shadow failed!\n");
+        }
     }
     else
     {
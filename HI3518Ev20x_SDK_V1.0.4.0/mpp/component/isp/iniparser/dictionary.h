@@ -80,6 +80,12 @@ typedef struct _dictionary_ {
 	                                2,at the key line's right;
 	                                3,Line of commnet or at the key line's behind;
 	                                4,Space Line;*/
+
+	/* open addressing index over key[], see dictionary_lookup() */
+	int          *  index ;     /** Hash buckets: slot in key[] + 1, 0 empty, -1 deleted */
+	int             indexSize ; /** Number of buckets, a power of 2 */
+	int             indexFill ; /** Buckets not empty, deleted ones included */
+	int             freeSlot ;  /** Every slot of key[] below this one is in use */
 } dictionary ;
 
 
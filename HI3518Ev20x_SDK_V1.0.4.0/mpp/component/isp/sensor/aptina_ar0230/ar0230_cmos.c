@@ -1265,6 +1265,14 @@ HI_U32 cmos_get_sns_regs_info(ISP_SNS_REGS_INFO_S *pstSnsRegsInfo)
     }
     else
     {
+#ifdef ISP_SNS_SHADOW
+        /* the isp driver keeps what was really sent on the bus and drops unchanged values
+         * itself, comparing here would lose an update if its sync node was not accepted */
+        for (i=0; i<g_stSnsRegsInfo.u32RegNum; i++)
+        {
+            g_stSnsRegsInfo.astI2cData[i].bUpdate = HI_TRUE;
+        }
+#else
         for (i=0; i<g_stSnsRegsInfo.u32RegNum; i++)
         {
             if (g_stSnsRegsInfo.astI2cData[i].u32Data == g_stPreSnsRegsInfo.astI2cData[i].u32Data)
@@ -1276,6 +1284,7 @@ HI_U32 cmos_get_sns_regs_info(ISP_SNS_REGS_INFO_S *pstSnsRegsInfo)
                 g_stSnsRegsInfo.astI2cData[i].bUpdate = HI_TRUE;
             }
         }
+#endif
     }
     
     if (HI_NULL == pstSnsRegsInfo)
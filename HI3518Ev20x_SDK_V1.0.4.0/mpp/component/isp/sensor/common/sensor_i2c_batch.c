@@ -0,0 +1,210 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2013, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : sensor_i2c_batch.c
+  Version       : Initial Draft
+  Author        : Hisilicon BVT ISP group
+  Created       : 2016/03/18
+  Description   : batched I2C programming of sensor register tables
+  History       :
+  1.Date        : 2016/03/18
+  Author        :
+  Modification  : Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "sensor_i2c_batch.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+typedef struct hiSENSOR_I2C_BATCH_CTX_S
+{
+    struct i2c_msg          astMsg[SENSOR_I2C_MAX_MSGS];
+    HI_U8                   au8Buf[SENSOR_I2C_BUF_SIZE];
+    HI_U32                  u32MsgNum;
+    HI_U32                  u32BufLen;
+    HI_U32                  u32BurstNum;    /* registers in the last message */
+    HI_U16                  u16NextAddr;    /* address that continues the last message */
+    const SENSOR_I2C_REG_S *pstPend;        /* first table entry not on the bus yet */
+    HI_U32                  u32PendNum;
+} SENSOR_I2C_BATCH_CTX_S;
+
+/* set once the adapter rejected I2C_RDWR, later tables go register by register */
+static HI_BOOL s_bRdwrUnsupported = HI_FALSE;
+
+static void sensor_i2c_batch_single(const SENSOR_I2C_BATCH_CFG_S *pstCfg,
+    const SENSOR_I2C_REG_S *pstReg, HI_U32 u32Num, SENSOR_I2C_BATCH_STAT_S *pstStat)
+{
+    HI_U32 i;
+
+    for (i = 0; i < u32Num; i++)
+    {
+        pstCfg->pfnWriteReg(pstReg[i].u16Addr, pstReg[i].u16Data);
+    }
+
+    pstStat->u32RegNum  += u32Num;
+    pstStat->u32MsgNum  += u32Num;
+    pstStat->u32XferNum += u32Num;
+    pstStat->u32ByteNum += u32Num * (pstCfg->u8AddrByte + pstCfg->u8DataByte);
+}
+
+static int sensor_i2c_batch_flush(int fd, const SENSOR_I2C_BATCH_CFG_S *pstCfg,
+    SENSOR_I2C_BATCH_CTX_S *pstCtx, SENSOR_I2C_BATCH_STAT_S *pstStat)
+{
+    struct i2c_rdwr_ioctl_data stRdwr;
+    int ret = 0;
+
+    if (0 == pstCtx->u32MsgNum)
+    {
+        return 0;
+    }
+
+    stRdwr.msgs  = pstCtx->astMsg;
+    stRdwr.nmsgs = pstCtx->u32MsgNum;
+    if (ioctl(fd, I2C_RDWR, &stRdwr) >= 0)
+    {
+        pstStat->u32RegNum  += pstCtx->u32PendNum;
+        pstStat->u32MsgNum  += pstCtx->u32MsgNum;
+        pstStat->u32XferNum += 1;
+        pstStat->u32ByteNum += pstCtx->u32BufLen;
+    }
+    else if ((ENOTTY == errno) || (EINVAL == errno) || (EOPNOTSUPP == errno))
+    {
+        /* rejected before anything was sent, so the writes can be replayed */
+        printf("I2C_RDWR not supported, write sensor registers one by one!\n");
+        s_bRdwrUnsupported = HI_TRUE;
+        sensor_i2c_batch_single(pstCfg, pstCtx->pstPend, pstCtx->u32PendNum, pstStat);
+    }
+    else
+    {
+        printf("I2C_RDWR error!\n");
+        ret = -1;
+    }
+
+    pstCtx->u32MsgNum  = 0;
+    pstCtx->u32BufLen  = 0;
+    pstCtx->u32PendNum = 0;
+
+    return ret;
+}
+
+int sensor_i2c_batch_write(int fd, const SENSOR_I2C_BATCH_CFG_S *pstCfg,
+    const SENSOR_I2C_REG_S *pstTable, SENSOR_I2C_BATCH_STAT_S *pstStat)
+{
+    SENSOR_I2C_BATCH_CTX_S stCtx;
+    SENSOR_I2C_BATCH_STAT_S stStat = {0};
+    const SENSOR_I2C_REG_S *pstReg;
+    struct i2c_msg *pstMsg;
+    HI_U8 *pu8Buf;
+    HI_U32 u32RegLen = pstCfg->u8AddrByte + pstCfg->u8DataByte;
+    int ret = 0;
+
+    stCtx.u32MsgNum  = 0;
+    stCtx.u32BufLen  = 0;
+    stCtx.u32PendNum = 0;
+
+    for (pstReg = pstTable; SENSOR_I2C_END != pstReg->u16Addr; pstReg++)
+    {
+        if (SENSOR_I2C_DELAY == pstReg->u16Addr)
+        {
+            ret |= sensor_i2c_batch_flush(fd, pstCfg, &stCtx, &stStat);
+            usleep(pstReg->u16Data * 1000);
+            stStat.u32DelayMs += pstReg->u16Data;
+            continue;
+        }
+
+        if ((HI_TRUE != pstCfg->bRdwr) || (HI_TRUE == s_bRdwrUnsupported))
+        {
+            sensor_i2c_batch_single(pstCfg, pstReg, 1, &stStat);
+            continue;
+        }
+
+        if (0 == stCtx.u32PendNum)
+        {
+            stCtx.pstPend = pstReg;
+        }
+
+        if ((0 != stCtx.u32MsgNum) && (pstReg->u16Addr == stCtx.u16NextAddr)
+            && (stCtx.u32BurstNum < pstCfg->u16MaxBurst)
+            && (stCtx.u32BufLen + pstCfg->u8DataByte <= SENSOR_I2C_BUF_SIZE))
+        {
+            /* continue the auto-increment write of the last message */
+            pstMsg = &stCtx.astMsg[stCtx.u32MsgNum - 1];
+            stCtx.u32BurstNum++;
+        }
+        else
+        {
+            if ((SENSOR_I2C_MAX_MSGS == stCtx.u32MsgNum)
+                || (stCtx.u32BufLen + u32RegLen > SENSOR_I2C_BUF_SIZE))
+            {
+                ret |= sensor_i2c_batch_flush(fd, pstCfg, &stCtx, &stStat);
+                stCtx.pstPend = pstReg;
+                if (HI_TRUE == s_bRdwrUnsupported)
+                {
+                    sensor_i2c_batch_single(pstCfg, pstReg, 1, &stStat);
+                    continue;
+                }
+            }
+
+            pu8Buf = &stCtx.au8Buf[stCtx.u32BufLen];
+            pstMsg = &stCtx.astMsg[stCtx.u32MsgNum++];
+            pstMsg->addr  = pstCfg->u16DevAddr;
+            pstMsg->flags = 0;
+            pstMsg->len   = 0;
+            pstMsg->buf   = pu8Buf;
+
+            /* register address, MSB first on the bus */
+            if (2 == pstCfg->u8AddrByte)
+            {
+                *pu8Buf++ = pstReg->u16Addr >> 8;
+            }
+            *pu8Buf = pstReg->u16Addr & 0xFF;
+            pstMsg->len      += pstCfg->u8AddrByte;
+            stCtx.u32BufLen  += pstCfg->u8AddrByte;
+            stCtx.u32BurstNum = 1;
+        }
+
+        pu8Buf = &stCtx.au8Buf[stCtx.u32BufLen];
+        if (2 == pstCfg->u8DataByte)
+        {
+            *pu8Buf++ = pstReg->u16Data >> 8;
+        }
+        *pu8Buf = pstReg->u16Data & 0xFF;
+        pstMsg->len     += pstCfg->u8DataByte;
+        stCtx.u32BufLen += pstCfg->u8DataByte;
+        stCtx.u32PendNum++;
+        stCtx.u16NextAddr = pstReg->u16Addr + pstCfg->u8DataByte;
+    }
+
+    ret |= sensor_i2c_batch_flush(fd, pstCfg, &stCtx, &stStat);
+
+    if (HI_NULL != pstStat)
+    {
+        pstStat->u32RegNum  += stStat.u32RegNum;
+        pstStat->u32MsgNum  += stStat.u32MsgNum;
+        pstStat->u32XferNum += stStat.u32XferNum;
+        pstStat->u32ByteNum += stStat.u32ByteNum;
+        pstStat->u32DelayMs += stStat.u32DelayMs;
+    }
+
+    return ret;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,89 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2013, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : sensor_i2c_batch.h
+  Version       : Initial Draft
+  Author        : Hisilicon BVT ISP group
+  Created       : 2016/03/18
+  Description   : batched I2C programming of sensor register tables
+  History       :
+  1.Date        : 2016/03/18
+  Author        :
+  Modification  : Created file
+
+******************************************************************************/
+
+#ifndef __SENSOR_I2C_BATCH_H__
+#define __SENSOR_I2C_BATCH_H__
+
+#include "hi_type.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+/*
+ * A register table is an array of {addr, data} ended by SENSOR_I2C_END; a
+ * SENSOR_I2C_DELAY entry waits u16Data ms after the writes before it are on
+ * the bus (the same markers as sensor_prog).
+ *
+ * The writes between two delays are sent as combined I2C_RDWR transfers of up
+ * to SENSOR_I2C_MAX_MSGS messages. Writes to consecutive registers are merged
+ * into one auto-increment message of up to u16MaxBurst registers; repeated
+ * writes to one address (e.g. a sequencer port) stay separate messages.
+ * When the adapter does not support I2C_RDWR, or bRdwr is HI_FALSE, every
+ * register is written with pfnWriteReg.
+ *
+ * The messages are plain I2C writes, address and data MSB first, with no
+ * adapter flags; pfnWriteReg (sensor_write_register) instead sets the
+ * adapter's 16-bit register/data width and hands it LSB-first buffers. That
+ * the hi35xx adapter sends such messages verbatim is only checked against the
+ * loopback stub of sensor/common/test, not on a board, so the sensors build
+ * with bRdwr = HI_FALSE unless CONFIG_SENSOR_I2C_BATCH=y.
+ */
+#define SENSOR_I2C_DELAY        (0xFFFE)    /* u16Data: delay in ms */
+#define SENSOR_I2C_END          (0xFFFF)    /* end of table */
+
+#define SENSOR_I2C_MAX_MSGS     (42)        /* I2C_RDWR_IOCTL_MAX_MSGS of i2c-dev */
+#define SENSOR_I2C_BUF_SIZE     (512)       /* bytes of one I2C_RDWR transfer */
+
+typedef struct hiSENSOR_I2C_REG_S
+{
+    HI_U16  u16Addr;
+    HI_U16  u16Data;
+} SENSOR_I2C_REG_S;
+
+typedef struct hiSENSOR_I2C_BATCH_CFG_S
+{
+    HI_U16  u16DevAddr;         /* slave address, as given to I2C_SLAVE_FORCE */
+    HI_U8   u8AddrByte;         /* register address bytes, 1 or 2 */
+    HI_U8   u8DataByte;         /* register data bytes, 1 or 2; also the address step of consecutive registers */
+    HI_U16  u16MaxBurst;        /* max registers of one auto-increment write, 0 or 1: no merging */
+    HI_BOOL bRdwr;              /* HI_FALSE: write the table register by register */
+    int   (*pfnWriteReg)(int addr, int data);
+} SENSOR_I2C_BATCH_CFG_S;
+
+typedef struct hiSENSOR_I2C_BATCH_STAT_S
+{
+    HI_U32  u32RegNum;          /* registers written */
+    HI_U32  u32MsgNum;          /* I2C messages, one START and slave address each */
+    HI_U32  u32XferNum;         /* I2C_RDWR transfers, or pfnWriteReg calls */
+    HI_U32  u32ByteNum;         /* register address and data bytes on the bus */
+    HI_U32  u32DelayMs;         /* inline delays */
+} SENSOR_I2C_BATCH_STAT_S;
+
+/* pstStat may be HI_NULL, otherwise the counts are added to it */
+int sensor_i2c_batch_write(int fd, const SENSOR_I2C_BATCH_CFG_S *pstCfg,
+    const SENSOR_I2C_REG_S *pstTable, SENSOR_I2C_BATCH_STAT_S *pstStat);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#endif /* __SENSOR_I2C_BATCH_H__ */
@@ -0,0 +1,334 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2013, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : sensor_i2c_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon BVT ISP group
+  Created       : 2016/03/18
+  Description   : host harness of the sensor init tables: runs the init
+                  sequences of one sensor against a loopback I2C stub, once
+                  batched (I2C_RDWR) and once register by register, checks
+                  that the sensor sees the same register writes, and reports
+                  the transfers and the modelled init time.
+  History       :
+  1.Date        : 2016/03/18
+  Author        :
+  Modification  : Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "hi_comm_video.h"
+#include "sensor_i2c_batch.h"
+
+#define TEST_FD             (100)
+#define TEST_LOG_MAX        (8192)
+
+/* I2C_16BIT_REG and I2C_16BIT_DATA of the hi_i2c driver */
+#define TEST_I2C_16BIT_REG  (0x0709)
+#define TEST_I2C_16BIT_DATA (0x070a)
+
+/* sensor globals normally provided by xxx_cmos.c */
+HI_U8 gu8SensorImageMode = 1;
+WDR_MODE_E genSensorMode = WDR_MODE_NONE;
+HI_BOOL bSensorInit = HI_FALSE;
+
+void sensor_init();
+void sensor_exit();
+extern const unsigned int sensor_addr_byte;
+extern const unsigned int sensor_data_byte;
+
+typedef struct hiTEST_MODE_S
+{
+    const char *pszName;
+    HI_U8       u8ImageMode;
+    WDR_MODE_E  enWdrMode;
+} TEST_MODE_S;
+
+#ifdef TEST_SENSOR_OV2718
+static const char *s_pszSensor = "ov2718";
+static const TEST_MODE_S s_astMode[] =
+{
+    {"linear 1080p30",          1, WDR_MODE_NONE},
+    {"combined 12bit 1080p30",  1, WDR_MODE_BUILT_IN},
+};
+#else
+static const char *s_pszSensor = "ar0230";
+static const TEST_MODE_S s_astMode[] =
+{
+    {"linear 1080p30",  1, WDR_MODE_NONE},
+    {"linear 1080p60",  2, WDR_MODE_NONE},
+    {"wdr 1080p30",     1, WDR_MODE_BUILT_IN},
+};
+#endif
+#define TEST_MODE_NUM   (sizeof(s_astMode) / sizeof(s_astMode[0]))
+
+/* loopback I2C device: the register writes it decoded and what it cost */
+typedef struct hiTEST_I2C_STUB_S
+{
+    HI_BOOL     bNoRdwr;            /* reject I2C_RDWR like an adapter without it */
+    HI_U32      u32Slave;
+    HI_U32      u32RegByte;
+    HI_U32      u32DataByte;
+    HI_U32      au32Log[TEST_LOG_MAX];  /* addr << 16 | data */
+    HI_U32      u32LogNum;
+    HI_U32      u32Syscall;
+    HI_U32      u32Msg;
+    HI_U32      u32Byte;
+    HI_U64      u64DelayUs;
+} TEST_I2C_STUB_S;
+
+static TEST_I2C_STUB_S s_stStub;
+
+static void TEST_StubLog(HI_U32 u32Addr, HI_U32 u32Data)
+{
+    if (s_stStub.u32LogNum < TEST_LOG_MAX)
+    {
+        s_stStub.au32Log[s_stStub.u32LogNum] = (u32Addr << 16) | u32Data;
+    }
+    s_stStub.u32LogNum++;
+}
+
+/* the system calls of the sensor code land here instead of in libc */
+int open(const char *pathname, int flags, ...)
+{
+    if (0 == strncmp(pathname, "/dev/i2c-", 9))
+    {
+        return TEST_FD;
+    }
+    errno = ENOENT;
+    return -1;
+}
+
+int close(int fd)
+{
+    return (TEST_FD == fd) ? 0 : (int)syscall(SYS_close, fd);
+}
+
+int usleep(useconds_t usec)
+{
+    s_stStub.u64DelayUs += usec;
+    return 0;
+}
+
+ssize_t write(int fd, const void *buf, size_t count)
+{
+    const unsigned char *pu8Buf = buf;
+    HI_U32 u32Addr, u32Data, i = 0;
+
+    if (TEST_FD != fd)
+    {
+        return syscall(SYS_write, fd, buf, count);
+    }
+
+    /* hi_i2c write(): register address then data, low byte first */
+    s_stStub.u32Syscall++;
+    s_stStub.u32Msg++;
+    s_stStub.u32Byte += count;
+    u32Addr = pu8Buf[i++];
+    if (s_stStub.u32RegByte == 2)
+    {
+        u32Addr |= pu8Buf[i++] << 8;
+    }
+    u32Data = pu8Buf[i++];
+    if (s_stStub.u32DataByte == 2)
+    {
+        u32Data |= pu8Buf[i++] << 8;
+    }
+    if (i != count)
+    {
+        printf("stub: write of %u bytes, expected %u\n", (HI_U32)count, i);
+        return -1;
+    }
+    TEST_StubLog(u32Addr, u32Data);
+
+    return count;
+}
+
+static int TEST_StubRdwr(const struct i2c_rdwr_ioctl_data *pstRdwr)
+{
+    const struct i2c_msg *pstMsg;
+    HI_U32 i, j, u32Addr, u32Data, u32RegByte, u32DataByte;
+
+    if (HI_TRUE == s_stStub.bNoRdwr)
+    {
+        errno = ENOTTY;
+        return -1;
+    }
+
+    if (pstRdwr->nmsgs > SENSOR_I2C_MAX_MSGS)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    /* plain I2C: register address then data, MSB first, auto-increment */
+    u32RegByte  = sensor_addr_byte;
+    u32DataByte = sensor_data_byte;
+    for (i = 0; i < pstRdwr->nmsgs; i++)
+    {
+        pstMsg = &pstRdwr->msgs[i];
+        if ((pstMsg->addr != s_stStub.u32Slave) || (pstMsg->flags & I2C_M_RD)
+            || (pstMsg->len < u32RegByte + u32DataByte)
+            || ((pstMsg->len - u32RegByte) % u32DataByte))
+        {
+            printf("stub: bad message %u: addr 0x%x flags 0x%x len %u\n", i,
+                pstMsg->addr, pstMsg->flags, pstMsg->len);
+            errno = EIO;
+            return -1;
+        }
+
+        u32Addr = (2 == u32RegByte) ? ((pstMsg->buf[0] << 8) | pstMsg->buf[1]) : pstMsg->buf[0];
+        for (j = u32RegByte; j < pstMsg->len; j += u32DataByte)
+        {
+            u32Data = (2 == u32DataByte) ? ((pstMsg->buf[j] << 8) | pstMsg->buf[j + 1]) : pstMsg->buf[j];
+            TEST_StubLog(u32Addr, u32Data);
+            u32Addr += u32DataByte;
+        }
+        s_stStub.u32Msg++;
+        s_stStub.u32Byte += pstMsg->len;
+    }
+    s_stStub.u32Syscall++;
+
+    return pstRdwr->nmsgs;
+}
+
+int ioctl(int fd, unsigned long request, ...)
+{
+    va_list args;
+    unsigned long arg;
+
+    va_start(args, request);
+    arg = va_arg(args, unsigned long);
+    va_end(args);
+
+    if (TEST_FD != fd)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    switch (request)
+    {
+        case I2C_SLAVE_FORCE :
+            s_stStub.u32Slave = arg;
+            return 0;
+        case TEST_I2C_16BIT_REG :
+            s_stStub.u32Syscall++;
+            s_stStub.u32RegByte = arg ? 2 : 1;
+            return 0;
+        case TEST_I2C_16BIT_DATA :
+            s_stStub.u32Syscall++;
+            s_stStub.u32DataByte = arg ? 2 : 1;
+            return 0;
+        case I2C_RDWR :
+            return TEST_StubRdwr((const struct i2c_rdwr_ioctl_data *)arg);
+        default :
+            errno = ENOTTY;
+            return -1;
+    }
+}
+
+static HI_U64 TEST_GetTimeUs(HI_VOID)
+{
+    struct timeval stTime;
+
+    gettimeofday(&stTime, NULL);
+    return (HI_U64)stTime.tv_sec * 1000000 + stTime.tv_usec;
+}
+
+/* bus time: START + slave address per message, 9 clocks per byte, STOP */
+static HI_DOUBLE TEST_ModelUs(const TEST_I2C_STUB_S *pstRun, HI_DOUBLE dSclKhz, HI_DOUBLE dSyscallUs)
+{
+    HI_DOUBLE dClocks = pstRun->u32Msg * (1 + 9 + 1) + pstRun->u32Byte * 9.0;
+
+    return pstRun->u32Syscall * dSyscallUs + dClocks * 1000.0 / dSclKhz;
+}
+
+static HI_S32 TEST_RunMode(const TEST_MODE_S *pstMode, HI_BOOL bNoRdwr, TEST_I2C_STUB_S *pstRun,
+    HI_U64 *pu64HostUs)
+{
+    HI_U64 u64Start;
+
+    memset(&s_stStub, 0, sizeof(s_stStub));
+    s_stStub.bNoRdwr     = bNoRdwr;
+    s_stStub.u32RegByte  = 1;
+    s_stStub.u32DataByte = 1;
+
+    gu8SensorImageMode = pstMode->u8ImageMode;
+    genSensorMode      = pstMode->enWdrMode;
+    bSensorInit        = HI_FALSE;
+
+    u64Start = TEST_GetTimeUs();
+    sensor_init();
+    *pu64HostUs = TEST_GetTimeUs() - u64Start;
+    sensor_exit();
+
+    if (s_stStub.u32LogNum > TEST_LOG_MAX)
+    {
+        printf("stub: log overflow\n");
+        return HI_FAILURE;
+    }
+    memcpy(pstRun, &s_stStub, sizeof(s_stStub));
+
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    static TEST_I2C_STUB_S astBatch[TEST_MODE_NUM], astSingle[TEST_MODE_NUM];
+    HI_DOUBLE dSclKhz = (argc > 1) ? atof(argv[1]) : 400.0;
+    HI_DOUBLE dSyscallUs = (argc > 2) ? atof(argv[2]) : 20.0;
+    HI_DOUBLE dBatchUs, dSingleUs;
+    HI_U64 au64BatchHost[TEST_MODE_NUM], au64SingleHost[TEST_MODE_NUM];
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U32 i;
+    HI_BOOL bSame;
+
+    printf("%s init tables, loopback I2C stub: SCL %.0f kHz, %.0f us per system call\n",
+        s_pszSensor, dSclKhz, dSyscallUs);
+
+    /* the batch code keeps to single writes once I2C_RDWR was rejected, so batched first */
+    for (i = 0; i < TEST_MODE_NUM; i++)
+    {
+        s32Ret |= TEST_RunMode(&s_astMode[i], HI_FALSE, &astBatch[i], &au64BatchHost[i]);
+    }
+    for (i = 0; i < TEST_MODE_NUM; i++)
+    {
+        s32Ret |= TEST_RunMode(&s_astMode[i], HI_TRUE, &astSingle[i], &au64SingleHost[i]);
+    }
+
+    for (i = 0; i < TEST_MODE_NUM; i++)
+    {
+        bSame = (astBatch[i].u32LogNum == astSingle[i].u32LogNum)
+             && (0 == memcmp(astBatch[i].au32Log, astSingle[i].au32Log, astSingle[i].u32LogNum * sizeof(HI_U32)));
+        dBatchUs  = TEST_ModelUs(&astBatch[i], dSclKhz, dSyscallUs);
+        dSingleUs = TEST_ModelUs(&astSingle[i], dSclKhz, dSyscallUs);
+
+        printf("\n%s: %u registers, %llu ms inline delays, same register writes ... %s\n",
+            s_astMode[i].pszName, astSingle[i].u32LogNum, astBatch[i].u64DelayUs / 1000,
+            bSame ? "OK" : "FAIL");
+        printf("    single : %5u calls %5u msgs %6u bytes  model %7.1f ms  host %5llu us\n",
+            astSingle[i].u32Syscall, astSingle[i].u32Msg, astSingle[i].u32Byte,
+            dSingleUs / 1000, au64SingleHost[i]);
+        printf("    batched: %5u calls %5u msgs %6u bytes  model %7.1f ms  host %5llu us  x%.1f\n",
+            astBatch[i].u32Syscall, astBatch[i].u32Msg, astBatch[i].u32Byte,
+            dBatchUs / 1000, au64BatchHost[i], dSingleUs / dBatchUs);
+        s32Ret |= bSame ? HI_SUCCESS : HI_FAILURE;
+    }
+
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
@@ -81,6 +81,70 @@ int hi_sensor_i2c_write(unsigned char dev_addr,
 	return 0;   
 }
 
+/* 1: let the isp send consecutive sensor registers as one auto-increment write.
+ * The burst is a plain i2c_msg (flags 0, MSB first), not the I2C_M_16BIT_REG/DATA
+ * convention of hi_sensor_i2c_write, and is not verified on the hi35xx adapter yet. */
+static int i2c_burst = 0;
+module_param(i2c_burst, int, S_IRUGO);
+
+#define SENSOR_I2C_BURST_MAX    32
+
+int hi_sensor_i2c_write_burst(unsigned char dev_addr,
+                              unsigned int reg_addr, unsigned int reg_addr_num,
+                              unsigned char *data, unsigned int data_len)
+{
+    unsigned char tmp_buf[2 + SENSOR_I2C_BURST_MAX];
+    int ret = 0;
+    int idx = 0;
+    struct i2c_client *client = sensor_client;
+    struct i2c_msg msg;
+    unsigned int u32Tries = 0;
+
+    if (data_len > SENSOR_I2C_BURST_MAX)
+    {
+        return -EINVAL;
+    }
+
+    /* plain message, register address and data go out MSB first as given */
+    if (reg_addr_num == 2)
+    {
+        tmp_buf[idx++] = reg_addr >> 8;
+    }
+    tmp_buf[idx++] = reg_addr;
+    memcpy(&tmp_buf[idx], data, data_len);
+    idx += data_len;
+
+    msg.addr  = dev_addr;
+    msg.flags = 0;
+    msg.len   = idx;
+    msg.buf   = tmp_buf;
+
+    while (1)
+    {
+        ret = i2c_transfer(client->adapter, &msg, 1);
+        if (ret == 1)
+        {
+            break;
+        }
+        else if ((ret == -EAGAIN) && (in_atomic() || irqs_disabled()))
+        {
+            u32Tries++;
+            if (u32Tries > 5)
+            {
+                return -1;
+            }
+        }
+        else
+        {
+            printk("[%s %d] i2c_transfer error, ret=%d. \n", __func__, __LINE__,
+                ret);
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 int hi_i2c_read(unsigned char dev_addr, unsigned int reg_addr, 
                 unsigned int reg_addr_num, unsigned int data_byte_num)
 {
@@ -149,6 +213,10 @@ static int hi_dev_isp_register(void)
     ISP_BUS_CALLBACK_S stBusCb = {0};
     
     stBusCb.pfnISPWriteI2CData = hi_sensor_i2c_write;
+    if (i2c_burst)
+    {
+        stBusCb.pfnISPWriteI2CBurst = hi_sensor_i2c_write_burst;
+    }
     if (CKFN_ISP_RegisterBusCallBack())
     {
         CALL_ISP_RegisterBusCallBack(0, ISP_BUS_TYPE_I2C, &stBusCb);
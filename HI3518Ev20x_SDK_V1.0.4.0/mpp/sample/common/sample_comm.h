@@ -45,6 +45,7 @@
 #include "hi_vreg.h"
 #include "hi_sns_ctrl.h"
 
+#include <sys/uio.h>
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -277,6 +278,288 @@ typedef struct sample_venc_getstream_s
      HI_S32  s32Cnt;
 }SAMPLE_VENC_GETSTREAM_PARA_S;
 
+/* per frame consumer of the stream collector, called before the stream is released */
+typedef HI_S32 (*SAMPLE_VENC_STREAM_PROC_FN)(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+
+typedef struct sample_venc_collect_chn_s
+{
+    VENC_CHN VencChn;
+    HI_S32 s32OutFd;                            /* -1: none, else the packs of a frame go out in one writev */
+    SAMPLE_VENC_STREAM_PROC_FN pfnStreamProc;   /* NULL: none */
+    HI_VOID *pPrivate;
+    HI_S32 s32Worker;                           /* pool only: -1 any free worker when ready, else the one it is pinned to */
+}SAMPLE_VENC_COLLECT_CHN_S;
+
+typedef struct sample_venc_collect_stat_s
+{
+    HI_U64 u64Frames;
+    HI_U64 u64Bytes;
+    HI_U32 u32PackCap;          /* preallocated packs, the high-water mark of u32PackCount */
+    HI_U32 u32PackGrows;        /* times a frame needed more packs than preallocated */
+    HI_U32 u32GetErrs;
+    HI_U32 u32WriteErrs;
+    HI_U32 u32ProcErrs;
+    HI_U32 u32QueueDepth;       /* frames left in venc, sampled every few frames */
+    HI_U32 u32QueueMax;
+    HI_U64 u64LatencyUsSum;     /* pts to GetStream, over u64Frames */
+    HI_U32 u32LatencyUsMax;
+}SAMPLE_VENC_COLLECT_STAT_S;
+
+typedef enum sample_venc_writer_sync_e
+{
+    SAMPLE_VENC_WRITER_SYNC_CLOSE = 0,  /* fdatasync only when the writer is closed */
+    SAMPLE_VENC_WRITER_SYNC_BYTES,      /* after every u32SyncParam bytes on storage */
+    SAMPLE_VENC_WRITER_SYNC_PERIOD,     /* at most every u32SyncParam ms */
+}SAMPLE_VENC_WRITER_SYNC_E;
+
+typedef struct sample_venc_writer_attr_s
+{
+    PAYLOAD_TYPE_E enType;              /* decides which frames restart the file after a drop */
+    HI_U32 u32BufSize;                  /* bytes per buffer, a multiple of 4096 */
+    HI_U32 u32BufCnt;                   /* buffers in the queue, at least 2 */
+    HI_BOOL bDirect;                    /* O_DIRECT, falls back to buffered io where unsupported */
+    HI_BOOL bDropWhenFull;              /* HI_TRUE: drop whole frames instead of blocking the caller */
+    SAMPLE_VENC_WRITER_SYNC_E enSync;
+    HI_U32 u32SyncParam;
+}SAMPLE_VENC_WRITER_ATTR_S;
+
+typedef struct sample_venc_writer_stat_s
+{
+    HI_U64 u64Bytes;                    /* taken from the caller */
+    HI_U64 u64Written;                  /* on storage */
+    HI_U64 u64StallUsTotal;             /* caller time spent waiting for a free buffer */
+    HI_U32 u32StallUsMax;
+    HI_U32 u32Stalls;
+    HI_U32 u32DropFrames;
+    HI_U32 u32QueueMax;                 /* high-water mark of filled buffers waiting for the io thread */
+    HI_U32 u32Syncs;
+    HI_U32 u32WriteErrs;
+    HI_BOOL bDirect;
+}SAMPLE_VENC_WRITER_STAT_S;
+
+typedef struct sample_venc_prerec_attr_s
+{
+    PAYLOAD_TYPE_E enType;              /* decides where gops start */
+    HI_U32 u32PreMs;                    /* history kept, whole gops, the oldest starting at or before it */
+    HI_U32 u32BufSize;                  /* bytes of the ring, older gops are evicted early to fit */
+    HI_U32 u32MaxFrames;                /* frames the index holds, e.g. fps * seconds * 2 */
+}SAMPLE_VENC_PREREC_ATTR_S;
+
+typedef struct sample_venc_prerec_stat_s
+{
+    HI_U32 u32BufSize;
+    HI_U32 u32Used;                     /* bytes of the gops held */
+    HI_U32 u32Frames;
+    HI_U32 u32Gops;
+    HI_U32 u32SpanMs;                   /* oldest gop start to the newest frame */
+    HI_U64 u64EvictGops;
+    HI_U64 u64EvictBytes;
+    HI_U32 u32DropFrames;               /* frames that found no room, the gop they were in is dropped */
+    HI_U32 u32Flushes;
+    HI_U32 u32FlushUsLast;              /* flush call to the last byte handed to the fd */
+    HI_U32 u32FlushUsMax;
+}SAMPLE_VENC_PREREC_STAT_S;
+
+typedef struct sample_venc_prerec_flush_s
+{
+    HI_U64 u64StartPts;                 /* pts of the gop start the flush began with */
+    HI_U64 u64EndPts;                   /* pts of the last frame flushed, the live stream goes on after it */
+    HI_U32 u32Frames;
+    HI_U32 u32Bytes;
+}SAMPLE_VENC_PREREC_FLUSH_S;
+
+typedef struct sample_venc_mp4_attr_s
+{
+    PAYLOAD_TYPE_E enType;              /* PT_H264 or PT_H265 */
+    HI_U32 u32Width;
+    HI_U32 u32Height;
+    HI_U32 u32FragBufSize;              /* video bytes of one fragment, a gop is cut short when over */
+    HI_U32 u32MaxFrames;                /* video samples of one fragment */
+    PAYLOAD_TYPE_E enAudioType;         /* PT_AAC (lc), PT_G711A, PT_G711U, or PT_BUTT for no audio */
+    HI_U32 u32SampleRate;
+    HI_U32 u32AudioChn;
+    HI_U32 u32AudioBufSize;             /* audio bytes of one fragment, more are dropped */
+    HI_U32 u32MaxAudioFrames;
+}SAMPLE_VENC_MP4_ATTR_S;
+
+typedef struct sample_venc_mp4_stat_s
+{
+    HI_U64 u64Bytes;                    /* handed to the fd, init segment included */
+    HI_U32 u32Fragments;
+    HI_U32 u32CutFragments;             /* ended before the next key frame for lack of room */
+    HI_U32 u32VideoFrames;
+    HI_U32 u32AudioFrames;
+    HI_U32 u32DropVideo;                /* before the first key frame or larger than a fragment */
+    HI_U32 u32DropAudio;                /* before the first key frame or for lack of room */
+    HI_U32 u32WriteErrs;
+}SAMPLE_VENC_MP4_STAT_S;
+
+typedef enum sample_venc_rtp_mode_e
+{
+    SAMPLE_VENC_RTP_MODE_SINGLE = 0,    /* one nal per packet, packetization-mode=0 */
+    SAMPLE_VENC_RTP_MODE_FU,            /* nals over the mtu go in FU-A (h264) or FU (h265) packets */
+    SAMPLE_VENC_RTP_MODE_AGGR,          /* as FU, small nals in a row share a STAP-A (h264) or AP (h265) */
+}SAMPLE_VENC_RTP_MODE_E;
+
+typedef struct sample_venc_rtp_attr_s
+{
+    PAYLOAD_TYPE_E enType;              /* PT_H264 or PT_H265 */
+    SAMPLE_VENC_RTP_MODE_E enMode;
+    HI_U32 u32Mtu;                      /* largest rtp packet, header included, e.g. 1400 */
+    HI_U32 u32PayloadType;              /* dynamic, 96..127 */
+    HI_U32 u32Ssrc;
+    HI_U32 u32SeqBase;                  /* sequence number of the first packet */
+    HI_U32 u32TsBase;                   /* rtp timestamp of pts 0 */
+}SAMPLE_VENC_RTP_ATTR_S;
+
+typedef struct sample_venc_rtp_stat_s
+{
+    HI_U64 u64Packets;
+    HI_U64 u64Bytes;                    /* rtp headers included */
+    HI_U32 u32Frames;
+    HI_U32 u32SinglePackets;
+    HI_U32 u32AggrPackets;
+    HI_U32 u32FuPackets;
+    HI_U32 u32Oversize;                 /* nals over the mtu sent whole in single nal mode */
+    HI_U32 u32BadFrames;                /* more nals or packs than a frame may have, not sent */
+    HI_U32 u32SendErrs;
+}SAMPLE_VENC_RTP_STAT_S;
+
+#define SAMPLE_VENC_TELEMETRY_HIST_NUM  12
+
+typedef struct sample_venc_telemetry_attr_s
+{
+    PAYLOAD_TYPE_E enType;              /* decides the key frames */
+    HI_U32 u32ShortMs;                  /* window of the instantaneous figures, e.g. 1000 */
+    HI_U32 u32LongMs;                   /* window of the averages, e.g. 10000 */
+    HI_U32 u32MaxFrames;                /* frames the window ring holds, at least fps * u32LongMs / 1000 */
+    HI_U32 u32BacklogPeriod;            /* HI_MPI_VENC_Query every so many frames, 0 never */
+}SAMPLE_VENC_TELEMETRY_ATTR_S;
+
+/*
+ * Histogram bucket 0 holds values below 1 ms or 1 KB, bucket n values from
+ * 2^(n-1) up to 2^n ms or KB, the last one everything above.
+ */
+typedef struct sample_venc_telemetry_stat_s
+{
+    HI_U64 u64Frames;
+    HI_U64 u64Bytes;
+    HI_U32 u32AvgKbps;                  /* since the first frame */
+    HI_U32 u32ShortKbps;                /* over u32ShortMs */
+    HI_U32 u32LongKbps;                 /* over u32LongMs */
+    HI_U32 u32ShortFps100;              /* frame rate over u32ShortMs, in 1/100 fps */
+    HI_U32 u32IFrameBytesLast;
+    HI_U32 u32IFrameBytesAvg;           /* over u32LongMs */
+    HI_U32 u32IFrameBytesMax;           /* over u32LongMs */
+    HI_U32 u32PFrameBytesLast;
+    HI_U32 u32PFrameBytesAvg;           /* over u32LongMs */
+    HI_U32 u32PFrameBytesMax;           /* over u32LongMs */
+    HI_U32 u32GopFrames;                /* frames of the last whole gop */
+    HI_U32 u32GopFramesMin;             /* since the first frame */
+    HI_U32 u32GopFramesMax;
+    HI_U32 u32Gops;
+    HI_U32 u32QpLast;                   /* start qp of the frame, qfactor for jpeg */
+    HI_U32 u32QpAvg100;                 /* over u32LongMs, in 1/100 */
+    HI_U32 u32QpMin;                    /* over u32LongMs */
+    HI_U32 u32QpMax;                    /* over u32LongMs */
+    HI_U32 u32LatencyUsLast;            /* capture pts to telemetry */
+    HI_U32 u32LatencyUsAvg;             /* over u32LongMs */
+    HI_U32 u32LatencyUsMax;             /* over u32LongMs */
+    HI_U32 u32BacklogLast;              /* u32LeftStreamFrames of the last query */
+    HI_U32 u32BacklogMax;               /* over u32LongMs */
+    HI_U32 au32LatencyHist[SAMPLE_VENC_TELEMETRY_HIST_NUM];     /* ms, since the first frame */
+    HI_U32 au32IFrameHist[SAMPLE_VENC_TELEMETRY_HIST_NUM];      /* KB, since the first frame */
+    HI_U32 au32PFrameHist[SAMPLE_VENC_TELEMETRY_HIST_NUM];      /* KB, since the first frame */
+}SAMPLE_VENC_TELEMETRY_STAT_S;
+
+#define SAMPLE_VENC_SVCT_MAX_CONSUMER   8
+
+typedef struct sample_venc_svct_attr_s
+{
+    PAYLOAD_TYPE_E enType;              /* PT_H264 or PT_H265 */
+    HI_U32 u32WindowMs;                 /* window of the effective frame rate and bitrate, e.g. 1000 */
+}SAMPLE_VENC_SVCT_ATTR_S;
+
+typedef struct sample_venc_svct_consumer_s
+{
+    HI_U32 u32MaxLayer;                 /* highest temporal layer forwarded, 0 the base layer only */
+    SAMPLE_VENC_STREAM_PROC_FN pfnStreamProc;   /* runs under the channel lock, must not call the filter */
+    HI_VOID *pPrivate;
+}SAMPLE_VENC_SVCT_CONSUMER_S;
+
+typedef struct sample_venc_svct_stat_s
+{
+    HI_U64 u64Frames;                   /* forwarded */
+    HI_U64 u64Bytes;
+    HI_U64 u64Dropped;                  /* above the layer, or before the first key frame */
+    HI_U32 u32MaxLayer;                 /* in force */
+    HI_U32 u32PendingLayer;             /* taken at the next layer 0 frame, u32MaxLayer when none */
+    HI_U32 u32Switches;
+    HI_U32 u32Fps100;                   /* effective frame rate of the last window, in 1/100 fps */
+    HI_U32 u32Kbps;                     /* effective bitrate of the last window */
+    HI_U32 u32ProcErrs;
+}SAMPLE_VENC_SVCT_STAT_S;
+
+typedef struct sample_venc_burst_attr_s
+{
+    HI_U32 u32MaxFrames;                /* most frames of one burst */
+    HI_U32 u32FrameSize;                /* bytes preallocated per frame, larger jpegs are dropped */
+    HI_U32 u32TimeoutMs;                /* longest wait for the next frame of a burst */
+}SAMPLE_VENC_BURST_ATTR_S;
+
+typedef struct sample_venc_burst_frame_s
+{
+    const HI_U8 *pu8Jpeg;
+    HI_U32 u32JpegLen;
+    const HI_U8 *pu8Thumb;              /* the dcf thumbnail inside pu8Jpeg, NULL when there is none */
+    HI_U32 u32ThumbLen;
+    HI_U64 u64Pts;
+    HI_U32 u32ReadyUs;                  /* from the trigger until the frame is in memory */
+}SAMPLE_VENC_BURST_FRAME_S;
+
+/* the frames stay valid until the next burst of the channel or its destroy */
+typedef struct sample_venc_burst_s
+{
+    HI_U32 u32Frames;
+    const SAMPLE_VENC_BURST_FRAME_S *pstFrame;
+    HI_U32 u32FirstUs;                  /* burst latency, from the trigger to the first frame in memory */
+    HI_U32 u32TotalUs;                  /* from the trigger to the last frame in memory */
+    HI_U32 u32IntervalUsAvg;            /* pts interval of the frames achieved */
+    HI_U32 u32IntervalUsMax;
+    HI_U32 u32Dropped;                  /* over u32FrameSize or failed to get */
+    HI_U32 u32Stale;                    /* frames left from before the trigger, thrown away */
+}SAMPLE_VENC_BURST_S;
+
+/* 4:2:0 layouts of a raw yuv file frame or of a frame buffer */
+typedef enum sample_yuv_fmt_e
+{
+    SAMPLE_YUV_I420 = 0,                /* planar, U plane then V plane */
+    SAMPLE_YUV_YV12,                    /* planar, V plane then U plane */
+    SAMPLE_YUV_NV12,                    /* semi-planar, UVUV.. */
+    SAMPLE_YUV_NV21,                    /* semi-planar, VUVU.., PIXEL_FORMAT_YUV_SEMIPLANAR_420 */
+    SAMPLE_YUV_BUTT
+}SAMPLE_YUV_FMT_E;
+
+typedef struct sample_venc_yuv_reader_attr_s
+{
+    HI_CHAR acFile[FILE_NAME_LEN];
+    HI_U32 u32Width;
+    HI_U32 u32Height;
+    SAMPLE_YUV_FMT_E enSrcFmt;          /* of the file, I420 or YV12 */
+    SAMPLE_YUV_FMT_E enDstFmt;          /* of the frames handed out, NV12 or NV21 */
+    HI_U32 u32Buffers;                  /* frames read ahead, 2 at least */
+    HI_BOOL bLoop;                      /* start over at the end of the file */
+}SAMPLE_VENC_YUV_READER_ATTR_S;
+
+typedef struct sample_venc_yuv_reader_stat_s
+{
+    HI_U64 u64Frames;                   /* handed out */
+    HI_U32 u32Loops;                    /* times the file was started over */
+    HI_U64 u64ReadUs;                   /* the reader thread in fread */
+    HI_U64 u64ConvertUs;                /* converting into the frames handed out */
+    HI_U64 u64WaitUs;                   /* the caller waiting for the reader, the feed was i/o bound */
+}SAMPLE_VENC_YUV_READER_STAT_S;
+
 typedef struct sample_vi_config_s
 {
     SAMPLE_VI_MODE_E enViMode;
@@ -380,6 +663,54 @@ HI_S32 SAMPLE_COMM_VENC_StopGetStream();
 HI_S32 SAMPLE_COMM_VENC_BindVpss(VENC_CHN VencChn,VPSS_GRP VpssGrp,VPSS_CHN VpssChn);
 HI_S32 SAMPLE_COMM_VENC_UnBindVpss(VENC_CHN VencChn,VPSS_GRP VpssGrp,VPSS_CHN VpssChn);
 HI_S32 SAMPLE_COMM_VENC_StartGetStream_Svc_t(HI_S32 s32Cnt);
+HI_S32 SAMPLE_COMM_VENC_WritevAll(HI_S32 s32Fd, struct iovec *pstIov, HI_U32 u32IovCnt);
+HI_S32 SAMPLE_COMM_VENC_StartCollect(const SAMPLE_VENC_COLLECT_CHN_S *pastChn, HI_S32 s32Cnt);
+HI_S32 SAMPLE_COMM_VENC_StartCollectPool(const SAMPLE_VENC_COLLECT_CHN_S *pastChn, HI_S32 s32Cnt, HI_S32 s32Workers);
+HI_S32 SAMPLE_COMM_VENC_StopCollect(HI_VOID);
+HI_BOOL SAMPLE_COMM_VENC_IsKeyStream(PAYLOAD_TYPE_E enType, const VENC_STREAM_S *pstStream);
+HI_S32 SAMPLE_COMM_VENC_GetCollectStat(HI_S32 s32Index, SAMPLE_VENC_COLLECT_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_WriterOpen(VENC_CHN VencChn, const HI_CHAR *pszFile, const SAMPLE_VENC_WRITER_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_WriterStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+HI_S32 SAMPLE_COMM_VENC_WriterClose(VENC_CHN VencChn);
+HI_S32 SAMPLE_COMM_VENC_WriterGetStat(VENC_CHN VencChn, SAMPLE_VENC_WRITER_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_PrerecCreate(VENC_CHN VencChn, const SAMPLE_VENC_PREREC_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_PrerecDestroy(VENC_CHN VencChn);
+HI_S32 SAMPLE_COMM_VENC_PrerecStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+HI_S32 SAMPLE_COMM_VENC_PrerecFlush(VENC_CHN VencChn, HI_S32 s32Fd, HI_U32 u32PreMs, SAMPLE_VENC_PREREC_FLUSH_S *pstFlush);
+HI_S32 SAMPLE_COMM_VENC_PrerecGetStat(VENC_CHN VencChn, SAMPLE_VENC_PREREC_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_Mp4Open(VENC_CHN VencChn, HI_S32 s32Fd, const SAMPLE_VENC_MP4_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_Mp4Stream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+HI_S32 SAMPLE_COMM_VENC_Mp4Audio(VENC_CHN VencChn, const AUDIO_STREAM_S *pstStream);
+HI_S32 SAMPLE_COMM_VENC_Mp4Close(VENC_CHN VencChn);
+HI_S32 SAMPLE_COMM_VENC_Mp4GetStat(VENC_CHN VencChn, SAMPLE_VENC_MP4_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_RtpOpen(VENC_CHN VencChn, HI_S32 s32Sock, const SAMPLE_VENC_RTP_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_RtpStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+HI_S32 SAMPLE_COMM_VENC_RtpClose(VENC_CHN VencChn);
+HI_S32 SAMPLE_COMM_VENC_RtpGetStat(VENC_CHN VencChn, SAMPLE_VENC_RTP_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_TelemetryCreate(VENC_CHN VencChn, const SAMPLE_VENC_TELEMETRY_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_TelemetryDestroy(VENC_CHN VencChn);
+HI_S32 SAMPLE_COMM_VENC_TelemetryStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+HI_S32 SAMPLE_COMM_VENC_TelemetryGetStat(VENC_CHN VencChn, SAMPLE_VENC_TELEMETRY_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_TelemetryExport(VENC_CHN VencChn, HI_CHAR *pszBuf, HI_U32 u32Len);
+HI_U32 SAMPLE_COMM_VENC_GetSvctLayer(PAYLOAD_TYPE_E enType, const VENC_STREAM_S *pstStream);
+HI_S32 SAMPLE_COMM_VENC_SvctCreate(VENC_CHN VencChn, const SAMPLE_VENC_SVCT_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_SvctDestroy(VENC_CHN VencChn);
+HI_S32 SAMPLE_COMM_VENC_SvctAddConsumer(VENC_CHN VencChn, const SAMPLE_VENC_SVCT_CONSUMER_S *pstConsumer, HI_S32 *ps32Id);
+HI_S32 SAMPLE_COMM_VENC_SvctRemoveConsumer(VENC_CHN VencChn, HI_S32 s32Id);
+HI_S32 SAMPLE_COMM_VENC_SvctSetLayer(VENC_CHN VencChn, HI_S32 s32Id, HI_U32 u32MaxLayer);
+HI_S32 SAMPLE_COMM_VENC_SvctStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate);
+HI_S32 SAMPLE_COMM_VENC_SvctGetStat(VENC_CHN VencChn, HI_S32 s32Id, SAMPLE_VENC_SVCT_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_FindThumb(const HI_U8 *pu8Jpeg, HI_U32 u32Len, HI_U32 *pu32ThumbOff, HI_U32 *pu32ThumbLen);
+HI_S32 SAMPLE_COMM_VENC_BurstCreate(VENC_CHN VencChn, const SAMPLE_VENC_BURST_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_BurstCapture(VENC_CHN VencChn, HI_U32 u32Frames, SAMPLE_VENC_BURST_S *pstBurst);
+HI_S32 SAMPLE_COMM_VENC_BurstDestroy(VENC_CHN VencChn);
+HI_VOID SAMPLE_COMM_VENC_Interleave(const HI_U8 *pu8First, const HI_U8 *pu8Second, HI_U8 *pu8Dst, HI_U32 u32Num);
+HI_S32 SAMPLE_COMM_VENC_YuvConvert(const HI_U8 *pu8Src, SAMPLE_YUV_FMT_E enSrcFmt, HI_U8 *pu8DstY, HI_U8 *pu8DstC,
+                                   HI_U32 u32DstStride, SAMPLE_YUV_FMT_E enDstFmt, HI_U32 u32Width, HI_U32 u32Height);
+HI_S32 SAMPLE_COMM_VENC_YuvReaderStart(VENC_CHN VencChn, const SAMPLE_VENC_YUV_READER_ATTR_S *pstAttr);
+HI_S32 SAMPLE_COMM_VENC_YuvReaderGet(VENC_CHN VencChn, VIDEO_FRAME_S *pstFrame);
+HI_S32 SAMPLE_COMM_VENC_YuvReaderGetStat(VENC_CHN VencChn, SAMPLE_VENC_YUV_READER_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VENC_YuvReaderStop(VENC_CHN VencChn);
 
 
 HI_S32 SAMPLE_COMM_VDA_MdStart(VDA_CHN VdaChn, HI_U32 u32Chn, SIZE_S *pstSize);
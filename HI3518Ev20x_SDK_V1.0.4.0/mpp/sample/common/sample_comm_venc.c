@@ -738,6 +738,30 @@ HI_S32 SAMPLE_COMM_VENC_SaveStream(PAYLOAD_TYPE_E enType,FILE *pFd, VENC_STREAM_
     return s32Ret;
 }
 
+/******************************************************************************
+* funciton : whether a stream starts a gop, frames without a slice type are
+*            taken as key frames
+******************************************************************************/
+HI_BOOL SAMPLE_COMM_VENC_IsKeyStream(PAYLOAD_TYPE_E enType, const VENC_STREAM_S *pstStream)
+{
+    HI_U32 i;
+
+    if ((PT_H264 != enType) && (PT_H265 != enType))
+    {
+        return HI_TRUE;
+    }
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        if (((PT_H264 == enType) && (H264E_NALU_ISLICE == pstStream->pstPack[i].DataType.enH264EType))
+            || ((PT_H265 == enType) && (H265E_NALU_ISLICE == pstStream->pstPack[i].DataType.enH265EType)))
+        {
+            return HI_TRUE;
+        }
+    }
+
+    return HI_FALSE;
+}
+
 /******************************************************************************
 * funciton : Start venc stream mode (h264, mjpeg)
 * note      : rate control parameter need adjust, according your case.
@@ -1970,12 +1994,39 @@ HI_VOID SAMPLE_COMM_VENC_ReadOneFrame( FILE * fp, HI_U8 * pY, HI_U8 * pU, HI_U8
    
 }
 
+/******************************************************************************
+* funciton : interleave two chroma rows, pu8Dst gets first, second, first, ...
+******************************************************************************/
+HI_VOID SAMPLE_COMM_VENC_Interleave(const HI_U8 *pu8First, const HI_U8 *pu8Second, HI_U8 *pu8Dst, HI_U32 u32Num)
+{
+    HI_U32 i = 0;
+    HI_U32 u32First;
+    HI_U32 u32Second;
+    HI_U32 au32Out[2];
+
+    /* 4 pairs a step, spread in words; little endian, as the Hi35xx are */
+    for (; i + 4 <= u32Num; i += 4)
+    {
+        memcpy(&u32First, pu8First + i, 4);
+        memcpy(&u32Second, pu8Second + i, 4);
+        au32Out[0] = ((u32First & 0xFF) | ((u32First & 0xFF00) << 8))
+                   | (((u32Second & 0xFF) << 8) | ((u32Second & 0xFF00) << 16));
+        au32Out[1] = (((u32First >> 16) & 0xFF) | ((u32First >> 8) & 0xFF0000))
+                   | (((u32Second >> 8) & 0xFF00) | (u32Second & 0xFF000000));
+        memcpy(pu8Dst + 2 * i, au32Out, 8);
+    }
+    for (; i < u32Num; i++)
+    {
+        pu8Dst[2 * i] = pu8First[i];
+        pu8Dst[2 * i + 1] = pu8Second[i];
+    }
+}
+
 HI_S32 SAMPLE_COMM_VENC_PlanToSemi(HI_U8 *pY, HI_S32 yStride, 
                        HI_U8 *pU, HI_S32 uStride,
 					   HI_U8 *pV, HI_S32 vStride, 
 					   HI_S32 picWidth, HI_S32 picHeight)
 {
-    HI_S32 i;
     HI_U8* pTmpU, *ptu;
     HI_U8* pTmpV, *ptv;
     
@@ -1994,17 +2045,9 @@ HI_S32 SAMPLE_COMM_VENC_PlanToSemi(HI_U8 *pY, HI_S32 yStride,
     memcpy(pTmpU,pU,s32Size);
     memcpy(pTmpV,pV,s32Size);
     
-    for(i = 0;i<s32Size>>1;i++)
-    {
-        *pU++ = *pTmpV++;
-        *pU++ = *pTmpU++;
-        
-    }
-    for(i = 0;i<s32Size>>1;i++)
-    {
-        *pV++ = *pTmpV++;
-        *pV++ = *pTmpU++;        
-    }
+    /* V U V U .., the first half over the U plane, the second over the V plane */
+    SAMPLE_COMM_VENC_Interleave(pTmpV, pTmpU, pU, s32Size >> 1);
+    SAMPLE_COMM_VENC_Interleave(pTmpV + (s32Size >> 1), pTmpU + (s32Size >> 1), pV, s32Size >> 1);
 
     free( ptu );
     free( ptv );
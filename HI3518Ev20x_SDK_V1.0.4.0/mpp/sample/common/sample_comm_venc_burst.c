@@ -0,0 +1,403 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: burst jpeg snapshots into memory.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-4 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/select.h>
+
+#include "sample_comm.h"
+
+/*
+ * The jpeg channel is made by SAMPLE_COMM_VENC_SnapStart and stays as it
+ * is between bursts. Create takes its fd and allocates every frame slot and
+ * the pack array once. A burst arms the channel for N pictures with
+ * HI_MPI_VENC_StartRecvPicEx, so the encoder takes N pictures in a row at
+ * the vi rate. Each frame is copied into its slot and released at once. The
+ * thumbnail is found by walking the APP segments of that copy, nothing
+ * goes through the filesystem.
+ */
+#define SAMPLE_VENC_BURST_MAX_PACKS     16
+
+typedef struct sample_venc_burst_ctx_s
+{
+    HI_BOOL bCreate;
+    SAMPLE_VENC_BURST_ATTR_S stAttr;
+    HI_S32 s32VencFd;
+    HI_U8 *pu8Buf;                      /* u32MaxFrames slots of u32FrameSize */
+    SAMPLE_VENC_BURST_FRAME_S *pstFrame;
+    VENC_PACK_S astPack[SAMPLE_VENC_BURST_MAX_PACKS];
+    pthread_mutex_t Lock;
+}SAMPLE_VENC_BURST_CTX_S;
+
+static SAMPLE_VENC_BURST_CTX_S gs_astBurst[VENC_MAX_CHN_NUM];
+
+/* end of the jpeg starting at pu8Jpeg with its SOI, walking the marker segments and the scans */
+static HI_S32 SAMPLE_COMM_VENC_JpegEnd(const HI_U8 *pu8Jpeg, HI_U32 u32Len, HI_U32 *pu32End)
+{
+    HI_U32 u32Pos = 2;
+    HI_U32 u32SegLen;
+    HI_U8 u8Marker;
+
+    while (u32Pos + 1 < u32Len)
+    {
+        if (0xFF != pu8Jpeg[u32Pos])
+        {
+            return HI_FAILURE;
+        }
+        u8Marker = pu8Jpeg[u32Pos + 1];
+        if (0xFF == u8Marker)
+        {
+            u32Pos++;                   /* fill byte */
+            continue;
+        }
+        if (0xD9 == u8Marker)
+        {
+            *pu32End = u32Pos + 2;
+            return HI_SUCCESS;
+        }
+        if ((0x01 == u8Marker) || ((u8Marker >= 0xD0) && (u8Marker <= 0xD7)))
+        {
+            u32Pos += 2;
+            continue;
+        }
+        if (u32Pos + 3 >= u32Len)
+        {
+            return HI_FAILURE;
+        }
+        u32SegLen = ((HI_U32)pu8Jpeg[u32Pos + 2] << 8) | pu8Jpeg[u32Pos + 3];
+        if (u32SegLen < 2)
+        {
+            return HI_FAILURE;
+        }
+        u32Pos += 2 + u32SegLen;
+        if (0xDA != u8Marker)
+        {
+            continue;
+        }
+        /* entropy data: 0xFF is stuffed with 0x00, restart markers go on with it */
+        while ((u32Pos + 1 < u32Len) && ((0xFF != pu8Jpeg[u32Pos]) || (0x00 == pu8Jpeg[u32Pos + 1])
+               || ((pu8Jpeg[u32Pos + 1] >= 0xD0) && (pu8Jpeg[u32Pos + 1] <= 0xD7))))
+        {
+            u32Pos += (0xFF == pu8Jpeg[u32Pos]) ? 2 : 1;
+        }
+    }
+
+    return HI_FAILURE;
+}
+
+/******************************************************************************
+* funciton : find the thumbnail jpeg a dcf jpeg carries in its APP segments,
+*            in memory, as FileTrans_GetThmFromJpg does on the saved file
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_FindThumb(const HI_U8 *pu8Jpeg, HI_U32 u32Len, HI_U32 *pu32ThumbOff, HI_U32 *pu32ThumbLen)
+{
+    HI_U32 u32Pos = 2;
+    HI_U32 u32SegLen;
+    HI_U32 u32SegEnd;
+    HI_U32 u32End;
+    HI_U32 i;
+    HI_U8 u8Marker;
+
+    if ((NULL == pu8Jpeg) || (NULL == pu32ThumbOff) || (NULL == pu32ThumbLen)
+        || (u32Len < 4) || (0xFF != pu8Jpeg[0]) || (0xD8 != pu8Jpeg[1]))
+    {
+        return HI_FAILURE;
+    }
+
+    /* the APP segments come before the frame header, stop at the first scan */
+    while (u32Pos + 3 < u32Len)
+    {
+        if (0xFF != pu8Jpeg[u32Pos])
+        {
+            return HI_FAILURE;
+        }
+        u8Marker = pu8Jpeg[u32Pos + 1];
+        if ((0xDA == u8Marker) || (0xD9 == u8Marker))
+        {
+            break;
+        }
+        u32SegLen = ((HI_U32)pu8Jpeg[u32Pos + 2] << 8) | pu8Jpeg[u32Pos + 3];
+        u32SegEnd = u32Pos + 2 + u32SegLen;
+        if ((u32SegLen < 2) || (u32SegEnd > u32Len))
+        {
+            return HI_FAILURE;
+        }
+        if ((u8Marker >= 0xE0) && (u8Marker <= 0xEF))
+        {
+            for (i = u32Pos + 4; i + 3 < u32SegEnd; i++)
+            {
+                if ((0xFF == pu8Jpeg[i]) && (0xD8 == pu8Jpeg[i + 1]) && (0xFF == pu8Jpeg[i + 2])
+                    && (HI_SUCCESS == SAMPLE_COMM_VENC_JpegEnd(pu8Jpeg + i, u32SegEnd - i, &u32End)))
+                {
+                    *pu32ThumbOff = i;
+                    *pu32ThumbLen = u32End;
+                    return HI_SUCCESS;
+                }
+            }
+        }
+        u32Pos = u32SegEnd;
+    }
+
+    return HI_FAILURE;
+}
+
+/******************************************************************************
+* funciton : get ready for bursts on a jpeg channel made by SAMPLE_COMM_VENC_SnapStart,
+*            all frame memory is allocated here
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_BurstCreate(VENC_CHN VencChn, const SAMPLE_VENC_BURST_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_BURST_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstAttr)
+        || (0 == pstAttr->u32MaxFrames) || (pstAttr->u32FrameSize < 4) || (0 == pstAttr->u32TimeoutMs))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astBurst[VencChn];
+    if (HI_TRUE == pstCtx->bCreate)
+    {
+        SAMPLE_PRT("burst of chn[%d] is created already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_BURST_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_BURST_ATTR_S));
+    pstCtx->s32VencFd = HI_MPI_VENC_GetFd(VencChn);
+    if (pstCtx->s32VencFd < 0)
+    {
+        SAMPLE_PRT("HI_MPI_VENC_GetFd chn[%d] failed with %#x!\n", VencChn, pstCtx->s32VencFd);
+        return HI_FAILURE;
+    }
+    pstCtx->pu8Buf = (HI_U8 *)malloc((size_t)pstAttr->u32MaxFrames * pstAttr->u32FrameSize);
+    pstCtx->pstFrame = (SAMPLE_VENC_BURST_FRAME_S *)malloc(sizeof(SAMPLE_VENC_BURST_FRAME_S) * pstAttr->u32MaxFrames);
+    if ((NULL == pstCtx->pu8Buf) || (NULL == pstCtx->pstFrame))
+    {
+        SAMPLE_PRT("malloc burst buffer failed!\n");
+        free(pstCtx->pu8Buf);
+        free(pstCtx->pstFrame);
+        return HI_FAILURE;
+    }
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pstCtx->bCreate = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/* wait for the next frame and copy it into its slot, HI_FAILURE on time out */
+static HI_S32 SAMPLE_COMM_VENC_BurstGet(VENC_CHN VencChn, SAMPLE_VENC_BURST_CTX_S *pstCtx, HI_U8 *pu8Slot,
+                                        SAMPLE_VENC_BURST_FRAME_S *pstFrame, HI_BOOL *pbDropped)
+{
+    struct timeval TimeoutVal;
+    fd_set read_fds;
+    VENC_STREAM_S stStream;
+    HI_U32 u32Len;
+    HI_U32 u32Off = 0;
+    HI_S32 s32Ret;
+    HI_U32 i;
+
+    do
+    {
+        FD_ZERO(&read_fds);
+        FD_SET(pstCtx->s32VencFd, &read_fds);
+        TimeoutVal.tv_sec = pstCtx->stAttr.u32TimeoutMs / 1000;
+        TimeoutVal.tv_usec = (pstCtx->stAttr.u32TimeoutMs % 1000) * 1000;
+        s32Ret = select(pstCtx->s32VencFd + 1, &read_fds, NULL, NULL, &TimeoutVal);
+    } while ((s32Ret < 0) && (EINTR == errno));
+    if (s32Ret <= 0)
+    {
+        return HI_FAILURE;
+    }
+
+    *pbDropped = HI_TRUE;
+    memset(&stStream, 0, sizeof(stStream));
+    stStream.pstPack = pstCtx->astPack;
+    stStream.u32PackCount = SAMPLE_VENC_BURST_MAX_PACKS;
+    s32Ret = HI_MPI_VENC_GetStream(VencChn, &stStream, 0);
+    if (HI_SUCCESS != s32Ret)
+    {
+        SAMPLE_PRT("HI_MPI_VENC_GetStream chn[%d] failed with %#x!\n", VencChn, s32Ret);
+        return HI_SUCCESS;
+    }
+    for (i = 0; i < stStream.u32PackCount; i++)
+    {
+        u32Len = stStream.pstPack[i].u32Len - stStream.pstPack[i].u32Offset;
+        if (u32Off + u32Len > pstCtx->stAttr.u32FrameSize)
+        {
+            break;
+        }
+        memcpy(pu8Slot + u32Off, stStream.pstPack[i].pu8Addr + stStream.pstPack[i].u32Offset, u32Len);
+        u32Off += u32Len;
+    }
+    pstFrame->u64Pts = stStream.pstPack[0].u64PTS;
+    s32Ret = HI_MPI_VENC_ReleaseStream(VencChn, &stStream);
+    if (HI_SUCCESS != s32Ret)
+    {
+        SAMPLE_PRT("HI_MPI_VENC_ReleaseStream chn[%d] failed with %#x!\n", VencChn, s32Ret);
+    }
+    if (i < stStream.u32PackCount)
+    {
+        SAMPLE_PRT("jpeg of chn[%d] is over %u bytes, dropped\n", VencChn, pstCtx->stAttr.u32FrameSize);
+        return HI_SUCCESS;
+    }
+
+    *pbDropped = HI_FALSE;
+    pstFrame->pu8Jpeg = pu8Slot;
+    pstFrame->u32JpegLen = u32Off;
+    pstFrame->pu8Thumb = NULL;
+    pstFrame->u32ThumbLen = 0;
+    if (HI_SUCCESS == SAMPLE_COMM_VENC_FindThumb(pu8Slot, u32Off, &u32Off, &u32Len))
+    {
+        pstFrame->pu8Thumb = pu8Slot + u32Off;
+        pstFrame->u32ThumbLen = u32Len;
+    }
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : take u32Frames jpegs in a row into memory, blocks until they are
+*            all in or the next one times out. The frames got are in
+*            pstBurst either way, HI_FAILURE when fewer than asked
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_BurstCapture(VENC_CHN VencChn, HI_U32 u32Frames, SAMPLE_VENC_BURST_S *pstBurst)
+{
+    SAMPLE_VENC_BURST_CTX_S *pstCtx;
+    SAMPLE_VENC_BURST_FRAME_S *pstFrame;
+    VENC_RECV_PIC_PARAM_S stRecvParam;
+    VENC_STREAM_S stStream;
+    HI_U64 u64Start = 0;
+    HI_U64 u64Now;
+    HI_U64 u64Interval;
+    HI_U64 u64IntervalSum = 0;
+    HI_BOOL bDropped;
+    HI_U32 u32Taken = 0;
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstBurst) || (0 == u32Frames)
+        || (HI_TRUE != gs_astBurst[VencChn].bCreate) || (u32Frames > gs_astBurst[VencChn].stAttr.u32MaxFrames))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astBurst[VencChn];
+    memset(pstBurst, 0, sizeof(SAMPLE_VENC_BURST_S));
+    pstBurst->pstFrame = pstCtx->pstFrame;
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    /* a burst cut short before may have left frames behind */
+    memset(&stStream, 0, sizeof(stStream));
+    stStream.pstPack = pstCtx->astPack;
+    stStream.u32PackCount = SAMPLE_VENC_BURST_MAX_PACKS;
+    while (HI_SUCCESS == HI_MPI_VENC_GetStream(VencChn, &stStream, 0))
+    {
+        HI_MPI_VENC_ReleaseStream(VencChn, &stStream);
+        stStream.u32PackCount = SAMPLE_VENC_BURST_MAX_PACKS;
+        pstBurst->u32Stale++;
+    }
+
+    (HI_VOID)HI_MPI_SYS_GetCurPts(&u64Start);
+    stRecvParam.s32RecvPicNum = (HI_S32)u32Frames;
+    s32Ret = HI_MPI_VENC_StartRecvPicEx(VencChn, &stRecvParam);
+    if (HI_SUCCESS != s32Ret)
+    {
+        pthread_mutex_unlock(&pstCtx->Lock);
+        SAMPLE_PRT("HI_MPI_VENC_StartRecvPicEx chn[%d] failed with %#x!\n", VencChn, s32Ret);
+        return HI_FAILURE;
+    }
+
+    while (u32Taken < u32Frames)
+    {
+        pstFrame = &pstCtx->pstFrame[pstBurst->u32Frames];
+        if (HI_SUCCESS != SAMPLE_COMM_VENC_BurstGet(VencChn, pstCtx,
+                pstCtx->pu8Buf + (size_t)pstBurst->u32Frames * pstCtx->stAttr.u32FrameSize, pstFrame, &bDropped))
+        {
+            SAMPLE_PRT("burst of chn[%d] timed out after %u of %u frames\n", VencChn, u32Taken, u32Frames);
+            (HI_VOID)HI_MPI_VENC_StopRecvPic(VencChn);
+            s32Ret = HI_FAILURE;
+            break;
+        }
+        u32Taken++;
+        if (HI_TRUE == bDropped)
+        {
+            pstBurst->u32Dropped++;
+            continue;
+        }
+        u64Now = 0;
+        (HI_VOID)HI_MPI_SYS_GetCurPts(&u64Now);
+        pstFrame->u32ReadyUs = (u64Now > u64Start) ? (HI_U32)(u64Now - u64Start) : 0;
+        pstBurst->u32Frames++;
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    if (0 != pstBurst->u32Frames)
+    {
+        pstBurst->u32FirstUs = pstCtx->pstFrame[0].u32ReadyUs;
+        pstBurst->u32TotalUs = pstCtx->pstFrame[pstBurst->u32Frames - 1].u32ReadyUs;
+    }
+    for (i = 1; i < pstBurst->u32Frames; i++)
+    {
+        u64Interval = pstCtx->pstFrame[i].u64Pts - pstCtx->pstFrame[i - 1].u64Pts;
+        u64IntervalSum += u64Interval;
+        if (u64Interval > pstBurst->u32IntervalUsMax)
+        {
+            pstBurst->u32IntervalUsMax = (HI_U32)u64Interval;
+        }
+    }
+    if (pstBurst->u32Frames > 1)
+    {
+        pstBurst->u32IntervalUsAvg = (HI_U32)(u64IntervalSum / (pstBurst->u32Frames - 1));
+    }
+    if (pstBurst->u32Frames < u32Frames)
+    {
+        s32Ret = HI_FAILURE;
+    }
+
+    return s32Ret;
+}
+
+/******************************************************************************
+* funciton : free the frame memory of a channel, the jpeg channel stays
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_BurstDestroy(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_BURST_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astBurst[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astBurst[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->bCreate = HI_FALSE;
+    free(pstCtx->pu8Buf);
+    free(pstCtx->pstFrame);
+    pstCtx->pu8Buf = NULL;
+    pstCtx->pstFrame = NULL;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    pthread_mutex_destroy(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,535 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: epoll based venc stream collector.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-3 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+
+#include "sample_comm.h"
+
+/*
+ * One thread serves every channel: the venc fds sit in one epoll set that is
+ * built once, and each channel keeps its VENC_PACK_S and iovec arrays between
+ * frames. The arrays start at SAMPLE_VENC_COLLECT_INIT_PACKS and only grow
+ * when HI_MPI_VENC_GetStream rejects a frame with more packs, so
+ * HI_MPI_VENC_Query is only called on that slow path and every
+ * SAMPLE_VENC_COLLECT_DEPTH_PERIOD frames for the queue depth. One frame is
+ * taken per readiness event: epoll reports a channel with frames left again
+ * at once, and draining would cost an extra HI_ERR_VENC_BUF_EMPTY call per
+ * event.
+ *
+ * With a pool, each worker waits on its own epoll set holding the channels
+ * pinned to it and the shared set. Unpinned channels sit in the shared set
+ * with EPOLLONESHOT: the first free worker takes one ready channel out of it,
+ * and the channel is armed again only after its frame is released, so a
+ * channel is never in two workers at once and keeps its frame order.
+ */
+#define SAMPLE_VENC_COLLECT_INIT_PACKS      8
+#define SAMPLE_VENC_COLLECT_TIMEOUT         2000
+#define SAMPLE_VENC_COLLECT_MAX_WORKERS     8
+#define SAMPLE_VENC_COLLECT_DEPTH_PERIOD    16
+#define SAMPLE_VENC_COLLECT_EV_WAKE         VENC_MAX_CHN_NUM
+#define SAMPLE_VENC_COLLECT_EV_SHARED       (VENC_MAX_CHN_NUM + 1)
+
+typedef struct sample_venc_collect_ctx_s
+{
+    SAMPLE_VENC_COLLECT_CHN_S stChn;
+    HI_S32 s32VencFd;
+    VENC_PACK_S *pstPack;
+    struct iovec *pstIov;
+    HI_BOOL bShared;
+    SAMPLE_VENC_COLLECT_STAT_S stStat;
+}SAMPLE_VENC_COLLECT_CTX_S;
+
+typedef struct sample_venc_collect_worker_s
+{
+    HI_S32 s32Index;
+    HI_S32 s32Epfd;
+    pthread_t Pid;
+}SAMPLE_VENC_COLLECT_WORKER_S;
+
+static SAMPLE_VENC_COLLECT_CTX_S gs_astCollect[VENC_MAX_CHN_NUM];
+static SAMPLE_VENC_COLLECT_WORKER_S gs_astCollectWorker[SAMPLE_VENC_COLLECT_MAX_WORKERS];
+static HI_S32 gs_s32CollectCnt = 0;
+static HI_S32 gs_s32CollectWorkers = 0;
+static HI_S32 gs_s32CollectEpfd = -1;       /* the shared set of a pool */
+static HI_S32 gs_s32CollectWakeFd = -1;
+static HI_BOOL gs_bCollectStart = HI_FALSE;
+static pthread_mutex_t gs_CollectLock = PTHREAD_MUTEX_INITIALIZER;
+
+static HI_S32 SAMPLE_COMM_VENC_CollectGrow(SAMPLE_VENC_COLLECT_CTX_S *pstCtx, HI_U32 u32Packs)
+{
+    VENC_PACK_S *pstPack;
+    struct iovec *pstIov;
+
+    pstPack = (VENC_PACK_S *)realloc(pstCtx->pstPack, sizeof(VENC_PACK_S) * u32Packs);
+    if (NULL == pstPack)
+    {
+        return HI_FAILURE;
+    }
+    pstCtx->pstPack = pstPack;
+    pstIov = (struct iovec *)realloc(pstCtx->pstIov, sizeof(struct iovec) * u32Packs);
+    if (NULL == pstIov)
+    {
+        return HI_FAILURE;
+    }
+    pstCtx->pstIov = pstIov;
+    pstCtx->stStat.u32PackCap = u32Packs;
+
+    return HI_SUCCESS;
+}
+
+/* all packs of one frame in a single writev */
+static HI_S32 SAMPLE_COMM_VENC_WritevStream(HI_S32 s32Fd, const VENC_STREAM_S *pstStream, struct iovec *pstIov)
+{
+    HI_U32 i;
+    HI_U32 u32IovCnt = 0;
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        if (pstStream->pstPack[i].u32Len > pstStream->pstPack[i].u32Offset)
+        {
+            pstIov[u32IovCnt].iov_base = pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset;
+            pstIov[u32IovCnt].iov_len = pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+            u32IovCnt++;
+        }
+    }
+
+    return SAMPLE_COMM_VENC_WritevAll(s32Fd, pstIov, u32IovCnt);
+}
+
+/* one frame of one channel, HI_ERR_VENC_BUF_EMPTY when it has none left */
+static HI_S32 SAMPLE_COMM_VENC_CollectFrame(SAMPLE_VENC_COLLECT_CTX_S *pstCtx)
+{
+    VENC_STREAM_S stStream;
+    VENC_CHN_STAT_S stStat;
+    HI_U64 u64Now;
+    HI_U32 u32LatencyUs;
+    HI_U32 u32Bytes = 0;
+    HI_BOOL bDepth;
+    HI_U32 i;
+    HI_S32 s32Ret;
+
+    memset(&stStream, 0, sizeof(stStream));
+    stStream.pstPack = pstCtx->pstPack;
+    stStream.u32PackCount = pstCtx->stStat.u32PackCap;
+    s32Ret = HI_MPI_VENC_GetStream(pstCtx->stChn.VencChn, &stStream, 0);
+    if (HI_ERR_VENC_BUF_EMPTY == s32Ret)
+    {
+        return s32Ret;
+    }
+    if (HI_SUCCESS != s32Ret)
+    {
+        /* slow path: the frame may just have more packs than preallocated */
+        if ((HI_SUCCESS != HI_MPI_VENC_Query(pstCtx->stChn.VencChn, &stStat)) || (0 == stStat.u32CurPacks))
+        {
+            return HI_ERR_VENC_BUF_EMPTY;
+        }
+        if (stStat.u32CurPacks <= pstCtx->stStat.u32PackCap)
+        {
+            SAMPLE_PRT("HI_MPI_VENC_GetStream chn[%d] failed with %#x!\n", pstCtx->stChn.VencChn, s32Ret);
+            pstCtx->stStat.u32GetErrs++;
+            return s32Ret;
+        }
+        if (HI_SUCCESS != SAMPLE_COMM_VENC_CollectGrow(pstCtx, stStat.u32CurPacks))
+        {
+            SAMPLE_PRT("chn[%d] no memory for %u packs!\n", pstCtx->stChn.VencChn, stStat.u32CurPacks);
+            pstCtx->stStat.u32GetErrs++;
+            return HI_FAILURE;
+        }
+        pstCtx->stStat.u32PackGrows++;
+
+        memset(&stStream, 0, sizeof(stStream));
+        stStream.pstPack = pstCtx->pstPack;
+        stStream.u32PackCount = pstCtx->stStat.u32PackCap;
+        s32Ret = HI_MPI_VENC_GetStream(pstCtx->stChn.VencChn, &stStream, 0);
+        if (HI_SUCCESS != s32Ret)
+        {
+            SAMPLE_PRT("HI_MPI_VENC_GetStream chn[%d] failed with %#x!\n", pstCtx->stChn.VencChn, s32Ret);
+            pstCtx->stStat.u32GetErrs++;
+            return s32Ret;
+        }
+    }
+
+    /* retrieval latency from the capture pts, the queue depth now and then */
+    u64Now = 0;
+    (HI_VOID)HI_MPI_SYS_GetCurPts(&u64Now);
+    u32LatencyUs = (u64Now > stStream.pstPack[0].u64PTS) ? (HI_U32)(u64Now - stStream.pstPack[0].u64PTS) : 0;
+    bDepth = (0 == (pstCtx->stStat.u64Frames % SAMPLE_VENC_COLLECT_DEPTH_PERIOD)) ? HI_TRUE : HI_FALSE;
+    if ((HI_TRUE == bDepth) && (HI_SUCCESS != HI_MPI_VENC_Query(pstCtx->stChn.VencChn, &stStat)))
+    {
+        bDepth = HI_FALSE;
+    }
+
+    if ((pstCtx->stChn.s32OutFd >= 0)
+        && (HI_SUCCESS != SAMPLE_COMM_VENC_WritevStream(pstCtx->stChn.s32OutFd, &stStream, pstCtx->pstIov)))
+    {
+        pstCtx->stStat.u32WriteErrs++;
+    }
+    if ((NULL != pstCtx->stChn.pfnStreamProc)
+        && (HI_SUCCESS != pstCtx->stChn.pfnStreamProc(pstCtx->stChn.VencChn, &stStream, pstCtx->stChn.pPrivate)))
+    {
+        pstCtx->stStat.u32ProcErrs++;
+    }
+    for (i = 0; i < stStream.u32PackCount; i++)
+    {
+        u32Bytes += stStream.pstPack[i].u32Len - stStream.pstPack[i].u32Offset;
+    }
+
+    s32Ret = HI_MPI_VENC_ReleaseStream(pstCtx->stChn.VencChn, &stStream);
+    if (HI_SUCCESS != s32Ret)
+    {
+        SAMPLE_PRT("HI_MPI_VENC_ReleaseStream chn[%d] failed with %#x!\n", pstCtx->stChn.VencChn, s32Ret);
+    }
+
+    pthread_mutex_lock(&gs_CollectLock);
+    pstCtx->stStat.u64Frames++;
+    pstCtx->stStat.u64Bytes += u32Bytes;
+    pstCtx->stStat.u64LatencyUsSum += u32LatencyUs;
+    if (u32LatencyUs > pstCtx->stStat.u32LatencyUsMax)
+    {
+        pstCtx->stStat.u32LatencyUsMax = u32LatencyUs;
+    }
+    if (HI_TRUE == bDepth)
+    {
+        pstCtx->stStat.u32QueueDepth = stStat.u32LeftStreamFrames;
+        if (stStat.u32LeftStreamFrames > pstCtx->stStat.u32QueueMax)
+        {
+            pstCtx->stStat.u32QueueMax = stStat.u32LeftStreamFrames;
+        }
+    }
+    pthread_mutex_unlock(&gs_CollectLock);
+
+    return HI_SUCCESS;
+}
+
+static HI_VOID* SAMPLE_COMM_VENC_CollectProc(HI_VOID *p)
+{
+    SAMPLE_VENC_COLLECT_WORKER_S *pstWorker = (SAMPLE_VENC_COLLECT_WORKER_S *)p;
+    struct epoll_event astEvent[VENC_MAX_CHN_NUM + 2];
+    struct epoll_event stShared;
+    SAMPLE_VENC_COLLECT_CTX_S *pstCtx;
+    HI_S32 s32EventCnt;
+    HI_S32 i;
+
+    while (HI_TRUE == gs_bCollectStart)
+    {
+        s32EventCnt = epoll_wait(pstWorker->s32Epfd, astEvent, gs_s32CollectCnt + 2, SAMPLE_VENC_COLLECT_TIMEOUT);
+        if (s32EventCnt < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            SAMPLE_PRT("epoll_wait failed!\n");
+            break;
+        }
+        else if (0 == s32EventCnt)
+        {
+            SAMPLE_PRT("get venc stream time out (worker %d)\n", pstWorker->s32Index);
+            continue;
+        }
+
+        for (i = 0; i < s32EventCnt; i++)
+        {
+            /* a ready channel of the shared set, unless another worker was faster */
+            if (SAMPLE_VENC_COLLECT_EV_SHARED == astEvent[i].data.u32)
+            {
+                if (1 != epoll_wait(gs_s32CollectEpfd, &stShared, 1, 0))
+                {
+                    continue;
+                }
+                pstCtx = &gs_astCollect[stShared.data.u32];
+                (HI_VOID)SAMPLE_COMM_VENC_CollectFrame(pstCtx);
+                stShared.events = EPOLLIN | EPOLLONESHOT;
+                if (epoll_ctl(gs_s32CollectEpfd, EPOLL_CTL_MOD, pstCtx->s32VencFd, &stShared) < 0)
+                {
+                    SAMPLE_PRT("epoll_ctl rearm chn[%d] failed!\n", pstCtx->stChn.VencChn);
+                }
+                continue;
+            }
+            /* the wake fd only breaks the wait, the loop condition decides */
+            if (astEvent[i].data.u32 >= (HI_U32)gs_s32CollectCnt)
+            {
+                continue;
+            }
+            (HI_VOID)SAMPLE_COMM_VENC_CollectFrame(&gs_astCollect[astEvent[i].data.u32]);
+        }
+    }
+
+    return NULL;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_CollectFree(HI_VOID)
+{
+    HI_S32 i;
+
+    /* the statistics stay readable until the next start */
+    for (i = 0; i < gs_s32CollectCnt; i++)
+    {
+        free(gs_astCollect[i].pstPack);
+        gs_astCollect[i].pstPack = NULL;
+        free(gs_astCollect[i].pstIov);
+        gs_astCollect[i].pstIov = NULL;
+    }
+    for (i = 0; i < SAMPLE_VENC_COLLECT_MAX_WORKERS; i++)
+    {
+        if (gs_astCollectWorker[i].s32Epfd >= 0)
+        {
+            close(gs_astCollectWorker[i].s32Epfd);
+            gs_astCollectWorker[i].s32Epfd = -1;
+        }
+    }
+    if (gs_s32CollectEpfd >= 0)
+    {
+        close(gs_s32CollectEpfd);
+        gs_s32CollectEpfd = -1;
+    }
+    if (gs_s32CollectWakeFd >= 0)
+    {
+        close(gs_s32CollectWakeFd);
+        gs_s32CollectWakeFd = -1;
+    }
+}
+
+static HI_VOID SAMPLE_COMM_VENC_CollectJoin(HI_S32 s32Workers)
+{
+    HI_U64 u64Wake = 1;
+    HI_S32 i;
+
+    gs_bCollectStart = HI_FALSE;
+    /* never read, so it wakes every worker */
+    if (write(gs_s32CollectWakeFd, &u64Wake, sizeof(u64Wake)) < 0)
+    {
+        SAMPLE_PRT("wake collector failed, it stops at the next timeout\n");
+    }
+    for (i = 0; i < s32Workers; i++)
+    {
+        pthread_join(gs_astCollectWorker[i].Pid, 0);
+    }
+}
+
+/******************************************************************************
+* funciton : writev continued over short writes, the iovecs are consumed
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_WritevAll(HI_S32 s32Fd, struct iovec *pstIov, HI_U32 u32IovCnt)
+{
+    ssize_t s32Len;
+
+    while (u32IovCnt > 0)
+    {
+        s32Len = writev(s32Fd, pstIov, u32IovCnt);
+        if (s32Len < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return HI_FAILURE;
+        }
+        while ((u32IovCnt > 0) && ((size_t)s32Len >= pstIov->iov_len))
+        {
+            s32Len -= pstIov->iov_len;
+            pstIov++;
+            u32IovCnt--;
+        }
+        if (u32IovCnt > 0)
+        {
+            pstIov->iov_base = (HI_U8 *)pstIov->iov_base + s32Len;
+            pstIov->iov_len -= s32Len;
+        }
+    }
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : start the epoll stream collector over s32Cnt venc channels
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_StartCollect(const SAMPLE_VENC_COLLECT_CHN_S *pastChn, HI_S32 s32Cnt)
+{
+    return SAMPLE_COMM_VENC_StartCollectPool(pastChn, s32Cnt, 1);
+}
+
+/******************************************************************************
+* funciton : start the collector with s32Workers threads, s32Worker of each
+*            channel pins it to one of them or leaves it to any (-1)
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_StartCollectPool(const SAMPLE_VENC_COLLECT_CHN_S *pastChn, HI_S32 s32Cnt, HI_S32 s32Workers)
+{
+    struct epoll_event stEvent;
+    SAMPLE_VENC_COLLECT_CTX_S *pstCtx;
+    HI_S32 s32Epfd;
+    HI_S32 i;
+
+    if ((NULL == pastChn) || (s32Cnt <= 0) || (s32Cnt > VENC_MAX_CHN_NUM)
+        || (s32Workers <= 0) || (s32Workers > SAMPLE_VENC_COLLECT_MAX_WORKERS))
+    {
+        SAMPLE_PRT("input count invaild\n");
+        return HI_FAILURE;
+    }
+    /* a single worker takes every channel whatever s32Worker says */
+    for (i = 0; (s32Workers > 1) && (i < s32Cnt); i++)
+    {
+        if ((pastChn[i].s32Worker < -1) || (pastChn[i].s32Worker >= s32Workers))
+        {
+            SAMPLE_PRT("chn[%d] worker %d invaild\n", pastChn[i].VencChn, pastChn[i].s32Worker);
+            return HI_FAILURE;
+        }
+    }
+    if (HI_TRUE == gs_bCollectStart)
+    {
+        SAMPLE_PRT("collector is started already\n");
+        return HI_FAILURE;
+    }
+
+    memset(gs_astCollect, 0, sizeof(gs_astCollect));
+    gs_s32CollectCnt = 0;
+    for (i = 0; i < SAMPLE_VENC_COLLECT_MAX_WORKERS; i++)
+    {
+        gs_astCollectWorker[i].s32Index = i;
+        gs_astCollectWorker[i].s32Epfd = -1;
+    }
+    gs_s32CollectEpfd = epoll_create(s32Cnt + 1);
+    gs_s32CollectWakeFd = eventfd(0, 0);
+    if ((gs_s32CollectEpfd < 0) || (gs_s32CollectWakeFd < 0))
+    {
+        SAMPLE_PRT("epoll_create/eventfd failed!\n");
+        SAMPLE_COMM_VENC_CollectFree();
+        return HI_FAILURE;
+    }
+    for (i = 0; i < s32Workers; i++)
+    {
+        gs_astCollectWorker[i].s32Epfd = epoll_create(s32Cnt + 2);
+        if (gs_astCollectWorker[i].s32Epfd < 0)
+        {
+            SAMPLE_PRT("epoll_create failed!\n");
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+        memset(&stEvent, 0, sizeof(stEvent));
+        stEvent.events = EPOLLIN;
+        stEvent.data.u32 = SAMPLE_VENC_COLLECT_EV_WAKE;
+        if (epoll_ctl(gs_astCollectWorker[i].s32Epfd, EPOLL_CTL_ADD, gs_s32CollectWakeFd, &stEvent) < 0)
+        {
+            SAMPLE_PRT("epoll_ctl failed!\n");
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+        stEvent.data.u32 = SAMPLE_VENC_COLLECT_EV_SHARED;
+        if ((s32Workers > 1) && (epoll_ctl(gs_astCollectWorker[i].s32Epfd, EPOLL_CTL_ADD, gs_s32CollectEpfd, &stEvent) < 0))
+        {
+            SAMPLE_PRT("epoll_ctl failed!\n");
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+    }
+
+    for (i = 0; i < s32Cnt; i++)
+    {
+        pstCtx = &gs_astCollect[i];
+        memcpy(&pstCtx->stChn, &pastChn[i], sizeof(SAMPLE_VENC_COLLECT_CHN_S));
+        gs_s32CollectCnt = i + 1;
+
+        if (HI_SUCCESS != SAMPLE_COMM_VENC_CollectGrow(pstCtx, SAMPLE_VENC_COLLECT_INIT_PACKS))
+        {
+            SAMPLE_PRT("malloc stream pack failed!\n");
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+        pstCtx->s32VencFd = HI_MPI_VENC_GetFd(pstCtx->stChn.VencChn);
+        if (pstCtx->s32VencFd < 0)
+        {
+            SAMPLE_PRT("HI_MPI_VENC_GetFd failed with %#x!\n", pstCtx->s32VencFd);
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+        pstCtx->bShared = ((s32Workers > 1) && (-1 == pstCtx->stChn.s32Worker)) ? HI_TRUE : HI_FALSE;
+        if (HI_TRUE == pstCtx->bShared)
+        {
+            s32Epfd = gs_s32CollectEpfd;
+            stEvent.events = EPOLLIN | EPOLLONESHOT;
+        }
+        else
+        {
+            s32Epfd = gs_astCollectWorker[(s32Workers > 1) ? pstCtx->stChn.s32Worker : 0].s32Epfd;
+            stEvent.events = EPOLLIN;
+        }
+        stEvent.data.u32 = i;
+        if (epoll_ctl(s32Epfd, EPOLL_CTL_ADD, pstCtx->s32VencFd, &stEvent) < 0)
+        {
+            SAMPLE_PRT("epoll_ctl chn[%d] failed!\n", pstCtx->stChn.VencChn);
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+    }
+
+    gs_bCollectStart = HI_TRUE;
+    for (i = 0; i < s32Workers; i++)
+    {
+        if (0 != pthread_create(&gs_astCollectWorker[i].Pid, 0, SAMPLE_COMM_VENC_CollectProc, &gs_astCollectWorker[i]))
+        {
+            SAMPLE_PRT("create collect worker %d failed!\n", i);
+            SAMPLE_COMM_VENC_CollectJoin(i);
+            SAMPLE_COMM_VENC_CollectFree();
+            return HI_FAILURE;
+        }
+    }
+    gs_s32CollectWorkers = s32Workers;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop the stream collector, frames not taken yet stay in venc
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_StopCollect(HI_VOID)
+{
+    if (HI_TRUE == gs_bCollectStart)
+    {
+        SAMPLE_COMM_VENC_CollectJoin(gs_s32CollectWorkers);
+        SAMPLE_COMM_VENC_CollectFree();
+    }
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : statistics of the s32Index-th channel of the last StartCollect
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_GetCollectStat(HI_S32 s32Index, SAMPLE_VENC_COLLECT_STAT_S *pstStat)
+{
+    if ((NULL == pstStat) || (s32Index < 0) || (s32Index >= gs_s32CollectCnt))
+    {
+        return HI_FAILURE;
+    }
+
+    pthread_mutex_lock(&gs_CollectLock);
+    memcpy(pstStat, &gs_astCollect[s32Index].stStat, sizeof(SAMPLE_VENC_COLLECT_STAT_S));
+    pthread_mutex_unlock(&gs_CollectLock);
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
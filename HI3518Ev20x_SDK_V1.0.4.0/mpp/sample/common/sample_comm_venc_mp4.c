@@ -0,0 +1,953 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: fragmented mp4 muxer of venc/aenc streams.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-4 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "sample_comm.h"
+
+/*
+ * The init segment (ftyp + moov) goes out at the first key frame, with the
+ * parameter sets taken from its packs into avcC/hvcC. Each gop then becomes
+ * one moof + mdat: video samples are converted to length-prefixed nal units
+ * as they are copied into the fragment buffer, their trun entries are filled
+ * in the same pass, and audio frames given in between land in a second traf.
+ * The fragment leaves in one writev when the next key frame comes. Every
+ * buffer is allocated on open.
+ */
+#define SAMPLE_VENC_MP4_TIMESCALE   90000
+#define SAMPLE_VENC_MP4_MAX_PARAM   256
+#define SAMPLE_VENC_MP4_INIT_SIZE   2048
+#define SAMPLE_VENC_MP4_HEAD_SIZE   128
+#define SAMPLE_VENC_MP4_VIDEO_TRACK 1
+#define SAMPLE_VENC_MP4_AUDIO_TRACK 2
+
+#define SAMPLE_VENC_MP4_PARAM_VPS   0
+#define SAMPLE_VENC_MP4_PARAM_SPS   1
+#define SAMPLE_VENC_MP4_PARAM_PPS   2
+#define SAMPLE_VENC_MP4_PARAM_NUM   3
+
+/* trun entries: video duration, size and flags, audio duration and size */
+#define SAMPLE_VENC_MP4_VIDEO_ENTRY 12
+#define SAMPLE_VENC_MP4_AUDIO_ENTRY 8
+#define SAMPLE_VENC_MP4_FLAG_SYNC   0x02000000
+#define SAMPLE_VENC_MP4_FLAG_NOSYNC 0x01010000
+
+typedef struct sample_venc_mp4_ctx_s
+{
+    HI_BOOL bOpen;
+    HI_BOOL bInit;                      /* init segment written */
+    HI_BOOL bWaitKey;
+    HI_BOOL bAudioStart;
+    HI_S32 s32Fd;
+    SAMPLE_VENC_MP4_ATTR_S stAttr;
+    HI_U8 au8Param[SAMPLE_VENC_MP4_PARAM_NUM][SAMPLE_VENC_MP4_MAX_PARAM];
+    HI_U32 au32ParamLen[SAMPLE_VENC_MP4_PARAM_NUM];
+    HI_U8 au8Init[SAMPLE_VENC_MP4_INIT_SIZE];
+    HI_U8 au8Head[SAMPLE_VENC_MP4_HEAD_SIZE];
+    HI_U8 au8AudioHead[SAMPLE_VENC_MP4_HEAD_SIZE];
+    HI_U8 au8MdatHead[8];
+    HI_U8 *pu8Video;
+    HI_U32 u32VideoLen;
+    HI_U8 *pu8VideoEntry;
+    HI_U32 u32VideoCnt;
+    HI_U8 *pu8Audio;
+    HI_U32 u32AudioLen;
+    HI_U8 *pu8AudioEntry;
+    HI_U32 u32AudioCnt;
+    HI_U64 u64BasePts;                  /* pts of the first key frame, decode time 0 of both tracks */
+    HI_U64 u64VideoFragDts;
+    HI_U64 u64LastDts;
+    HI_U32 u32LastDuration;
+    HI_U64 u64AudioFragDts;
+    HI_U64 u64AudioDts;                 /* of the next audio frame, counted in samples */
+    HI_U32 u32Seq;
+    pthread_mutex_t Lock;
+    SAMPLE_VENC_MP4_STAT_S stStat;
+}SAMPLE_VENC_MP4_CTX_S;
+
+static SAMPLE_VENC_MP4_CTX_S gs_astMp4[VENC_MAX_CHN_NUM];
+
+static const HI_U32 gs_au32Mp4Matrix[9] = {0x00010000, 0, 0, 0, 0x00010000, 0, 0, 0, 0x40000000};
+static const HI_U32 gs_au32AacRate[13] = {96000, 88200, 64000, 48000, 44100, 32000, 24000, 22050, 16000,
+                                           12000, 11025, 8000, 7350};
+
+/* the sampling frequency index of an aac rate, 13 for one that has none */
+static HI_U32 SAMPLE_COMM_VENC_Mp4AacRateIdx(HI_U32 u32SampleRate)
+{
+    HI_U32 u32RateIdx;
+
+    for (u32RateIdx = 0; u32RateIdx < 13; u32RateIdx++)
+    {
+        if (gs_au32AacRate[u32RateIdx] == u32SampleRate)
+        {
+            break;
+        }
+    }
+    return u32RateIdx;
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4Put16(HI_U8 *p, HI_U32 u32Val)
+{
+    p[0] = (HI_U8)(u32Val >> 8);
+    p[1] = (HI_U8)u32Val;
+    return p + 2;
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4Put32(HI_U8 *p, HI_U32 u32Val)
+{
+    p[0] = (HI_U8)(u32Val >> 24);
+    p[1] = (HI_U8)(u32Val >> 16);
+    p[2] = (HI_U8)(u32Val >> 8);
+    p[3] = (HI_U8)u32Val;
+    return p + 4;
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4Put64(HI_U8 *p, HI_U64 u64Val)
+{
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, (HI_U32)(u64Val >> 32));
+    return SAMPLE_COMM_VENC_Mp4Put32(p, (HI_U32)u64Val);
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4PutZero(HI_U8 *p, HI_U32 u32Len)
+{
+    memset(p, 0, u32Len);
+    return p + u32Len;
+}
+
+/* box header with the size left 0, SAMPLE_COMM_VENC_Mp4End fills it */
+static HI_U8 *SAMPLE_COMM_VENC_Mp4Box(HI_U8 *p, const HI_CHAR *pszType)
+{
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    memcpy(p, pszType, 4);
+    return p + 4;
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4FullBox(HI_U8 *p, const HI_CHAR *pszType, HI_U32 u32Version, HI_U32 u32Flags)
+{
+    p = SAMPLE_COMM_VENC_Mp4Box(p, pszType);
+    return SAMPLE_COMM_VENC_Mp4Put32(p, (u32Version << 24) | u32Flags);
+}
+
+static HI_VOID SAMPLE_COMM_VENC_Mp4End(HI_U8 *pu8Box, const HI_U8 *p)
+{
+    (HI_VOID)SAMPLE_COMM_VENC_Mp4Put32(pu8Box, (HI_U32)(p - pu8Box));
+}
+
+/* full box header of a size known up front, the fragment boxes */
+static HI_U8 *SAMPLE_COMM_VENC_Mp4SizedBox(HI_U8 *p, HI_U32 u32Size, const HI_CHAR *pszType,
+                                           HI_U32 u32Version, HI_U32 u32Flags)
+{
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, u32Size);
+    memcpy(p, pszType, 4);
+    return SAMPLE_COMM_VENC_Mp4Put32(p + 4, (u32Version << 24) | u32Flags);
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4PutMatrix(HI_U8 *p)
+{
+    HI_U32 i;
+
+    for (i = 0; i < 9; i++)
+    {
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, gs_au32Mp4Matrix[i]);
+    }
+    return p;
+}
+
+/* general profile, compatibility, constraint and level of the sps, emulation prevention removed */
+static HI_VOID SAMPLE_COMM_VENC_Mp4H265Ptl(const HI_U8 *pu8Sps, HI_U32 u32Len, HI_U8 au8Ptl[12])
+{
+    HI_U32 u32Zero = 0;
+    HI_U32 i;
+    HI_U32 j = 0;
+
+    memset(au8Ptl, 0, 12);
+    /* 2 bytes nal header, 1 byte vps id / sub layers / nesting */
+    for (i = 3; (i < u32Len) && (j < 12); i++)
+    {
+        if ((u32Zero >= 2) && (0x03 == pu8Sps[i]))
+        {
+            u32Zero = 0;
+            continue;
+        }
+        u32Zero = (0 == pu8Sps[i]) ? u32Zero + 1 : 0;
+        au8Ptl[j++] = pu8Sps[i];
+    }
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4PutVideoConfig(SAMPLE_VENC_MP4_CTX_S *pstCtx, HI_U8 *p)
+{
+    const HI_U8 *pu8Sps = pstCtx->au8Param[SAMPLE_VENC_MP4_PARAM_SPS];
+    HI_U8 au8Ptl[12];
+    HI_U8 *pu8Box;
+    HI_U32 i;
+
+    if (PT_H264 == pstCtx->stAttr.enType)
+    {
+        pu8Box = p;
+        p = SAMPLE_COMM_VENC_Mp4Box(p, "avcC");
+        *p++ = 1;
+        *p++ = pu8Sps[1];               /* profile, compatibility, level */
+        *p++ = pu8Sps[2];
+        *p++ = pu8Sps[3];
+        *p++ = 0xFF;                    /* 4 byte nal lengths */
+        *p++ = 0xE1;
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_SPS]);
+        memcpy(p, pu8Sps, pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_SPS]);
+        p += pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_SPS];
+        *p++ = 1;
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_PPS]);
+        memcpy(p, pstCtx->au8Param[SAMPLE_VENC_MP4_PARAM_PPS], pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_PPS]);
+        p += pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_PPS];
+        if ((100 == pu8Sps[1]) || (110 == pu8Sps[1]) || (122 == pu8Sps[1]) || (144 == pu8Sps[1]))
+        {
+            *p++ = 0xFD;                /* 4:2:0, 8 bit */
+            *p++ = 0xF8;
+            *p++ = 0xF8;
+            *p++ = 0;
+        }
+        SAMPLE_COMM_VENC_Mp4End(pu8Box, p);
+        return p;
+    }
+
+    SAMPLE_COMM_VENC_Mp4H265Ptl(pu8Sps, pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_SPS], au8Ptl);
+    pu8Box = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "hvcC");
+    *p++ = 1;
+    memcpy(p, au8Ptl, 12);
+    p += 12;
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0xF000);
+    *p++ = 0xFC;
+    *p++ = 0xFD;                        /* 4:2:0, 8 bit */
+    *p++ = 0xF8;
+    *p++ = 0xF8;
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0);
+    *p++ = 0x0F;                        /* 1 temporal layer, nested, 4 byte nal lengths */
+    *p++ = SAMPLE_VENC_MP4_PARAM_NUM;
+    for (i = 0; i < SAMPLE_VENC_MP4_PARAM_NUM; i++)
+    {
+        *p++ = 0x80 | (32 + i);         /* vps, sps, pps nal types */
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 1);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, pstCtx->au32ParamLen[i]);
+        memcpy(p, pstCtx->au8Param[i], pstCtx->au32ParamLen[i]);
+        p += pstCtx->au32ParamLen[i];
+    }
+    SAMPLE_COMM_VENC_Mp4End(pu8Box, p);
+    return p;
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4PutAudioConfig(SAMPLE_VENC_MP4_CTX_S *pstCtx, HI_U8 *p)
+{
+    HI_U8 *pu8Box;
+    HI_U32 u32RateIdx;
+
+    if (PT_AAC != pstCtx->stAttr.enAudioType)
+    {
+        return p;
+    }
+    /* SAMPLE_COMM_VENC_Mp4Open took only rates with an index */
+    u32RateIdx = SAMPLE_COMM_VENC_Mp4AacRateIdx(pstCtx->stAttr.u32SampleRate);
+
+    pu8Box = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "esds", 0, 0);
+    *p++ = 0x03;                        /* es descriptor */
+    *p++ = 25;
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0);
+    *p++ = 0;
+    *p++ = 0x04;                        /* decoder config descriptor, mpeg-4 audio */
+    *p++ = 17;
+    *p++ = 0x40;
+    *p++ = 0x15;
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 3 + 4 + 4);
+    *p++ = 0x05;                        /* audio specific config, aac lc */
+    *p++ = 2;
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, (2 << 11) | (u32RateIdx << 7) | (pstCtx->stAttr.u32AudioChn << 3));
+    *p++ = 0x06;                        /* sl config */
+    *p++ = 1;
+    *p++ = 0x02;
+    SAMPLE_COMM_VENC_Mp4End(pu8Box, p);
+    return p;
+}
+
+static HI_U8 *SAMPLE_COMM_VENC_Mp4PutTrak(SAMPLE_VENC_MP4_CTX_S *pstCtx, HI_U8 *p, HI_BOOL bVideo)
+{
+    HI_U8 *apu8Box[8];
+    HI_U8 *pu8Entry;
+    HI_U32 u32Timescale;
+
+    u32Timescale = (HI_TRUE == bVideo) ? SAMPLE_VENC_MP4_TIMESCALE : pstCtx->stAttr.u32SampleRate;
+
+    apu8Box[0] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "trak");
+
+    apu8Box[1] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "tkhd", 0, 3);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 8);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, (HI_TRUE == bVideo) ? SAMPLE_VENC_MP4_VIDEO_TRACK : SAMPLE_VENC_MP4_AUDIO_TRACK);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 4 + 4 + 8 + 2 + 2);
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, (HI_TRUE == bVideo) ? 0 : 0x0100);
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0);
+    p = SAMPLE_COMM_VENC_Mp4PutMatrix(p);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, (HI_TRUE == bVideo) ? pstCtx->stAttr.u32Width << 16 : 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, (HI_TRUE == bVideo) ? pstCtx->stAttr.u32Height << 16 : 0);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[1], p);
+
+    apu8Box[1] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "mdia");
+    apu8Box[2] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "mdhd", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 8);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, u32Timescale);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0x55C4);   /* und */
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[2], p);
+
+    apu8Box[2] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "hdlr", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    memcpy(p, (HI_TRUE == bVideo) ? "vide" : "soun", 4);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p + 4, 12);
+    memcpy(p, (HI_TRUE == bVideo) ? "Video\0" : "Audio\0", 6);
+    p += 6;
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[2], p);
+
+    apu8Box[2] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "minf");
+    apu8Box[3] = p;
+    if (HI_TRUE == bVideo)
+    {
+        p = SAMPLE_COMM_VENC_Mp4FullBox(p, "vmhd", 0, 1);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 8);
+    }
+    else
+    {
+        p = SAMPLE_COMM_VENC_Mp4FullBox(p, "smhd", 0, 0);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 4);
+    }
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[3], p);
+
+    apu8Box[3] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "dinf");
+    apu8Box[4] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "dref", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 1);
+    apu8Box[5] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "url ", 0, 1);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[5], p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[4], p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[3], p);
+
+    apu8Box[3] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "stbl");
+    apu8Box[4] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "stsd", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 1);
+    pu8Entry = p;
+    if (HI_TRUE == bVideo)
+    {
+        p = SAMPLE_COMM_VENC_Mp4Box(p, (PT_H264 == pstCtx->stAttr.enType) ? "avc1" : "hvc1");
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 6);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 1);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 16);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, pstCtx->stAttr.u32Width);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, pstCtx->stAttr.u32Height);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, 0x00480000);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, 0x00480000);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 1);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 32);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 0x0018);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 0xFFFF);
+        p = SAMPLE_COMM_VENC_Mp4PutVideoConfig(pstCtx, p);
+    }
+    else
+    {
+        p = SAMPLE_COMM_VENC_Mp4Box(p, (PT_AAC == pstCtx->stAttr.enAudioType) ? "mp4a"
+                                    : (PT_G711A == pstCtx->stAttr.enAudioType) ? "alaw" : "ulaw");
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 6);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 1);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 8);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, pstCtx->stAttr.u32AudioChn);
+        p = SAMPLE_COMM_VENC_Mp4Put16(p, 16);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 4);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, pstCtx->stAttr.u32SampleRate << 16);
+        p = SAMPLE_COMM_VENC_Mp4PutAudioConfig(pstCtx, p);
+    }
+    SAMPLE_COMM_VENC_Mp4End(pu8Entry, p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[4], p);
+
+    /* empty tables, the samples are all in fragments */
+    apu8Box[4] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "stts", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[4], p);
+    apu8Box[4] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "stsc", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[4], p);
+    apu8Box[4] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "stsz", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put64(p, 0);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[4], p);
+    apu8Box[4] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "stco", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[4], p);
+
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[3], p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[2], p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[1], p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[0], p);
+    return p;
+}
+
+static HI_S32 SAMPLE_COMM_VENC_Mp4WriteInit(SAMPLE_VENC_MP4_CTX_S *pstCtx)
+{
+    struct iovec stIov;
+    HI_BOOL bAudio = (PT_BUTT != pstCtx->stAttr.enAudioType) ? HI_TRUE : HI_FALSE;
+    HI_U8 *apu8Box[3];
+    HI_U8 *p = pstCtx->au8Init;
+    HI_U32 u32Track;
+
+    apu8Box[0] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "ftyp");
+    memcpy(p, "isom\0\0\2\0isomiso6mp41", 20);
+    p += 20;
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[0], p);
+
+    apu8Box[0] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "moov");
+    apu8Box[1] = p;
+    p = SAMPLE_COMM_VENC_Mp4FullBox(p, "mvhd", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 8);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 1000);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, 0x00010000);
+    p = SAMPLE_COMM_VENC_Mp4Put16(p, 0x0100);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 10);
+    p = SAMPLE_COMM_VENC_Mp4PutMatrix(p);
+    p = SAMPLE_COMM_VENC_Mp4PutZero(p, 24);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, (HI_TRUE == bAudio) ? 3 : 2);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[1], p);
+
+    p = SAMPLE_COMM_VENC_Mp4PutTrak(pstCtx, p, HI_TRUE);
+    if (HI_TRUE == bAudio)
+    {
+        p = SAMPLE_COMM_VENC_Mp4PutTrak(pstCtx, p, HI_FALSE);
+    }
+
+    apu8Box[1] = p;
+    p = SAMPLE_COMM_VENC_Mp4Box(p, "mvex");
+    for (u32Track = SAMPLE_VENC_MP4_VIDEO_TRACK; u32Track <= ((HI_TRUE == bAudio) ? 2 : 1); u32Track++)
+    {
+        apu8Box[2] = p;
+        p = SAMPLE_COMM_VENC_Mp4FullBox(p, "trex", 0, 0);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, u32Track);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, 1);
+        p = SAMPLE_COMM_VENC_Mp4PutZero(p, 12);
+        SAMPLE_COMM_VENC_Mp4End(apu8Box[2], p);
+    }
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[1], p);
+    SAMPLE_COMM_VENC_Mp4End(apu8Box[0], p);
+
+    stIov.iov_base = pstCtx->au8Init;
+    stIov.iov_len = p - pstCtx->au8Init;
+    pstCtx->stStat.u64Bytes += stIov.iov_len;
+    return SAMPLE_COMM_VENC_WritevAll(pstCtx->s32Fd, &stIov, 1);
+}
+
+/* moof + mdat of what was gathered since the last fragment, in one writev */
+static HI_VOID SAMPLE_COMM_VENC_Mp4Emit(SAMPLE_VENC_MP4_CTX_S *pstCtx)
+{
+    struct iovec astIov[7];
+    HI_U32 u32VideoTraf = 0;
+    HI_U32 u32AudioTraf = 0;
+    HI_U32 u32Moof;
+    HI_U32 u32IovCnt = 0;
+    HI_U32 i;
+    HI_U8 *p;
+
+    if (pstCtx->u32VideoCnt > 0)
+    {
+        u32VideoTraf = 8 + 16 + 20 + 20 + SAMPLE_VENC_MP4_VIDEO_ENTRY * pstCtx->u32VideoCnt;
+    }
+    if (pstCtx->u32AudioCnt > 0)
+    {
+        u32AudioTraf = 8 + 16 + 20 + 20 + SAMPLE_VENC_MP4_AUDIO_ENTRY * pstCtx->u32AudioCnt;
+    }
+    if (0 == u32VideoTraf + u32AudioTraf)
+    {
+        return;
+    }
+    u32Moof = 8 + 16 + u32VideoTraf + u32AudioTraf;
+
+    p = SAMPLE_COMM_VENC_Mp4Put32(pstCtx->au8Head, u32Moof);
+    memcpy(p, "moof", 4);
+    p = SAMPLE_COMM_VENC_Mp4SizedBox(p + 4, 16, "mfhd", 0, 0);
+    p = SAMPLE_COMM_VENC_Mp4Put32(p, ++pstCtx->u32Seq);
+    if (pstCtx->u32VideoCnt > 0)
+    {
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, u32VideoTraf);
+        memcpy(p, "traf", 4);
+        p = SAMPLE_COMM_VENC_Mp4SizedBox(p + 4, 16, "tfhd", 0, 0x020000);    /* default base is moof */
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, SAMPLE_VENC_MP4_VIDEO_TRACK);
+        p = SAMPLE_COMM_VENC_Mp4SizedBox(p, 20, "tfdt", 1, 0);
+        p = SAMPLE_COMM_VENC_Mp4Put64(p, pstCtx->u64VideoFragDts);
+        p = SAMPLE_COMM_VENC_Mp4SizedBox(p, 20 + SAMPLE_VENC_MP4_VIDEO_ENTRY * pstCtx->u32VideoCnt,
+                                         "trun", 0, 0x000701);          /* offset, duration, size, flags */
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, pstCtx->u32VideoCnt);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, u32Moof + 8);
+    }
+    astIov[u32IovCnt].iov_base = pstCtx->au8Head;
+    astIov[u32IovCnt++].iov_len = p - pstCtx->au8Head;
+    if (pstCtx->u32VideoCnt > 0)
+    {
+        astIov[u32IovCnt].iov_base = pstCtx->pu8VideoEntry;
+        astIov[u32IovCnt++].iov_len = SAMPLE_VENC_MP4_VIDEO_ENTRY * pstCtx->u32VideoCnt;
+    }
+    if (pstCtx->u32AudioCnt > 0)
+    {
+        p = SAMPLE_COMM_VENC_Mp4Put32(pstCtx->au8AudioHead, u32AudioTraf);
+        memcpy(p, "traf", 4);
+        p = SAMPLE_COMM_VENC_Mp4SizedBox(p + 4, 16, "tfhd", 0, 0x020000);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, SAMPLE_VENC_MP4_AUDIO_TRACK);
+        p = SAMPLE_COMM_VENC_Mp4SizedBox(p, 20, "tfdt", 1, 0);
+        p = SAMPLE_COMM_VENC_Mp4Put64(p, pstCtx->u64AudioFragDts);
+        p = SAMPLE_COMM_VENC_Mp4SizedBox(p, 20 + SAMPLE_VENC_MP4_AUDIO_ENTRY * pstCtx->u32AudioCnt,
+                                         "trun", 0, 0x000301);          /* offset, duration, size */
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, pstCtx->u32AudioCnt);
+        p = SAMPLE_COMM_VENC_Mp4Put32(p, u32Moof + 8 + pstCtx->u32VideoLen);
+        astIov[u32IovCnt].iov_base = pstCtx->au8AudioHead;
+        astIov[u32IovCnt++].iov_len = p - pstCtx->au8AudioHead;
+        astIov[u32IovCnt].iov_base = pstCtx->pu8AudioEntry;
+        astIov[u32IovCnt++].iov_len = SAMPLE_VENC_MP4_AUDIO_ENTRY * pstCtx->u32AudioCnt;
+    }
+    p = SAMPLE_COMM_VENC_Mp4Put32(pstCtx->au8MdatHead, 8 + pstCtx->u32VideoLen + pstCtx->u32AudioLen);
+    memcpy(p, "mdat", 4);
+    astIov[u32IovCnt].iov_base = pstCtx->au8MdatHead;
+    astIov[u32IovCnt++].iov_len = 8;
+    astIov[u32IovCnt].iov_base = pstCtx->pu8Video;
+    astIov[u32IovCnt++].iov_len = pstCtx->u32VideoLen;
+    astIov[u32IovCnt].iov_base = pstCtx->pu8Audio;
+    astIov[u32IovCnt++].iov_len = pstCtx->u32AudioLen;
+
+    for (i = 0; i < u32IovCnt; i++)
+    {
+        pstCtx->stStat.u64Bytes += astIov[i].iov_len;
+    }
+    if (HI_SUCCESS != SAMPLE_COMM_VENC_WritevAll(pstCtx->s32Fd, astIov, u32IovCnt))
+    {
+        pstCtx->stStat.u32WriteErrs++;
+    }
+    pstCtx->stStat.u32Fragments++;
+    pstCtx->u32VideoCnt = 0;
+    pstCtx->u32VideoLen = 0;
+    pstCtx->u32AudioCnt = 0;
+    pstCtx->u32AudioLen = 0;
+}
+
+/* packs to length-prefixed nal units at the end of the fragment buffer, parameter sets kept aside */
+static HI_VOID SAMPLE_COMM_VENC_Mp4AddPacks(SAMPLE_VENC_MP4_CTX_S *pstCtx, const VENC_STREAM_S *pstStream)
+{
+    const HI_U8 *pu8Data;
+    HI_U8 *pu8Nal = NULL;
+    HI_U32 u32Len;
+    HI_U32 u32Sc;
+    HI_U32 u32Type;
+    HI_S32 s32Param = -1;
+    HI_U32 i;
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        pu8Data = pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset;
+        u32Len = pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+        u32Sc = 0;
+        if ((u32Len > 4) && (0 == pu8Data[0]) && (0 == pu8Data[1]) && (0 == pu8Data[2]) && (1 == pu8Data[3]))
+        {
+            u32Sc = 4;
+        }
+        else if ((u32Len > 3) && (0 == pu8Data[0]) && (0 == pu8Data[1]) && (1 == pu8Data[2]))
+        {
+            u32Sc = 3;
+        }
+
+        /* a pack without a start code goes on with the nal of the pack before, the stream buffer wrapped */
+        if (u32Sc > 0)
+        {
+            if (NULL != pu8Nal)
+            {
+                SAMPLE_COMM_VENC_Mp4Put32(pu8Nal, pstCtx->pu8Video + pstCtx->u32VideoLen - pu8Nal - 4);
+                pu8Nal = NULL;
+            }
+            pu8Data += u32Sc;
+            u32Len -= u32Sc;
+            s32Param = -1;
+            if (PT_H264 == pstCtx->stAttr.enType)
+            {
+                u32Type = pu8Data[0] & 0x1F;
+                s32Param = (H264E_NALU_SPS == u32Type) ? SAMPLE_VENC_MP4_PARAM_SPS
+                           : (H264E_NALU_PPS == u32Type) ? SAMPLE_VENC_MP4_PARAM_PPS : -1;
+            }
+            else
+            {
+                u32Type = (pu8Data[0] >> 1) & 0x3F;
+                if ((u32Type >= H265E_NALU_VPS) && (u32Type <= H265E_NALU_PPS))
+                {
+                    s32Param = u32Type - H265E_NALU_VPS;
+                }
+            }
+            if (s32Param >= 0)
+            {
+                pstCtx->au32ParamLen[s32Param] = 0;
+            }
+            else
+            {
+                pu8Nal = pstCtx->pu8Video + pstCtx->u32VideoLen;
+                pstCtx->u32VideoLen += 4;
+            }
+        }
+
+        if (s32Param >= 0)
+        {
+            if (pstCtx->au32ParamLen[s32Param] + u32Len <= SAMPLE_VENC_MP4_MAX_PARAM)
+            {
+                memcpy(pstCtx->au8Param[s32Param] + pstCtx->au32ParamLen[s32Param], pu8Data, u32Len);
+                pstCtx->au32ParamLen[s32Param] += u32Len;
+            }
+            continue;
+        }
+        if (NULL == pu8Nal)
+        {
+            /* not behind a start code at all, nothing to add it to */
+            continue;
+        }
+        memcpy(pstCtx->pu8Video + pstCtx->u32VideoLen, pu8Data, u32Len);
+        pstCtx->u32VideoLen += u32Len;
+    }
+    if (NULL != pu8Nal)
+    {
+        SAMPLE_COMM_VENC_Mp4Put32(pu8Nal, pstCtx->pu8Video + pstCtx->u32VideoLen - pu8Nal - 4);
+    }
+}
+
+static HI_VOID SAMPLE_COMM_VENC_Mp4Free(SAMPLE_VENC_MP4_CTX_S *pstCtx)
+{
+    free(pstCtx->pu8Video);
+    pstCtx->pu8Video = NULL;
+    free(pstCtx->pu8VideoEntry);
+    pstCtx->pu8VideoEntry = NULL;
+    free(pstCtx->pu8Audio);
+    pstCtx->pu8Audio = NULL;
+    free(pstCtx->pu8AudioEntry);
+    pstCtx->pu8AudioEntry = NULL;
+    pthread_mutex_destroy(&pstCtx->Lock);
+}
+
+/******************************************************************************
+* funciton : start muxing a venc channel (and an aenc stream) to s32Fd as fmp4
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_Mp4Open(VENC_CHN VencChn, HI_S32 s32Fd, const SAMPLE_VENC_MP4_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_MP4_CTX_S *pstCtx;
+    HI_BOOL bAudio;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (s32Fd < 0) || (NULL == pstAttr))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    bAudio = (PT_BUTT != pstAttr->enAudioType) ? HI_TRUE : HI_FALSE;
+    if (((PT_H264 != pstAttr->enType) && (PT_H265 != pstAttr->enType)) || (0 == pstAttr->u32FragBufSize)
+        || (0 == pstAttr->u32MaxFrames) || (pstAttr->u32Width > 0xFFFF) || (pstAttr->u32Height > 0xFFFF)
+        || ((HI_TRUE == bAudio) && (((PT_AAC != pstAttr->enAudioType) && (PT_G711A != pstAttr->enAudioType)
+                                     && (PT_G711U != pstAttr->enAudioType))
+                                    || (0 == pstAttr->u32SampleRate) || (pstAttr->u32SampleRate > 0xFFFF)
+                                    || ((PT_AAC == pstAttr->enAudioType)
+                                        && (13 == SAMPLE_COMM_VENC_Mp4AacRateIdx(pstAttr->u32SampleRate)))
+                                    || (0 == pstAttr->u32AudioChn) || (pstAttr->u32AudioChn > 2)
+                                    || (0 == pstAttr->u32AudioBufSize) || (0 == pstAttr->u32MaxAudioFrames))))
+    {
+        SAMPLE_PRT("mp4 attr invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astMp4[VencChn];
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        SAMPLE_PRT("mp4 of chn[%d] is open already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_MP4_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_MP4_ATTR_S));
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pstCtx->s32Fd = s32Fd;
+    pstCtx->bWaitKey = HI_TRUE;
+    pstCtx->pu8Video = (HI_U8 *)malloc(pstAttr->u32FragBufSize);
+    pstCtx->pu8VideoEntry = (HI_U8 *)malloc(SAMPLE_VENC_MP4_VIDEO_ENTRY * pstAttr->u32MaxFrames);
+    if (HI_TRUE == bAudio)
+    {
+        pstCtx->pu8Audio = (HI_U8 *)malloc(pstAttr->u32AudioBufSize);
+        pstCtx->pu8AudioEntry = (HI_U8 *)malloc(SAMPLE_VENC_MP4_AUDIO_ENTRY * pstAttr->u32MaxAudioFrames);
+    }
+    if ((NULL == pstCtx->pu8Video) || (NULL == pstCtx->pu8VideoEntry)
+        || ((HI_TRUE == bAudio) && ((NULL == pstCtx->pu8Audio) || (NULL == pstCtx->pu8AudioEntry))))
+    {
+        SAMPLE_PRT("malloc mp4 fragment buffer failed!\n");
+        SAMPLE_COMM_VENC_Mp4Free(pstCtx);
+        return HI_FAILURE;
+    }
+    pstCtx->bOpen = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : add one video frame, fits SAMPLE_VENC_STREAM_PROC_FN
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_Mp4Stream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    SAMPLE_VENC_MP4_CTX_S *pstCtx;
+    HI_U8 *pu8Entry;
+    HI_BOOL bKey;
+    HI_U64 u64Pts;
+    HI_U64 u64Dts;
+    HI_U32 u32Bound = 0;
+    HI_U32 u32Start;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream) || (0 == pstStream->u32PackCount)
+        || (HI_TRUE != gs_astMp4[VencChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astMp4[VencChn];
+
+    /* a start code turns into a 4 byte length, at most one more byte per pack */
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        u32Bound += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset + 1;
+    }
+    u64Pts = pstStream->pstPack[0].u64PTS;
+    bKey = SAMPLE_COMM_VENC_IsKeyStream(pstCtx->stAttr.enType, pstStream);
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (HI_TRUE == bKey)
+    {
+        pstCtx->bWaitKey = HI_FALSE;
+    }
+    if ((HI_TRUE == pstCtx->bWaitKey) || (u32Bound > pstCtx->stAttr.u32FragBufSize))
+    {
+        pstCtx->bWaitKey = HI_TRUE;
+        pstCtx->stStat.u32DropVideo++;
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_SUCCESS;
+    }
+
+    u64Dts = 0;
+    if (HI_TRUE == pstCtx->bInit)
+    {
+        u64Dts = ((u64Pts - pstCtx->u64BasePts) * 9 + 50) / 100;
+        if (pstCtx->u32VideoCnt > 0)
+        {
+            if (u64Dts > pstCtx->u64LastDts)
+            {
+                pstCtx->u32LastDuration = (HI_U32)(u64Dts - pstCtx->u64LastDts);
+            }
+            /* the last sample gets its duration now that the next one is here */
+            pu8Entry = pstCtx->pu8VideoEntry + SAMPLE_VENC_MP4_VIDEO_ENTRY * (pstCtx->u32VideoCnt - 1);
+            SAMPLE_COMM_VENC_Mp4Put32(pu8Entry, pstCtx->u32LastDuration);
+            if ((HI_TRUE == bKey) || (pstCtx->u32VideoCnt == pstCtx->stAttr.u32MaxFrames)
+                || (pstCtx->u32VideoLen + u32Bound > pstCtx->stAttr.u32FragBufSize))
+            {
+                if (HI_TRUE != bKey)
+                {
+                    pstCtx->stStat.u32CutFragments++;
+                }
+                SAMPLE_COMM_VENC_Mp4Emit(pstCtx);
+            }
+        }
+    }
+
+    u32Start = pstCtx->u32VideoLen;
+    SAMPLE_COMM_VENC_Mp4AddPacks(pstCtx, pstStream);
+    if (HI_TRUE != pstCtx->bInit)
+    {
+        if ((0 == pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_SPS]) || (0 == pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_PPS])
+            || ((PT_H265 == pstCtx->stAttr.enType) && (0 == pstCtx->au32ParamLen[SAMPLE_VENC_MP4_PARAM_VPS])))
+        {
+            SAMPLE_PRT("chn[%d] key frame without parameter sets\n", VencChn);
+            pstCtx->u32VideoLen = u32Start;
+            pstCtx->bWaitKey = HI_TRUE;
+            pstCtx->stStat.u32DropVideo++;
+            pthread_mutex_unlock(&pstCtx->Lock);
+            return HI_FAILURE;
+        }
+        if (HI_SUCCESS != SAMPLE_COMM_VENC_Mp4WriteInit(pstCtx))
+        {
+            pstCtx->stStat.u32WriteErrs++;
+        }
+        pstCtx->u64BasePts = u64Pts;
+        pstCtx->u32LastDuration = SAMPLE_VENC_MP4_TIMESCALE / 30;
+        pstCtx->bInit = HI_TRUE;
+    }
+
+    if (0 == pstCtx->u32VideoCnt)
+    {
+        pstCtx->u64VideoFragDts = u64Dts;
+    }
+    pu8Entry = pstCtx->pu8VideoEntry + SAMPLE_VENC_MP4_VIDEO_ENTRY * pstCtx->u32VideoCnt;
+    pu8Entry = SAMPLE_COMM_VENC_Mp4Put32(pu8Entry, pstCtx->u32LastDuration);
+    pu8Entry = SAMPLE_COMM_VENC_Mp4Put32(pu8Entry, pstCtx->u32VideoLen - u32Start);
+    (HI_VOID)SAMPLE_COMM_VENC_Mp4Put32(pu8Entry, (HI_TRUE == bKey) ? SAMPLE_VENC_MP4_FLAG_SYNC : SAMPLE_VENC_MP4_FLAG_NOSYNC);
+    pstCtx->u32VideoCnt++;
+    pstCtx->u64LastDts = u64Dts;
+    pstCtx->stStat.u32VideoFrames++;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : add one aenc frame, it goes out with the video fragment in progress
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_Mp4Audio(VENC_CHN VencChn, const AUDIO_STREAM_S *pstStream)
+{
+    SAMPLE_VENC_MP4_CTX_S *pstCtx;
+    const HI_U8 *pu8Data;
+    HI_U8 *pu8Entry;
+    HI_U32 u32Len;
+    HI_U32 u32Duration;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream)
+        || (HI_TRUE != gs_astMp4[VencChn].bOpen) || (PT_BUTT == gs_astMp4[VencChn].stAttr.enAudioType))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astMp4[VencChn];
+    pu8Data = pstStream->pStream;
+    u32Len = pstStream->u32Len;
+
+    if (PT_AAC == pstCtx->stAttr.enAudioType)
+    {
+        /* adts header off, the config is in esds */
+        if ((u32Len > 9) && (0xFF == pu8Data[0]) && (0xF0 == (pu8Data[1] & 0xF6)))
+        {
+            u32Len -= (pu8Data[1] & 0x01) ? 7 : 9;
+            pu8Data += (pu8Data[1] & 0x01) ? 7 : 9;
+        }
+        u32Duration = 1024;
+    }
+    else
+    {
+        /* hisilicon voice frame header off */
+        if ((u32Len > 4) && (0 == pu8Data[0]) && (1 == pu8Data[1]) && ((HI_U32)pu8Data[2] * 2 == u32Len - 4))
+        {
+            u32Len -= 4;
+            pu8Data += 4;
+        }
+        u32Duration = u32Len / pstCtx->stAttr.u32AudioChn;
+    }
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if ((HI_TRUE != pstCtx->bInit) || (0 == u32Len)
+        || ((HI_TRUE != pstCtx->bAudioStart) && (pstStream->u64TimeStamp < pstCtx->u64BasePts))
+        || (pstCtx->u32AudioCnt == pstCtx->stAttr.u32MaxAudioFrames)
+        || (pstCtx->u32AudioLen + u32Len > pstCtx->stAttr.u32AudioBufSize))
+    {
+        pstCtx->stStat.u32DropAudio++;
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_SUCCESS;
+    }
+    if (HI_TRUE != pstCtx->bAudioStart)
+    {
+        pstCtx->u64AudioDts = (pstStream->u64TimeStamp - pstCtx->u64BasePts) * pstCtx->stAttr.u32SampleRate / 1000000;
+        pstCtx->bAudioStart = HI_TRUE;
+    }
+    if (0 == pstCtx->u32AudioCnt)
+    {
+        pstCtx->u64AudioFragDts = pstCtx->u64AudioDts;
+    }
+
+    pu8Entry = pstCtx->pu8AudioEntry + SAMPLE_VENC_MP4_AUDIO_ENTRY * pstCtx->u32AudioCnt;
+    pu8Entry = SAMPLE_COMM_VENC_Mp4Put32(pu8Entry, u32Duration);
+    (HI_VOID)SAMPLE_COMM_VENC_Mp4Put32(pu8Entry, u32Len);
+    memcpy(pstCtx->pu8Audio + pstCtx->u32AudioLen, pu8Data, u32Len);
+    pstCtx->u32AudioLen += u32Len;
+    pstCtx->u32AudioCnt++;
+    pstCtx->u64AudioDts += u32Duration;
+    pstCtx->stStat.u32AudioFrames++;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : write the last fragment and stop, the fd stays open
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_Mp4Close(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_MP4_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astMp4[VencChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astMp4[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    SAMPLE_COMM_VENC_Mp4Emit(pstCtx);
+    pstCtx->bOpen = HI_FALSE;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    SAMPLE_COMM_VENC_Mp4Free(pstCtx);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : statistics of the muxer of a venc channel, kept after close
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_Mp4GetStat(VENC_CHN VencChn, SAMPLE_VENC_MP4_STAT_S *pstStat)
+{
+    SAMPLE_VENC_MP4_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astMp4[VencChn];
+
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        pthread_mutex_lock(&pstCtx->Lock);
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_MP4_STAT_S));
+        pthread_mutex_unlock(&pstCtx->Lock);
+    }
+    else
+    {
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_MP4_STAT_S));
+    }
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
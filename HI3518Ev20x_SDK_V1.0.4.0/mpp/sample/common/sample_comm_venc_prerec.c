@@ -0,0 +1,393 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: pre-event venc stream ring.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-3 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "sample_comm.h"
+
+/*
+ * Frames of a channel are copied once into one byte ring, back to back, so
+ * any run of whole gops is at most two spans of it. A frame index and a gop
+ * start index sit beside the ring; eviction always takes the oldest whole
+ * gop, so what is held starts at a key frame. A flush pins the gops it hands
+ * out and writes them straight from the ring with writev while the stream
+ * proc goes on filling the free part; frames that find no room while a pin
+ * holds the oldest gop are dropped up to the next key frame.
+ */
+typedef struct sample_venc_prerec_frame_s
+{
+    HI_U64 u64Pts;
+    HI_U32 u32Offset;
+    HI_U32 u32Len;
+}SAMPLE_VENC_PREREC_FRAME_S;
+
+typedef struct sample_venc_prerec_ctx_s
+{
+    HI_BOOL bCreate;
+    HI_BOOL bWaitKey;
+    HI_BOOL bFlushing;
+    SAMPLE_VENC_PREREC_ATTR_S stAttr;
+    HI_U8 *pu8Ring;
+    HI_U32 u32Head;                     /* ring offset of the next frame */
+    SAMPLE_VENC_PREREC_FRAME_S *pstFrame;
+    HI_U32 u32FrameTail;                /* oldest frame, stStat.u32Frames follow it */
+    HI_U32 *pu32Gop;                    /* frame of each gop start */
+    HI_U32 u32GopTail;                  /* oldest gop, stStat.u32Gops follow it */
+    HI_U64 u64GopSeq;                   /* gops evicted so far, the sequence of the oldest one */
+    HI_U64 u64PinSeq;                   /* the flush holds this gop and all after it */
+    pthread_mutex_t Lock;
+    SAMPLE_VENC_PREREC_STAT_S stStat;
+}SAMPLE_VENC_PREREC_CTX_S;
+
+static SAMPLE_VENC_PREREC_CTX_S gs_astPrerec[VENC_MAX_CHN_NUM];
+
+static HI_U64 SAMPLE_COMM_VENC_PrerecNowUs(HI_VOID)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return (HI_U64)stNow.tv_sec * 1000000 + stNow.tv_nsec / 1000;
+}
+
+static SAMPLE_VENC_PREREC_FRAME_S *SAMPLE_COMM_VENC_PrerecGopFrame(SAMPLE_VENC_PREREC_CTX_S *pstCtx, HI_U32 u32Gop)
+{
+    return &pstCtx->pstFrame[pstCtx->pu32Gop[(pstCtx->u32GopTail + u32Gop) % pstCtx->stAttr.u32MaxFrames]];
+}
+
+static HI_BOOL SAMPLE_COMM_VENC_PrerecCanEvict(SAMPLE_VENC_PREREC_CTX_S *pstCtx)
+{
+    return ((0 != pstCtx->stStat.u32Gops)
+            && ((HI_TRUE != pstCtx->bFlushing) || (pstCtx->u64GopSeq < pstCtx->u64PinSeq))) ? HI_TRUE : HI_FALSE;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_PrerecEvictGop(SAMPLE_VENC_PREREC_CTX_S *pstCtx)
+{
+    HI_U32 u32Frames;
+    HI_U32 u32Bytes;
+    HI_U32 u32Next;
+
+    if (pstCtx->stStat.u32Gops > 1)
+    {
+        u32Next = pstCtx->pu32Gop[(pstCtx->u32GopTail + 1) % pstCtx->stAttr.u32MaxFrames];
+        u32Frames = (u32Next + pstCtx->stAttr.u32MaxFrames - pstCtx->u32FrameTail) % pstCtx->stAttr.u32MaxFrames;
+        u32Bytes = (pstCtx->pstFrame[u32Next].u32Offset + pstCtx->stAttr.u32BufSize
+                    - pstCtx->pstFrame[pstCtx->u32FrameTail].u32Offset) % pstCtx->stAttr.u32BufSize;
+    }
+    else
+    {
+        u32Next = (pstCtx->u32FrameTail + pstCtx->stStat.u32Frames) % pstCtx->stAttr.u32MaxFrames;
+        u32Frames = pstCtx->stStat.u32Frames;
+        u32Bytes = pstCtx->stStat.u32Used;
+    }
+
+    pstCtx->u32FrameTail = u32Next;
+    pstCtx->stStat.u32Frames -= u32Frames;
+    pstCtx->stStat.u32Used -= u32Bytes;
+    pstCtx->u32GopTail = (pstCtx->u32GopTail + 1) % pstCtx->stAttr.u32MaxFrames;
+    pstCtx->stStat.u32Gops--;
+    pstCtx->u64GopSeq++;
+    pstCtx->stStat.u64EvictGops++;
+    pstCtx->stStat.u64EvictBytes += u32Bytes;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_PrerecCopy(SAMPLE_VENC_PREREC_CTX_S *pstCtx, const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 u32Copy;
+
+    u32Copy = pstCtx->stAttr.u32BufSize - pstCtx->u32Head;
+    if (u32Copy > u32Len)
+    {
+        u32Copy = u32Len;
+    }
+    memcpy(pstCtx->pu8Ring + pstCtx->u32Head, pu8Data, u32Copy);
+    memcpy(pstCtx->pu8Ring, pu8Data + u32Copy, u32Len - u32Copy);
+    pstCtx->u32Head = (pstCtx->u32Head + u32Len) % pstCtx->stAttr.u32BufSize;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_PrerecFree(SAMPLE_VENC_PREREC_CTX_S *pstCtx)
+{
+    free(pstCtx->pu8Ring);
+    pstCtx->pu8Ring = NULL;
+    free(pstCtx->pstFrame);
+    pstCtx->pstFrame = NULL;
+    free(pstCtx->pu32Gop);
+    pstCtx->pu32Gop = NULL;
+    pthread_mutex_destroy(&pstCtx->Lock);
+}
+
+/******************************************************************************
+* funciton : create the pre-event ring of a venc channel
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_PrerecCreate(VENC_CHN VencChn, const SAMPLE_VENC_PREREC_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_PREREC_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstAttr)
+        || (0 == pstAttr->u32BufSize) || (pstAttr->u32MaxFrames < 2))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astPrerec[VencChn];
+    if (HI_TRUE == pstCtx->bCreate)
+    {
+        SAMPLE_PRT("prerec of chn[%d] is created already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_PREREC_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_PREREC_ATTR_S));
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pstCtx->pu8Ring = (HI_U8 *)malloc(pstAttr->u32BufSize);
+    pstCtx->pstFrame = (SAMPLE_VENC_PREREC_FRAME_S *)malloc(sizeof(SAMPLE_VENC_PREREC_FRAME_S) * pstAttr->u32MaxFrames);
+    pstCtx->pu32Gop = (HI_U32 *)malloc(sizeof(HI_U32) * pstAttr->u32MaxFrames);
+    if ((NULL == pstCtx->pu8Ring) || (NULL == pstCtx->pstFrame) || (NULL == pstCtx->pu32Gop))
+    {
+        SAMPLE_PRT("malloc prerec ring failed!\n");
+        SAMPLE_COMM_VENC_PrerecFree(pstCtx);
+        return HI_FAILURE;
+    }
+    pstCtx->bWaitKey = HI_TRUE;
+    pstCtx->stStat.u32BufSize = pstAttr->u32BufSize;
+    pstCtx->bCreate = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : destroy the pre-event ring, no flush of it may be running
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_PrerecDestroy(VENC_CHN VencChn)
+{
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astPrerec[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+
+    gs_astPrerec[VencChn].bCreate = HI_FALSE;
+    SAMPLE_COMM_VENC_PrerecFree(&gs_astPrerec[VencChn]);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : append one frame to the ring, fits SAMPLE_VENC_STREAM_PROC_FN
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_PrerecStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    SAMPLE_VENC_PREREC_CTX_S *pstCtx;
+    SAMPLE_VENC_PREREC_FRAME_S *pstFrame;
+    HI_BOOL bKey;
+    HI_U64 u64Pts;
+    HI_U32 u32Len = 0;
+    HI_U32 u32Index;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream) || (0 == pstStream->u32PackCount)
+        || (HI_TRUE != gs_astPrerec[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astPrerec[VencChn];
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        u32Len += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+    u64Pts = pstStream->pstPack[0].u64PTS;
+    bKey = SAMPLE_COMM_VENC_IsKeyStream(pstCtx->stAttr.enType, pstStream);
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (HI_TRUE == bKey)
+    {
+        pstCtx->bWaitKey = HI_FALSE;
+    }
+
+    /* keep the newest gop that starts u32PreMs back, and everything after it */
+    while ((pstCtx->stStat.u32Gops >= 2) && (HI_TRUE == SAMPLE_COMM_VENC_PrerecCanEvict(pstCtx))
+           && (u64Pts - SAMPLE_COMM_VENC_PrerecGopFrame(pstCtx, 1)->u64Pts >= (HI_U64)pstCtx->stAttr.u32PreMs * 1000))
+    {
+        SAMPLE_COMM_VENC_PrerecEvictGop(pstCtx);
+    }
+
+    /* a key frame may push out the gop in progress, other frames only older ones */
+    while ((HI_TRUE != pstCtx->bWaitKey)
+           && ((pstCtx->stStat.u32Used + u32Len > pstCtx->stAttr.u32BufSize)
+               || (pstCtx->stStat.u32Frames == pstCtx->stAttr.u32MaxFrames)))
+    {
+        if (((pstCtx->stStat.u32Gops < 2) && (HI_TRUE != bKey)) || (HI_TRUE != SAMPLE_COMM_VENC_PrerecCanEvict(pstCtx)))
+        {
+            pstCtx->bWaitKey = HI_TRUE;
+            break;
+        }
+        SAMPLE_COMM_VENC_PrerecEvictGop(pstCtx);
+    }
+    if (HI_TRUE == pstCtx->bWaitKey)
+    {
+        pstCtx->stStat.u32DropFrames++;
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_SUCCESS;
+    }
+
+    if (0 == pstCtx->stStat.u32Frames)
+    {
+        pstCtx->u32FrameTail = 0;
+        pstCtx->u32GopTail = 0;
+    }
+    u32Index = (pstCtx->u32FrameTail + pstCtx->stStat.u32Frames) % pstCtx->stAttr.u32MaxFrames;
+    pstFrame = &pstCtx->pstFrame[u32Index];
+    pstFrame->u64Pts = u64Pts;
+    pstFrame->u32Offset = pstCtx->u32Head;
+    pstFrame->u32Len = u32Len;
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        SAMPLE_COMM_VENC_PrerecCopy(pstCtx, pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset,
+                                    pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset);
+    }
+    if (HI_TRUE == bKey)
+    {
+        pstCtx->pu32Gop[(pstCtx->u32GopTail + pstCtx->stStat.u32Gops) % pstCtx->stAttr.u32MaxFrames] = u32Index;
+        pstCtx->stStat.u32Gops++;
+    }
+    pstCtx->stStat.u32Frames++;
+    pstCtx->stStat.u32Used += u32Len;
+    pstCtx->stStat.u32SpanMs = (HI_U32)((u64Pts - SAMPLE_COMM_VENC_PrerecGopFrame(pstCtx, 0)->u64Pts) / 1000);
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : write the held gops from the one starting u32PreMs before the
+*            newest frame (0: the newest key frame) to s32Fd
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_PrerecFlush(VENC_CHN VencChn, HI_S32 s32Fd, HI_U32 u32PreMs, SAMPLE_VENC_PREREC_FLUSH_S *pstFlush)
+{
+    SAMPLE_VENC_PREREC_CTX_S *pstCtx;
+    SAMPLE_VENC_PREREC_FRAME_S *pstStart;
+    SAMPLE_VENC_PREREC_FRAME_S *pstEnd;
+    struct iovec astIov[2];
+    HI_U32 u32IovCnt;
+    HI_U32 u32Gop;
+    HI_U32 u32StartIndex;
+    HI_U32 u32EndIndex;
+    HI_U32 u32Bytes;
+    HI_U32 u32Us;
+    HI_U64 u64Start;
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstFlush)
+        || (HI_TRUE != gs_astPrerec[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astPrerec[VencChn];
+    u64Start = SAMPLE_COMM_VENC_PrerecNowUs();
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if ((HI_TRUE == pstCtx->bFlushing) || (0 == pstCtx->stStat.u32Gops))
+    {
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_FAILURE;
+    }
+    u32EndIndex = (pstCtx->u32FrameTail + pstCtx->stStat.u32Frames - 1) % pstCtx->stAttr.u32MaxFrames;
+    pstEnd = &pstCtx->pstFrame[u32EndIndex];
+    u32Gop = pstCtx->stStat.u32Gops - 1;
+    while ((u32Gop > 0)
+           && (pstEnd->u64Pts - SAMPLE_COMM_VENC_PrerecGopFrame(pstCtx, u32Gop)->u64Pts < (HI_U64)u32PreMs * 1000))
+    {
+        u32Gop--;
+    }
+    u32StartIndex = pstCtx->pu32Gop[(pstCtx->u32GopTail + u32Gop) % pstCtx->stAttr.u32MaxFrames];
+    pstStart = &pstCtx->pstFrame[u32StartIndex];
+
+    pstFlush->u64StartPts = pstStart->u64Pts;
+    pstFlush->u64EndPts = pstEnd->u64Pts;
+    pstFlush->u32Frames = (u32EndIndex + pstCtx->stAttr.u32MaxFrames - u32StartIndex) % pstCtx->stAttr.u32MaxFrames + 1;
+    u32Bytes = (pstCtx->u32Head + pstCtx->stAttr.u32BufSize - pstStart->u32Offset) % pstCtx->stAttr.u32BufSize;
+    if ((0 == u32Bytes) && (0 != pstCtx->stStat.u32Used))
+    {
+        u32Bytes = pstCtx->stAttr.u32BufSize;
+    }
+    pstFlush->u32Bytes = u32Bytes;
+
+    astIov[0].iov_base = pstCtx->pu8Ring + pstStart->u32Offset;
+    astIov[0].iov_len = pstCtx->stAttr.u32BufSize - pstStart->u32Offset;
+    u32IovCnt = 1;
+    if (astIov[0].iov_len >= u32Bytes)
+    {
+        astIov[0].iov_len = u32Bytes;
+    }
+    else
+    {
+        astIov[1].iov_base = pstCtx->pu8Ring;
+        astIov[1].iov_len = u32Bytes - astIov[0].iov_len;
+        u32IovCnt = 2;
+    }
+    pstCtx->u64PinSeq = pstCtx->u64GopSeq + u32Gop;
+    pstCtx->bFlushing = HI_TRUE;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    if (HI_SUCCESS != SAMPLE_COMM_VENC_WritevAll(s32Fd, astIov, u32IovCnt))
+    {
+        SAMPLE_PRT("flush prerec chn[%d] failed!\n", VencChn);
+        s32Ret = HI_FAILURE;
+    }
+    u32Us = (HI_U32)(SAMPLE_COMM_VENC_PrerecNowUs() - u64Start);
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->bFlushing = HI_FALSE;
+    pstCtx->stStat.u32Flushes++;
+    pstCtx->stStat.u32FlushUsLast = u32Us;
+    if (u32Us > pstCtx->stStat.u32FlushUsMax)
+    {
+        pstCtx->stStat.u32FlushUsMax = u32Us;
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return s32Ret;
+}
+
+/******************************************************************************
+* funciton : memory use, eviction and flush statistics of the ring
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_PrerecGetStat(VENC_CHN VencChn, SAMPLE_VENC_PREREC_STAT_S *pstStat)
+{
+    SAMPLE_VENC_PREREC_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStat)
+        || (HI_TRUE != gs_astPrerec[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astPrerec[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_PREREC_STAT_S));
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,514 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: rtp packetizer of venc streams.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-4 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "sample_comm.h"
+
+/*
+ * Payload bytes are never copied: each packet is a sendmsg whose first iovec
+ * is the rtp header (plus the FU or aggregation header) built in a small side
+ * buffer, and whose other iovecs point into the venc stream buffer through
+ * pu8Addr + u32Offset of the packs. A nal split over two packs, the stream
+ * buffer wrapping, just takes one more iovec. The socket is a connected udp
+ * socket owned by the caller, and everything is sent before the stream is
+ * released.
+ */
+#define SAMPLE_VENC_RTP_HDR_LEN     12
+#define SAMPLE_VENC_RTP_MAX_NALU    32
+#define SAMPLE_VENC_RTP_MAX_SEG     32          /* below SAMPLE_VENC_RTP_MAX_IOV, a packet of one nal always fits */
+#define SAMPLE_VENC_RTP_MAX_IOV     48
+#define SAMPLE_VENC_RTP_SIDE_LEN    (SAMPLE_VENC_RTP_HDR_LEN + 3 + 2 * SAMPLE_VENC_RTP_MAX_NALU)
+
+#define SAMPLE_VENC_RTP_H264_STAPA  24
+#define SAMPLE_VENC_RTP_H264_FUA    28
+#define SAMPLE_VENC_RTP_H265_AP     48
+#define SAMPLE_VENC_RTP_H265_FU     49
+
+typedef struct sample_venc_rtp_seg_s
+{
+    const HI_U8 *pu8Addr;
+    HI_U32 u32Len;
+}SAMPLE_VENC_RTP_SEG_S;
+
+/* one nal of the frame, start code left out, over u32SegCnt segments */
+typedef struct sample_venc_rtp_nalu_s
+{
+    HI_U32 u32Seg;
+    HI_U32 u32SegCnt;
+    HI_U32 u32Len;
+}SAMPLE_VENC_RTP_NALU_S;
+
+typedef struct sample_venc_rtp_ctx_s
+{
+    HI_BOOL bOpen;
+    HI_S32 s32Sock;
+    SAMPLE_VENC_RTP_ATTR_S stAttr;
+    HI_U32 u32NalHdrLen;                /* 1 for h264, 2 for h265 */
+    HI_U16 u16Seq;
+    HI_U32 u32Ts;
+    SAMPLE_VENC_RTP_SEG_S astSeg[SAMPLE_VENC_RTP_MAX_SEG];
+    SAMPLE_VENC_RTP_NALU_S astNalu[SAMPLE_VENC_RTP_MAX_NALU];
+    HI_U32 u32NaluCnt;
+    HI_U8 au8Side[SAMPLE_VENC_RTP_SIDE_LEN];
+    struct iovec astIov[SAMPLE_VENC_RTP_MAX_IOV];
+    pthread_mutex_t Lock;
+    SAMPLE_VENC_RTP_STAT_S stStat;
+}SAMPLE_VENC_RTP_CTX_S;
+
+static SAMPLE_VENC_RTP_CTX_S gs_astRtp[VENC_MAX_CHN_NUM];
+
+/* the packs of a frame to nal units, one per start code, packs without one go on with the last */
+static HI_S32 SAMPLE_COMM_VENC_RtpSplit(SAMPLE_VENC_RTP_CTX_S *pstCtx, const VENC_STREAM_S *pstStream)
+{
+    SAMPLE_VENC_RTP_NALU_S *pstNalu = NULL;
+    const HI_U8 *pu8Data;
+    HI_U32 u32SegCnt = 0;
+    HI_U32 u32Len;
+    HI_U32 i;
+
+    pstCtx->u32NaluCnt = 0;
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        pu8Data = pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset;
+        u32Len = pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+        if ((u32Len > 4) && (0 == pu8Data[0]) && (0 == pu8Data[1]) && (0 == pu8Data[2]) && (1 == pu8Data[3]))
+        {
+            pu8Data += 4;
+            u32Len -= 4;
+            pstNalu = NULL;
+        }
+        else if ((u32Len > 3) && (0 == pu8Data[0]) && (0 == pu8Data[1]) && (1 == pu8Data[2]))
+        {
+            pu8Data += 3;
+            u32Len -= 3;
+            pstNalu = NULL;
+        }
+        else if (NULL == pstNalu)
+        {
+            return HI_FAILURE;
+        }
+        if (0 == u32Len)
+        {
+            continue;
+        }
+        if (u32SegCnt == SAMPLE_VENC_RTP_MAX_SEG)
+        {
+            return HI_FAILURE;
+        }
+        if (NULL == pstNalu)
+        {
+            if (pstCtx->u32NaluCnt == SAMPLE_VENC_RTP_MAX_NALU)
+            {
+                return HI_FAILURE;
+            }
+            pstNalu = &pstCtx->astNalu[pstCtx->u32NaluCnt++];
+            pstNalu->u32Seg = u32SegCnt;
+            pstNalu->u32SegCnt = 0;
+            pstNalu->u32Len = 0;
+        }
+        pstCtx->astSeg[u32SegCnt].pu8Addr = pu8Data;
+        pstCtx->astSeg[u32SegCnt++].u32Len = u32Len;
+        pstNalu->u32SegCnt++;
+        pstNalu->u32Len += u32Len;
+    }
+
+    /* the nal header has to be readable from the first segment */
+    for (i = 0; i < pstCtx->u32NaluCnt; i++)
+    {
+        if (pstCtx->astSeg[pstCtx->astNalu[i].u32Seg].u32Len < pstCtx->u32NalHdrLen + 1)
+        {
+            return HI_FAILURE;
+        }
+    }
+    return (pstCtx->u32NaluCnt > 0) ? HI_SUCCESS : HI_FAILURE;
+}
+
+/* iovecs of bytes [u32Off, u32Off + u32Len) of a nal, straight into the stream buffer */
+static HI_U32 SAMPLE_COMM_VENC_RtpGather(SAMPLE_VENC_RTP_CTX_S *pstCtx, const SAMPLE_VENC_RTP_NALU_S *pstNalu,
+                                         HI_U32 u32Off, HI_U32 u32Len, HI_U32 u32IovCnt)
+{
+    const SAMPLE_VENC_RTP_SEG_S *pstSeg = &pstCtx->astSeg[pstNalu->u32Seg];
+    HI_U32 u32Take;
+
+    while (u32Off >= pstSeg->u32Len)
+    {
+        u32Off -= pstSeg->u32Len;
+        pstSeg++;
+    }
+    while (u32Len > 0)
+    {
+        u32Take = pstSeg->u32Len - u32Off;
+        if (u32Take > u32Len)
+        {
+            u32Take = u32Len;
+        }
+        pstCtx->astIov[u32IovCnt].iov_base = (HI_VOID *)(pstSeg->pu8Addr + u32Off);
+        pstCtx->astIov[u32IovCnt++].iov_len = u32Take;
+        u32Len -= u32Take;
+        u32Off = 0;
+        pstSeg++;
+    }
+    return u32IovCnt;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_RtpHeader(SAMPLE_VENC_RTP_CTX_S *pstCtx, HI_BOOL bMarker)
+{
+    HI_U8 *p = pstCtx->au8Side;
+
+    p[0] = 0x80;
+    p[1] = (HI_U8)(((HI_TRUE == bMarker) ? 0x80 : 0) | (pstCtx->stAttr.u32PayloadType & 0x7F));
+    p[2] = (HI_U8)(pstCtx->u16Seq >> 8);
+    p[3] = (HI_U8)pstCtx->u16Seq;
+    p[4] = (HI_U8)(pstCtx->u32Ts >> 24);
+    p[5] = (HI_U8)(pstCtx->u32Ts >> 16);
+    p[6] = (HI_U8)(pstCtx->u32Ts >> 8);
+    p[7] = (HI_U8)pstCtx->u32Ts;
+    p[8] = (HI_U8)(pstCtx->stAttr.u32Ssrc >> 24);
+    p[9] = (HI_U8)(pstCtx->stAttr.u32Ssrc >> 16);
+    p[10] = (HI_U8)(pstCtx->stAttr.u32Ssrc >> 8);
+    p[11] = (HI_U8)pstCtx->stAttr.u32Ssrc;
+    pstCtx->u16Seq++;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_RtpSend(SAMPLE_VENC_RTP_CTX_S *pstCtx, HI_U32 u32IovCnt)
+{
+    struct msghdr stMsg;
+    ssize_t s32Len;
+
+    memset(&stMsg, 0, sizeof(stMsg));
+    stMsg.msg_iov = pstCtx->astIov;
+    stMsg.msg_iovlen = u32IovCnt;
+    do
+    {
+        s32Len = sendmsg(pstCtx->s32Sock, &stMsg, 0);
+    } while ((s32Len < 0) && (EINTR == errno));
+
+    if (s32Len < 0)
+    {
+        pstCtx->stStat.u32SendErrs++;
+        return;
+    }
+    pstCtx->stStat.u64Packets++;
+    pstCtx->stStat.u64Bytes += s32Len;
+}
+
+/* nals from u32First on that fit one STAP-A / AP together, 0 when fewer than 2 do */
+static HI_U32 SAMPLE_COMM_VENC_RtpAggrCount(SAMPLE_VENC_RTP_CTX_S *pstCtx, HI_U32 u32First)
+{
+    HI_U32 u32Size = SAMPLE_VENC_RTP_HDR_LEN + pstCtx->u32NalHdrLen;
+    HI_U32 u32Iov = 1;
+    HI_U32 i;
+
+    for (i = u32First; i < pstCtx->u32NaluCnt; i++)
+    {
+        u32Size += 2 + pstCtx->astNalu[i].u32Len;
+        u32Iov += 1 + pstCtx->astNalu[i].u32SegCnt;
+        if ((u32Size > pstCtx->stAttr.u32Mtu) || (u32Iov > SAMPLE_VENC_RTP_MAX_IOV))
+        {
+            break;
+        }
+    }
+    return (i - u32First >= 2) ? i - u32First : 0;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_RtpSendAggr(SAMPLE_VENC_RTP_CTX_S *pstCtx, HI_U32 u32First, HI_U32 u32Cnt,
+                                            HI_BOOL bMarker)
+{
+    const HI_U8 *pu8Nal;
+    HI_U8 *p = pstCtx->au8Side + SAMPLE_VENC_RTP_HDR_LEN;
+    HI_U8 u8Fnri = 0;
+    HI_U8 u8Tid = 7;
+    HI_U32 u32IovCnt = 0;
+    HI_U32 i;
+
+    SAMPLE_COMM_VENC_RtpHeader(pstCtx, bMarker);
+    for (i = u32First; i < u32First + u32Cnt; i++)
+    {
+        pu8Nal = pstCtx->astSeg[pstCtx->astNalu[i].u32Seg].pu8Addr;
+        if (PT_H264 == pstCtx->stAttr.enType)
+        {
+            /* F is or-ed, NRI the highest of the nals */
+            u8Fnri |= pu8Nal[0] & 0x80;
+            if ((pu8Nal[0] & 0x60) > (u8Fnri & 0x60))
+            {
+                u8Fnri = (u8Fnri & 0x80) | (pu8Nal[0] & 0x60);
+            }
+        }
+        else if ((pu8Nal[1] & 0x07) < u8Tid)
+        {
+            u8Tid = pu8Nal[1] & 0x07;
+        }
+    }
+    if (PT_H264 == pstCtx->stAttr.enType)
+    {
+        *p++ = u8Fnri | SAMPLE_VENC_RTP_H264_STAPA;
+    }
+    else
+    {
+        *p++ = SAMPLE_VENC_RTP_H265_AP << 1;
+        *p++ = u8Tid;
+    }
+
+    /* size fields live in the side buffer behind the headers, each ahead of its nal */
+    for (i = u32First; i < u32First + u32Cnt; i++)
+    {
+        p[0] = (HI_U8)(pstCtx->astNalu[i].u32Len >> 8);
+        p[1] = (HI_U8)pstCtx->astNalu[i].u32Len;
+        if (i == u32First)
+        {
+            pstCtx->astIov[0].iov_base = pstCtx->au8Side;
+            pstCtx->astIov[0].iov_len = p + 2 - pstCtx->au8Side;
+            u32IovCnt = 1;
+        }
+        else
+        {
+            pstCtx->astIov[u32IovCnt].iov_base = p;
+            pstCtx->astIov[u32IovCnt++].iov_len = 2;
+        }
+        p += 2;
+        u32IovCnt = SAMPLE_COMM_VENC_RtpGather(pstCtx, &pstCtx->astNalu[i], 0, pstCtx->astNalu[i].u32Len, u32IovCnt);
+    }
+    SAMPLE_COMM_VENC_RtpSend(pstCtx, u32IovCnt);
+    pstCtx->stStat.u32AggrPackets++;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_RtpSendSingle(SAMPLE_VENC_RTP_CTX_S *pstCtx, const SAMPLE_VENC_RTP_NALU_S *pstNalu,
+                                              HI_BOOL bMarker)
+{
+    HI_U32 u32IovCnt;
+
+    SAMPLE_COMM_VENC_RtpHeader(pstCtx, bMarker);
+    pstCtx->astIov[0].iov_base = pstCtx->au8Side;
+    pstCtx->astIov[0].iov_len = SAMPLE_VENC_RTP_HDR_LEN;
+    u32IovCnt = SAMPLE_COMM_VENC_RtpGather(pstCtx, pstNalu, 0, pstNalu->u32Len, 1);
+    SAMPLE_COMM_VENC_RtpSend(pstCtx, u32IovCnt);
+    pstCtx->stStat.u32SinglePackets++;
+}
+
+/* the nal header is replaced by the FU indicator and header, the rest goes in mtu sized slices */
+static HI_VOID SAMPLE_COMM_VENC_RtpSendFu(SAMPLE_VENC_RTP_CTX_S *pstCtx, const SAMPLE_VENC_RTP_NALU_S *pstNalu,
+                                          HI_BOOL bMarker)
+{
+    const HI_U8 *pu8Nal = pstCtx->astSeg[pstNalu->u32Seg].pu8Addr;
+    HI_U8 *p;
+    HI_U32 u32Chunk;
+    HI_U32 u32Off = pstCtx->u32NalHdrLen;
+    HI_U32 u32Len;
+    HI_U32 u32IovCnt;
+    HI_U8 u8Type;
+    HI_U8 u8FuHdr;
+
+    u32Chunk = pstCtx->stAttr.u32Mtu - SAMPLE_VENC_RTP_HDR_LEN - pstCtx->u32NalHdrLen - 1;
+    u8Type = (PT_H264 == pstCtx->stAttr.enType) ? (pu8Nal[0] & 0x1F) : ((pu8Nal[0] >> 1) & 0x3F);
+    while (u32Off < pstNalu->u32Len)
+    {
+        u32Len = pstNalu->u32Len - u32Off;
+        if (u32Len > u32Chunk)
+        {
+            u32Len = u32Chunk;
+        }
+        u8FuHdr = u8Type;
+        if (u32Off == pstCtx->u32NalHdrLen)
+        {
+            u8FuHdr |= 0x80;
+        }
+        if (u32Off + u32Len == pstNalu->u32Len)
+        {
+            u8FuHdr |= 0x40;
+        }
+
+        SAMPLE_COMM_VENC_RtpHeader(pstCtx, ((HI_TRUE == bMarker) && (u8FuHdr & 0x40)) ? HI_TRUE : HI_FALSE);
+        p = pstCtx->au8Side + SAMPLE_VENC_RTP_HDR_LEN;
+        if (PT_H264 == pstCtx->stAttr.enType)
+        {
+            *p++ = (pu8Nal[0] & 0xE0) | SAMPLE_VENC_RTP_H264_FUA;
+        }
+        else
+        {
+            *p++ = (pu8Nal[0] & 0x81) | (SAMPLE_VENC_RTP_H265_FU << 1);
+            *p++ = pu8Nal[1];
+        }
+        *p++ = u8FuHdr;
+        pstCtx->astIov[0].iov_base = pstCtx->au8Side;
+        pstCtx->astIov[0].iov_len = p - pstCtx->au8Side;
+        u32IovCnt = SAMPLE_COMM_VENC_RtpGather(pstCtx, pstNalu, u32Off, u32Len, 1);
+        SAMPLE_COMM_VENC_RtpSend(pstCtx, u32IovCnt);
+        pstCtx->stStat.u32FuPackets++;
+        u32Off += u32Len;
+    }
+}
+
+/******************************************************************************
+* funciton : start sending a venc channel as rtp over a connected udp socket
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_RtpOpen(VENC_CHN VencChn, HI_S32 s32Sock, const SAMPLE_VENC_RTP_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_RTP_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (s32Sock < 0) || (NULL == pstAttr))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    if (((PT_H264 != pstAttr->enType) && (PT_H265 != pstAttr->enType)) || (pstAttr->enMode > SAMPLE_VENC_RTP_MODE_AGGR)
+        || (pstAttr->u32Mtu < SAMPLE_VENC_RTP_HDR_LEN + 64) || (pstAttr->u32Mtu > 65507)
+        || (pstAttr->u32PayloadType > 127))
+    {
+        SAMPLE_PRT("rtp attr invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astRtp[VencChn];
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        SAMPLE_PRT("rtp of chn[%d] is open already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_RTP_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_RTP_ATTR_S));
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pstCtx->s32Sock = s32Sock;
+    pstCtx->u32NalHdrLen = (PT_H264 == pstAttr->enType) ? 1 : 2;
+    pstCtx->u16Seq = (HI_U16)pstAttr->u32SeqBase;
+    pstCtx->bOpen = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : send one frame, fits SAMPLE_VENC_STREAM_PROC_FN
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_RtpStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    SAMPLE_VENC_RTP_CTX_S *pstCtx;
+    SAMPLE_VENC_RTP_NALU_S *pstNalu;
+    HI_BOOL bLast;
+    HI_U32 u32Cnt;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream) || (0 == pstStream->u32PackCount)
+        || (HI_TRUE != gs_astRtp[VencChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astRtp[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (HI_SUCCESS != SAMPLE_COMM_VENC_RtpSplit(pstCtx, pstStream))
+    {
+        pstCtx->stStat.u32BadFrames++;
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_FAILURE;
+    }
+    pstCtx->u32Ts = pstCtx->stAttr.u32TsBase + (HI_U32)((pstStream->pstPack[0].u64PTS * 9 + 50) / 100);
+
+    for (i = 0; i < pstCtx->u32NaluCnt; i += u32Cnt)
+    {
+        pstNalu = &pstCtx->astNalu[i];
+        u32Cnt = 1;
+        if (SAMPLE_VENC_RTP_MODE_AGGR == pstCtx->stAttr.enMode)
+        {
+            u32Cnt = SAMPLE_COMM_VENC_RtpAggrCount(pstCtx, i);
+            if (u32Cnt > 0)
+            {
+                bLast = (i + u32Cnt == pstCtx->u32NaluCnt) ? HI_TRUE : HI_FALSE;
+                SAMPLE_COMM_VENC_RtpSendAggr(pstCtx, i, u32Cnt, bLast);
+                continue;
+            }
+            u32Cnt = 1;
+        }
+
+        bLast = (i + 1 == pstCtx->u32NaluCnt) ? HI_TRUE : HI_FALSE;
+        if ((SAMPLE_VENC_RTP_HDR_LEN + pstNalu->u32Len <= pstCtx->stAttr.u32Mtu)
+            || (SAMPLE_VENC_RTP_MODE_SINGLE == pstCtx->stAttr.enMode))
+        {
+            if (SAMPLE_VENC_RTP_HDR_LEN + pstNalu->u32Len > pstCtx->stAttr.u32Mtu)
+            {
+                pstCtx->stStat.u32Oversize++;
+            }
+            SAMPLE_COMM_VENC_RtpSendSingle(pstCtx, pstNalu, bLast);
+        }
+        else
+        {
+            SAMPLE_COMM_VENC_RtpSendFu(pstCtx, pstNalu, bLast);
+        }
+    }
+    pstCtx->stStat.u32Frames++;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop sending a venc channel, the socket stays open
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_RtpClose(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_RTP_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astRtp[VencChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astRtp[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->bOpen = HI_FALSE;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    pthread_mutex_destroy(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : statistics of the rtp packetizer of a venc channel, kept after close
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_RtpGetStat(VENC_CHN VencChn, SAMPLE_VENC_RTP_STAT_S *pstStat)
+{
+    SAMPLE_VENC_RTP_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astRtp[VencChn];
+
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        pthread_mutex_lock(&pstCtx->Lock);
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_RTP_STAT_S));
+        pthread_mutex_unlock(&pstCtx->Lock);
+    }
+    else
+    {
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_RTP_STAT_S));
+    }
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
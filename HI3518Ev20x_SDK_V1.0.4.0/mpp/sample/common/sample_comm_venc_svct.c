@@ -0,0 +1,395 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: svc-t temporal layer thinning of venc streams.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-4 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "sample_comm.h"
+
+/*
+ * Each consumer of a channel gets the frames up to its temporal layer and
+ * nothing else, no bytes are copied. The layer of a frame is worked out once
+ * for all consumers. A new layer only takes effect on a layer 0 frame: the
+ * higher layers refer to the base layer frames since the last one, which a
+ * consumer going up has not had. A new consumer waits for a key frame.
+ *
+ * The effective rate of a consumer is counted over tumbling windows that
+ * close on the first forwarded frame at least u32WindowMs after the window
+ * opened, so a steady thinned stream gives its exact rate.
+ */
+#define SAMPLE_VENC_SVCT_LAYER_NUM      3           /* layers of the svc-t modes of the encoder */
+
+typedef struct sample_venc_svct_slot_s
+{
+    HI_BOOL bUsed;
+    HI_BOOL bWaitKey;
+    SAMPLE_VENC_SVCT_CONSUMER_S stConsumer;
+    HI_U64 u64WinPts;                   /* pts the window opened at */
+    HI_U32 u32WinFrames;
+    HI_U64 u64WinBytes;
+    SAMPLE_VENC_SVCT_STAT_S stStat;
+}SAMPLE_VENC_SVCT_SLOT_S;
+
+typedef struct sample_venc_svct_ctx_s
+{
+    HI_BOOL bCreate;
+    SAMPLE_VENC_SVCT_ATTR_S stAttr;
+    SAMPLE_VENC_SVCT_SLOT_S astSlot[SAMPLE_VENC_SVCT_MAX_CONSUMER];
+    pthread_mutex_t Lock;
+}SAMPLE_VENC_SVCT_CTX_S;
+
+static SAMPLE_VENC_SVCT_CTX_S gs_astSvct[VENC_MAX_CHN_NUM];
+
+/* temporal id carried in the nal headers: h264 svc prefix or extension nal, h265 nuh_temporal_id_plus1 */
+static HI_U32 SAMPLE_COMM_VENC_SvctNalLayer(PAYLOAD_TYPE_E enType, const VENC_STREAM_S *pstStream)
+{
+    const HI_U8 *pu8Data;
+    HI_U32 u32Len;
+    HI_U32 u32NalType;
+    HI_U32 u32Layer = 0;
+    HI_U32 u32Tid;
+    HI_U32 i;
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        pu8Data = pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset;
+        u32Len = pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+        if ((u32Len > 4) && (0 == pu8Data[0]) && (0 == pu8Data[1]) && (0 == pu8Data[2]) && (1 == pu8Data[3]))
+        {
+            pu8Data += 4;
+            u32Len -= 4;
+        }
+        else if ((u32Len > 3) && (0 == pu8Data[0]) && (0 == pu8Data[1]) && (1 == pu8Data[2]))
+        {
+            pu8Data += 3;
+            u32Len -= 3;
+        }
+        else
+        {
+            continue;
+        }
+
+        u32Tid = 0;
+        if (PT_H264 == enType)
+        {
+            u32NalType = pu8Data[0] & 0x1F;
+            if (((14 == u32NalType) || (20 == u32NalType)) && (u32Len >= 4) && (0 != (pu8Data[1] & 0x80)))
+            {
+                u32Tid = pu8Data[3] >> 5;
+            }
+        }
+        else if (u32Len >= 2)
+        {
+            u32NalType = (pu8Data[0] >> 1) & 0x3F;
+            if ((u32NalType < 32) && (0 != (pu8Data[1] & 0x07)))
+            {
+                u32Tid = (pu8Data[1] & 0x07) - 1;
+            }
+        }
+        u32Layer = (u32Tid > u32Layer) ? u32Tid : u32Layer;
+    }
+
+    return u32Layer;
+}
+
+/******************************************************************************
+* funciton : temporal layer of a frame, 0 the base layer. The nal headers
+*            decide when they carry a temporal id, else the ref type of the
+*            stream info, grouped as SAMPLE_COMM_VENC_GetVencStreamProc_Svc_t does
+******************************************************************************/
+HI_U32 SAMPLE_COMM_VENC_GetSvctLayer(PAYLOAD_TYPE_E enType, const VENC_STREAM_S *pstStream)
+{
+    H264E_REF_TYPE_E enRefType;
+    HI_U32 u32Layer;
+
+    if ((PT_H264 != enType) && (PT_H265 != enType))
+    {
+        return 0;
+    }
+    u32Layer = SAMPLE_COMM_VENC_SvctNalLayer(enType, pstStream);
+    if (0 != u32Layer)
+    {
+        return u32Layer;
+    }
+
+    enRefType = (PT_H264 == enType) ? pstStream->stH264Info.enRefType : pstStream->stH265Info.enRefType;
+    switch (enRefType)
+    {
+        case BASE_IDRSLICE:
+        case BASE_REFTOIDR:
+        case BASE_PSLICE_REFBYBASE:
+            return 0;
+        case BASE_PSLICE_REFBYENHANCE:
+            return 1;
+        default:
+            return SAMPLE_VENC_SVCT_LAYER_NUM - 1;
+    }
+}
+
+/******************************************************************************
+* funciton : start thinning a venc channel, consumers are added after
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctCreate(VENC_CHN VencChn, const SAMPLE_VENC_SVCT_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstAttr)
+        || ((PT_H264 != pstAttr->enType) && (PT_H265 != pstAttr->enType)) || (0 == pstAttr->u32WindowMs))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+    if (HI_TRUE == pstCtx->bCreate)
+    {
+        SAMPLE_PRT("svc-t filter of chn[%d] is created already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_SVCT_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_SVCT_ATTR_S));
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pstCtx->bCreate = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop thinning a venc channel, every consumer goes with it
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctDestroy(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astSvct[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->bCreate = HI_FALSE;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    pthread_mutex_destroy(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : add a consumer of a venc channel, it starts at the next key frame
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctAddConsumer(VENC_CHN VencChn, const SAMPLE_VENC_SVCT_CONSUMER_S *pstConsumer, HI_S32 *ps32Id)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+    SAMPLE_VENC_SVCT_SLOT_S *pstSlot;
+    HI_S32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstConsumer) || (NULL == pstConsumer->pfnStreamProc)
+        || (NULL == ps32Id) || (HI_TRUE != gs_astSvct[VencChn].bCreate))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    for (i = 0; i < SAMPLE_VENC_SVCT_MAX_CONSUMER; i++)
+    {
+        if (HI_TRUE != pstCtx->astSlot[i].bUsed)
+        {
+            break;
+        }
+    }
+    if (SAMPLE_VENC_SVCT_MAX_CONSUMER == i)
+    {
+        pthread_mutex_unlock(&pstCtx->Lock);
+        SAMPLE_PRT("svc-t filter of chn[%d] has no free consumer\n", VencChn);
+        return HI_FAILURE;
+    }
+    pstSlot = &pstCtx->astSlot[i];
+    memset(pstSlot, 0, sizeof(SAMPLE_VENC_SVCT_SLOT_S));
+    memcpy(&pstSlot->stConsumer, pstConsumer, sizeof(SAMPLE_VENC_SVCT_CONSUMER_S));
+    pstSlot->stStat.u32MaxLayer = pstConsumer->u32MaxLayer;
+    pstSlot->stStat.u32PendingLayer = pstConsumer->u32MaxLayer;
+    pstSlot->bWaitKey = HI_TRUE;
+    pstSlot->bUsed = HI_TRUE;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    *ps32Id = i;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : remove a consumer, its callback is not called any more on return
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctRemoveConsumer(VENC_CHN VencChn, HI_S32 s32Id)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (s32Id < 0) || (s32Id >= SAMPLE_VENC_SVCT_MAX_CONSUMER)
+        || (HI_TRUE != gs_astSvct[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->astSlot[s32Id].bUsed = HI_FALSE;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : change the highest layer of a consumer, from the next layer 0 frame
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctSetLayer(VENC_CHN VencChn, HI_S32 s32Id, HI_U32 u32MaxLayer)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+    HI_S32 s32Ret = HI_FAILURE;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (s32Id < 0) || (s32Id >= SAMPLE_VENC_SVCT_MAX_CONSUMER)
+        || (HI_TRUE != gs_astSvct[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (HI_TRUE == pstCtx->astSlot[s32Id].bUsed)
+    {
+        pstCtx->astSlot[s32Id].stStat.u32PendingLayer = u32MaxLayer;
+        s32Ret = HI_SUCCESS;
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return s32Ret;
+}
+
+/******************************************************************************
+* funciton : hand one frame to the consumers whose layer it is in, fits
+*            SAMPLE_VENC_STREAM_PROC_FN
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+    SAMPLE_VENC_SVCT_SLOT_S *pstSlot;
+    HI_U64 u64Pts;
+    HI_U64 u64SpanUs;
+    HI_U32 u32Bytes = 0;
+    HI_U32 u32Layer;
+    HI_BOOL bKey;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream) || (0 == pstStream->u32PackCount)
+        || (HI_TRUE != gs_astSvct[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+
+    u32Layer = SAMPLE_COMM_VENC_GetSvctLayer(pstCtx->stAttr.enType, pstStream);
+    bKey = SAMPLE_COMM_VENC_IsKeyStream(pstCtx->stAttr.enType, pstStream);
+    u64Pts = pstStream->pstPack[0].u64PTS;
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        u32Bytes += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    for (i = 0; i < SAMPLE_VENC_SVCT_MAX_CONSUMER; i++)
+    {
+        pstSlot = &pstCtx->astSlot[i];
+        if (HI_TRUE != pstSlot->bUsed)
+        {
+            continue;
+        }
+        if ((HI_TRUE == pstSlot->bWaitKey) && (HI_TRUE != bKey))
+        {
+            pstSlot->stStat.u64Dropped++;
+            continue;
+        }
+        if (HI_TRUE == pstSlot->bWaitKey)
+        {
+            pstSlot->bWaitKey = HI_FALSE;
+            pstSlot->u64WinPts = u64Pts;
+        }
+        if ((0 == u32Layer) && (pstSlot->stStat.u32PendingLayer != pstSlot->stStat.u32MaxLayer))
+        {
+            pstSlot->stStat.u32MaxLayer = pstSlot->stStat.u32PendingLayer;
+            pstSlot->stStat.u32Switches++;
+        }
+        if (u32Layer > pstSlot->stStat.u32MaxLayer)
+        {
+            pstSlot->stStat.u64Dropped++;
+            continue;
+        }
+
+        if (HI_SUCCESS != pstSlot->stConsumer.pfnStreamProc(VencChn, pstStream, pstSlot->stConsumer.pPrivate))
+        {
+            pstSlot->stStat.u32ProcErrs++;
+        }
+        pstSlot->stStat.u64Frames++;
+        pstSlot->stStat.u64Bytes += u32Bytes;
+
+        u64SpanUs = (u64Pts > pstSlot->u64WinPts) ? u64Pts - pstSlot->u64WinPts : 0;
+        if ((0 != pstSlot->u32WinFrames) && (u64SpanUs >= (HI_U64)pstCtx->stAttr.u32WindowMs * 1000))
+        {
+            pstSlot->stStat.u32Fps100 = (HI_U32)((HI_U64)pstSlot->u32WinFrames * 100000000 / u64SpanUs);
+            pstSlot->stStat.u32Kbps = (HI_U32)(pstSlot->u64WinBytes * 8000 / u64SpanUs);
+            pstSlot->u64WinPts = u64Pts;
+            pstSlot->u32WinFrames = 0;
+            pstSlot->u64WinBytes = 0;
+        }
+        pstSlot->u32WinFrames++;
+        pstSlot->u64WinBytes += u32Bytes;
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : statistics of a consumer of a venc channel
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_SvctGetStat(VENC_CHN VencChn, HI_S32 s32Id, SAMPLE_VENC_SVCT_STAT_S *pstStat)
+{
+    SAMPLE_VENC_SVCT_CTX_S *pstCtx;
+    HI_S32 s32Ret = HI_FAILURE;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (s32Id < 0) || (s32Id >= SAMPLE_VENC_SVCT_MAX_CONSUMER)
+        || (NULL == pstStat) || (HI_TRUE != gs_astSvct[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astSvct[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (HI_TRUE == pstCtx->astSlot[s32Id].bUsed)
+    {
+        memcpy(pstStat, &pstCtx->astSlot[s32Id].stStat, sizeof(SAMPLE_VENC_SVCT_STAT_S));
+        s32Ret = HI_SUCCESS;
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return s32Ret;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
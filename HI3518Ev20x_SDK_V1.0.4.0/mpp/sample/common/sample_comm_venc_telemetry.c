@@ -0,0 +1,482 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: per channel venc telemetry.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-4 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "sample_comm.h"
+
+/*
+ * The stream path only appends one small record per frame to a ring
+ * allocated at create and bumps the since-start counters and histograms, all
+ * under the channel lock; HI_MPI_SYS_GetCurPts is called once per frame and
+ * HI_MPI_VENC_Query every u32BacklogPeriod frames, both before the lock is
+ * taken. The windowed figures are worked out from the ring when they are
+ * asked for, so their cost is on the reader, not on the encoder.
+ *
+ * A window of W ms ends at the newest frame and is anchored at the newest
+ * frame at least W ms older: the rates count the bytes and frames after the
+ * anchor over the pts span from the anchor, which is exact for a steady
+ * stream whatever the ring holds beyond the window.
+ */
+#define SAMPLE_VENC_TELEMETRY_NO_BACKLOG    0xFFFF
+
+typedef struct sample_venc_telemetry_frame_s
+{
+    HI_U64 u64Pts;
+    HI_U32 u32Bytes;
+    HI_U32 u32LatencyUs;
+    HI_U16 u16Backlog;                  /* SAMPLE_VENC_TELEMETRY_NO_BACKLOG when not queried */
+    HI_U8 u8Qp;
+    HI_U8 u8Key;
+}SAMPLE_VENC_TELEMETRY_FRAME_S;
+
+typedef struct sample_venc_telemetry_window_s
+{
+    HI_U64 u64Bytes;
+    HI_U64 u64SpanUs;
+    HI_U32 u32Frames;
+    HI_U64 u64IBytes;
+    HI_U32 u32IFrames;
+    HI_U32 u32IMax;
+    HI_U64 u64PBytes;
+    HI_U32 u32PFrames;
+    HI_U32 u32PMax;
+    HI_U64 u64LatencySum;
+    HI_U32 u32LatencyMax;
+    HI_U32 u32QpSum;
+    HI_U32 u32QpMin;
+    HI_U32 u32QpMax;
+    HI_U32 u32BacklogMax;
+}SAMPLE_VENC_TELEMETRY_WINDOW_S;
+
+typedef struct sample_venc_telemetry_ctx_s
+{
+    HI_BOOL bCreate;
+    SAMPLE_VENC_TELEMETRY_ATTR_S stAttr;
+    SAMPLE_VENC_TELEMETRY_FRAME_S *pstFrame;
+    HI_U32 u32Head;                     /* next record to write */
+    HI_U32 u32Filled;
+    HI_U64 u64FirstPts;
+    HI_U32 u32FirstBytes;
+    HI_BOOL bKeySeen;
+    HI_U32 u32SinceKey;
+    pthread_mutex_t Lock;
+    SAMPLE_VENC_TELEMETRY_STAT_S stStat;
+}SAMPLE_VENC_TELEMETRY_CTX_S;
+
+static SAMPLE_VENC_TELEMETRY_CTX_S gs_astTelemetry[VENC_MAX_CHN_NUM];
+
+/* bucket of a value in ms or KB: 0 below 1, n from 2^(n-1) up to 2^n */
+static HI_U32 SAMPLE_COMM_VENC_TelemetryBucket(HI_U32 u32Value)
+{
+    HI_U32 u32Bucket = 0;
+
+    while ((0 != u32Value) && (u32Bucket < SAMPLE_VENC_TELEMETRY_HIST_NUM - 1))
+    {
+        u32Value >>= 1;
+        u32Bucket++;
+    }
+    return u32Bucket;
+}
+
+static HI_U32 SAMPLE_COMM_VENC_TelemetryQp(PAYLOAD_TYPE_E enType, const VENC_STREAM_S *pstStream)
+{
+    switch (enType)
+    {
+        case PT_H264:
+            return pstStream->stH264Info.u32StartQp;
+        case PT_H265:
+            return pstStream->stH265Info.u32StartQp;
+        case PT_JPEG:
+        case PT_MJPEG:
+            return pstStream->stJpegInfo.u32Qfactor;
+        default:
+            return 0;
+    }
+}
+
+/* sum the records of the u32Ms window, called with the lock held */
+static HI_VOID SAMPLE_COMM_VENC_TelemetryWindow(SAMPLE_VENC_TELEMETRY_CTX_S *pstCtx, HI_U32 u32Ms,
+                                                SAMPLE_VENC_TELEMETRY_WINDOW_S *pstWin)
+{
+    SAMPLE_VENC_TELEMETRY_FRAME_S *pstNewest;
+    SAMPLE_VENC_TELEMETRY_FRAME_S *pstFrame;
+    HI_U64 u64WinUs = (HI_U64)u32Ms * 1000;
+    HI_U32 u32Max = pstCtx->stAttr.u32MaxFrames;
+    HI_U32 u32Idx;
+    HI_U32 i;
+
+    memset(pstWin, 0, sizeof(SAMPLE_VENC_TELEMETRY_WINDOW_S));
+    pstWin->u32QpMin = ~0U;
+    if (pstCtx->u32Filled < 2)
+    {
+        pstWin->u32QpMin = 0;
+        return;
+    }
+    pstNewest = &pstCtx->pstFrame[(pstCtx->u32Head + u32Max - 1) % u32Max];
+
+    for (i = 0; i < pstCtx->u32Filled; i++)
+    {
+        u32Idx = (pstCtx->u32Head + u32Max - 1 - i) % u32Max;
+        pstFrame = &pstCtx->pstFrame[u32Idx];
+        if ((i > 0) && ((pstNewest->u64Pts - pstFrame->u64Pts >= u64WinUs) || (i + 1 == pstCtx->u32Filled)))
+        {
+            pstWin->u64SpanUs = pstNewest->u64Pts - pstFrame->u64Pts;
+            break;
+        }
+
+        pstWin->u64Bytes += pstFrame->u32Bytes;
+        pstWin->u32Frames++;
+        if (pstFrame->u8Key)
+        {
+            pstWin->u64IBytes += pstFrame->u32Bytes;
+            pstWin->u32IFrames++;
+            pstWin->u32IMax = (pstFrame->u32Bytes > pstWin->u32IMax) ? pstFrame->u32Bytes : pstWin->u32IMax;
+        }
+        else
+        {
+            pstWin->u64PBytes += pstFrame->u32Bytes;
+            pstWin->u32PFrames++;
+            pstWin->u32PMax = (pstFrame->u32Bytes > pstWin->u32PMax) ? pstFrame->u32Bytes : pstWin->u32PMax;
+        }
+        pstWin->u64LatencySum += pstFrame->u32LatencyUs;
+        pstWin->u32LatencyMax = (pstFrame->u32LatencyUs > pstWin->u32LatencyMax) ? pstFrame->u32LatencyUs : pstWin->u32LatencyMax;
+        pstWin->u32QpSum += pstFrame->u8Qp;
+        pstWin->u32QpMin = (pstFrame->u8Qp < pstWin->u32QpMin) ? pstFrame->u8Qp : pstWin->u32QpMin;
+        pstWin->u32QpMax = (pstFrame->u8Qp > pstWin->u32QpMax) ? pstFrame->u8Qp : pstWin->u32QpMax;
+        if ((SAMPLE_VENC_TELEMETRY_NO_BACKLOG != pstFrame->u16Backlog) && (pstFrame->u16Backlog > pstWin->u32BacklogMax))
+        {
+            pstWin->u32BacklogMax = pstFrame->u16Backlog;
+        }
+    }
+}
+
+/******************************************************************************
+* funciton : start telemetry of a venc channel, the window ring is allocated here
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_TelemetryCreate(VENC_CHN VencChn, const SAMPLE_VENC_TELEMETRY_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_TELEMETRY_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstAttr)
+        || (0 == pstAttr->u32ShortMs) || (pstAttr->u32LongMs < pstAttr->u32ShortMs) || (pstAttr->u32MaxFrames < 2))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astTelemetry[VencChn];
+    if (HI_TRUE == pstCtx->bCreate)
+    {
+        SAMPLE_PRT("telemetry of chn[%d] is created already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_TELEMETRY_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_TELEMETRY_ATTR_S));
+    pstCtx->pstFrame = (SAMPLE_VENC_TELEMETRY_FRAME_S *)malloc(sizeof(SAMPLE_VENC_TELEMETRY_FRAME_S) * pstAttr->u32MaxFrames);
+    if (NULL == pstCtx->pstFrame)
+    {
+        SAMPLE_PRT("malloc telemetry ring failed!\n");
+        return HI_FAILURE;
+    }
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pstCtx->bCreate = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop telemetry of a venc channel, the since-start figures are kept
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_TelemetryDestroy(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_TELEMETRY_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astTelemetry[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astTelemetry[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->bCreate = HI_FALSE;
+    free(pstCtx->pstFrame);
+    pstCtx->pstFrame = NULL;
+    pstCtx->u32Filled = 0;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    pthread_mutex_destroy(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : account one frame, fits SAMPLE_VENC_STREAM_PROC_FN
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_TelemetryStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    SAMPLE_VENC_TELEMETRY_CTX_S *pstCtx;
+    SAMPLE_VENC_TELEMETRY_FRAME_S *pstFrame;
+    SAMPLE_VENC_TELEMETRY_STAT_S *pstStat;
+    VENC_CHN_STAT_S stChnStat;
+    HI_U64 u64Now = 0;
+    HI_U64 u64Pts;
+    HI_U32 u32Bytes = 0;
+    HI_U32 u32LatencyUs;
+    HI_U32 u32Backlog = SAMPLE_VENC_TELEMETRY_NO_BACKLOG;
+    HI_U32 u32Qp;
+    HI_BOOL bKey;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream) || (0 == pstStream->u32PackCount)
+        || (HI_TRUE != gs_astTelemetry[VencChn].bCreate))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astTelemetry[VencChn];
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        u32Bytes += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+    u64Pts = pstStream->pstPack[0].u64PTS;
+    bKey = SAMPLE_COMM_VENC_IsKeyStream(pstCtx->stAttr.enType, pstStream);
+    u32Qp = SAMPLE_COMM_VENC_TelemetryQp(pstCtx->stAttr.enType, pstStream);
+    (HI_VOID)HI_MPI_SYS_GetCurPts(&u64Now);
+    u32LatencyUs = (u64Now > u64Pts) ? (HI_U32)(u64Now - u64Pts) : 0;
+    /* frames of a channel come one at a time, only this function moves u64Frames */
+    if ((0 != pstCtx->stAttr.u32BacklogPeriod) && (0 == (pstCtx->stStat.u64Frames % pstCtx->stAttr.u32BacklogPeriod))
+        && (HI_SUCCESS == HI_MPI_VENC_Query(VencChn, &stChnStat)))
+    {
+        u32Backlog = (stChnStat.u32LeftStreamFrames < SAMPLE_VENC_TELEMETRY_NO_BACKLOG)
+            ? stChnStat.u32LeftStreamFrames : SAMPLE_VENC_TELEMETRY_NO_BACKLOG - 1;
+    }
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (HI_TRUE != pstCtx->bCreate)
+    {
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_FAILURE;
+    }
+    pstStat = &pstCtx->stStat;
+    pstFrame = &pstCtx->pstFrame[pstCtx->u32Head];
+    pstFrame->u64Pts = u64Pts;
+    pstFrame->u32Bytes = u32Bytes;
+    pstFrame->u32LatencyUs = u32LatencyUs;
+    pstFrame->u16Backlog = (HI_U16)u32Backlog;
+    pstFrame->u8Qp = (u32Qp > 255) ? 255 : (HI_U8)u32Qp;
+    pstFrame->u8Key = (HI_TRUE == bKey) ? 1 : 0;
+    pstCtx->u32Head = (pstCtx->u32Head + 1) % pstCtx->stAttr.u32MaxFrames;
+    if (pstCtx->u32Filled < pstCtx->stAttr.u32MaxFrames)
+    {
+        pstCtx->u32Filled++;
+    }
+
+    if (0 == pstStat->u64Frames)
+    {
+        pstCtx->u64FirstPts = u64Pts;
+        pstCtx->u32FirstBytes = u32Bytes;
+    }
+    pstStat->u64Frames++;
+    pstStat->u64Bytes += u32Bytes;
+    pstStat->u32QpLast = u32Qp;
+    pstStat->u32LatencyUsLast = u32LatencyUs;
+    pstStat->au32LatencyHist[SAMPLE_COMM_VENC_TelemetryBucket(u32LatencyUs / 1000)]++;
+    if (SAMPLE_VENC_TELEMETRY_NO_BACKLOG != u32Backlog)
+    {
+        pstStat->u32BacklogLast = u32Backlog;
+    }
+    if (HI_TRUE == bKey)
+    {
+        pstStat->u32IFrameBytesLast = u32Bytes;
+        pstStat->au32IFrameHist[SAMPLE_COMM_VENC_TelemetryBucket(u32Bytes >> 10)]++;
+        if (HI_TRUE == pstCtx->bKeySeen)
+        {
+            pstStat->u32GopFrames = pstCtx->u32SinceKey;
+            pstStat->u32GopFramesMin = ((0 == pstStat->u32Gops) || (pstCtx->u32SinceKey < pstStat->u32GopFramesMin))
+                ? pstCtx->u32SinceKey : pstStat->u32GopFramesMin;
+            pstStat->u32GopFramesMax = (pstCtx->u32SinceKey > pstStat->u32GopFramesMax)
+                ? pstCtx->u32SinceKey : pstStat->u32GopFramesMax;
+            pstStat->u32Gops++;
+        }
+        pstCtx->bKeySeen = HI_TRUE;
+        pstCtx->u32SinceKey = 0;
+    }
+    else
+    {
+        pstStat->u32PFrameBytesLast = u32Bytes;
+        pstStat->au32PFrameHist[SAMPLE_COMM_VENC_TelemetryBucket(u32Bytes >> 10)]++;
+    }
+    pstCtx->u32SinceKey++;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : telemetry of a venc channel, the windows are summed here
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_TelemetryGetStat(VENC_CHN VencChn, SAMPLE_VENC_TELEMETRY_STAT_S *pstStat)
+{
+    SAMPLE_VENC_TELEMETRY_CTX_S *pstCtx;
+    SAMPLE_VENC_TELEMETRY_WINDOW_S stShort;
+    SAMPLE_VENC_TELEMETRY_WINDOW_S stLong;
+    HI_U64 u64SpanUs;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astTelemetry[VencChn];
+
+    if (HI_TRUE != pstCtx->bCreate)
+    {
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_TELEMETRY_STAT_S));
+        return HI_SUCCESS;
+    }
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_TELEMETRY_STAT_S));
+    SAMPLE_COMM_VENC_TelemetryWindow(pstCtx, pstCtx->stAttr.u32ShortMs, &stShort);
+    SAMPLE_COMM_VENC_TelemetryWindow(pstCtx, pstCtx->stAttr.u32LongMs, &stLong);
+    u64SpanUs = 0;
+    if (pstCtx->u32Filled > 0)
+    {
+        u64SpanUs = pstCtx->pstFrame[(pstCtx->u32Head + pstCtx->stAttr.u32MaxFrames - 1) % pstCtx->stAttr.u32MaxFrames].u64Pts
+            - pstCtx->u64FirstPts;
+    }
+    if (0 != u64SpanUs)
+    {
+        pstStat->u32AvgKbps = (HI_U32)((pstStat->u64Bytes - pstCtx->u32FirstBytes) * 8000 / u64SpanUs);
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    if (0 != stShort.u64SpanUs)
+    {
+        pstStat->u32ShortKbps = (HI_U32)(stShort.u64Bytes * 8000 / stShort.u64SpanUs);
+        pstStat->u32ShortFps100 = (HI_U32)((HI_U64)stShort.u32Frames * 100000000 / stShort.u64SpanUs);
+    }
+    if (0 != stLong.u64SpanUs)
+    {
+        pstStat->u32LongKbps = (HI_U32)(stLong.u64Bytes * 8000 / stLong.u64SpanUs);
+    }
+    if (0 != stLong.u32IFrames)
+    {
+        pstStat->u32IFrameBytesAvg = (HI_U32)(stLong.u64IBytes / stLong.u32IFrames);
+    }
+    if (0 != stLong.u32PFrames)
+    {
+        pstStat->u32PFrameBytesAvg = (HI_U32)(stLong.u64PBytes / stLong.u32PFrames);
+    }
+    pstStat->u32IFrameBytesMax = stLong.u32IMax;
+    pstStat->u32PFrameBytesMax = stLong.u32PMax;
+    if (0 != stLong.u32Frames)
+    {
+        pstStat->u32LatencyUsAvg = (HI_U32)(stLong.u64LatencySum / stLong.u32Frames);
+        pstStat->u32QpAvg100 = stLong.u32QpSum * 100 / stLong.u32Frames;
+    }
+    pstStat->u32LatencyUsMax = stLong.u32LatencyMax;
+    pstStat->u32QpMin = stLong.u32QpMin;
+    pstStat->u32QpMax = stLong.u32QpMax;
+    pstStat->u32BacklogMax = stLong.u32BacklogMax;
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 SAMPLE_COMM_VENC_TelemetryHist(HI_CHAR *pszBuf, HI_U32 u32Len, const HI_CHAR *pszName, const HI_U32 *pu32Hist)
+{
+    HI_S32 s32Len;
+    HI_S32 s32Total = 0;
+    HI_U32 i;
+
+    for (i = 0; i < SAMPLE_VENC_TELEMETRY_HIST_NUM; i++)
+    {
+        s32Len = snprintf(pszBuf + s32Total, u32Len - s32Total, "%s%u", (0 == i) ? pszName : ",", pu32Hist[i]);
+        if ((s32Len < 0) || ((HI_U32)(s32Total + s32Len) >= u32Len))
+        {
+            return HI_FAILURE;
+        }
+        s32Total += s32Len;
+    }
+    return s32Total;
+}
+
+/******************************************************************************
+* funciton : telemetry of a venc channel as one text line of key=value fields,
+*            slashes separate last/avg/max or short/long/since-start values.
+*            Returns the length written, HI_FAILURE when u32Len is too short
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_TelemetryExport(VENC_CHN VencChn, HI_CHAR *pszBuf, HI_U32 u32Len)
+{
+    SAMPLE_VENC_TELEMETRY_STAT_S stStat;
+    HI_S32 s32Len;
+    HI_S32 s32Total;
+
+    if ((NULL == pszBuf) || (0 == u32Len) || (HI_SUCCESS != SAMPLE_COMM_VENC_TelemetryGetStat(VencChn, &stStat)))
+    {
+        return HI_FAILURE;
+    }
+
+    s32Total = snprintf(pszBuf, u32Len,
+                        "chn=%d frames=%llu bytes=%llu kbps=%u/%u/%u fps=%u.%02u i=%u/%u/%u p=%u/%u/%u gop=%u/%u/%u/%u "
+                        "qp=%u/%u.%02u/%u/%u lat=%u/%u/%u backlog=%u/%u ",
+                        VencChn, (unsigned long long)stStat.u64Frames, (unsigned long long)stStat.u64Bytes,
+                        stStat.u32ShortKbps, stStat.u32LongKbps, stStat.u32AvgKbps,
+                        stStat.u32ShortFps100 / 100, stStat.u32ShortFps100 % 100,
+                        stStat.u32IFrameBytesLast, stStat.u32IFrameBytesAvg, stStat.u32IFrameBytesMax,
+                        stStat.u32PFrameBytesLast, stStat.u32PFrameBytesAvg, stStat.u32PFrameBytesMax,
+                        stStat.u32GopFrames, stStat.u32GopFramesMin, stStat.u32GopFramesMax, stStat.u32Gops,
+                        stStat.u32QpLast, stStat.u32QpAvg100 / 100, stStat.u32QpAvg100 % 100, stStat.u32QpMin, stStat.u32QpMax,
+                        stStat.u32LatencyUsLast, stStat.u32LatencyUsAvg, stStat.u32LatencyUsMax,
+                        stStat.u32BacklogLast, stStat.u32BacklogMax);
+    if ((s32Total < 0) || ((HI_U32)s32Total >= u32Len))
+    {
+        return HI_FAILURE;
+    }
+
+    s32Len = SAMPLE_COMM_VENC_TelemetryHist(pszBuf + s32Total, u32Len - s32Total, "lath=", stStat.au32LatencyHist);
+    if (HI_FAILURE == s32Len)
+    {
+        return HI_FAILURE;
+    }
+    s32Total += s32Len;
+    s32Len = SAMPLE_COMM_VENC_TelemetryHist(pszBuf + s32Total, u32Len - s32Total, " ih=", stStat.au32IFrameHist);
+    if (HI_FAILURE == s32Len)
+    {
+        return HI_FAILURE;
+    }
+    s32Total += s32Len;
+    s32Len = SAMPLE_COMM_VENC_TelemetryHist(pszBuf + s32Total, u32Len - s32Total, " ph=", stStat.au32PFrameHist);
+    if (HI_FAILURE == s32Len)
+    {
+        return HI_FAILURE;
+    }
+    s32Total += s32Len;
+    if ((HI_U32)s32Total + 1 >= u32Len)
+    {
+        return HI_FAILURE;
+    }
+    pszBuf[s32Total++] = '\n';
+    pszBuf[s32Total] = '\0';
+
+    return s32Total;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
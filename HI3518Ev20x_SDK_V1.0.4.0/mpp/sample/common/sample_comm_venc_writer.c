@@ -0,0 +1,458 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: asynchronous aligned venc stream writer.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-3 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE             /* O_DIRECT */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "sample_comm.h"
+
+/*
+ * The caller only copies packs into a ring of aligned buffers; full buffers
+ * are handed to one io thread per file that writes them at aligned offsets,
+ * so O_DIRECT keeps the page cache out of the way and a slow card only
+ * blocks the caller once every buffer is queued. The last, partial buffer is
+ * written padded on close and the file truncated back to its real length.
+ */
+#define SAMPLE_VENC_WRITER_ALIGN    4096
+
+typedef struct sample_venc_writer_ctx_s
+{
+    HI_BOOL bOpen;
+    HI_BOOL bExit;
+    HI_BOOL bWaitKey;           /* a frame was dropped, skip to the next key frame */
+    HI_S32 s32Fd;
+    SAMPLE_VENC_WRITER_ATTR_S stAttr;
+    HI_U8 *pu8Buf;              /* u32BufCnt buffers of u32BufSize */
+    HI_U32 *pu32Len;
+    HI_U32 u32Head;             /* next buffer for the io thread */
+    HI_U32 u32Full;             /* buffers queued for the io thread, head included while written */
+    HI_U32 u32Fill;             /* buffer the caller copies into, always (head + full) % cnt */
+    HI_U32 u32FillLen;
+    HI_U64 u64LastSync;
+    pthread_t Pid;
+    pthread_mutex_t Lock;
+    pthread_cond_t FullCond;
+    pthread_cond_t FreeCond;
+    SAMPLE_VENC_WRITER_STAT_S stStat;
+}SAMPLE_VENC_WRITER_CTX_S;
+
+static SAMPLE_VENC_WRITER_CTX_S gs_astWriter[VENC_MAX_CHN_NUM];
+
+static HI_U64 SAMPLE_COMM_VENC_WriterNowUs(HI_VOID)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return (HI_U64)stNow.tv_sec * 1000000 + stNow.tv_nsec / 1000;
+}
+
+static HI_S32 SAMPLE_COMM_VENC_WriterPwrite(HI_S32 s32Fd, const HI_U8 *pu8Data, HI_U32 u32Len, HI_U64 u64Offset)
+{
+    ssize_t s32Len;
+
+    while (u32Len > 0)
+    {
+        s32Len = pwrite(s32Fd, pu8Data, u32Len, (off_t)u64Offset);
+        if (s32Len < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return HI_FAILURE;
+        }
+        pu8Data += s32Len;
+        u32Len -= s32Len;
+        u64Offset += s32Len;
+    }
+
+    return HI_SUCCESS;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_WriterSync(SAMPLE_VENC_WRITER_CTX_S *pstCtx, HI_U64 u64Written)
+{
+    HI_U64 u64Now;
+
+    if (SAMPLE_VENC_WRITER_SYNC_BYTES == pstCtx->stAttr.enSync)
+    {
+        if (u64Written - pstCtx->u64LastSync < pstCtx->stAttr.u32SyncParam)
+        {
+            return;
+        }
+        pstCtx->u64LastSync = u64Written;
+    }
+    else if (SAMPLE_VENC_WRITER_SYNC_PERIOD == pstCtx->stAttr.enSync)
+    {
+        u64Now = SAMPLE_COMM_VENC_WriterNowUs() / 1000;
+        if (u64Now - pstCtx->u64LastSync < pstCtx->stAttr.u32SyncParam)
+        {
+            return;
+        }
+        pstCtx->u64LastSync = u64Now;
+    }
+    else
+    {
+        return;
+    }
+
+    fdatasync(pstCtx->s32Fd);
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->stStat.u32Syncs++;
+    pthread_mutex_unlock(&pstCtx->Lock);
+}
+
+static HI_VOID* SAMPLE_COMM_VENC_WriterProc(HI_VOID *p)
+{
+    SAMPLE_VENC_WRITER_CTX_S *pstCtx = (SAMPLE_VENC_WRITER_CTX_S *)p;
+    HI_U8 *pu8Data;
+    HI_U32 u32Len;
+    HI_U32 u32IoLen;
+    HI_U64 u64Offset = 0;
+    HI_S32 s32Ret;
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    while (1)
+    {
+        while ((0 == pstCtx->u32Full) && (HI_TRUE != pstCtx->bExit))
+        {
+            pthread_cond_wait(&pstCtx->FullCond, &pstCtx->Lock);
+        }
+        if (0 == pstCtx->u32Full)
+        {
+            break;
+        }
+        pu8Data = pstCtx->pu8Buf + (size_t)pstCtx->u32Head * pstCtx->stAttr.u32BufSize;
+        u32Len = pstCtx->pu32Len[pstCtx->u32Head];
+        pthread_mutex_unlock(&pstCtx->Lock);
+
+        /* only the tail handed over on close is short, o_direct needs it padded */
+        u32IoLen = u32Len;
+        if (HI_TRUE == pstCtx->stStat.bDirect)
+        {
+            u32IoLen = (u32Len + SAMPLE_VENC_WRITER_ALIGN - 1) & ~(SAMPLE_VENC_WRITER_ALIGN - 1);
+        }
+        s32Ret = SAMPLE_COMM_VENC_WriterPwrite(pstCtx->s32Fd, pu8Data, u32IoLen, u64Offset);
+        u64Offset += u32Len;
+        if (HI_SUCCESS == s32Ret)
+        {
+            SAMPLE_COMM_VENC_WriterSync(pstCtx, u64Offset);
+        }
+
+        pthread_mutex_lock(&pstCtx->Lock);
+        if (HI_SUCCESS == s32Ret)
+        {
+            pstCtx->stStat.u64Written += u32Len;
+        }
+        else
+        {
+            pstCtx->stStat.u32WriteErrs++;
+        }
+        pstCtx->u32Head = (pstCtx->u32Head + 1) % pstCtx->stAttr.u32BufCnt;
+        pstCtx->u32Full--;
+        pthread_cond_signal(&pstCtx->FreeCond);
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    if ((HI_TRUE == pstCtx->stStat.bDirect) && (0 != ftruncate(pstCtx->s32Fd, (off_t)u64Offset)))
+    {
+        SAMPLE_PRT("truncate record file failed!\n");
+    }
+    fdatasync(pstCtx->s32Fd);
+
+    return NULL;
+}
+
+/* queue the fill buffer and wait for the next one, the only place the caller blocks */
+static HI_VOID SAMPLE_COMM_VENC_WriterHandOff(SAMPLE_VENC_WRITER_CTX_S *pstCtx)
+{
+    HI_U64 u64Start;
+    HI_U32 u32Stall;
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->pu32Len[pstCtx->u32Fill] = pstCtx->u32FillLen;
+    pstCtx->u32Full++;
+    if (pstCtx->u32Full > pstCtx->stStat.u32QueueMax)
+    {
+        pstCtx->stStat.u32QueueMax = pstCtx->u32Full;
+    }
+    pthread_cond_signal(&pstCtx->FullCond);
+    if (pstCtx->u32Full == pstCtx->stAttr.u32BufCnt)
+    {
+        u64Start = SAMPLE_COMM_VENC_WriterNowUs();
+        while (pstCtx->u32Full == pstCtx->stAttr.u32BufCnt)
+        {
+            pthread_cond_wait(&pstCtx->FreeCond, &pstCtx->Lock);
+        }
+        u32Stall = (HI_U32)(SAMPLE_COMM_VENC_WriterNowUs() - u64Start);
+        pstCtx->stStat.u32Stalls++;
+        pstCtx->stStat.u64StallUsTotal += u32Stall;
+        if (u32Stall > pstCtx->stStat.u32StallUsMax)
+        {
+            pstCtx->stStat.u32StallUsMax = u32Stall;
+        }
+    }
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    pstCtx->u32Fill = (pstCtx->u32Fill + 1) % pstCtx->stAttr.u32BufCnt;
+    pstCtx->u32FillLen = 0;
+}
+
+static HI_VOID SAMPLE_COMM_VENC_WriterFree(SAMPLE_VENC_WRITER_CTX_S *pstCtx)
+{
+    if (pstCtx->s32Fd >= 0)
+    {
+        close(pstCtx->s32Fd);
+        pstCtx->s32Fd = -1;
+    }
+    free(pstCtx->pu8Buf);
+    pstCtx->pu8Buf = NULL;
+    free(pstCtx->pu32Len);
+    pstCtx->pu32Len = NULL;
+    pthread_mutex_destroy(&pstCtx->Lock);
+    pthread_cond_destroy(&pstCtx->FullCond);
+    pthread_cond_destroy(&pstCtx->FreeCond);
+}
+
+/******************************************************************************
+* funciton : open the record file of a venc channel behind an io thread
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_WriterOpen(VENC_CHN VencChn, const HI_CHAR *pszFile, const SAMPLE_VENC_WRITER_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_WRITER_CTX_S *pstCtx;
+    HI_VOID *pBuf = NULL;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pszFile) || (NULL == pstAttr))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    if ((0 == pstAttr->u32BufSize) || (0 != pstAttr->u32BufSize % SAMPLE_VENC_WRITER_ALIGN)
+        || (pstAttr->u32BufCnt < 2) || (pstAttr->enSync > SAMPLE_VENC_WRITER_SYNC_PERIOD))
+    {
+        SAMPLE_PRT("writer attr invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astWriter[VencChn];
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        SAMPLE_PRT("writer of chn[%d] is open already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_WRITER_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_WRITER_ATTR_S));
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pthread_cond_init(&pstCtx->FullCond, NULL);
+    pthread_cond_init(&pstCtx->FreeCond, NULL);
+
+    pstCtx->s32Fd = -1;
+    if (HI_TRUE == pstAttr->bDirect)
+    {
+        pstCtx->s32Fd = open(pszFile, O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+        pstCtx->stStat.bDirect = (pstCtx->s32Fd >= 0) ? HI_TRUE : HI_FALSE;
+    }
+    if (pstCtx->s32Fd < 0)
+    {
+        pstCtx->s32Fd = open(pszFile, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (pstCtx->s32Fd < 0)
+    {
+        SAMPLE_PRT("open file[%s] failed!\n", pszFile);
+        SAMPLE_COMM_VENC_WriterFree(pstCtx);
+        return HI_FAILURE;
+    }
+
+    if (0 != posix_memalign(&pBuf, SAMPLE_VENC_WRITER_ALIGN, (size_t)pstAttr->u32BufSize * pstAttr->u32BufCnt))
+    {
+        pBuf = NULL;
+    }
+    pstCtx->pu8Buf = (HI_U8 *)pBuf;
+    pstCtx->pu32Len = (HI_U32 *)malloc(sizeof(HI_U32) * pstAttr->u32BufCnt);
+    if ((NULL == pstCtx->pu8Buf) || (NULL == pstCtx->pu32Len))
+    {
+        SAMPLE_PRT("malloc writer buffer failed!\n");
+        SAMPLE_COMM_VENC_WriterFree(pstCtx);
+        return HI_FAILURE;
+    }
+    /* fault the ring in now rather than on the first pass of the caller */
+    memset(pstCtx->pu8Buf, 0, (size_t)pstAttr->u32BufSize * pstAttr->u32BufCnt);
+    if (SAMPLE_VENC_WRITER_SYNC_PERIOD == pstAttr->enSync)
+    {
+        pstCtx->u64LastSync = SAMPLE_COMM_VENC_WriterNowUs() / 1000;
+    }
+
+    if (0 != pthread_create(&pstCtx->Pid, 0, SAMPLE_COMM_VENC_WriterProc, (HI_VOID *)pstCtx))
+    {
+        SAMPLE_COMM_VENC_WriterFree(pstCtx);
+        return HI_FAILURE;
+    }
+    pstCtx->bOpen = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : copy one frame into the writer, fits SAMPLE_VENC_STREAM_PROC_FN
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_WriterStream(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    SAMPLE_VENC_WRITER_CTX_S *pstCtx;
+    const HI_U8 *pu8Data;
+    HI_U32 u32Len;
+    HI_U32 u32Copy;
+    HI_U32 u32Bytes = 0;
+    HI_U64 u64Room;
+    HI_U32 i;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStream)
+        || (HI_TRUE != gs_astWriter[VencChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astWriter[VencChn];
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        u32Bytes += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+
+    if (HI_TRUE == pstCtx->stAttr.bDropWhenFull)
+    {
+        pthread_mutex_lock(&pstCtx->Lock);
+        u64Room = (HI_U64)(pstCtx->stAttr.u32BufCnt - 1 - pstCtx->u32Full) * pstCtx->stAttr.u32BufSize
+                  + pstCtx->stAttr.u32BufSize - pstCtx->u32FillLen;
+        if ((HI_TRUE == pstCtx->bWaitKey)
+            && (HI_TRUE == SAMPLE_COMM_VENC_IsKeyStream(pstCtx->stAttr.enType, pstStream)))
+        {
+            pstCtx->bWaitKey = HI_FALSE;
+        }
+        if ((HI_TRUE == pstCtx->bWaitKey) || (u32Bytes > u64Room))
+        {
+            /* a partial gop would not decode, drop up to the next key frame */
+            pstCtx->bWaitKey = HI_TRUE;
+            pstCtx->stStat.u32DropFrames++;
+            pthread_mutex_unlock(&pstCtx->Lock);
+            return HI_SUCCESS;
+        }
+        pthread_mutex_unlock(&pstCtx->Lock);
+    }
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        if (pstStream->pstPack[i].u32Len <= pstStream->pstPack[i].u32Offset)
+        {
+            continue;
+        }
+        pu8Data = pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset;
+        u32Len = pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+        while (u32Len > 0)
+        {
+            u32Copy = pstCtx->stAttr.u32BufSize - pstCtx->u32FillLen;
+            if (u32Copy > u32Len)
+            {
+                u32Copy = u32Len;
+            }
+            memcpy(pstCtx->pu8Buf + (size_t)pstCtx->u32Fill * pstCtx->stAttr.u32BufSize + pstCtx->u32FillLen,
+                   pu8Data, u32Copy);
+            pstCtx->u32FillLen += u32Copy;
+            pu8Data += u32Copy;
+            u32Len -= u32Copy;
+            if (pstCtx->u32FillLen == pstCtx->stAttr.u32BufSize)
+            {
+                SAMPLE_COMM_VENC_WriterHandOff(pstCtx);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->stStat.u64Bytes += u32Bytes;
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : write what is queued, sync and close the record file
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_WriterClose(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_WRITER_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astWriter[VencChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astWriter[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    if (pstCtx->u32FillLen > 0)
+    {
+        /* the io thread may hold every other buffer, the fill one is still ours */
+        pstCtx->pu32Len[pstCtx->u32Fill] = pstCtx->u32FillLen;
+        pstCtx->u32Full++;
+        pstCtx->u32FillLen = 0;
+    }
+    pstCtx->bExit = HI_TRUE;
+    pthread_cond_signal(&pstCtx->FullCond);
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    pthread_join(pstCtx->Pid, 0);
+    pstCtx->bOpen = HI_FALSE;
+    SAMPLE_COMM_VENC_WriterFree(pstCtx);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : statistics of the writer of a venc channel, kept after close
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_WriterGetStat(VENC_CHN VencChn, SAMPLE_VENC_WRITER_STAT_S *pstStat)
+{
+    SAMPLE_VENC_WRITER_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astWriter[VencChn];
+
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        pthread_mutex_lock(&pstCtx->Lock);
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_WRITER_STAT_S));
+        pthread_mutex_unlock(&pstCtx->Lock);
+    }
+    else
+    {
+        memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_WRITER_STAT_S));
+    }
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,333 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: raw yuv files into venc frames.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-4 Created
+******************************************************************************/
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#include "sample_comm.h"
+
+/*
+ * A thread per channel reads whole file frames, one fread each, into
+ * u32Buffers slots ahead of the caller. YuvReaderGet converts the oldest
+ * slot straight into the frame buffer given, so the file is read while the
+ * encoder works on the frame before, and the planar frame is interleaved
+ * once on the way into the vb block instead of in place.
+ */
+typedef struct sample_venc_yuv_reader_ctx_s
+{
+    HI_BOOL bStart;
+    HI_BOOL bEof;
+    SAMPLE_VENC_YUV_READER_ATTR_S stAttr;
+    FILE *pFile;
+    HI_U32 u32FrameSize;
+    HI_U8 *pu8Buf;                      /* u32Buffers slots of u32FrameSize */
+    HI_U32 u32Head;                     /* next slot the thread reads into */
+    HI_U32 u32Tail;                     /* next slot handed out */
+    HI_U32 u32Filled;
+    SAMPLE_VENC_YUV_READER_STAT_S stStat;
+    pthread_t ReadPid;
+    pthread_mutex_t Lock;
+    pthread_cond_t Cond;
+}SAMPLE_VENC_YUV_READER_CTX_S;
+
+static SAMPLE_VENC_YUV_READER_CTX_S gs_astYuvReader[VENC_MAX_CHN_NUM];
+
+static HI_U64 SAMPLE_COMM_VENC_YuvNowUs(HI_VOID)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (HI_U64)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/******************************************************************************
+* funciton : convert a planar 4:2:0 frame as it is in a yuv file (I420 or YV12,
+*            no padding) into a semi-planar frame buffer (NV12 or NV21)
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_YuvConvert(const HI_U8 *pu8Src, SAMPLE_YUV_FMT_E enSrcFmt, HI_U8 *pu8DstY, HI_U8 *pu8DstC,
+                                   HI_U32 u32DstStride, SAMPLE_YUV_FMT_E enDstFmt, HI_U32 u32Width, HI_U32 u32Height)
+{
+    const HI_U8 *pu8SrcU;
+    const HI_U8 *pu8SrcV;
+    const HI_U8 *pu8First;
+    const HI_U8 *pu8Second;
+    HI_U32 u32HalfW = u32Width >> 1;
+    HI_U32 u32Row;
+
+    if ((NULL == pu8Src) || (NULL == pu8DstY) || (NULL == pu8DstC) || (0 == u32Width) || (0 == u32Height)
+        || (u32Width & 1) || (u32Height & 1) || (u32DstStride < u32Width)
+        || ((SAMPLE_YUV_I420 != enSrcFmt) && (SAMPLE_YUV_YV12 != enSrcFmt))
+        || ((SAMPLE_YUV_NV12 != enDstFmt) && (SAMPLE_YUV_NV21 != enDstFmt)))
+    {
+        return HI_FAILURE;
+    }
+
+    pu8SrcU = pu8Src + u32Width * u32Height;
+    pu8SrcV = pu8SrcU + u32HalfW * (u32Height >> 1);
+    if (SAMPLE_YUV_YV12 == enSrcFmt)
+    {
+        pu8SrcV = pu8SrcU;
+        pu8SrcU = pu8SrcV + u32HalfW * (u32Height >> 1);
+    }
+    pu8First = (SAMPLE_YUV_NV12 == enDstFmt) ? pu8SrcU : pu8SrcV;
+    pu8Second = (SAMPLE_YUV_NV12 == enDstFmt) ? pu8SrcV : pu8SrcU;
+
+    if (u32DstStride == u32Width)
+    {
+        memcpy(pu8DstY, pu8Src, u32Width * u32Height);
+    }
+    else
+    {
+        for (u32Row = 0; u32Row < u32Height; u32Row++)
+        {
+            memcpy(pu8DstY + u32Row * u32DstStride, pu8Src + u32Row * u32Width, u32Width);
+        }
+    }
+    for (u32Row = 0; u32Row < (u32Height >> 1); u32Row++)
+    {
+        SAMPLE_COMM_VENC_Interleave(pu8First + u32Row * u32HalfW, pu8Second + u32Row * u32HalfW,
+                                    pu8DstC + u32Row * u32DstStride, u32HalfW);
+    }
+
+    return HI_SUCCESS;
+}
+
+static HI_VOID *SAMPLE_COMM_VENC_YuvReadProc(HI_VOID *p)
+{
+    SAMPLE_VENC_YUV_READER_CTX_S *pstCtx = (SAMPLE_VENC_YUV_READER_CTX_S *)p;
+    HI_BOOL bGotFrame = HI_FALSE;           /* since the file was last started */
+    HI_U64 u64Start;
+    HI_U8 *pu8Slot;
+    size_t Num;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&pstCtx->Lock);
+        while ((HI_TRUE == pstCtx->bStart) && (pstCtx->u32Filled == pstCtx->stAttr.u32Buffers))
+        {
+            pthread_cond_wait(&pstCtx->Cond, &pstCtx->Lock);
+        }
+        if (HI_TRUE != pstCtx->bStart)
+        {
+            pthread_mutex_unlock(&pstCtx->Lock);
+            break;
+        }
+        pu8Slot = pstCtx->pu8Buf + (size_t)pstCtx->u32Head * pstCtx->u32FrameSize;
+        pthread_mutex_unlock(&pstCtx->Lock);
+
+        /* the slot is not handed out until u32Filled counts it */
+        u64Start = SAMPLE_COMM_VENC_YuvNowUs();
+        Num = fread(pu8Slot, pstCtx->u32FrameSize, 1, pstCtx->pFile);
+        if ((1 != Num) && (HI_TRUE == pstCtx->stAttr.bLoop) && (HI_TRUE == bGotFrame))
+        {
+            rewind(pstCtx->pFile);
+            bGotFrame = HI_FALSE;
+            pthread_mutex_lock(&pstCtx->Lock);
+            pstCtx->stStat.u32Loops++;
+            pthread_mutex_unlock(&pstCtx->Lock);
+            continue;
+        }
+
+        pthread_mutex_lock(&pstCtx->Lock);
+        pstCtx->stStat.u64ReadUs += SAMPLE_COMM_VENC_YuvNowUs() - u64Start;
+        if (1 != Num)
+        {
+            pstCtx->bEof = HI_TRUE;
+            pthread_cond_broadcast(&pstCtx->Cond);
+            pthread_mutex_unlock(&pstCtx->Lock);
+            break;
+        }
+        bGotFrame = HI_TRUE;
+        pstCtx->u32Head = (pstCtx->u32Head + 1) % pstCtx->stAttr.u32Buffers;
+        pstCtx->u32Filled++;
+        pthread_cond_broadcast(&pstCtx->Cond);
+        pthread_mutex_unlock(&pstCtx->Lock);
+    }
+
+    return NULL;
+}
+
+/******************************************************************************
+* funciton : open a raw yuv file for a channel and start reading it ahead
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_YuvReaderStart(VENC_CHN VencChn, const SAMPLE_VENC_YUV_READER_ATTR_S *pstAttr)
+{
+    SAMPLE_VENC_YUV_READER_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstAttr)
+        || (0 == pstAttr->u32Width) || (0 == pstAttr->u32Height) || (pstAttr->u32Width & 1) || (pstAttr->u32Height & 1)
+        || (pstAttr->u32Buffers < 2)
+        || ((SAMPLE_YUV_I420 != pstAttr->enSrcFmt) && (SAMPLE_YUV_YV12 != pstAttr->enSrcFmt))
+        || ((SAMPLE_YUV_NV12 != pstAttr->enDstFmt) && (SAMPLE_YUV_NV21 != pstAttr->enDstFmt)))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astYuvReader[VencChn];
+    if (HI_TRUE == pstCtx->bStart)
+    {
+        SAMPLE_PRT("yuv reader of chn[%d] is started already\n", VencChn);
+        return HI_FAILURE;
+    }
+
+    memset(pstCtx, 0, sizeof(SAMPLE_VENC_YUV_READER_CTX_S));
+    memcpy(&pstCtx->stAttr, pstAttr, sizeof(SAMPLE_VENC_YUV_READER_ATTR_S));
+    pstCtx->stAttr.acFile[FILE_NAME_LEN - 1] = '\0';
+    pstCtx->u32FrameSize = pstAttr->u32Width * pstAttr->u32Height * 3 / 2;
+    pstCtx->pFile = fopen(pstCtx->stAttr.acFile, "rb");
+    if (NULL == pstCtx->pFile)
+    {
+        SAMPLE_PRT("open file[%s] failed!\n", pstCtx->stAttr.acFile);
+        return HI_FAILURE;
+    }
+    pstCtx->pu8Buf = (HI_U8 *)malloc((size_t)pstAttr->u32Buffers * pstCtx->u32FrameSize);
+    if (NULL == pstCtx->pu8Buf)
+    {
+        SAMPLE_PRT("malloc yuv buffer failed!\n");
+        fclose(pstCtx->pFile);
+        return HI_FAILURE;
+    }
+    pthread_mutex_init(&pstCtx->Lock, NULL);
+    pthread_cond_init(&pstCtx->Cond, NULL);
+    pstCtx->bStart = HI_TRUE;
+    if (0 != pthread_create(&pstCtx->ReadPid, NULL, SAMPLE_COMM_VENC_YuvReadProc, pstCtx))
+    {
+        SAMPLE_PRT("create yuv read thread failed!\n");
+        pstCtx->bStart = HI_FALSE;
+        pthread_cond_destroy(&pstCtx->Cond);
+        pthread_mutex_destroy(&pstCtx->Lock);
+        free(pstCtx->pu8Buf);
+        fclose(pstCtx->pFile);
+        return HI_FAILURE;
+    }
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : fill the next file frame into a semi-planar frame buffer,
+*            pVirAddr[0] / pVirAddr[1] with u32Stride[0] for both planes as
+*            SAMPLE_COMM_VI_GetVFrameFromYUV lays them out. Blocks until the
+*            reader has it, HI_FAILURE at the end of the file. One caller per channel
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_YuvReaderGet(VENC_CHN VencChn, VIDEO_FRAME_S *pstFrame)
+{
+    SAMPLE_VENC_YUV_READER_CTX_S *pstCtx;
+    const HI_U8 *pu8Slot;
+    HI_U64 u64Start;
+    HI_U64 u64Wait;
+    HI_S32 s32Ret;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstFrame)
+        || (HI_TRUE != gs_astYuvReader[VencChn].bStart))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astYuvReader[VencChn];
+
+    u64Start = SAMPLE_COMM_VENC_YuvNowUs();
+    pthread_mutex_lock(&pstCtx->Lock);
+    while ((0 == pstCtx->u32Filled) && (HI_TRUE != pstCtx->bEof))
+    {
+        pthread_cond_wait(&pstCtx->Cond, &pstCtx->Lock);
+    }
+    if (0 == pstCtx->u32Filled)
+    {
+        pthread_mutex_unlock(&pstCtx->Lock);
+        return HI_FAILURE;
+    }
+    pu8Slot = pstCtx->pu8Buf + (size_t)pstCtx->u32Tail * pstCtx->u32FrameSize;
+    pthread_mutex_unlock(&pstCtx->Lock);
+    u64Wait = SAMPLE_COMM_VENC_YuvNowUs() - u64Start;
+
+    u64Start = SAMPLE_COMM_VENC_YuvNowUs();
+    s32Ret = SAMPLE_COMM_VENC_YuvConvert(pu8Slot, pstCtx->stAttr.enSrcFmt,
+                                         (HI_U8 *)pstFrame->pVirAddr[0], (HI_U8 *)pstFrame->pVirAddr[1],
+                                         pstFrame->u32Stride[0], pstCtx->stAttr.enDstFmt,
+                                         pstCtx->stAttr.u32Width, pstCtx->stAttr.u32Height);
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->stStat.u64WaitUs += u64Wait;
+    pstCtx->stStat.u64ConvertUs += SAMPLE_COMM_VENC_YuvNowUs() - u64Start;
+    pstCtx->u32Tail = (pstCtx->u32Tail + 1) % pstCtx->stAttr.u32Buffers;
+    pstCtx->u32Filled--;
+    if (HI_SUCCESS == s32Ret)
+    {
+        pstCtx->stStat.u64Frames++;
+    }
+    pthread_cond_broadcast(&pstCtx->Cond);
+    pthread_mutex_unlock(&pstCtx->Lock);
+
+    if (HI_SUCCESS != s32Ret)
+    {
+        SAMPLE_PRT("frame of chn[%d] does not fit %ux%u!\n", VencChn, pstCtx->stAttr.u32Width, pstCtx->stAttr.u32Height);
+    }
+    return s32Ret;
+}
+
+HI_S32 SAMPLE_COMM_VENC_YuvReaderGetStat(VENC_CHN VencChn, SAMPLE_VENC_YUV_READER_STAT_S *pstStat)
+{
+    SAMPLE_VENC_YUV_READER_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (NULL == pstStat)
+        || (HI_TRUE != gs_astYuvReader[VencChn].bStart))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astYuvReader[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    memcpy(pstStat, &pstCtx->stStat, sizeof(SAMPLE_VENC_YUV_READER_STAT_S));
+    pthread_mutex_unlock(&pstCtx->Lock);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop the reader thread of a channel and close its file
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VENC_YuvReaderStop(VENC_CHN VencChn)
+{
+    SAMPLE_VENC_YUV_READER_CTX_S *pstCtx;
+
+    if ((VencChn < 0) || (VencChn >= VENC_MAX_CHN_NUM) || (HI_TRUE != gs_astYuvReader[VencChn].bStart))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astYuvReader[VencChn];
+
+    pthread_mutex_lock(&pstCtx->Lock);
+    pstCtx->bStart = HI_FALSE;
+    pthread_cond_broadcast(&pstCtx->Cond);
+    pthread_mutex_unlock(&pstCtx->Lock);
+    pthread_join(pstCtx->ReadPid, NULL);
+
+    fclose(pstCtx->pFile);
+    free(pstCtx->pu8Buf);
+    pstCtx->pFile = NULL;
+    pstCtx->pu8Buf = NULL;
+    pthread_cond_destroy(&pstCtx->Cond);
+    pthread_mutex_destroy(&pstCtx->Lock);
+
+    return HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
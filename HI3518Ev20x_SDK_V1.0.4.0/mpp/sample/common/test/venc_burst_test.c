@@ -0,0 +1,316 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_burst_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/25
+  Description   : burst jpeg snapshots from the venc stub at the vi rate:
+                  frames and thumbnails in memory, burst latency and frame
+                  interval, stale and oversize frames, time out, and the
+                  cost of the saved file thumbnail scan against the in
+                  memory one
+  History       :
+  1.Date        : 2016/04/25
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define TEST_FPS            30
+#define TEST_JPEG_LEN       (200 * 1024)
+#define TEST_BURST          10
+#define TEST_TIMEOUT_MS     300
+#define TEST_SCAN_LOOPS     20
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FUNCTION__, __LINE__, #cond); \
+            return HI_FAILURE; \
+        } \
+    } while (0)
+
+/* in sample_comm_venc.c, not in sample_comm.h */
+extern HI_S32 SAMPLE_COMM_VENC_Getdcfinfo(char* SrcJpgPath, char* DstThmPath);
+
+static volatile HI_BOOL s_bVi = HI_FALSE;
+static HI_U8 s_au8Ref[TEST_JPEG_LEN + 64];
+static HI_U32 s_u32RefLen;
+
+/* vi pictures reach the jpeg channel at TEST_FPS */
+static HI_VOID *TEST_ViProc(HI_VOID *p)
+{
+    while (HI_TRUE == s_bVi)
+    {
+        (HI_VOID)VENC_STUB_Picture(0);
+        usleep(1000000 / TEST_FPS);
+    }
+    return NULL;
+}
+
+static HI_U64 TEST_NowUs(HI_VOID)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (HI_U64)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/* one frame straight from the stub, the burst frames must match it */
+static HI_S32 TEST_Reference(HI_VOID)
+{
+    VENC_PACK_S astPack[4];
+    VENC_STREAM_S stStream;
+    HI_U32 i;
+
+    VENC_STUB_Post(0, 1);
+    memset(&stStream, 0, sizeof(stStream));
+    stStream.pstPack = astPack;
+    stStream.u32PackCount = 4;
+    TEST_CHECK(HI_SUCCESS == HI_MPI_VENC_GetStream(0, &stStream, 0));
+    s_u32RefLen = 0;
+    for (i = 0; i < stStream.u32PackCount; i++)
+    {
+        TEST_CHECK(s_u32RefLen + astPack[i].u32Len - astPack[i].u32Offset <= sizeof(s_au8Ref));
+        memcpy(s_au8Ref + s_u32RefLen, astPack[i].pu8Addr + astPack[i].u32Offset, astPack[i].u32Len - astPack[i].u32Offset);
+        s_u32RefLen += astPack[i].u32Len - astPack[i].u32Offset;
+    }
+    TEST_CHECK(HI_SUCCESS == HI_MPI_VENC_ReleaseStream(0, &stStream));
+    /* the channel was receiving every picture, now it waits for a burst */
+    TEST_CHECK(HI_SUCCESS == HI_MPI_VENC_StopRecvPic(0));
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_CheckBurst(const SAMPLE_VENC_BURST_S *pstBurst, HI_U32 u32Frames)
+{
+    const SAMPLE_VENC_BURST_FRAME_S *pstFrame;
+    HI_U32 u32Interval = 1000000 / TEST_FPS;
+    HI_U32 i;
+
+    TEST_CHECK(u32Frames == pstBurst->u32Frames);
+    for (i = 0; i < pstBurst->u32Frames; i++)
+    {
+        pstFrame = &pstBurst->pstFrame[i];
+        TEST_CHECK(s_u32RefLen == pstFrame->u32JpegLen);
+        TEST_CHECK(0 == memcmp(s_au8Ref, pstFrame->pu8Jpeg, s_u32RefLen));
+        TEST_CHECK(pstFrame->pu8Jpeg + VENC_STUB_THUMB_OFF == pstFrame->pu8Thumb);
+        TEST_CHECK(VENC_STUB_THUMB_LEN == pstFrame->u32ThumbLen);
+        TEST_CHECK((0xFF == pstFrame->pu8Thumb[0]) && (0xD8 == pstFrame->pu8Thumb[1]));
+        TEST_CHECK((0xFF == pstFrame->pu8Thumb[VENC_STUB_THUMB_LEN - 2]) && (0xD9 == pstFrame->pu8Thumb[VENC_STUB_THUMB_LEN - 1]));
+        if (i > 0)
+        {
+            TEST_CHECK(pstFrame->u64Pts > pstBurst->pstFrame[i - 1].u64Pts);
+            TEST_CHECK(pstFrame->u32ReadyUs >= pstBurst->pstFrame[i - 1].u32ReadyUs);
+        }
+    }
+    /* the vi rate, not some slower select / save / reopen cycle */
+    TEST_CHECK(pstBurst->u32IntervalUsAvg > u32Interval * 8 / 10);
+    TEST_CHECK(pstBurst->u32IntervalUsAvg < u32Interval * 15 / 10);
+    TEST_CHECK(pstBurst->u32FirstUs < 2 * u32Interval);
+    TEST_CHECK(pstBurst->u32TotalUs < (u32Frames + 1) * u32Interval * 15 / 10);
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Burst(HI_VOID)
+{
+    SAMPLE_VENC_BURST_ATTR_S stAttr;
+    SAMPLE_VENC_BURST_S stBurst;
+    const HI_U8 *pu8First;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.u32MaxFrames = 16;
+    stAttr.u32FrameSize = TEST_JPEG_LEN + 4096;
+    stAttr.u32TimeoutMs = TEST_TIMEOUT_MS;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstCreate(0, &stAttr));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_BurstCreate(0, &stAttr));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_BurstCapture(0, 17, &stBurst));
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstCapture(0, TEST_BURST, &stBurst));
+    TEST_CHECK(HI_SUCCESS == TEST_CheckBurst(&stBurst, TEST_BURST));
+    TEST_CHECK((0 == stBurst.u32Dropped) && (0 == stBurst.u32Stale));
+    printf("burst %u: first %u us, total %u us, interval avg %u us max %u us\n", stBurst.u32Frames,
+           stBurst.u32FirstUs, stBurst.u32TotalUs, stBurst.u32IntervalUsAvg, stBurst.u32IntervalUsMax);
+
+    /* disarmed after N pictures */
+    usleep(4 * 1000000 / TEST_FPS);
+    TEST_CHECK(0 == VENC_STUB_Pending(0));
+
+    /* again, same memory; frames posted in between are stale */
+    pu8First = stBurst.pstFrame[0].pu8Jpeg;
+    VENC_STUB_Post(0, 2);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstCapture(0, 4, &stBurst));
+    TEST_CHECK(HI_SUCCESS == TEST_CheckBurst(&stBurst, 4));
+    TEST_CHECK(2 == stBurst.u32Stale);
+    TEST_CHECK(pu8First == stBurst.pstFrame[0].pu8Jpeg);
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstDestroy(0));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_BurstDestroy(0));
+    printf("burst: ok\n");
+    return HI_SUCCESS;
+}
+
+/* frames over u32FrameSize are dropped, they still count against the burst */
+static HI_S32 TEST_Oversize(HI_VOID)
+{
+    SAMPLE_VENC_BURST_ATTR_S stAttr;
+    SAMPLE_VENC_BURST_S stBurst;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.u32MaxFrames = 4;
+    stAttr.u32FrameSize = TEST_JPEG_LEN / 2;
+    stAttr.u32TimeoutMs = TEST_TIMEOUT_MS;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstCreate(0, &stAttr));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_BurstCapture(0, 3, &stBurst));
+    TEST_CHECK((0 == stBurst.u32Frames) && (3 == stBurst.u32Dropped));
+    usleep(2 * 1000000 / TEST_FPS);
+    TEST_CHECK(0 == VENC_STUB_Pending(0));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstDestroy(0));
+    printf("oversize: ok\n");
+    return HI_SUCCESS;
+}
+
+/* no vi: the burst gives up after u32TimeoutMs and disarms the channel */
+static HI_S32 TEST_Timeout(HI_VOID)
+{
+    SAMPLE_VENC_BURST_ATTR_S stAttr;
+    SAMPLE_VENC_BURST_S stBurst;
+    HI_U64 u64Start;
+    HI_U64 u64Us;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.u32MaxFrames = 4;
+    stAttr.u32FrameSize = TEST_JPEG_LEN + 4096;
+    stAttr.u32TimeoutMs = TEST_TIMEOUT_MS;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstCreate(0, &stAttr));
+    u64Start = TEST_NowUs();
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_BurstCapture(0, 2, &stBurst));
+    u64Us = TEST_NowUs() - u64Start;
+    TEST_CHECK(0 == stBurst.u32Frames);
+    TEST_CHECK((u64Us >= TEST_TIMEOUT_MS * 900) && (u64Us < TEST_TIMEOUT_MS * 2000));
+    TEST_CHECK(HI_FALSE == VENC_STUB_Picture(0));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_BurstDestroy(0));
+    printf("timeout: ok\n");
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_FindThumb(HI_VOID)
+{
+    /* APP0 without a thumbnail, APP1 with a bare SOI and then a real one with a stuffed scan */
+    HI_U8 au8Jpeg[] = {
+        0xFF, 0xD8,
+        0xFF, 0xE0, 0x00, 0x06, 'J', 'F', 'I', 'F',
+        0xFF, 0xE1, 0x00, 0x1A, 0xFF, 0xD8, 0xFF, 0x00,
+            0xFF, 0xD8, 0xFF, 0xDB, 0x00, 0x04, 0xFF, 0xD9,
+            0xFF, 0xDA, 0x00, 0x02, 0x12, 0xFF, 0x00, 0xFF, 0xD0, 0x34, 0xFF, 0xD9,
+        0xFF, 0xDA, 0x00, 0x02, 0x56, 0xFF, 0xD9};
+    HI_U32 u32Off;
+    HI_U32 u32Len;
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_FindThumb(au8Jpeg, sizeof(au8Jpeg), &u32Off, &u32Len));
+    TEST_CHECK((18 == u32Off) && (20 == u32Len));
+
+    /* thumbnail cut by its segment */
+    au8Jpeg[13] = 0x18;
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_FindThumb(au8Jpeg, sizeof(au8Jpeg), &u32Off, &u32Len));
+    au8Jpeg[13] = 0x1A;
+    /* a segment running past the buffer */
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_FindThumb(au8Jpeg, 30, &u32Off, &u32Len));
+    /* no SOI */
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_FindThumb(au8Jpeg + 2, sizeof(au8Jpeg) - 2, &u32Off, &u32Len));
+    /* only APP segments carry one */
+    au8Jpeg[11] = 0xDB;
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_FindThumb(au8Jpeg, sizeof(au8Jpeg), &u32Off, &u32Len));
+
+    printf("find thumb: ok\n");
+    return HI_SUCCESS;
+}
+
+/* the saved file path of SAMPLE_COMM_VENC_SnapProcess against the scan in memory */
+static HI_S32 TEST_ScanCost(const HI_CHAR *pszDir)
+{
+    HI_CHAR acJpg[FILE_NAME_LEN];
+    HI_CHAR acThm[FILE_NAME_LEN];
+    FILE *pFile;
+    HI_U64 u64Start;
+    HI_U64 u64FileUs;
+    HI_U64 u64MemUs;
+    HI_U32 u32Off = 0;
+    HI_U32 u32Len = 0;
+    HI_U32 i;
+
+    snprintf(acJpg, sizeof(acJpg), "%s/burst_test.jpg", pszDir);
+    snprintf(acThm, sizeof(acThm), "%s/burst_test.thm", pszDir);
+    u64Start = TEST_NowUs();
+    for (i = 0; i < TEST_SCAN_LOOPS; i++)
+    {
+        pFile = fopen(acJpg, "wb");
+        TEST_CHECK(NULL != pFile);
+        TEST_CHECK(1 == fwrite(s_au8Ref, s_u32RefLen, 1, pFile));
+        fclose(pFile);
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_Getdcfinfo(acJpg, acThm));
+    }
+    u64FileUs = TEST_NowUs() - u64Start;
+    remove(acJpg);
+    remove(acThm);
+
+    u64Start = TEST_NowUs();
+    for (i = 0; i < TEST_SCAN_LOOPS; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_FindThumb(s_au8Ref, s_u32RefLen, &u32Off, &u32Len));
+    }
+    u64MemUs = TEST_NowUs() - u64Start;
+    TEST_CHECK((VENC_STUB_THUMB_OFF == u32Off) && (VENC_STUB_THUMB_LEN == u32Len));
+
+    printf("thumbnail of a %u byte jpeg: save + file scan %llu us, memory scan %llu us\n", s_u32RefLen,
+           (unsigned long long)(u64FileUs / TEST_SCAN_LOOPS), (unsigned long long)(u64MemUs / TEST_SCAN_LOOPS));
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    VENC_STUB_CFG_S stCfg;
+    pthread_t ViPid;
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    memset(&stCfg, 0, sizeof(stCfg));
+    stCfg.enType = PT_JPEG;
+    stCfg.u32Gop = 1;
+    stCfg.u32IFrameLen = TEST_JPEG_LEN;
+    stCfg.u32SlicePacks = 2;
+    stCfg.u32FrameRate = TEST_FPS;
+    if ((HI_SUCCESS != VENC_STUB_Init(1, &stCfg)) || (HI_SUCCESS != TEST_Reference()))
+    {
+        printf("FAIL\n");
+        return 1;
+    }
+    VENC_STUB_SetClockPts(HI_TRUE);
+
+    s32Ret |= TEST_FindThumb();
+    s32Ret |= TEST_ScanCost((argc > 1) ? argv[1] : "/tmp");
+    s_bVi = HI_TRUE;
+    pthread_create(&ViPid, NULL, TEST_ViProc, NULL);
+    s32Ret |= TEST_Burst();
+    s32Ret |= TEST_Oversize();
+    s_bVi = HI_FALSE;
+    pthread_join(ViPid, NULL);
+    s32Ret |= TEST_Timeout();
+
+    VENC_STUB_Exit();
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
@@ -0,0 +1,470 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_mp4_bench.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/05
+  Description   : muxes the canned h264 and h265 streams of the venc stub with
+                  g711a or aac frames into fragmented mp4 files of the given
+                  directory, reports the muxing cost per frame and walks the
+                  boxes of each file back to check them. An aac rate
+                  without a sampling frequency index is refused at open
+  History       :
+  1.Date        : 2016/04/05
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define BENCH_FPS       30
+#define BENCH_GOP       30
+#define BENCH_FRAMES    900
+
+#define BENCH_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FUNCTION__, __LINE__, #cond); \
+            return HI_FAILURE; \
+        } \
+    } while (0)
+
+typedef struct hiBENCH_CASE_S
+{
+    const HI_CHAR *pszName;
+    PAYLOAD_TYPE_E enType;
+    PAYLOAD_TYPE_E enAudioType;
+    HI_U32 u32MaxFrames;            /* trun entries per fragment, below the gop cuts fragments */
+}BENCH_CASE_S;
+
+static const BENCH_CASE_S s_astCase[] =
+{
+    {"h264",            PT_H264, PT_BUTT,  64},
+    {"h264 g711a",      PT_H264, PT_G711A, 64},
+    {"h265 aac",        PT_H265, PT_AAC,   64},
+    {"h264 aac cut",    PT_H264, PT_AAC,   12},
+};
+
+static HI_U64 BENCH_NowNs(HI_VOID)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return (HI_U64)stNow.tv_sec * 1000000000 + stNow.tv_nsec;
+}
+
+static HI_U32 BENCH_Get32(const HI_U8 *p)
+{
+    return ((HI_U32)p[0] << 24) | ((HI_U32)p[1] << 16) | ((HI_U32)p[2] << 8) | p[3];
+}
+
+static HI_U64 BENCH_Get64(const HI_U8 *p)
+{
+    return ((HI_U64)BENCH_Get32(p) << 32) | BENCH_Get32(p + 4);
+}
+
+/* first box of that type inside [pu8Start, pu8End), descending into the given containers */
+static const HI_U8 *BENCH_Find(const HI_U8 *pu8Start, const HI_U8 *pu8End, const HI_CHAR *pszType)
+{
+    static const HI_CHAR *apszContainer[] = {"moov", "trak", "mdia", "minf", "stbl", "mvex"};
+    const HI_U8 *pu8Found;
+    HI_U32 u32Size;
+    HI_U32 i;
+
+    while (pu8Start + 8 <= pu8End)
+    {
+        u32Size = BENCH_Get32(pu8Start);
+        if ((u32Size < 8) || (pu8Start + u32Size > pu8End))
+        {
+            return NULL;
+        }
+        if (0 == memcmp(pu8Start + 4, pszType, 4))
+        {
+            return pu8Start;
+        }
+        for (i = 0; i < sizeof(apszContainer) / sizeof(apszContainer[0]); i++)
+        {
+            if (0 == memcmp(pu8Start + 4, apszContainer[i], 4))
+            {
+                pu8Found = BENCH_Find(pu8Start + 8, pu8Start + u32Size, pszType);
+                if (NULL != pu8Found)
+                {
+                    return pu8Found;
+                }
+            }
+        }
+        /* stsd holds one sample entry whose config box follows the fixed fields */
+        if (0 == memcmp(pu8Start + 4, "stsd", 4))
+        {
+            for (i = 16; i + 8 <= u32Size; i++)
+            {
+                if (0 == memcmp(pu8Start + i + 4, pszType, 4))
+                {
+                    return pu8Start + i;
+                }
+            }
+        }
+        pu8Start += u32Size;
+    }
+    return NULL;
+}
+
+/* each sample has to be whole length-prefixed nal units and none of them a parameter set */
+static HI_S32 BENCH_CheckSample(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Sample, HI_U32 u32Size)
+{
+    HI_U32 u32Off = 0;
+    HI_U32 u32NalLen;
+    HI_U32 u32NalType;
+
+    while (u32Off < u32Size)
+    {
+        BENCH_CHECK(u32Off + 5 <= u32Size);
+        u32NalLen = BENCH_Get32(pu8Sample + u32Off);
+        BENCH_CHECK((u32NalLen > 0) && (u32Off + 4 + u32NalLen <= u32Size));
+        u32NalType = (PT_H264 == enType) ? (pu8Sample[u32Off + 4] & 0x1F) : ((pu8Sample[u32Off + 4] >> 1) & 0x3F);
+        BENCH_CHECK((PT_H264 == enType) ? ((7 != u32NalType) && (8 != u32NalType))
+                    : ((u32NalType < 32) || (u32NalType > 34)));
+        u32Off += 4 + u32NalLen;
+    }
+    return HI_SUCCESS;
+}
+
+static HI_S32 BENCH_CheckFile(const BENCH_CASE_S *pstCase, const HI_CHAR *pszFile,
+                              const SAMPLE_VENC_MP4_STAT_S *pstStat)
+{
+    const HI_U8 *pu8Box;
+    const HI_U8 *pu8Moof;
+    const HI_U8 *pu8Mdat;
+    const HI_U8 *pu8Traf;
+    const HI_U8 *pu8Trun;
+    const HI_U8 *pu8Entry;
+    const HI_U8 *pu8Data;
+    HI_U8 *pu8File;
+    HI_U64 au64NextDts[3] = {0, 0, 0};
+    HI_U32 au32Samples[3] = {0, 0, 0};
+    HI_U32 u32Seq = 0;
+    HI_U32 u32Size;
+    HI_U32 u32Track;
+    HI_U32 u32Cnt;
+    HI_U32 u32EntrySize;
+    HI_U32 u32DataEnd;
+    HI_U32 i;
+    struct stat stSt;
+    FILE *pFile;
+
+    BENCH_CHECK(0 == stat(pszFile, &stSt));
+    BENCH_CHECK((HI_U64)stSt.st_size == pstStat->u64Bytes);
+    pu8File = (HI_U8 *)malloc(stSt.st_size);
+    pFile = fopen(pszFile, "rb");
+    BENCH_CHECK((NULL != pu8File) && (NULL != pFile));
+    BENCH_CHECK(1 == fread(pu8File, stSt.st_size, 1, pFile));
+    fclose(pFile);
+
+    pu8Box = pu8File;
+    BENCH_CHECK(0 == memcmp(pu8Box + 4, "ftyp", 4));
+    pu8Box += BENCH_Get32(pu8Box);
+    BENCH_CHECK(0 == memcmp(pu8Box + 4, "moov", 4));
+    BENCH_CHECK(NULL != BENCH_Find(pu8Box, pu8Box + BENCH_Get32(pu8Box),
+                                   (PT_H264 == pstCase->enType) ? "avcC" : "hvcC"));
+    if (PT_AAC == pstCase->enAudioType)
+    {
+        BENCH_CHECK(NULL != BENCH_Find(pu8Box, pu8Box + BENCH_Get32(pu8Box), "esds"));
+    }
+    else if (PT_G711A == pstCase->enAudioType)
+    {
+        BENCH_CHECK(NULL != BENCH_Find(pu8Box, pu8Box + BENCH_Get32(pu8Box), "alaw"));
+    }
+    pu8Box += BENCH_Get32(pu8Box);
+
+    /* moof + mdat pairs to the end, decode times of each track continuing across them */
+    while (pu8Box < pu8File + stSt.st_size)
+    {
+        pu8Moof = pu8Box;
+        BENCH_CHECK(0 == memcmp(pu8Moof + 4, "moof", 4));
+        pu8Mdat = pu8Moof + BENCH_Get32(pu8Moof);
+        BENCH_CHECK(0 == memcmp(pu8Mdat + 4, "mdat", 4));
+        BENCH_CHECK(0 == memcmp(pu8Moof + 12, "mfhd", 4));
+        BENCH_CHECK(BENCH_Get32(pu8Moof + 20) == ++u32Seq);
+        u32DataEnd = 8;
+
+        for (pu8Traf = pu8Moof + 24; pu8Traf < pu8Mdat; pu8Traf += BENCH_Get32(pu8Traf))
+        {
+            BENCH_CHECK(0 == memcmp(pu8Traf + 4, "traf", 4));
+            BENCH_CHECK((0 == memcmp(pu8Traf + 12, "tfhd", 4)) && (0x020000 == BENCH_Get32(pu8Traf + 16)));
+            u32Track = BENCH_Get32(pu8Traf + 20);
+            BENCH_CHECK((1 == u32Track) || ((2 == u32Track) && (PT_BUTT != pstCase->enAudioType)));
+            BENCH_CHECK(0 == memcmp(pu8Traf + 28, "tfdt", 4));
+            /* audio starts with the first frame after the first key frame, at its own time */
+            if ((2 == u32Track) && (0 == au32Samples[2]))
+            {
+                au64NextDts[2] = BENCH_Get64(pu8Traf + 36);
+            }
+            BENCH_CHECK(BENCH_Get64(pu8Traf + 36) == au64NextDts[u32Track]);
+            pu8Trun = pu8Traf + 44;
+            BENCH_CHECK(0 == memcmp(pu8Trun + 4, "trun", 4));
+            u32Cnt = BENCH_Get32(pu8Trun + 12);
+            u32EntrySize = (1 == u32Track) ? 12 : 8;
+            BENCH_CHECK(BENCH_Get32(pu8Trun) == 20 + u32EntrySize * u32Cnt);
+            BENCH_CHECK(BENCH_Get32(pu8Trun + 16) == (HI_U32)(pu8Mdat - pu8Moof) + u32DataEnd);
+
+            pu8Data = pu8Mdat + u32DataEnd;
+            for (i = 0, pu8Entry = pu8Trun + 20; i < u32Cnt; i++, pu8Entry += u32EntrySize)
+            {
+                BENCH_CHECK(BENCH_Get32(pu8Entry) > 0);
+                u32Size = BENCH_Get32(pu8Entry + 4);
+                BENCH_CHECK(pu8Data + u32Size <= pu8Mdat + BENCH_Get32(pu8Mdat));
+                if (1 == u32Track)
+                {
+                    /* only the first sample of a fragment may be a key frame, cut fragments start on p frames */
+                    BENCH_CHECK((0 == i) || (0x01010000 == BENCH_Get32(pu8Entry + 8)));
+                    BENCH_CHECK(HI_SUCCESS == BENCH_CheckSample(pstCase->enType, pu8Data, u32Size));
+                }
+                au64NextDts[u32Track] += BENCH_Get32(pu8Entry);
+                au32Samples[u32Track]++;
+                pu8Data += u32Size;
+            }
+            u32DataEnd = pu8Data - pu8Mdat;
+        }
+        BENCH_CHECK(u32DataEnd == BENCH_Get32(pu8Mdat));
+        pu8Box = pu8Mdat + BENCH_Get32(pu8Mdat);
+    }
+
+    BENCH_CHECK(u32Seq == pstStat->u32Fragments);
+    BENCH_CHECK(au32Samples[1] == pstStat->u32VideoFrames);
+    BENCH_CHECK(au32Samples[2] == pstStat->u32AudioFrames);
+    /* the video track runs for the frames fed, 90k ticks per second */
+    BENCH_CHECK(au64NextDts[1] == (HI_U64)BENCH_FRAMES * 90000 / BENCH_FPS);
+    free(pu8File);
+
+    return HI_SUCCESS;
+}
+
+/* g711a of 40 ms behind the hisilicon voice frame header, or an adts aac frame */
+static HI_U32 BENCH_MakeAudio(PAYLOAD_TYPE_E enAudioType, HI_U8 *pu8Buf, HI_U32 u32Seq)
+{
+    HI_U32 u32Len;
+
+    if (PT_G711A == enAudioType)
+    {
+        pu8Buf[0] = 0;
+        pu8Buf[1] = 1;
+        pu8Buf[2] = 160;
+        pu8Buf[3] = 0;
+        memset(pu8Buf + 4, 0xD5 ^ (u32Seq & 0x0F), 320);
+        return 324;
+    }
+
+    u32Len = 7 + 180 + (u32Seq % 40);
+    pu8Buf[0] = 0xFF;
+    pu8Buf[1] = 0xF1;
+    pu8Buf[2] = (1 << 6) | (11 << 2);       /* lc, 8000 Hz */
+    pu8Buf[3] = (1 << 6) | (u32Len >> 11);  /* 1 channel */
+    pu8Buf[4] = (HI_U8)(u32Len >> 3);
+    pu8Buf[5] = (HI_U8)((u32Len << 5) | 0x1F);
+    pu8Buf[6] = 0xFC;
+    memset(pu8Buf + 7, 0x21 + (u32Seq & 0x0F), u32Len - 7);
+    return u32Len;
+}
+
+static HI_S32 BENCH_Run(const BENCH_CASE_S *pstCase, const HI_CHAR *pszDir)
+{
+    VENC_STUB_CFG_S stCfg;
+    SAMPLE_VENC_MP4_ATTR_S stAttr;
+    SAMPLE_VENC_MP4_STAT_S stStat;
+    VENC_PACK_S astPack[16];
+    VENC_STREAM_S stStream;
+    AUDIO_STREAM_S stAudio;
+    HI_U8 au8Audio[512];
+    HI_CHAR szFile[256];
+    HI_U64 u64VideoNs = 0;
+    HI_U64 u64AudioNs = 0;
+    HI_U64 u64StreamBytes = 0;
+    HI_U64 u64AudioUs;
+    HI_U64 u64Start;
+    HI_U32 u32AudioSeq = 0;
+    HI_U32 u32Frame;
+    HI_U32 i;
+    HI_S32 s32Fd;
+    HI_S32 s32Ret;
+
+    memset(&stCfg, 0, sizeof(stCfg));
+    stCfg.enType = pstCase->enType;
+    stCfg.u32Gop = BENCH_GOP;
+    stCfg.u32IFrameLen = 96 * 1024;
+    stCfg.u32PFrameLen = 12 * 1024;
+    stCfg.u32SlicePacks = 2;
+    stCfg.u32FrameRate = BENCH_FPS;
+    if (HI_SUCCESS != VENC_STUB_Init(1, &stCfg))
+    {
+        printf("venc stub init failed\n");
+        return HI_FAILURE;
+    }
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.enType = pstCase->enType;
+    stAttr.u32Width = 1920;
+    stAttr.u32Height = 1080;
+    stAttr.u32FragBufSize = 2 * 1024 * 1024;
+    stAttr.u32MaxFrames = pstCase->u32MaxFrames;
+    stAttr.enAudioType = pstCase->enAudioType;
+    stAttr.u32SampleRate = 8000;
+    stAttr.u32AudioChn = 1;
+    stAttr.u32AudioBufSize = 64 * 1024;
+    stAttr.u32MaxAudioFrames = 128;
+
+    snprintf(szFile, sizeof(szFile), "%s/venc_mp4_bench_%u.mp4", pszDir, (HI_U32)(pstCase - s_astCase));
+    s32Fd = open(szFile, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if ((s32Fd < 0) || (HI_SUCCESS != SAMPLE_COMM_VENC_Mp4Open(0, s32Fd, &stAttr)))
+    {
+        printf("open %s failed\n", szFile);
+        VENC_STUB_Exit();
+        return HI_FAILURE;
+    }
+
+    VENC_STUB_Post(0, BENCH_FRAMES);
+    for (u32Frame = 0; u32Frame < BENCH_FRAMES; u32Frame++)
+    {
+        memset(&stStream, 0, sizeof(stStream));
+        stStream.pstPack = astPack;
+        stStream.u32PackCount = 16;
+        if (HI_SUCCESS != HI_MPI_VENC_GetStream(0, &stStream, 0))
+        {
+            printf("get stream failed\n");
+            break;
+        }
+        for (i = 0; i < stStream.u32PackCount; i++)
+        {
+            u64StreamBytes += astPack[i].u32Len - astPack[i].u32Offset;
+        }
+
+        /* the aenc frames due by this video frame, as the audio thread would hand them over */
+        while (1)
+        {
+            u64AudioUs = (PT_AAC == pstCase->enAudioType) ? (HI_U64)u32AudioSeq * 1024 * 1000000 / 8000
+                         : (HI_U64)u32AudioSeq * 40000;
+            if ((PT_BUTT == pstCase->enAudioType) || (u64AudioUs > astPack[0].u64PTS))
+            {
+                break;
+            }
+            memset(&stAudio, 0, sizeof(stAudio));
+            stAudio.pStream = au8Audio;
+            stAudio.u32Len = BENCH_MakeAudio(pstCase->enAudioType, au8Audio, u32AudioSeq);
+            stAudio.u64TimeStamp = u64AudioUs;
+            stAudio.u32Seq = u32AudioSeq++;
+            u64Start = BENCH_NowNs();
+            SAMPLE_COMM_VENC_Mp4Audio(0, &stAudio);
+            u64AudioNs += BENCH_NowNs() - u64Start;
+        }
+
+        u64Start = BENCH_NowNs();
+        s32Ret = SAMPLE_COMM_VENC_Mp4Stream(0, &stStream, NULL);
+        u64VideoNs += BENCH_NowNs() - u64Start;
+        HI_MPI_VENC_ReleaseStream(0, &stStream);
+        if (HI_SUCCESS != s32Ret)
+        {
+            printf("mp4 stream failed\n");
+            break;
+        }
+    }
+
+    SAMPLE_COMM_VENC_Mp4Close(0);
+    close(s32Fd);
+    VENC_STUB_Exit();
+    SAMPLE_COMM_VENC_Mp4GetStat(0, &stStat);
+
+    printf("%-14s %4u frames %4u audio %3u frags (%2u cut) %6.2f MB in %6.2f MB out  %6.0f ns/frame %5.0f ns/audio"
+           "  %5.1f ns/KB\n",
+           pstCase->pszName, stStat.u32VideoFrames, stStat.u32AudioFrames, stStat.u32Fragments,
+           stStat.u32CutFragments, u64StreamBytes / 1048576.0, stStat.u64Bytes / 1048576.0,
+           (double)u64VideoNs / BENCH_FRAMES, u32AudioSeq ? (double)u64AudioNs / u32AudioSeq : 0.0,
+           (double)u64VideoNs * 1024 / u64StreamBytes);
+
+    if ((BENCH_FRAMES != stStat.u32VideoFrames) || (0 != stStat.u32DropVideo) || (0 != stStat.u32WriteErrs)
+        || ((PT_BUTT != pstCase->enAudioType) && (u32AudioSeq != stStat.u32AudioFrames + stStat.u32DropAudio)))
+    {
+        printf("%s: frames lost\n", pstCase->pszName);
+        return HI_FAILURE;
+    }
+    s32Ret = BENCH_CheckFile(pstCase, szFile, &stStat);
+    unlink(szFile);
+    return s32Ret;
+}
+
+/* aac needs a rate of the sampling frequency table, 7350 is its last entry */
+static HI_S32 BENCH_AacRate(const HI_CHAR *pszDir)
+{
+    static const HI_U32 s_au32Rate[] = {8000, 7350, 44000, 0};
+    static const HI_S32 s_as32Expect[] = {HI_SUCCESS, HI_SUCCESS, HI_FAILURE, HI_FAILURE};
+    SAMPLE_VENC_MP4_ATTR_S stAttr;
+    HI_CHAR szFile[256];
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_S32 s32Fd;
+    HI_U32 i;
+
+    snprintf(szFile, sizeof(szFile), "%s/venc_mp4_bench_rate.mp4", pszDir);
+    s32Fd = open(szFile, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (s32Fd < 0)
+    {
+        printf("open %s failed\n", szFile);
+        return HI_FAILURE;
+    }
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.enType = PT_H264;
+    stAttr.u32FragBufSize = 64 * 1024;
+    stAttr.u32MaxFrames = 16;
+    stAttr.enAudioType = PT_AAC;
+    stAttr.u32AudioChn = 1;
+    stAttr.u32AudioBufSize = 16 * 1024;
+    stAttr.u32MaxAudioFrames = 16;
+    for (i = 0; i < sizeof(s_au32Rate) / sizeof(s_au32Rate[0]); i++)
+    {
+        stAttr.u32SampleRate = s_au32Rate[i];
+        if (s_as32Expect[i] != SAMPLE_COMM_VENC_Mp4Open(0, s32Fd, &stAttr))
+        {
+            printf("aac at %u Hz: open should %s\n", s_au32Rate[i], (HI_SUCCESS == s_as32Expect[i]) ? "pass" : "fail");
+            s32Ret = HI_FAILURE;
+        }
+        SAMPLE_COMM_VENC_Mp4Close(0);
+    }
+    close(s32Fd);
+    unlink(szFile);
+    return s32Ret;
+}
+
+int main(int argc, char *argv[])
+{
+    const HI_CHAR *pszDir = (argc > 1) ? argv[1] : "/tmp";
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U32 i;
+
+    for (i = 0; i < sizeof(s_astCase) / sizeof(s_astCase[0]); i++)
+    {
+        if (HI_SUCCESS != BENCH_Run(&s_astCase[i], pszDir))
+        {
+            printf("%s: FAILED\n", s_astCase[i].pszName);
+            s32Ret = HI_FAILURE;
+        }
+    }
+    if (HI_SUCCESS != BENCH_AacRate(pszDir))
+    {
+        printf("aac rate: FAILED\n");
+        s32Ret = HI_FAILURE;
+    }
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
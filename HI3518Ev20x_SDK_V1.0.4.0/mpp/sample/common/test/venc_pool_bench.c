@@ -0,0 +1,247 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_pool_bench.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/18
+  Description   : synthetic load on the stream collector: many stub channels
+                  paced at their frame rate, one of them with a save callback
+                  that blocks for long on I frames. Reports the retrieval
+                  latency and venc queue depth of the other channels for a
+                  single thread and for worker pools, and checks that every
+                  channel still gets its frames in order
+  History       :
+  1.Date        : 2016/04/18
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define BENCH_SLOW_CHN      0
+
+typedef struct hiBENCH_RUN_S
+{
+    const HI_CHAR *pszName;
+    HI_S32 s32Workers;
+    HI_S32 s32SlowWorker;           /* worker of the slow channel, -1 any */
+    HI_S32 s32OtherWorker;          /* worker of the other channels, -1 any, -2 round robin */
+}BENCH_RUN_S;
+
+static const BENCH_RUN_S s_astRun[] =
+{
+    {"1 thread",             1, -1, -1},
+    {"pool 2",               2, -1, -1},
+    {"pool 4",               4, -1, -1},
+    {"pool 4 slow pinned",   4,  0, -1},
+    {"pool 4 all pinned",    4, -2, -2},
+};
+
+static HI_S32 s_s32ChnCnt = 16;
+static HI_U32 s_u32Fps = 30;
+static HI_U32 s_u32SlowMs = 120;
+static HI_U32 s_u32SaveUs = 500;
+static volatile HI_BOOL s_bFeed;
+static HI_U32 s_au32NextSeq[VENC_MAX_CHN_NUM];
+static HI_U32 s_au32OrderErrs[VENC_MAX_CHN_NUM];
+
+/* stands in for saving the frame: a short blocking write, a long one on I frames of the slow channel */
+static HI_S32 BENCH_StreamProc(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    if (pstStream->u32Seq != s_au32NextSeq[VencChn])
+    {
+        s_au32OrderErrs[VencChn]++;
+    }
+    s_au32NextSeq[VencChn] = pstStream->u32Seq + 1;
+
+    if ((BENCH_SLOW_CHN == VencChn) && (BASE_IDRSLICE == pstStream->stH264Info.enRefType))
+    {
+        usleep(s_u32SlowMs * 1000);
+    }
+    else
+    {
+        usleep(s_u32SaveUs);
+    }
+    return HI_SUCCESS;
+}
+
+/* one frame per channel every frame interval, as the encoder would */
+static HI_VOID *BENCH_FeedProc(HI_VOID *p)
+{
+    struct timespec stNext;
+    HI_S32 i;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNext);
+    while (HI_TRUE == s_bFeed)
+    {
+        for (i = 0; i < s_s32ChnCnt; i++)
+        {
+            VENC_STUB_Post(i, 1);
+        }
+        stNext.tv_nsec += 1000000000 / s_u32Fps;
+        if (stNext.tv_nsec >= 1000000000)
+        {
+            stNext.tv_nsec -= 1000000000;
+            stNext.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &stNext, NULL);
+    }
+    return NULL;
+}
+
+static HI_S32 BENCH_Run(const BENCH_RUN_S *pstRun, HI_U32 u32Secs, HI_U32 *pu32OtherMaxUs)
+{
+    VENC_STUB_CFG_S stCfg;
+    SAMPLE_VENC_COLLECT_CHN_S astChn[VENC_MAX_CHN_NUM];
+    SAMPLE_VENC_COLLECT_STAT_S stStat;
+    VENC_STUB_STAT_S stStub;
+    pthread_t FeedPid;
+    HI_U64 u64OtherSum = 0;
+    HI_U64 u64OtherFrames = 0;
+    HI_U32 u32OtherMax = 0;
+    HI_U32 u32OtherQueueMax = 0;
+    HI_U32 u32SlowMax = 0;
+    HI_U32 u32SlowQueueMax = 0;
+    HI_U32 u32OrderErrs = 0;
+    HI_U32 u32Left = 0;
+    HI_S32 i;
+
+    memset(&stCfg, 0, sizeof(stCfg));
+    stCfg.enType = PT_H264;
+    stCfg.u32Gop = 30;
+    stCfg.u32IFrameLen = 24 * 1024;
+    stCfg.u32PFrameLen = 3 * 1024;
+    stCfg.u32SlicePacks = 1;
+    stCfg.u32FrameRate = s_u32Fps;
+    if (HI_SUCCESS != VENC_STUB_Init(s_s32ChnCnt, &stCfg))
+    {
+        printf("venc stub init failed\n");
+        return HI_FAILURE;
+    }
+    VENC_STUB_SetClockPts(HI_TRUE);
+
+    memset(astChn, 0, sizeof(astChn));
+    memset(s_au32NextSeq, 0, sizeof(s_au32NextSeq));
+    memset(s_au32OrderErrs, 0, sizeof(s_au32OrderErrs));
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        astChn[i].VencChn = i;
+        astChn[i].s32OutFd = -1;
+        astChn[i].pfnStreamProc = BENCH_StreamProc;
+        astChn[i].s32Worker = (BENCH_SLOW_CHN == i) ? pstRun->s32SlowWorker : pstRun->s32OtherWorker;
+        if (-2 == astChn[i].s32Worker)
+        {
+            astChn[i].s32Worker = i % pstRun->s32Workers;
+        }
+    }
+    if (HI_SUCCESS != SAMPLE_COMM_VENC_StartCollectPool(astChn, s_s32ChnCnt, pstRun->s32Workers))
+    {
+        VENC_STUB_Exit();
+        return HI_FAILURE;
+    }
+
+    s_bFeed = HI_TRUE;
+    pthread_create(&FeedPid, NULL, BENCH_FeedProc, NULL);
+    sleep(u32Secs);
+    s_bFeed = HI_FALSE;
+    pthread_join(FeedPid, NULL);
+    /* let the pool drain what the feeder left */
+    for (i = 0; i < 100; i++)
+    {
+        VENC_STUB_GetStat(&stStub);
+        if (stStub.u64Released == stStub.u64Posted)
+        {
+            break;
+        }
+        usleep(10 * 1000);
+    }
+    SAMPLE_COMM_VENC_StopCollect();
+
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        SAMPLE_COMM_VENC_GetCollectStat(i, &stStat);
+        u32OrderErrs += s_au32OrderErrs[i];
+        u32Left += VENC_STUB_Pending(i);
+        if (BENCH_SLOW_CHN == i)
+        {
+            u32SlowMax = stStat.u32LatencyUsMax;
+            u32SlowQueueMax = stStat.u32QueueMax;
+            continue;
+        }
+        u64OtherSum += stStat.u64LatencyUsSum;
+        u64OtherFrames += stStat.u64Frames;
+        u32OtherMax = (stStat.u32LatencyUsMax > u32OtherMax) ? stStat.u32LatencyUsMax : u32OtherMax;
+        u32OtherQueueMax = (stStat.u32QueueMax > u32OtherQueueMax) ? stStat.u32QueueMax : u32OtherQueueMax;
+    }
+    VENC_STUB_GetStat(&stStub);
+    VENC_STUB_Exit();
+
+    printf("%-20s %8llu %10.2f %10.2f %7u %10.2f %7u %6u %6u\n", pstRun->pszName,
+           (unsigned long long)stStub.u64Released,
+           u64OtherFrames ? u64OtherSum / 1000.0 / u64OtherFrames : 0.0, u32OtherMax / 1000.0, u32OtherQueueMax,
+           u32SlowMax / 1000.0, u32SlowQueueMax, u32OrderErrs, u32Left);
+    *pu32OtherMaxUs = u32OtherMax;
+
+    return ((0 == u32OrderErrs) && (0 == u32Left)) ? HI_SUCCESS : HI_FAILURE;
+}
+
+int main(int argc, char *argv[])
+{
+    HI_U32 au32OtherMaxUs[sizeof(s_astRun) / sizeof(s_astRun[0])];
+    HI_U32 u32Secs = 3;
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U32 i;
+
+    if (argc > 1)
+    {
+        s_s32ChnCnt = atoi(argv[1]);
+    }
+    if (argc > 2)
+    {
+        u32Secs = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        s_u32SlowMs = atoi(argv[3]);
+    }
+    if ((s_s32ChnCnt < 2) || (s_s32ChnCnt > VENC_MAX_CHN_NUM) || (0 == u32Secs))
+    {
+        printf("usage: %s [chn(2-16)] [secs] [slow ms]\n", argv[0]);
+        return -1;
+    }
+
+    printf("%d chn x %u fps, chn %d blocks %u ms on I frames, the others %u us per frame, %u s per run\n",
+           s_s32ChnCnt, s_u32Fps, BENCH_SLOW_CHN, s_u32SlowMs, s_u32SaveUs, u32Secs);
+    printf("%-20s %8s %10s %10s %7s %10s %7s %6s %6s\n", "collector", "frames", "avg ms", "max ms", "queue",
+           "slow max", "queue", "order", "left");
+    for (i = 0; i < sizeof(s_astRun) / sizeof(s_astRun[0]); i++)
+    {
+        if (HI_SUCCESS != BENCH_Run(&s_astRun[i], u32Secs, &au32OtherMaxUs[i]))
+        {
+            printf("%s: FAILED\n", s_astRun[i].pszName);
+            s32Ret = HI_FAILURE;
+        }
+    }
+
+    /* with a free worker around, the slow channel no longer holds the others up */
+    if (au32OtherMaxUs[2] >= au32OtherMaxUs[0])
+    {
+        printf("pool 4 did not cut the latency of the other channels\n");
+        s32Ret = HI_FAILURE;
+    }
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
@@ -0,0 +1,298 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_prerec_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/28
+  Description   : feeds the canned h264 stream of the venc stub through the
+                  pre-event ring and checks what it holds, evicts and flushes
+  History       :
+  1.Date        : 2016/03/28
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define TEST_FPS        30
+#define TEST_GOP        30
+#define TEST_MAX_FRAMES 2000
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FUNCTION__, __LINE__, #cond); \
+            return HI_FAILURE; \
+        } \
+    } while (0)
+
+/* every frame the stub handed out, to compare flushes against */
+static HI_U8 *s_pu8Ref;
+static HI_U32 s_au32RefOff[TEST_MAX_FRAMES + 1];
+static HI_U32 s_u32RefFrames;
+
+static HI_VOID TEST_Feed(HI_U32 u32Frames)
+{
+    VENC_PACK_S astPack[16];
+    VENC_STREAM_S stStream;
+    HI_U32 u32Off;
+    HI_U32 i;
+
+    VENC_STUB_Post(0, u32Frames);
+    while (u32Frames-- > 0)
+    {
+        memset(&stStream, 0, sizeof(stStream));
+        stStream.pstPack = astPack;
+        stStream.u32PackCount = 16;
+        if (HI_SUCCESS != HI_MPI_VENC_GetStream(0, &stStream, 0))
+        {
+            printf("get stream failed\n");
+            return;
+        }
+        u32Off = s_au32RefOff[s_u32RefFrames];
+        for (i = 0; i < stStream.u32PackCount; i++)
+        {
+            memcpy(s_pu8Ref + u32Off, astPack[i].pu8Addr + astPack[i].u32Offset,
+                   astPack[i].u32Len - astPack[i].u32Offset);
+            u32Off += astPack[i].u32Len - astPack[i].u32Offset;
+        }
+        s_au32RefOff[++s_u32RefFrames] = u32Off;
+        SAMPLE_COMM_VENC_PrerecStream(0, &stStream, NULL);
+        HI_MPI_VENC_ReleaseStream(0, &stStream);
+    }
+}
+
+static HI_U32 TEST_PtsToFrame(HI_U64 u64Pts)
+{
+    return (HI_U32)((u64Pts * TEST_FPS + 500000) / 1000000);
+}
+
+/* the flushed bytes must be exactly the reference frames it reports */
+static HI_S32 TEST_Compare(const HI_U8 *pu8Data, HI_U32 u32Len, const SAMPLE_VENC_PREREC_FLUSH_S *pstFlush)
+{
+    HI_U32 u32Start = TEST_PtsToFrame(pstFlush->u64StartPts);
+    HI_U32 u32End = TEST_PtsToFrame(pstFlush->u64EndPts) + 1;
+
+    TEST_CHECK(0 == u32Start % TEST_GOP);
+    TEST_CHECK(u32End - u32Start == pstFlush->u32Frames);
+    TEST_CHECK(u32Len == pstFlush->u32Bytes);
+    TEST_CHECK(s_au32RefOff[u32End] - s_au32RefOff[u32Start] == u32Len);
+    TEST_CHECK(0 == memcmp(pu8Data, s_pu8Ref + s_au32RefOff[u32Start], u32Len));
+    /* starts with the sps of the key frame */
+    TEST_CHECK((0 == pu8Data[0]) && (0 == pu8Data[1]) && (0 == pu8Data[2]) && (1 == pu8Data[3]) && (0x67 == pu8Data[4]));
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Flush(HI_U32 u32PreMs, SAMPLE_VENC_PREREC_FLUSH_S *pstFlush)
+{
+    static HI_U8 s_au8File[4 * 1024 * 1024];
+    FILE *pFile = tmpfile();
+    HI_U32 u32Len;
+
+    TEST_CHECK(NULL != pFile);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_PrerecFlush(0, fileno(pFile), u32PreMs, pstFlush));
+    rewind(pFile);
+    u32Len = fread(s_au8File, 1, sizeof(s_au8File), pFile);
+    fclose(pFile);
+    return TEST_Compare(s_au8File, u32Len, pstFlush);
+}
+
+static HI_S32 TEST_Start(HI_U32 u32PreMs, HI_U32 u32BufSize, HI_U32 u32MaxFrames)
+{
+    VENC_STUB_CFG_S stCfg;
+    SAMPLE_VENC_PREREC_ATTR_S stAttr;
+
+    /* I 20k, P 2k, about 78k per gop */
+    stCfg.enType = PT_H264;
+    stCfg.u32Gop = TEST_GOP;
+    stCfg.u32IFrameLen = 20 * 1024;
+    stCfg.u32PFrameLen = 2 * 1024;
+    stCfg.u32SlicePacks = 2;
+    stCfg.u32FrameRate = TEST_FPS;
+    TEST_CHECK(HI_SUCCESS == VENC_STUB_Init(1, &stCfg));
+
+    stAttr.enType = PT_H264;
+    stAttr.u32PreMs = u32PreMs;
+    stAttr.u32BufSize = u32BufSize;
+    stAttr.u32MaxFrames = u32MaxFrames;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_PrerecCreate(0, &stAttr));
+    s_u32RefFrames = 0;
+    return HI_SUCCESS;
+}
+
+static HI_VOID TEST_Stop(HI_VOID)
+{
+    SAMPLE_COMM_VENC_PrerecDestroy(0);
+    VENC_STUB_Exit();
+}
+
+static HI_VOID TEST_PrintStat(const HI_CHAR *pszName)
+{
+    SAMPLE_VENC_PREREC_STAT_S stStat;
+
+    SAMPLE_COMM_VENC_PrerecGetStat(0, &stStat);
+    printf("%-8s used %7u/%-7u frames %4u gops %2u span %5u ms evicted %3llu gops %8llu bytes drops %3u"
+           " flush %u us (max %u)\n", pszName, stStat.u32Used, stStat.u32BufSize, stStat.u32Frames, stStat.u32Gops,
+           stStat.u32SpanMs, stStat.u64EvictGops, stStat.u64EvictBytes, stStat.u32DropFrames,
+           stStat.u32FlushUsLast, stStat.u32FlushUsMax);
+}
+
+/* ample memory: the time limit decides, and a flush picks its gop by age */
+static HI_S32 TEST_Time(HI_VOID)
+{
+    SAMPLE_VENC_PREREC_STAT_S stStat;
+    SAMPLE_VENC_PREREC_FLUSH_S stFlush;
+
+    TEST_CHECK(HI_SUCCESS == TEST_Start(2000, 4 * 1024 * 1024, 300));
+    TEST_Feed(300);
+    TEST_PrintStat("time");
+    SAMPLE_COMM_VENC_PrerecGetStat(0, &stStat);
+    TEST_CHECK((3 == stStat.u32Gops) && (90 == stStat.u32Frames) && (2966 == stStat.u32SpanMs));
+    TEST_CHECK((7 == stStat.u64EvictGops) && (0 == stStat.u32DropFrames));
+    TEST_CHECK(stStat.u32Used == s_au32RefOff[300] - s_au32RefOff[210]);
+
+    TEST_CHECK(HI_SUCCESS == TEST_Flush(0, &stFlush));
+    TEST_CHECK(30 == stFlush.u32Frames);
+    TEST_CHECK(HI_SUCCESS == TEST_Flush(1500, &stFlush));
+    TEST_CHECK(60 == stFlush.u32Frames);
+    TEST_CHECK(HI_SUCCESS == TEST_Flush(2000, &stFlush));
+    TEST_CHECK(90 == stFlush.u32Frames);
+    TEST_CHECK(HI_SUCCESS == TEST_Flush(60000, &stFlush));
+    TEST_CHECK(90 == stFlush.u32Frames);
+    TEST_Stop();
+    return HI_SUCCESS;
+}
+
+/* short of memory: whole gops go early and the held ones wrap the ring */
+static HI_S32 TEST_Memory(HI_VOID)
+{
+    SAMPLE_VENC_PREREC_STAT_S stStat;
+    SAMPLE_VENC_PREREC_FLUSH_S stFlush;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_Start(10000, 200000, 600));
+    for (i = 0; i < 10; i++)
+    {
+        TEST_Feed(37);
+        SAMPLE_COMM_VENC_PrerecGetStat(0, &stStat);
+        TEST_CHECK((stStat.u32Used <= stStat.u32BufSize) && (0 == stStat.u32DropFrames));
+        TEST_CHECK(HI_SUCCESS == TEST_Flush(10000, &stFlush));
+    }
+    TEST_PrintStat("memory");
+    TEST_CHECK(stStat.u64EvictGops >= 8);
+    TEST_CHECK(stStat.u64EvictBytes + stStat.u32Used == s_au32RefOff[s_u32RefFrames]);
+    TEST_Stop();
+    return HI_SUCCESS;
+}
+
+/* a gop larger than the ring: its head is kept, the rest dropped up to the next key frame */
+static HI_S32 TEST_Oversize(HI_VOID)
+{
+    SAMPLE_VENC_PREREC_STAT_S stStat;
+    SAMPLE_VENC_PREREC_FLUSH_S stFlush;
+
+    TEST_CHECK(HI_SUCCESS == TEST_Start(2000, 40000, 100));
+    TEST_Feed(75);
+    TEST_PrintStat("oversize");
+    SAMPLE_COMM_VENC_PrerecGetStat(0, &stStat);
+    TEST_CHECK((1 == stStat.u32Gops) && (stStat.u32Frames < 15) && (stStat.u32DropFrames > 30));
+    TEST_CHECK(HI_SUCCESS == TEST_Flush(0, &stFlush));
+    TEST_CHECK(60 == TEST_PtsToFrame(stFlush.u64StartPts));
+    TEST_Stop();
+    return HI_SUCCESS;
+}
+
+typedef struct hiTEST_PIN_S
+{
+    HI_S32 s32Fd;
+    SAMPLE_VENC_PREREC_FLUSH_S stFlush;
+    HI_S32 s32Ret;
+}TEST_PIN_S;
+
+static HI_VOID *TEST_PinProc(HI_VOID *p)
+{
+    TEST_PIN_S *pstPin = (TEST_PIN_S *)p;
+
+    pstPin->s32Ret = SAMPLE_COMM_VENC_PrerecFlush(0, pstPin->s32Fd, 10000, &pstPin->stFlush);
+    close(pstPin->s32Fd);
+    return NULL;
+}
+
+/* a flush blocked on a slow fd keeps its gops, new frames only take free room */
+static HI_S32 TEST_Pin(HI_VOID)
+{
+    static HI_U8 s_au8Pipe[1024 * 1024];
+    SAMPLE_VENC_PREREC_STAT_S stStat;
+    SAMPLE_VENC_PREREC_FLUSH_S stFlush;
+    TEST_PIN_S stPin;
+    pthread_t Pid;
+    HI_S32 as32Pipe[2];
+    HI_U32 u32Len;
+    ssize_t s32Len;
+
+    TEST_CHECK(HI_SUCCESS == TEST_Start(10000, 200000, 600));
+    TEST_Feed(60);
+    TEST_CHECK(0 == pipe(as32Pipe));
+    stPin.s32Fd = as32Pipe[1];
+    pthread_create(&Pid, NULL, TEST_PinProc, &stPin);
+
+    /* the pipe holds 64k, so the flush is past its snapshot and blocked once data shows up */
+    u32Len = read(as32Pipe[0], s_au8Pipe, 1);
+    TEST_CHECK(1 == u32Len);
+    TEST_Feed(150);
+    SAMPLE_COMM_VENC_PrerecGetStat(0, &stStat);
+    TEST_CHECK((0 == stStat.u64EvictGops) && (stStat.u32DropFrames > 0));
+
+    while ((s32Len = read(as32Pipe[0], s_au8Pipe + u32Len, sizeof(s_au8Pipe) - u32Len)) > 0)
+    {
+        u32Len += s32Len;
+    }
+    pthread_join(Pid, NULL);
+    close(as32Pipe[0]);
+    TEST_CHECK(HI_SUCCESS == stPin.s32Ret);
+    TEST_CHECK(HI_SUCCESS == TEST_Compare(s_au8Pipe, u32Len, &stPin.stFlush));
+    TEST_CHECK(0 == TEST_PtsToFrame(stPin.stFlush.u64StartPts));
+
+    /* released: the next key frame evicts again and the ring goes on */
+    TEST_Feed(60);
+    TEST_PrintStat("pin");
+    SAMPLE_COMM_VENC_PrerecGetStat(0, &stStat);
+    TEST_CHECK(stStat.u64EvictGops > 0);
+    TEST_CHECK(HI_SUCCESS == TEST_Flush(0, &stFlush));
+    TEST_CHECK(TEST_PtsToFrame(stFlush.u64EndPts) + 1 == s_u32RefFrames);
+    TEST_Stop();
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    s_pu8Ref = (HI_U8 *)malloc(TEST_MAX_FRAMES * 24 * 1024);
+    if (NULL == s_pu8Ref)
+    {
+        return -1;
+    }
+
+    if ((HI_SUCCESS != TEST_Time()) || (HI_SUCCESS != TEST_Memory()) || (HI_SUCCESS != TEST_Oversize())
+        || (HI_SUCCESS != TEST_Pin()))
+    {
+        s32Ret = HI_FAILURE;
+    }
+
+    free(s_pu8Ref);
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+    return (HI_SUCCESS == s32Ret) ? 0 : -1;
+}
@@ -0,0 +1,447 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_rtp_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/11
+  Description   : sends the canned streams of the venc stub through the rtp
+                  packetizer to a loopback udp receiver, which reassembles
+                  every frame and compares it with what the stub handed out,
+                  and reports packets per second against the usual path that
+                  copies each packet into a scratch buffer first
+  History       :
+  1.Date        : 2016/04/11
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define TEST_FPS        30
+#define TEST_GOP        30
+#define TEST_FRAMES     600
+#define TEST_PT         96
+#define TEST_SSRC       0x5A5A1234
+#define TEST_MAX_FRAME  (512 * 1024)
+
+typedef struct hiTEST_CASE_S
+{
+    const HI_CHAR *pszName;
+    PAYLOAD_TYPE_E enType;
+    SAMPLE_VENC_RTP_MODE_E enMode;
+    HI_U32 u32Mtu;
+    HI_U32 u32IFrameLen;
+    HI_U32 u32PFrameLen;
+    HI_U32 u32SlicePacks;
+    HI_BOOL bCopy;                  /* the scratch buffer packetizer of the test instead */
+}TEST_CASE_S;
+
+static const TEST_CASE_S s_astCase[] =
+{
+    {"h264 fu copy",    PT_H264, SAMPLE_VENC_RTP_MODE_FU,     1400, 96 * 1024, 12 * 1024, 1, HI_TRUE},
+    {"h264 fu",         PT_H264, SAMPLE_VENC_RTP_MODE_FU,     1400, 96 * 1024, 12 * 1024, 1, HI_FALSE},
+    {"h264 aggr wrap",  PT_H264, SAMPLE_VENC_RTP_MODE_AGGR,   1400, 96 * 1024, 12 * 1024, 2, HI_FALSE},
+    {"h265 aggr wrap",  PT_H265, SAMPLE_VENC_RTP_MODE_AGGR,   1400, 96 * 1024, 12 * 1024, 2, HI_FALSE},
+    {"h265 fu mtu 500", PT_H265, SAMPLE_VENC_RTP_MODE_FU,     500,  96 * 1024, 12 * 1024, 3, HI_FALSE},
+    {"h264 single",     PT_H264, SAMPLE_VENC_RTP_MODE_SINGLE, 1400, 1200,      600,       1, HI_FALSE},
+};
+
+typedef struct hiTEST_RECV_S
+{
+    HI_S32 s32Sock;
+    HI_BOOL bStarted;
+    HI_U16 u16NextSeq;
+    HI_U32 u32Ts;
+    HI_BOOL bInFu;
+    HI_U8 au8Pkt[65536];
+    HI_U8 *pu8Frame;
+    HI_U32 u32FrameLen;
+    HI_U64 u64Packets;
+    HI_U64 u64Ns;
+    HI_U32 u32Frames;
+    HI_U32 u32Errs;
+}TEST_RECV_S;
+
+static HI_U8 *s_pu8Ref;
+static HI_U32 s_u32RefLen;
+static HI_U8 *s_pu8Scratch;
+
+static HI_U64 TEST_NowNs(HI_VOID)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return (HI_U64)stNow.tv_sec * 1000000000 + stNow.tv_nsec;
+}
+
+static HI_VOID TEST_Append(TEST_RECV_S *pstRecv, const HI_U8 *pu8Data, HI_U32 u32Len, HI_BOOL bStart)
+{
+    static const HI_U8 au8Sc[4] = {0, 0, 0, 1};
+
+    if (pstRecv->u32FrameLen + u32Len + 4 > TEST_MAX_FRAME)
+    {
+        pstRecv->u32Errs++;
+        return;
+    }
+    if (HI_TRUE == bStart)
+    {
+        memcpy(pstRecv->pu8Frame + pstRecv->u32FrameLen, au8Sc, 4);
+        pstRecv->u32FrameLen += 4;
+    }
+    memcpy(pstRecv->pu8Frame + pstRecv->u32FrameLen, pu8Data, u32Len);
+    pstRecv->u32FrameLen += u32Len;
+}
+
+/* rtp back to annex b, the frame ends with the marker bit */
+static HI_VOID TEST_Depacketize(TEST_RECV_S *pstRecv, PAYLOAD_TYPE_E enType, HI_U32 u32Len)
+{
+    const HI_U8 *p = pstRecv->au8Pkt;
+    const HI_U8 *pu8Pl = p + 12;
+    HI_U32 u32PlLen = u32Len - 12;
+    HI_U32 u32HdrLen = (PT_H264 == enType) ? 1 : 2;
+    HI_U32 u32Type;
+    HI_U32 u32Size;
+    HI_U8 au8Hdr[2];
+    HI_U16 u16Seq = (HI_U16)((p[2] << 8) | p[3]);
+    HI_U32 u32Ts = ((HI_U32)p[4] << 24) | ((HI_U32)p[5] << 16) | ((HI_U32)p[6] << 8) | p[7];
+
+    if ((u32Len <= 12 + u32HdrLen) || (0x80 != p[0]) || (TEST_PT != (p[1] & 0x7F))
+        || (TEST_SSRC != (((HI_U32)p[8] << 24) | ((HI_U32)p[9] << 16) | ((HI_U32)p[10] << 8) | p[11]))
+        || ((HI_TRUE == pstRecv->bStarted) && (u16Seq != pstRecv->u16NextSeq))
+        || ((0 != pstRecv->u32FrameLen) && (u32Ts != pstRecv->u32Ts)))
+    {
+        pstRecv->u32Errs++;
+    }
+    pstRecv->bStarted = HI_TRUE;
+    pstRecv->u16NextSeq = u16Seq + 1;
+    pstRecv->u32Ts = u32Ts;
+
+    u32Type = (PT_H264 == enType) ? (pu8Pl[0] & 0x1F) : ((pu8Pl[0] >> 1) & 0x3F);
+    if (((PT_H264 == enType) && (24 == u32Type)) || ((PT_H265 == enType) && (48 == u32Type)))
+    {
+        pu8Pl += u32HdrLen;
+        u32PlLen -= u32HdrLen;
+        while (u32PlLen >= 2)
+        {
+            u32Size = (pu8Pl[0] << 8) | pu8Pl[1];
+            if (u32Size + 2 > u32PlLen)
+            {
+                pstRecv->u32Errs++;
+                break;
+            }
+            TEST_Append(pstRecv, pu8Pl + 2, u32Size, HI_TRUE);
+            pu8Pl += 2 + u32Size;
+            u32PlLen -= 2 + u32Size;
+        }
+    }
+    else if (((PT_H264 == enType) && (28 == u32Type)) || ((PT_H265 == enType) && (49 == u32Type)))
+    {
+        if (pu8Pl[u32HdrLen] & 0x80)
+        {
+            if (PT_H264 == enType)
+            {
+                au8Hdr[0] = (pu8Pl[0] & 0xE0) | (pu8Pl[1] & 0x1F);
+            }
+            else
+            {
+                au8Hdr[0] = (pu8Pl[0] & 0x81) | ((pu8Pl[2] & 0x3F) << 1);
+                au8Hdr[1] = pu8Pl[1];
+            }
+            TEST_Append(pstRecv, au8Hdr, u32HdrLen, HI_TRUE);
+            pstRecv->bInFu = HI_TRUE;
+        }
+        else if (HI_TRUE != pstRecv->bInFu)
+        {
+            pstRecv->u32Errs++;
+        }
+        TEST_Append(pstRecv, pu8Pl + u32HdrLen + 1, u32PlLen - u32HdrLen - 1, HI_FALSE);
+        if (pu8Pl[u32HdrLen] & 0x40)
+        {
+            pstRecv->bInFu = HI_FALSE;
+        }
+    }
+    else
+    {
+        TEST_Append(pstRecv, pu8Pl, u32PlLen, HI_TRUE);
+    }
+
+    if (p[1] & 0x80)
+    {
+        if ((pstRecv->u32FrameLen != s_u32RefLen) || (0 != memcmp(pstRecv->pu8Frame, s_pu8Ref, s_u32RefLen))
+            || (HI_TRUE == pstRecv->bInFu))
+        {
+            pstRecv->u32Errs++;
+        }
+        pstRecv->u32Frames++;
+        pstRecv->u32FrameLen = 0;
+    }
+}
+
+/* everything queued on the receiving socket, the sender waits for it frame by frame */
+static HI_VOID TEST_Drain(TEST_RECV_S *pstRecv, const TEST_CASE_S *pstCase)
+{
+    HI_U64 u64Start = TEST_NowNs();
+    ssize_t s32Len;
+
+    while (1)
+    {
+        s32Len = recv(pstRecv->s32Sock, pstRecv->au8Pkt, sizeof(pstRecv->au8Pkt), MSG_DONTWAIT);
+        if (s32Len < 0)
+        {
+            break;
+        }
+        if ((s32Len > (ssize_t)pstCase->u32Mtu) && (SAMPLE_VENC_RTP_MODE_SINGLE != pstCase->enMode))
+        {
+            pstRecv->u32Errs++;
+        }
+        pstRecv->u64Packets++;
+        TEST_Depacketize(pstRecv, pstCase->enType, (HI_U32)s32Len);
+    }
+    pstRecv->u64Ns += TEST_NowNs() - u64Start;
+}
+
+/* what a deployment usually does: frame gathered into one buffer, each packet copied into a scratch buffer */
+static HI_U32 TEST_CopySend(HI_S32 s32Sock, const VENC_STREAM_S *pstStream, HI_U32 u32Mtu, HI_U16 *pu16Seq)
+{
+    HI_U8 au8Pkt[1500];
+    HI_U32 u32FrameLen = 0;
+    HI_U32 u32Nal;
+    HI_U32 u32End;
+    HI_U32 u32Off;
+    HI_U32 u32Len;
+    HI_U32 u32Ts = (HI_U32)((pstStream->pstPack[0].u64PTS * 9 + 50) / 100);
+    HI_U32 u32Packets = 0;
+    HI_U32 i;
+    HI_BOOL bLast;
+
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        memcpy(s_pu8Scratch + u32FrameLen, pstStream->pstPack[i].pu8Addr + pstStream->pstPack[i].u32Offset,
+               pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset);
+        u32FrameLen += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+    au8Pkt[0] = 0x80;
+    au8Pkt[8] = TEST_SSRC >> 24;
+    au8Pkt[9] = (TEST_SSRC >> 16) & 0xFF;
+    au8Pkt[10] = (TEST_SSRC >> 8) & 0xFF;
+    au8Pkt[11] = TEST_SSRC & 0xFF;
+    au8Pkt[4] = u32Ts >> 24;
+    au8Pkt[5] = (u32Ts >> 16) & 0xFF;
+    au8Pkt[6] = (u32Ts >> 8) & 0xFF;
+    au8Pkt[7] = u32Ts & 0xFF;
+
+    /* the stub writes 4 byte start codes only */
+    for (u32Nal = 4; u32Nal < u32FrameLen; u32Nal = u32End + 4)
+    {
+        for (u32End = u32Nal; u32End + 4 <= u32FrameLen; u32End++)
+        {
+            if ((0 == s_pu8Scratch[u32End]) && (0 == s_pu8Scratch[u32End + 1]) && (0 == s_pu8Scratch[u32End + 2])
+                && (1 == s_pu8Scratch[u32End + 3]))
+            {
+                break;
+            }
+        }
+        if (u32End + 4 > u32FrameLen)
+        {
+            u32End = u32FrameLen;
+        }
+        bLast = (u32End == u32FrameLen) ? HI_TRUE : HI_FALSE;
+        for (u32Off = u32Nal + 1; u32Off < u32End; u32Off += u32Len)
+        {
+            u32Len = u32End - u32Off;
+            if (u32Len > u32Mtu - 14)
+            {
+                u32Len = u32Mtu - 14;
+            }
+            au8Pkt[1] = (((HI_TRUE == bLast) && (u32Off + u32Len == u32End)) ? 0x80 : 0) | TEST_PT;
+            au8Pkt[2] = *pu16Seq >> 8;
+            au8Pkt[3] = *pu16Seq & 0xFF;
+            (*pu16Seq)++;
+            au8Pkt[12] = (s_pu8Scratch[u32Nal] & 0xE0) | 28;
+            au8Pkt[13] = (s_pu8Scratch[u32Nal] & 0x1F) | ((u32Off == u32Nal + 1) ? 0x80 : 0)
+                         | ((u32Off + u32Len == u32End) ? 0x40 : 0);
+            memcpy(au8Pkt + 14, s_pu8Scratch + u32Off, u32Len);
+            send(s32Sock, au8Pkt, 14 + u32Len, 0);
+            u32Packets++;
+        }
+    }
+    return u32Packets;
+}
+
+static HI_S32 TEST_Run(const TEST_CASE_S *pstCase, HI_S32 s32TxSock, TEST_RECV_S *pstRecv)
+{
+    VENC_STUB_CFG_S stCfg;
+    SAMPLE_VENC_RTP_ATTR_S stAttr;
+    SAMPLE_VENC_RTP_STAT_S stStat;
+    VENC_PACK_S astPack[16];
+    VENC_STREAM_S stStream;
+    HI_U64 u64SendNs = 0;
+    HI_U64 u64Packets = 0;
+    HI_U64 u64Start;
+    HI_U16 u16Seq = 0;
+    HI_U32 u32Frame;
+    HI_U32 i;
+
+    memset(&stCfg, 0, sizeof(stCfg));
+    stCfg.enType = pstCase->enType;
+    stCfg.u32Gop = TEST_GOP;
+    stCfg.u32IFrameLen = pstCase->u32IFrameLen;
+    stCfg.u32PFrameLen = pstCase->u32PFrameLen;
+    stCfg.u32SlicePacks = pstCase->u32SlicePacks;
+    stCfg.u32FrameRate = TEST_FPS;
+    if (HI_SUCCESS != VENC_STUB_Init(1, &stCfg))
+    {
+        printf("venc stub init failed\n");
+        return HI_FAILURE;
+    }
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.enType = pstCase->enType;
+    stAttr.enMode = pstCase->enMode;
+    stAttr.u32Mtu = pstCase->u32Mtu;
+    stAttr.u32PayloadType = TEST_PT;
+    stAttr.u32Ssrc = TEST_SSRC;
+    if ((HI_TRUE != pstCase->bCopy) && (HI_SUCCESS != SAMPLE_COMM_VENC_RtpOpen(0, s32TxSock, &stAttr)))
+    {
+        VENC_STUB_Exit();
+        return HI_FAILURE;
+    }
+
+    memset(pstRecv->au8Pkt, 0, 16);
+    pstRecv->bStarted = HI_FALSE;
+    pstRecv->bInFu = HI_FALSE;
+    pstRecv->u32FrameLen = 0;
+    pstRecv->u64Packets = 0;
+    pstRecv->u64Ns = 0;
+    pstRecv->u32Frames = 0;
+    pstRecv->u32Errs = 0;
+
+    VENC_STUB_Post(0, TEST_FRAMES);
+    for (u32Frame = 0; u32Frame < TEST_FRAMES; u32Frame++)
+    {
+        memset(&stStream, 0, sizeof(stStream));
+        stStream.pstPack = astPack;
+        stStream.u32PackCount = 16;
+        if (HI_SUCCESS != HI_MPI_VENC_GetStream(0, &stStream, 0))
+        {
+            printf("get stream failed\n");
+            break;
+        }
+        s_u32RefLen = 0;
+        for (i = 0; i < stStream.u32PackCount; i++)
+        {
+            memcpy(s_pu8Ref + s_u32RefLen, astPack[i].pu8Addr + astPack[i].u32Offset,
+                   astPack[i].u32Len - astPack[i].u32Offset);
+            s_u32RefLen += astPack[i].u32Len - astPack[i].u32Offset;
+        }
+
+        u64Start = TEST_NowNs();
+        if (HI_TRUE == pstCase->bCopy)
+        {
+            u64Packets += TEST_CopySend(s32TxSock, &stStream, pstCase->u32Mtu, &u16Seq);
+        }
+        else
+        {
+            SAMPLE_COMM_VENC_RtpStream(0, &stStream, NULL);
+        }
+        u64SendNs += TEST_NowNs() - u64Start;
+        HI_MPI_VENC_ReleaseStream(0, &stStream);
+        TEST_Drain(pstRecv, pstCase);
+    }
+
+    memset(&stStat, 0, sizeof(stStat));
+    if (HI_TRUE != pstCase->bCopy)
+    {
+        SAMPLE_COMM_VENC_RtpClose(0);
+        SAMPLE_COMM_VENC_RtpGetStat(0, &stStat);
+        u64Packets = stStat.u64Packets;
+    }
+    VENC_STUB_Exit();
+
+    printf("%-16s %7llu pkts (single %6u aggr %5u fu %6u) send %7.0f kpps %6.0f ns/pkt  recv %7.0f kpps"
+           "  %4u frames %u errs\n",
+           pstCase->pszName, (unsigned long long)u64Packets, stStat.u32SinglePackets, stStat.u32AggrPackets,
+           stStat.u32FuPackets, u64Packets * 1e6 / u64SendNs, (double)u64SendNs / u64Packets,
+           pstRecv->u64Packets * 1e6 / pstRecv->u64Ns, pstRecv->u32Frames, pstRecv->u32Errs);
+
+    if ((TEST_FRAMES != pstRecv->u32Frames) || (0 != pstRecv->u32Errs) || (u64Packets != pstRecv->u64Packets)
+        || (0 != stStat.u32SendErrs) || (0 != stStat.u32BadFrames))
+    {
+        return HI_FAILURE;
+    }
+    if ((SAMPLE_VENC_RTP_MODE_AGGR == pstCase->enMode) && (0 == stStat.u32AggrPackets))
+    {
+        printf("no parameter sets aggregated\n");
+        return HI_FAILURE;
+    }
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    struct sockaddr_in stAddr;
+    socklen_t s32AddrLen = sizeof(stAddr);
+    TEST_RECV_S *pstRecv;
+    HI_S32 s32TxSock;
+    HI_S32 s32BufSize = 4 * 1024 * 1024;
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U32 i;
+
+    pstRecv = (TEST_RECV_S *)calloc(1, sizeof(TEST_RECV_S));
+    s_pu8Ref = (HI_U8 *)malloc(TEST_MAX_FRAME);
+    s_pu8Scratch = (HI_U8 *)malloc(TEST_MAX_FRAME);
+    if ((NULL == pstRecv) || (NULL == s_pu8Ref) || (NULL == s_pu8Scratch))
+    {
+        return 1;
+    }
+    pstRecv->pu8Frame = (HI_U8 *)malloc(TEST_MAX_FRAME);
+
+    memset(&stAddr, 0, sizeof(stAddr));
+    stAddr.sin_family = AF_INET;
+    stAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    pstRecv->s32Sock = socket(AF_INET, SOCK_DGRAM, 0);
+    s32TxSock = socket(AF_INET, SOCK_DGRAM, 0);
+    setsockopt(pstRecv->s32Sock, SOL_SOCKET, SO_RCVBUF, &s32BufSize, sizeof(s32BufSize));
+    if ((NULL == pstRecv->pu8Frame) || (pstRecv->s32Sock < 0) || (s32TxSock < 0)
+        || (0 != bind(pstRecv->s32Sock, (struct sockaddr *)&stAddr, sizeof(stAddr)))
+        || (0 != getsockname(pstRecv->s32Sock, (struct sockaddr *)&stAddr, &s32AddrLen))
+        || (0 != connect(s32TxSock, (struct sockaddr *)&stAddr, sizeof(stAddr))))
+    {
+        printf("loopback udp setup failed: %s\n", strerror(errno));
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(s_astCase) / sizeof(s_astCase[0]); i++)
+    {
+        if (HI_SUCCESS != TEST_Run(&s_astCase[i], s32TxSock, pstRecv))
+        {
+            printf("%s: FAILED\n", s_astCase[i].pszName);
+            s32Ret = HI_FAILURE;
+        }
+    }
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    close(s32TxSock);
+    close(pstRecv->s32Sock);
+    free(pstRecv->pu8Frame);
+    free(pstRecv);
+    free(s_pu8Ref);
+    free(s_pu8Scratch);
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
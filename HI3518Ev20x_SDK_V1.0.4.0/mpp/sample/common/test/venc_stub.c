@@ -0,0 +1,613 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_stub.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/14
+  Description   : host stand-in for the venc mpi. Each channel has an eventfd
+                  in semaphore mode as its venc fd, one count per ready frame.
+                  Packs point into per channel templates that hold valid NAL
+                  start codes and headers, payload bytes never form a start
+                  code.
+  History       :
+  1.Date        : 2016/03/14
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/eventfd.h>
+
+#include "mpi_venc.h"
+#include "venc_stub.h"
+
+#define VENC_STUB_MAX_PACKS     16
+#define VENC_STUB_HDR_LEN       64
+#define VENC_STUB_PTS_RING      4096
+
+typedef struct hiVENC_STUB_CHN_S
+{
+    HI_S32 s32Fd;
+    HI_U32 u32Pending;
+    HI_U32 u32Seq;              /* next frame to hand out */
+    HI_BOOL bOut;               /* a frame is got and not released yet */
+    HI_U8 *pu8Param;            /* VPS/SPS/PPS/SEI, each with a start code */
+    HI_U32 au32ParamLen[4];
+    HI_U32 u32ParamNum;
+    HI_U8 *pu8ISlice;
+    HI_U8 *pu8PSlice;
+    HI_U64 au64PostUs[VENC_STUB_PTS_RING];  /* clock at post time of the pending frames */
+    HI_S32 s32RecvLeft;         /* pictures still encoded by VENC_STUB_Picture, -1 all */
+}VENC_STUB_CHN_S;
+
+static VENC_STUB_CFG_S s_stCfg;
+static VENC_STUB_CHN_S s_astChn[VENC_MAX_CHN_NUM];
+static HI_S32 s_s32ChnCnt = 0;
+static HI_BOOL s_bClockPts = HI_FALSE;
+static HI_BOOL s_bSvct = HI_FALSE;
+static VENC_STUB_STAT_S s_stStat;
+static pthread_mutex_t s_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* baseline 1920x1080 parameter sets and an SEI, H.265 main 1920x1080 */
+static const HI_U8 s_au8H264Sps[] = {0x67, 0x42, 0x00, 0x28, 0x95, 0xA0, 0x1E, 0x00, 0x89, 0xF9, 0x50};
+static const HI_U8 s_au8H264Pps[] = {0x68, 0xCE, 0x3C, 0x80};
+static const HI_U8 s_au8H264Sei[] = {0x06, 0x05, 0x01, 0x11, 0x80};
+static const HI_U8 s_au8H265Vps[] = {0x40, 0x01, 0x0C, 0x01, 0xFF, 0xFF, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0xB0,
+                                     0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x7B, 0xAC, 0x09};
+static const HI_U8 s_au8H265Sps[] = {0x42, 0x01, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0xB0, 0x00, 0x00, 0x03,
+                                     0x00, 0x00, 0x03, 0x00, 0x7B, 0xA0, 0x03, 0xC0, 0x80, 0x10, 0xE5, 0x96, 0x56,
+                                     0x69, 0x24, 0xCA, 0xE0, 0x10, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x03,
+                                     0x01, 0xE0, 0x80};
+static const HI_U8 s_au8H265Pps[] = {0x44, 0x01, 0xC1, 0x72, 0xB4, 0x62, 0x40};
+static const HI_U8 s_au8H265Sei[] = {0x4E, 0x01, 0x05, 0x01, 0x11, 0x80};
+
+static HI_U32 VENC_STUB_AddNal(HI_U8 *pu8Dst, const HI_U8 *pu8Nal, HI_U32 u32Len)
+{
+    pu8Dst[0] = 0;
+    pu8Dst[1] = 0;
+    pu8Dst[2] = 0;
+    pu8Dst[3] = 1;
+    memcpy(pu8Dst + 4, pu8Nal, u32Len);
+    return u32Len + 4;
+}
+
+/*
+ * A jpeg as the encoder makes it with dcf on: an APP1 exif segment holding a
+ * whole thumbnail jpeg at VENC_STUB_THUMB_OFF, then the tables and the scan
+ * up to u32Len. Both have 0xFF 0xD9 inside their quantization table and
+ * stuffed 0xFF bytes in the entropy data.
+ */
+static HI_U32 VENC_STUB_AddJpeg(HI_U8 *pu8Dst, HI_U32 u32Len, HI_U32 u32Seed, HI_BOOL bSoi)
+{
+    HI_U32 u32Off = 0;
+    HI_U32 i;
+
+    if (HI_TRUE == bSoi)
+    {
+        pu8Dst[u32Off++] = 0xFF;
+        pu8Dst[u32Off++] = 0xD8;
+    }
+    pu8Dst[u32Off++] = 0xFF;
+    pu8Dst[u32Off++] = 0xDB;
+    pu8Dst[u32Off++] = 0x00;
+    pu8Dst[u32Off++] = 67;
+    pu8Dst[u32Off++] = 0x00;
+    for (i = 0; i < 64; i++)
+    {
+        pu8Dst[u32Off++] = (i < 2) ? ((0 == i) ? 0xFF : 0xD9) : (HI_U8)(i + 1);
+    }
+    pu8Dst[u32Off++] = 0xFF;
+    pu8Dst[u32Off++] = 0xDA;
+    pu8Dst[u32Off++] = 0x00;
+    pu8Dst[u32Off++] = 8;
+    pu8Dst[u32Off++] = 1;
+    pu8Dst[u32Off++] = 1;
+    pu8Dst[u32Off++] = 0x00;
+    pu8Dst[u32Off++] = 0x00;
+    pu8Dst[u32Off++] = 0x3F;
+    pu8Dst[u32Off++] = 0x00;
+    while (u32Off < u32Len - 2)
+    {
+        u32Seed = u32Seed * 1103515245 + 12345;
+        if ((0 == ((u32Seed >> 8) & 0x3F)) && (u32Off + 2 < u32Len - 2))
+        {
+            pu8Dst[u32Off++] = 0xFF;
+            pu8Dst[u32Off++] = 0x00;
+            continue;
+        }
+        pu8Dst[u32Off++] = (HI_U8)((u32Seed >> 16) % 254) + 1;
+    }
+    pu8Dst[u32Off++] = 0xFF;
+    pu8Dst[u32Off++] = 0xD9;
+    return u32Off;
+}
+
+static HI_U8 *VENC_STUB_MakeJpeg(HI_U32 u32Len, HI_U32 u32Seed)
+{
+    static const HI_U8 au8Exif[] = {'E', 'x', 'i', 'f', 0, 0, 'I', 'I', 0x2A, 0, 8, 0, 0, 0};
+    HI_U32 u32App = 2 + sizeof(au8Exif) + VENC_STUB_THUMB_LEN;
+    HI_U8 *pu8Jpeg;
+
+    pu8Jpeg = (HI_U8 *)malloc(u32Len);
+    if (NULL == pu8Jpeg)
+    {
+        return NULL;
+    }
+    pu8Jpeg[0] = 0xFF;
+    pu8Jpeg[1] = 0xD8;
+    pu8Jpeg[2] = 0xFF;
+    pu8Jpeg[3] = 0xE1;
+    pu8Jpeg[4] = (HI_U8)(u32App >> 8);
+    pu8Jpeg[5] = (HI_U8)u32App;
+    memcpy(pu8Jpeg + 6, au8Exif, sizeof(au8Exif));
+    VENC_STUB_AddJpeg(pu8Jpeg + VENC_STUB_THUMB_OFF, VENC_STUB_THUMB_LEN, u32Seed + 7, HI_TRUE);
+    VENC_STUB_AddJpeg(pu8Jpeg + VENC_STUB_THUMB_OFF + VENC_STUB_THUMB_LEN,
+                      u32Len - VENC_STUB_THUMB_OFF - VENC_STUB_THUMB_LEN, u32Seed, HI_FALSE);
+    return pu8Jpeg;
+}
+
+static HI_U8 *VENC_STUB_MakeSlice(HI_U32 u32Len, const HI_U8 *pu8Hdr, HI_U32 u32HdrLen, HI_U32 u32Seed)
+{
+    HI_U8 *pu8Slice;
+    HI_U32 i;
+
+    pu8Slice = (HI_U8 *)malloc(u32Len);
+    if (NULL == pu8Slice)
+    {
+        return NULL;
+    }
+    VENC_STUB_AddNal(pu8Slice, pu8Hdr, u32HdrLen);
+    for (i = 4 + u32HdrLen; i < u32Len; i++)
+    {
+        u32Seed = u32Seed * 1103515245 + 12345;
+        pu8Slice[i] = (HI_U8)((u32Seed >> 16) % 255) + 1;
+    }
+    return pu8Slice;
+}
+
+HI_S32 VENC_STUB_Init(HI_S32 s32ChnCnt, const VENC_STUB_CFG_S *pstCfg)
+{
+    static const HI_U8 au8H264I[] = {0x65, 0x88};
+    static const HI_U8 au8H264P[] = {0x41, 0x9A};
+    static const HI_U8 au8H265I[] = {0x26, 0x01, 0xAF};
+    static const HI_U8 au8H265P[] = {0x02, 0x01, 0xD0};
+    VENC_STUB_CHN_S *pstChn;
+    HI_U32 u32Off;
+    HI_S32 i;
+
+    if ((s32ChnCnt <= 0) || (s32ChnCnt > VENC_MAX_CHN_NUM) || (pstCfg->u32Gop == 0)
+        || (pstCfg->u32SlicePacks == 0) || (pstCfg->u32SlicePacks > VENC_STUB_MAX_PACKS - 4)
+        || (pstCfg->u32IFrameLen < VENC_STUB_HDR_LEN)
+        || ((PT_JPEG != pstCfg->enType) && (pstCfg->u32PFrameLen < VENC_STUB_HDR_LEN))
+        || ((PT_JPEG == pstCfg->enType) && (pstCfg->u32IFrameLen < VENC_STUB_THUMB_OFF + VENC_STUB_THUMB_LEN + 256)))
+    {
+        return HI_FAILURE;
+    }
+    memcpy(&s_stCfg, pstCfg, sizeof(s_stCfg));
+    memset(&s_stStat, 0, sizeof(s_stStat));
+    memset(s_astChn, 0, sizeof(s_astChn));
+    s_s32ChnCnt = s32ChnCnt;
+
+    for (i = 0; i < s32ChnCnt; i++)
+    {
+        pstChn = &s_astChn[i];
+        pstChn->s32Fd = eventfd(0, EFD_SEMAPHORE | EFD_NONBLOCK);
+        pstChn->pu8Param = (HI_U8 *)malloc(256);
+        if ((pstChn->s32Fd < 0) || (NULL == pstChn->pu8Param))
+        {
+            return HI_FAILURE;
+        }
+        u32Off = 0;
+        pstChn->s32RecvLeft = -1;
+        if (PT_JPEG == pstCfg->enType)
+        {
+            pstChn->u32ParamNum = 0;
+            pstChn->pu8ISlice = VENC_STUB_MakeJpeg(pstCfg->u32IFrameLen, i + 1);
+            pstChn->pu8PSlice = (HI_U8 *)malloc(1);
+        }
+        else if (PT_H265 == pstCfg->enType)
+        {
+            pstChn->au32ParamLen[0] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H265Vps, sizeof(s_au8H265Vps));
+            u32Off += pstChn->au32ParamLen[0];
+            pstChn->au32ParamLen[1] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H265Sps, sizeof(s_au8H265Sps));
+            u32Off += pstChn->au32ParamLen[1];
+            pstChn->au32ParamLen[2] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H265Pps, sizeof(s_au8H265Pps));
+            u32Off += pstChn->au32ParamLen[2];
+            pstChn->au32ParamLen[3] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H265Sei, sizeof(s_au8H265Sei));
+            pstChn->u32ParamNum = 4;
+            pstChn->pu8ISlice = VENC_STUB_MakeSlice(pstCfg->u32IFrameLen, au8H265I, sizeof(au8H265I), i * 2 + 1);
+            pstChn->pu8PSlice = VENC_STUB_MakeSlice(pstCfg->u32PFrameLen, au8H265P, sizeof(au8H265P), i * 2 + 2);
+        }
+        else
+        {
+            pstChn->au32ParamLen[0] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H264Sps, sizeof(s_au8H264Sps));
+            u32Off += pstChn->au32ParamLen[0];
+            pstChn->au32ParamLen[1] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H264Pps, sizeof(s_au8H264Pps));
+            u32Off += pstChn->au32ParamLen[1];
+            pstChn->au32ParamLen[2] = VENC_STUB_AddNal(pstChn->pu8Param + u32Off, s_au8H264Sei, sizeof(s_au8H264Sei));
+            pstChn->u32ParamNum = 3;
+            pstChn->pu8ISlice = VENC_STUB_MakeSlice(pstCfg->u32IFrameLen, au8H264I, sizeof(au8H264I), i * 2 + 1);
+            pstChn->pu8PSlice = VENC_STUB_MakeSlice(pstCfg->u32PFrameLen, au8H264P, sizeof(au8H264P), i * 2 + 2);
+        }
+        if ((NULL == pstChn->pu8ISlice) || (NULL == pstChn->pu8PSlice))
+        {
+            return HI_FAILURE;
+        }
+    }
+
+    return HI_SUCCESS;
+}
+
+HI_VOID VENC_STUB_Exit(HI_VOID)
+{
+    HI_S32 i;
+
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        close(s_astChn[i].s32Fd);
+        free(s_astChn[i].pu8Param);
+        free(s_astChn[i].pu8ISlice);
+        free(s_astChn[i].pu8PSlice);
+    }
+    memset(s_astChn, 0, sizeof(s_astChn));
+    s_s32ChnCnt = 0;
+    s_bClockPts = HI_FALSE;
+    s_bSvct = HI_FALSE;
+}
+
+static HI_U64 VENC_STUB_NowUs(HI_VOID)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return (HI_U64)stNow.tv_sec * 1000000 + stNow.tv_nsec / 1000;
+}
+
+HI_VOID VENC_STUB_SetClockPts(HI_BOOL bClockPts)
+{
+    s_bClockPts = bClockPts;
+}
+
+HI_VOID VENC_STUB_SetSvct(HI_BOOL bSvct)
+{
+    s_bSvct = bSvct;
+}
+
+/* ref type of a P frame: with svc-t, base every 4th frame, layer 1 in between, layer 2 on odd frames */
+static H264E_REF_TYPE_E VENC_STUB_RefType(HI_U32 u32Seq)
+{
+    if (HI_TRUE != s_bSvct)
+    {
+        return BASE_PSLICE_REFBYBASE;
+    }
+    if (0 != (u32Seq % 2))
+    {
+        return ENHANCE_PSLICE_NOTFORREF;
+    }
+    return (0 == (u32Seq % 4)) ? BASE_PSLICE_REFBYBASE : BASE_PSLICE_REFBYENHANCE;
+}
+
+HI_VOID VENC_STUB_Post(VENC_CHN VencChn, HI_U32 u32Frames)
+{
+    VENC_STUB_CHN_S *pstChn = &s_astChn[VencChn];
+    HI_U64 u64Cnt = u32Frames;
+    HI_U64 u64Now;
+    HI_U32 i;
+
+    pthread_mutex_lock(&s_Lock);
+    if (HI_TRUE == s_bClockPts)
+    {
+        u64Now = VENC_STUB_NowUs();
+        for (i = 0; i < u32Frames; i++)
+        {
+            pstChn->au64PostUs[(pstChn->u32Seq + pstChn->u32Pending + i) % VENC_STUB_PTS_RING] = u64Now;
+        }
+    }
+    pstChn->u32Pending += u32Frames;
+    s_stStat.u64Posted += u32Frames;
+    pthread_mutex_unlock(&s_Lock);
+    if (write(pstChn->s32Fd, &u64Cnt, sizeof(u64Cnt)) < 0)
+    {
+        printf("post chn %d failed\n", VencChn);
+    }
+}
+
+HI_BOOL VENC_STUB_Picture(VENC_CHN VencChn)
+{
+    VENC_STUB_CHN_S *pstChn = &s_astChn[VencChn];
+    HI_BOOL bEncode = HI_FALSE;
+
+    pthread_mutex_lock(&s_Lock);
+    if (0 != pstChn->s32RecvLeft)
+    {
+        bEncode = HI_TRUE;
+        pstChn->s32RecvLeft = (pstChn->s32RecvLeft > 0) ? pstChn->s32RecvLeft - 1 : -1;
+    }
+    pthread_mutex_unlock(&s_Lock);
+    if (HI_TRUE == bEncode)
+    {
+        VENC_STUB_Post(VencChn, 1);
+    }
+    return bEncode;
+}
+
+HI_U32 VENC_STUB_Pending(VENC_CHN VencChn)
+{
+    HI_U32 u32Pending;
+
+    pthread_mutex_lock(&s_Lock);
+    u32Pending = s_astChn[VencChn].u32Pending;
+    pthread_mutex_unlock(&s_Lock);
+    return u32Pending;
+}
+
+HI_VOID VENC_STUB_GetStat(VENC_STUB_STAT_S *pstStat)
+{
+    pthread_mutex_lock(&s_Lock);
+    memcpy(pstStat, &s_stStat, sizeof(s_stStat));
+    pthread_mutex_unlock(&s_Lock);
+}
+
+static HI_BOOL VENC_STUB_IsIFrame(HI_U32 u32Seq)
+{
+    return ((PT_JPEG == s_stCfg.enType) || (0 == (u32Seq % s_stCfg.u32Gop))) ? HI_TRUE : HI_FALSE;
+}
+
+static HI_U32 VENC_STUB_FramePacks(const VENC_STUB_CHN_S *pstChn, HI_U32 u32Seq)
+{
+    return ((HI_TRUE == VENC_STUB_IsIFrame(u32Seq)) ? pstChn->u32ParamNum : 0) + s_stCfg.u32SlicePacks;
+}
+
+HI_S32 HI_MPI_VENC_GetFd(VENC_CHN VeChn)
+{
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    return s_astChn[VeChn].s32Fd;
+}
+
+HI_S32 HI_MPI_VENC_CloseFd(VENC_CHN VeChn)
+{
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_GetChnAttr(VENC_CHN VeChn, VENC_CHN_ATTR_S *pstAttr)
+{
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    memset(pstAttr, 0, sizeof(*pstAttr));
+    pstAttr->stVeAttr.enType = s_stCfg.enType;
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_Query(VENC_CHN VeChn, VENC_CHN_STAT_S *pstStat)
+{
+    VENC_STUB_CHN_S *pstChn;
+
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    pstChn = &s_astChn[VeChn];
+    memset(pstStat, 0, sizeof(*pstStat));
+    pthread_mutex_lock(&s_Lock);
+    s_stStat.u64QueryCalls++;
+    pstStat->u32LeftStreamFrames = pstChn->u32Pending;
+    pstStat->u32CurPacks = (0 == pstChn->u32Pending) ? 0 : VENC_STUB_FramePacks(pstChn, pstChn->u32Seq);
+    pthread_mutex_unlock(&s_Lock);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_GetStream(VENC_CHN VeChn, VENC_STREAM_S *pstStream, HI_S32 s32MilliSec)
+{
+    VENC_STUB_CHN_S *pstChn;
+    VENC_PACK_S *pstPack;
+    HI_U64 u64Cnt;
+    HI_U64 u64Pts;
+    HI_U32 u32Packs;
+    HI_U32 u32Off = 0;
+    HI_U32 u32SliceLen;
+    HI_U32 u32Left;
+    HI_U8 *pu8Slice;
+    HI_BOOL bIFrame;
+    HI_U32 i;
+
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    if ((NULL == pstStream) || (NULL == pstStream->pstPack))
+    {
+        return HI_ERR_VENC_NULL_PTR;
+    }
+    pstChn = &s_astChn[VeChn];
+
+    pthread_mutex_lock(&s_Lock);
+    s_stStat.u64GetCalls++;
+    if (0 == pstChn->u32Pending)
+    {
+        pthread_mutex_unlock(&s_Lock);
+        return HI_ERR_VENC_BUF_EMPTY;
+    }
+    u32Packs = VENC_STUB_FramePacks(pstChn, pstChn->u32Seq);
+    if (pstStream->u32PackCount < u32Packs)
+    {
+        pthread_mutex_unlock(&s_Lock);
+        return HI_ERR_VENC_ILLEGAL_PARAM;
+    }
+    if (read(pstChn->s32Fd, &u64Cnt, sizeof(u64Cnt)) < 0)
+    {
+        pthread_mutex_unlock(&s_Lock);
+        return HI_ERR_VENC_BUF_EMPTY;
+    }
+    bIFrame = VENC_STUB_IsIFrame(pstChn->u32Seq);
+    u64Pts = (HI_U64)pstChn->u32Seq * 1000000 / ((0 == s_stCfg.u32FrameRate) ? 30 : s_stCfg.u32FrameRate);
+    if (HI_TRUE == s_bClockPts)
+    {
+        u64Pts = pstChn->au64PostUs[pstChn->u32Seq % VENC_STUB_PTS_RING];
+    }
+    pstStream->u32Seq = pstChn->u32Seq;
+    pstStream->u32PackCount = u32Packs;
+    pstChn->u32Pending--;
+    pstChn->u32Seq++;
+    pstChn->bOut = HI_TRUE;
+    s_stStat.u64Got++;
+    pthread_mutex_unlock(&s_Lock);
+
+    memset(pstStream->pstPack, 0, sizeof(VENC_PACK_S) * u32Packs);
+    pstPack = pstStream->pstPack;
+    if (HI_TRUE == bIFrame)
+    {
+        for (i = 0; i < pstChn->u32ParamNum; i++)
+        {
+            pstPack->pu8Addr = pstChn->pu8Param + u32Off;
+            pstPack->u32PhyAddr = 0x80000000 + u32Off;
+            pstPack->u32Len = pstChn->au32ParamLen[i];
+            if (PT_H265 == s_stCfg.enType)
+            {
+                pstPack->DataType.enH265EType = (0 == i) ? H265E_NALU_VPS : (1 == i) ? H265E_NALU_SPS
+                                               : (2 == i) ? H265E_NALU_PPS : H265E_NALU_SEI;
+            }
+            else
+            {
+                pstPack->DataType.enH264EType = (0 == i) ? H264E_NALU_SPS : (1 == i) ? H264E_NALU_PPS : H264E_NALU_SEI;
+            }
+            pstPack->u64PTS = u64Pts;
+            u32Off += pstPack->u32Len;
+            pstPack++;
+        }
+    }
+
+    /* the slice split across packs, as a frame wrapping the stream buffer end comes out */
+    pu8Slice = (HI_TRUE == bIFrame) ? pstChn->pu8ISlice : pstChn->pu8PSlice;
+    u32Left = (HI_TRUE == bIFrame) ? s_stCfg.u32IFrameLen : s_stCfg.u32PFrameLen;
+    for (i = 0; i < s_stCfg.u32SlicePacks; i++)
+    {
+        u32SliceLen = (i + 1 == s_stCfg.u32SlicePacks) ? u32Left : (u32Left / (s_stCfg.u32SlicePacks - i));
+        pstPack->pu8Addr = pu8Slice;
+        pstPack->u32PhyAddr = 0x90000000 + (HI_U32)(pu8Slice - ((HI_TRUE == bIFrame) ? pstChn->pu8ISlice : pstChn->pu8PSlice));
+        pstPack->u32Len = u32SliceLen;
+        pstPack->u64PTS = u64Pts;
+        pstPack->bFrameEnd = (i + 1 == s_stCfg.u32SlicePacks) ? HI_TRUE : HI_FALSE;
+        if (PT_JPEG == s_stCfg.enType)
+        {
+            pstPack->DataType.enJPEGEType = JPEGE_PACK_ECS;
+        }
+        else if (PT_H265 == s_stCfg.enType)
+        {
+            pstPack->DataType.enH265EType = (HI_TRUE == bIFrame) ? H265E_NALU_ISLICE : H265E_NALU_PSLICE;
+        }
+        else
+        {
+            pstPack->DataType.enH264EType = (HI_TRUE == bIFrame) ? H264E_NALU_ISLICE : H264E_NALU_PSLICE;
+        }
+        pu8Slice += u32SliceLen;
+        u32Left -= u32SliceLen;
+        pstPack++;
+    }
+
+    if (PT_JPEG == s_stCfg.enType)
+    {
+        pstStream->stJpegInfo.u32PicBytesNum = s_stCfg.u32IFrameLen;
+        pstStream->stJpegInfo.u32Qfactor = 90;
+    }
+    else if (PT_H265 == s_stCfg.enType)
+    {
+        pstStream->stH265Info.u32PicBytesNum = u32Off + ((HI_TRUE == bIFrame) ? s_stCfg.u32IFrameLen : s_stCfg.u32PFrameLen);
+        pstStream->stH265Info.enRefType = (HI_TRUE == bIFrame) ? BASE_IDRSLICE : VENC_STUB_RefType(pstStream->u32Seq);
+        pstStream->stH265Info.u32StartQp = (HI_TRUE == bIFrame) ? VENC_STUB_I_QP : VENC_STUB_P_QP + pstStream->u32Seq % 5;
+    }
+    else
+    {
+        pstStream->stH264Info.u32PicBytesNum = u32Off + ((HI_TRUE == bIFrame) ? s_stCfg.u32IFrameLen : s_stCfg.u32PFrameLen);
+        pstStream->stH264Info.enRefType = (HI_TRUE == bIFrame) ? BASE_IDRSLICE : VENC_STUB_RefType(pstStream->u32Seq);
+        pstStream->stH264Info.u32StartQp = (HI_TRUE == bIFrame) ? VENC_STUB_I_QP : VENC_STUB_P_QP + pstStream->u32Seq % 5;
+    }
+
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_ReleaseStream(VENC_CHN VeChn, VENC_STREAM_S *pstStream)
+{
+    HI_U32 i;
+
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    pthread_mutex_lock(&s_Lock);
+    s_astChn[VeChn].bOut = HI_FALSE;
+    s_stStat.u64Released++;
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        s_stStat.u64Bytes += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+    pthread_mutex_unlock(&s_Lock);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_StartRecvPic(VENC_CHN VeChn)
+{
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    pthread_mutex_lock(&s_Lock);
+    s_astChn[VeChn].s32RecvLeft = -1;
+    pthread_mutex_unlock(&s_Lock);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_StartRecvPicEx(VENC_CHN VeChn, VENC_RECV_PIC_PARAM_S *pstRecvParam)
+{
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    if ((NULL == pstRecvParam) || (pstRecvParam->s32RecvPicNum <= 0))
+    {
+        return HI_ERR_VENC_ILLEGAL_PARAM;
+    }
+    pthread_mutex_lock(&s_Lock);
+    s_astChn[VeChn].s32RecvLeft = pstRecvParam->s32RecvPicNum;
+    pthread_mutex_unlock(&s_Lock);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VENC_StopRecvPic(VENC_CHN VeChn)
+{
+    if ((VeChn < 0) || (VeChn >= s_s32ChnCnt))
+    {
+        return HI_ERR_VENC_INVALID_CHNID;
+    }
+    pthread_mutex_lock(&s_Lock);
+    s_astChn[VeChn].s32RecvLeft = 0;
+    pthread_mutex_unlock(&s_Lock);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_SYS_GetCurPts(HI_U64 *pu64CurPts)
+{
+    *pu64CurPts = VENC_STUB_NowUs();
+    return HI_SUCCESS;
+}
+
+/* the rest of the venc/sys mpi the sample layer links against, unused on the host */
+HI_S32 HI_MPI_VENC_CreateChn(VENC_CHN VeChn, const VENC_CHN_ATTR_S *pstAttr) { return HI_ERR_VENC_NOT_SUPPORT; }
+HI_S32 HI_MPI_VENC_DestroyChn(VENC_CHN VeChn) { return HI_ERR_VENC_NOT_SUPPORT; }
+HI_S32 HI_MPI_SYS_Bind(MPP_CHN_S *pstSrcChn, MPP_CHN_S *pstDestChn) { return HI_FAILURE; }
+HI_S32 HI_MPI_SYS_UnBind(MPP_CHN_S *pstSrcChn, MPP_CHN_S *pstDestChn) { return HI_FAILURE; }
+HI_S32 HI_MPI_SYS_SetMemConf(MPP_CHN_S *pstMppChn, const HI_CHAR *pcMmzName) { return HI_FAILURE; }
+HI_S32 SAMPLE_COMM_SYS_GetPicSize(VIDEO_NORM_E enNorm, PIC_SIZE_E enPicSize, SIZE_S *pstSize) { return HI_FAILURE; }
@@ -0,0 +1,67 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_stub.h
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/14
+  Description   : host stand-in for the venc mpi, feeds canned streams to the
+                  sample layer so it can be measured without a board
+  History       :
+  1.Date        : 2016/03/14
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#ifndef __VENC_STUB_H__
+#define __VENC_STUB_H__
+
+#include "hi_type.h"
+#include "hi_common.h"
+#include "hi_comm_venc.h"
+
+/* start qp of the frames, P frames step through VENC_STUB_P_QP + seq % 5 */
+#define VENC_STUB_I_QP          26
+#define VENC_STUB_P_QP          30
+
+/* PT_JPEG: every frame is one u32IFrameLen jpeg with a thumbnail jpeg in its APP1 segment at this offset */
+#define VENC_STUB_THUMB_OFF     20
+#define VENC_STUB_THUMB_LEN     1536
+
+typedef struct hiVENC_STUB_CFG_S
+{
+    PAYLOAD_TYPE_E enType;      /* PT_H264, PT_H265 or PT_JPEG */
+    HI_U32 u32Gop;
+    HI_U32 u32IFrameLen;        /* bytes of the I slice, parameter sets come on top */
+    HI_U32 u32PFrameLen;
+    HI_U32 u32SlicePacks;       /* packs a slice is split into, models the stream buffer wrap */
+    HI_U32 u32FrameRate;        /* pts step */
+}VENC_STUB_CFG_S;
+
+typedef struct hiVENC_STUB_STAT_S
+{
+    HI_U64 u64Posted;
+    HI_U64 u64Got;
+    HI_U64 u64Released;
+    HI_U64 u64Bytes;
+    HI_U64 u64QueryCalls;
+    HI_U64 u64GetCalls;
+}VENC_STUB_STAT_S;
+
+HI_S32 VENC_STUB_Init(HI_S32 s32ChnCnt, const VENC_STUB_CFG_S *pstCfg);
+HI_VOID VENC_STUB_Exit(HI_VOID);
+/* make u32Frames more frames of the channel ready, wakes its fd */
+HI_VOID VENC_STUB_Post(VENC_CHN VencChn, HI_U32 u32Frames);
+/* a vi picture reaches the channel: one more frame as VENC_STUB_Post if it is receiving, see HI_MPI_VENC_StartRecvPic(Ex) */
+HI_BOOL VENC_STUB_Picture(VENC_CHN VencChn);
+HI_U32 VENC_STUB_Pending(VENC_CHN VencChn);
+/* HI_TRUE: pts is the clock of HI_MPI_SYS_GetCurPts when the frame was posted, not seq / fps, until exit */
+HI_VOID VENC_STUB_SetClockPts(HI_BOOL bClockPts);
+/* HI_TRUE: the P frames carry the enRefType of a 3 layer svc-t stream, see VENC_STUB_RefType, until exit */
+HI_VOID VENC_STUB_SetSvct(HI_BOOL bSvct);
+HI_VOID VENC_STUB_GetStat(VENC_STUB_STAT_S *pstStat);
+
+#endif /* __VENC_STUB_H__ */
@@ -0,0 +1,311 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_svct_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/22
+  Description   : records a 3 layer svc-t h264 stream from the venc stub and
+                  plays it back through the temporal layer filter: what each
+                  consumer gets per layer, layer switches at base frames,
+                  late consumers, effective rates, and the temporal ids of
+                  the nal headers
+  History       :
+  1.Date        : 2016/04/22
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define TEST_FPS            30
+#define TEST_GOP            32
+#define TEST_FRAMES         320
+#define TEST_MAX_PACKS      8
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FUNCTION__, __LINE__, #cond); \
+            return HI_FAILURE; \
+        } \
+    } while (0)
+
+/* the recorded stream, packs pointing into one buffer */
+typedef struct hiTEST_FRAME_S
+{
+    VENC_STREAM_S stStream;
+    VENC_PACK_S astPack[TEST_MAX_PACKS];
+    HI_U32 u32Bytes;
+}TEST_FRAME_S;
+
+/* what a consumer got */
+typedef struct hiTEST_SINK_S
+{
+    HI_U32 u32Frames;
+    HI_U64 u64Bytes;
+    HI_BOOL abGot[TEST_FRAMES];
+}TEST_SINK_S;
+
+static TEST_FRAME_S s_astFrame[TEST_FRAMES];
+static HI_U8 *s_pu8Rec;
+
+static HI_S32 TEST_Record(HI_VOID)
+{
+    VENC_STUB_CFG_S stCfg;
+    VENC_PACK_S astPack[TEST_MAX_PACKS];
+    VENC_STREAM_S stStream;
+    TEST_FRAME_S *pstFrame;
+    HI_U32 u32Off = 0;
+    HI_U32 u32Len;
+    HI_U32 i;
+    HI_U32 j;
+
+    memset(&stCfg, 0, sizeof(stCfg));
+    stCfg.enType = PT_H264;
+    stCfg.u32Gop = TEST_GOP;
+    stCfg.u32IFrameLen = 16 * 1024;
+    stCfg.u32PFrameLen = 2 * 1024;
+    stCfg.u32SlicePacks = 2;
+    stCfg.u32FrameRate = TEST_FPS;
+    TEST_CHECK(HI_SUCCESS == VENC_STUB_Init(1, &stCfg));
+    VENC_STUB_SetSvct(HI_TRUE);
+    s_pu8Rec = (HI_U8 *)malloc(TEST_FRAMES * (stCfg.u32IFrameLen + 1024));
+    TEST_CHECK(NULL != s_pu8Rec);
+
+    VENC_STUB_Post(0, TEST_FRAMES);
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        memset(&stStream, 0, sizeof(stStream));
+        stStream.pstPack = astPack;
+        stStream.u32PackCount = TEST_MAX_PACKS;
+        TEST_CHECK(HI_SUCCESS == HI_MPI_VENC_GetStream(0, &stStream, 0));
+        TEST_CHECK(i == stStream.u32Seq);
+
+        pstFrame = &s_astFrame[i];
+        memcpy(&pstFrame->stStream, &stStream, sizeof(VENC_STREAM_S));
+        pstFrame->stStream.pstPack = pstFrame->astPack;
+        pstFrame->u32Bytes = 0;
+        for (j = 0; j < stStream.u32PackCount; j++)
+        {
+            u32Len = astPack[j].u32Len - astPack[j].u32Offset;
+            memcpy(s_pu8Rec + u32Off, astPack[j].pu8Addr + astPack[j].u32Offset, u32Len);
+            memcpy(&pstFrame->astPack[j], &astPack[j], sizeof(VENC_PACK_S));
+            pstFrame->astPack[j].pu8Addr = s_pu8Rec + u32Off;
+            pstFrame->astPack[j].u32Offset = 0;
+            pstFrame->astPack[j].u32Len = u32Len;
+            pstFrame->u32Bytes += u32Len;
+            u32Off += u32Len;
+        }
+        HI_MPI_VENC_ReleaseStream(0, &stStream);
+    }
+    VENC_STUB_Exit();
+    return HI_SUCCESS;
+}
+
+/* layer of the recorded frame, from the pattern of the stub */
+static HI_U32 TEST_Layer(HI_U32 u32Seq)
+{
+    return (0 == u32Seq % 4) ? 0 : (0 == u32Seq % 2) ? 1 : 2;
+}
+
+static HI_S32 TEST_SinkProc(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    TEST_SINK_S *pstSink = (TEST_SINK_S *)pPrivate;
+    HI_U32 i;
+
+    pstSink->u32Frames++;
+    pstSink->abGot[pstStream->u32Seq] = HI_TRUE;
+    for (i = 0; i < pstStream->u32PackCount; i++)
+    {
+        pstSink->u64Bytes += pstStream->pstPack[i].u32Len - pstStream->pstPack[i].u32Offset;
+    }
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Open(HI_VOID)
+{
+    SAMPLE_VENC_SVCT_ATTR_S stAttr;
+
+    stAttr.enType = PT_H264;
+    stAttr.u32WindowMs = 1000;
+    return SAMPLE_COMM_VENC_SvctCreate(0, &stAttr);
+}
+
+static HI_S32 TEST_Add(HI_U32 u32MaxLayer, TEST_SINK_S *pstSink, HI_S32 *ps32Id)
+{
+    SAMPLE_VENC_SVCT_CONSUMER_S stConsumer;
+
+    memset(pstSink, 0, sizeof(TEST_SINK_S));
+    stConsumer.u32MaxLayer = u32MaxLayer;
+    stConsumer.pfnStreamProc = TEST_SinkProc;
+    stConsumer.pPrivate = pstSink;
+    return SAMPLE_COMM_VENC_SvctAddConsumer(0, &stConsumer, ps32Id);
+}
+
+static HI_VOID TEST_Play(HI_U32 u32From, HI_U32 u32To)
+{
+    HI_U32 i;
+
+    for (i = u32From; i < u32To; i++)
+    {
+        SAMPLE_COMM_VENC_SvctStream(0, &s_astFrame[i].stStream, NULL);
+    }
+}
+
+/* one consumer per layer over the whole recording */
+static HI_S32 TEST_Layers(HI_VOID)
+{
+    static TEST_SINK_S astSink[SAMPLE_VENC_SVCT_MAX_CONSUMER];
+    SAMPLE_VENC_SVCT_STAT_S stStat;
+    HI_U32 au32Fps100[] = {750, 1500, 3000};
+    HI_U32 au32Kbps[3];
+    HI_S32 as32Id[3];
+    HI_U64 u64Bytes;
+    HI_U32 u32Frames;
+    HI_U32 u32Layer;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_Open());
+    for (u32Layer = 0; u32Layer < 3; u32Layer++)
+    {
+        TEST_CHECK(HI_SUCCESS == TEST_Add(u32Layer, &astSink[u32Layer], &as32Id[u32Layer]));
+    }
+    TEST_Play(0, TEST_FRAMES);
+
+    for (u32Layer = 0; u32Layer < 3; u32Layer++)
+    {
+        u64Bytes = 0;
+        u32Frames = 0;
+        for (i = 0; i < TEST_FRAMES; i++)
+        {
+            TEST_CHECK(TEST_Layer(i) == SAMPLE_COMM_VENC_GetSvctLayer(PT_H264, &s_astFrame[i].stStream));
+            TEST_CHECK(astSink[u32Layer].abGot[i] == ((TEST_Layer(i) <= u32Layer) ? HI_TRUE : HI_FALSE));
+            if (TEST_Layer(i) <= u32Layer)
+            {
+                u64Bytes += s_astFrame[i].u32Bytes;
+                u32Frames++;
+            }
+        }
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_SvctGetStat(0, as32Id[u32Layer], &stStat));
+        TEST_CHECK((u32Frames == stStat.u64Frames) && (u32Frames == astSink[u32Layer].u32Frames));
+        TEST_CHECK((u64Bytes == stStat.u64Bytes) && (u64Bytes == astSink[u32Layer].u64Bytes));
+        TEST_CHECK(TEST_FRAMES - u32Frames == stStat.u64Dropped);
+        TEST_CHECK((stStat.u32Fps100 + 1 >= au32Fps100[u32Layer]) && (stStat.u32Fps100 <= au32Fps100[u32Layer] + 1));
+        TEST_CHECK((0 == stStat.u32Switches) && (0 == stStat.u32ProcErrs));
+        au32Kbps[u32Layer] = stStat.u32Kbps;
+        printf("layer %u: %u frames, %llu bytes, %u.%02u fps, %u kbps\n", u32Layer, u32Frames,
+               (unsigned long long)u64Bytes, stStat.u32Fps100 / 100, stStat.u32Fps100 % 100, stStat.u32Kbps);
+    }
+    TEST_CHECK((0 < au32Kbps[0]) && (au32Kbps[0] < au32Kbps[1]) && (au32Kbps[1] < au32Kbps[2]));
+
+    SAMPLE_COMM_VENC_SvctDestroy(0);
+    printf("layers: ok\n");
+    return HI_SUCCESS;
+}
+
+/* layer changes wait for a base frame, late consumers for a key frame, removed ones get nothing */
+static HI_S32 TEST_Switch(HI_VOID)
+{
+    static TEST_SINK_S stUp;
+    static TEST_SINK_S stLate;
+    SAMPLE_VENC_SVCT_STAT_S stStat;
+    HI_S32 s32Up;
+    HI_S32 s32Late;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_Open());
+    TEST_CHECK(HI_SUCCESS == TEST_Add(0, &stUp, &s32Up));
+    TEST_Play(0, 37);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_SvctSetLayer(0, s32Up, 2));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_SvctGetStat(0, s32Up, &stStat));
+    TEST_CHECK((0 == stStat.u32MaxLayer) && (2 == stStat.u32PendingLayer));
+    TEST_Play(37, 50);
+    TEST_CHECK(HI_SUCCESS == TEST_Add(2, &stLate, &s32Late));
+    TEST_Play(50, 101);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_SvctSetLayer(0, s32Up, 1));
+    TEST_Play(101, 200);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_SvctRemoveConsumer(0, s32Late));
+    TEST_Play(200, TEST_FRAMES);
+
+    /* up from 0 to 2 at frame 40, down from 2 to 1 at frame 104 */
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        TEST_CHECK(stUp.abGot[i] == ((TEST_Layer(i) <= ((i < 40) ? 0 : (i < 104) ? 2 : 1)) ? HI_TRUE : HI_FALSE));
+        TEST_CHECK(stLate.abGot[i] == (((i >= 64) && (i < 200)) ? HI_TRUE : HI_FALSE));
+    }
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_SvctGetStat(0, s32Up, &stStat));
+    TEST_CHECK((2 == stStat.u32Switches) && (1 == stStat.u32MaxLayer) && (1 == stStat.u32PendingLayer));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VENC_SvctGetStat(0, s32Late, &stStat));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VENC_SvctSetLayer(0, s32Late, 0));
+
+    SAMPLE_COMM_VENC_SvctDestroy(0);
+    printf("switch: ok\n");
+    return HI_SUCCESS;
+}
+
+/* temporal ids in the nal headers win over the ref type */
+static HI_S32 TEST_NalLayer(HI_VOID)
+{
+    HI_U8 au8Prefix[] = {0, 0, 0, 1, 0x6E, 0xC0, 0x00, 0x40, 0x00};        /* prefix nal, temporal_id 2 */
+    HI_U8 au8Slice[] = {0, 0, 0, 1, 0x41, 0x9A, 0x00};
+    HI_U8 au8H265[] = {0, 0, 0, 1, 0x02, 0x02, 0xAF, 0x00};                /* TRAIL_R, temporal_id 1 */
+    HI_U8 au8H265Base[] = {0, 0, 0, 1, 0x02, 0x01, 0xAF, 0x00};
+    VENC_PACK_S astPack[2];
+    VENC_STREAM_S stStream;
+
+    memset(&stStream, 0, sizeof(stStream));
+    memset(astPack, 0, sizeof(astPack));
+    stStream.pstPack = astPack;
+    astPack[0].pu8Addr = au8Prefix;
+    astPack[0].u32Len = sizeof(au8Prefix);
+    astPack[1].pu8Addr = au8Slice;
+    astPack[1].u32Len = sizeof(au8Slice);
+    stStream.u32PackCount = 2;
+    stStream.stH264Info.enRefType = BASE_PSLICE_REFBYBASE;
+    TEST_CHECK(2 == SAMPLE_COMM_VENC_GetSvctLayer(PT_H264, &stStream));
+    stStream.pstPack = &astPack[1];
+    stStream.u32PackCount = 1;
+    TEST_CHECK(0 == SAMPLE_COMM_VENC_GetSvctLayer(PT_H264, &stStream));
+    stStream.stH264Info.enRefType = BASE_PSLICE_REFBYENHANCE;
+    TEST_CHECK(1 == SAMPLE_COMM_VENC_GetSvctLayer(PT_H264, &stStream));
+
+    astPack[1].pu8Addr = au8H265;
+    astPack[1].u32Len = sizeof(au8H265);
+    stStream.stH265Info.enRefType = BASE_PSLICE_REFBYBASE;
+    TEST_CHECK(1 == SAMPLE_COMM_VENC_GetSvctLayer(PT_H265, &stStream));
+    astPack[1].pu8Addr = au8H265Base;
+    stStream.stH265Info.enRefType = ENHANCE_PSLICE_NOTFORREF;
+    TEST_CHECK(2 == SAMPLE_COMM_VENC_GetSvctLayer(PT_H265, &stStream));
+    TEST_CHECK(0 == SAMPLE_COMM_VENC_GetSvctLayer(PT_JPEG, &stStream));
+
+    printf("nal layer: ok\n");
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    if (HI_SUCCESS != TEST_Record())
+    {
+        printf("FAIL\n");
+        return 1;
+    }
+    s32Ret |= TEST_Layers();
+    s32Ret |= TEST_Switch();
+    s32Ret |= TEST_NalLayer();
+    free(s_pu8Rec);
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
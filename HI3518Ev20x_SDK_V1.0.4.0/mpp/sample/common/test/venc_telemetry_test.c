@@ -0,0 +1,327 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_telemetry_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/20
+  Description   : feeds the canned h264 stream of the venc stub through the
+                  telemetry and checks the windowed figures against a plain
+                  recount of the frames, then the latency histogram on clock
+                  pts, and measures the cost per frame of the stream path
+  History       :
+  1.Date        : 2016/04/20
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+#define TEST_FPS            30
+#define TEST_GOP            30
+#define TEST_FRAMES         600
+#define TEST_SHORT_MS       1000
+#define TEST_LONG_MS        10000
+#define TEST_PERIOD         8
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FUNCTION__, __LINE__, #cond); \
+            return HI_FAILURE; \
+        } \
+    } while (0)
+
+static HI_U64 s_au64Pts[TEST_FRAMES];
+static HI_U32 s_au32Bytes[TEST_FRAMES];
+static HI_U32 s_au32Qp[TEST_FRAMES];
+static HI_BOOL s_abKey[TEST_FRAMES];
+
+static HI_U64 TEST_NowNs(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000000 + stTs.tv_nsec;
+}
+
+static HI_S32 TEST_StubInit(HI_VOID)
+{
+    VENC_STUB_CFG_S stCfg;
+
+    memset(&stCfg, 0, sizeof(stCfg));
+    stCfg.enType = PT_H264;
+    stCfg.u32Gop = TEST_GOP;
+    stCfg.u32IFrameLen = 24 * 1024;
+    stCfg.u32PFrameLen = 3 * 1024;
+    stCfg.u32SlicePacks = 2;
+    stCfg.u32FrameRate = TEST_FPS;
+    return VENC_STUB_Init(1, &stCfg);
+}
+
+static HI_S32 TEST_Create(HI_VOID)
+{
+    SAMPLE_VENC_TELEMETRY_ATTR_S stAttr;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.enType = PT_H264;
+    stAttr.u32ShortMs = TEST_SHORT_MS;
+    stAttr.u32LongMs = TEST_LONG_MS;
+    stAttr.u32MaxFrames = TEST_FPS * TEST_LONG_MS / 1000 + TEST_FPS;
+    stAttr.u32BacklogPeriod = TEST_PERIOD;
+    return SAMPLE_COMM_VENC_TelemetryCreate(0, &stAttr);
+}
+
+/* takes one frame out of the stub, records it and hands it to the telemetry */
+static HI_S32 TEST_Take(HI_U32 u32Frame)
+{
+    VENC_PACK_S astPack[16];
+    VENC_STREAM_S stStream;
+    HI_U32 i;
+
+    memset(&stStream, 0, sizeof(stStream));
+    stStream.pstPack = astPack;
+    stStream.u32PackCount = 16;
+    if (HI_SUCCESS != HI_MPI_VENC_GetStream(0, &stStream, 0))
+    {
+        return HI_FAILURE;
+    }
+    if (u32Frame < TEST_FRAMES)
+    {
+        s_au64Pts[u32Frame] = astPack[0].u64PTS;
+        s_au32Bytes[u32Frame] = 0;
+        for (i = 0; i < stStream.u32PackCount; i++)
+        {
+            s_au32Bytes[u32Frame] += astPack[i].u32Len - astPack[i].u32Offset;
+        }
+        s_au32Qp[u32Frame] = stStream.stH264Info.u32StartQp;
+        s_abKey[u32Frame] = (BASE_IDRSLICE == stStream.stH264Info.enRefType) ? HI_TRUE : HI_FALSE;
+    }
+    SAMPLE_COMM_VENC_TelemetryStream(0, &stStream, NULL);
+    HI_MPI_VENC_ReleaseStream(0, &stStream);
+    return HI_SUCCESS;
+}
+
+/* first frame of the window of u32Ms ending at the last frame, the anchor is the one before */
+static HI_U32 TEST_WindowStart(HI_U32 u32Ms)
+{
+    HI_U32 u32Last = TEST_FRAMES - 1;
+    HI_U32 i = u32Last;
+
+    while ((i > 0) && (s_au64Pts[u32Last] - s_au64Pts[i - 1] < (HI_U64)u32Ms * 1000))
+    {
+        i--;
+    }
+    return (0 == i) ? 1 : i;
+}
+
+static HI_S32 TEST_Figures(HI_VOID)
+{
+    SAMPLE_VENC_TELEMETRY_STAT_S stStat;
+    HI_U64 u64Bytes = 0;
+    HI_U64 u64IBytes = 0;
+    HI_U64 u64PBytes = 0;
+    HI_U32 u32IFrames = 0;
+    HI_U32 u32QpSum = 0;
+    HI_U32 u32Start;
+    HI_U32 u32Sum;
+    HI_U32 u32Backlog = 0;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_StubInit());
+    TEST_CHECK(HI_SUCCESS == TEST_Create());
+    VENC_STUB_Post(0, TEST_FRAMES);
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == TEST_Take(i));
+    }
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_TelemetryGetStat(0, &stStat));
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        u64Bytes += s_au32Bytes[i];
+    }
+    TEST_CHECK(TEST_FRAMES == stStat.u64Frames);
+    TEST_CHECK(u64Bytes == stStat.u64Bytes);
+    TEST_CHECK(stStat.u32AvgKbps == (HI_U32)((u64Bytes - s_au32Bytes[0]) * 8000 / (s_au64Pts[TEST_FRAMES - 1] - s_au64Pts[0])));
+
+    u32Start = TEST_WindowStart(TEST_SHORT_MS);
+    TEST_CHECK(TEST_FRAMES - u32Start == TEST_FPS);
+    for (u64Bytes = 0, i = u32Start; i < TEST_FRAMES; i++)
+    {
+        u64Bytes += s_au32Bytes[i];
+    }
+    TEST_CHECK(stStat.u32ShortKbps == (HI_U32)(u64Bytes * 8000 / (s_au64Pts[TEST_FRAMES - 1] - s_au64Pts[u32Start - 1])));
+    TEST_CHECK((stStat.u32ShortFps100 >= TEST_FPS * 100 - 1) && (stStat.u32ShortFps100 <= TEST_FPS * 100 + 1));
+
+    u32Start = TEST_WindowStart(TEST_LONG_MS);
+    TEST_CHECK(TEST_FRAMES - u32Start == TEST_FPS * TEST_LONG_MS / 1000);
+    for (u64Bytes = 0, i = u32Start; i < TEST_FRAMES; i++)
+    {
+        u64Bytes += s_au32Bytes[i];
+        u32QpSum += s_au32Qp[i];
+        if (HI_TRUE == s_abKey[i])
+        {
+            u64IBytes += s_au32Bytes[i];
+            u32IFrames++;
+        }
+        else
+        {
+            u64PBytes += s_au32Bytes[i];
+        }
+        if (0 == i % TEST_PERIOD)
+        {
+            u32Backlog = (TEST_FRAMES - 1 - i > u32Backlog) ? TEST_FRAMES - 1 - i : u32Backlog;
+        }
+    }
+    TEST_CHECK(stStat.u32LongKbps == (HI_U32)(u64Bytes * 8000 / (s_au64Pts[TEST_FRAMES - 1] - s_au64Pts[u32Start - 1])));
+    TEST_CHECK(stStat.u32IFrameBytesAvg == u64IBytes / u32IFrames);
+    TEST_CHECK(stStat.u32PFrameBytesAvg == u64PBytes / (TEST_FRAMES - u32Start - u32IFrames));
+    TEST_CHECK(stStat.u32IFrameBytesLast == s_au32Bytes[(TEST_FRAMES - 1) / TEST_GOP * TEST_GOP]);
+    TEST_CHECK(stStat.u32PFrameBytesLast == s_au32Bytes[TEST_FRAMES - 1]);
+    TEST_CHECK(stStat.u32QpAvg100 == u32QpSum * 100 / (TEST_FRAMES - u32Start));
+    TEST_CHECK(stStat.u32QpLast == s_au32Qp[TEST_FRAMES - 1]);
+    TEST_CHECK((VENC_STUB_I_QP == stStat.u32QpMin) && (VENC_STUB_P_QP + 4 == stStat.u32QpMax));
+    TEST_CHECK(stStat.u32BacklogMax == u32Backlog);
+    TEST_CHECK(stStat.u32BacklogLast == TEST_FRAMES - 1 - (TEST_FRAMES - 1) / TEST_PERIOD * TEST_PERIOD);
+
+    TEST_CHECK((TEST_GOP == stStat.u32GopFrames) && (TEST_GOP == stStat.u32GopFramesMin) && (TEST_GOP == stStat.u32GopFramesMax));
+    TEST_CHECK(TEST_FRAMES / TEST_GOP - 1 == stStat.u32Gops);
+    for (u32Sum = 0, i = 0; i < SAMPLE_VENC_TELEMETRY_HIST_NUM; i++)
+    {
+        u32Sum += stStat.au32LatencyHist[i];
+    }
+    TEST_CHECK(TEST_FRAMES == u32Sum);
+    /* 24 KB I slices from 16 KB up, 3 KB P slices from 2 KB up */
+    TEST_CHECK(TEST_FRAMES / TEST_GOP == stStat.au32IFrameHist[5]);
+    TEST_CHECK(TEST_FRAMES - TEST_FRAMES / TEST_GOP == stStat.au32PFrameHist[2]);
+
+    printf("figures: %u/%u/%u kbps, I %u B, P %u B, qp %u.%02u, backlog max %u: ok\n",
+           stStat.u32ShortKbps, stStat.u32LongKbps, stStat.u32AvgKbps, stStat.u32IFrameBytesAvg,
+           stStat.u32PFrameBytesAvg, stStat.u32QpAvg100 / 100, stStat.u32QpAvg100 % 100, stStat.u32BacklogMax);
+    SAMPLE_COMM_VENC_TelemetryDestroy(0);
+    VENC_STUB_Exit();
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Latency(HI_VOID)
+{
+    SAMPLE_VENC_TELEMETRY_STAT_S stStat;
+    HI_U32 u32Slow = 0;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_StubInit());
+    VENC_STUB_SetClockPts(HI_TRUE);
+    TEST_CHECK(HI_SUCCESS == TEST_Create());
+    for (i = 0; i < 20; i++)
+    {
+        VENC_STUB_Post(0, 1);
+        usleep(2500);
+        TEST_CHECK(HI_SUCCESS == TEST_Take(TEST_FRAMES));
+    }
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_TelemetryGetStat(0, &stStat));
+    TEST_CHECK(0 == stStat.au32LatencyHist[0] + stStat.au32LatencyHist[1]);
+    for (i = 3; i < SAMPLE_VENC_TELEMETRY_HIST_NUM; i++)
+    {
+        u32Slow += stStat.au32LatencyHist[i];
+    }
+    TEST_CHECK(20 == stStat.au32LatencyHist[2] + u32Slow);
+    TEST_CHECK((stStat.u32LatencyUsAvg >= 2500) && (stStat.u32LatencyUsMax >= stStat.u32LatencyUsAvg));
+    printf("latency: avg %u us, max %u us, %u of 20 in 2-4 ms: ok\n",
+           stStat.u32LatencyUsAvg, stStat.u32LatencyUsMax, stStat.au32LatencyHist[2]);
+    SAMPLE_COMM_VENC_TelemetryDestroy(0);
+    VENC_STUB_Exit();
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Export(HI_VOID)
+{
+    HI_CHAR szLine[1024];
+    HI_S32 s32Len;
+
+    TEST_CHECK(HI_SUCCESS == TEST_StubInit());
+    TEST_CHECK(HI_SUCCESS == TEST_Create());
+    VENC_STUB_Post(0, 3 * TEST_GOP + 1);
+    while (0 != VENC_STUB_Pending(0))
+    {
+        TEST_CHECK(HI_SUCCESS == TEST_Take(TEST_FRAMES));
+    }
+    s32Len = SAMPLE_COMM_VENC_TelemetryExport(0, szLine, sizeof(szLine));
+    TEST_CHECK((s32Len > 0) && ((HI_U32)s32Len == strlen(szLine)) && ('\n' == szLine[s32Len - 1]));
+    TEST_CHECK(NULL != strstr(szLine, "frames=91 "));
+    TEST_CHECK(NULL != strstr(szLine, " gop=30/30/30/3 "));
+    TEST_CHECK(NULL != strstr(szLine, " ih=0,0,0,0,0,4,0,"));
+    printf("export: %s", szLine);
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VENC_TelemetryExport(0, szLine, s32Len));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VENC_TelemetryExport(0, szLine, 64));
+    SAMPLE_COMM_VENC_TelemetryDestroy(0);
+    VENC_STUB_Exit();
+    return HI_SUCCESS;
+}
+
+/* cost of the stream path on one frame handed in over and over, and of a full read */
+static HI_S32 TEST_Cost(HI_U32 u32Loops)
+{
+    SAMPLE_VENC_TELEMETRY_STAT_S stStat;
+    VENC_PACK_S astPack[16];
+    VENC_STREAM_S stStream;
+    HI_U64 u64Start;
+    HI_U64 u64StreamNs;
+    HI_U64 u64StatNs;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_StubInit());
+    TEST_CHECK(HI_SUCCESS == TEST_Create());
+    VENC_STUB_Post(0, 2);
+    memset(&stStream, 0, sizeof(stStream));
+    stStream.pstPack = astPack;
+    stStream.u32PackCount = 16;
+    TEST_CHECK(HI_SUCCESS == HI_MPI_VENC_GetStream(0, &stStream, 0));
+
+    u64Start = TEST_NowNs();
+    for (i = 0; i < u32Loops; i++)
+    {
+        astPack[0].u64PTS = (HI_U64)i * 1000000 / TEST_FPS;
+        SAMPLE_COMM_VENC_TelemetryStream(0, &stStream, NULL);
+    }
+    u64StreamNs = (TEST_NowNs() - u64Start) / u32Loops;
+
+    u64Start = TEST_NowNs();
+    for (i = 0; i < 1000; i++)
+    {
+        SAMPLE_COMM_VENC_TelemetryGetStat(0, &stStat);
+    }
+    u64StatNs = (TEST_NowNs() - u64Start) / 1000;
+
+    HI_MPI_VENC_ReleaseStream(0, &stStream);
+    SAMPLE_COMM_VENC_TelemetryDestroy(0);
+    VENC_STUB_Exit();
+    printf("cost: %llu ns per frame, %llu ns per full read of a %u frame window\n",
+           (unsigned long long)u64StreamNs, (unsigned long long)u64StatNs, TEST_FPS * TEST_LONG_MS / 1000);
+    TEST_CHECK(u64StreamNs < 5000);
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    s32Ret |= TEST_Figures();
+    s32Ret |= TEST_Latency();
+    s32Ret |= TEST_Export();
+    s32Ret |= TEST_Cost((argc > 1) ? atoi(argv[1]) : 1000000);
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
@@ -0,0 +1,373 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_writer_bench.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/21
+  Description   : record throughput and worst collector stall of
+                  SAMPLE_COMM_VENC_SaveStream against the asynchronous writer,
+                  buffered and o_direct, into files of the given directory
+                  (a tmpfs or a loop device mount)
+  History       :
+  1.Date        : 2016/03/21
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "sample_comm.h"
+#include "venc_stub.h"
+
+/* the fwrite + fflush per pack path of the sample get stream thread */
+HI_S32 SAMPLE_COMM_VENC_SaveStream(PAYLOAD_TYPE_E enType, FILE *pFd, VENC_STREAM_S *pstStream);
+
+#define BENCH_MODE_STDIO    0
+#define BENCH_MODE_WRITER   1
+#define BENCH_MODE_DIRECT   2
+#define BENCH_MODE_NUM      3
+
+static const HI_CHAR *s_apszMode[BENCH_MODE_NUM] = {"savestream", "writer", "writer direct"};
+
+static HI_S32 s_s32ChnCnt = 4;
+static HI_U32 s_u32Fps = 120;
+static HI_S32 s_s32Mode;
+static FILE *s_apFile[VENC_MAX_CHN_NUM];
+static HI_U64 s_u64StallMaxUs;
+static volatile HI_BOOL s_bFeed;
+
+static HI_U64 BENCH_NowUs(HI_VOID)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return (HI_U64)stNow.tv_sec * 1000000 + stNow.tv_nsec / 1000;
+}
+
+/* every frame passes here on the collector thread, so its longest call is the worst stall */
+static HI_S32 BENCH_StreamProc(VENC_CHN VencChn, const VENC_STREAM_S *pstStream, HI_VOID *pPrivate)
+{
+    HI_U64 u64Start = BENCH_NowUs();
+    HI_S32 s32Ret;
+
+    if (BENCH_MODE_STDIO == s_s32Mode)
+    {
+        s32Ret = SAMPLE_COMM_VENC_SaveStream(PT_H264, s_apFile[VencChn], (VENC_STREAM_S *)pstStream);
+    }
+    else
+    {
+        s32Ret = SAMPLE_COMM_VENC_WriterStream(VencChn, pstStream, pPrivate);
+    }
+    u64Start = BENCH_NowUs() - u64Start;
+    if (u64Start > s_u64StallMaxUs)
+    {
+        s_u64StallMaxUs = u64Start;
+    }
+    return s32Ret;
+}
+
+static HI_VOID *BENCH_FeedProc(HI_VOID *p)
+{
+    struct timespec stNext;
+    HI_S32 i;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNext);
+    while (s_bFeed)
+    {
+        for (i = 0; i < s_s32ChnCnt; i++)
+        {
+            VENC_STUB_Post(i, 1);
+        }
+        stNext.tv_nsec += 1000000000 / s_u32Fps;
+        if (stNext.tv_nsec >= 1000000000)
+        {
+            stNext.tv_nsec -= 1000000000;
+            stNext.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &stNext, NULL);
+    }
+    return NULL;
+}
+
+static HI_BOOL BENCH_Drained(HI_VOID)
+{
+    HI_S32 i;
+
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        if (0 != VENC_STUB_Pending(i))
+        {
+            return HI_FALSE;
+        }
+    }
+    return HI_TRUE;
+}
+
+static HI_S32 BENCH_Open(HI_S32 s32Mode, HI_BOOL bSync)
+{
+    SAMPLE_VENC_WRITER_ATTR_S stAttr;
+    HI_CHAR szName[64];
+    HI_S32 i;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    stAttr.enType = PT_H264;
+    stAttr.u32BufSize = 512 * 1024;
+    stAttr.u32BufCnt = 8;
+    stAttr.bDirect = (BENCH_MODE_DIRECT == s32Mode) ? HI_TRUE : HI_FALSE;
+    stAttr.enSync = (HI_TRUE == bSync) ? SAMPLE_VENC_WRITER_SYNC_PERIOD : SAMPLE_VENC_WRITER_SYNC_CLOSE;
+    stAttr.u32SyncParam = 1000;
+
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        snprintf(szName, sizeof(szName), "record_%d_chn%d.h264", s32Mode, i);
+        if (BENCH_MODE_STDIO == s32Mode)
+        {
+            s_apFile[i] = fopen(szName, "wb");
+            if (NULL == s_apFile[i])
+            {
+                return HI_FAILURE;
+            }
+        }
+        else if (HI_SUCCESS != SAMPLE_COMM_VENC_WriterOpen(i, szName, &stAttr))
+        {
+            return HI_FAILURE;
+        }
+    }
+    return HI_SUCCESS;
+}
+
+static HI_VOID BENCH_Close(HI_S32 s32Mode, SAMPLE_VENC_WRITER_STAT_S *pstStat)
+{
+    SAMPLE_VENC_WRITER_STAT_S stStat;
+    HI_S32 i;
+
+    memset(pstStat, 0, sizeof(SAMPLE_VENC_WRITER_STAT_S));
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        if (BENCH_MODE_STDIO == s32Mode)
+        {
+            fflush(s_apFile[i]);
+            fdatasync(fileno(s_apFile[i]));
+            fclose(s_apFile[i]);
+            continue;
+        }
+        SAMPLE_COMM_VENC_WriterClose(i);
+        SAMPLE_COMM_VENC_WriterGetStat(i, &stStat);
+        pstStat->u64Written += stStat.u64Written;
+        pstStat->u32Stalls += stStat.u32Stalls;
+        pstStat->u32WriteErrs += stStat.u32WriteErrs;
+        pstStat->u32Syncs += stStat.u32Syncs;
+        pstStat->bDirect = stStat.bDirect;
+        if (stStat.u32QueueMax > pstStat->u32QueueMax)
+        {
+            pstStat->u32QueueMax = stStat.u32QueueMax;
+        }
+    }
+}
+
+static HI_VOID BENCH_Collect(HI_VOID)
+{
+    SAMPLE_VENC_COLLECT_CHN_S astChn[VENC_MAX_CHN_NUM];
+    HI_S32 i;
+
+    for (i = 0; i < s_s32ChnCnt; i++)
+    {
+        astChn[i].VencChn = i;
+        astChn[i].s32OutFd = -1;
+        astChn[i].pfnStreamProc = BENCH_StreamProc;
+        astChn[i].pPrivate = NULL;
+    }
+    SAMPLE_COMM_VENC_StartCollect(astChn, s_s32ChnCnt);
+}
+
+static HI_VOID BENCH_WaitDrained(HI_VOID)
+{
+    while (HI_TRUE != BENCH_Drained())
+    {
+        usleep(1000);
+    }
+}
+
+/* the canned frames are the same for every mode, so are the files */
+static HI_S32 BENCH_CheckFiles(HI_S32 s32Mode)
+{
+    HI_CHAR szName[64];
+    HI_U8 au8A[65536];
+    HI_U8 au8B[65536];
+    FILE *pA;
+    FILE *pB;
+    size_t lenA;
+    size_t lenB;
+    HI_S32 i;
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    for (i = 0; (i < s_s32ChnCnt) && (HI_SUCCESS == s32Ret); i++)
+    {
+        snprintf(szName, sizeof(szName), "record_%d_chn%d.h264", BENCH_MODE_STDIO, i);
+        pA = fopen(szName, "rb");
+        snprintf(szName, sizeof(szName), "record_%d_chn%d.h264", s32Mode, i);
+        pB = fopen(szName, "rb");
+        if ((NULL == pA) || (NULL == pB))
+        {
+            s32Ret = HI_FAILURE;
+        }
+        while (HI_SUCCESS == s32Ret)
+        {
+            lenA = fread(au8A, 1, sizeof(au8A), pA);
+            lenB = fread(au8B, 1, sizeof(au8B), pB);
+            if ((lenA != lenB) || (0 != memcmp(au8A, au8B, lenA)))
+            {
+                printf("chn %d: %s file differs from %s\n", i, s_apszMode[s32Mode], s_apszMode[BENCH_MODE_STDIO]);
+                s32Ret = HI_FAILURE;
+            }
+            if (0 == lenA)
+            {
+                break;
+            }
+        }
+        if (NULL != pA)
+        {
+            fclose(pA);
+        }
+        if (NULL != pB)
+        {
+            fclose(pB);
+        }
+    }
+    return s32Ret;
+}
+
+static HI_VOID BENCH_Unlink(HI_VOID)
+{
+    HI_CHAR szName[64];
+    HI_S32 s32Mode;
+    HI_S32 i;
+
+    for (s32Mode = 0; s32Mode < BENCH_MODE_NUM; s32Mode++)
+    {
+        for (i = 0; i < s_s32ChnCnt; i++)
+        {
+            snprintf(szName, sizeof(szName), "record_%d_chn%d.h264", s32Mode, i);
+            unlink(szName);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    VENC_STUB_CFG_S stCfg;
+    VENC_STUB_STAT_S stStart;
+    VENC_STUB_STAT_S stEnd;
+    SAMPLE_VENC_WRITER_STAT_S stStat;
+    pthread_t FeedPid;
+    HI_U64 u64Start;
+    HI_DOUBLE dMB;
+    HI_U32 u32Secs = 3;
+    HI_U32 u32Burst = 3000;
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_S32 i;
+
+    if ((argc > 1) && (0 != chdir(argv[1])))
+    {
+        printf("usage: %s [dir] [chn(1-16)] [secs] [fps]\n", argv[0]);
+        return -1;
+    }
+    if (argc > 2)
+    {
+        s_s32ChnCnt = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        u32Secs = atoi(argv[3]);
+    }
+    if (argc > 4)
+    {
+        s_u32Fps = atoi(argv[4]);
+    }
+    if ((s_s32ChnCnt <= 0) || (s_s32ChnCnt > VENC_MAX_CHN_NUM) || (0 == s_u32Fps))
+    {
+        printf("usage: %s [dir] [chn(1-16)] [secs] [fps]\n", argv[0]);
+        return -1;
+    }
+
+    /* ~4 Mbit/s at 30 fps, gop 30 */
+    stCfg.enType = PT_H264;
+    stCfg.u32Gop = 30;
+    stCfg.u32IFrameLen = 120 * 1024;
+    stCfg.u32PFrameLen = 12 * 1024;
+    stCfg.u32SlicePacks = 2;
+    stCfg.u32FrameRate = 30;
+
+    printf("paced: %d chn x %u fps for %u s, fdatasync every 1 s; burst: %u frames per chn\n",
+           s_s32ChnCnt, s_u32Fps, u32Secs, u32Burst);
+    printf("%-14s %12s %14s %10s %8s %8s\n", "path", "paced MB/s", "max stall us", "burst MB/s", "queue", "stalls");
+    for (s_s32Mode = 0; s_s32Mode < BENCH_MODE_NUM; s_s32Mode++)
+    {
+        /* paced at the given frame rate: how long the collector is held per frame */
+        VENC_STUB_Init(s_s32ChnCnt, &stCfg);
+        if (HI_SUCCESS != BENCH_Open(s_s32Mode, HI_TRUE))
+        {
+            printf("open record files failed\n");
+            return -1;
+        }
+        s_u64StallMaxUs = 0;
+        VENC_STUB_GetStat(&stStart);
+        u64Start = BENCH_NowUs();
+        BENCH_Collect();
+        s_bFeed = HI_TRUE;
+        pthread_create(&FeedPid, NULL, BENCH_FeedProc, NULL);
+        sleep(u32Secs);
+        s_bFeed = HI_FALSE;
+        pthread_join(FeedPid, NULL);
+        BENCH_WaitDrained();
+        SAMPLE_COMM_VENC_StopCollect();
+        BENCH_Close(s_s32Mode, &stStat);
+        VENC_STUB_GetStat(&stEnd);
+        VENC_STUB_Exit();
+        printf("%-14s %12.1f %14llu", s_apszMode[s_s32Mode],
+               (stEnd.u64Bytes - stStart.u64Bytes) / (HI_DOUBLE)(BENCH_NowUs() - u64Start),
+               s_u64StallMaxUs);
+
+        /* every frame queued up front: how fast the path gets it to storage */
+        VENC_STUB_Init(s_s32ChnCnt, &stCfg);
+        BENCH_Open(s_s32Mode, HI_FALSE);
+        for (i = 0; i < s_s32ChnCnt; i++)
+        {
+            VENC_STUB_Post(i, u32Burst);
+        }
+        VENC_STUB_GetStat(&stStart);
+        u64Start = BENCH_NowUs();
+        BENCH_Collect();
+        BENCH_WaitDrained();
+        SAMPLE_COMM_VENC_StopCollect();
+        BENCH_Close(s_s32Mode, &stStat);
+        VENC_STUB_GetStat(&stEnd);
+        VENC_STUB_Exit();
+        dMB = (stEnd.u64Bytes - stStart.u64Bytes) / (HI_DOUBLE)(BENCH_NowUs() - u64Start);
+        if (BENCH_MODE_STDIO == s_s32Mode)
+        {
+            printf(" %10.1f %8s %8s\n", dMB, "-", "-");
+            continue;
+        }
+        printf(" %10.1f %8u %8u%s\n", dMB, stStat.u32QueueMax, stStat.u32Stalls,
+               ((BENCH_MODE_DIRECT == s_s32Mode) && (HI_TRUE != stStat.bDirect)) ? "  (no o_direct here)" : "");
+        if ((0 != stStat.u32WriteErrs) || (stStat.u64Written != stEnd.u64Bytes - stStart.u64Bytes)
+            || (HI_SUCCESS != BENCH_CheckFiles(s_s32Mode)))
+        {
+            s32Ret = HI_FAILURE;
+        }
+    }
+
+    BENCH_Unlink();
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+    return (HI_SUCCESS == s32Ret) ? 0 : -1;
+}
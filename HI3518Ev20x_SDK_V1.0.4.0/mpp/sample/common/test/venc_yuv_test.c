@@ -0,0 +1,472 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : venc_yuv_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/04/27
+  Description   : planar to semi-planar conversion against a byte by byte
+                  reference (every source and destination layout, odd chroma
+                  widths, padded strides), its throughput, and the read-ahead
+                  yuv reader: frame order, end of file, looping, and the feed
+                  rate against the fread / PlanToSemi path
+  History       :
+  1.Date        : 2016/04/27
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "sample_comm.h"
+
+#define TEST_PAD            0xA5
+#define TEST_BENCH_W        1920
+#define TEST_BENCH_H        1080
+#define TEST_BENCH_LOOPS    100
+#define TEST_FILE_W         352
+#define TEST_FILE_H         288
+#define TEST_FILE_FRAMES    7
+#define TEST_FEED_W         1280
+#define TEST_FEED_H         720
+#define TEST_FEED_FRAMES    40
+#define TEST_FEED_ENC_US    4000        /* what the encoder takes of a frame */
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FUNCTION__, __LINE__, #cond); \
+            return HI_FAILURE; \
+        } \
+    } while (0)
+
+/* in sample_comm_venc.c, not in sample_comm.h */
+extern HI_VOID SAMPLE_COMM_VENC_ReadOneFrame(FILE * fp, HI_U8 * pY, HI_U8 * pU, HI_U8 * pV,
+                                             HI_U32 width, HI_U32 height, HI_U32 stride, HI_U32 stride2);
+extern HI_S32 SAMPLE_COMM_VENC_PlanToSemi(HI_U8 *pY, HI_S32 yStride, HI_U8 *pU, HI_S32 uStride,
+                                          HI_U8 *pV, HI_S32 vStride, HI_S32 picWidth, HI_S32 picHeight);
+
+static HI_U32 s_u32Seed = 1;
+
+static HI_U8 TEST_Rand(HI_VOID)
+{
+    s_u32Seed = s_u32Seed * 1103515245 + 12345;
+    return (HI_U8)(s_u32Seed >> 16);
+}
+
+static HI_U64 TEST_NowUs(HI_VOID)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (HI_U64)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static HI_VOID TEST_FillFrame(HI_U8 *pu8Frame, HI_U32 u32Size, HI_U32 u32Seed)
+{
+    HI_U32 i;
+
+    s_u32Seed = u32Seed;
+    for (i = 0; i < u32Size; i++)
+    {
+        pu8Frame[i] = TEST_Rand();
+    }
+}
+
+/* the byte by byte conversion the results must match */
+static HI_VOID TEST_RefConvert(const HI_U8 *pu8Src, SAMPLE_YUV_FMT_E enSrcFmt, HI_U8 *pu8DstY, HI_U8 *pu8DstC,
+                               HI_U32 u32Stride, SAMPLE_YUV_FMT_E enDstFmt, HI_U32 u32Width, HI_U32 u32Height)
+{
+    HI_U32 u32CSize = (u32Width / 2) * (u32Height / 2);
+    const HI_U8 *pu8U = pu8Src + u32Width * u32Height + ((SAMPLE_YUV_YV12 == enSrcFmt) ? u32CSize : 0);
+    const HI_U8 *pu8V = pu8Src + u32Width * u32Height + ((SAMPLE_YUV_YV12 == enSrcFmt) ? 0 : u32CSize);
+    HI_U32 x;
+    HI_U32 y;
+
+    for (y = 0; y < u32Height; y++)
+    {
+        for (x = 0; x < u32Width; x++)
+        {
+            pu8DstY[y * u32Stride + x] = pu8Src[y * u32Width + x];
+        }
+    }
+    for (y = 0; y < u32Height / 2; y++)
+    {
+        for (x = 0; x < u32Width / 2; x++)
+        {
+            pu8DstC[y * u32Stride + 2 * x] = (SAMPLE_YUV_NV12 == enDstFmt) ? pu8U[y * u32Width / 2 + x] : pu8V[y * u32Width / 2 + x];
+            pu8DstC[y * u32Stride + 2 * x + 1] = (SAMPLE_YUV_NV12 == enDstFmt) ? pu8V[y * u32Width / 2 + x] : pu8U[y * u32Width / 2 + x];
+        }
+    }
+}
+
+static HI_S32 TEST_Interleave(HI_VOID)
+{
+    HI_U8 au8First[80];
+    HI_U8 au8Second[80];
+    HI_U8 au8Dst[170];
+    HI_U32 u32Num;
+    HI_U32 u32Off;
+    HI_U32 i;
+
+    TEST_FillFrame(au8First, sizeof(au8First), 3);
+    TEST_FillFrame(au8Second, sizeof(au8Second), 4);
+    for (u32Num = 0; u32Num <= 70; u32Num++)
+    {
+        for (u32Off = 0; u32Off < 4; u32Off++)
+        {
+            memset(au8Dst, TEST_PAD, sizeof(au8Dst));
+            SAMPLE_COMM_VENC_Interleave(au8First + u32Off, au8Second + (3 - u32Off), au8Dst + u32Off, u32Num);
+            for (i = 0; i < u32Num; i++)
+            {
+                TEST_CHECK(au8First[u32Off + i] == au8Dst[u32Off + 2 * i]);
+                TEST_CHECK(au8Second[3 - u32Off + i] == au8Dst[u32Off + 2 * i + 1]);
+            }
+            for (i = 0; i < u32Off; i++)
+            {
+                TEST_CHECK(TEST_PAD == au8Dst[i]);
+            }
+            for (i = u32Off + 2 * u32Num; i < sizeof(au8Dst); i++)
+            {
+                TEST_CHECK(TEST_PAD == au8Dst[i]);
+            }
+        }
+    }
+    printf("interleave: ok\n");
+    return HI_SUCCESS;
+}
+
+/* every layout pair, chroma widths that are not a multiple of the vector step, padded strides */
+static HI_S32 TEST_Exact(HI_VOID)
+{
+    static const HI_U32 au32Size[][2] = {{2, 2}, {6, 4}, {34, 2}, {176, 144}, {354, 288}, {1920, 1080}};
+    SAMPLE_YUV_FMT_E enSrc;
+    SAMPLE_YUV_FMT_E enDst;
+    HI_U32 u32W;
+    HI_U32 u32H;
+    HI_U32 u32Stride;
+    HI_U32 u32Pad;
+    HI_U32 u32DstSize;
+    HI_U8 *pu8Src;
+    HI_U8 *pu8Dst;
+    HI_U8 *pu8Ref;
+    HI_U32 i;
+
+    for (i = 0; i < sizeof(au32Size) / sizeof(au32Size[0]); i++)
+    {
+        u32W = au32Size[i][0];
+        u32H = au32Size[i][1];
+        pu8Src = (HI_U8 *)malloc(u32W * u32H * 3 / 2);
+        TEST_CHECK(NULL != pu8Src);
+        TEST_FillFrame(pu8Src, u32W * u32H * 3 / 2, i + 7);
+        for (u32Pad = 0; u32Pad <= 32; u32Pad += 32)
+        {
+            u32Stride = u32W + u32Pad;
+            u32DstSize = u32Stride * u32H * 3 / 2;
+            pu8Dst = (HI_U8 *)malloc(u32DstSize);
+            pu8Ref = (HI_U8 *)malloc(u32DstSize);
+            TEST_CHECK((NULL != pu8Dst) && (NULL != pu8Ref));
+            for (enSrc = SAMPLE_YUV_I420; enSrc <= SAMPLE_YUV_YV12; enSrc++)
+            {
+                for (enDst = SAMPLE_YUV_NV12; enDst <= SAMPLE_YUV_NV21; enDst++)
+                {
+                    memset(pu8Dst, TEST_PAD, u32DstSize);
+                    memset(pu8Ref, TEST_PAD, u32DstSize);
+                    TEST_RefConvert(pu8Src, enSrc, pu8Ref, pu8Ref + u32Stride * u32H, u32Stride, enDst, u32W, u32H);
+                    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvConvert(pu8Src, enSrc, pu8Dst, pu8Dst + u32Stride * u32H,
+                                                                         u32Stride, enDst, u32W, u32H));
+                    TEST_CHECK(0 == memcmp(pu8Ref, pu8Dst, u32DstSize));
+                }
+            }
+            free(pu8Dst);
+            free(pu8Ref);
+        }
+        free(pu8Src);
+    }
+
+    pu8Src = (HI_U8 *)malloc(64);
+    TEST_CHECK(NULL != pu8Src);
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvConvert(pu8Src, SAMPLE_YUV_I420, pu8Src, pu8Src, 3, SAMPLE_YUV_NV12, 3, 2));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvConvert(pu8Src, SAMPLE_YUV_I420, pu8Src, pu8Src, 2, SAMPLE_YUV_NV12, 4, 2));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvConvert(pu8Src, SAMPLE_YUV_NV12, pu8Src, pu8Src, 4, SAMPLE_YUV_NV12, 4, 2));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvConvert(pu8Src, SAMPLE_YUV_I420, pu8Src, pu8Src, 4, SAMPLE_YUV_YV12, 4, 2));
+    free(pu8Src);
+
+    printf("exact: ok\n");
+    return HI_SUCCESS;
+}
+
+/* PlanToSemi in place on a vb style frame still gives what its byte loop gave */
+static HI_S32 TEST_PlanToSemi(HI_VOID)
+{
+    HI_U32 u32W = 354;
+    HI_U32 u32Stride = 384;
+    HI_U32 u32H = 288;
+    HI_U32 u32Size = u32Stride * u32H * 3 / 2;
+    HI_U32 u32CSize = (u32Stride / 2) * (u32H / 2);
+    HI_U8 *pu8Frame;
+    HI_U8 *pu8Ref;
+    HI_U8 *pu8U;
+    HI_U32 i;
+
+    pu8Frame = (HI_U8 *)malloc(u32Size);
+    pu8Ref = (HI_U8 *)malloc(u32Size);
+    TEST_CHECK((NULL != pu8Frame) && (NULL != pu8Ref));
+    TEST_FillFrame(pu8Frame, u32Size, 11);
+    memcpy(pu8Ref, pu8Frame, u32Size);
+
+    pu8U = pu8Ref + u32Stride * u32H;
+    for (i = 0; i < u32CSize; i++)
+    {
+        pu8U[2 * i] = pu8Frame[u32Stride * u32H + u32CSize + i];
+        pu8U[2 * i + 1] = pu8Frame[u32Stride * u32H + i];
+    }
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_PlanToSemi(pu8Frame, u32Stride, pu8Frame + u32Stride * u32H, u32Stride,
+                                                         pu8Frame + u32Stride * u32H + u32CSize, u32Stride, u32W, u32H));
+    TEST_CHECK(0 == memcmp(pu8Ref, pu8Frame, u32Size));
+
+    free(pu8Frame);
+    free(pu8Ref);
+    printf("plan to semi: ok\n");
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Throughput(HI_VOID)
+{
+    HI_U32 u32Size = TEST_BENCH_W * TEST_BENCH_H * 3 / 2;
+    HI_U8 *pu8Src;
+    HI_U8 *pu8Dst;
+    HI_U64 u64Start;
+    HI_U64 u64RefUs;
+    HI_U64 u64Us;
+    HI_U32 i;
+
+    pu8Src = (HI_U8 *)malloc(u32Size);
+    pu8Dst = (HI_U8 *)malloc(u32Size);
+    TEST_CHECK((NULL != pu8Src) && (NULL != pu8Dst));
+    TEST_FillFrame(pu8Src, u32Size, 5);
+    memset(pu8Dst, 0, u32Size);
+
+    u64Start = TEST_NowUs();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++)
+    {
+        TEST_RefConvert(pu8Src, SAMPLE_YUV_I420, pu8Dst, pu8Dst + TEST_BENCH_W * TEST_BENCH_H, TEST_BENCH_W,
+                        SAMPLE_YUV_NV21, TEST_BENCH_W, TEST_BENCH_H);
+    }
+    u64RefUs = TEST_NowUs() - u64Start;
+
+    u64Start = TEST_NowUs();
+    for (i = 0; i < TEST_BENCH_LOOPS; i++)
+    {
+        (HI_VOID)SAMPLE_COMM_VENC_YuvConvert(pu8Src, SAMPLE_YUV_I420, pu8Dst, pu8Dst + TEST_BENCH_W * TEST_BENCH_H,
+                                             TEST_BENCH_W, SAMPLE_YUV_NV21, TEST_BENCH_W, TEST_BENCH_H);
+    }
+    u64Us = TEST_NowUs() - u64Start;
+
+    printf("%ux%u i420 to nv21: byte loop %llu us, convert %llu us a frame, %.0f fps\n",
+           TEST_BENCH_W, TEST_BENCH_H,
+           (unsigned long long)(u64RefUs / TEST_BENCH_LOOPS), (unsigned long long)(u64Us / TEST_BENCH_LOOPS),
+           (0 != u64Us) ? 1e6 * TEST_BENCH_LOOPS / u64Us : 0.0);
+    free(pu8Src);
+    free(pu8Dst);
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_WriteFile(const HI_CHAR *pszFile, HI_U32 u32Width, HI_U32 u32Height, HI_U32 u32Frames)
+{
+    HI_U32 u32Size = u32Width * u32Height * 3 / 2;
+    HI_U8 *pu8Frame;
+    FILE *pFile;
+    HI_U32 i;
+
+    pu8Frame = (HI_U8 *)malloc(u32Size);
+    pFile = fopen(pszFile, "wb");
+    TEST_CHECK((NULL != pu8Frame) && (NULL != pFile));
+    for (i = 0; i < u32Frames; i++)
+    {
+        TEST_FillFrame(pu8Frame, u32Size, 100 + i);
+        TEST_CHECK(1 == fwrite(pu8Frame, u32Size, 1, pFile));
+    }
+    fclose(pFile);
+    free(pu8Frame);
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Reader(const HI_CHAR *pszDir)
+{
+    SAMPLE_VENC_YUV_READER_ATTR_S stAttr;
+    SAMPLE_VENC_YUV_READER_STAT_S stStat;
+    VIDEO_FRAME_S stFrame;
+    HI_U32 u32Stride = 384;
+    HI_U32 u32SrcSize = TEST_FILE_W * TEST_FILE_H * 3 / 2;
+    HI_U32 u32DstSize = u32Stride * TEST_FILE_H * 3 / 2;
+    HI_U8 *pu8Src;
+    HI_U8 *pu8Dst;
+    HI_U8 *pu8Ref;
+    HI_U32 i;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    snprintf(stAttr.acFile, sizeof(stAttr.acFile), "%s/yuv_test_%ux%u.yuv", pszDir, TEST_FILE_W, TEST_FILE_H);
+    TEST_CHECK(HI_SUCCESS == TEST_WriteFile(stAttr.acFile, TEST_FILE_W, TEST_FILE_H, TEST_FILE_FRAMES));
+    pu8Src = (HI_U8 *)malloc(u32SrcSize);
+    pu8Dst = (HI_U8 *)malloc(u32DstSize);
+    pu8Ref = (HI_U8 *)malloc(u32DstSize);
+    TEST_CHECK((NULL != pu8Src) && (NULL != pu8Dst) && (NULL != pu8Ref));
+    memset(&stFrame, 0, sizeof(stFrame));
+    stFrame.pVirAddr[0] = pu8Dst;
+    stFrame.pVirAddr[1] = pu8Dst + u32Stride * TEST_FILE_H;
+    stFrame.u32Stride[0] = u32Stride;
+    stFrame.u32Stride[1] = u32Stride;
+
+    stAttr.u32Width = TEST_FILE_W;
+    stAttr.u32Height = TEST_FILE_H;
+    stAttr.enSrcFmt = SAMPLE_YUV_YV12;
+    stAttr.enDstFmt = SAMPLE_YUV_NV21;
+    stAttr.u32Buffers = 1;
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderStart(0, &stAttr));
+    stAttr.u32Buffers = 2;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStart(0, &stAttr));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderStart(0, &stAttr));
+
+    /* in order, then the end of the file */
+    for (i = 0; i < TEST_FILE_FRAMES; i++)
+    {
+        memset(pu8Dst, TEST_PAD, u32DstSize);
+        memset(pu8Ref, TEST_PAD, u32DstSize);
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderGet(0, &stFrame));
+        TEST_FillFrame(pu8Src, u32SrcSize, 100 + i);
+        TEST_RefConvert(pu8Src, SAMPLE_YUV_YV12, pu8Ref, pu8Ref + u32Stride * TEST_FILE_H, u32Stride,
+                        SAMPLE_YUV_NV21, TEST_FILE_W, TEST_FILE_H);
+        TEST_CHECK(0 == memcmp(pu8Ref, pu8Dst, u32DstSize));
+    }
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderGet(0, &stFrame));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderGet(0, &stFrame));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderGetStat(0, &stStat));
+    TEST_CHECK((TEST_FILE_FRAMES == stStat.u64Frames) && (0 == stStat.u32Loops));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStop(0));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderStop(0));
+
+    /* looping, and a stop while the thread waits on full buffers */
+    stAttr.enSrcFmt = SAMPLE_YUV_I420;
+    stAttr.enDstFmt = SAMPLE_YUV_NV12;
+    stAttr.u32Buffers = 3;
+    stAttr.bLoop = HI_TRUE;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStart(1, &stAttr));
+    for (i = 0; i < 2 * TEST_FILE_FRAMES + 3; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderGet(1, &stFrame));
+        TEST_FillFrame(pu8Src, u32SrcSize, 100 + i % TEST_FILE_FRAMES);
+        TEST_RefConvert(pu8Src, SAMPLE_YUV_I420, pu8Ref, pu8Ref + u32Stride * TEST_FILE_H, u32Stride,
+                        SAMPLE_YUV_NV12, TEST_FILE_W, TEST_FILE_H);
+        TEST_CHECK(0 == memcmp(pu8Ref, pu8Dst, u32DstSize));
+    }
+    usleep(20000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderGetStat(1, &stStat));
+    TEST_CHECK((2 * TEST_FILE_FRAMES + 3 == stStat.u64Frames) && (2 == stStat.u32Loops));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStop(1));
+
+    /* a file shorter than a frame loops to nothing */
+    TEST_CHECK(HI_SUCCESS == TEST_WriteFile(stAttr.acFile, TEST_FILE_W, 2, 1));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStart(1, &stAttr));
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderGet(1, &stFrame));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStop(1));
+
+    remove(stAttr.acFile);
+    TEST_CHECK(HI_SUCCESS != SAMPLE_COMM_VENC_YuvReaderStart(1, &stAttr));
+    free(pu8Src);
+    free(pu8Dst);
+    free(pu8Ref);
+    printf("reader: ok\n");
+    return HI_SUCCESS;
+}
+
+/* feeding an encoder that takes TEST_FEED_ENC_US a frame: line freads and PlanToSemi against the reader */
+static HI_S32 TEST_Feed(const HI_CHAR *pszDir)
+{
+    SAMPLE_VENC_YUV_READER_ATTR_S stAttr;
+    SAMPLE_VENC_YUV_READER_STAT_S stStat;
+    VIDEO_FRAME_S stFrame;
+    HI_U32 u32LumaSize = TEST_FEED_W * TEST_FEED_H;
+    HI_U8 *pu8Vb;
+    FILE *pFile;
+    HI_U64 u64Start;
+    HI_U64 u64SyncUs;
+    HI_U64 u64ReaderUs;
+    HI_U32 i;
+
+    memset(&stAttr, 0, sizeof(stAttr));
+    snprintf(stAttr.acFile, sizeof(stAttr.acFile), "%s/yuv_test_%ux%u.yuv", pszDir, TEST_FEED_W, TEST_FEED_H);
+    TEST_CHECK(HI_SUCCESS == TEST_WriteFile(stAttr.acFile, TEST_FEED_W, TEST_FEED_H, TEST_FEED_FRAMES));
+    pu8Vb = (HI_U8 *)malloc(u32LumaSize * 3 / 2);
+    TEST_CHECK(NULL != pu8Vb);
+
+    pFile = fopen(stAttr.acFile, "rb");
+    TEST_CHECK(NULL != pFile);
+    u64Start = TEST_NowUs();
+    for (i = 0; i < TEST_FEED_FRAMES; i++)
+    {
+        SAMPLE_COMM_VENC_ReadOneFrame(pFile, pu8Vb, pu8Vb + u32LumaSize, pu8Vb + u32LumaSize * 5 / 4,
+                                      TEST_FEED_W, TEST_FEED_H, TEST_FEED_W, TEST_FEED_W / 2);
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_PlanToSemi(pu8Vb, TEST_FEED_W, pu8Vb + u32LumaSize, TEST_FEED_W,
+                                                             pu8Vb + u32LumaSize * 5 / 4, TEST_FEED_W,
+                                                             TEST_FEED_W, TEST_FEED_H));
+        usleep(TEST_FEED_ENC_US);
+    }
+    u64SyncUs = TEST_NowUs() - u64Start;
+    fclose(pFile);
+
+    memset(&stFrame, 0, sizeof(stFrame));
+    stFrame.pVirAddr[0] = pu8Vb;
+    stFrame.pVirAddr[1] = pu8Vb + u32LumaSize;
+    stFrame.u32Stride[0] = TEST_FEED_W;
+    stFrame.u32Stride[1] = TEST_FEED_W;
+    stAttr.u32Width = TEST_FEED_W;
+    stAttr.u32Height = TEST_FEED_H;
+    stAttr.enSrcFmt = SAMPLE_YUV_I420;
+    stAttr.enDstFmt = SAMPLE_YUV_NV21;
+    stAttr.u32Buffers = 2;
+    u64Start = TEST_NowUs();
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStart(0, &stAttr));
+    for (i = 0; i < TEST_FEED_FRAMES; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderGet(0, &stFrame));
+        usleep(TEST_FEED_ENC_US);
+    }
+    u64ReaderUs = TEST_NowUs() - u64Start;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderGetStat(0, &stStat));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VENC_YuvReaderStop(0));
+    remove(stAttr.acFile);
+
+    printf("feed %ux%u, encoder %u us a frame: fread + PlanToSemi %.1f fps, reader %.1f fps "
+           "(read %llu us, convert %llu us, waited %llu us a frame)\n", TEST_FEED_W, TEST_FEED_H, TEST_FEED_ENC_US,
+           1e6 * TEST_FEED_FRAMES / u64SyncUs, 1e6 * TEST_FEED_FRAMES / u64ReaderUs,
+           (unsigned long long)(stStat.u64ReadUs / TEST_FEED_FRAMES),
+           (unsigned long long)(stStat.u64ConvertUs / TEST_FEED_FRAMES),
+           (unsigned long long)(stStat.u64WaitUs / TEST_FEED_FRAMES));
+    free(pu8Vb);
+    return HI_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    const HI_CHAR *pszDir = (argc > 1) ? argv[1] : "/tmp";
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    s32Ret |= TEST_Interleave();
+    s32Ret |= TEST_Exact();
+    s32Ret |= TEST_PlanToSemi();
+    s32Ret |= TEST_Throughput();
+    s32Ret |= TEST_Reader(pszDir);
+    s32Ret |= TEST_Feed(pszDir);
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
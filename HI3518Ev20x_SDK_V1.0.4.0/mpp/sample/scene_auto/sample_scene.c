@@ -49,6 +49,8 @@ int main(int argc, char *argv[])
 	int choice;
     int specialscene;
     SRDK_SCENEAUTO_SEPCIAL_SCENE_E eSpecialScene;
+    SRDK_SCENEAUTO_STAT_S stStat;
+    SRDK_SCENEAUTO_RELOAD_STATUS_S stReloadStatus;
     char *file_name;
     HI_BOOL b_help = 0;
 
@@ -96,6 +98,8 @@ int main(int argc, char *argv[])
         printf("3.set specialmode\n");
         printf("4.get specialmode\n");
 		printf("5.exit the sample\n");
+		printf("6.get statistics\n");
+		printf("7.get reload status\n");
 
 	    scanf("%d", &choice);
 	    switch (choice)
@@ -204,6 +208,28 @@ int main(int argc, char *argv[])
 				}
 				exit(-1);
 				break;
+			case 6:
+				ret = HI_SRDK_SCENEAUTO_GetStat(&stStat);
+				if (HI_SUCCESS != ret)
+				{
+					printf("HI_SRDK_SCENEAUTO_GetStat failed\n");
+					break;
+				}
+				printf("cycles %u, idle cycles %u, mpi calls %u/s, get %llu, set %llu\n",
+					stStat.u32Cycles, stStat.u32IdleCycles, stStat.u32MpiCallsPerSec,
+					stStat.u64MpiGetCalls, stStat.u64MpiSetCalls);
+				break;
+			case 7:
+				ret = HI_SRDK_SCENEAUTO_GetReloadStatus(&stReloadStatus);
+				if (HI_SUCCESS != ret)
+				{
+					printf("HI_SRDK_SCENEAUTO_GetReloadStatus failed\n");
+					break;
+				}
+				printf("watching %d, reloads %u, failed %u, last [%s] parsed in %u us, in use after %u us\n",
+					stReloadStatus.bWatching, stReloadStatus.u32ReloadCount, stReloadStatus.u32FailCount,
+					stReloadStatus.szChangedSection, stReloadStatus.u32ParseTime, stReloadStatus.u32ReloadTime);
+				break;
 	        default:
 	            printf("unkonw input\n");
 	            break;
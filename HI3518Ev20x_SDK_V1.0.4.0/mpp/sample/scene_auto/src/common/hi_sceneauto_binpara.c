@@ -0,0 +1,427 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include "hi_type.h"
+#include "hi_sceneauto_comm.h"
+#include "hi_sceneauto_define.h"
+#include "hi_sceneauto_binpara.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif /* __cplusplus */
+
+#define BINPARA_NO_COUNT    0xFFFFFFFF
+#define BINPARA_ALIGN_UP(x) (((x) + SCENEAUTO_BINPARA_ALIGN - 1) & ~(SCENEAUTO_BINPARA_ALIGN - 1))
+
+/* one entry per malloc'd array of SCENEAUTO_INIPARA_S, element number is count (* count2) */
+typedef struct hiSCENEAUTO_BINPARA_ARRAY_S
+{
+    HI_U32 u32PtrOffset;
+    HI_U32 u32CountOffset;
+    HI_U32 u32Count2Offset;
+    HI_U32 u32ElemSize;
+}SCENEAUTO_BINPARA_ARRAY_S;
+
+#define BINPARA_ARRAY(ptr, cnt, type) \
+    {offsetof(SCENEAUTO_INIPARA_S, ptr), offsetof(SCENEAUTO_INIPARA_S, cnt), BINPARA_NO_COUNT, sizeof(type)}
+#define BINPARA_ARRAY2(ptr, cnt, cnt2, type) \
+    {offsetof(SCENEAUTO_INIPARA_S, ptr), offsetof(SCENEAUTO_INIPARA_S, cnt), offsetof(SCENEAUTO_INIPARA_S, cnt2), sizeof(type)}
+
+static const SCENEAUTO_BINPARA_ARRAY_S g_astBinParaArray[] =
+{
+    BINPARA_ARRAY(stIniAE.pu32BitrateThresh, stIniAE.s32BitrateCount, HI_U32),
+    BINPARA_ARRAY(stIniAE.pstAERelatedBit, stIniAE.s32BitrateCount, SCENEAUTO_AERELATEDBIT_S),
+    BINPARA_ARRAY(stIniAE.pu32AEExpDtoLThresh, stIniAE.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniAE.pu32AEExpLtoDThresh, stIniAE.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniAE.pstAERelatedExp, stIniAE.s32ExpCount, SCENEAUTO_AERELATEDEXP_S),
+    BINPARA_ARRAY(stIniDemosaic.pu32BitrateThresh, stIniDemosaic.s32BitrateCount, HI_U32),
+    BINPARA_ARRAY(stIniDemosaic.pu32ExpThresh, stIniDemosaic.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniDemosaic.pstDemosaic, stIniDemosaic.s32ExpCount, SCENEAUTO_DEMOSAIC_S),
+    BINPARA_ARRAY(stIniSharpen.pu32BitrateThresh, stIniSharpen.s32BitrateCount, HI_U32),
+    BINPARA_ARRAY(stIniSharpen.pu32ExpThresh, stIniSharpen.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniSharpen.pstSharpen, stIniSharpen.s32ExpCount, SCENEAUTO_SHARPEN_S),
+    BINPARA_ARRAY(stIniDP.pu32ExpThresh, stIniDP.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniDP.pstDPAttr, stIniDP.s32ExpCount, SCENEAUTO_DEPATTR_S),
+    BINPARA_ARRAY(stIniGamma.pu32ExpThreshLtoD, stIniGamma.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniGamma.pu32ExpThreshDtoL, stIniGamma.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIniGamma.pstGamma, stIniGamma.s32ExpCount, SCENEAUTO_GAMMA_S),
+    BINPARA_ARRAY(stIniH264Venc.pu32BitrateThresh, stIniH264Venc.s32BitrateCount, HI_U32),
+    BINPARA_ARRAY(stIniH264Venc.pstH264Venc, stIniH264Venc.s32BitrateCount, SCENEAUTO_H264VENC_S),
+    BINPARA_ARRAY(stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh,
+                  stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount, HI_U32),
+    BINPARA_ARRAY(stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh,
+                  stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount, HI_U32),
+    BINPARA_ARRAY2(stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg,
+                   stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount,
+                   stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount, SCENEAUTO_H265VENC_FACECFG_S),
+    BINPARA_ARRAY(stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh,
+                  stIniH265Venc.stIniH265VencRcParam.s32BitrateCount, HI_U32),
+    BINPARA_ARRAY(stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam,
+                  stIniH265Venc.stIniH265VencRcParam.s32BitrateCount, SCENEAUTO_H265VENC_RCPARAM_S),
+    BINPARA_ARRAY(stIni3dnr.pu323DnrIsoThresh, stIni3dnr.s323DnrIsoCount, HI_U32),
+    BINPARA_ARRAY(stIni3dnr.pst3dnrParam, stIni3dnr.s323DnrIsoCount, SCENEAUTO_INIPARAM_3DNRCFG_S),
+    BINPARA_ARRAY(stHLC.pu323DnrIsoThresh, stHLC.s323DnrIsoCount, HI_U32),
+    BINPARA_ARRAY(stHLC.pst3dnrParam, stHLC.s323DnrIsoCount, SCENEAUTO_INIPARAM_3DNRCFG_S),
+    BINPARA_ARRAY(stIR.pu32ExpThreshLtoH, stIR.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIR.pu32ExpThreshHtoL, stIR.s32ExpCount, HI_U32),
+    BINPARA_ARRAY(stIR.pu8ExpCompensation, stIR.s32ExpCount, HI_U8),
+    BINPARA_ARRAY(stIR.pu8MaxHistOffset, stIR.s32ExpCount, HI_U8),
+    BINPARA_ARRAY(stIR.pu323DnrIsoThresh, stIR.s323DnrIsoCount, HI_U32),
+    BINPARA_ARRAY(stIR.pst3dnrParam, stIR.s323DnrIsoCount, SCENEAUTO_INIPARAM_3DNRCFG_S),
+    BINPARA_ARRAY(stFastDynamic.pstRouteNode, stFastDynamic.s32TotalNum, SCENEAUTO_ROUTE_NODE_S),
+    BINPARA_ARRAY(stNormalDynamic.pstRouteNode, stNormalDynamic.s32TotalNum, SCENEAUTO_ROUTE_NODE_S),
+};
+
+#define BINPARA_ARRAY_NUM   (sizeof(g_astBinParaArray) / sizeof(g_astBinParaArray[0]))
+
+static HI_VOID *g_pBinParaMap = NULL;
+static HI_U32 g_u32BinParaMapLen = 0;
+static const SCENEAUTO_INIPARA_S *g_pstBinParaOwner = NULL;
+
+HI_U64 Sceneauto_GetTimeUs(HI_VOID)
+{
+    struct timeval stTime;
+
+    gettimeofday(&stTime, NULL);
+    return (HI_U64)stTime.tv_sec * 1000000 + stTime.tv_usec;
+}
+
+static HI_VOID **Sceneauto_BinParaPtr(const SCENEAUTO_INIPARA_S *pstPara, const SCENEAUTO_BINPARA_ARRAY_S *pstArray)
+{
+    return (HI_VOID **)((HI_U8 *)pstPara + pstArray->u32PtrOffset);
+}
+
+static HI_U32 Sceneauto_BinParaArraySize(const SCENEAUTO_INIPARA_S *pstPara, const SCENEAUTO_BINPARA_ARRAY_S *pstArray)
+{
+    HI_S32 s32Count;
+    HI_S32 s32Count2 = 1;
+
+    s32Count = *(const HI_S32 *)((const HI_U8 *)pstPara + pstArray->u32CountOffset);
+    if (BINPARA_NO_COUNT != pstArray->u32Count2Offset)
+    {
+        s32Count2 = *(const HI_S32 *)((const HI_U8 *)pstPara + pstArray->u32Count2Offset);
+    }
+    if ((s32Count <= 0) || (s32Count2 <= 0) || (NULL == *Sceneauto_BinParaPtr(pstPara, pstArray)))
+    {
+        return 0;
+    }
+
+    return (HI_U32)s32Count * (HI_U32)s32Count2 * pstArray->u32ElemSize;
+}
+
+/* FNV-1a, the blob is a few tens of KB so a byte loop is cheap enough */
+static HI_U32 Sceneauto_BinParaChecksum(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 u32Hash = 2166136261U;
+    HI_U32 i;
+
+    for (i = 0; i < u32Len; i++)
+    {
+        u32Hash ^= pu8Data[i];
+        u32Hash *= 16777619U;
+    }
+
+    return u32Hash;
+}
+
+HI_S32 Sceneauto_SaveBinPara(const SCENEAUTO_INIPARA_S *pstPara, const HI_CHAR *pszIniFile, const HI_CHAR *pszBinFile)
+{
+    SCENEAUTO_BINPARA_HEAD_S stHead;
+    SCENEAUTO_INIPARA_S *pstImage;
+    struct stat stIniStat;
+    HI_U8 *pu8Data;
+    HI_U32 u32DataSize;
+    HI_U32 u32Offset;
+    HI_U32 u32Size;
+    HI_U32 i;
+    FILE *pFile;
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    if (0 != stat(pszIniFile, &stIniStat))
+    {
+        printf("stat %s failed\n", pszIniFile);
+        return HI_FAILURE;
+    }
+
+    u32DataSize = BINPARA_ALIGN_UP(sizeof(SCENEAUTO_INIPARA_S));
+    for (i = 0; i < BINPARA_ARRAY_NUM; i++)
+    {
+        u32DataSize += BINPARA_ALIGN_UP(Sceneauto_BinParaArraySize(pstPara, &g_astBinParaArray[i]));
+    }
+
+    pu8Data = (HI_U8 *)calloc(1, u32DataSize);
+    if (NULL == pu8Data)
+    {
+        printf("malloc %u bytes failed\n", u32DataSize);
+        return HI_FAILURE;
+    }
+
+    pstImage = (SCENEAUTO_INIPARA_S *)pu8Data;
+    memcpy(pstImage, pstPara, sizeof(SCENEAUTO_INIPARA_S));
+    u32Offset = BINPARA_ALIGN_UP(sizeof(SCENEAUTO_INIPARA_S));
+    for (i = 0; i < BINPARA_ARRAY_NUM; i++)
+    {
+        u32Size = Sceneauto_BinParaArraySize(pstPara, &g_astBinParaArray[i]);
+        if (0 == u32Size)
+        {
+            *Sceneauto_BinParaPtr(pstImage, &g_astBinParaArray[i]) = NULL;
+            continue;
+        }
+        memcpy(pu8Data + u32Offset, *Sceneauto_BinParaPtr(pstPara, &g_astBinParaArray[i]), u32Size);
+        /* offsets are relative to the file start, so 0 never names a valid array */
+        *Sceneauto_BinParaPtr(pstImage, &g_astBinParaArray[i]) =
+            (HI_VOID *)(unsigned long)(sizeof(SCENEAUTO_BINPARA_HEAD_S) + u32Offset);
+        u32Offset += BINPARA_ALIGN_UP(u32Size);
+    }
+
+    memset(&stHead, 0, sizeof(stHead));
+    stHead.u32Magic = SCENEAUTO_BINPARA_MAGIC;
+    stHead.u32Version = SCENEAUTO_BINPARA_VERSION;
+    stHead.u32HeadSize = sizeof(SCENEAUTO_BINPARA_HEAD_S);
+    stHead.u32ParaSize = sizeof(SCENEAUTO_INIPARA_S);
+    stHead.u32PtrSize = sizeof(HI_VOID *);
+    stHead.u32ArrayNum = BINPARA_ARRAY_NUM;
+    stHead.u32DataSize = u32DataSize;
+    stHead.u32Checksum = Sceneauto_BinParaChecksum(pu8Data, u32DataSize);
+    stHead.u32IniSize = (HI_U32)stIniStat.st_size;
+    stHead.u32IniMtime = (HI_U32)stIniStat.st_mtime;
+
+    pFile = fopen(pszBinFile, "wb");
+    if (NULL == pFile)
+    {
+        printf("open %s failed\n", pszBinFile);
+        free(pu8Data);
+        return HI_FAILURE;
+    }
+    if ((1 != fwrite(&stHead, sizeof(stHead), 1, pFile))
+        || (1 != fwrite(pu8Data, u32DataSize, 1, pFile)))
+    {
+        printf("write %s failed\n", pszBinFile);
+        s32Ret = HI_FAILURE;
+    }
+    if (0 != fclose(pFile))
+    {
+        s32Ret = HI_FAILURE;
+    }
+    if (HI_SUCCESS != s32Ret)
+    {
+        (HI_VOID)unlink(pszBinFile);
+    }
+
+    free(pu8Data);
+    return s32Ret;
+}
+
+static HI_S32 Sceneauto_CheckBinParaHead(const SCENEAUTO_BINPARA_HEAD_S *pstHead, HI_U32 u32FileLen, const HI_CHAR *pszIniFile)
+{
+    struct stat stIniStat;
+
+    if ((SCENEAUTO_BINPARA_MAGIC != pstHead->u32Magic)
+        || (SCENEAUTO_BINPARA_VERSION != pstHead->u32Version)
+        || (sizeof(SCENEAUTO_BINPARA_HEAD_S) != pstHead->u32HeadSize)
+        || (sizeof(SCENEAUTO_INIPARA_S) != pstHead->u32ParaSize)
+        || (sizeof(HI_VOID *) != pstHead->u32PtrSize)
+        || (BINPARA_ARRAY_NUM != pstHead->u32ArrayNum))
+    {
+        printf("sceneauto bin para version mismatch\n");
+        return HI_FAILURE;
+    }
+
+    if ((pstHead->u32DataSize < sizeof(SCENEAUTO_INIPARA_S))
+        || (pstHead->u32DataSize != u32FileLen - sizeof(SCENEAUTO_BINPARA_HEAD_S)))
+    {
+        printf("sceneauto bin para truncated\n");
+        return HI_FAILURE;
+    }
+
+    /* without the ini there is nothing to fall back to, trust the blob */
+    if (0 == stat(pszIniFile, &stIniStat))
+    {
+        if (((HI_U32)stIniStat.st_size != pstHead->u32IniSize)
+            || ((HI_U32)stIniStat.st_mtime != pstHead->u32IniMtime))
+        {
+            printf("sceneauto bin para is older than %s\n", pszIniFile);
+            return HI_FAILURE;
+        }
+    }
+
+    return HI_SUCCESS;
+}
+
+HI_S32 Sceneauto_MapBinPara(SCENEAUTO_INIPARA_S *pstPara, const HI_CHAR *pszIniFile, const HI_CHAR *pszBinFile)
+{
+    const SCENEAUTO_BINPARA_HEAD_S *pstHead;
+    HI_U8 *pu8Map;
+    HI_U8 *pu8Data;
+    HI_VOID **ppArray;
+    struct stat stBinStat;
+    unsigned long ulOffset;
+    HI_U32 u32Size;
+    HI_U32 i;
+    HI_S32 s32Fd;
+
+    if (NULL != g_pBinParaMap)
+    {
+        printf("sceneauto bin para has been mapped already\n");
+        return HI_FAILURE;
+    }
+
+    s32Fd = open(pszBinFile, O_RDONLY);
+    if (s32Fd < 0)
+    {
+        return HI_FAILURE;
+    }
+    if ((0 != fstat(s32Fd, &stBinStat)) || (stBinStat.st_size <= (off_t)sizeof(SCENEAUTO_BINPARA_HEAD_S)))
+    {
+        close(s32Fd);
+        return HI_FAILURE;
+    }
+
+    /* private mapping: the arrays stay in the page cache until someone writes them */
+    pu8Map = (HI_U8 *)mmap(NULL, stBinStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, s32Fd, 0);
+    close(s32Fd);
+    if (MAP_FAILED == (HI_VOID *)pu8Map)
+    {
+        printf("mmap %s failed\n", pszBinFile);
+        return HI_FAILURE;
+    }
+
+    pstHead = (const SCENEAUTO_BINPARA_HEAD_S *)pu8Map;
+    pu8Data = pu8Map + sizeof(SCENEAUTO_BINPARA_HEAD_S);
+    if ((HI_SUCCESS != Sceneauto_CheckBinParaHead(pstHead, (HI_U32)stBinStat.st_size, pszIniFile))
+        || (pstHead->u32Checksum != Sceneauto_BinParaChecksum(pu8Data, pstHead->u32DataSize)))
+    {
+        printf("%s is invalid, fall back to ini\n", pszBinFile);
+        munmap(pu8Map, stBinStat.st_size);
+        return HI_FAILURE;
+    }
+
+    memcpy(pstPara, pu8Data, sizeof(SCENEAUTO_INIPARA_S));
+    for (i = 0; i < BINPARA_ARRAY_NUM; i++)
+    {
+        ppArray = Sceneauto_BinParaPtr(pstPara, &g_astBinParaArray[i]);
+        ulOffset = (unsigned long)*ppArray;
+        if (0 == ulOffset)
+        {
+            continue;
+        }
+        *ppArray = pu8Map + ulOffset;
+        u32Size = Sceneauto_BinParaArraySize(pstPara, &g_astBinParaArray[i]);
+        if ((0 != (ulOffset % SCENEAUTO_BINPARA_ALIGN))
+            || (ulOffset < sizeof(SCENEAUTO_BINPARA_HEAD_S) + sizeof(SCENEAUTO_INIPARA_S))
+            || (ulOffset + u32Size > (unsigned long)stBinStat.st_size))
+        {
+            printf("%s array %u out of range\n", pszBinFile, i);
+            memset(pstPara, 0, sizeof(SCENEAUTO_INIPARA_S));
+            munmap(pu8Map, stBinStat.st_size);
+            return HI_FAILURE;
+        }
+    }
+
+    g_pBinParaMap = pu8Map;
+    g_u32BinParaMapLen = (HI_U32)stBinStat.st_size;
+    g_pstBinParaOwner = pstPara;
+
+    return HI_SUCCESS;
+}
+
+HI_BOOL Sceneauto_IsBinParaMapped(const SCENEAUTO_INIPARA_S *pstPara)
+{
+    return ((NULL != g_pBinParaMap) && (pstPara == g_pstBinParaOwner)) ? HI_TRUE : HI_FALSE;
+}
+
+HI_VOID Sceneauto_UnmapBinPara(SCENEAUTO_INIPARA_S *pstPara)
+{
+    HI_U32 i;
+
+    if (HI_TRUE != Sceneauto_IsBinParaMapped(pstPara))
+    {
+        return;
+    }
+
+    for (i = 0; i < BINPARA_ARRAY_NUM; i++)
+    {
+        *Sceneauto_BinParaPtr(pstPara, &g_astBinParaArray[i]) = NULL;
+    }
+    munmap(g_pBinParaMap, g_u32BinParaMapLen);
+    g_pBinParaMap = NULL;
+    g_u32BinParaMapLen = 0;
+    g_pstBinParaOwner = NULL;
+}
+
+/* free the malloc'd arrays whose pointer lies in [u32Offset, u32Offset + u32Size) of a parsed set */
+HI_VOID Sceneauto_FreeParaArrays(SCENEAUTO_INIPARA_S *pstPara, HI_U32 u32Offset, HI_U32 u32Size)
+{
+    HI_VOID **ppArray;
+    HI_U32 i;
+
+    for (i = 0; i < BINPARA_ARRAY_NUM; i++)
+    {
+        if ((g_astBinParaArray[i].u32PtrOffset < u32Offset)
+            || (g_astBinParaArray[i].u32PtrOffset >= u32Offset + u32Size))
+        {
+            continue;
+        }
+        ppArray = Sceneauto_BinParaPtr(pstPara, &g_astBinParaArray[i]);
+        free(*ppArray);
+        *ppArray = NULL;
+    }
+}
+
+HI_S32 Sceneauto_CompareBinPara(const SCENEAUTO_INIPARA_S *pstPara1, const SCENEAUTO_INIPARA_S *pstPara2)
+{
+    SCENEAUTO_INIPARA_S *pstImage1;
+    SCENEAUTO_INIPARA_S *pstImage2;
+    HI_U32 u32Size;
+    HI_U32 i;
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    pstImage1 = (SCENEAUTO_INIPARA_S *)malloc(sizeof(SCENEAUTO_INIPARA_S));
+    pstImage2 = (SCENEAUTO_INIPARA_S *)malloc(sizeof(SCENEAUTO_INIPARA_S));
+    if ((NULL == pstImage1) || (NULL == pstImage2))
+    {
+        free(pstImage1);
+        free(pstImage2);
+        return HI_FAILURE;
+    }
+    memcpy(pstImage1, pstPara1, sizeof(SCENEAUTO_INIPARA_S));
+    memcpy(pstImage2, pstPara2, sizeof(SCENEAUTO_INIPARA_S));
+
+    for (i = 0; i < BINPARA_ARRAY_NUM; i++)
+    {
+        u32Size = Sceneauto_BinParaArraySize(pstPara1, &g_astBinParaArray[i]);
+        if ((u32Size != Sceneauto_BinParaArraySize(pstPara2, &g_astBinParaArray[i]))
+            || ((0 != u32Size) && (0 != memcmp(*Sceneauto_BinParaPtr(pstPara1, &g_astBinParaArray[i]),
+                                               *Sceneauto_BinParaPtr(pstPara2, &g_astBinParaArray[i]), u32Size))))
+        {
+            printf("sceneauto bin para array %u differs\n", i);
+            s32Ret = HI_FAILURE;
+        }
+        *Sceneauto_BinParaPtr(pstImage1, &g_astBinParaArray[i]) = NULL;
+        *Sceneauto_BinParaPtr(pstImage2, &g_astBinParaArray[i]) = NULL;
+    }
+    if (0 != memcmp(pstImage1, pstImage2, sizeof(SCENEAUTO_INIPARA_S)))
+    {
+        printf("sceneauto bin para scalars differ\n");
+        s32Ret = HI_FAILURE;
+    }
+
+    free(pstImage1);
+    free(pstImage2);
+    return s32Ret;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
@@ -0,0 +1,177 @@
+#include <string.h>
+#include "hi_type.h"
+#include "hi_sceneauto_comm.h"
+#include "hi_sceneauto_define.h"
+#include "hi_sceneauto_lut.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif /* __cplusplus */
+
+static __inline int iMin2(int a, int b)         {{ if (a > b) a = b; }; return a; }
+
+static int MapISO(int iso)
+{
+  int   j,  i = (iso >= 200);
+  i += ( (iso >= (200 << 1)) + (iso >= (400 << 1)) + (iso >= (400 << 2)) + (iso >= (400 << 3)) + (iso >= (400 << 4)) );
+  i += ( (iso >= (400 << 5)) + (iso >= (400 << 6)) + (iso >= (400 << 7)) + (iso >= (400 << 8)) + (iso >= (400 << 9)) );
+  j  = ( (iso >  (112 << i)) + (iso >  (125 << i)) + (iso >  (141 << i)) + (iso >  (158 << i)) + (iso >  (178 << i)) );
+  return (i * 6 + j + (iso >= 25) + (iso >= 50) + (iso >= 100));  
+}
+
+HI_VOID Interpolate(SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrcfg, HI_U32 u32Mid, 
+                                const SCENEAUTO_INIPARAM_3DNRCFG_S *pstL3dnrcfg, HI_U32 u32Left,  
+                                const SCENEAUTO_INIPARAM_3DNRCFG_S *pstR3dnrcfg, HI_U32 u32Right)
+{
+  int   k, left, right, i = ((u32Mid > 3) ? MapISO(u32Mid) : iMin2(71,-u32Mid));  
+  left  = ((u32Left  > 3) ? MapISO(u32Left) : iMin2(71,-u32Left) ); if (i <= left)  { *pst3dnrcfg = *pstL3dnrcfg; return; }
+  right = ((u32Right > 3) ? MapISO(u32Right): iMin2(71,-u32Right)); if (i >= right) { *pst3dnrcfg = *pstR3dnrcfg; return; }
+  k = (right - left); *pst3dnrcfg = *(( (i+((k * 3) >> 2)) < right ) ? pstL3dnrcfg : pstR3dnrcfg);
+  pst3dnrcfg->s32YPKStr = ( ((right - i) * pstL3dnrcfg->s32YPKStr + (i - left) * pstR3dnrcfg->s32YPKStr + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YSFStr = ( ((right - i) * pstL3dnrcfg->s32YSFStr + (i - left) * pstR3dnrcfg->s32YSFStr + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YTFStr = ( ((right - i) * pstL3dnrcfg->s32YTFStr + (i - left) * pstR3dnrcfg->s32YTFStr + (k >> 1)) / k ); 
+  pst3dnrcfg->s32TFStrMax = ( ((right - i) * pstL3dnrcfg->s32TFStrMax + (i - left) * pstR3dnrcfg->s32TFStrMax + (k >> 1)) / k ); 
+  pst3dnrcfg->s32TFStrMov = ( ((right - i) * pstL3dnrcfg->s32TFStrMov + (i - left) * pstR3dnrcfg->s32TFStrMov + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YSmthStr = ( ((right - i) * pstL3dnrcfg->s32YSmthStr + (i - left) * pstR3dnrcfg->s32YSmthStr + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YSmthRat = ( ((right - i) * pstL3dnrcfg->s32YSmthRat + (i - left) * pstR3dnrcfg->s32YSmthRat + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YSFBriRat = ( ((right - i) * pstL3dnrcfg->s32YSFBriRat + (i - left) * pstR3dnrcfg->s32YSFBriRat + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YSFStrDl = ( ((right - i) * pstL3dnrcfg->s32YSFStrDl + (i - left) * pstR3dnrcfg->s32YSFStrDl + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YSFStrDlt = ( ((right - i) * pstL3dnrcfg->s32YSFStrDlt + (i - left) * pstR3dnrcfg->s32YSFStrDlt + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YTFStrDlt = ( ((right - i) * pstL3dnrcfg->s32YTFStrDlt + (i - left) * pstR3dnrcfg->s32YTFStrDlt + (k >> 1)) / k );
+  pst3dnrcfg->s32YTFStrDl = ( ((right - i) * pstL3dnrcfg->s32YTFStrDl + (i - left) * pstR3dnrcfg->s32YTFStrDl + (k >> 1)) / k ); 
+  pst3dnrcfg->s32CTFstr = ( ((right - i) * pstL3dnrcfg->s32CTFstr + (i - left) * pstR3dnrcfg->s32CTFstr + (k >> 1)) / k );
+  pst3dnrcfg->s32CSFStr = ( ((right - i) * pstL3dnrcfg->s32CSFStr + (i - left) * pstR3dnrcfg->s32CSFStr + (k >> 1)) / k ); 
+  pst3dnrcfg->s32YTFMdWin = ( ((right - i) * pstL3dnrcfg->s32YTFMdWin + (i - left) * pstR3dnrcfg->s32YTFMdWin + (k >> 1)) / k );
+} 
+
+
+HI_S32 Sceneauto_IsoIndex(HI_U32 u32Iso)
+{
+    return ((u32Iso > 3) ? MapISO(u32Iso) : iMin2(71, -u32Iso));
+}
+
+/* the original per frame path: pick the two iso levels around u32Iso and interpolate */
+HI_VOID Sceneauto_Calc3dnr(HI_S32 s32IsoCount, const HI_U32 *pu32IsoThresh, const SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrParam,
+                           HI_U32 u32Iso, SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnr)
+{
+    HI_S32 i;
+    HI_S32 s32IsoLevel;
+    HI_S32 s32IsoLevel1;
+
+    s32IsoLevel = s32IsoCount - 1;
+    for (i = 0; i < s32IsoCount; i++)
+    {
+        if (u32Iso <= pu32IsoThresh[i])
+        {
+            s32IsoLevel = i;
+            break;
+        }
+    }
+
+    s32IsoLevel1 = s32IsoLevel - 1;
+    if (s32IsoLevel1 < 0)
+    {
+        s32IsoLevel1 = 0;
+    }
+
+    Interpolate(pst3dnr, u32Iso,
+            &pst3dnrParam[s32IsoLevel1], pu32IsoThresh[s32IsoLevel1],
+            &pst3dnrParam[s32IsoLevel], pu32IsoThresh[s32IsoLevel]);
+}
+
+/* smallest iso above 3 whose index is at least s32Index */
+static HI_U32 Sceneauto_IndexToIso(HI_S32 s32Index)
+{
+    HI_U32 u32Low = 4;
+    HI_U32 u32High = SCENEAUTO_ISO_LUT_MAX;
+    HI_U32 u32Mid;
+
+    while (u32Low < u32High)
+    {
+        u32Mid = u32Low + ((u32High - u32Low) >> 1);
+        if (MapISO(u32Mid) >= s32Index)
+        {
+            u32High = u32Mid;
+        }
+        else
+        {
+            u32Low = u32Mid + 1;
+        }
+    }
+
+    return u32Low;
+}
+
+/*
+ * Interpolate() only looks at the iso index, so the result depends on the index
+ * alone as long as no two thresholds share an index: every iso of one index then
+ * lands on the same pair of levels, or on the level whose threshold it shares.
+ * Tables that break this keep the search + interpolate path.
+ */
+HI_S32 Sceneauto_Build3dnrLut(SCENEAUTO_3DNR_LUT_S *pstLut, HI_S32 s32IsoCount, const HI_U32 *pu32IsoThresh,
+                              const SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrParam)
+{
+    HI_S32 i;
+    HI_S32 s32Index;
+    HI_U32 u32Iso;
+
+    if (NULL == pstLut)
+    {
+        return HI_FAILURE;
+    }
+
+    pstLut->bValid = HI_FALSE;
+    pstLut->s32IsoCount = s32IsoCount;
+    pstLut->pu32IsoThresh = pu32IsoThresh;
+    pstLut->pst3dnrParam = pst3dnrParam;
+
+    if ((s32IsoCount <= 0) || (NULL == pu32IsoThresh) || (NULL == pst3dnrParam))
+    {
+        return HI_FAILURE;
+    }
+
+    if ((pu32IsoThresh[0] <= 3) || (pu32IsoThresh[s32IsoCount - 1] > SCENEAUTO_ISO_LUT_MAX))
+    {
+        return HI_FAILURE;
+    }
+
+    for (i = 1; i < s32IsoCount; i++)
+    {
+        if ((pu32IsoThresh[i] <= pu32IsoThresh[i - 1])
+            || (MapISO(pu32IsoThresh[i]) <= MapISO(pu32IsoThresh[i - 1])))
+        {
+            return HI_FAILURE;
+        }
+    }
+
+    for (s32Index = SCENEAUTO_ISO_INDEX_MIN; s32Index <= SCENEAUTO_ISO_INDEX_MAX; s32Index++)
+    {
+        u32Iso = (s32Index > 0) ? Sceneauto_IndexToIso(s32Index) : (HI_U32)(-s32Index);
+        Sceneauto_Calc3dnr(s32IsoCount, pu32IsoThresh, pst3dnrParam, u32Iso,
+                           &pstLut->ast3dnr[s32Index - SCENEAUTO_ISO_INDEX_MIN]);
+    }
+
+    pstLut->bValid = HI_TRUE;
+
+    return HI_SUCCESS;
+}
+
+HI_VOID Sceneauto_Get3dnr(const SCENEAUTO_3DNR_LUT_S *pstLut, HI_U32 u32Iso, SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnr)
+{
+    if ((HI_TRUE != pstLut->bValid) || (u32Iso > SCENEAUTO_ISO_LUT_MAX))
+    {
+        Sceneauto_Calc3dnr(pstLut->s32IsoCount, pstLut->pu32IsoThresh, pstLut->pst3dnrParam, u32Iso, pst3dnr);
+        return;
+    }
+
+    memcpy(pst3dnr, &pstLut->ast3dnr[Sceneauto_IsoIndex(u32Iso) - SCENEAUTO_ISO_INDEX_MIN], sizeof(*pst3dnr));
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
@@ -1,7 +1,11 @@
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
+#include <unistd.h>
 #include <pthread.h>
 #include <sys/prctl.h>
+#include <poll.h>
+#include <sys/inotify.h>
 #include "hi_type.h"
 //#include "hi_confaccess.h"
 #include "iniparser.h"
@@ -10,6 +14,8 @@
 #include "hi_sceneauto_define.h"
 #include "hi_srdk_sceneauto_define_ext.h"
 #include "hi_srdk_sceneauto_ext.h"
+#include "hi_sceneauto_binpara.h"
+#include "hi_sceneauto_lut.h"
 
 
 #ifdef __cplusplus
@@ -38,6 +44,8 @@ pthread_mutex_t g_stSceneautoLock = PTHREAD_MUTEX_INITIALIZER;
 
 pthread_t g_pthSceneAutoNormal;
 pthread_t g_pthSceneAutoSpecial;
+pthread_t g_pthSceneAutoReload;
+HI_BOOL g_bReloadThreadFlag = HI_FALSE;
 
 #define CHECK_SCENEAUTO_INIT()\
     do{\
@@ -72,6 +80,48 @@ pthread_t g_pthSceneAutoSpecial;
         }\
     }while(0)
     
+/* adapt layer call accounting, see HI_SRDK_SCENEAUTO_GetStat */
+#define SCENEAUTO_MPI_GET(call)     (g_stSceneautoStat.u64MpiGetCalls++, (call))
+#define SCENEAUTO_MPI_SET(call)     (g_stSceneautoStat.u64MpiSetCalls++, (call))
+
+/* VENC, RGBIR, DRC, WDR and defog attributes are re-read every N cycles */
+#define SCENEAUTO_ATTR_REFRESH_CYCLE        4
+/* default exposure hysteresis band in percent, common:ExpHysteresis */
+#define SCENEAUTO_EXP_HYSTERESIS_DEFAULT    5
+/* special thread poll period when neither HLC auto nor DIS is enabled, in us */
+#define SCENEAUTO_SPECIAL_IDLE_SLEEP        500000
+
+static SRDK_SCENEAUTO_STAT_S g_stSceneautoStat;
+static HI_U64 g_u64SceneautoStatTime = 0;
+static HI_U64 g_u64SceneautoStatCalls = 0;
+
+/* 3DNR parameters of every iso index, rebuilt whenever g_stINIPara is loaded */
+static SCENEAUTO_3DNR_LUT_S g_st3dnrLut;
+static SCENEAUTO_3DNR_LUT_S g_stHLC3dnrLut;
+static SCENEAUTO_3DNR_LUT_S g_stIR3dnrLut;
+
+/* reload thread poll period and how long an edited ini must stay quiet before it is parsed, in ms */
+#define SCENEAUTO_RELOAD_POLL_TIME          500
+#define SCENEAUTO_RELOAD_SETTLE_TIME        200
+#define SCENEAUTO_RELOAD_EVENT_BUF          1024
+#define SCENEAUTO_FILE_NAME_LEN             256
+
+/* an edited ini parsed by the reload thread, waiting for the normal thread to swap it in */
+typedef struct hiSCENEAUTO_RELOAD_S
+{
+    HI_BOOL bPending;
+    HI_U32 u32SectionMask;              /* changed ini sections */
+    HI_U32 u32LoaderMask;               /* g_astSceneautoSection entries parsed into stShadowPara */
+    HI_U64 u64EventTime;
+    HI_U64 u64ParseTime;
+    dictionary *pShadowDict;
+    SCENEAUTO_INIPARA_S stShadowPara;
+}SCENEAUTO_RELOAD_S;
+
+static HI_CHAR g_szSceneautoIniFile[SCENEAUTO_FILE_NAME_LEN];
+static SCENEAUTO_RELOAD_S g_stSceneautoReload;
+static SRDK_SCENEAUTO_RELOAD_STATUS_S g_stSceneautoReloadStatus;
+    
 static __inline int iClip2(int x, int b)       {{ if (x < 0) x = 0; };{ if (x > b) x = b; }; return x; }
 static __inline int iMin2(int a, int b)         {{ if (a > b) a = b; }; return a; }
 static __inline int iMax2(int a, int b)       {{ if (a > b) b = a; }; return b; }
@@ -216,47 +266,13 @@ HI_S32 DrcStrISO(HI_S16 s16Index)
     return s16Weight;
 }
 
-static int MapISO(int iso)
-{
-  int   j,  i = (iso >= 200);
-  i += ( (iso >= (200 << 1)) + (iso >= (400 << 1)) + (iso >= (400 << 2)) + (iso >= (400 << 3)) + (iso >= (400 << 4)) );
-  i += ( (iso >= (400 << 5)) + (iso >= (400 << 6)) + (iso >= (400 << 7)) + (iso >= (400 << 8)) + (iso >= (400 << 9)) );
-  j  = ( (iso >  (112 << i)) + (iso >  (125 << i)) + (iso >  (141 << i)) + (iso >  (158 << i)) + (iso >  (178 << i)) );
-  return (i * 6 + j + (iso >= 25) + (iso >= 50) + (iso >= 100));  
-}
-
-HI_VOID Interpolate(SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrcfg, HI_U32 u32Mid, 
-                                const SCENEAUTO_INIPARAM_3DNRCFG_S *pstL3dnrcfg, HI_U32 u32Left,  
-                                const SCENEAUTO_INIPARAM_3DNRCFG_S *pstR3dnrcfg, HI_U32 u32Right)
-{
-  int   k, left, right, i = ((u32Mid > 3) ? MapISO(u32Mid) : iMin2(71,-u32Mid));  
-  left  = ((u32Left  > 3) ? MapISO(u32Left) : iMin2(71,-u32Left) ); if (i <= left)  { *pst3dnrcfg = *pstL3dnrcfg; return; }
-  right = ((u32Right > 3) ? MapISO(u32Right): iMin2(71,-u32Right)); if (i >= right) { *pst3dnrcfg = *pstR3dnrcfg; return; }
-  k = (right - left); *pst3dnrcfg = *(( (i+((k * 3) >> 2)) < right ) ? pstL3dnrcfg : pstR3dnrcfg);
-  pst3dnrcfg->s32YPKStr = ( ((right - i) * pstL3dnrcfg->s32YPKStr + (i - left) * pstR3dnrcfg->s32YPKStr + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YSFStr = ( ((right - i) * pstL3dnrcfg->s32YSFStr + (i - left) * pstR3dnrcfg->s32YSFStr + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YTFStr = ( ((right - i) * pstL3dnrcfg->s32YTFStr + (i - left) * pstR3dnrcfg->s32YTFStr + (k >> 1)) / k ); 
-  pst3dnrcfg->s32TFStrMax = ( ((right - i) * pstL3dnrcfg->s32TFStrMax + (i - left) * pstR3dnrcfg->s32TFStrMax + (k >> 1)) / k ); 
-  pst3dnrcfg->s32TFStrMov = ( ((right - i) * pstL3dnrcfg->s32TFStrMov + (i - left) * pstR3dnrcfg->s32TFStrMov + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YSmthStr = ( ((right - i) * pstL3dnrcfg->s32YSmthStr + (i - left) * pstR3dnrcfg->s32YSmthStr + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YSmthRat = ( ((right - i) * pstL3dnrcfg->s32YSmthRat + (i - left) * pstR3dnrcfg->s32YSmthRat + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YSFBriRat = ( ((right - i) * pstL3dnrcfg->s32YSFBriRat + (i - left) * pstR3dnrcfg->s32YSFBriRat + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YSFStrDl = ( ((right - i) * pstL3dnrcfg->s32YSFStrDl + (i - left) * pstR3dnrcfg->s32YSFStrDl + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YSFStrDlt = ( ((right - i) * pstL3dnrcfg->s32YSFStrDlt + (i - left) * pstR3dnrcfg->s32YSFStrDlt + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YTFStrDlt = ( ((right - i) * pstL3dnrcfg->s32YTFStrDlt + (i - left) * pstR3dnrcfg->s32YTFStrDlt + (k >> 1)) / k );
-  pst3dnrcfg->s32YTFStrDl = ( ((right - i) * pstL3dnrcfg->s32YTFStrDl + (i - left) * pstR3dnrcfg->s32YTFStrDl + (k >> 1)) / k ); 
-  pst3dnrcfg->s32CTFstr = ( ((right - i) * pstL3dnrcfg->s32CTFstr + (i - left) * pstR3dnrcfg->s32CTFstr + (k >> 1)) / k );
-  pst3dnrcfg->s32CSFStr = ( ((right - i) * pstL3dnrcfg->s32CSFStr + (i - left) * pstR3dnrcfg->s32CSFStr + (k >> 1)) / k ); 
-  pst3dnrcfg->s32YTFMdWin = ( ((right - i) * pstL3dnrcfg->s32YTFMdWin + (i - left) * pstR3dnrcfg->s32YTFMdWin + (k >> 1)) / k );
-} 
-
 HI_S32 SceneAuto_SetDRC()
 {
     HI_S32 s32Ret = HI_SUCCESS;
     HI_S32 s32IspDev;
     ADPT_SCENEAUTO_DRCATTR_S stAdptDRCAttr;
     s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -276,7 +292,7 @@ HI_S32 SceneAuto_SetDRC()
     stAdptDRCAttr.u8SecondPole         = g_stINIPara.stDRC.u8SecondPole;
     stAdptDRCAttr.u8SpatialVar         = g_stINIPara.stDRC.u8SpatialVar;
 	stAdptDRCAttr.u8Stretch            = g_stINIPara.stDRC.u8Stretch;
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
@@ -301,7 +317,7 @@ HI_S32 SceneAuto_SetDynamic()
         stAdptAERoute.astRouteNode[i].u32SysGain = g_stINIPara.stFastDynamic.pstRouteNode[i].u32SysGain;
     }
 
-    s32Ret = CommSceneautoSetAERoute(s32IspDev, &stAdptAERoute);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAERoute(s32IspDev, &stAdptAERoute));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAERoute failed\n");
@@ -328,7 +344,7 @@ HI_S32 SceneAuto_SetHLC()
     s32ViDev = g_stINIPara.stMpInfo.s32ViDev;
 
     //AE
-    s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAEAttr failed\n");
@@ -341,7 +357,7 @@ HI_S32 SceneAuto_SetHLC()
     stAdptAEAttr.u8Tolerance = g_stINIPara.stHLC.u8Tolerance;
     stAdptAEAttr.u16HistRatioSlope = g_stINIPara.stHLC.u16HistRatioSlope;
     stAdptAEAttr.u8MaxHistOffset = g_stINIPara.stHLC.u8MaxHistOffset;
-    s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAEAttr failed\n");
@@ -349,7 +365,7 @@ HI_S32 SceneAuto_SetHLC()
     }
 
     //DCI
-    s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIParam);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDCIParam failed\n");
@@ -359,7 +375,7 @@ HI_S32 SceneAuto_SetHLC()
     stAdptDCIParam.u32BlackGain = g_stINIPara.stHLC.u32DCIBlackGain;
     stAdptDCIParam.u32ContrastGain = g_stINIPara.stHLC.u32DCIContrastGain;
     stAdptDCIParam.u32LightGain = g_stINIPara.stHLC.u32DCILightGain;
-    s32Ret = CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIParam);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDCIParam failed\n");
@@ -367,7 +383,7 @@ HI_S32 SceneAuto_SetHLC()
     }
 
     //DRC
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -376,7 +392,7 @@ HI_S32 SceneAuto_SetHLC()
     stAdptDRCAttr.bEnable = g_stINIPara.stHLC.bDRCEnable;
     stAdptDRCAttr.bManulEnable = g_stINIPara.stHLC.bDRCManulEnable;
     stAdptDRCAttr.u8Strength = g_stINIPara.stHLC.u32DRCStrengthTarget;
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
@@ -384,7 +400,7 @@ HI_S32 SceneAuto_SetHLC()
     }
 
     //SATURATION
-    s32Ret = CommSceneautoGetSaturation(s32IspDev, &stAdptSaturation);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSaturation(s32IspDev, &stAdptSaturation));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetSaturation failed\n");
@@ -395,7 +411,7 @@ HI_S32 SceneAuto_SetHLC()
     {
         stAdptSaturation.au8AutoSat[i] = g_stINIPara.stHLC.u8Saturation[i];
     }
-    s32Ret = CommSceneautoSetSaturation(s32IspDev, &stAdptSaturation);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSaturation(s32IspDev, &stAdptSaturation));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetSaturation failed\n");
@@ -408,7 +424,7 @@ HI_S32 SceneAuto_SetHLC()
         stAdptGamma.au16GammaTable[i] = g_stINIPara.stHLC.u16GammaTable[i];
     }
     stAdptGamma.u8CurveType = 2;
-    s32Ret = CommSceneautoSetGamma(s32IspDev, &stAdptGamma);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetGamma(s32IspDev, &stAdptGamma));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetGamma failed\n");
@@ -416,7 +432,7 @@ HI_S32 SceneAuto_SetHLC()
     }
 
     //sharpen
-    s32Ret = CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetSharpen failed\n");
@@ -432,7 +448,7 @@ HI_S32 SceneAuto_SetHLC()
         stAdptSharpen.u8TextureNoiseThd[i] = g_stINIPara.stHLC.u8TextureNoiseThd[i];
         stAdptSharpen.u8EdgeNoiseThd[i] = g_stINIPara.stHLC.u8EdgeNoiseThd[i];
     }
-    s32Ret = CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetSharpen failed\n");
@@ -462,7 +478,7 @@ HI_S32 SceneAuto_SetIR()
     s32ViDev = g_stINIPara.stMpInfo.s32ViDev;
     
 
-    s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAEAttr failed\n");
@@ -484,7 +500,7 @@ HI_S32 SceneAuto_SetIR()
         }
     }
     
-    s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAEAttr failed\n");
@@ -492,7 +508,7 @@ HI_S32 SceneAuto_SetIR()
     }
 
     //WB
-    s32Ret = CommSceneautoGetWB(s32IspDev, &stAdptWB);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetWB(s32IspDev, &stAdptWB));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetWB failed\n");
@@ -505,7 +521,7 @@ HI_S32 SceneAuto_SetIR()
     stAdptWB.u16Gbgain = 0x100;
     stAdptWB.u16Bgain  = 0x100;
     
-    s32Ret = CommSceneautoSetWB(s32IspDev, &stAdptWB);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetWB(s32IspDev, &stAdptWB));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetWB failed\n");
@@ -513,7 +529,7 @@ HI_S32 SceneAuto_SetIR()
     }
 
     //RGBIR
-    s32Ret = CommSceneautoGetRgbirParam(s32IspDev, &stRgbirParam);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetRgbirParam(s32IspDev, &stRgbirParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetRgbirParam failed\n");
@@ -523,7 +539,7 @@ HI_S32 SceneAuto_SetIR()
     if (stRgbirParam.bEnable)
     {
         stRgbirParam.bRemovelEn = 0;
-        s32Ret = CommSceneautoSetRgbirParam(s32IspDev, &stRgbirParam);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetRgbirParam(s32IspDev, &stRgbirParam));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetRgbirParam failed\n");
@@ -531,7 +547,7 @@ HI_S32 SceneAuto_SetIR()
         }
     }
 
-    s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIParam);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDCIParam failed\n");
@@ -541,13 +557,13 @@ HI_S32 SceneAuto_SetIR()
     stAdptDCIParam.u32BlackGain = g_stINIPara.stIR.u32DCIBlackGain;
     stAdptDCIParam.u32ContrastGain = g_stINIPara.stIR.u32DCIContrastGain;
     stAdptDCIParam.u32LightGain = g_stINIPara.stIR.u32DCILightGain;
-    s32Ret = CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIParam);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDCIParam failed\n");
         return HI_FAILURE;
     }
-    s32Ret = CommSceneautoGetDP(s32ViDev, &stAdptDP);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDP(s32ViDev, &stAdptDP));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDP failed\n");
@@ -559,14 +575,14 @@ HI_S32 SceneAuto_SetIR()
         stAdptDP.u16Slope[i] = g_stINIPara.stIR.u16Slope[i];
     }
     
-    s32Ret = CommSceneautoSetDP(s32ViDev,&stAdptDP);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDP(s32ViDev,&stAdptDP));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDP failed\n");
         return HI_FAILURE;
     }
 
-    s32Ret = CommSceneautoGetSaturation(s32IspDev, &stSaturation);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSaturation(s32IspDev, &stSaturation));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetSaturation failed\n");
@@ -574,14 +590,14 @@ HI_S32 SceneAuto_SetIR()
     }
     stSaturation.u8OpType = 1;
     stSaturation.u8ManualSat = 0;
-    s32Ret = CommSceneautoSetSaturation(s32IspDev, &stSaturation);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSaturation(s32IspDev, &stSaturation));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetSaturation failed\n");
         return HI_FAILURE;
     } 
 	#if 0
-    s32Ret = CommSceneautoGetDemosaic(s32IspDev, &stAdptDemosaic);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDemosaic(s32IspDev, &stAdptDemosaic));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDemosaic failed\n");
@@ -591,7 +607,7 @@ HI_S32 SceneAuto_SetIR()
     {
         stAdptDemosaic.au8LumThresh[i] = g_stINIPara.stIR.au8LumThresh[i];
     }
-    s32Ret = CommSceneautoSetDemosaic(s32IspDev, &stAdptDemosaic);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDemosaic(s32IspDev, &stAdptDemosaic));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDemosaic failed\n");
@@ -599,7 +615,7 @@ HI_S32 SceneAuto_SetIR()
     }
     #endif
 
-    s32Ret = CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetSharpen failed\n");
@@ -615,7 +631,7 @@ HI_S32 SceneAuto_SetIR()
         stAdptSharpen.u8TextureNoiseThd[i] = g_stINIPara.stIR.u8TextureNoiseThd[i];
         stAdptSharpen.u8EdgeNoiseThd[i] = g_stINIPara.stIR.u8EdgeNoiseThd[i];
     }
-    s32Ret = CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetSharpen failed\n");
@@ -627,7 +643,7 @@ HI_S32 SceneAuto_SetIR()
         stAdptGamma.au16GammaTable[i] = g_stINIPara.stIR.u16GammaTable[i];
     }
     stAdptGamma.u8CurveType = 2;
-    s32Ret = CommSceneautoSetGamma(s32IspDev, &stAdptGamma);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetGamma(s32IspDev, &stAdptGamma));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetGamma failed\n");
@@ -645,7 +661,7 @@ HI_S32 SceneAuto_SetBLC()
 
     s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
 
-    s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAEAttr failed\n");
@@ -656,7 +672,7 @@ HI_S32 SceneAuto_SetBLC()
     stAdptAEAttr.u16HistRatioSlope = g_stINIPara.stBLC.u16HistRatioSlope;
     stAdptAEAttr.u8MaxHistOffset = g_stINIPara.stBLC.u8MaxHistOffset;
 
-    s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAEAttr failed\n");
@@ -674,7 +690,7 @@ HI_S32 SceneAuto_HLCAutoOn()
     ADPT_SCENEAUTO_DRCATTR_S stAdptDRCAttr;
     s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
 
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -683,7 +699,7 @@ HI_S32 SceneAuto_HLCAutoOn()
     stAdptDRCAttr.bEnable = HI_FALSE;
     stAdptDRCAttr.bManulEnable = HI_TRUE;
     stAdptDRCAttr.u8Strength = 0;
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
@@ -691,7 +707,7 @@ HI_S32 SceneAuto_HLCAutoOn()
     }
 
     usleep(100000);
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -700,14 +716,14 @@ HI_S32 SceneAuto_HLCAutoOn()
     stAdptDRCAttr.bEnable = HI_TRUE;
     stAdptDRCAttr.bManulEnable = HI_TRUE;
     stAdptDRCAttr.u8Strength = 0;
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
         return HI_FAILURE;
     }
 
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -716,7 +732,7 @@ HI_S32 SceneAuto_HLCAutoOn()
     stAdptDRCAttr.bEnable = HI_TRUE;
     stAdptDRCAttr.bManulEnable = HI_TRUE;
     stAdptDRCAttr.u8Strength = 0;
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
@@ -726,7 +742,7 @@ HI_S32 SceneAuto_HLCAutoOn()
 
     for (i = 1; i < 128; i++)
     {
-        s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetDRCAttr failed\n");
@@ -735,7 +751,7 @@ HI_S32 SceneAuto_HLCAutoOn()
         stAdptDRCAttr.bEnable = HI_TRUE;
         stAdptDRCAttr.bManulEnable = HI_TRUE;
         stAdptDRCAttr.u8Strength = i;
-        s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetDRCAttr failed\n");
@@ -755,7 +771,7 @@ HI_S32 SceneAuto_HLCAutoOff()
     ADPT_SCENEAUTO_DRCATTR_S stAdptDRCAttr;
     s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
 
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -765,7 +781,7 @@ HI_S32 SceneAuto_HLCAutoOff()
     for (i = stAdptDRCAttr.u8Strength; i >= 0; i--)
     {
         stAdptDRCAttr.u8Strength = i;
-        s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetDRCAttr failed\n");
@@ -777,7 +793,7 @@ HI_S32 SceneAuto_HLCAutoOff()
     stAdptDRCAttr.bEnable = HI_FALSE;
     stAdptDRCAttr.bManulEnable = HI_FALSE;
     stAdptDRCAttr.u8Strength = 0;
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
@@ -792,7 +808,7 @@ HI_S32 SceneAuto_SetDemosaic(HI_S32 s32IspDev, HI_S32 s32DemosaicExpLevel, HI_S3
     HI_S32 s32Ret = HI_SUCCESS;
     ADPT_SCENEAUTO_DEMOSAIC_S stAdptDemosaic;
 
-    s32Ret = CommSceneautoGetDemosaic(s32IspDev, &stAdptDemosaic);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDemosaic(s32IspDev, &stAdptDemosaic));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDemosaic failed\n");
@@ -804,7 +820,7 @@ HI_S32 SceneAuto_SetDemosaic(HI_S32 s32IspDev, HI_S32 s32DemosaicExpLevel, HI_S3
     stAdptDemosaic.u8AaSlope = g_stINIPara.stIniDemosaic.pstDemosaic[s32DemosaicBitrateLevel * g_stINIPara.stIniDemosaic.s32ExpCount + s32DemosaicExpLevel].u8AaSlope;
     stAdptDemosaic.u8VhSlope = g_stINIPara.stIniDemosaic.pstDemosaic[s32DemosaicBitrateLevel * g_stINIPara.stIniDemosaic.s32ExpCount + s32DemosaicExpLevel].u8VhSlope;
 
-    s32Ret = CommSceneautoSetDemosaic(s32IspDev, &stAdptDemosaic);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDemosaic(s32IspDev, &stAdptDemosaic));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDemosaic failed\n");
@@ -822,7 +838,7 @@ HI_S32 SceneAuto_SetAERealtedBit(HI_S32 s32IspDev, HI_S32 s32AEBitrateLevel)
 
     if ((SRDK_SCENEAUTO_SPECIAL_SCENE_IR != g_eSpecialScene) && (SRDK_SCENEAUTO_SPECIAL_SCENE_BLC != g_eSpecialScene) && (SRDK_SCENEAUTO_SPECIAL_SCENE_HLC != g_eSpecialScene))
     {
-        s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetAEAttr failed\n");
@@ -835,7 +851,7 @@ HI_S32 SceneAuto_SetAERealtedBit(HI_S32 s32IspDev, HI_S32 s32AEBitrateLevel)
         stAdptAEAttr.u16WhiteDelayFrame = g_stINIPara.stIniAE.pstAERelatedBit[s32AEBitrateLevel].u16WhiteDelayFrame;
         stAdptAEAttr.u32SysGainMax = g_stINIPara.stIniAE.pstAERelatedBit[s32AEBitrateLevel].u32SysGainMax;
 
-        s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetAEAttr failed\n");
@@ -855,7 +871,7 @@ HI_S32 SceneAuto_SetSharpen(HI_S32 s32IspDev, HI_S32 s32SharpenBitrateLevel)
 
     if ((SRDK_SCENEAUTO_SPECIAL_SCENE_IR != g_eSpecialScene)&&(SRDK_SCENEAUTO_SPECIAL_SCENE_HLC != g_eSpecialScene))
     {
-        s32Ret = CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen);
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetSharpen failed\n");
@@ -869,7 +885,7 @@ HI_S32 SceneAuto_SetSharpen(HI_S32 s32IspDev, HI_S32 s32SharpenBitrateLevel)
             stAdptSharpen.au8SharpenUd[i] = g_stINIPara.stIniSharpen.pstSharpen[s32SharpenBitrateLevel].au8SharpenUd[i];
         }
 
-        s32Ret = CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetSharpen failed\n");
@@ -884,7 +900,7 @@ HI_S32 SceneAuto_SetH265FaceCfg(HI_S32 s32VencChn, HI_S32 s32H265FaceCfgExpLevel
 {
     HI_S32 s32Ret = HI_SUCCESS;
     ADPT_SCENEAUTO_H265_FACE_CFG_S stAdptH265FaceCfg;
-    s32Ret = CommSceneautoGetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetH265FaceCfg failed\n");
@@ -978,7 +994,7 @@ HI_S32 SceneAuto_SetH265FaceCfg(HI_S32 s32VencChn, HI_S32 s32H265FaceCfgExpLevel
     stAdptH265FaceCfg.u32Hedge16MaxNum_P    = g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[s32H265FaceCfgBitrateLevel * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + s32H265FaceCfgExpLevel].u32Hedge16MaxNum_P;
     stAdptH265FaceCfg.u32Hedge32ProtectNum_P = g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[s32H265FaceCfgBitrateLevel * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + s32H265FaceCfgExpLevel].u32Hedge32ProtectNum_P;
     stAdptH265FaceCfg.u32Hedge16ProtectNum_P = g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[s32H265FaceCfgBitrateLevel * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + s32H265FaceCfgExpLevel].u32Hedge16ProtectNum_P;
-    s32Ret = CommSceneautoSetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetH265FaceCfg failed\n");
@@ -991,7 +1007,7 @@ HI_S32 SceneAuto_SetH265RcParam(HI_S32 s32VencChn, HI_S32 s32VencBitrateLevel)
     HI_S32 s32Ret = HI_SUCCESS;
     HI_S32 i;
     ADPT_SCENEAUTO_H265_RCPARAM_S stAdptH265RCParam;
-    s32Ret = CommSceneautoGetH265RcParam(s32VencChn, &stAdptH265RCParam);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH265RcParam(s32VencChn, &stAdptH265RCParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetH265RcParam failed\n");
@@ -1004,7 +1020,7 @@ HI_S32 SceneAuto_SetH265RcParam(HI_S32 s32VencChn, HI_S32 s32VencBitrateLevel)
         stAdptH265RCParam.u32ThrdI[i] = g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[s32VencBitrateLevel].u32ThrdI[i];
         stAdptH265RCParam.u32ThrdP[i] = g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[s32VencBitrateLevel].u32ThrdP[i];
     }
-    s32Ret = CommSceneautoSetH265RcParam(s32VencChn, &stAdptH265RCParam);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH265RcParam(s32VencChn, &stAdptH265RCParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetH265RcParam failed\n");
@@ -1018,7 +1034,7 @@ HI_S32 SceneAuto_SetH264RcParam(HI_S32 s32VencChn, HI_S32 s32VencBitrateLevel)
     HI_S32 i;
     ADPT_SCENEAUTO_H264_RCPARAM_S stAdptH264RCParam;
 
-    s32Ret = CommSceneautoGetH264RcParam(s32VencChn, &stAdptH264RCParam);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH264RcParam(s32VencChn, &stAdptH264RCParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetH264RcParam failed\n");
@@ -1033,7 +1049,7 @@ HI_S32 SceneAuto_SetH264RcParam(HI_S32 s32VencChn, HI_S32 s32VencBitrateLevel)
     }
     stAdptH264RCParam.s32IPQPDelta = g_stINIPara.stIniH264Venc.pstH264Venc[s32VencBitrateLevel].s32IPQPDelta;
 
-    s32Ret = CommSceneautoSetH264RcParam(s32VencChn, &stAdptH264RCParam);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH264RcParam(s32VencChn, &stAdptH264RCParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetH264RcParam failed\n");
@@ -1048,7 +1064,7 @@ HI_S32 SceneAuto_SetH264Debolck(HI_S32 s32VencChn, HI_S32 s32VencBitrateLevel)
     HI_S32 s32Ret = HI_SUCCESS;
     ADPT_SCENEAUTO_H264_DEBLOCK_S stAdptH264Deblock;
 
-    s32Ret = CommSceneautoGetH24Deblock(s32VencChn, &stAdptH264Deblock);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH24Deblock(s32VencChn, &stAdptH264Deblock));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetH24Deblock failed\n");
@@ -1058,7 +1074,7 @@ HI_S32 SceneAuto_SetH264Debolck(HI_S32 s32VencChn, HI_S32 s32VencBitrateLevel)
     stAdptH264Deblock.disable_deblocking_filter_idc = g_stINIPara.stIniH264Venc.pstH264Venc[s32VencBitrateLevel].stH264Dblk.disable_deblocking_filter_idc;
     stAdptH264Deblock.slice_alpha_c0_offset_div2 = g_stINIPara.stIniH264Venc.pstH264Venc[s32VencBitrateLevel].stH264Dblk.slice_alpha_c0_offset_div2;
     stAdptH264Deblock.slice_beta_offset_div2 = g_stINIPara.stIniH264Venc.pstH264Venc[s32VencBitrateLevel].stH264Dblk.slice_beta_offset_div2;
-    s32Ret = CommSceneautoSetH24Deblock(s32VencChn, &stAdptH264Deblock);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH24Deblock(s32VencChn, &stAdptH264Deblock));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetH24Deblock failed\n");
@@ -1073,7 +1089,7 @@ HI_S32 SceneAuto_SetH264Trans(HI_S32  s32VencChn, HI_S32 s32VencBitrateLevel)
     HI_S32 s32Ret = HI_SUCCESS;
     ADPT_SCENEAUTO_H264TRANS_S stAdptH264Trans;
 
-    s32Ret = CommSceneautoGetH264Trans(s32VencChn, &stAdptH264Trans);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH264Trans(s32VencChn, &stAdptH264Trans));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetH264Trans failed\n");
@@ -1081,7 +1097,7 @@ HI_S32 SceneAuto_SetH264Trans(HI_S32  s32VencChn, HI_S32 s32VencBitrateLevel)
     }
 
     stAdptH264Trans.chroma_qp_index_offset = g_stINIPara.stIniH264Venc.pstH264Venc[s32VencBitrateLevel].s32chroma_qp_index_offset;
-	s32Ret = CommSceneautoSetH264Trans(s32VencChn, &stAdptH264Trans);
+	s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH264Trans(s32VencChn, &stAdptH264Trans));
 	if (HI_SUCCESS != s32Ret)
 	{
 		printf("CommSceneautoSetH264Trans failed\n");
@@ -1098,7 +1114,7 @@ HI_S32 SceneAuto_SetDP(HI_S32 s32IspDev, HI_S32 s32DpExpLevel)
 
     if ((SRDK_SCENEAUTO_SPECIAL_SCENE_IR != g_eSpecialScene))
     {
-        s32Ret = CommSceneautoGetDP(s32IspDev, &stAdptDp);
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDP(s32IspDev, &stAdptDp));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetDP failed\n");
@@ -1106,7 +1122,7 @@ HI_S32 SceneAuto_SetDP(HI_S32 s32IspDev, HI_S32 s32DpExpLevel)
         }
 
         stAdptDp.u16Slope = g_stINIPara.stIniDP.pstDPAttr[s32DpExpLevel].u16Slope;
-        s32Ret = CommSceneautoSetDP(s32IspDev, &stAdptDp);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDP(s32IspDev, &stAdptDp));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetDP failed\n");
@@ -1125,7 +1141,7 @@ HI_S32 SceneAuto_SetSharpen(HI_S32 s32IspDev, HI_S32 s32SharpenExpLevel)
     ADPT_SCENEAUTO_SHARPEN_S stAdptSharpen;
     if (SRDK_SCENEAUTO_SPECIAL_SCENE_IR != g_eSpecialScene)
     {
-       s32Ret = CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen);
+       s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetSharpen failed\n");
@@ -1141,7 +1157,7 @@ HI_S32 SceneAuto_SetSharpen(HI_S32 s32IspDev, HI_S32 s32SharpenExpLevel)
 	  stAdptSharpen.u8TextureNoiseThd[i] = g_stINIPara.stIniSharpen.pstSharpen[s32SharpenExpLevel].u8TextureNoiseThd[i];
 	  stAdptSharpen.u8EdgeNoiseThd[i] = g_stINIPara.stIniSharpen.pstSharpen[s32SharpenExpLevel].u8EdgeNoiseThd[i];
      	}
-      s32Ret = CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen);
+      s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetSharpen failed\n");
@@ -1183,7 +1199,7 @@ HI_S32 SceneAuto_SetGamma(HI_S32 s32IspDev, HI_S32 s32GammaExpLevel, HI_S32 s32L
             }
             stAdptGamma.u8CurveType = g_stINIPara.stIniGamma.pstGamma[s32GammaExpLevel].u8CurveType;
 
-            s32Ret = CommSceneautoSetGamma(s32IspDev, &stAdptGamma);
+            s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetGamma(s32IspDev, &stAdptGamma));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoSetGamma failed\n");
@@ -1210,7 +1226,7 @@ HI_S32 SceneAuto_SetDefaultGamma()
     }
     stAdptGamma.u8CurveType = 2;
 
-    s32Ret = CommSceneautoSetGamma(s32IspDev, &stAdptGamma);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetGamma(s32IspDev, &stAdptGamma));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetGamma failed\n");
@@ -1225,7 +1241,7 @@ HI_S32 Scenauto_SetIRAERealtedExp(HI_S32 s32IspDev, HI_S32 s32IRAECurPos)
     HI_S32 s32Ret = HI_SUCCESS;
     ADPT_SCENEAUTO_AEATTR_S stAdptAEAttr;
 
-    s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAEAttr failed\n");
@@ -1235,7 +1251,7 @@ HI_S32 Scenauto_SetIRAERealtedExp(HI_S32 s32IspDev, HI_S32 s32IRAECurPos)
     stAdptAEAttr.u8ExpCompensation = g_stINIPara.stIR.pu8ExpCompensation[s32IRAECurPos];
     stAdptAEAttr.u8MaxHistOffset = g_stINIPara.stIR.pu8MaxHistOffset[s32IRAECurPos];
 
-    s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAEAttr failed\n");
@@ -1252,7 +1268,7 @@ HI_S32 Scenauto_SetAERealtedExp(HI_S32 s32IspDev, HI_S32 s32AECurPos)
 
     if ((SRDK_SCENEAUTO_SPECIAL_SCENE_IR != g_eSpecialScene) && (SRDK_SCENEAUTO_SPECIAL_SCENE_BLC != g_eSpecialScene) && (SRDK_SCENEAUTO_SPECIAL_SCENE_HLC != g_eSpecialScene))
     {
-        s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetAEAttr failed\n");
@@ -1262,7 +1278,7 @@ HI_S32 Scenauto_SetAERealtedExp(HI_S32 s32IspDev, HI_S32 s32AECurPos)
         stAdptAEAttr.u8ExpCompensation = g_stINIPara.stIniAE.pstAERelatedExp[s32AECurPos].u8AECompesation;
         stAdptAEAttr.u8MaxHistOffset = g_stINIPara.stIniAE.pstAERelatedExp[s32AECurPos].u8AEHistOffset;;
 
-        s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoSetAEAttr failed\n");
@@ -1294,7 +1310,7 @@ HI_S32 Sceneauto_Set3DNR(HI_U32 s32VpssGrp, SCENEAUTO_INIPARAM_3DNRCFG_S stScene
     stAdptSceneauto3dnr.s32CTFstr    = stSceneauto3dnr.s32CTFstr;
     stAdptSceneauto3dnr.s32YTFMdWin  = stSceneauto3dnr.s32YTFMdWin;    
 
-    s32Ret = CommSceneautoSet3DNRAttr(s32VpssGrp, &stAdptSceneauto3dnr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSet3DNRAttr(s32VpssGrp, &stAdptSceneauto3dnr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSet3DNR failed\n");
@@ -1307,7 +1323,7 @@ HI_S32 Sceneauto_IVEStop()
 {
     HI_S32 s32Ret = HI_SUCCESS;
 
-    s32Ret = CommSceneautoIVEStop();
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoIVEStop());
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoIVEStop failed\n");
@@ -1325,7 +1341,7 @@ HI_S32 Sceneauto_IVEStart()
 
     s32VpssGrp = g_stINIPara.stMpInfo.s32VpssGrp;
     s32VpssChn = g_stINIPara.stMpInfo.s32VpssChn;
-    s32Ret = CommSceneautoIVEStart(s32VpssGrp, s32VpssChn);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoIVEStart(s32VpssGrp, s32VpssChn));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoIVEStart failed\n");
@@ -1352,7 +1368,7 @@ HI_S32 SceneAuto_SetAERoute()
         stAdptAERoute.astRouteNode[i].u32SysGain = g_stINIPara.stNormalDynamic.pstRouteNode[i].u32SysGain;
     }
 
-    s32Ret = CommSceneautoSetAERoute(s32IspDev, &stAdptAERoute);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAERoute(s32IspDev, &stAdptAERoute));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAERoute failed\n");
@@ -1409,7 +1425,7 @@ HI_S32 SceneAuto_SetPreviousPara()
         stAdptSharpen.u8TextureNoiseThd[i] = g_stPreviousPara.stSharpen.u8TextureNoiseThd[i];
         stAdptSharpen.u8EdgeNoiseThd[i] = g_stPreviousPara.stSharpen.u8EdgeNoiseThd[i];
     }
-    s32Ret = CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetSharpen failed\n");
@@ -1421,7 +1437,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     {
         stAdptDP.u16Slope[i] = g_stPreviousPara.stDP.u16Slope[i];
     }
-    s32Ret = CommSceneautoSetDP(s32IspDev, &stAdptDP);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDP(s32IspDev, &stAdptDP));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDP failed\n");
@@ -1435,7 +1451,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     stAdptWB.u16Grgain = g_stPreviousPara.stWB.u16Grgain;
     stAdptWB.u16Rgain = g_stPreviousPara.stWB.u16Rgain;
 
-    s32Ret = CommSceneautoSetWB(s32IspDev, &stAdptWB);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetWB(s32IspDev, &stAdptWB));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetWB failed\n");
@@ -1448,7 +1464,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     {
         stAdptGamma.au16GammaTable[i] = g_stPreviousPara.stGamma.u16Table[i];
     }
-    s32Ret = CommSceneautoSetGamma(s32IspDev, &stAdptGamma);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetGamma(s32IspDev, &stAdptGamma));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetGamma failed\n");
@@ -1465,7 +1481,7 @@ HI_S32 SceneAuto_SetPreviousPara()
         stAdptCcmAttr.au16MidCCM[i] = g_stPreviousPara.stCcm.au16MidCCM[i];
         stAdptCcmAttr.au16LowCCM[i] = g_stPreviousPara.stCcm.au16LowCCM[i];
     }
-    s32Ret = CommSceneautoSetCcmAttr(s32IspDev, &stAdptCcmAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetCcmAttr(s32IspDev, &stAdptCcmAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetCcmAttr failed\n");
@@ -1478,7 +1494,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     stAdptAcmAttr.u32GainHue = g_stPreviousPara.stAcm.u32GainHue;
     stAdptAcmAttr.u32GainLuma = g_stPreviousPara.stAcm.u32GainLuma;
     stAdptAcmAttr.u32GainSat = g_stPreviousPara.stAcm.u32GainSat;
-    s32Ret = CommSceneautoSetAcmAttr(s32IspDev, &stAdptAcmAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAcmAttr(s32IspDev, &stAdptAcmAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAcmAttr failed\n");
@@ -1489,7 +1505,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     switch (g_eVencRcMode)
     {
         case ADPT_SCENEAUTO_RCMODE_H264:
-            s32Ret = CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetVencAttr failed\n");
@@ -1500,7 +1516,7 @@ HI_S32 SceneAuto_SetPreviousPara()
                 stAdptH264Deblock.disable_deblocking_filter_idc = g_stPreviousPara.stH264Venc.stH264Dblk.disable_deblocking_filter_idc;
                 stAdptH264Deblock.slice_alpha_c0_offset_div2 = g_stPreviousPara.stH264Venc.stH264Dblk.slice_alpha_c0_offset_div2;
                 stAdptH264Deblock.slice_beta_offset_div2 = g_stPreviousPara.stH264Venc.stH264Dblk.slice_beta_offset_div2;
-                s32Ret = CommSceneautoSetH24Deblock(s32VencChn, &stAdptH264Deblock);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH24Deblock(s32VencChn, &stAdptH264Deblock));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetH24Deblock failed\n");
@@ -1508,7 +1524,7 @@ HI_S32 SceneAuto_SetPreviousPara()
                 }
 
                 stAdptH264Trans.chroma_qp_index_offset = g_stPreviousPara.stH264Venc.s32chroma_qp_index_offset;
-                s32Ret = CommSceneautoSetH264Trans(s32VencChn, &stAdptH264Trans);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH264Trans(s32VencChn, &stAdptH264Trans));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetH264Trans failed\n");
@@ -1522,7 +1538,7 @@ HI_S32 SceneAuto_SetPreviousPara()
                     stAdptH264RcParam.u32ThrdI[i] = g_stPreviousPara.stH264Venc.u32ThrdI[i];
                     stAdptH264RcParam.u32ThrdP[i] = g_stPreviousPara.stH264Venc.u32ThrdP[i];
                 }
-                s32Ret = CommSceneautoSetH264RcParam(s32VencChn, &stAdptH264RcParam);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH264RcParam(s32VencChn, &stAdptH264RcParam));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetH264RcParam failed\n");
@@ -1531,7 +1547,7 @@ HI_S32 SceneAuto_SetPreviousPara()
             }
             break;
         case ADPT_SCENEAUTO_RCMODE_H265:
-            s32Ret = CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetVencAttr failed\n");
@@ -1546,7 +1562,7 @@ HI_S32 SceneAuto_SetPreviousPara()
                     stAdptH265RcParam.u32ThrdI[i] = g_stPreviousPara.stH265Venc.stH265VencRcParam.u32ThrdI[i];
                     stAdptH265RcParam.u32ThrdP[i] = g_stPreviousPara.stH265Venc.stH265VencRcParam.u32ThrdP[i];
                 }
-                s32Ret = CommSceneautoSetH265RcParam(s32VencChn, &stAdptH265RcParam);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH265RcParam(s32VencChn, &stAdptH265RcParam));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoGetH265RcParam failed\n");
@@ -1642,7 +1658,7 @@ HI_S32 SceneAuto_SetPreviousPara()
                     stAdptH265FaceCfg.u32Hedge32ProtectNum_P = g_stPreviousPara.stH265Venc.stH265VencFaceCfg.u32Hedge32ProtectNum_P;
                     stAdptH265FaceCfg.u32Hedge16ProtectNum_P = g_stPreviousPara.stH265Venc.stH265VencFaceCfg.u32Hedge16ProtectNum_P;
                 }
-                s32Ret = CommSceneautoSetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetH265FaceCfg failed\n");
@@ -1661,7 +1677,7 @@ HI_S32 SceneAuto_SetPreviousPara()
         stAdptAERoute.astRouteNode[i].u32IntTime = g_stPreviousPara.stAERoute.astRouteNode[i].u32IntTime;
         stAdptAERoute.astRouteNode[i].u32SysGain = g_stPreviousPara.stAERoute.astRouteNode[i].u32SysGain;
     }
-    s32Ret = CommSceneautoSetAERoute(s32IspDev, &stAdptAERoute);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAERoute(s32IspDev, &stAdptAERoute));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAERoute failed\n");
@@ -1673,7 +1689,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     stAdptDCIPara.u32BlackGain = g_stPreviousPara.stDCIParam.u32BlackGain;
     stAdptDCIPara.u32ContrastGain = g_stPreviousPara.stDCIParam.u32ContrastGain;
     stAdptDCIPara.u32LightGain = g_stPreviousPara.stDCIParam.u32LightGain;
-    s32Ret = CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIPara);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIPara));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDCIParam failed\n");
@@ -1696,7 +1712,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     stAdptDRCAttr.u8Stretch = g_stPreviousPara.stDRCAttr.u8Stretch;
     stAdptDRCAttr.u8Strength = g_stPreviousPara.stDRCAttr.u8Strength;
     
-    s32Ret = CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDRCAttr failed\n");
@@ -1710,7 +1726,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     {
         stAdptSaturation.au8AutoSat[i] = g_stPreviousPara.stSaturation.au8AutoSat[i];
     }
-    s32Ret = CommSceneautoSetSaturation(s32IspDev, &stAdptSaturation);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSaturation(s32IspDev, &stAdptSaturation));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -1719,7 +1735,7 @@ HI_S32 SceneAuto_SetPreviousPara()
 
     //DIS
     stAdptDISAttr.bEnable = g_stPreviousPara.stDis.bEnable;
-    s32Ret = CommSceneautoSetDISAttr(s32IspDev, &stAdptDISAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDISAttr(s32IspDev, &stAdptDISAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDISAttr failed\n");
@@ -1744,7 +1760,7 @@ HI_S32 SceneAuto_SetPreviousPara()
             stAdptAEAttr.au8AeWeight[i][j] = g_stPreviousPara.stAEAttr.au8AeWeight[i][j];
         }
     }    
-    s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAEAttr failed\n");
@@ -1754,7 +1770,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     //RGBIR
     stAdptRgbirParam.bEnable = g_stPreviousPara.stRgbirParam.bEnable;
     stAdptRgbirParam.bRemovelEn = g_stPreviousPara.stRgbirParam.bRemovelEn;
-    s32Ret = CommSceneautoSetRgbirParam(s32IspDev, &stAdptRgbirParam);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetRgbirParam(s32IspDev, &stAdptRgbirParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetRgbirParam failed\n");
@@ -1776,7 +1792,7 @@ HI_S32 SceneAuto_SetPreviousPara()
     stAdpt3dnrAttr.s32YSFBriRat = g_stPreviousPara.st3dnr.s32YSFBriRat;
     stAdpt3dnrAttr.s32CSFStr    = g_stPreviousPara.st3dnr.s32CSFStr;
     stAdpt3dnrAttr.s32CTFstr    = g_stPreviousPara.st3dnr.s32CTFstr; 
-    s32Ret = CommSceneautoSet3DNRAttr(s32IspDev, &stAdpt3dnrAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSet3DNRAttr(s32IspDev, &stAdpt3dnrAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSet3DNRAttr failed\n");
@@ -1821,7 +1837,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     //s32VpssGrp = g_stINIPara.stMpInfo.s32VpssGrp;
 
     //sharpen
-    s32Ret = CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen));
     if (HI_SUCCESS != s32Ret)
     {
         printf("Adpt_GetDemosaic failed\n");
@@ -1839,7 +1855,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //DP
-    s32Ret = CommSceneautoGetDP(s32IspDev, &stAdptDP);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDP(s32IspDev, &stAdptDP));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDP failed\n");
@@ -1852,7 +1868,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //WB
-    s32Ret = CommSceneautoGetWB(s32IspDev, &stAdptWB);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetWB(s32IspDev, &stAdptWB));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetWB failed\n");
@@ -1866,7 +1882,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     g_stPreviousPara.stWB.u16Bgain = stAdptWB.u16Bgain;
     
     //gamma
-    s32Ret = CommSceneautoGetGamma(s32IspDev, &stAdptGamma);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetGamma(s32IspDev, &stAdptGamma));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetGamma failed\n");
@@ -1879,7 +1895,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //ccm
-    s32Ret = CommSceneautoGetCcmAttr(s32IspDev, &stAdptCcmAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetCcmAttr(s32IspDev, &stAdptCcmAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetCcmAttr failed\n");
@@ -1896,7 +1912,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //acm
-    s32Ret = CommSceneautoGetAcmAttr(s32IspDev, &stAdptAcmAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAcmAttr(s32IspDev, &stAdptAcmAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAcmAttr failed\n");
@@ -1909,7 +1925,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     g_stPreviousPara.stAcm.u32GainSat = stAdptAcmAttr.u32GainSat;
 
     //venc
-    s32Ret = CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetVencAttr failed\n");
@@ -1921,7 +1937,7 @@ HI_S32 Sceneauto_GetPreviousPara()
         case ADPT_SCENEAUTO_RCMODE_H264:
             g_eVencRcMode = ADPT_SCENEAUTO_RCMODE_H264;
 
-            s32Ret = CommSceneautoGetH24Deblock(s32VencChn, &stAdptH264Deblock);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH24Deblock(s32VencChn, &stAdptH264Deblock));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetH24Deblock failed\n");
@@ -1931,7 +1947,7 @@ HI_S32 Sceneauto_GetPreviousPara()
             g_stPreviousPara.stH264Venc.stH264Dblk.slice_alpha_c0_offset_div2 = stAdptH264Deblock.slice_alpha_c0_offset_div2;
             g_stPreviousPara.stH264Venc.stH264Dblk.slice_beta_offset_div2 = stAdptH264Deblock.slice_beta_offset_div2;
 
-            s32Ret = CommSceneautoGetH264Trans(s32VencChn, &stAdptH264Trans);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH264Trans(s32VencChn, &stAdptH264Trans));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetH264Trans failed\n");
@@ -1939,7 +1955,7 @@ HI_S32 Sceneauto_GetPreviousPara()
             }
             g_stPreviousPara.stH264Venc.s32chroma_qp_index_offset = stAdptH264Trans.chroma_qp_index_offset;
 
-            s32Ret = CommSceneautoGetH264RcParam(s32VencChn, &stAdptH264RcParam);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH264RcParam(s32VencChn, &stAdptH264RcParam));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetRcParam failed\n");
@@ -1956,7 +1972,7 @@ HI_S32 Sceneauto_GetPreviousPara()
             break;
         case ADPT_SCENEAUTO_RCMODE_H265:
             g_eVencRcMode = ADPT_SCENEAUTO_RCMODE_H265;
-            s32Ret = CommSceneautoGetH265RcParam(s32VencChn, &stAdptH265RcParam);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH265RcParam(s32VencChn, &stAdptH265RcParam));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetH265RcParam failed\n");
@@ -1969,7 +1985,7 @@ HI_S32 Sceneauto_GetPreviousPara()
                 g_stPreviousPara.stH265Venc.stH265VencRcParam.u32ThrdI[i] = stAdptH265RcParam.u32ThrdI[i];
                 g_stPreviousPara.stH265Venc.stH265VencRcParam.u32ThrdP[i] = stAdptH265RcParam.u32ThrdP[i];
             }
-            s32Ret = CommSceneautoGetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetH265FaceCfg(s32VencChn, &stAdptH265FaceCfg));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetH265FaceCfg failed\n");
@@ -2071,7 +2087,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //AERoute
-    s32Ret = CommSceneautoGetAERoute(s32IspDev, &stAdptAERoute);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAERoute(s32IspDev, &stAdptAERoute));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAERoute failed\n");
@@ -2085,7 +2101,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //DCI
-    s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIPara);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIPara));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDCIParam failed\n");
@@ -2097,7 +2113,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     g_stPreviousPara.stDCIParam.u32LightGain = stAdptDCIPara.u32LightGain;
 
     //DRC
-    s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDRCAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDRCAttr failed\n");
@@ -2119,7 +2135,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     g_stPreviousPara.stDRCAttr.u8SpatialVar = stAdptDRCAttr.u8SpatialVar;
 
     //Saturation
-    s32Ret = CommSceneautoGetSaturation(s32IspDev, &stAdptSaturation);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSaturation(s32IspDev, &stAdptSaturation));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetSaturation failed\n");
@@ -2133,7 +2149,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //DIS
-    s32Ret = CommSceneautoGetDISAttr(s32IspDev, &stAdptDISAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDISAttr(s32IspDev, &stAdptDISAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDISAttr failed\n");
@@ -2142,7 +2158,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     g_stPreviousPara.stDis.bEnable = stAdptDISAttr.bEnable;
 
     //AE
-    s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAEAttr failed\n");
@@ -2168,7 +2184,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     }
 
     //RGBIR
-    s32Ret = CommSceneautoGetRgbirParam(s32IspDev, &stAdptRgbirParam);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetRgbirParam(s32IspDev, &stAdptRgbirParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetRgbirParam failed\n");
@@ -2178,7 +2194,7 @@ HI_S32 Sceneauto_GetPreviousPara()
     g_stPreviousPara.stRgbirParam.bRemovelEn = stAdptRgbirParam.bRemovelEn;
 #if 0
     //3dnr
-    s32Ret = CommSceneautoGet3DNRAttr(s32VpssGrp, &stAdpt3dnrAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGet3DNRAttr(s32VpssGrp, &stAdpt3dnrAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGet3DNRAttr failed\n");
@@ -2202,6 +2218,12 @@ HI_S32 Sceneauto_GetPreviousPara()
 
 HI_VOID Sceneauto_FreeMem()
 {
+    /* the arrays point into the blob mapping, nothing was malloc'd */
+    if (HI_TRUE == Sceneauto_IsBinParaMapped(&g_stINIPara))
+    {
+        Sceneauto_UnmapBinPara(&g_stINIPara);
+        return;
+    }
 
     if (NULL != g_stINIPara.stIniAE.pu32BitrateThresh)
     {
@@ -2257,6 +2279,12 @@ HI_VOID Sceneauto_FreeMem()
         g_stINIPara.stIniSharpen.pu32BitrateThresh = NULL;
     }
 
+    if (NULL != g_stINIPara.stIniSharpen.pu32ExpThresh)
+    {
+        free(g_stINIPara.stIniSharpen.pu32ExpThresh);
+        g_stINIPara.stIniSharpen.pu32ExpThresh = NULL;
+    }
+
     if (NULL != g_stINIPara.stIniSharpen.pstSharpen)
     {
         free(g_stINIPara.stIniSharpen.pstSharpen);
@@ -2410,187 +2438,185 @@ HI_VOID Sceneauto_FreeMem()
     }
 }
 
-HI_S32 Sceneauto_LoadINIPara()
+static HI_S32 Sceneauto_LoadCommonPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
 {
     HI_S32 s32Temp = 0;
-    HI_S32 s32Offset = 0;
-    HI_S32 i, j;
-    HI_CHAR szTempStr[128];
+    HI_S32 i;
     HI_CHAR* pszTempStr;
 
     /**************common:IspDev**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:IspDev", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:IspDev", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:IspDev failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32IspDev = s32Temp;
+    pstPara->stMpInfo.s32IspDev = s32Temp;
 
     /**************common:ViDev**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:ViDev", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:ViDev", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:ViDev failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32ViDev = s32Temp;
+    pstPara->stMpInfo.s32ViDev = s32Temp;
 
     /**************common:ViChn**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:ViChn", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:ViChn", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:ViChn failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32ViChn = s32Temp;
+    pstPara->stMpInfo.s32ViChn = s32Temp;
 
     /**************common:VpssGrp**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:VpssGrp", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:VpssGrp", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:VpssGrp failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32VpssGrp = s32Temp;
+    pstPara->stMpInfo.s32VpssGrp = s32Temp;
 
     /**************common:VpssChn**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:VpssChn", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:VpssChn", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:VpssChn failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32VpssChn = s32Temp;
+    pstPara->stMpInfo.s32VpssChn = s32Temp;
 
     /**************common:VencGrp**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:VencGrp", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:VencGrp", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:VencGrp failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32VencGrp = s32Temp;
+    pstPara->stMpInfo.s32VencGrp = s32Temp;
 
     /**************common:VencChn**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:VencChn", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:VencChn", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:VencChn failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stMpInfo.s32VencChn = s32Temp;
+    pstPara->stMpInfo.s32VencChn = s32Temp;
     
     /**************common:IVE_Enable**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:IVE_Enable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:IVE_Enable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:IVE_Enable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.bIVEEnable = (HI_BOOL)s32Temp;
+    pstPara->stThreshValue.bIVEEnable = (HI_BOOL)s32Temp;
 
     /**************common:HLC_AutoEnable**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:HLC_AutoEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:HLC_AutoEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:HLC_AutoEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.bHLCAutoEnable = (HI_BOOL)s32Temp;
+    pstPara->stThreshValue.bHLCAutoEnable = (HI_BOOL)s32Temp;
 
     /**************common:HLC_thr_on**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:HLC_thr_on", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:HLC_thr_on", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:HLC_thr_on failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32HLCOnThresh = s32Temp;
+    pstPara->stThreshValue.u32HLCOnThresh = s32Temp;
 
     /**************common:HLC_thr_off**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:HLC_thr_off", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:HLC_thr_off", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:HLC_thr_off failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32HLCOffThresh = s32Temp;
+    pstPara->stThreshValue.u32HLCOffThresh = s32Temp;
 
     /**************common:HLC_tolerance**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:HLC_tolerance", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:HLC_tolerance", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:HLC_tolerance failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32HLCTolerance = s32Temp;
+    pstPara->stThreshValue.u32HLCTolerance = s32Temp;
 
     /**************common:HLC_expthr**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:HLC_expthr", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:HLC_expthr", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:HLC_expthr failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32HLCExpThresh = s32Temp;
+    pstPara->stThreshValue.u32HLCExpThresh = s32Temp;
 
     /**************common:HLC_count**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:HLC_count", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:HLC_count", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:HLC_count failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32HLCCount = s32Temp;
+    pstPara->stThreshValue.u32HLCCount = s32Temp;
 
     /**************common:ave_lum_thresh**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:ave_lum_thresh", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:ave_lum_thresh", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:ave_lum_thresh failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32AveLumThresh = s32Temp;
+    pstPara->stThreshValue.u32AveLumThresh = s32Temp;
 
     /**************common:delta_dis_expthresh**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:delta_dis_expthresh", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:delta_dis_expthresh", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:delta_dis_expthresh failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32DeltaDisExpThreash = s32Temp;
+    pstPara->stThreshValue.u32DeltaDisExpThreash = s32Temp;
 
 #if 0
     /**************common:fpn_exp_thresh**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:fpn_exp_thresh", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:fpn_exp_thresh", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:fpn_exp_thresh failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32FpnExpThresh = s32Temp;
+    pstPara->stThreshValue.u32FpnExpThresh = s32Temp;
 #endif
     /**************common:dci_strength_lut**************/
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "common:dci_strength_lut");
+    pszTempStr = iniparser_getstr(pDict, "common:dci_strength_lut");
     if(NULL == pszTempStr)
     {
         printf("common:dci_strength_lut error\n");
@@ -2599,215 +2625,246 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.au8DciStrengthLut[i] = MAEWeight[i];
+        pstPara->au8DciStrengthLut[i] = MAEWeight[i];
     } 
 
     /**************common:u32DRCStrengthThresh**************/
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "common:u32DRCStrengthThresh", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "common:u32DRCStrengthThresh", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("common:u32DRCStrengthThresh failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stThreshValue.u32DRCStrengthThresh = s32Temp;
+    pstPara->stThreshValue.u32DRCStrengthThresh = s32Temp;
+
+    /**************common:ExpHysteresis**************/
+    s32Temp = 0;
+    s32Temp = iniparser_getint(pDict, "common:ExpHysteresis", SCENEAUTO_EXP_HYSTERESIS_DEFAULT);
+    if ((s32Temp < 0) || (s32Temp > 100))
+    {
+        printf("common:ExpHysteresis failed\n");
+        return HI_FAILURE;
+    }
+    pstPara->stThreshValue.u32ExpHysteresis = s32Temp;
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadAEPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 i;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
 
     /**************AE**************/
     //AE:aeRunInterval
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "AE:aeRunInterval", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "AE:aeRunInterval", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("AE:aeRunInterval failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniAE.u8AERunInterval = s32Temp;
+    pstPara->stIniAE.u8AERunInterval = s32Temp;
     
     //AE:aeBitrateCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "AE:aeBitrateCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "AE:aeBitrateCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("AE:aeBitrateCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniAE.s32BitrateCount = s32Temp;
-    g_stINIPara.stIniAE.pu32BitrateThresh = (HI_U32*)malloc((g_stINIPara.stIniAE.s32BitrateCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniAE.pu32BitrateThresh);
-    g_stINIPara.stIniAE.pstAERelatedBit = (SCENEAUTO_AERELATEDBIT_S*)malloc((g_stINIPara.stIniAE.s32BitrateCount) * sizeof(SCENEAUTO_AERELATEDBIT_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniAE.pstAERelatedBit);
+    pstPara->stIniAE.s32BitrateCount = s32Temp;
+    pstPara->stIniAE.pu32BitrateThresh = (HI_U32*)malloc((pstPara->stIniAE.s32BitrateCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniAE.pu32BitrateThresh);
+    pstPara->stIniAE.pstAERelatedBit = (SCENEAUTO_AERELATEDBIT_S*)malloc((pstPara->stIniAE.s32BitrateCount) * sizeof(SCENEAUTO_AERELATEDBIT_S));
+    CHECK_NULL_PTR(pstPara->stIniAE.pstAERelatedBit);
 
     //AE:aeBitrateThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "AE:aeBitrateThresh");
+    pszTempStr = iniparser_getstr(pDict, "AE:aeBitrateThresh");
     if (NULL == pszTempStr)
     {
         printf("AE:aeBitrateThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniAE.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniAE.s32BitrateCount; i++)
     {
-        g_stINIPara.stIniAE.pu32BitrateThresh[i] = MAEWeight[i];
+        pstPara->stIniAE.pu32BitrateThresh[i] = MAEWeight[i];
     }
 
-    for (i = 0; i < g_stINIPara.stIniAE.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniAE.s32BitrateCount; i++)
     {
         //AE:u8Speed
         snprintf(szTempStr, sizeof(szTempStr), "AE:u8Speed_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("AE:u8Speed_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniAE.pstAERelatedBit[i].u8Speed = s32Temp;
+        pstPara->stIniAE.pstAERelatedBit[i].u8Speed = s32Temp;
 
         //AE:u8Tolerance
         snprintf(szTempStr, sizeof(szTempStr), "AE:u8Tolerance_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("AE:u8Tolerance_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniAE.pstAERelatedBit[i].u8Tolerance = s32Temp;
+        pstPara->stIniAE.pstAERelatedBit[i].u8Tolerance = s32Temp;
 
         //AE:u16BlackDelayFrame
         snprintf(szTempStr, sizeof(szTempStr), "AE:u16BlackDelayFrame_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("AE:u16BlackDelayFrame_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniAE.pstAERelatedBit[i].u16BlackDelayFrame = s32Temp;
+        pstPara->stIniAE.pstAERelatedBit[i].u16BlackDelayFrame = s32Temp;
 
         //AE:u16WhiteDelayFrame
         snprintf(szTempStr, sizeof(szTempStr), "AE:u16WhiteDelayFrame_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("AE:u16WhiteDelayFrame_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniAE.pstAERelatedBit[i].u16WhiteDelayFrame = s32Temp;
+        pstPara->stIniAE.pstAERelatedBit[i].u16WhiteDelayFrame = s32Temp;
         snprintf(szTempStr, sizeof(szTempStr), "AE:u32SysGainMax_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("AE:u32SysGainMax_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniAE.pstAERelatedBit[i].u32SysGainMax = s32Temp;
+        pstPara->stIniAE.pstAERelatedBit[i].u32SysGainMax = s32Temp;
     }
     //AE:aeExpCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "AE:aeExpCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "AE:aeExpCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("AE:aeExpCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniAE.s32ExpCount = s32Temp;
-    g_stINIPara.stIniAE.pu32AEExpDtoLThresh = (HI_U32*)malloc((g_stINIPara.stIniAE.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniAE.pu32AEExpDtoLThresh);
-    g_stINIPara.stIniAE.pu32AEExpLtoDThresh = (HI_U32*)malloc((g_stINIPara.stIniAE.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniAE.pu32AEExpLtoDThresh);
-    g_stINIPara.stIniAE.pstAERelatedExp = (SCENEAUTO_AERELATEDEXP_S*)malloc((g_stINIPara.stIniAE.s32ExpCount) * sizeof(SCENEAUTO_AERELATEDEXP_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniAE.pstAERelatedExp );
+    pstPara->stIniAE.s32ExpCount = s32Temp;
+    pstPara->stIniAE.pu32AEExpDtoLThresh = (HI_U32*)malloc((pstPara->stIniAE.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniAE.pu32AEExpDtoLThresh);
+    pstPara->stIniAE.pu32AEExpLtoDThresh = (HI_U32*)malloc((pstPara->stIniAE.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniAE.pu32AEExpLtoDThresh);
+    pstPara->stIniAE.pstAERelatedExp = (SCENEAUTO_AERELATEDEXP_S*)malloc((pstPara->stIniAE.s32ExpCount) * sizeof(SCENEAUTO_AERELATEDEXP_S));
+    CHECK_NULL_PTR(pstPara->stIniAE.pstAERelatedExp );
     //AE:aeExpDtoLThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "AE:aeExpDtoLThresh");
+    pszTempStr = iniparser_getstr(pDict, "AE:aeExpDtoLThresh");
     if (NULL == pszTempStr)
     {
         printf("AE:aeExpDtoLThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniAE.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniAE.s32ExpCount; i++)
     {
-        g_stINIPara.stIniAE.pu32AEExpDtoLThresh[i] = MAEWeight[i];
+        pstPara->stIniAE.pu32AEExpDtoLThresh[i] = MAEWeight[i];
     }
     //AE:aeExpLtoDThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "AE:aeExpLtoDThresh");
+    pszTempStr = iniparser_getstr(pDict, "AE:aeExpLtoDThresh");
     if (NULL == pszTempStr)
     {
         printf("AE:aeExpLtoDThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniAE.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniAE.s32ExpCount; i++)
     {
-        g_stINIPara.stIniAE.pu32AEExpLtoDThresh[i] = MAEWeight[i];
+        pstPara->stIniAE.pu32AEExpLtoDThresh[i] = MAEWeight[i];
     }
     //AE:aeCompesation
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "AE:aeCompesation");
+    pszTempStr = iniparser_getstr(pDict, "AE:aeCompesation");
     if (NULL == pszTempStr)
     {
         printf("AE:aeCompesation error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniAE.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniAE.s32ExpCount; i++)
     {
-        g_stINIPara.stIniAE.pstAERelatedExp[i].u8AECompesation = MAEWeight[i];
+        pstPara->stIniAE.pstAERelatedExp[i].u8AECompesation = MAEWeight[i];
     }
     //AE:aeHistOffset
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "AE:aeHistOffset");
+    pszTempStr = iniparser_getstr(pDict, "AE:aeHistOffset");
     if (NULL == pszTempStr)
     {
         printf("AE:aeHistOffset error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniAE.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniAE.s32ExpCount; i++)
     {
-        g_stINIPara.stIniAE.pstAERelatedExp[i].u8AEHistOffset = MAEWeight[i];
+        pstPara->stIniAE.pstAERelatedExp[i].u8AEHistOffset = MAEWeight[i];
     }
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadSharpenPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 i, j;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
 	/**************sharpen**************/
 	//sharpen:IsoThresh
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "sharpen:IsoThresh", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "sharpen:IsoThresh", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
     	printf("sharpen:IsoThresh failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniSharpen.s32IsoThresh = s32Temp;
+    pstPara->stIniSharpen.s32IsoThresh = s32Temp;
 	//sharpen:ExpCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "sharpen:ExpCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "sharpen:ExpCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
     	printf("sharpen:ExpCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniSharpen.s32ExpCount = s32Temp;
-    g_stINIPara.stIniSharpen.pu32ExpThresh = (HI_U32 *)malloc((g_stINIPara.stIniSharpen.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniSharpen.pu32ExpThresh);
-    g_stINIPara.stIniSharpen.pstSharpen = (SCENEAUTO_SHARPEN_S *)malloc((g_stINIPara.stIniSharpen.s32ExpCount) * sizeof(SCENEAUTO_SHARPEN_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniSharpen.pstSharpen);
+    pstPara->stIniSharpen.s32ExpCount = s32Temp;
+    pstPara->stIniSharpen.pu32ExpThresh = (HI_U32 *)malloc((pstPara->stIniSharpen.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniSharpen.pu32ExpThresh);
+    pstPara->stIniSharpen.pstSharpen = (SCENEAUTO_SHARPEN_S *)malloc((pstPara->stIniSharpen.s32ExpCount) * sizeof(SCENEAUTO_SHARPEN_S));
+    CHECK_NULL_PTR(pstPara->stIniSharpen.pstSharpen);
     //sharpen:ExpThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "sharpen:ExpThresh");
+    pszTempStr = iniparser_getstr(pDict, "sharpen:ExpThresh");
     if (NULL == pszTempStr)
     {
         printf("sharpen:ExpThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniSharpen.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniSharpen.s32ExpCount; i++)
     {
-        g_stINIPara.stIniSharpen.pu32ExpThresh[i] = MAEWeight[i];
+        pstPara->stIniSharpen.pu32ExpThresh[i] = MAEWeight[i];
     }
-	 for (i = 0; i < g_stINIPara.stIniSharpen.s32ExpCount; i++)
+	 for (i = 0; i < pstPara->stIniSharpen.s32ExpCount; i++)
 	 {
 	//sharpen:abEnLowLumaShoot
 		snprintf(szTempStr, sizeof(szTempStr), "sharpen:abEnLowLumaShoot_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:abEnLowLumaShoot_%d error\n", i);
@@ -2816,11 +2873,11 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].abEnLowLumaShoot[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].abEnLowLumaShoot[j] = MAEWeight[j];
 		}
 	//sharpen:SharpenD
         snprintf(szTempStr, sizeof(szTempStr), "sharpen:SharpenD_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:SharpenD_%d error\n", i);
@@ -2829,11 +2886,11 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].u8SharpenD[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].u8SharpenD[j] = MAEWeight[j];
 		}
 	//sharpen:SharpenUd
        snprintf(szTempStr, sizeof(szTempStr), "sharpen:SharpenUd_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:SharpenUd_%d error\n", i);
@@ -2842,11 +2899,11 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].u8SharpenUd[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].u8SharpenUd[j] = MAEWeight[j];
 		}
 	//sharpen:TextureNoiseThd
         snprintf(szTempStr, sizeof(szTempStr), "sharpen:TextureNoiseThd_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:TextureNoiseThd_%d error\n", i);
@@ -2855,11 +2912,11 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].u8TextureNoiseThd[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].u8TextureNoiseThd[j] = MAEWeight[j];
 		}
 	//sharpen:EdgeNoiseThd
         snprintf(szTempStr, sizeof(szTempStr), "sharpen:EdgeNoiseThd_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:EdgeNoiseThd_%d error\n", i);
@@ -2868,11 +2925,11 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].u8EdgeNoiseThd[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].u8EdgeNoiseThd[j] = MAEWeight[j];
 		}
 	//sharpen:overshoot
         snprintf(szTempStr, sizeof(szTempStr), "sharpen:overshoot_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:overshoot_%d error\n", i);
@@ -2881,11 +2938,11 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].u8OverShoot[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].u8OverShoot[j] = MAEWeight[j];
 		}
 	//sharpen:undershoot
     snprintf(szTempStr, sizeof(szTempStr), "sharpen:undershoot_%d", i);
-		pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+		pszTempStr = iniparser_getstr(pDict, szTempStr);
 		if(NULL == pszTempStr)
 		{
 		printf("sharpen:undershoot_%d error\n", i);
@@ -2894,77 +2951,89 @@ HI_S32 Sceneauto_LoadINIPara()
 		s32Temp = Weight(pszTempStr);		 
 		for (j = 0; j < EXPOSURE_LEVEL; j++)
 		{
-		g_stINIPara.stIniSharpen.pstSharpen[i].u8UnderShoot[j] = MAEWeight[j];
+		pstPara->stIniSharpen.pstSharpen[i].u8UnderShoot[j] = MAEWeight[j];
 		}
 	 	}
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadGammaPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 s32Offset = 0;
+    HI_S32 i, j;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
     /**************gamma**************/
     //gamma:DelayCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "gamma:DelayCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "gamma:DelayCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("gamma:DelayCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniGamma.u32DelayCount = s32Temp;
+    pstPara->stIniGamma.u32DelayCount = s32Temp;
 
     //gamma:Interval
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "gamma:Interval", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "gamma:Interval", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("gamma:Interval failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniGamma.s32Interval = s32Temp;
+    pstPara->stIniGamma.s32Interval = s32Temp;
 
     //gamma:ExpCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "gamma:ExpCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "gamma:ExpCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("gamma:ExpCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniGamma.s32ExpCount = s32Temp;
+    pstPara->stIniGamma.s32ExpCount = s32Temp;
 
-    g_stINIPara.stIniGamma.pu32ExpThreshLtoD = (HI_U32*)malloc((g_stINIPara.stIniGamma.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniGamma.pu32ExpThreshLtoD);
-    g_stINIPara.stIniGamma.pu32ExpThreshDtoL = (HI_U32*)malloc((g_stINIPara.stIniGamma.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniGamma.pu32ExpThreshDtoL);
-    g_stINIPara.stIniGamma.pstGamma = (SCENEAUTO_GAMMA_S*)malloc((g_stINIPara.stIniGamma.s32ExpCount) * sizeof(SCENEAUTO_GAMMA_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniGamma.pstGamma);
+    pstPara->stIniGamma.pu32ExpThreshLtoD = (HI_U32*)malloc((pstPara->stIniGamma.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniGamma.pu32ExpThreshLtoD);
+    pstPara->stIniGamma.pu32ExpThreshDtoL = (HI_U32*)malloc((pstPara->stIniGamma.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniGamma.pu32ExpThreshDtoL);
+    pstPara->stIniGamma.pstGamma = (SCENEAUTO_GAMMA_S*)malloc((pstPara->stIniGamma.s32ExpCount) * sizeof(SCENEAUTO_GAMMA_S));
+    CHECK_NULL_PTR(pstPara->stIniGamma.pstGamma);
     //gamma:ExpThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "gamma:ExpThreshLtoD");
+    pszTempStr = iniparser_getstr(pDict, "gamma:ExpThreshLtoD");
     if (NULL == pszTempStr)
     {
         printf("gamma:ExpThreshLtoD error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniGamma.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniGamma.s32ExpCount; i++)
     {
-        g_stINIPara.stIniGamma.pu32ExpThreshLtoD[i] = MAEWeight[i];
+        pstPara->stIniGamma.pu32ExpThreshLtoD[i] = MAEWeight[i];
     }
     //gamma:ExpThreshDtoL
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "gamma:ExpThreshDtoL");
+    pszTempStr = iniparser_getstr(pDict, "gamma:ExpThreshDtoL");
     if (NULL == pszTempStr)
     {
         printf("gamma:ExpThreshDtoL error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniGamma.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniGamma.s32ExpCount; i++)
     {
-        g_stINIPara.stIniGamma.pu32ExpThreshDtoL[i] = MAEWeight[i];
+        pstPara->stIniGamma.pu32ExpThreshDtoL[i] = MAEWeight[i];
     }
     //gammatable
-    for (i = 0; i < g_stINIPara.stIniGamma.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniGamma.s32ExpCount; i++)
     {
         s32Offset = 0;
         
         snprintf(szTempStr, sizeof(szTempStr), "gamma:gamma.0_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("gamma:gamma.0_%d error\n", i);
@@ -2973,12 +3042,12 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < s32Temp; j++)
         {
-            g_stINIPara.stIniGamma.pstGamma[i].u16Table[j] = MAEWeight[j];
+            pstPara->stIniGamma.pstGamma[i].u16Table[j] = MAEWeight[j];
         }
         s32Offset += s32Temp;
 
         sprintf(szTempStr, "gamma:gamma.1_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("gamma:gamma.1_%d error\n", i);
@@ -2987,12 +3056,12 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < s32Temp; j++)
         {
-            g_stINIPara.stIniGamma.pstGamma[i].u16Table[s32Offset + j] = MAEWeight[j];
+            pstPara->stIniGamma.pstGamma[i].u16Table[s32Offset + j] = MAEWeight[j];
         }
         s32Offset += s32Temp;
 
         sprintf(szTempStr, "gamma:gamma.2_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("gamma:gamma.2_%d error\n", i);
@@ -3001,110 +3070,120 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < s32Temp; j++)
         {
-            g_stINIPara.stIniGamma.pstGamma[i].u16Table[s32Offset + j] = MAEWeight[j];
+            pstPara->stIniGamma.pstGamma[i].u16Table[s32Offset + j] = MAEWeight[j];
         }
 
-        g_stINIPara.stIniGamma.pstGamma[i].u8CurveType = 2;
+        pstPara->stIniGamma.pstGamma[i].u8CurveType = 2;
     }
 
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadH264VencPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 i, j;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
     /**************h264venc**************/
     //h264venc:vencBitrateCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "h264venc:vencBitrateCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "h264venc:vencBitrateCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("h264venc:vencBitrateCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniH264Venc.s32BitrateCount = s32Temp;
-    g_stINIPara.stIniH264Venc.pu32BitrateThresh = (HI_U32*)malloc((g_stINIPara.stIniH264Venc.s32BitrateCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniH264Venc.pu32BitrateThresh);
-    g_stINIPara.stIniH264Venc.pstH264Venc = (SCENEAUTO_H264VENC_S*)malloc((g_stINIPara.stIniH264Venc.s32BitrateCount) * sizeof(SCENEAUTO_H264VENC_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniH264Venc.pstH264Venc);
+    pstPara->stIniH264Venc.s32BitrateCount = s32Temp;
+    pstPara->stIniH264Venc.pu32BitrateThresh = (HI_U32*)malloc((pstPara->stIniH264Venc.s32BitrateCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniH264Venc.pu32BitrateThresh);
+    pstPara->stIniH264Venc.pstH264Venc = (SCENEAUTO_H264VENC_S*)malloc((pstPara->stIniH264Venc.s32BitrateCount) * sizeof(SCENEAUTO_H264VENC_S));
+    CHECK_NULL_PTR(pstPara->stIniH264Venc.pstH264Venc);
     //h264venc:vencBitrateThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "h264venc:vencBitrateThresh");
+    pszTempStr = iniparser_getstr(pDict, "h264venc:vencBitrateThresh");
     if (NULL == pszTempStr)
     {
         printf("h264venc:vencBitrateThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniH264Venc.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniH264Venc.s32BitrateCount; i++)
     {
-        g_stINIPara.stIniH264Venc.pu32BitrateThresh[i] = MAEWeight[i];
+        pstPara->stIniH264Venc.pu32BitrateThresh[i] = MAEWeight[i];
     }
 
-    for (i = 0; i < g_stINIPara.stIniH264Venc.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniH264Venc.s32BitrateCount; i++)
     {
         //h264venc:chroma_qp_index_offset
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:chroma_qp_index_offset_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h264venc:chroma_qp_index_offset_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH264Venc.pstH264Venc[i].s32chroma_qp_index_offset = s32Temp;
+        pstPara->stIniH264Venc.pstH264Venc[i].s32chroma_qp_index_offset = s32Temp;
 
         //h264venc:disable_deblocking_filter_idc
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:disable_deblocking_filter_idc_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h264venc:disable_deblocking_filter_idc_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH264Venc.pstH264Venc[i].stH264Dblk.disable_deblocking_filter_idc = s32Temp;
+        pstPara->stIniH264Venc.pstH264Venc[i].stH264Dblk.disable_deblocking_filter_idc = s32Temp;
 
         //h264venc:slice_alpha_c0_offset_div2
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:slice_alpha_c0_offset_div2_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h264venc:slice_alpha_c0_offset_div2_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH264Venc.pstH264Venc[i].stH264Dblk.slice_alpha_c0_offset_div2 = s32Temp;
+        pstPara->stIniH264Venc.pstH264Venc[i].stH264Dblk.slice_alpha_c0_offset_div2 = s32Temp;
 
         //h264venc:slice_beta_offset_div2
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:slice_beta_offset_div2_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h264venc:slice_beta_offset_div2_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH264Venc.pstH264Venc[i].stH264Dblk.slice_beta_offset_div2 = s32Temp;
+        pstPara->stIniH264Venc.pstH264Venc[i].stH264Dblk.slice_beta_offset_div2 = s32Temp;
 
         //h264venc:u32DeltaQP
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:u32DeltaQP_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h264venc:u32DeltaQP_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH264Venc.pstH264Venc[i].u32DeltaQP = s32Temp;
+        pstPara->stIniH264Venc.pstH264Venc[i].u32DeltaQP = s32Temp;
 
         //h264venc:s32IPQPDelta
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:s32IPQPDelta_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h264venc:s32IPQPDelta_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH264Venc.pstH264Venc[i].s32IPQPDelta = s32Temp;
+        pstPara->stIniH264Venc.pstH264Venc[i].s32IPQPDelta = s32Temp;
 
         //h264venc:ThreshI
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:ThreshI_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h264venc:ThreshI_%d error\n", i);
@@ -3113,12 +3192,12 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < 12; j++)
         {
-            g_stINIPara.stIniH264Venc.pstH264Venc[i].u32ThrdI[j] = MAEWeight[j];
+            pstPara->stIniH264Venc.pstH264Venc[i].u32ThrdI[j] = MAEWeight[j];
         }
 
         //h264venc:ThreshP
         snprintf(szTempStr, sizeof(szTempStr), "h264venc:ThreshP_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h264venc:ThreshP_%d error\n", i);
@@ -3127,64 +3206,75 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < 12; j++)
         {
-            g_stINIPara.stIniH264Venc.pstH264Venc[i].u32ThrdP[j] = MAEWeight[j];
+            pstPara->stIniH264Venc.pstH264Venc[i].u32ThrdP[j] = MAEWeight[j];
         }
 
     }
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadH265VencPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 i, j;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
     /**************h265venc**************/
     //h265venc:vencBitrateCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "h265venc:vencBitrateCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "h265venc:vencBitrateCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("h264venc:vencBitrateCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniH265Venc.stIniH265VencRcParam.s32BitrateCount = s32Temp;
-    g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh = (HI_U32*)malloc((g_stINIPara.stIniH265Venc.stIniH265VencRcParam.s32BitrateCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh);
-    g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam = (SCENEAUTO_H265VENC_RCPARAM_S*)malloc((g_stINIPara.stIniH265Venc.stIniH265VencRcParam.s32BitrateCount) * sizeof(SCENEAUTO_H265VENC_RCPARAM_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam);
+    pstPara->stIniH265Venc.stIniH265VencRcParam.s32BitrateCount = s32Temp;
+    pstPara->stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh = (HI_U32*)malloc((pstPara->stIniH265Venc.stIniH265VencRcParam.s32BitrateCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh);
+    pstPara->stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam = (SCENEAUTO_H265VENC_RCPARAM_S*)malloc((pstPara->stIniH265Venc.stIniH265VencRcParam.s32BitrateCount) * sizeof(SCENEAUTO_H265VENC_RCPARAM_S));
+    CHECK_NULL_PTR(pstPara->stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam);
 
     //h265venc:vencBitrateThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "h265venc:vencBitrateThresh");
+    pszTempStr = iniparser_getstr(pDict, "h265venc:vencBitrateThresh");
     if (NULL == pszTempStr)
     {
         printf("h265venc:vencBitrateThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniH265Venc.stIniH265VencRcParam.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniH265Venc.stIniH265VencRcParam.s32BitrateCount; i++)
     {
-        g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh[i] = MAEWeight[i];
+        pstPara->stIniH265Venc.stIniH265VencRcParam.pu32BitrateThresh[i] = MAEWeight[i];
     }
 
-    for (i = 0; i < g_stINIPara.stIniH265Venc.stIniH265VencRcParam.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniH265Venc.stIniH265VencRcParam.s32BitrateCount; i++)
     {
         //h265venc:u32RowQpDelta
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32RowQpDelta_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h265venc:u32RowQpDelta_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].u32DeltaQP = s32Temp;
+        pstPara->stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].u32DeltaQP = s32Temp;
 
         //h265venc:s32IPQPDelta
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:s32IPQPDelta_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("h265venc:s32IPQPDelta_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].s32IPQPDelta = s32Temp;
+        pstPara->stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].s32IPQPDelta = s32Temp;
         //h265venc:ThreshI
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:ThreshI_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:ThreshI_%d error\n", i);
@@ -3193,12 +3283,12 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < 12; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].u32ThrdI[j] = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].u32ThrdI[j] = MAEWeight[j];
         }
 
         //h265venc:ThreshP
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:ThreshP_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:ThreshP_%d error\n", i);
@@ -3207,1508 +3297,1547 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < 12; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].u32ThrdP[j] = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencRcParam.pstH265VencRcParam[i].u32ThrdP[j] = MAEWeight[j];
         }
     }
 
     //h265venc_face_cfg
     //h265venc:vencBitrateCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "h265venc:vencBitrateCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "h265venc:vencBitrateCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("h265venc:vencBitrateCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount = s32Temp;
-    g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh = (HI_U32*)malloc((g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh);
+    pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount = s32Temp;
+    pstPara->stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh = (HI_U32*)malloc((pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh);
     //h265venc:vencBitrateThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "h265venc:vencBitrateThresh");
+    pszTempStr = iniparser_getstr(pDict, "h265venc:vencBitrateThresh");
     if (NULL == pszTempStr)
     {
         printf("h265venc:vencBitrateThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount; i++)
     {
-        g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh[i] = MAEWeight[i];
+        pstPara->stIniH265Venc.stIniH265VencFaceCfg.pu32BitrateThresh[i] = MAEWeight[i];
     }
     //h265venc:ExpCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "h265venc:ExpCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "h265venc:ExpCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("h265venc:ExpCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount = s32Temp;
-    g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh = (HI_U32*)malloc((g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh);
+    pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount = s32Temp;
+    pstPara->stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh = (HI_U32*)malloc((pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh);
     //h265venc:ExpThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "h265venc:ExpThresh");
+    pszTempStr = iniparser_getstr(pDict, "h265venc:ExpThresh");
     if (NULL == pszTempStr)
     {
         printf("h265venc:ExpThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; i++)
     {
-        g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh[i] = MAEWeight[i];
+        pstPara->stIniH265Venc.stIniH265VencFaceCfg.pu32ExpThresh[i] = MAEWeight[i];
     }
 
-    g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg = (SCENEAUTO_H265VENC_FACECFG_S*)malloc((g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount) * (g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount) * sizeof(SCENEAUTO_H265VENC_FACECFG_S));
-    CHECK_NULL_PTR(g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg);
+    pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg = (SCENEAUTO_H265VENC_FACECFG_S*)malloc((pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount) * (pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount) * sizeof(SCENEAUTO_H265VENC_FACECFG_S));
+    CHECK_NULL_PTR(pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg);
 
-    for (i = 0; i < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount; i++)
+    for (i = 0; i < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount; i++)
     {
         //h265venc:u8NormIntra4RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra4RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra4RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra4RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra4RdCost_I = MAEWeight[j];
         }
         //h265venc:u8NormIntra8RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra8RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra8RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra8RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra8RdCost_I = MAEWeight[j];
         }
         //h265venc:u8NormIntra16RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra16RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra16RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra16RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra16RdCost_I = MAEWeight[j];
         }
         //h265venc:u8NormIntra32RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra32RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra32RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra32RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra32RdCost_I = MAEWeight[j];
         }
         //h265venc:u8SkinIntra4RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra4RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra4RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra4RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra4RdCost_I = MAEWeight[j];
         }
         //h265venc:u8SkinIntra8RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra8RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra8RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra8RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra8RdCost_I = MAEWeight[j];
         }
         //h265venc:u8SkinIntra16RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra16RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra16RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra16RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra16RdCost_I = MAEWeight[j];
         }
         //h265venc:u8SkinIntra32RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra32RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra32RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra32RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra32RdCost_I = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra4RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra4RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra4RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra4RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra4RdCost_I = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra8RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra8RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra8RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra8RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra8RdCost_I = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra16RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra16RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra16RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra16RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra16RdCost_I = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra32RdCost_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra32RdCost_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra32RdCost_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra32RdCost_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra32RdCost_I = MAEWeight[j];
         }
         //h265venc:u8NormIntra4RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra4RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra4RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra4RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra4RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormIntra8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormIntra16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormIntra32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormIntra32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormIntra32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormIntra32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8SkinIntra4RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra4RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra4RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra4RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra4RdCost_P = MAEWeight[j];
         }
         //h265venc:u8SkinIntra8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8SkinIntra16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8SkinIntra32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinIntra32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinIntra32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinIntra32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra4RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra4RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra4RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra4RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra4RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeIntra32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeIntra32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeIntra32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeIntra32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormFme8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormFme8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormFme8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormFme16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormFme16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormFme16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormFme32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormFme32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormFme32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormFme64RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormFme64RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8NormFme64RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme64RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormFme64RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinFme8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinFme8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme8RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinFme16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinFme16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme16RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinFme32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinFme32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme32RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinFme64RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8SkinFme64RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme64RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinFme64RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeFme8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeFme8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeFme8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeFme16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeFme16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeFme16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeFme32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeFme32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeFme32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeFme64RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeFme64RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeFme64RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme64RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeFme64RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormMerg8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormMerg8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8NormMerg8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormMerg16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormMerg16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8NormMerg16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormMerg32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormMerg32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8NormMerg32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8NormMerg64RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8NormMerg64RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8NormMerg64RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg64RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8NormMerg64RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinMerg8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinMerg8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg8RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinMerg16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinMerg16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg16RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinMerg32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinMerg32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg32RdCost_P = MAEWeight[j];
         }
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinMerg64RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinMerg64RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg64RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinMerg64RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeMerg8RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeMerg8RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeMerg8RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg8RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg8RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeMerg16RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeMerg16RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeMerg16RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg16RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg16RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeMerg32RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeMerg32RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeMerg32RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg32RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg32RdCost_P = MAEWeight[j];
         }
         //h265venc:u8HedgeMerg64RdCost_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeMerg64RdCost_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeMerg64RdCost_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg64RdCost_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeMerg64RdCost_P = MAEWeight[j];
         }
         //h265venc:bSkinEn_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:bSkinEn_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:bSkinEn_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bSkinEn_I = (HI_BOOL)MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bSkinEn_I = (HI_BOOL)MAEWeight[j];
         }
         //h265venc:u32SkinQpDelta_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32SkinQpDelta_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32SkinQpDelta_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinQpDelta_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinQpDelta_I = MAEWeight[j];
         }
         //h265venc:u8SkinUMax_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinUMax_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinUMax_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMax_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMax_I = MAEWeight[j];
         }
         //h265venc:u8SkinUMin_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinUMin_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinUMin_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMin_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMin_I = MAEWeight[j];
         }
         //h265venc:u8SkinVMax_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinVMax_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinVMax_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMax_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMax_I = MAEWeight[j];
         }
         //h265venc:u8SkinVMin_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinVMin_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinVMin_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMin_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMin_I = MAEWeight[j];
         }
         //h265venc:u32SkinNum_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32SkinNum_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32SkinNum_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinNum_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinNum_I = MAEWeight[j];
         }
         //h265venc:bSkinEn_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:bSkinEn_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:bSkinEn_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bSkinEn_P = (HI_BOOL)MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bSkinEn_P = (HI_BOOL)MAEWeight[j];
         }
         //h265venc:u32SkinQpDelta_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32SkinQpDelta_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32SkinQpDelta_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinQpDelta_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinQpDelta_P = MAEWeight[j];
         }
         //h265venc:u8SkinUMax_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinUMax_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinUMax_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMax_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMax_P = MAEWeight[j];
         }
         //h265venc:u8SkinUMin_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinUMin_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinUMin_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMin_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinUMin_P = MAEWeight[j];
         }
         //h265venc:u8SkinVMax_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinVMax_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinVMax_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMax_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMax_P = MAEWeight[j];
         }
         //h265venc:u8SkinVMin_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8SkinVMin_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8SkinVMin_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMin_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8SkinVMin_P = MAEWeight[j];
         }
         //h265venc:u32SkinNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32SkinNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32SkinNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32SkinNum_P = MAEWeight[j];
         }
         //h265venc:u8HedgeThr_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeThr_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeThr_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeThr_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeThr_I = MAEWeight[j];
         }
         //h265venc:u8HedgeCnt_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeCnt_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeCnt_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeCnt_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeCnt_I = MAEWeight[j];
         }
         //h265venc:bStroEdgeEn_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:bStroEdgeEn_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:bStroEdgeEn_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bStroEdgeEn_I = (HI_BOOL)MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bStroEdgeEn_I = (HI_BOOL)MAEWeight[j];
         }
         //h265venc:u32StroEdgeQpDelta_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32StroEdgeQpDelta_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32StroEdgeQpDelta_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32StroEdgeQpDelta_I = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32StroEdgeQpDelta_I = MAEWeight[j];
         }
         //h265venc:u8HedgeThr_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeThr_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeThr_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeThr_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeThr_P = MAEWeight[j];
         }
         //h265venc:u8HedgeCnt_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u8HedgeCnt_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u8HedgeCnt_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeCnt_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u8HedgeCnt_P = MAEWeight[j];
         }
         //h265venc:bStroEdgeEn_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:bStroEdgeEn_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:bStroEdgeEn_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bStroEdgeEn_P = (HI_BOOL)MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bStroEdgeEn_P = (HI_BOOL)MAEWeight[j];
         }
         //h265venc:u32StroEdgeQpDelta_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32StroEdgeQpDelta_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32StroEdgeQpDelta_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32StroEdgeQpDelta_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32StroEdgeQpDelta_P = MAEWeight[j];
         }
         //h265venc:bImproveEn_I
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:bImproveEn_I_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:bImproveEn_I_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bImproveEn_I = (HI_BOOL)MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bImproveEn_I = (HI_BOOL)MAEWeight[j];
         }
         //h265venc:bImproveEn_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:bImproveEn_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:bImproveEn_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bImproveEn_P = (HI_BOOL)MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].bImproveEn_P = (HI_BOOL)MAEWeight[j];
         }
         //h265venc:u32Norm32MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Norm32MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Norm32MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm32MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm32MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Norm16MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Norm16MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Norm16MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm16MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm16MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Norm32ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Norm32ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Norm32ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm32ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm32ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Norm16ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Norm16ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Norm16ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm16ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Norm16ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Skin32MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Skin32MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Skin32MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin32MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin32MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Skin16MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Skin16MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Skin16MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin16MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin16MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Skin32ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Skin32ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Skin32ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin32ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin32ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Skin16ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Skin16ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Skin16ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin16ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Skin16ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Still32MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Still32MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Still32MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still32MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still32MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Still16MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Still16MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Still16MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still16MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still16MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Still32ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Still32ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Still32ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still32ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still32ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Still16ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Still16ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Still16ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still16ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Still16ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Hedge32MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Hedge32MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Hedge32MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge32MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge32MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Hedge16MaxNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Hedge16MaxNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Hedge16MaxNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge16MaxNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge16MaxNum_P = MAEWeight[j];
         }
         //h265venc:u32Hedge32ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Hedge32ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Hedge32ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge32ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge32ProtectNum_P = MAEWeight[j];
         }
         //h265venc:u32Hedge16ProtectNum_P
         snprintf(szTempStr, sizeof(szTempStr), "h265venc:u32Hedge16ProtectNum_P_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if(NULL == pszTempStr)
         {
             printf("h265venc:u32Hedge16ProtectNum_P_%d error\n", i);
             return HI_FAILURE;
         }
         s32Temp = Weight(pszTempStr);
-        for (j = 0; j < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
+        for (j = 0; j < pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount; j++)
         {
-            g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge16ProtectNum_P = MAEWeight[j];
+            pstPara->stIniH265Venc.stIniH265VencFaceCfg.pstH265VencFaceCfg[i * pstPara->stIniH265Venc.stIniH265VencFaceCfg.s32ExpCount + j].u32Hedge16ProtectNum_P = MAEWeight[j];
         }
     }     
-    
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_Load3dnrPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 i;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
    /**************3dnr**************/
    //3dnr:3DnrIsoCount
    s32Temp = 0;
-   s32Temp = iniparser_getint(g_Sceneautodictionary, "3dnr:3DnrIsoCount", HI_FAILURE);
+   s32Temp = iniparser_getint(pDict, "3dnr:3DnrIsoCount", HI_FAILURE);
    if (HI_FAILURE == s32Temp)
    {
        printf("3dnr:3DnrIsoCount failed\n");
        return HI_FAILURE;
    }    
-   g_stINIPara.stIni3dnr.s323DnrIsoCount = s32Temp;
-   g_stINIPara.stIni3dnr.pu323DnrIsoThresh = (HI_U32 *)malloc((g_stINIPara.stIni3dnr.s323DnrIsoCount) * sizeof(HI_U32));
-   CHECK_NULL_PTR(g_stINIPara.stIni3dnr.pu323DnrIsoThresh);
-   g_stINIPara.stIni3dnr.pst3dnrParam = (SCENEAUTO_INIPARAM_3DNRCFG_S *)malloc((g_stINIPara.stIni3dnr.s323DnrIsoCount) * sizeof(SCENEAUTO_INIPARAM_3DNRCFG_S));
-   CHECK_NULL_PTR(g_stINIPara.stIni3dnr.pst3dnrParam);
+   pstPara->stIni3dnr.s323DnrIsoCount = s32Temp;
+   pstPara->stIni3dnr.pu323DnrIsoThresh = (HI_U32 *)malloc((pstPara->stIni3dnr.s323DnrIsoCount) * sizeof(HI_U32));
+   CHECK_NULL_PTR(pstPara->stIni3dnr.pu323DnrIsoThresh);
+   pstPara->stIni3dnr.pst3dnrParam = (SCENEAUTO_INIPARAM_3DNRCFG_S *)malloc((pstPara->stIni3dnr.s323DnrIsoCount) * sizeof(SCENEAUTO_INIPARAM_3DNRCFG_S));
+   CHECK_NULL_PTR(pstPara->stIni3dnr.pst3dnrParam);
    
    //3dnr:3DnrIsoThresh
-   pszTempStr = iniparser_getstr(g_Sceneautodictionary, "3dnr:3DnrIsoThresh");
+   pszTempStr = iniparser_getstr(pDict, "3dnr:3DnrIsoThresh");
    if (NULL == pszTempStr)
    {
        printf("3dnr:3DnrIsoThresh error\n");
        return HI_FAILURE;
    }
    s32Temp = Weight(pszTempStr);
-   for (i = 0; i < g_stINIPara.stIni3dnr.s323DnrIsoCount; i++)
+   for (i = 0; i < pstPara->stIni3dnr.s323DnrIsoCount; i++)
    {
-       g_stINIPara.stIni3dnr.pu323DnrIsoThresh[i] = MAEWeight[i];
+       pstPara->stIni3dnr.pu323DnrIsoThresh[i] = MAEWeight[i];
    }
    
-   for (i = 0; i < g_stINIPara.stIni3dnr.s323DnrIsoCount; i++)
+   for (i = 0; i < pstPara->stIni3dnr.s323DnrIsoCount; i++)
    {
        //3dnr:s32YPKStr
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YPKStr_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YPKStr_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YPKStr = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YPKStr = s32Temp;
 
        //3dnr:s32YSFStr
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YSFStr_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YSFStr_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YSFStr = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YSFStr = s32Temp;
        
        //3dnr:s32YTFStr
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YTFStr_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YTFStr_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YTFStr = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YTFStr = s32Temp;
        
        //3dnr:s32TFStrMax  
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32TFStrMax_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32TFStrMax_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32TFStrMax = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32TFStrMax = s32Temp;
        
        //3dnr:s32TFStrMov 
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32TFStrMov_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32TFStrMov_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32TFStrMov = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32TFStrMov = s32Temp;
 
        //3dnr:s32YSmthStr
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YSmthStr_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YSmthStr_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YSmthStr = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YSmthStr = s32Temp;
 
        //3dnr:s32YSmthRat
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YSmthRat_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YSmthRat_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YSmthRat = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YSmthRat = s32Temp;
 
        //3dnr:s32YSFStrDlt
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YSFStrDlt_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YSFStrDlt_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YSFStrDlt = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YSFStrDlt = s32Temp;
 
        //3dnr:s32YSFStrDl
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YSFStrDl_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YSFStrDl_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YSFStrDl = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YSFStrDl = s32Temp;
 
        //3dnr:s32YTFStrDlt
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YTFStrDlt_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YTFStrDlt_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YTFStrDlt = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YTFStrDlt = s32Temp;
 
        //3dnr:s32YTFStrDl
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YTFStrDl_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YTFStrDl_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YTFStrDl = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YTFStrDl = s32Temp;
 
        //3dnr:s32YSFBriRat
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YSFBriRat_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YSFBriRat_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YSFBriRat = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YSFBriRat = s32Temp;
 
        //3dnr:s32CSFStr
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32CSFStr_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32CSFStr_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32CSFStr = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32CSFStr = s32Temp;
 
        //3dnr:s32CTFstr
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32CTFstr_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32CTFstr_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32CTFstr = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32CTFstr = s32Temp;
        
        //3dnr:s32YTFMdWin
        snprintf(szTempStr, sizeof(szTempStr), "3dnr:s32YTFMdWin_%d", i);
        s32Temp = 0;
-       s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+       s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
        if (HI_FAILURE == s32Temp)
        {
            printf("3dnr:s32YTFMdWin_%d failed\n", i);
            return HI_FAILURE;
        }
-       g_stINIPara.stIni3dnr.pst3dnrParam[i].s32YTFMdWin = s32Temp;
+       pstPara->stIni3dnr.pst3dnrParam[i].s32YTFMdWin = s32Temp;
    }
 
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadBLCPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+
     /**************BLC**************/
     //BLC:AEStrategyMode
     s32Temp = 0;
- 	s32Temp = iniparser_getint(g_Sceneautodictionary, "BLC:AEStrategyMode", HI_FAILURE);
+ 	s32Temp = iniparser_getint(pDict, "BLC:AEStrategyMode", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("BLC:AEStrategyMode failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stBLC.u8AEStrategyMode = s32Temp;
+    pstPara->stBLC.u8AEStrategyMode = s32Temp;
     //BLC:MaxHistOffset
     s32Temp = 0;
- 	s32Temp = iniparser_getint(g_Sceneautodictionary, "BLC:MaxHistOffset", HI_FAILURE);
+ 	s32Temp = iniparser_getint(pDict, "BLC:MaxHistOffset", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("BLC:MaxHistOffset failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stBLC.u8MaxHistOffset = s32Temp;
+    pstPara->stBLC.u8MaxHistOffset = s32Temp;
     //BLC:HistRatioSlope
     s32Temp = 0;
- 	s32Temp = iniparser_getint(g_Sceneautodictionary, "BLC:HistRatioSlope", HI_FAILURE);
+ 	s32Temp = iniparser_getint(pDict, "BLC:HistRatioSlope", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("BLC:HistRatioSlope failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stBLC.u16HistRatioSlope = s32Temp;
+    pstPara->stBLC.u16HistRatioSlope = s32Temp;
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadDynamicPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 i;
+    HI_CHAR* pszTempStr;
+
     /**************DYNAMIC**************/
     //DYNAMIC:TotalNum_fast
     s32Temp = 0;
- 	s32Temp = iniparser_getint(g_Sceneautodictionary, "DYNAMIC:TotalNum_fast", HI_FAILURE);
+ 	s32Temp = iniparser_getint(pDict, "DYNAMIC:TotalNum_fast", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DYNAMIC:TotalNum_fast failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stFastDynamic.s32TotalNum = s32Temp;
-    g_stINIPara.stFastDynamic.pstRouteNode = (SCENEAUTO_ROUTE_NODE_S*)malloc((g_stINIPara.stFastDynamic.s32TotalNum) * sizeof (SCENEAUTO_ROUTE_NODE_S));
-    CHECK_NULL_PTR(g_stINIPara.stFastDynamic.pstRouteNode);
+    pstPara->stFastDynamic.s32TotalNum = s32Temp;
+    pstPara->stFastDynamic.pstRouteNode = (SCENEAUTO_ROUTE_NODE_S*)malloc((pstPara->stFastDynamic.s32TotalNum) * sizeof (SCENEAUTO_ROUTE_NODE_S));
+    CHECK_NULL_PTR(pstPara->stFastDynamic.pstRouteNode);
     //DYNAMIC:IntTime_fast
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "DYNAMIC:IntTime_fast");
+    pszTempStr = iniparser_getstr(pDict, "DYNAMIC:IntTime_fast");
     if (NULL == pszTempStr)
     {
         printf("DYNAMIC:IntTime_fast error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stFastDynamic.s32TotalNum; i++)
+    for (i = 0; i < pstPara->stFastDynamic.s32TotalNum; i++)
     {
-        g_stINIPara.stFastDynamic.pstRouteNode[i].u32IntTime = MAEWeight[i];
+        pstPara->stFastDynamic.pstRouteNode[i].u32IntTime = MAEWeight[i];
     }
     //DYNAMIC:SysGain_fast
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "DYNAMIC:SysGain_fast");
+    pszTempStr = iniparser_getstr(pDict, "DYNAMIC:SysGain_fast");
     if (NULL == pszTempStr)
     {
         printf("DYNAMIC:SysGain_fast error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stFastDynamic.s32TotalNum; i++)
+    for (i = 0; i < pstPara->stFastDynamic.s32TotalNum; i++)
     {
-        g_stINIPara.stFastDynamic.pstRouteNode[i].u32SysGain = MAEWeight[i];
+        pstPara->stFastDynamic.pstRouteNode[i].u32SysGain = MAEWeight[i];
     }
     //DYNAMIC:TotalNum_normal
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DYNAMIC:TotalNum_normal", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DYNAMIC:TotalNum_normal", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DYNAMIC:TotalNum_normal failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stNormalDynamic.s32TotalNum = s32Temp;
-    g_stINIPara.stNormalDynamic.pstRouteNode = (SCENEAUTO_ROUTE_NODE_S*)malloc((g_stINIPara.stFastDynamic.s32TotalNum) * sizeof (SCENEAUTO_ROUTE_NODE_S));
-    CHECK_NULL_PTR(g_stINIPara.stNormalDynamic.pstRouteNode);
+    pstPara->stNormalDynamic.s32TotalNum = s32Temp;
+    pstPara->stNormalDynamic.pstRouteNode = (SCENEAUTO_ROUTE_NODE_S*)malloc((pstPara->stFastDynamic.s32TotalNum) * sizeof (SCENEAUTO_ROUTE_NODE_S));
+    CHECK_NULL_PTR(pstPara->stNormalDynamic.pstRouteNode);
     //DYNAMIC:IntTime_normal
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "DYNAMIC:IntTime_normal");
+    pszTempStr = iniparser_getstr(pDict, "DYNAMIC:IntTime_normal");
     if (NULL == pszTempStr)
     {
         printf("DYNAMIC:IntTime_normal error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stNormalDynamic.s32TotalNum; i++)
+    for (i = 0; i < pstPara->stNormalDynamic.s32TotalNum; i++)
     {
-        g_stINIPara.stNormalDynamic.pstRouteNode[i].u32IntTime = MAEWeight[i];
+        pstPara->stNormalDynamic.pstRouteNode[i].u32IntTime = MAEWeight[i];
     }
     //DYNAMIC:SysGain_normal
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "DYNAMIC:SysGain_normal");
+    pszTempStr = iniparser_getstr(pDict, "DYNAMIC:SysGain_normal");
     if (NULL == pszTempStr)
     {
         printf("DYNAMIC:SysGain_normal error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stNormalDynamic.s32TotalNum; i++)
+    for (i = 0; i < pstPara->stNormalDynamic.s32TotalNum; i++)
     {
-        g_stINIPara.stNormalDynamic.pstRouteNode[i].u32SysGain = MAEWeight[i];
+        pstPara->stNormalDynamic.pstRouteNode[i].u32SysGain = MAEWeight[i];
     }
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadHLCPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 s32Offset = 0;
+    HI_S32 i;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
     /**************HLC**************/
     //HLC:ExpCompensation
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:ExpCompensation", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:ExpCompensation", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:ExpCompensation failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u8ExpCompensation = s32Temp;
+    pstPara->stHLC.u8ExpCompensation = s32Temp;
     //HLC:Saturation
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:Saturation");
+    pszTempStr = iniparser_getstr(pDict, "HLC:Saturation");
     if (NULL == pszTempStr)
     {
         printf("HLC:Saturation error\n");
@@ -4717,140 +4846,140 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stHLC.u8Saturation[i] = MAEWeight[i];
+        pstPara->stHLC.u8Saturation[i] = MAEWeight[i];
     }
     //HLC:BlackDelayFrame
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:BlackDelayFrame", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:BlackDelayFrame", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:BlackDelayFrame failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u16BlackDelayFrame = s32Temp;
+    pstPara->stHLC.u16BlackDelayFrame = s32Temp;
     //HLC:WhiteDelayFrame
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:WhiteDelayFrame", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:WhiteDelayFrame", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:WhiteDelayFrame failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u16WhiteDelayFrame = s32Temp;
+    pstPara->stHLC.u16WhiteDelayFrame = s32Temp;
 
     //HLC:u8Speed
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:u8Speed", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:u8Speed", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:u8Speed failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u8Speed = s32Temp;
+    pstPara->stHLC.u8Speed = s32Temp;
     //HLC:HistRatioSlope
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:HistRatioSlope", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:HistRatioSlope", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:HistRatioSlope failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u16HistRatioSlope = s32Temp;
+    pstPara->stHLC.u16HistRatioSlope = s32Temp;
     //HLC:MaxHistOffset
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:MaxHistOffset", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:MaxHistOffset", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:MaxHistOffset failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u8MaxHistOffset = s32Temp;
+    pstPara->stHLC.u8MaxHistOffset = s32Temp;
     //HLC:u8Tolerance
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:u8Tolerance", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:u8Tolerance", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:u8Tolerance failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u8Tolerance = s32Temp;
+    pstPara->stHLC.u8Tolerance = s32Temp;
     //HLC:DCIEnable
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DCIEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DCIEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DCIEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.bDCIEnable = (HI_BOOL)s32Temp;
+    pstPara->stHLC.bDCIEnable = (HI_BOOL)s32Temp;
     //HLC:DCIBlackGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DCIBlackGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DCIBlackGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DCIBlackGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u32DCIBlackGain = s32Temp;
+    pstPara->stHLC.u32DCIBlackGain = s32Temp;
     //HLC:DCIContrastGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DCIContrastGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DCIContrastGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DCIContrastGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u32DCIContrastGain = s32Temp;
+    pstPara->stHLC.u32DCIContrastGain = s32Temp;
     //HLC:DCILightGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DCILightGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DCILightGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DCILightGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u32DCILightGain = s32Temp;
+    pstPara->stHLC.u32DCILightGain = s32Temp;
     //HLC:DCILightGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DCILightGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DCILightGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DCILightGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u32DCILightGain = s32Temp;
+    pstPara->stHLC.u32DCILightGain = s32Temp;
     //HLC:DRCEnable
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DRCEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DRCEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DRCEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.bDRCEnable = (HI_BOOL)s32Temp;
+    pstPara->stHLC.bDRCEnable = (HI_BOOL)s32Temp;
     //HLC:DRCManulEnable
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DRCManulEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DRCManulEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DRCManulEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.bDRCManulEnable = (HI_BOOL)s32Temp;
+    pstPara->stHLC.bDRCManulEnable = (HI_BOOL)s32Temp;
     //HLC:DRCStrengthTarget
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:DRCStrengthTarget", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "HLC:DRCStrengthTarget", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("HLC:DRCStrengthTarget failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stHLC.u32DRCStrengthTarget = s32Temp;
+    pstPara->stHLC.u32DRCStrengthTarget = s32Temp;
     
     //HLC:gamma
     s32Offset = 0;    
     snprintf(szTempStr, sizeof(szTempStr), "HLC:gamma_0");
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+    pszTempStr = iniparser_getstr(pDict, szTempStr);
     if (NULL == pszTempStr)
     {
         printf("HLC:gamma_0 error\n");
@@ -4859,12 +4988,12 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.stHLC.u16GammaTable[i] = MAEWeight[i];
+        pstPara->stHLC.u16GammaTable[i] = MAEWeight[i];
     }
     s32Offset += s32Temp;
 
     snprintf(szTempStr, sizeof(szTempStr), "HLC:gamma_1");
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+    pszTempStr = iniparser_getstr(pDict, szTempStr);
     if (NULL == pszTempStr)
     {
         printf("HLC:gamma_1 error\n");
@@ -4873,12 +5002,12 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.stHLC.u16GammaTable[s32Offset + i] = MAEWeight[i];
+        pstPara->stHLC.u16GammaTable[s32Offset + i] = MAEWeight[i];
     }
     s32Offset += s32Temp;
 
     snprintf(szTempStr, sizeof(szTempStr), "HLC:gamma_2");
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+    pszTempStr = iniparser_getstr(pDict, szTempStr);
     if (NULL == pszTempStr)
     {
         printf("HLC:gamma_2 error\n");
@@ -4887,12 +5016,12 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.stHLC.u16GammaTable[s32Offset + i] = MAEWeight[i];
+        pstPara->stHLC.u16GammaTable[s32Offset + i] = MAEWeight[i];
     }
 
     
     //HLC:abEnLowLumaShoot
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:abEnLowLumaShoot");
+     pszTempStr = iniparser_getstr(pDict, "HLC:abEnLowLumaShoot");
      if(NULL == pszTempStr)
      {
          printf("HLC:abEnLowLumaShoot error\n");
@@ -4901,11 +5030,11 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.abEnLowLumaShoot[i] = MAEWeight[i];
+         pstPara->stHLC.abEnLowLumaShoot[i] = MAEWeight[i];
      } 
     
      //HLC:u8SharpenD
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:u8SharpenD");
+     pszTempStr = iniparser_getstr(pDict, "HLC:u8SharpenD");
      if(NULL == pszTempStr)
      {
          printf("HLC:u8SharpenD error\n");
@@ -4914,11 +5043,11 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.u8SharpenD[i] = MAEWeight[i];
+         pstPara->stHLC.u8SharpenD[i] = MAEWeight[i];
      } 
     
      //HLC:u8SharpenUd
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:u8SharpenUd");
+     pszTempStr = iniparser_getstr(pDict, "HLC:u8SharpenUd");
      if(NULL == pszTempStr)
      {
          printf("HLC:u8SharpenUd error\n");
@@ -4927,12 +5056,12 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.u8SharpenUd[i] = MAEWeight[i];
+         pstPara->stHLC.u8SharpenUd[i] = MAEWeight[i];
      } 
     
     
      //HLC:u8OverShoot
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:u8OverShoot");
+     pszTempStr = iniparser_getstr(pDict, "HLC:u8OverShoot");
      if(NULL == pszTempStr)
      {
          printf("HLC:u8OverShoot error\n");
@@ -4941,11 +5070,11 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.u8OverShoot[i] = MAEWeight[i];
+         pstPara->stHLC.u8OverShoot[i] = MAEWeight[i];
      } 
     
      //HLC:u8UnderShoot
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8UnderShoot");
+     pszTempStr = iniparser_getstr(pDict, "IR:u8UnderShoot");
      if(NULL == pszTempStr)
      {
          printf("HLC:u8UnderShoot error\n");
@@ -4954,11 +5083,11 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.u8UnderShoot[i] = MAEWeight[i];
+         pstPara->stHLC.u8UnderShoot[i] = MAEWeight[i];
      } 
     
      //HLC:u8TextureNoiseThd
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:u8TextureNoiseThd");
+     pszTempStr = iniparser_getstr(pDict, "HLC:u8TextureNoiseThd");
      if(NULL == pszTempStr)
      {
          printf("HLC:u8TextureNoiseThd error\n");
@@ -4967,11 +5096,11 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.u8TextureNoiseThd[i] = MAEWeight[i];
+         pstPara->stHLC.u8TextureNoiseThd[i] = MAEWeight[i];
      } 
     
      //HLC:u8EdgeNoiseThd
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:u8EdgeNoiseThd");
+     pszTempStr = iniparser_getstr(pDict, "HLC:u8EdgeNoiseThd");
      if(NULL == pszTempStr)
      {
          printf("HLC:u8EdgeNoiseThd error\n");
@@ -4980,330 +5109,342 @@ HI_S32 Sceneauto_LoadINIPara()
      s32Temp = Weight(pszTempStr);
      for (i = 0; i < 16; i++)
      {
-         g_stINIPara.stHLC.u8EdgeNoiseThd[i] = MAEWeight[i];
+         pstPara->stHLC.u8EdgeNoiseThd[i] = MAEWeight[i];
      } 
 
      //HLC:3DnrIsoCount
      s32Temp = 0;
-     s32Temp = iniparser_getint(g_Sceneautodictionary, "HLC:3DnrIsoCount", HI_FAILURE);
+     s32Temp = iniparser_getint(pDict, "HLC:3DnrIsoCount", HI_FAILURE);
      if (HI_FAILURE == s32Temp)
      {
          printf("HLC:3DnrIsoCount failed\n");
          return HI_FAILURE;
      }    
-     g_stINIPara.stHLC.s323DnrIsoCount = s32Temp;
-     g_stINIPara.stHLC.pu323DnrIsoThresh = (HI_U32 *)malloc((g_stINIPara.stHLC.s323DnrIsoCount) * sizeof(HI_U32));
-     CHECK_NULL_PTR(g_stINIPara.stHLC.pu323DnrIsoThresh);
-     g_stINIPara.stHLC.pst3dnrParam = (SCENEAUTO_INIPARAM_3DNRCFG_S *)malloc((g_stINIPara.stHLC.s323DnrIsoCount) * sizeof(SCENEAUTO_INIPARAM_3DNRCFG_S));
-     CHECK_NULL_PTR(g_stINIPara.stHLC.pst3dnrParam);
+     pstPara->stHLC.s323DnrIsoCount = s32Temp;
+     pstPara->stHLC.pu323DnrIsoThresh = (HI_U32 *)malloc((pstPara->stHLC.s323DnrIsoCount) * sizeof(HI_U32));
+     CHECK_NULL_PTR(pstPara->stHLC.pu323DnrIsoThresh);
+     pstPara->stHLC.pst3dnrParam = (SCENEAUTO_INIPARAM_3DNRCFG_S *)malloc((pstPara->stHLC.s323DnrIsoCount) * sizeof(SCENEAUTO_INIPARAM_3DNRCFG_S));
+     CHECK_NULL_PTR(pstPara->stHLC.pst3dnrParam);
    
      //HLC:3DnrIsoThresh
-     pszTempStr = iniparser_getstr(g_Sceneautodictionary, "HLC:3DnrIsoThresh");
+     pszTempStr = iniparser_getstr(pDict, "HLC:3DnrIsoThresh");
      if (NULL == pszTempStr)
      {
          printf("HLC:3DnrIsoThresh error\n");
          return HI_FAILURE;
      }
      s32Temp = Weight(pszTempStr);
-     for (i = 0; i < g_stINIPara.stHLC.s323DnrIsoCount; i++)
+     for (i = 0; i < pstPara->stHLC.s323DnrIsoCount; i++)
      {
-         g_stINIPara.stHLC.pu323DnrIsoThresh[i] = MAEWeight[i];
+         pstPara->stHLC.pu323DnrIsoThresh[i] = MAEWeight[i];
      }
      
-     for (i = 0; i < g_stINIPara.stHLC.s323DnrIsoCount; i++)
+     for (i = 0; i < pstPara->stHLC.s323DnrIsoCount; i++)
      {
          //HLC:s32YPKStr
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YPKStr_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YPKStr_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YPKStr = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YPKStr = s32Temp;
      
          //HLC:s32YSFStr
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YSFStr_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YSFStr_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YSFStr = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YSFStr = s32Temp;
          
          //HLC:s32YTFStr
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YTFStr_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YTFStr_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YTFStr = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YTFStr = s32Temp;
          
          //HLC:s32TFStrMax  
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32TFStrMax_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32TFStrMax_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32TFStrMax = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32TFStrMax = s32Temp;
          
          //HLC:s32TFStrMov 
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32TFStrMov_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32TFStrMov_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32TFStrMov = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32TFStrMov = s32Temp;
      
          //HLC:s32YSmthStr
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YSmthStr_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YSmthStr_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YSmthStr = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YSmthStr = s32Temp;
      
          //HLC:s32YSmthRat
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YSmthRat_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YSmthRat_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YSmthRat = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YSmthRat = s32Temp;
      
      
          //HLC:s32YSFStrDlt
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YSFStrDlt_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YSFStrDlt_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YSFStrDlt = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YSFStrDlt = s32Temp;
          
          //HLC:s32YSFStrDl
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YSFStrDl_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YSFStrDl_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YSFStrDl = s32Temp;     
+         pstPara->stHLC.pst3dnrParam[i].s32YSFStrDl = s32Temp;     
      
          //HLC:s32YTFStrDlt
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YTFStrDlt_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YTFStrDlt_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YTFStrDlt = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YTFStrDlt = s32Temp;
      
          //HLC:s32YTFStrDl
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YTFStrDl_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YTFStrDl_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YTFStrDl = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YTFStrDl = s32Temp;
      
          //HLC:s32YSFBriRat
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YSFBriRat_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YSFBriRat_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YSFBriRat = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YSFBriRat = s32Temp;
      
          //HLC:s32CSFStr
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32CSFStr_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32CSFStr_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32CSFStr = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32CSFStr = s32Temp;
      
          //HLC:s32CTFstr
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32CTFstr_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32CTFstr_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32CTFstr = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32CTFstr = s32Temp;
 
          //HLC:s32YTFMdWin
          snprintf(szTempStr, sizeof(szTempStr), "HLC:s32YTFMdWin_%d", i);
          s32Temp = 0;
-         s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+         s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
          if (HI_FAILURE == s32Temp)
          {
              printf("HLC:s32YTFMdWin_%d failed\n", i);
              return HI_FAILURE;
          }
-         g_stINIPara.stHLC.pst3dnrParam[i].s32YTFMdWin = s32Temp;
+         pstPara->stHLC.pst3dnrParam[i].s32YTFMdWin = s32Temp;
      }
+
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadIRPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+    HI_S32 s32Offset = 0;
+    HI_S32 i, j;
+    HI_CHAR szTempStr[128];
+    HI_CHAR* pszTempStr;
+
     /**************IR**************/
     //IR:ExpCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:ExpCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:ExpCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:ExpCount failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.s32ExpCount = s32Temp;
-    g_stINIPara.stIR.pu32ExpThreshLtoH = (HI_U32*)malloc((g_stINIPara.stIR.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIR.pu32ExpThreshLtoH);
-    g_stINIPara.stIR.pu32ExpThreshHtoL = (HI_U32*)malloc((g_stINIPara.stIR.s32ExpCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIR.pu32ExpThreshHtoL);
-    g_stINIPara.stIR.pu8ExpCompensation = (HI_U8*)malloc((g_stINIPara.stIR.s32ExpCount) * sizeof(HI_U8));
-    CHECK_NULL_PTR(g_stINIPara.stIR.pu8ExpCompensation);
-    g_stINIPara.stIR.pu8MaxHistOffset = (HI_U8*)malloc((g_stINIPara.stIR.s32ExpCount) * sizeof(HI_U8));
-    CHECK_NULL_PTR(g_stINIPara.stIR.pu8MaxHistOffset);
+    pstPara->stIR.s32ExpCount = s32Temp;
+    pstPara->stIR.pu32ExpThreshLtoH = (HI_U32*)malloc((pstPara->stIR.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIR.pu32ExpThreshLtoH);
+    pstPara->stIR.pu32ExpThreshHtoL = (HI_U32*)malloc((pstPara->stIR.s32ExpCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIR.pu32ExpThreshHtoL);
+    pstPara->stIR.pu8ExpCompensation = (HI_U8*)malloc((pstPara->stIR.s32ExpCount) * sizeof(HI_U8));
+    CHECK_NULL_PTR(pstPara->stIR.pu8ExpCompensation);
+    pstPara->stIR.pu8MaxHistOffset = (HI_U8*)malloc((pstPara->stIR.s32ExpCount) * sizeof(HI_U8));
+    CHECK_NULL_PTR(pstPara->stIR.pu8MaxHistOffset);
 
     //IR:ExpThreshLtoH
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:ExpThreshLtoH");
+    pszTempStr = iniparser_getstr(pDict, "IR:ExpThreshLtoH");
     if (NULL == pszTempStr)
     {
         printf("IR:ExpThreshLtoH error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIR.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIR.s32ExpCount; i++)
     {
-        g_stINIPara.stIR.pu32ExpThreshLtoH[i] = MAEWeight[i];
+        pstPara->stIR.pu32ExpThreshLtoH[i] = MAEWeight[i];
     }
 
     //IR:ExpThreshHtoL
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:ExpThreshHtoL");
+    pszTempStr = iniparser_getstr(pDict, "IR:ExpThreshHtoL");
     if (NULL == pszTempStr)
     {
         printf("IR:ExpThreshHtoL error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIR.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIR.s32ExpCount; i++)
     {
-        g_stINIPara.stIR.pu32ExpThreshHtoL[i] = MAEWeight[i];
+        pstPara->stIR.pu32ExpThreshHtoL[i] = MAEWeight[i];
     }
 
     //IR:ExpCompensation
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:ExpCompensation");
+    pszTempStr = iniparser_getstr(pDict, "IR:ExpCompensation");
     if (NULL == pszTempStr)
     {
         printf("IR:ExpCompensation error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIR.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIR.s32ExpCount; i++)
     {
-        g_stINIPara.stIR.pu8ExpCompensation[i] = MAEWeight[i];
+        pstPara->stIR.pu8ExpCompensation[i] = MAEWeight[i];
     }
 
     //IR:MaxHistOffset
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:MaxHistOffset");
+    pszTempStr = iniparser_getstr(pDict, "IR:MaxHistOffset");
     if (NULL == pszTempStr)
     {
         printf("IR:MaxHistOffset error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIR.s32ExpCount; i++)
+    for (i = 0; i < pstPara->stIR.s32ExpCount; i++)
     {
-        g_stINIPara.stIR.pu8MaxHistOffset[i] = MAEWeight[i];
+        pstPara->stIR.pu8MaxHistOffset[i] = MAEWeight[i];
     }
 
     //IR:u16HistRatioSlope
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:u16HistRatioSlope", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:u16HistRatioSlope", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:u16HistRatioSlope failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u16HistRatioSlope = s32Temp;
+    pstPara->stIR.u16HistRatioSlope = s32Temp;
 
     //IR:BlackDelayFrame
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:BlackDelayFrame", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:BlackDelayFrame", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:BlackDelayFrame failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u16BlackDelayFrame = s32Temp;
+    pstPara->stIR.u16BlackDelayFrame = s32Temp;
 
     //IR:WhiteDelayFrame
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:WhiteDelayFrame", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:WhiteDelayFrame", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:WhiteDelayFrame failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u16WhiteDelayFrame = s32Temp;
+    pstPara->stIR.u16WhiteDelayFrame = s32Temp;
 
     //IR:u8Tolerance
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:u8Tolerance", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:u8Tolerance", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:u8Tolerance failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u8Tolerance = s32Temp;
+    pstPara->stIR.u8Tolerance = s32Temp;
     //IR:u8Speed
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:u8Speed", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:u8Speed", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:u8Speed failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u8Speed = s32Temp;
+    pstPara->stIR.u8Speed = s32Temp;
 
 
     //IR:AE WEIGHT
     for(i = 0; i < AE_WEIGHT_ROW; i++)
     {
         snprintf(szTempStr, sizeof(szTempStr), "IR:expweight_%d", i);
-        pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+        pszTempStr = iniparser_getstr(pDict, szTempStr);
         if (NULL == pszTempStr)
         {
             printf("IR:expweight_%d error\n", i);
@@ -5312,52 +5453,52 @@ HI_S32 Sceneauto_LoadINIPara()
         s32Temp = Weight(pszTempStr);
         for (j = 0; j < AE_WEIGHT_COLUMN; j++)
         {
-            g_stINIPara.stIR.au8Weight[i][j] = MAEWeight[j];
+            pstPara->stIR.au8Weight[i][j] = MAEWeight[j];
         }
     }
 
     //IR:DCIEnable
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:DCIEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:DCIEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:DCIEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.bDCIEnable = (HI_BOOL)s32Temp;
+    pstPara->stIR.bDCIEnable = (HI_BOOL)s32Temp;
 
     //IR:DCIBlackGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:DCIBlackGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:DCIBlackGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:DCIBlackGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u32DCIBlackGain = s32Temp;
+    pstPara->stIR.u32DCIBlackGain = s32Temp;
 
     //IR:DCIContrastGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:DCIContrastGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:DCIContrastGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:DCIContrastGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u32DCIContrastGain = s32Temp;
+    pstPara->stIR.u32DCIContrastGain = s32Temp;
 
     //IR:DCILightGain
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:DCILightGain", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:DCILightGain", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:DCILightGain failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stIR.u32DCILightGain = s32Temp;
+    pstPara->stIR.u32DCILightGain = s32Temp;
     
     //IR:IRu16Slope
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:IRu16Slope");
+    pszTempStr = iniparser_getstr(pDict, "IR:IRu16Slope");
     if(NULL == pszTempStr)
     {
         printf("IR:IRu16Slope error\n");
@@ -5366,11 +5507,11 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u16Slope[i] = MAEWeight[i];
+        pstPara->stIR.u16Slope[i] = MAEWeight[i];
     } 
 
     //IR:abEnLowLumaShoot
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:abEnLowLumaShoot");
+    pszTempStr = iniparser_getstr(pDict, "IR:abEnLowLumaShoot");
     if(NULL == pszTempStr)
     {
         printf("IR:abEnLowLumaShoot error\n");
@@ -5379,11 +5520,11 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.abEnLowLumaShoot[i] = MAEWeight[i];
+        pstPara->stIR.abEnLowLumaShoot[i] = MAEWeight[i];
     } 
 
     //IR:u8SharpenD
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8SharpenD");
+    pszTempStr = iniparser_getstr(pDict, "IR:u8SharpenD");
     if(NULL == pszTempStr)
     {
         printf("IR:u8SharpenD error\n");
@@ -5392,11 +5533,11 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u8SharpenD[i] = MAEWeight[i];
+        pstPara->stIR.u8SharpenD[i] = MAEWeight[i];
     } 
 
     //IR:u8SharpenUd
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8SharpenUd");
+    pszTempStr = iniparser_getstr(pDict, "IR:u8SharpenUd");
     if(NULL == pszTempStr)
     {
         printf("IR:u8SharpenUd error\n");
@@ -5405,12 +5546,12 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u8SharpenUd[i] = MAEWeight[i];
+        pstPara->stIR.u8SharpenUd[i] = MAEWeight[i];
     } 
 
 
     //IR:u8OverShoot
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8OverShoot");
+    pszTempStr = iniparser_getstr(pDict, "IR:u8OverShoot");
     if(NULL == pszTempStr)
     {
         printf("IR:u8OverShoot error\n");
@@ -5419,11 +5560,11 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u8OverShoot[i] = MAEWeight[i];
+        pstPara->stIR.u8OverShoot[i] = MAEWeight[i];
     } 
 
     //IR:u8UnderShoot
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8UnderShoot");
+    pszTempStr = iniparser_getstr(pDict, "IR:u8UnderShoot");
     if(NULL == pszTempStr)
     {
         printf("IR:u8UnderShoot error\n");
@@ -5432,11 +5573,11 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u8UnderShoot[i] = MAEWeight[i];
+        pstPara->stIR.u8UnderShoot[i] = MAEWeight[i];
     } 
 
     //IR:u8TextureNoiseThd
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8TextureNoiseThd");
+    pszTempStr = iniparser_getstr(pDict, "IR:u8TextureNoiseThd");
     if(NULL == pszTempStr)
     {
         printf("IR:u8TextureNoiseThd error\n");
@@ -5445,11 +5586,11 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u8TextureNoiseThd[i] = MAEWeight[i];
+        pstPara->stIR.u8TextureNoiseThd[i] = MAEWeight[i];
     } 
 
     //IR:u8EdgeNoiseThd
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:u8EdgeNoiseThd");
+    pszTempStr = iniparser_getstr(pDict, "IR:u8EdgeNoiseThd");
     if(NULL == pszTempStr)
     {
         printf("IR:u8EdgeNoiseThd error\n");
@@ -5458,13 +5599,13 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < 16; i++)
     {
-        g_stINIPara.stIR.u8EdgeNoiseThd[i] = MAEWeight[i];
+        pstPara->stIR.u8EdgeNoiseThd[i] = MAEWeight[i];
     } 
 
     //IR:gamma
     s32Offset = 0;    
     snprintf(szTempStr, sizeof(szTempStr), "IR:gamma_0");
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+    pszTempStr = iniparser_getstr(pDict, szTempStr);
     if (NULL == pszTempStr)
     {
         printf("IR:gamma_0 error\n");
@@ -5473,12 +5614,12 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.stIR.u16GammaTable[i] = MAEWeight[i];
+        pstPara->stIR.u16GammaTable[i] = MAEWeight[i];
     }
     s32Offset += s32Temp;
 
     snprintf(szTempStr, sizeof(szTempStr), "IR:gamma_1");
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+    pszTempStr = iniparser_getstr(pDict, szTempStr);
     if (NULL == pszTempStr)
     {
         printf("IR:gamma_1 error\n");
@@ -5487,12 +5628,12 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.stIR.u16GammaTable[s32Offset + i] = MAEWeight[i];
+        pstPara->stIR.u16GammaTable[s32Offset + i] = MAEWeight[i];
     }
     s32Offset += s32Temp;
 
     snprintf(szTempStr, sizeof(szTempStr), "IR:gamma_2");
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, szTempStr);
+    pszTempStr = iniparser_getstr(pDict, szTempStr);
     if (NULL == pszTempStr)
     {
         printf("IR:gamma_2 error\n");
@@ -5501,320 +5642,397 @@ HI_S32 Sceneauto_LoadINIPara()
     s32Temp = Weight(pszTempStr);
     for (i = 0; i < s32Temp; i++)
     {
-        g_stINIPara.stIR.u16GammaTable[s32Offset + i] = MAEWeight[i];
+        pstPara->stIR.u16GammaTable[s32Offset + i] = MAEWeight[i];
     }
 
     //IR:3DnrIsoCount
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "IR:3DnrIsoCount", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "IR:3DnrIsoCount", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("IR:3DnrIsoCount failed\n");
         return HI_FAILURE;
     }    
-    g_stINIPara.stIR.s323DnrIsoCount = s32Temp;
-    g_stINIPara.stIR.pu323DnrIsoThresh = (HI_U32 *)malloc((g_stINIPara.stIR.s323DnrIsoCount) * sizeof(HI_U32));
-    CHECK_NULL_PTR(g_stINIPara.stIR.pu323DnrIsoThresh);
-    g_stINIPara.stIR.pst3dnrParam = (SCENEAUTO_INIPARAM_3DNRCFG_S *)malloc((g_stINIPara.stIR.s323DnrIsoCount) * sizeof(SCENEAUTO_INIPARAM_3DNRCFG_S));
-    CHECK_NULL_PTR(g_stINIPara.stIR.pst3dnrParam);
+    pstPara->stIR.s323DnrIsoCount = s32Temp;
+    pstPara->stIR.pu323DnrIsoThresh = (HI_U32 *)malloc((pstPara->stIR.s323DnrIsoCount) * sizeof(HI_U32));
+    CHECK_NULL_PTR(pstPara->stIR.pu323DnrIsoThresh);
+    pstPara->stIR.pst3dnrParam = (SCENEAUTO_INIPARAM_3DNRCFG_S *)malloc((pstPara->stIR.s323DnrIsoCount) * sizeof(SCENEAUTO_INIPARAM_3DNRCFG_S));
+    CHECK_NULL_PTR(pstPara->stIR.pst3dnrParam);
 
     //IR:3DnrIsoThresh
-    pszTempStr = iniparser_getstr(g_Sceneautodictionary, "IR:3DnrIsoThresh");
+    pszTempStr = iniparser_getstr(pDict, "IR:3DnrIsoThresh");
     if (NULL == pszTempStr)
     {
         printf("IR:3DnrIsoThresh error\n");
         return HI_FAILURE;
     }
     s32Temp = Weight(pszTempStr);
-    for (i = 0; i < g_stINIPara.stIR.s323DnrIsoCount; i++)
+    for (i = 0; i < pstPara->stIR.s323DnrIsoCount; i++)
     {
-        g_stINIPara.stIR.pu323DnrIsoThresh[i] = MAEWeight[i];
+        pstPara->stIR.pu323DnrIsoThresh[i] = MAEWeight[i];
     }
     
-    for (i = 0; i < g_stINIPara.stIR.s323DnrIsoCount; i++)
+    for (i = 0; i < pstPara->stIR.s323DnrIsoCount; i++)
     {
         //IR:s32YPKStr
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YPKStr_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YPKStr_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YPKStr = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YPKStr = s32Temp;
     
         //IR:s32YSFStr
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YSFStr_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YSFStr_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YSFStr = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YSFStr = s32Temp;
         
         //IR:s32YTFStr
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YTFStr_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YTFStr_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YTFStr = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YTFStr = s32Temp;
         
         //IR:s32TFStrMax  
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32TFStrMax_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32TFStrMax_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32TFStrMax = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32TFStrMax = s32Temp;
         
         //IR:s32TFStrMov 
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32TFStrMov_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32TFStrMov_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32TFStrMov = s32Temp;    
+        pstPara->stIR.pst3dnrParam[i].s32TFStrMov = s32Temp;    
     
         //IR:s32YSmthStr
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YSmthStr_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YSmthStr_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YSmthStr = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YSmthStr = s32Temp;
     
         //IR:s32YSmthRat
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YSmthRat_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YSmthRat_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YSmthRat = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YSmthRat = s32Temp;
     
     
         //IR:s32YSFStrDlt
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YSFStrDlt_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YSFStrDlt_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YSFStrDlt = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YSFStrDlt = s32Temp;
         
         //IR:s32YSFStrDl
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YSFStrDl_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YSFStrDl_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YSFStrDl = s32Temp;    
+        pstPara->stIR.pst3dnrParam[i].s32YSFStrDl = s32Temp;    
     
         //IR:s32YTFStrDlt
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YTFStrDlt_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YTFStrDlt_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YTFStrDlt = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YTFStrDlt = s32Temp;
     
         //IR:s32YTFStrDl
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YTFStrDl_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YTFStrDl_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YTFStrDl = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YTFStrDl = s32Temp;
     
         //IR:s32YSFBriRat
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YSFBriRat_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YSFBriRat_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YSFBriRat = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YSFBriRat = s32Temp;
     
         //IR:s32CSFStr
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32CSFStr_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32CSFStr_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32CSFStr = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32CSFStr = s32Temp;
     
         //IR:s32CTFstr
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32CTFstr_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32CTFstr_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32CTFstr = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32CTFstr = s32Temp;
 
         //IR:s32YTFMdWin
         snprintf(szTempStr, sizeof(szTempStr), "IR:s32YTFMdWin_%d", i);
         s32Temp = 0;
-        s32Temp = iniparser_getint(g_Sceneautodictionary, szTempStr, HI_FAILURE);
+        s32Temp = iniparser_getint(pDict, szTempStr, HI_FAILURE);
         if (HI_FAILURE == s32Temp)
         {
             printf("IR:s32YTFMdWin_%d failed\n", i);
             return HI_FAILURE;
         }
-        g_stINIPara.stIR.pst3dnrParam[i].s32YTFMdWin = s32Temp;
+        pstPara->stIR.pst3dnrParam[i].s32YTFMdWin = s32Temp;
     }
 
+    return HI_SUCCESS;
+}
+
+static HI_S32 Sceneauto_LoadDRCPara(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict)
+{
+    HI_S32 s32Temp = 0;
+
     /*************************DRC***************************/
 	//pthread_mutex_unlock(&g_stIniParaLock);
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.bDRCEnable = (HI_BOOL)s32Temp;
+    pstPara->stDRC.bDRCEnable = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCManulEnable", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCManulEnable", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCManulEnable failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.bDRCManulEnable = (HI_BOOL)s32Temp;
+    pstPara->stDRC.bDRCManulEnable = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCStrengthTarget", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCStrengthTarget", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCStrengthTarget failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8Strength = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8Strength = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu16BrightGainLmt", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu16BrightGainLmt", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu16BrightGainLmt failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u16BrightGainLmt = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u16BrightGainLmt = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu16DarkGainLmtC", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu16DarkGainLmtC", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu16DarkGainLmtC failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u16DarkGainLmtC = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u16DarkGainLmtC = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu16DarkGainLmtY", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu16DarkGainLmtY", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu16DarkGainLmtY failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u16DarkGainLmtY = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u16DarkGainLmtY = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8Asymmetry", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8Asymmetry", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8Asymmetry failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8Asymmetry = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8Asymmetry = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8LocalMixingBright", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8LocalMixingBright", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8LocalMixingBright failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8LocalMixingBright = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8LocalMixingBright = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8LocalMixingDark", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8LocalMixingDark", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8LocalMixingDark failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8LocalMixingDark = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8LocalMixingDark = (HI_BOOL)s32Temp;
     s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8LocalMixingThres", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8LocalMixingThres", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8LocalMixingThres failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8LocalMixingThres = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8LocalMixingThres = (HI_BOOL)s32Temp;
 	s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8RangeVar", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8RangeVar", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8RangeVar failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8RangeVar = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8RangeVar = (HI_BOOL)s32Temp;
 	s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8SecondPole", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8SecondPole", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8SecondPole failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8SecondPole = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8SecondPole = (HI_BOOL)s32Temp;
 	s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8SpatialVar", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8SpatialVar", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8SpatialVar failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8SpatialVar = (HI_BOOL)s32Temp;
+    pstPara->stDRC.u8SpatialVar = (HI_BOOL)s32Temp;
 	s32Temp = 0;
-    s32Temp = iniparser_getint(g_Sceneautodictionary, "DRC:DRCu8Stretch", HI_FAILURE);
+    s32Temp = iniparser_getint(pDict, "DRC:DRCu8Stretch", HI_FAILURE);
     if (HI_FAILURE == s32Temp)
     {
         printf("DRC:DRCu8Stretch failed\n");
         return HI_FAILURE;
     }
-    g_stINIPara.stDRC.u8Stretch = (HI_BOOL)s32Temp;
-	
+    pstPara->stDRC.u8Stretch = (HI_BOOL)s32Temp;
+
+    return HI_SUCCESS;
+}
+
+/* ini sections the loaders read, in the bit order of SCENEAUTO_SECTION_XXX */
+static const HI_CHAR *g_apszSceneautoIniSection[] =
+{
+    "common", "ae", "sharpen", "gamma", "h264venc", "h265venc", "3dnr", "blc", "dynamic", "hlc", "ir", "drc"
+};
+
+#define SCENEAUTO_INI_SECTION_NUM   (sizeof(g_apszSceneautoIniSection) / sizeof(g_apszSceneautoIniSection[0]))
+#define SCENEAUTO_SECTION_COMMON      (1 << 0)
+#define SCENEAUTO_SECTION_AE          (1 << 1)
+#define SCENEAUTO_SECTION_SHARPEN     (1 << 2)
+#define SCENEAUTO_SECTION_GAMMA       (1 << 3)
+#define SCENEAUTO_SECTION_H264VENC    (1 << 4)
+#define SCENEAUTO_SECTION_H265VENC    (1 << 5)
+#define SCENEAUTO_SECTION_3DNR        (1 << 6)
+#define SCENEAUTO_SECTION_BLC         (1 << 7)
+#define SCENEAUTO_SECTION_DYNAMIC     (1 << 8)
+#define SCENEAUTO_SECTION_HLC         (1 << 9)
+#define SCENEAUTO_SECTION_IR          (1 << 10)
+#define SCENEAUTO_SECTION_DRC         (1 << 11)
+#define SCENEAUTO_SECTION_ALL         ((1 << SCENEAUTO_INI_SECTION_NUM) - 1)
+
+/* each loader fills one contiguous part of SCENEAUTO_INIPARA_S, first to last member */
+typedef struct hiSCENEAUTO_INISECTION_S
+{
+    HI_U32 u32SectionMask;
+    HI_U32 u32Offset;
+    HI_U32 u32Size;
+    HI_S32 (*pfnLoad)(SCENEAUTO_INIPARA_S *pstPara, const dictionary *pDict);
+}SCENEAUTO_INISECTION_S;
+
+#define SCENEAUTO_INISECTION(mask, first, last, fn) \
+    {mask, offsetof(SCENEAUTO_INIPARA_S, first), \
+     offsetof(SCENEAUTO_INIPARA_S, last) + sizeof(((SCENEAUTO_INIPARA_S *)0)->last) - offsetof(SCENEAUTO_INIPARA_S, first), fn}
+
+static const SCENEAUTO_INISECTION_S g_astSceneautoSection[] =
+{
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_COMMON, au8DciStrengthLut, stThreshValue, Sceneauto_LoadCommonPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_AE, stIniAE, stIniAE, Sceneauto_LoadAEPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_SHARPEN, stIniSharpen, stIniSharpen, Sceneauto_LoadSharpenPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_GAMMA, stIniGamma, stIniGamma, Sceneauto_LoadGammaPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_H264VENC, stIniH264Venc, stIniH264Venc, Sceneauto_LoadH264VencPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_H265VENC, stIniH265Venc, stIniH265Venc, Sceneauto_LoadH265VencPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_3DNR, stIni3dnr, stIni3dnr, Sceneauto_Load3dnrPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_BLC, stBLC, stBLC, Sceneauto_LoadBLCPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_DYNAMIC, stFastDynamic, stNormalDynamic, Sceneauto_LoadDynamicPara),
+    /* the HLC loader also takes u8UnderShoot from [IR] */
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_HLC | SCENEAUTO_SECTION_IR, stHLC, stHLC, Sceneauto_LoadHLCPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_IR, stIR, stIR, Sceneauto_LoadIRPara),
+    SCENEAUTO_INISECTION(SCENEAUTO_SECTION_DRC, stDRC, stDRC, Sceneauto_LoadDRCPara),
+};
+
+#define SCENEAUTO_INISECTION_NUM    (sizeof(g_astSceneautoSection) / sizeof(g_astSceneautoSection[0]))
+
+HI_S32 Sceneauto_LoadINIPara()
+{
+    HI_U32 i;
+    HI_S32 s32Ret;
+
+    for (i = 0; i < SCENEAUTO_INISECTION_NUM; i++)
+    {
+        s32Ret = g_astSceneautoSection[i].pfnLoad(&g_stINIPara, g_Sceneautodictionary);
+        if (HI_SUCCESS != s32Ret)
+        {
+            return HI_FAILURE;
+        }
+    }
+
     return HI_SUCCESS;
 }
 
@@ -5845,122 +6063,504 @@ HI_S32 Sceneauto_LoadFile(const HI_CHAR *pszFILENAME)
     return HI_SUCCESS;
 }
 
-void *SceneAuto_NormalThread(void *pVoid)
+/* 3DNR interpolation is a pure function of the iso index, tabulate it once per load */
+static HI_VOID Sceneauto_BuildLut(HI_VOID)
 {
-    HI_S32 s32Ret = HI_SUCCESS;
-    HI_S32 i;
-    HI_S32 s32AECurPos = 0;
-    HI_S32 s32IRAECurPos = 0;
-    HI_U32 u32Exposure = 0;
-    HI_U32 u32Iso = 0;
-    HI_U32 u32LastExposure = (MAX_LEVEL + 1);
-    HI_S32 s32GammaExpLevel = 0;
-    HI_S32 s32LastGammaExpLevel = 0;
-    HI_U32 u32GammaExposure = 0;
-    HI_U32 u32LastGammaExposure = 0;
-    HI_U32 u32GammaCount = 0;
-    HI_U32 u32Bitrate = 0;
-    HI_U32 u32LastBitrate = (MAX_LEVEL + 1);
-    HI_S32 s32VencBitrateLevel = 0;
-	HI_S32 s32LastVencBitrateLevel = (MAX_LEVEL + 1);
-    HI_S32 u32Lastu32sharpenIso = 0;
-	HI_S32 s32AEBitrateLevel = 0;
-	HI_S32 s32LastAEBitrateLevel = (MAX_LEVEL + 1);
-	HI_S32 s32H265FaceCfgBitrateLevel = 0;
-	HI_S32 s32LastH265FaceCfgBitrateLevel = (MAX_LEVEL + 1);
-	HI_S32 s32H265FaceCfgExpLevel = 0;
-	HI_S32 s32LastH265FaceCfgExpLevel = (MAX_LEVEL + 1);
-    HI_S32 s32IspDev = 0;
-    HI_S32 s32VencChn = 0;
-    HI_S32 s32VpssGrp = 0;
-    HI_S32 s32ViDev = 0;
-    HI_U64 u64Temp = 0;
-    HI_U8 u8DciStrength = 0;
-    HI_U32 u8DrcGain = 0;
-    HI_BOOL bDefogState = HI_FALSE;
-    HI_BOOL bDciEnable;
-    HI_U32 u32BlackGain;
-    HI_U32 u32ContrastGain;
-    HI_U32 u32LightGain; 
-    ADPT_SCENEAUTO_EXPOSUREINFO_S stAdptExposureInfo;
-    ADPT_SCENEAUTO_DRCATTR_S stAdptDrcAttr;
-    ADPT_SCENEAUTO_WDRATTR_S stAdptWdrAttr;
-    ADPT_SCENEAUTO_SHARPEN_S stAdptSharpen;
-    ADPT_SCENEAUTO_STATEINFO_S stAdptStatInfo;
-    ADPT_SCENEAUTO_DEFOG_ATTR_S stAdptDefogAttr;
-    ADPT_SCENEAUTO_DCIPARAM_S stAdptDciParam;
-    ADPT_SCENEAUTO_VENC_ATTR_S stAdptVencAttr;
-    ADPT_SCENEAUTO_RGBIRPARAM_S stAdptRgbirParam;
-    HI_S32 s32IsoLevel,s32IsoLevel1;
-    SCENEAUTO_INIPARAM_3DNRCFG_S stSceneauto3dnr;
-
-    SRDK_SCENEAUTO_SEPCIAL_SCENE_E eSpecialScene;
-    eSpecialScene = g_eSpecialScene;
-
-    prctl(PR_SET_NAME, (unsigned long)"SceneautoNormalThread", 0,0,0);
-    s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
-    s32VencChn = g_stINIPara.stMpInfo.s32VencChn;
-    s32VpssGrp = g_stINIPara.stMpInfo.s32VpssGrp;
-    s32ViDev = g_stINIPara.stMpInfo.s32ViDev;
+    HI_S32 s32Ret;
 
-    //get the DCI value	
-    s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDciParam);
+    s32Ret = Sceneauto_Build3dnrLut(&g_st3dnrLut, g_stINIPara.stIni3dnr.s323DnrIsoCount,
+                                    g_stINIPara.stIni3dnr.pu323DnrIsoThresh, g_stINIPara.stIni3dnr.pst3dnrParam);
     if (HI_SUCCESS != s32Ret)
     {
-        printf("CommSceneautoGetDCIParam failed\n");
+        printf("3dnr lut not built, interpolate per frame\n");
     }
-    bDciEnable = stAdptDciParam.bEnable;
-    u32BlackGain = stAdptDciParam.u32BlackGain;
-    u32ContrastGain = stAdptDciParam.u32ContrastGain;
-    u32LightGain = stAdptDciParam.u32LightGain;
-
-	
+    s32Ret = Sceneauto_Build3dnrLut(&g_stHLC3dnrLut, g_stINIPara.stHLC.s323DnrIsoCount,
+                                    g_stINIPara.stHLC.pu323DnrIsoThresh, g_stINIPara.stHLC.pst3dnrParam);
     if (HI_SUCCESS != s32Ret)
     {
-        printf("CommSceneautoLoad3DNRdata failed\n");
+        printf("HLC 3dnr lut not built, interpolate per frame\n");
     }
-	
-    while (g_bNormalThreadFlag == HI_TRUE)
+    s32Ret = Sceneauto_Build3dnrLut(&g_stIR3dnrLut, g_stINIPara.stIR.s323DnrIsoCount,
+                                    g_stINIPara.stIR.pu323DnrIsoThresh, g_stINIPara.stIR.pst3dnrParam);
+    if (HI_SUCCESS != s32Ret)
     {
-        //get the exposure value
-        s32Ret = CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo);
-        if (HI_SUCCESS != s32Ret)
-        {
-            printf("CommSceneautoGetExposureInfo failed\n");
-        }
-        s32Ret = CommSceneautoGetRgbirParam(s32IspDev, &stAdptRgbirParam);
-        if (HI_SUCCESS != s32Ret)
+        printf("IR 3dnr lut not built, interpolate per frame\n");
+    }
+}
+
+/* an ini entry is "section" or "section:key", both dictionaries hold lower case keys */
+static HI_BOOL Sceneauto_IsSectionKey(const HI_CHAR *pszKey, const HI_CHAR *pszSection)
+{
+    HI_U32 u32Len = strlen(pszSection);
+
+    return ((0 == strncmp(pszKey, pszSection, u32Len)) && (('\0' == pszKey[u32Len]) || (':' == pszKey[u32Len])))
+           ? HI_TRUE : HI_FALSE;
+}
+
+static HI_BOOL Sceneauto_IsSectionChanged(const dictionary *pOldDict, const dictionary *pNewDict, const HI_CHAR *pszSection)
+{
+    HI_CHAR cAbsent;
+    HI_CHAR *pszOldVal;
+    HI_S32 s32OldNum = 0;
+    HI_S32 s32NewNum = 0;
+    HI_S32 i;
+
+    for (i = 0; i < pNewDict->size; i++)
+    {
+        if ((NULL == pNewDict->key[i]) || (HI_TRUE != Sceneauto_IsSectionKey(pNewDict->key[i], pszSection)))
         {
-            printf("CommSceneautoGetRgbirParam failed\n");
+            continue;
         }
-        if (stAdptRgbirParam.bEnable)
+        s32NewNum++;
+        pszOldVal = dictionary_get(pOldDict, pNewDict->key[i], &cAbsent);
+        if ((&cAbsent == pszOldVal) || ((NULL == pszOldVal) != (NULL == pNewDict->val[i]))
+            || ((NULL != pszOldVal) && (0 != strcmp(pszOldVal, pNewDict->val[i]))))
         {
-            u64Temp = ((HI_U64)stAdptExposureInfo.u32AGain * (HI_U64)stAdptExposureInfo.u32DGain * (HI_U64)stAdptExposureInfo.u32ISPDGain) >> 30;
-            u64Temp = (u64Temp * (HI_U64)stAdptExposureInfo.u16RgbirGain * (HI_U64)stAdptExposureInfo.u16RgbirGain) >> 16;
+            return HI_TRUE;
         }
-        else
+    }
+    for (i = 0; i < pOldDict->size; i++)
+    {
+        if ((NULL != pOldDict->key[i]) && (HI_TRUE == Sceneauto_IsSectionKey(pOldDict->key[i], pszSection)))
         {
-            u64Temp = ((HI_U64)stAdptExposureInfo.u32AGain * (HI_U64)stAdptExposureInfo.u32DGain * (HI_U64)stAdptExposureInfo.u32ISPDGain) >> 30;                        
+            s32OldNum++;
         }
-        u32Exposure = (HI_U32)u64Temp * stAdptExposureInfo.u32ExpTime;
+    }
 
+    return (s32OldNum != s32NewNum) ? HI_TRUE : HI_FALSE;
+}
 
-        s32Ret = CommSceneautoGetDRCAttr(s32IspDev, &stAdptDrcAttr);
-        if (HI_SUCCESS)
-        {
-            printf("CommSceneautoGetDRCAttr failed\n");
-        }
-        s32Ret = CommSceneautoGetWDRAttr(s32IspDev, &stAdptWdrAttr);
-        if (HI_SUCCESS)
+/* drop a shadow set the normal thread has not swapped in, the running set shares none of its arrays */
+static HI_VOID Sceneauto_FreeShadow()
+{
+    HI_U32 i;
+
+    for (i = 0; i < SCENEAUTO_INISECTION_NUM; i++)
+    {
+        if (0 != (g_stSceneautoReload.u32LoaderMask & (1 << i)))
         {
-            printf("CommSceneautoGetWDRAttr failed\n");
+            Sceneauto_FreeParaArrays(&g_stSceneautoReload.stShadowPara,
+                                     g_astSceneautoSection[i].u32Offset, g_astSceneautoSection[i].u32Size);
         }
+    }
+    if (NULL != g_stSceneautoReload.pShadowDict)
+    {
+        iniparser_freedict(g_stSceneautoReload.pShadowDict);
+        g_stSceneautoReload.pShadowDict = NULL;
+    }
+    g_stSceneautoReload.u32LoaderMask = 0;
+    g_stSceneautoReload.bPending = HI_FALSE;
+}
 
-        //exposure value if different in WDR
-        if (stAdptWdrAttr.u8WdrMode != 0)
+/*
+ * Parse the edited ini into a shadow set: a copy of the running one whose
+ * changed sections are parsed again, unchanged arrays are shared. Returns
+ * HI_FAILURE only when the lock is busy and the reload must be retried.
+ */
+static HI_S32 Sceneauto_PrepareReload(HI_U64 u64EventTime)
+{
+    dictionary *pNewDict;
+    HI_U32 u32SectionMask = 0;
+    HI_U32 u32LoaderMask = 0;
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U32 i;
+
+    /* Stop/DeInit join this thread with the lock held */
+    if (0 != pthread_mutex_trylock(&g_stSceneautoLock))
+    {
+        return HI_FAILURE;
+    }
+
+    pNewDict = iniparser_load(g_szSceneautoIniFile);
+    if (NULL == pNewDict)
+    {
+        printf("sceneauto reload: load %s failed, keep the running parameters\n", g_szSceneautoIniFile);
+        g_stSceneautoReloadStatus.u32FailCount++;
+        pthread_mutex_unlock(&g_stSceneautoLock);
+        return HI_SUCCESS;
+    }
+
+    /* a newer edit replaces one the normal thread has not picked up yet */
+    Sceneauto_FreeShadow();
+
+    /* parameters mapped from the .bin have no dictionary to compare with */
+    if (NULL == g_Sceneautodictionary)
+    {
+        u32SectionMask = SCENEAUTO_SECTION_ALL;
+    }
+    else
+    {
+        for (i = 0; i < SCENEAUTO_INI_SECTION_NUM; i++)
+        {
+            if (HI_TRUE == Sceneauto_IsSectionChanged(g_Sceneautodictionary, pNewDict, g_apszSceneautoIniSection[i]))
+            {
+                u32SectionMask |= (1 << i);
+            }
+        }
+    }
+    if (0 == u32SectionMask)
+    {
+        iniparser_freedict(pNewDict);
+        pthread_mutex_unlock(&g_stSceneautoLock);
+        return HI_SUCCESS;
+    }
+
+    /* a full reload must not share arrays with a mapped .bin, it is unmapped on swap */
+    if (SCENEAUTO_SECTION_ALL == u32SectionMask)
+    {
+        memset(&g_stSceneautoReload.stShadowPara, 0, sizeof(SCENEAUTO_INIPARA_S));
+    }
+    else
+    {
+        memcpy(&g_stSceneautoReload.stShadowPara, &g_stINIPara, sizeof(SCENEAUTO_INIPARA_S));
+    }
+    for (i = 0; i < SCENEAUTO_INISECTION_NUM; i++)
+    {
+        if (0 != (g_astSceneautoSection[i].u32SectionMask & u32SectionMask))
+        {
+            u32LoaderMask |= (1 << i);
+            memset((HI_U8 *)&g_stSceneautoReload.stShadowPara + g_astSceneautoSection[i].u32Offset, 0,
+                   g_astSceneautoSection[i].u32Size);
+        }
+    }
+    g_stSceneautoReload.u32LoaderMask = u32LoaderMask;
+    g_stSceneautoReload.pShadowDict = pNewDict;
+
+    for (i = 0; i < SCENEAUTO_INISECTION_NUM; i++)
+    {
+        if (0 != (u32LoaderMask & (1 << i)))
+        {
+            s32Ret = g_astSceneautoSection[i].pfnLoad(&g_stSceneautoReload.stShadowPara, pNewDict);
+            if (HI_SUCCESS != s32Ret)
+            {
+                break;
+            }
+        }
+    }
+    if (HI_SUCCESS != s32Ret)
+    {
+        printf("sceneauto reload: parse %s failed, keep the running parameters\n", g_szSceneautoIniFile);
+        Sceneauto_FreeShadow();
+        g_stSceneautoReloadStatus.u32FailCount++;
+        pthread_mutex_unlock(&g_stSceneautoLock);
+        return HI_SUCCESS;
+    }
+
+    g_stSceneautoReload.u32SectionMask = u32SectionMask;
+    g_stSceneautoReload.u64EventTime = u64EventTime;
+    g_stSceneautoReload.u64ParseTime = Sceneauto_GetTimeUs();
+    g_stSceneautoReload.bPending = HI_TRUE;
+    pthread_mutex_unlock(&g_stSceneautoLock);
+
+    return HI_SUCCESS;
+}
+
+/* re-apply the special scene whose parameters were just replaced, lock held */
+static HI_VOID Sceneauto_ReapplySpecialScene(HI_U32 u32SectionMask)
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    if ((SRDK_SCENEAUTO_SPECIAL_SCENE_BLC == g_eSpecialScene) && (0 != (u32SectionMask & SCENEAUTO_SECTION_BLC)))
+    {
+        s32Ret = SceneAuto_SetBLC();
+    }
+    else if ((SRDK_SCENEAUTO_SPECIAL_SCENE_IR == g_eSpecialScene) && (0 != (u32SectionMask & SCENEAUTO_SECTION_IR)))
+    {
+        s32Ret = SceneAuto_SetIR();
+    }
+    else if ((SRDK_SCENEAUTO_SPECIAL_SCENE_HLC == g_eSpecialScene)
+             && (0 != (u32SectionMask & (SCENEAUTO_SECTION_HLC | SCENEAUTO_SECTION_IR))))
+    {
+        s32Ret = SceneAuto_SetHLC();
+    }
+    else if ((SRDK_SCENEAUTO_SPECIAL_SCENE_DYNAMIC == g_eSpecialScene) && (0 != (u32SectionMask & SCENEAUTO_SECTION_DYNAMIC)))
+    {
+        s32Ret = SceneAuto_SetDynamic();
+    }
+    else if ((SRDK_SCENEAUTO_SPECIAL_SCENE_DRC == g_eSpecialScene) && (0 != (u32SectionMask & SCENEAUTO_SECTION_DRC)))
+    {
+        s32Ret = SceneAuto_SetDRC();
+    }
+    if (HI_SUCCESS != s32Ret)
+    {
+        printf("sceneauto reload: special scene %d set failed\n", g_eSpecialScene);
+    }
+}
+
+/*
+ * Called by the normal thread between cycles: swap the shadow set in and
+ * free what it replaced. Returns the changed ini sections, 0 if none.
+ */
+static HI_U32 Sceneauto_ApplyReload()
+{
+    HI_U32 u32SectionMask;
+    HI_U64 u64Now;
+    HI_U32 u32Len = 0;
+    HI_U32 i;
+
+    if (HI_TRUE != g_stSceneautoReload.bPending)
+    {
+        return 0;
+    }
+    /* an API call holds the lock, swap at the next cycle */
+    if (0 != pthread_mutex_trylock(&g_stSceneautoLock))
+    {
+        return 0;
+    }
+    if (HI_TRUE != g_stSceneautoReload.bPending)
+    {
+        pthread_mutex_unlock(&g_stSceneautoLock);
+        return 0;
+    }
+
+    /* a mapped set was parsed again as a whole and shares nothing with the shadow */
+    if (HI_TRUE == Sceneauto_IsBinParaMapped(&g_stINIPara))
+    {
+        Sceneauto_UnmapBinPara(&g_stINIPara);
+    }
+    else
+    {
+        for (i = 0; i < SCENEAUTO_INISECTION_NUM; i++)
         {
-            s32Ret = CommSceneautoGetQueryInnerStateInfo(s32IspDev, &stAdptStatInfo);
-            if (HI_SUCCESS)
+            if (0 != (g_stSceneautoReload.u32LoaderMask & (1 << i)))
+            {
+                Sceneauto_FreeParaArrays(&g_stINIPara, g_astSceneautoSection[i].u32Offset, g_astSceneautoSection[i].u32Size);
+            }
+        }
+    }
+    memcpy(&g_stINIPara, &g_stSceneautoReload.stShadowPara, sizeof(SCENEAUTO_INIPARA_S));
+    Sceneauto_FreeDict();
+    g_Sceneautodictionary = g_stSceneautoReload.pShadowDict;
+    g_stSceneautoReload.pShadowDict = NULL;
+    g_stSceneautoReload.u32LoaderMask = 0;
+    g_stSceneautoReload.bPending = HI_FALSE;
+    Sceneauto_BuildLut();
+
+    u32SectionMask = g_stSceneautoReload.u32SectionMask;
+    Sceneauto_ReapplySpecialScene(u32SectionMask);
+
+    u64Now = Sceneauto_GetTimeUs();
+    g_stSceneautoReloadStatus.u32ReloadCount++;
+    g_stSceneautoReloadStatus.u32ParseTime = (HI_U32)(g_stSceneautoReload.u64ParseTime - g_stSceneautoReload.u64EventTime);
+    g_stSceneautoReloadStatus.u32ReloadTime = (HI_U32)(u64Now - g_stSceneautoReload.u64EventTime);
+    g_stSceneautoReloadStatus.szChangedSection[0] = '\0';
+    for (i = 0; i < SCENEAUTO_INI_SECTION_NUM; i++)
+    {
+        if ((0 != (u32SectionMask & (1 << i))) && (u32Len < SRDK_SCENEAUTO_SECTION_LIST_LEN))
+        {
+            u32Len += snprintf(g_stSceneautoReloadStatus.szChangedSection + u32Len, SRDK_SCENEAUTO_SECTION_LIST_LEN - u32Len,
+                               (0 == u32Len) ? "%s" : " %s", g_apszSceneautoIniSection[i]);
+        }
+    }
+    pthread_mutex_unlock(&g_stSceneautoLock);
+
+    printf("sceneauto reload: [%s] in use %u us after the ini was written\n",
+           g_stSceneautoReloadStatus.szChangedSection, g_stSceneautoReloadStatus.u32ReloadTime);
+
+    return u32SectionMask;
+}
+
+static HI_BOOL Sceneauto_InExpHysteresis(HI_U32 u32Exposure, HI_U32 u32LastExposure)
+{
+    HI_U64 u64Delta;
+
+    u64Delta = (u32Exposure > u32LastExposure) ? (u32Exposure - u32LastExposure) : (u32LastExposure - u32Exposure);
+
+    return ((u64Delta * 100) <= ((HI_U64)u32LastExposure * g_stINIPara.stThreshValue.u32ExpHysteresis)) ? HI_TRUE : HI_FALSE;
+}
+
+static HI_VOID Sceneauto_UpdateMpiRate()
+{
+    HI_U64 u64Now;
+    HI_U64 u64Calls;
+
+    u64Now = Sceneauto_GetTimeUs();
+    if (u64Now - g_u64SceneautoStatTime < 1000000)
+    {
+        return;
+    }
+
+    u64Calls = g_stSceneautoStat.u64MpiGetCalls + g_stSceneautoStat.u64MpiSetCalls;
+    g_stSceneautoStat.u32MpiCallsPerSec = (HI_U32)(((u64Calls - g_u64SceneautoStatCalls) * 1000000 + 500000)
+                                                   / (u64Now - g_u64SceneautoStatTime));
+    g_u64SceneautoStatCalls = u64Calls;
+    g_u64SceneautoStatTime = u64Now;
+}
+
+void *SceneAuto_NormalThread(void *pVoid)
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_S32 i;
+    HI_S32 s32AECurPos = 0;
+    HI_S32 s32LastAECurPos = -1;
+    HI_S32 s32IRAECurPos = 0;
+    HI_S32 s32LastIRAECurPos = -1;
+    HI_U32 u32Exposure = 0;
+    HI_U32 u32Iso = 0;
+    HI_U32 u32LastExposure = (MAX_LEVEL + 1);
+    HI_U32 u32LastIso = 0;
+    HI_S32 s32GammaExpLevel = 0;
+    HI_S32 s32LastGammaExpLevel = 0;
+    HI_U32 u32GammaExposure = 0;
+    HI_U32 u32LastGammaExposure = 0;
+    HI_U32 u32GammaCount = 0;
+    HI_U32 u32Bitrate = 0;
+    HI_U32 u32LastBitrate = (MAX_LEVEL + 1);
+    HI_S32 s32VencBitrateLevel = 0;
+	HI_S32 s32LastVencBitrateLevel = (MAX_LEVEL + 1);
+    HI_S32 u32Lastu32sharpenIso = 0;
+	HI_S32 s32AEBitrateLevel = 0;
+	HI_S32 s32LastAEBitrateLevel = (MAX_LEVEL + 1);
+	HI_S32 s32H265FaceCfgBitrateLevel = 0;
+	HI_S32 s32LastH265FaceCfgBitrateLevel = (MAX_LEVEL + 1);
+	HI_S32 s32H265FaceCfgExpLevel = 0;
+	HI_S32 s32LastH265FaceCfgExpLevel = (MAX_LEVEL + 1);
+    HI_S32 s32IspDev = 0;
+    HI_S32 s32VencChn = 0;
+    HI_S32 s32VpssGrp = 0;
+    HI_S32 s32ViDev = 0;
+    HI_U64 u64Temp = 0;
+    HI_U8 u8DciStrength = 0;
+    HI_U8 u8LastDciStrength = 0;
+    HI_U32 u8DrcGain = 0;
+    HI_BOOL bDefogState = HI_FALSE;
+    HI_BOOL bDciEnable;
+    HI_U32 u32BlackGain;
+    HI_U32 u32ContrastGain;
+    HI_U32 u32LightGain; 
+    HI_U32 u32Cycle = 0;
+    HI_U64 u64SetCalls;
+    HI_BOOL bSceneChanged;
+    HI_BOOL b3dnrValid = HI_FALSE;
+    HI_U32 u32ReloadMask;
+    ADPT_SCENEAUTO_EXPOSUREINFO_S stAdptExposureInfo;
+    ADPT_SCENEAUTO_DRCATTR_S stAdptDrcAttr;
+    ADPT_SCENEAUTO_WDRATTR_S stAdptWdrAttr;
+    ADPT_SCENEAUTO_SHARPEN_S stAdptSharpen;
+    ADPT_SCENEAUTO_STATEINFO_S stAdptStatInfo;
+    ADPT_SCENEAUTO_DEFOG_ATTR_S stAdptDefogAttr;
+    ADPT_SCENEAUTO_DCIPARAM_S stAdptDciParam;
+    ADPT_SCENEAUTO_VENC_ATTR_S stAdptVencAttr;
+    ADPT_SCENEAUTO_RGBIRPARAM_S stAdptRgbirParam;
+    SCENEAUTO_INIPARAM_3DNRCFG_S stSceneauto3dnr;
+    SCENEAUTO_INIPARAM_3DNRCFG_S stLastSceneauto3dnr;
+
+    SRDK_SCENEAUTO_SEPCIAL_SCENE_E eSpecialScene;
+    eSpecialScene = g_eSpecialScene;
+
+    prctl(PR_SET_NAME, (unsigned long)"SceneautoNormalThread", 0,0,0);
+    s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
+    s32VencChn = g_stINIPara.stMpInfo.s32VencChn;
+    s32VpssGrp = g_stINIPara.stMpInfo.s32VpssGrp;
+    s32ViDev = g_stINIPara.stMpInfo.s32ViDev;
+
+    //get the DCI value	
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDciParam));
+    if (HI_SUCCESS != s32Ret)
+    {
+        printf("CommSceneautoGetDCIParam failed\n");
+    }
+    bDciEnable = stAdptDciParam.bEnable;
+    u32BlackGain = stAdptDciParam.u32BlackGain;
+    u32ContrastGain = stAdptDciParam.u32ContrastGain;
+    u32LightGain = stAdptDciParam.u32LightGain;
+
+    memset(&g_stSceneautoStat, 0, sizeof(g_stSceneautoStat));
+    g_u64SceneautoStatTime = Sceneauto_GetTimeUs();
+    g_u64SceneautoStatCalls = 0;
+	
+    while (g_bNormalThreadFlag == HI_TRUE)
+    {
+        u64SetCalls = g_stSceneautoStat.u64MpiSetCalls;
+        bSceneChanged = (eSpecialScene != g_eSpecialScene) ? HI_TRUE : HI_FALSE;
+
+        /* this thread reads g_stINIPara without the lock, so it swaps edited parameters in itself;
+         * the special thread copies its thresholds under the lock once per cycle */
+        u32ReloadMask = Sceneauto_ApplyReload();
+        if (0 != u32ReloadMask)
+        {
+            bSceneChanged = HI_TRUE;
+            s32AECurPos = 0;
+            s32LastAECurPos = -1;
+            s32IRAECurPos = 0;
+            s32LastIRAECurPos = -1;
+            u32LastExposure = (MAX_LEVEL + 1);
+            u32LastGammaExposure = 0;
+            u32LastBitrate = (MAX_LEVEL + 1);
+            s32LastVencBitrateLevel = (MAX_LEVEL + 1);
+            s32LastAEBitrateLevel = (MAX_LEVEL + 1);
+            s32LastH265FaceCfgBitrateLevel = (MAX_LEVEL + 1);
+            s32LastH265FaceCfgExpLevel = (MAX_LEVEL + 1);
+            u32Lastu32sharpenIso = 0;
+            u8LastDciStrength = 0;
+            b3dnrValid = HI_FALSE;
+            if (s32LastGammaExpLevel >= g_stINIPara.stIniGamma.s32ExpCount)
+            {
+                s32LastGammaExpLevel = g_stINIPara.stIniGamma.s32ExpCount - 1;
+            }
+            if (0 != (u32ReloadMask & SCENEAUTO_SECTION_GAMMA))
+            {
+                s32Ret = SceneAuto_SetGamma(s32IspDev, s32LastGammaExpLevel, s32LastGammaExpLevel);
+                if (HI_SUCCESS != s32Ret)
+                {
+                    printf("SceneAuto_SetGamma failed\n");
+                }
+            }
+        }
+
+        /* attributes the application changes rarely are re-read every few cycles only */
+        if ((0 == (u32Cycle % SCENEAUTO_ATTR_REFRESH_CYCLE)) || (HI_TRUE == bSceneChanged))
+        {
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetRgbirParam(s32IspDev, &stAdptRgbirParam));
+            if (HI_SUCCESS != s32Ret)
+            {
+                printf("CommSceneautoGetRgbirParam failed\n");
+            }
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDRCAttr(s32IspDev, &stAdptDrcAttr));
+            if (HI_SUCCESS != s32Ret)
+            {
+                printf("CommSceneautoGetDRCAttr failed\n");
+            }
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetWDRAttr(s32IspDev, &stAdptWdrAttr));
+            if (HI_SUCCESS != s32Ret)
+            {
+                printf("CommSceneautoGetWDRAttr failed\n");
+            }
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr));
+            if (HI_SUCCESS != s32Ret)
+            {
+                printf("HI_SceneAuto_GetBitrate failed\n");
+            }
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDefogAttr(s32IspDev, &stAdptDefogAttr));
+            if (HI_SUCCESS != s32Ret)
+            {
+                printf("CommSceneautoGetDefogAttr failed\n");
+            }
+        }
+        u32Cycle++;
+
+        //get the exposure value
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo));
+        if (HI_SUCCESS != s32Ret)
+        {
+            printf("CommSceneautoGetExposureInfo failed\n");
+        }
+        if (stAdptRgbirParam.bEnable)
+        {
+            u64Temp = ((HI_U64)stAdptExposureInfo.u32AGain * (HI_U64)stAdptExposureInfo.u32DGain * (HI_U64)stAdptExposureInfo.u32ISPDGain) >> 30;
+            u64Temp = (u64Temp * (HI_U64)stAdptExposureInfo.u16RgbirGain * (HI_U64)stAdptExposureInfo.u16RgbirGain) >> 16;
+        }
+        else
+        {
+            u64Temp = ((HI_U64)stAdptExposureInfo.u32AGain * (HI_U64)stAdptExposureInfo.u32DGain * (HI_U64)stAdptExposureInfo.u32ISPDGain) >> 30;                        
+        }
+        u32Exposure = (HI_U32)u64Temp * stAdptExposureInfo.u32ExpTime;
+
+        //exposure value if different in WDR
+        if (stAdptWdrAttr.u8WdrMode != 0)
+        {
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetQueryInnerStateInfo(s32IspDev, &stAdptStatInfo));
+            if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetQueryInnerStateInfo failed\n");
             }
@@ -5980,8 +6580,8 @@ void *SceneAuto_NormalThread(void *pVoid)
         {
             if (stAdptDrcAttr.bEnable == HI_TRUE)
             {
-                s32Ret = CommSceneautoGetQueryInnerStateInfo(s32IspDev, &stAdptStatInfo);
-                if (HI_SUCCESS)
+                s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetQueryInnerStateInfo(s32IspDev, &stAdptStatInfo));
+                if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoGetQueryInnerStateInfo failed\n");
                 }
@@ -5994,10 +6594,18 @@ void *SceneAuto_NormalThread(void *pVoid)
                 u32Exposure = (u32Exposure * stAdptStatInfo.u32DRCStrengthActual) / g_stINIPara.stThreshValue.u32DRCStrengthThresh;
             }
 
-            u32Iso = 100 * (u32Exposure / stAdptExposureInfo.u32ExpTime);
+            u32Iso = 100 * (u32Exposure / DIV_0_TO_1(stAdptExposureInfo.u32ExpTime));
 
         }
 
+        /* small AE wobble inside the band is not an exposure change event */
+        if ((HI_FALSE == bSceneChanged) && (u32LastExposure != (MAX_LEVEL + 1))
+            && (HI_TRUE == Sceneauto_InExpHysteresis(u32Exposure, u32LastExposure)))
+        {
+            u32Exposure = u32LastExposure;
+            u32Iso = u32LastIso;
+        }
+
         u32GammaExposure = u32Exposure;
         
         if (u32GammaExposure != u32LastGammaExposure)
@@ -6052,102 +6660,49 @@ void *SceneAuto_NormalThread(void *pVoid)
             }
         }
         
-        if ((u32Exposure != u32LastExposure) ||
-            (eSpecialScene != g_eSpecialScene))
+        if ((u32Exposure != u32LastExposure) || (HI_TRUE == bSceneChanged))
         {
             //setting 3DNR param
                         if (SRDK_SCENEAUTO_SPECIAL_SCENE_HLC == g_eSpecialScene)
                         {
-                            s32IsoLevel = g_stINIPara.stHLC.s323DnrIsoCount - 1;
-                            for (i = 0; i < g_stINIPara.stHLC.s323DnrIsoCount; i++)
-                            {
-                                if (u32Iso <= g_stINIPara.stHLC.pu323DnrIsoThresh[i])
-                                {
-                                    s32IsoLevel = i;
-                                    break;
-                                }
-                            }
-
-                            s32IsoLevel1 = s32IsoLevel - 1;
-                            
-                            if (s32IsoLevel1 < 0)
-                            {
-                                s32IsoLevel1 = 0;
-                            }
-            
-                            Interpolate(&stSceneauto3dnr, u32Iso, 
-                                    &g_stINIPara.stHLC.pst3dnrParam[s32IsoLevel1], g_stINIPara.stHLC.pu323DnrIsoThresh[s32IsoLevel1],
-                                    &g_stINIPara.stHLC.pst3dnrParam[s32IsoLevel], g_stINIPara.stHLC.pu323DnrIsoThresh[s32IsoLevel]);
-                            
+                            Sceneauto_Get3dnr(&g_stHLC3dnrLut, u32Iso, &stSceneauto3dnr);
                         }
                         else if (SRDK_SCENEAUTO_SPECIAL_SCENE_IR == g_eSpecialScene)
                         {
-                            s32IsoLevel = g_stINIPara.stIR.s323DnrIsoCount - 1;
-                            for (i = 0; i < g_stINIPara.stIR.s323DnrIsoCount; i++)
-                            {
-                                if (u32Iso <= g_stINIPara.stIR.pu323DnrIsoThresh[i])
-                                {
-                                    s32IsoLevel = i;
-                                    break;
-                                }
-                            }
-
-                            s32IsoLevel1 = s32IsoLevel - 1;
-                            
-                            if (s32IsoLevel1 < 0)
-                            {
-                                s32IsoLevel1 = 0;
-                            }
-            
-                            Interpolate(&stSceneauto3dnr, u32Iso, 
-                                    &g_stINIPara.stIR.pst3dnrParam[s32IsoLevel1], g_stINIPara.stIR.pu323DnrIsoThresh[s32IsoLevel1],
-                                    &g_stINIPara.stIR.pst3dnrParam[s32IsoLevel], g_stINIPara.stIR.pu323DnrIsoThresh[s32IsoLevel]);  
+                            Sceneauto_Get3dnr(&g_stIR3dnrLut, u32Iso, &stSceneauto3dnr);
                         }
                         else
                         {
-                            s32IsoLevel = g_stINIPara.stIni3dnr.s323DnrIsoCount - 1;
-                            for (i = 0; i < g_stINIPara.stIni3dnr.s323DnrIsoCount; i++)
-                            {
-                                if (u32Iso <= g_stINIPara.stIni3dnr.pu323DnrIsoThresh[i])
-                                {
-                                    s32IsoLevel = i;
-                                    break;
-                                }
-                            }
-
-                            s32IsoLevel1 = s32IsoLevel - 1;
-                            
-                            if (s32IsoLevel1 < 0)
-                            {
-                                s32IsoLevel1 = 0;
-                            }
-            
-                            Interpolate(&stSceneauto3dnr, u32Iso, 
-                                    &g_stINIPara.stIni3dnr.pst3dnrParam[s32IsoLevel1], g_stINIPara.stIni3dnr.pu323DnrIsoThresh[s32IsoLevel1],
-                                    &g_stINIPara.stIni3dnr.pst3dnrParam[s32IsoLevel], g_stINIPara.stIni3dnr.pu323DnrIsoThresh[s32IsoLevel]);
-                            
+                            Sceneauto_Get3dnr(&g_st3dnrLut, u32Iso, &stSceneauto3dnr);
                         }
                                                 
-                        s32Ret = Sceneauto_Set3DNR(s32VpssGrp, stSceneauto3dnr);
-                        if (HI_SUCCESS != s32Ret)
+                        /* neighbouring ISO values often interpolate to the same strengths */
+                        if ((HI_FALSE == b3dnrValid)
+                            || (0 != memcmp(&stSceneauto3dnr, &stLastSceneauto3dnr, sizeof(stSceneauto3dnr))))
                         {
-                            printf("Sceneauto_SetNormal3DNR failed\n");
+                            s32Ret = Sceneauto_Set3DNR(s32VpssGrp, stSceneauto3dnr);
+                            if (HI_SUCCESS != s32Ret)
+                            {
+                                printf("Sceneauto_SetNormal3DNR failed\n");
+                            }
+                            stLastSceneauto3dnr = stSceneauto3dnr;
+                            b3dnrValid = (HI_SUCCESS == s32Ret) ? HI_TRUE : HI_FALSE;
                         }
         }
 
             //setting sharpen param
 			if (SRDK_SCENEAUTO_SPECIAL_SCENE_IR != g_eSpecialScene && SRDK_SCENEAUTO_SPECIAL_SCENE_HLC != g_eSpecialScene)
             {
-                 s32Ret = CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen);
-                 if (HI_SUCCESS != s32Ret)
-                 {
-                     printf("CommSceneautoGetSharpen failed\n");
-                     return HI_FALSE;
-                 }
 		         if (u32Iso != u32Lastu32sharpenIso)
                  { 
                      if(u32Iso < g_stINIPara.stIniSharpen.s32IsoThresh)
                      {
+                         s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetSharpen(s32IspDev, &stAdptSharpen));
+                         if (HI_SUCCESS != s32Ret)
+                         {
+                             printf("CommSceneautoGetSharpen failed\n");
+                             return HI_FALSE;
+                         }
                          for(i=0; i<EXPOSURE_LEVEL; i++)
 	                     {
 			                 stAdptSharpen.abEnLowLumaShoot[i] = InterpolationCalculate(stAdptExposureInfo.u32ExpTime,g_stINIPara.stIniSharpen.pu32ExpThresh[0],
@@ -6172,7 +6727,7 @@ void *SceneAuto_NormalThread(void *pVoid)
              	                g_stINIPara.stIniSharpen.pstSharpen[0].u8EdgeNoiseThd[i],g_stINIPara.stIniSharpen.pu32ExpThresh[1],
              	                g_stINIPara.stIniSharpen.pstSharpen[1].u8EdgeNoiseThd[i]);
                          }
-			             s32Ret = CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen);
+			             s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetSharpen(s32IspDev, &stAdptSharpen));
                          if (HI_SUCCESS != s32Ret)
                          {
                              printf("CommSceneautoSetSharpen failed\n");
@@ -6217,10 +6772,15 @@ void *SceneAuto_NormalThread(void *pVoid)
                         }
                     }
                 }
-                s32Ret = Scenauto_SetIRAERealtedExp(s32IspDev, s32IRAECurPos);
-                if (HI_SUCCESS != s32Ret)
+                if ((s32IRAECurPos != s32LastIRAECurPos) || (HI_TRUE == bSceneChanged))
                 {
-                    printf("Scenauto_SetAERealtedExp failed\n");
+                    s32Ret = Scenauto_SetIRAERealtedExp(s32IspDev, s32IRAECurPos);
+                    if (HI_SUCCESS != s32Ret)
+                    {
+                        printf("Scenauto_SetAERealtedExp failed\n");
+                    }
+                    s32LastIRAECurPos = s32IRAECurPos;
+                    s32LastAECurPos = -1;
                 }
             }
             else
@@ -6258,28 +6818,23 @@ void *SceneAuto_NormalThread(void *pVoid)
                         }
                     }
                 }
-                s32Ret = Scenauto_SetAERealtedExp(s32IspDev, s32AECurPos);
-                if (HI_SUCCESS != s32Ret)
+                if ((s32AECurPos != s32LastAECurPos) || (HI_TRUE == bSceneChanged))
                 {
-                    printf("Scenauto_SetAERealtedExp failed\n");
+                    s32Ret = Scenauto_SetAERealtedExp(s32IspDev, s32AECurPos);
+                    if (HI_SUCCESS != s32Ret)
+                    {
+                        printf("Scenauto_SetAERealtedExp failed\n");
+                    }
+                    s32LastAECurPos = s32AECurPos;
+                    s32LastIRAECurPos = -1;
                 }
             }
 
-        //get the bitrate value
-        s32Ret = CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr);
-        if (HI_SUCCESS != s32Ret)
-        {
-            printf("HI_SceneAuto_GetBitrate failed\n");
-        }
+        //the bitrate value is refreshed with the other attributes above
         u32Bitrate = stAdptVencAttr.u32BitRate;
 
         if (u32Bitrate != u32LastBitrate)
         {
-            s32Ret = CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr);
-            if (HI_SUCCESS != s32Ret)
-            {
-                printf("HI_SceneAuto_GetBitrate failed\n");
-            }
             switch (stAdptVencAttr.eRcMode)
             {
                 case ADPT_SCENEAUTO_RCMODE_H264:
@@ -6371,11 +6926,6 @@ void *SceneAuto_NormalThread(void *pVoid)
 		
 	    if ((u32Bitrate != u32LastBitrate) || (u32Exposure != u32LastExposure))
 	    {
-            s32Ret = CommSceneautoGetVencAttr(s32VencChn, &stAdptVencAttr);
-            if (HI_SUCCESS != s32Ret)
-            {
-                printf("HI_SceneAuto_GetBitrate failed\n");
-            }
             if (ADPT_SCENEAUTO_RCMODE_H265 == stAdptVencAttr.eRcMode)
             {
         		for (s32H265FaceCfgBitrateLevel = 0; s32H265FaceCfgBitrateLevel < g_stINIPara.stIniH265Venc.stIniH265VencFaceCfg.s32BitrateCount; s32H265FaceCfgBitrateLevel++)
@@ -6415,18 +6965,15 @@ void *SceneAuto_NormalThread(void *pVoid)
 	    }
 
         u32LastExposure = u32Exposure;
+        u32LastIso = u32Iso;
         u32LastBitrate = u32Bitrate;
+        eSpecialScene = g_eSpecialScene;
    	    usleep(1000000);
 
         //DCI param when defog is on
-        s32Ret = CommSceneautoGetDefogAttr(s32IspDev, &stAdptDefogAttr);
-        if (HI_SUCCESS != s32Ret)
-        {
-            printf("CommSceneautoGetDefogAttr failed\n");
-        }
         if (stAdptDefogAttr.bEnable == HI_TRUE)
         {
-            s32Ret = CommSceneautoGetQueryInnerStateInfo(s32IspDev, &stAdptStatInfo);
+            s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetQueryInnerStateInfo(s32IspDev, &stAdptStatInfo));
             if (HI_SUCCESS != s32Ret)
             {
                 printf("CommSceneautoGetQueryInnerStateInfo failed\n");
@@ -6441,34 +6988,38 @@ void *SceneAuto_NormalThread(void *pVoid)
                 u8DciStrength = g_stINIPara.au8DciStrengthLut[stAdptStatInfo.u32DefogStrengthActual - 129];
             } 
 
-            s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDciParam);
-            if (HI_SUCCESS != s32Ret)
-            {
-                printf("CommSceneautoGetDCIParam failed\n");
-            }
             if (HI_FALSE == bDefogState)
             {
+                s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDciParam));
+                if (HI_SUCCESS != s32Ret)
+                {
+                    printf("CommSceneautoGetDCIParam failed\n");
+                }
                 bDciEnable = stAdptDciParam.bEnable;
                 u32BlackGain = stAdptDciParam.u32BlackGain;
                 u32ContrastGain = stAdptDciParam.u32ContrastGain;
                 u32LightGain = stAdptDciParam.u32LightGain;
-                bDefogState = HI_TRUE;
             }
-            stAdptDciParam.bEnable = HI_TRUE;
-            stAdptDciParam.u32BlackGain = u8DciStrength;
-            stAdptDciParam.u32ContrastGain = u8DciStrength;
-            stAdptDciParam.u32LightGain = u8DciStrength; 
-            s32Ret = CommSceneautoSetDCIParam(s32ViDev, &stAdptDciParam);
-            if (HI_SUCCESS != s32Ret)
+            if ((HI_FALSE == bDefogState) || (u8DciStrength != u8LastDciStrength))
             {
-                printf("CommSceneautoSetDCIParam failed\n");
+                stAdptDciParam.bEnable = HI_TRUE;
+                stAdptDciParam.u32BlackGain = u8DciStrength;
+                stAdptDciParam.u32ContrastGain = u8DciStrength;
+                stAdptDciParam.u32LightGain = u8DciStrength;
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDCIParam(s32ViDev, &stAdptDciParam));
+                if (HI_SUCCESS != s32Ret)
+                {
+                    printf("CommSceneautoSetDCIParam failed\n");
+                }
+                u8LastDciStrength = u8DciStrength;
+                bDefogState = HI_TRUE;
             }            
         }  
         else
         {
             if (HI_TRUE == bDefogState)
             {
-                s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDciParam);
+                s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDciParam));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoGetDCIParam failed\n");
@@ -6477,7 +7028,7 @@ void *SceneAuto_NormalThread(void *pVoid)
                 stAdptDciParam.u32BlackGain = u32BlackGain;
                 stAdptDciParam.u32ContrastGain = u32ContrastGain;
                 stAdptDciParam.u32LightGain = u32LightGain; 
-                s32Ret = CommSceneautoSetDCIParam(s32ViDev, &stAdptDciParam);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDCIParam(s32ViDev, &stAdptDciParam));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetDCIParam failed\n");
@@ -6485,6 +7036,13 @@ void *SceneAuto_NormalThread(void *pVoid)
                 bDefogState = HI_FALSE;
             }            
         }  
+
+        g_stSceneautoStat.u32Cycles++;
+        if (u64SetCalls == g_stSceneautoStat.u64MpiSetCalls)
+        {
+            g_stSceneautoStat.u32IdleCycles++;
+        }
+        Sceneauto_UpdateMpiRate();
     }
     return NULL;
 }
@@ -6507,12 +7065,13 @@ void *SceneAuto_SpecialThread(void *pVoid)
     HI_U8 u8HLCCount = 0;
     ADPT_SCENEAUTO_EXPOSUREINFO_S stAdptExposureInfo;
     ADPT_SCENEAUTO_DIS_ATTR_S stAdptDisAttr;
+    SCENEAUTO_INIPARAM_THRESHVALUE_S stThresh;
     stAdptDisAttr.bEnable = HI_TRUE;
     prctl(PR_SET_NAME, (unsigned long)"SceneautoSpecialThread", 0,0,0);
     
     s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
 
-    s32Ret = CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetExposureInfo failed\n");
@@ -6525,7 +7084,19 @@ void *SceneAuto_SpecialThread(void *pVoid)
 
     while (g_bSpecialThreadFlag == HI_TRUE)
     {
-        s32Ret = CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo);
+        /* an ini reload swaps g_stINIPara under the lock, work on one consistent copy per cycle */
+        pthread_mutex_lock(&g_stSceneautoLock);
+        memcpy(&stThresh, &g_stINIPara.stThreshValue, sizeof(stThresh));
+        pthread_mutex_unlock(&g_stSceneautoLock);
+
+        /* HLC auto and DIS are the only consumers of the fast exposure probe */
+        if ((HI_TRUE != stThresh.bHLCAutoEnable) && (HI_TRUE != g_stPreviousPara.stDis.bEnable))
+        {
+            usleep(SCENEAUTO_SPECIAL_IDLE_SLEEP);
+            continue;
+        }
+
+        s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo));
         if (HI_SUCCESS != s32Ret)
         {
             printf("CommSceneautoGetExposureInfo failed\n");
@@ -6541,7 +7112,7 @@ void *SceneAuto_SpecialThread(void *pVoid)
         }
 
         //HLC start
-        if (HI_TRUE == g_stINIPara.stThreshValue.bHLCAutoEnable)
+        if (HI_TRUE == stThresh.bHLCAutoEnable)
         {
             pthread_mutex_lock(&g_stSceneautoLock);
             if (g_eSpecialScene == SRDK_SCENEAUTO_SPECIAL_SCENE_NONE)
@@ -6555,26 +7126,21 @@ void *SceneAuto_SpecialThread(void *pVoid)
                     u32HLCDeltaExp = u32LastExposure - u32Exposure;
                 }
 
-                s32Ret = CommSceneautoGetExposureInfo(s32IspDev, &stAdptExposureInfo);
-                if (HI_SUCCESS != s32Ret)
-                {
-                    printf("CommSceneautoGetExposureInfo failed\n");
-                }
                 u32HistSum = stAdptExposureInfo.u32Hist256Value[0]
                              + stAdptExposureInfo.u32Hist256Value[1]
                              + stAdptExposureInfo.u32Hist256Value[2]
                              + stAdptExposureInfo.u32Hist256Value[3];
                 
                 
-                if ((u32HLCDeltaExp < g_stINIPara.stThreshValue.u32HLCTolerance) 
-                    && (u32Exposure < g_stINIPara.stThreshValue.u32HLCExpThresh))
+                if ((u32HLCDeltaExp < stThresh.u32HLCTolerance) 
+                    && (u32Exposure < stThresh.u32HLCExpThresh))
                 {
                     if (HI_FALSE == bHLCState)
                     {
-                        if (u32HistSum > g_stINIPara.stThreshValue.u32HLCOnThresh)
+                        if (u32HistSum > stThresh.u32HLCOnThresh)
                         {
                             u8HLCCount++;
-                            if (u8HLCCount > g_stINIPara.stThreshValue.u32HLCCount)
+                            if (u8HLCCount > stThresh.u32HLCCount)
                             {
                                 s32Ret = SceneAuto_HLCAutoOn();
                                 if (HI_SUCCESS != s32Ret)
@@ -6594,10 +7160,10 @@ void *SceneAuto_SpecialThread(void *pVoid)
                     }
                     else
                     {
-                        if (u32HistSum < g_stINIPara.stThreshValue.u32HLCOffThresh)
+                        if (u32HistSum < stThresh.u32HLCOffThresh)
                         {
                             u8HLCCount++;
-                            if (u8HLCCount > g_stINIPara.stThreshValue.u32HLCCount)
+                            if (u8HLCCount > stThresh.u32HLCCount)
                             {
                                 s32Ret = SceneAuto_HLCAutoOff();
                                 if (HI_SUCCESS != s32Ret)
@@ -6617,7 +7183,7 @@ void *SceneAuto_SpecialThread(void *pVoid)
                 }
                 else
                 {
-                    if ((HI_TRUE == bHLCState) && (u32HistSum < g_stINIPara.stThreshValue.u32HLCOffThresh))
+                    if ((HI_TRUE == bHLCState) && (u32HistSum < stThresh.u32HLCOffThresh))
                     {
                         s32Ret = SceneAuto_HLCAutoOff();
                         if (HI_SUCCESS != s32Ret)
@@ -6657,14 +7223,14 @@ void *SceneAuto_SpecialThread(void *pVoid)
             {
 
 
-                if ((u32DeltaExposure > g_stINIPara.stThreshValue.u32DeltaDisExpThreash) || (u8DelataAveLum > g_stINIPara.stThreshValue.u32AveLumThresh))
+                if ((u32DeltaExposure > stThresh.u32DeltaDisExpThreash) || (u8DelataAveLum > stThresh.u32AveLumThresh))
                 {
 
                     if (stAdptDisAttr.bEnable == HI_TRUE)
                     {
                         printf("\n\n----------------DIS DISABLE--------------------\n\n");
                         stAdptDisAttr.bEnable = HI_FALSE;
-                        s32Ret = CommSceneautoSetDISAttr(s32IspDev, &stAdptDisAttr);
+                        s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDISAttr(s32IspDev, &stAdptDisAttr));
                         if (HI_SUCCESS != s32Ret)
                         {
                             printf("CommSceneautoSetDISAttr failed\n");
@@ -6682,7 +7248,7 @@ void *SceneAuto_SpecialThread(void *pVoid)
                         {
                             printf("\n\n----------------DIS ENABLE--------------------\n\n");
                             stAdptDisAttr.bEnable = HI_TRUE;
-                            s32Ret = CommSceneautoSetDISAttr(s32IspDev, &stAdptDisAttr);
+                            s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDISAttr(s32IspDev, &stAdptDisAttr));
                             if (HI_SUCCESS != s32Ret)
                             {
                                 printf("CommSceneautoSetDISAttr failed\n");
@@ -6695,10 +7261,10 @@ void *SceneAuto_SpecialThread(void *pVoid)
             }
 
 #if 0
-            if (u32Exposure > g_stINIPara.stThreshValue.u32FpnExpThresh)
+            if (u32Exposure > stThresh.u32FpnExpThresh)
             {
                 stAdptFpnAttr.bEnable = HI_FALSE;
-                s32Ret = CommSceneautoSetFPNAttr(s32IspDev, &stAdptFpnAttr);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetFPNAttr(s32IspDev, &stAdptFpnAttr));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetFPNAttr failed\n");
@@ -6707,7 +7273,7 @@ void *SceneAuto_SpecialThread(void *pVoid)
             else
             {
                 stAdptFpnAttr.bEnable = HI_TRUE;
-                s32Ret = CommSceneautoSetFPNAttr(s32IspDev, &stAdptFpnAttr);
+                s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetFPNAttr(s32IspDev, &stAdptFpnAttr));
                 if (HI_SUCCESS != s32Ret)
                 {
                     printf("CommSceneautoSetFPNAttr failed\n");
@@ -6725,6 +7291,100 @@ void *SceneAuto_SpecialThread(void *pVoid)
     return NULL;
 }
 
+/*
+ * Watches the directory of the ini rather than the file itself, editors save
+ * by writing a new file and renaming it over the old one.
+ */
+void *SceneAuto_ReloadThread(void *pVoid)
+{
+    HI_S32 s32Fd;
+    HI_S32 s32Wd;
+    HI_S32 s32Len;
+    HI_S32 s32Off;
+    HI_CHAR szDir[SCENEAUTO_FILE_NAME_LEN];
+    const HI_CHAR *pszName;
+    HI_CHAR *pszSlash;
+    HI_U64 u64EventTime = 0;
+    HI_U64 u64LastEvent = 0;
+    struct pollfd stPollFd;
+    struct inotify_event *pstEvent;
+    HI_CHAR acEventBuf[SCENEAUTO_RELOAD_EVENT_BUF] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    prctl(PR_SET_NAME, (unsigned long)"SceneautoReloadThread", 0,0,0);
+
+    snprintf(szDir, sizeof(szDir), "%s", g_szSceneautoIniFile);
+    pszSlash = strrchr(szDir, '/');
+    if (NULL == pszSlash)
+    {
+        snprintf(szDir, sizeof(szDir), ".");
+        pszName = g_szSceneautoIniFile;
+    }
+    else
+    {
+        *pszSlash = '\0';
+        if (pszSlash == szDir)
+        {
+            snprintf(szDir, sizeof(szDir), "/");
+        }
+        pszName = strrchr(g_szSceneautoIniFile, '/') + 1;
+    }
+
+    s32Fd = inotify_init();
+    if (s32Fd < 0)
+    {
+        printf("sceneauto reload: inotify_init failed, ini edits need restart\n");
+        return NULL;
+    }
+    s32Wd = inotify_add_watch(s32Fd, szDir, IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (s32Wd < 0)
+    {
+        printf("sceneauto reload: watch %s failed, ini edits need restart\n", szDir);
+        close(s32Fd);
+        return NULL;
+    }
+    g_stSceneautoReloadStatus.bWatching = HI_TRUE;
+
+    stPollFd.fd = s32Fd;
+    stPollFd.events = POLLIN;
+    while (g_bReloadThreadFlag == HI_TRUE)
+    {
+        stPollFd.revents = 0;
+        if ((poll(&stPollFd, 1, (0 == u64EventTime) ? SCENEAUTO_RELOAD_POLL_TIME : SCENEAUTO_RELOAD_SETTLE_TIME) > 0)
+            && (0 != (stPollFd.revents & POLLIN)))
+        {
+            s32Len = read(s32Fd, acEventBuf, sizeof(acEventBuf));
+            for (s32Off = 0; s32Off + (HI_S32)sizeof(struct inotify_event) <= s32Len;
+                 s32Off += sizeof(struct inotify_event) + pstEvent->len)
+            {
+                pstEvent = (struct inotify_event *)(acEventBuf + s32Off);
+                if ((0 != pstEvent->len) && (0 == strcmp(pstEvent->name, pszName)))
+                {
+                    u64LastEvent = Sceneauto_GetTimeUs();
+                    if (0 == u64EventTime)
+                    {
+                        u64EventTime = u64LastEvent;
+                    }
+                }
+            }
+        }
+
+        /* parse once the writer has been quiet for a while, one save may be several writes */
+        if ((0 != u64EventTime) && (Sceneauto_GetTimeUs() - u64LastEvent >= SCENEAUTO_RELOAD_SETTLE_TIME * 1000))
+        {
+            if (HI_SUCCESS == Sceneauto_PrepareReload(u64EventTime))
+            {
+                u64EventTime = 0;
+            }
+        }
+    }
+
+    g_stSceneautoReloadStatus.bWatching = HI_FALSE;
+    (void)inotify_rm_watch(s32Fd, s32Wd);
+    close(s32Fd);
+
+    return NULL;
+}
+
 HI_S32 HI_SRDK_SCENEAUTO_GetSpecialMode(SRDK_SCENEAUTO_SEPCIAL_SCENE_E* peSpecialScene)
 {
     pthread_mutex_lock(&g_stSceneautoLock);
@@ -6733,6 +7393,28 @@ HI_S32 HI_SRDK_SCENEAUTO_GetSpecialMode(SRDK_SCENEAUTO_SEPCIAL_SCENE_E* peSpecia
     return HI_SUCCESS;
 }
 
+HI_S32 HI_SRDK_SCENEAUTO_GetStat(SRDK_SCENEAUTO_STAT_S* pstStat)
+{
+    CHECK_SCENEAUTO_INIT();
+    CHECK_NULL_PTR(pstStat);
+
+    pthread_mutex_lock(&g_stSceneautoLock);
+    memcpy(pstStat, &g_stSceneautoStat, sizeof(SRDK_SCENEAUTO_STAT_S));
+    pthread_mutex_unlock(&g_stSceneautoLock);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_SRDK_SCENEAUTO_GetReloadStatus(SRDK_SCENEAUTO_RELOAD_STATUS_S* pstStatus)
+{
+    CHECK_SCENEAUTO_INIT();
+    CHECK_NULL_PTR(pstStatus);
+
+    pthread_mutex_lock(&g_stSceneautoLock);
+    memcpy(pstStatus, &g_stSceneautoReloadStatus, sizeof(SRDK_SCENEAUTO_RELOAD_STATUS_S));
+    pthread_mutex_unlock(&g_stSceneautoLock);
+    return HI_SUCCESS;
+}
+
 HI_S32 HI_SRDK_SCENEAUTO_SetSpecialMode(const SRDK_SCENEAUTO_SEPCIAL_SCENE_E* peSpecialScene)
 {
     HI_S32 s32Ret = HI_SUCCESS;
@@ -6860,8 +7542,10 @@ HI_S32 HI_SRDK_SCENEAUTO_Stop()
     g_bNormalThreadFlag = HI_FALSE;
 
     g_bSpecialThreadFlag = HI_FALSE;
+    g_bReloadThreadFlag = HI_FALSE;
     (void)pthread_join(g_pthSceneAutoNormal, NULL);
     (void)pthread_join(g_pthSceneAutoSpecial, NULL);
+    (void)pthread_join(g_pthSceneAutoReload, NULL);
 
     if (HI_TRUE == g_stINIPara.stThreshValue.bIVEEnable)
     {
@@ -6911,13 +7595,13 @@ HI_S32 HI_SRDK_SCENEAUTO_Start()
 	s32IspDev = g_stINIPara.stMpInfo.s32IspDev;
 	s32ViDev = g_stINIPara.stMpInfo.s32ViDev;
     
-    s32Ret = CommSceneautoGetWDRAttr(s32IspDev, &stAdptWdrAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetWDRAttr(s32IspDev, &stAdptWdrAttr));
     if (HI_SUCCESS)
     {
         printf("CommSceneautoGetWDRAttr failed\n");
     }
     
-	s32Ret = CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIParam);
+	s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetDCIParam(s32ViDev, &stAdptDCIParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetDCIParam failed\n");
@@ -6935,7 +7619,7 @@ HI_S32 HI_SRDK_SCENEAUTO_Start()
     stAdptDCIParam.u32BlackGain = 32;
     stAdptDCIParam.u32ContrastGain = 32;
     stAdptDCIParam.u32LightGain = 32;
-    s32Ret = CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIParam);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetDCIParam(s32ViDev, &stAdptDCIParam));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetDCIParam failed\n");
@@ -6968,7 +7652,7 @@ HI_S32 HI_SRDK_SCENEAUTO_Start()
         return HI_FAILURE;
     }
 
-    s32Ret = CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_GET(CommSceneautoGetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoGetAEAttr failed\n");
@@ -6976,7 +7660,7 @@ HI_S32 HI_SRDK_SCENEAUTO_Start()
         return HI_FAILURE;
     }
     stAdptAEAttr.u8AERunInterval = g_stINIPara.stIniAE.u8AERunInterval;
-    s32Ret = CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr);
+    s32Ret = SCENEAUTO_MPI_SET(CommSceneautoSetAEAttr(s32IspDev, &stAdptAEAttr));
     if (HI_SUCCESS != s32Ret)
     {
         printf("CommSceneautoSetAEAttr failed\n");
@@ -7004,6 +7688,15 @@ HI_S32 HI_SRDK_SCENEAUTO_Start()
         return HI_FAILURE;
     }
 
+    g_bReloadThreadFlag = HI_TRUE;
+    s32Ret = pthread_create(&g_pthSceneAutoReload, NULL, SceneAuto_ReloadThread, NULL);
+    if (HI_SUCCESS != s32Ret)
+    {
+        printf("pthread_create SceneAuto_ReloadThread failed \n");
+        pthread_mutex_unlock(&g_stSceneautoLock);
+        return HI_FAILURE;
+    }
+
     if (HI_TRUE == g_stINIPara.stThreshValue.bIVEEnable)
     {
         s32Ret = Sceneauto_IVEStart();
@@ -7044,6 +7737,12 @@ HI_S32 HI_SRDK_SCENEAUTO_DeInit()
         g_bSpecialThreadFlag = HI_FALSE;
         (void)pthread_join(g_pthSceneAutoSpecial, NULL);
     }
+    if (HI_TRUE == g_bReloadThreadFlag)
+    {
+        g_bReloadThreadFlag = HI_FALSE;
+        (void)pthread_join(g_pthSceneAutoReload, NULL);
+    }
+    Sceneauto_FreeShadow();
     Sceneauto_FreeDict();
     Sceneauto_FreeMem();
     g_bSceneautoInit = HI_FALSE;
@@ -7054,38 +7753,118 @@ HI_S32 HI_SRDK_SCENEAUTO_DeInit()
 	return HI_SUCCESS;
 }
 
-HI_S32 HI_SRDK_SCENEAUTO_Init(const HI_CHAR *pszFileName)
+HI_S32 HI_SRDK_SCENEAUTO_CompileBin(const HI_CHAR *pszIniFile, const HI_CHAR *pszBinFile)
 {
     HI_S32 s32Ret = HI_SUCCESS;
+    HI_U64 u64IniTime;
+    HI_U64 u64BinTime;
+    SCENEAUTO_INIPARA_S stBinPara;
 
-    CHECK_NULL_PTR(pszFileName);
+    CHECK_NULL_PTR(pszIniFile);
+    CHECK_NULL_PTR(pszBinFile);
 
     pthread_mutex_lock(&g_stSceneautoLock);
     if (HI_TRUE == g_bSceneautoInit)
     {
-        printf("SRDK SCENEAUTO Module has been inited already\n");
+        printf("SRDK SCENEAUTO Module is inited, deinit it before compiling\n");
         pthread_mutex_unlock(&g_stSceneautoLock);
-        return HI_SUCCESS;
+        return HI_FAILURE;
     }
 
-    s32Ret = Sceneauto_LoadFile(pszFileName);
+    u64IniTime = Sceneauto_GetTimeUs();
+    s32Ret = Sceneauto_LoadFile(pszIniFile);
+    if (HI_SUCCESS == s32Ret)
+    {
+        s32Ret = Sceneauto_LoadINIPara();
+    }
+    u64IniTime = Sceneauto_GetTimeUs() - u64IniTime;
+    Sceneauto_FreeDict();
     if (HI_SUCCESS != s32Ret)
     {
-        printf("Sceneauto_LoadFile failed\n");
-        Sceneauto_FreeDict();
+        printf("Sceneauto_LoadINIPara failed\n");
+        Sceneauto_FreeMem();
         pthread_mutex_unlock(&g_stSceneautoLock);
         return HI_FAILURE;
     }
 
-    s32Ret = Sceneauto_LoadINIPara();
-    if (HI_SUCCESS != s32Ret)
+    s32Ret = Sceneauto_SaveBinPara(&g_stINIPara, pszIniFile, pszBinFile);
+    if (HI_SUCCESS == s32Ret)
     {
-        printf("Sceneauto_LoadCommonPara failed\n");
-        Sceneauto_FreeDict();
-        Sceneauto_FreeMem();
+        /* read the blob back and check it reproduces what the ini parser built */
+        memset(&stBinPara, 0, sizeof(stBinPara));
+        u64BinTime = Sceneauto_GetTimeUs();
+        s32Ret = Sceneauto_MapBinPara(&stBinPara, pszIniFile, pszBinFile);
+        u64BinTime = Sceneauto_GetTimeUs() - u64BinTime;
+        if (HI_SUCCESS == s32Ret)
+        {
+            s32Ret = Sceneauto_CompareBinPara(&g_stINIPara, &stBinPara);
+            Sceneauto_UnmapBinPara(&stBinPara);
+        }
+        if (HI_SUCCESS == s32Ret)
+        {
+            printf("%s -> %s: ini load %llu us, bin load %llu us\n", pszIniFile, pszBinFile, u64IniTime, u64BinTime);
+        }
+        else
+        {
+            printf("verify %s failed\n", pszBinFile);
+            (HI_VOID)unlink(pszBinFile);
+        }
+    }
+
+    Sceneauto_FreeMem();
+    pthread_mutex_unlock(&g_stSceneautoLock);
+
+    return s32Ret;
+}
+
+HI_S32 HI_SRDK_SCENEAUTO_Init(const HI_CHAR *pszFileName)
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U64 u64LoadTime;
+    HI_CHAR szBinFile[256];
+
+    CHECK_NULL_PTR(pszFileName);
+
+    pthread_mutex_lock(&g_stSceneautoLock);
+    if (HI_TRUE == g_bSceneautoInit)
+    {
+        printf("SRDK SCENEAUTO Module has been inited already\n");
         pthread_mutex_unlock(&g_stSceneautoLock);
-        return HI_FAILURE;
+        return HI_SUCCESS;
+    }
+
+    u64LoadTime = Sceneauto_GetTimeUs();
+    snprintf(szBinFile, sizeof(szBinFile), "%s%s", pszFileName, SCENEAUTO_BINPARA_SUFFIX);
+    s32Ret = Sceneauto_MapBinPara(&g_stINIPara, pszFileName, szBinFile);
+    if (HI_SUCCESS == s32Ret)
+    {
+        printf("sceneauto para mapped from %s in %llu us\n", szBinFile, Sceneauto_GetTimeUs() - u64LoadTime);
+    }
+    else
+    {
+        s32Ret = Sceneauto_LoadFile(pszFileName);
+        if (HI_SUCCESS != s32Ret)
+        {
+            printf("Sceneauto_LoadFile failed\n");
+            Sceneauto_FreeDict();
+            pthread_mutex_unlock(&g_stSceneautoLock);
+            return HI_FAILURE;
+        }
+
+        s32Ret = Sceneauto_LoadINIPara();
+        if (HI_SUCCESS != s32Ret)
+        {
+            printf("Sceneauto_LoadCommonPara failed\n");
+            Sceneauto_FreeDict();
+            Sceneauto_FreeMem();
+            pthread_mutex_unlock(&g_stSceneautoLock);
+            return HI_FAILURE;
+        }
+        printf("sceneauto para parsed from %s in %llu us\n", pszFileName, Sceneauto_GetTimeUs() - u64LoadTime);
     }
+    Sceneauto_BuildLut();
+    snprintf(g_szSceneautoIniFile, sizeof(g_szSceneautoIniFile), "%s", pszFileName);
+    memset(&g_stSceneautoReloadStatus, 0, sizeof(g_stSceneautoReloadStatus));
 
     g_bSceneautoInit = HI_TRUE;
     g_eSpecialScene = SRDK_SCENEAUTO_SPECIAL_SCENE_NONE;
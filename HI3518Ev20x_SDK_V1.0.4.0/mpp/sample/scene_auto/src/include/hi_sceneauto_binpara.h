@@ -0,0 +1,73 @@
+/******************************************************************************
+
+  Copyright (C), 2013-2023, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : hi_sceneauto_binpara.h
+  Version       : Initial Draft
+  Author        : Hisilicon BVR REF
+  Created       : 2016/03/02
+  Description   : compiled (binary) form of the sceneauto ini parameters
+  History       :
+  1.Date        : 2016/03/02
+  Author        :
+  Modification: Created file
+
+******************************************************************************/
+
+#ifndef __HI_SCENEAUTO_BINPARA_H__
+#define __HI_SCENEAUTO_BINPARA_H__
+
+#include "hi_type.h"
+#include "hi_sceneauto_define.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* __cplusplus */
+
+/* the blob sits next to the ini file: sceneauto_xxx.ini -> sceneauto_xxx.ini.bin */
+#define SCENEAUTO_BINPARA_SUFFIX    ".bin"
+#define SCENEAUTO_BINPARA_MAGIC     0x50415348  /* "HSAP" */
+#define SCENEAUTO_BINPARA_VERSION   1
+#define SCENEAUTO_BINPARA_ALIGN     8
+
+/*
+ * File layout:
+ *   SCENEAUTO_BINPARA_HEAD_S
+ *   SCENEAUTO_INIPARA_S image, every array pointer replaced by its file offset
+ *   the arrays themselves, each aligned to SCENEAUTO_BINPARA_ALIGN
+ * The checksum covers everything after the head. The struct image is only
+ * valid for the ABI that produced it, so the blob has to be compiled by a
+ * binary built with the same toolchain as the loader (see sceneauto_bin).
+ */
+typedef struct hiSCENEAUTO_BINPARA_HEAD_S
+{
+    HI_U32 u32Magic;
+    HI_U32 u32Version;
+    HI_U32 u32HeadSize;
+    HI_U32 u32ParaSize;     /* sizeof(SCENEAUTO_INIPARA_S) */
+    HI_U32 u32PtrSize;      /* sizeof(HI_VOID *) */
+    HI_U32 u32ArrayNum;     /* number of relocated arrays */
+    HI_U32 u32DataSize;     /* bytes following the head */
+    HI_U32 u32Checksum;
+    HI_U32 u32IniSize;      /* size and mtime of the source ini, staleness check */
+    HI_U32 u32IniMtime;
+}SCENEAUTO_BINPARA_HEAD_S;
+
+HI_S32 Sceneauto_SaveBinPara(const SCENEAUTO_INIPARA_S *pstPara, const HI_CHAR *pszIniFile, const HI_CHAR *pszBinFile);
+HI_S32 Sceneauto_MapBinPara(SCENEAUTO_INIPARA_S *pstPara, const HI_CHAR *pszIniFile, const HI_CHAR *pszBinFile);
+HI_BOOL Sceneauto_IsBinParaMapped(const SCENEAUTO_INIPARA_S *pstPara);
+HI_VOID Sceneauto_UnmapBinPara(SCENEAUTO_INIPARA_S *pstPara);
+HI_VOID Sceneauto_FreeParaArrays(SCENEAUTO_INIPARA_S *pstPara, HI_U32 u32Offset, HI_U32 u32Size);
+HI_S32 Sceneauto_CompareBinPara(const SCENEAUTO_INIPARA_S *pstPara1, const SCENEAUTO_INIPARA_S *pstPara2);
+HI_U64 Sceneauto_GetTimeUs(HI_VOID);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
+
+#endif /* __HI_SCENEAUTO_BINPARA_H__ */
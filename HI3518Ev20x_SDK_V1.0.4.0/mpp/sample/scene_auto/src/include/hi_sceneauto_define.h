@@ -471,6 +471,7 @@ typedef struct hiSCENEAUTO_INIPARAM_THRESHVALUE_S
     HI_U32 u32DeltaDisExpThreash;
     HI_U32 u32FpnExpThresh;
     HI_U32 u32DRCStrengthThresh;
+    HI_U32 u32ExpHysteresis;
 }SCENEAUTO_INIPARAM_THRESHVALUE_S;
 
 typedef struct hiSCENEAUTO_INIPARA_S
@@ -0,0 +1,67 @@
+/******************************************************************************
+
+  Copyright (C), 2013-2023, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : hi_sceneauto_lut.h
+  Version       : Initial Draft
+  Author        : Hisilicon BVR REF
+  Created       : 2016/03/09
+  Description   : ISO indexed lookup tables of the interpolated scene parameters
+  History       :
+  1.Date        : 2016/03/09
+  Author        :
+  Modification: Created file
+
+******************************************************************************/
+
+#ifndef __HI_SCENEAUTO_LUT_H__
+#define __HI_SCENEAUTO_LUT_H__
+
+#include "hi_type.h"
+#include "hi_sceneauto_define.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* __cplusplus */
+
+/*
+ * Sceneauto_IsoIndex() is the log ISO scale Interpolate() works on: six steps
+ * per octave above ISO 100, -3..0 for ISO 0..3 and 74 from ISO 364545 on.
+ */
+#define SCENEAUTO_ISO_INDEX_MIN     (-3)
+#define SCENEAUTO_ISO_INDEX_MAX     74
+#define SCENEAUTO_ISO_INDEX_NUM     (SCENEAUTO_ISO_INDEX_MAX - SCENEAUTO_ISO_INDEX_MIN + 1)
+/* above this the ISO no longer fits the int MapISO works on, use the slow path */
+#define SCENEAUTO_ISO_LUT_MAX       0x7FFFFFFF
+
+typedef struct hiSCENEAUTO_3DNR_LUT_S
+{
+    HI_BOOL bValid;
+    /* source table, used by the slow path when the lut can not be built */
+    HI_S32 s32IsoCount;
+    const HI_U32 *pu32IsoThresh;
+    const SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrParam;
+    SCENEAUTO_INIPARAM_3DNRCFG_S ast3dnr[SCENEAUTO_ISO_INDEX_NUM];
+}SCENEAUTO_3DNR_LUT_S;
+
+HI_VOID Interpolate(SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrcfg, HI_U32 u32Mid,
+                                const SCENEAUTO_INIPARAM_3DNRCFG_S *pstL3dnrcfg, HI_U32 u32Left,
+                                const SCENEAUTO_INIPARAM_3DNRCFG_S *pstR3dnrcfg, HI_U32 u32Right);
+
+HI_S32 Sceneauto_IsoIndex(HI_U32 u32Iso);
+HI_VOID Sceneauto_Calc3dnr(HI_S32 s32IsoCount, const HI_U32 *pu32IsoThresh, const SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrParam,
+                           HI_U32 u32Iso, SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnr);
+HI_S32 Sceneauto_Build3dnrLut(SCENEAUTO_3DNR_LUT_S *pstLut, HI_S32 s32IsoCount, const HI_U32 *pu32IsoThresh,
+                              const SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnrParam);
+HI_VOID Sceneauto_Get3dnr(const SCENEAUTO_3DNR_LUT_S *pstLut, HI_U32 u32Iso, SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnr);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* __cplusplus */
+
+#endif /* __HI_SCENEAUTO_LUT_H__ */
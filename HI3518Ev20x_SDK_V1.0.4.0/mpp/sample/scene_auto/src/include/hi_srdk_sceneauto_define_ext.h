@@ -29,6 +29,27 @@ typedef enum hiSRDK_SCENEAUTO_SEPCIAL_SCENE_E
     SRDK_SCENEAUTO_SPECIAL_SCENE_BUTT
 } SRDK_SCENEAUTO_SEPCIAL_SCENE_E;
 
+typedef struct hiSRDK_SCENEAUTO_STAT_S
+{
+    HI_U32 u32Cycles;           /* normal thread cycles since start */
+    HI_U32 u32IdleCycles;       /* cycles that applied nothing */
+    HI_U32 u32MpiCallsPerSec;   /* adapt layer calls over the last second */
+    HI_U64 u64MpiGetCalls;
+    HI_U64 u64MpiSetCalls;
+} SRDK_SCENEAUTO_STAT_S;
+
+#define SRDK_SCENEAUTO_SECTION_LIST_LEN     128
+
+typedef struct hiSRDK_SCENEAUTO_RELOAD_STATUS_S
+{
+    HI_BOOL bWatching;          /* the ini is watched for edits while sceneauto runs */
+    HI_U32 u32ReloadCount;      /* edited parameter sets swapped in since init */
+    HI_U32 u32FailCount;        /* edits that failed to parse, the running set was kept */
+    HI_U32 u32ParseTime;        /* last reload, ini written to shadow set parsed, in us */
+    HI_U32 u32ReloadTime;       /* last reload, ini written to shadow set in use, in us */
+    HI_CHAR szChangedSection[SRDK_SCENEAUTO_SECTION_LIST_LEN];  /* last reload, e.g. "ae 3dnr" */
+} SRDK_SCENEAUTO_RELOAD_STATUS_S;
+
 #ifdef __cplusplus
 #if __cplusplus
  extern "C"{
@@ -35,6 +35,20 @@ extern "C" {
 ******************************************************************************/
 HI_S32 HI_SRDK_SCENEAUTO_Init(const HI_CHAR* pszFileName);
 
+/*****************************************************************************
+\brief SCENEAUTO compile ini to binary parameter file
+\attention \n
+Init maps pszFileName.bin directly when it is newer than the ini, and parses
+the ini otherwise. Must be called before init or after deinit.
+\param[in]	const HI_CHAR *pszIniFile
+\param[in]	const HI_CHAR *pszBinFile
+\retval ::HI_SUCCESS
+\retval ::HI_FAILURE
+\see \n
+:: \n
+******************************************************************************/
+HI_S32 HI_SRDK_SCENEAUTO_CompileBin(const HI_CHAR* pszIniFile, const HI_CHAR* pszBinFile);
+
 /*****************************************************************************
 \brief SCENEAUTO deinit
 \attention \n
@@ -85,6 +99,29 @@ HI_S32 HI_SRDK_SCENEAUTO_SetSpecialMode(const SRDK_SCENEAUTO_SEPCIAL_SCENE_E* pe
 ******************************************************************************/
 HI_S32 HI_SRDK_SCENEAUTO_GetSpecialMode(SRDK_SCENEAUTO_SEPCIAL_SCENE_E* peSpecialScene);
 
+/*****************************************************************************
+\brief SCENEAUTO  get statistics
+\attention \n
+Counts adapt layer (MPI) calls issued by the scene threads since start.
+\retval ::HI_SUCCESS
+\retval ::HI_FAILURE
+\see \n
+:: \n
+******************************************************************************/
+HI_S32 HI_SRDK_SCENEAUTO_GetStat(SRDK_SCENEAUTO_STAT_S* pstStat);
+
+/*****************************************************************************
+\brief SCENEAUTO  get hot reload status
+\attention \n
+While sceneauto runs, edits of the ini given to init are parsed into a shadow
+set and swapped in by the scene thread at its next cycle, no stop/start needed.
+\retval ::HI_SUCCESS
+\retval ::HI_FAILURE
+\see \n
+:: \n
+******************************************************************************/
+HI_S32 HI_SRDK_SCENEAUTO_GetReloadStatus(SRDK_SCENEAUTO_RELOAD_STATUS_S* pstStatus);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
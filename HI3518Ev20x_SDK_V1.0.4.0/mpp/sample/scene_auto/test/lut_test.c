@@ -0,0 +1,300 @@
+/******************************************************************************
+
+  Copyright (C), 2013-2023, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : lut_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon BVR REF
+  Created       : 2016/03/09
+  Description   : host check and timing of the iso indexed 3DNR parameter tables
+  History       :
+  1.Date        : 2016/03/09
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "hi_type.h"
+#include "hi_sceneauto_comm.h"
+#include "hi_sceneauto_define.h"
+#include "hi_sceneauto_lut.h"
+
+#define MAX_ISO_COUNT       16
+#define SWEEP_ISO_MAX       2000000
+#define RANDOM_ISO_NUM      1000000
+#define RANDOM_TABLE_NUM    40
+#define BENCH_LOOP          20000000
+
+static int s_s32Fail = 0;
+static unsigned int s_u32Seed = 20160309;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+    printf(__VA_ARGS__); printf("\n"); s_s32Fail++; } } while (0)
+
+static double now_us(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+static unsigned int rand32(void)
+{
+    s_u32Seed = s_u32Seed * 1103515245 + 12345;
+    return (s_u32Seed >> 16) | ((s_u32Seed & 0xFFFF) << 16);
+}
+
+/* the search + interpolate block SceneAuto_NormalThread ran for every exposure change */
+static void legacy_3dnr(HI_S32 s32Count, const HI_U32 *pu32Thresh, const SCENEAUTO_INIPARAM_3DNRCFG_S *pstParam,
+                        HI_U32 u32Iso, SCENEAUTO_INIPARAM_3DNRCFG_S *pst3dnr)
+{
+    HI_S32 i, s32IsoLevel, s32IsoLevel1;
+
+    s32IsoLevel = s32Count - 1;
+    for (i = 0; i < s32Count; i++)
+    {
+        if (u32Iso <= pu32Thresh[i])
+        {
+            s32IsoLevel = i;
+            break;
+        }
+    }
+
+    s32IsoLevel1 = s32IsoLevel - 1;
+    if (s32IsoLevel1 < 0)
+    {
+        s32IsoLevel1 = 0;
+    }
+
+    Interpolate(pst3dnr, u32Iso,
+            &pstParam[s32IsoLevel1], pu32Thresh[s32IsoLevel1],
+            &pstParam[s32IsoLevel], pu32Thresh[s32IsoLevel]);
+}
+
+static void random_param(SCENEAUTO_INIPARAM_3DNRCFG_S *pstParam, HI_S32 s32Count)
+{
+    HI_S32 i, j;
+    HI_S32 *ps32;
+
+    for (i = 0; i < s32Count; i++)
+    {
+        ps32 = (HI_S32 *)&pstParam[i];
+        for (j = 0; j < (HI_S32)(sizeof(pstParam[i]) / sizeof(HI_S32)); j++)
+        {
+            ps32[j] = rand32() % 256;
+        }
+    }
+}
+
+static int check_iso(const SCENEAUTO_3DNR_LUT_S *pstLut, HI_S32 s32Count, const HI_U32 *pu32Thresh,
+                     const SCENEAUTO_INIPARAM_3DNRCFG_S *pstParam, HI_U32 u32Iso)
+{
+    SCENEAUTO_INIPARAM_3DNRCFG_S stRef, stLut;
+
+    memset(&stRef, 0, sizeof(stRef));
+    memset(&stLut, 0, sizeof(stLut));
+    legacy_3dnr(s32Count, pu32Thresh, pstParam, u32Iso, &stRef);
+    Sceneauto_Get3dnr(pstLut, u32Iso, &stLut);
+
+    return memcmp(&stRef, &stLut, sizeof(stRef));
+}
+
+/* every iso up to SWEEP_ISO_MAX, random ones up to 0xFFFFFFFF */
+static void check_table(const char *pszName, HI_S32 s32Count, const HI_U32 *pu32Thresh,
+                        const SCENEAUTO_INIPARAM_3DNRCFG_S *pstParam, HI_BOOL bExpectValid)
+{
+    SCENEAUTO_3DNR_LUT_S stLut;
+    HI_U32 u32Iso;
+    HI_S32 i;
+    int s32Mismatch = 0;
+
+    (void)Sceneauto_Build3dnrLut(&stLut, s32Count, pu32Thresh, pstParam);
+    CHECK(stLut.bValid == bExpectValid, "%s: lut valid %d, expect %d", pszName, stLut.bValid, bExpectValid);
+
+    for (u32Iso = 0; u32Iso <= SWEEP_ISO_MAX; u32Iso++)
+    {
+        if (check_iso(&stLut, s32Count, pu32Thresh, pstParam, u32Iso) && (s32Mismatch++ < 4))
+        {
+            CHECK(0, "%s: iso %u differs", pszName, u32Iso);
+        }
+    }
+    for (i = 0; i < RANDOM_ISO_NUM; i++)
+    {
+        u32Iso = rand32();
+        if (check_iso(&stLut, s32Count, pu32Thresh, pstParam, u32Iso) && (s32Mismatch++ < 4))
+        {
+            CHECK(0, "%s: iso %u differs", pszName, u32Iso);
+        }
+    }
+    for (u32Iso = 0xFFFFFFFF; u32Iso >= 0xFFFFFF00; u32Iso--)
+    {
+        if (check_iso(&stLut, s32Count, pu32Thresh, pstParam, u32Iso) && (s32Mismatch++ < 4))
+        {
+            CHECK(0, "%s: iso %u differs", pszName, u32Iso);
+        }
+    }
+}
+
+static void test_iso_index(void)
+{
+    HI_U32 u32Iso;
+    HI_S32 s32Last = Sceneauto_IsoIndex(4);
+    HI_S32 s32Index;
+
+    for (u32Iso = 0; u32Iso <= 3; u32Iso++)
+    {
+        CHECK(Sceneauto_IsoIndex(u32Iso) == -(HI_S32)u32Iso, "iso %u index %d", u32Iso, Sceneauto_IsoIndex(u32Iso));
+    }
+
+    /* step 1 up to 2^24, so the binary search in the lut build is exact */
+    for (u32Iso = 5; u32Iso < (1 << 24); u32Iso++)
+    {
+        s32Index = Sceneauto_IsoIndex(u32Iso);
+        if ((s32Index < s32Last) || (s32Index > s32Last + 1))
+        {
+            CHECK(0, "iso %u index %d after %d", u32Iso, s32Index, s32Last);
+            break;
+        }
+        s32Last = s32Index;
+    }
+    for (; u32Iso <= SCENEAUTO_ISO_LUT_MAX; u32Iso += 997)
+    {
+        s32Index = Sceneauto_IsoIndex(u32Iso);
+        CHECK(s32Index == SCENEAUTO_ISO_INDEX_MAX, "iso %u index %d", u32Iso, s32Index);
+        if (s32Index != SCENEAUTO_ISO_INDEX_MAX)
+        {
+            break;
+        }
+    }
+    CHECK(s32Last == SCENEAUTO_ISO_INDEX_MAX, "last index %d", s32Last);
+}
+
+static void test_3dnr(void)
+{
+    static const HI_U32 au32Ar0230[] = {50, 100, 400, 1500, 3000, 7000, 14000, 28000, 78000, 180000};
+    static const HI_U32 au32Ar0230Ir[] = {50, 100, 400, 1500, 3600, 7000};
+    /* 101 and 105 map to the same iso index */
+    static const HI_U32 au32Shared[] = {50, 101, 105, 400};
+    static const HI_U32 au32Small[] = {2, 100, 400};
+    SCENEAUTO_INIPARAM_3DNRCFG_S astParam[MAX_ISO_COUNT];
+    HI_U32 au32Thresh[MAX_ISO_COUNT];
+    HI_BOOL abUsed[SCENEAUTO_ISO_INDEX_MAX + 1];
+    HI_U32 au32IndexIso[SCENEAUTO_ISO_INDEX_MAX + 2];
+    HI_U32 u32Iso;
+    HI_S32 s32Count, s32Index, i, j;
+    char szName[32];
+
+    random_param(astParam, MAX_ISO_COUNT);
+    check_table("ar0230", 10, au32Ar0230, astParam, HI_TRUE);
+    check_table("ar0230 ir", 6, au32Ar0230Ir, astParam, HI_TRUE);
+    check_table("shared index", 4, au32Shared, astParam, HI_FALSE);
+    check_table("small thresh", 3, au32Small, astParam, HI_FALSE);
+
+    /* first iso of every index, the last index is open ended */
+    memset(au32IndexIso, 0, sizeof(au32IndexIso));
+    for (u32Iso = 4; u32Iso <= SWEEP_ISO_MAX; u32Iso++)
+    {
+        s32Index = Sceneauto_IsoIndex(u32Iso);
+        if ((s32Index > 0) && (0 == au32IndexIso[s32Index]))
+        {
+            au32IndexIso[s32Index] = u32Iso;
+        }
+    }
+    au32IndexIso[0] = 4;
+    au32IndexIso[SCENEAUTO_ISO_INDEX_MAX + 1] = SWEEP_ISO_MAX;
+
+    /* random ascending tables with one threshold per iso index */
+    for (i = 0; i < RANDOM_TABLE_NUM; i++)
+    {
+        s32Count = 1 + rand32() % MAX_ISO_COUNT;
+        memset(abUsed, 0, sizeof(abUsed));
+        for (j = 0; j < s32Count; j++)
+        {
+            do
+            {
+                s32Index = rand32() % (SCENEAUTO_ISO_INDEX_MAX + 1);
+            } while (abUsed[s32Index]);
+            abUsed[s32Index] = HI_TRUE;
+        }
+        for (s32Index = 0, j = 0; s32Index <= SCENEAUTO_ISO_INDEX_MAX; s32Index++)
+        {
+            if (abUsed[s32Index])
+            {
+                /* any iso of that index, ini files pick round numbers anywhere in it */
+                au32Thresh[j++] = au32IndexIso[s32Index] + rand32() % (au32IndexIso[s32Index + 1] - au32IndexIso[s32Index]);
+            }
+        }
+        random_param(astParam, s32Count);
+        snprintf(szName, sizeof(szName), "random %d", i);
+        check_table(szName, s32Count, au32Thresh, astParam, HI_TRUE);
+    }
+}
+
+static void bench(void)
+{
+    static const HI_U32 au32Ar0230[] = {50, 100, 400, 1500, 3000, 7000, 14000, 28000, 78000, 180000};
+    SCENEAUTO_INIPARAM_3DNRCFG_S astParam[10];
+    SCENEAUTO_INIPARAM_3DNRCFG_S st3dnr;
+    SCENEAUTO_3DNR_LUT_S stLut;
+    HI_U32 *pu32Iso;
+    volatile HI_U32 u32Sum = 0;
+    double dStart, dLegacy, dLut;
+    HI_S32 i;
+
+    random_param(astParam, 10);
+    Sceneauto_Build3dnrLut(&stLut, 10, au32Ar0230, astParam);
+
+    pu32Iso = malloc(4096 * sizeof(HI_U32));
+    if (NULL == pu32Iso)
+    {
+        return;
+    }
+    for (i = 0; i < 4096; i++)
+    {
+        pu32Iso[i] = 100 + rand32() % 300000;
+    }
+
+    dStart = now_us();
+    for (i = 0; i < BENCH_LOOP; i++)
+    {
+        legacy_3dnr(10, au32Ar0230, astParam, pu32Iso[i & 4095], &st3dnr);
+        u32Sum += st3dnr.s32YSFStr;
+    }
+    dLegacy = now_us() - dStart;
+
+    dStart = now_us();
+    for (i = 0; i < BENCH_LOOP; i++)
+    {
+        Sceneauto_Get3dnr(&stLut, pu32Iso[i & 4095], &st3dnr);
+        u32Sum += st3dnr.s32YSFStr;
+    }
+    dLut = now_us() - dStart;
+
+    printf("3dnr: search + interpolate %.1f ns, lut %.1f ns\n",
+           dLegacy * 1000 / BENCH_LOOP, dLut * 1000 / BENCH_LOOP);
+
+    free(pu32Iso);
+}
+
+int main(int argc, char *argv[])
+{
+    test_iso_index();
+    test_3dnr();
+
+    if (0 != s_s32Fail)
+    {
+        printf("%d check(s) failed\n", s_s32Fail);
+        return 1;
+    }
+    printf("all checks passed\n");
+
+    bench();
+
+    return 0;
+}
@@ -215,6 +215,72 @@ typedef struct hiVdecThreadParam
     HI_BOOL bLoopSend;
 }VdecThreadParam;
 
+/* this sdk has no payload type for h265, the stream source takes the one later sdks give PT_H265 */
+#define SAMPLE_PT_H265              ((PAYLOAD_TYPE_E)265)
+
+/* an access unit of an elementary stream file, also the record of its .idx sidecar */
+typedef struct sample_vdec_frame_s
+{
+    HI_U32 u32Offset;                   /* at the start code of its first nal, zero_byte included,
+                                           the sample of an mp4, the packet a ts pes starts in */
+    HI_U32 u32Len;                      /* for a ts the bytes of the pes payload */
+    HI_U64 u64PTS;                      /* from the encoder, an index rebuilt from the stream counts in steps */
+    HI_U32 u32Type;                     /* nal type of the first slice, vop_coding_type for mpeg4, 0 in an mp4 */
+    HI_BOOL bKey;                       /* idr / irap picture or mpeg4 I-vop, parameter sets in front included */
+}SAMPLE_VDEC_FRAME_S;
+
+/* what SAMPLE_COMM_VDEC_SourceOpen finds in a file */
+typedef enum sample_vdec_container_e
+{
+    SAMPLE_VDEC_CONTAINER_ES = 0,       /* elementary stream */
+    SAMPLE_VDEC_CONTAINER_MP4,          /* iso base media file, plain or fragmented */
+    SAMPLE_VDEC_CONTAINER_TS,           /* mpeg-2 transport stream, 188 byte packets or 192 of m2ts */
+}SAMPLE_VDEC_CONTAINER_E;
+
+/* trick play speeds of SAMPLE_COMM_VDEC_SourceSetSpeed, above 1 only key frames are sent */
+#define SAMPLE_VDEC_SPEED_MAX       8
+
+/* threads of SAMPLE_COMM_VDEC_FeederStart, each serves every n-th channel */
+#define SAMPLE_VDEC_FEEDER_MAX_THREAD   8
+
+typedef struct sample_vdec_feeder_stat_s
+{
+    HI_U64 u64Frames;
+    HI_U64 u64Bytes;
+    HI_U32 u32Underflow;                /* frames sent more than a frame time after they were due */
+    HI_U32 u32Overflow;                 /* sends put off as the decoder had no room for the frame */
+    HI_U32 u32MaxLateUs;
+    HI_BOOL bEnd;                       /* end of stream sent */
+}SAMPLE_VDEC_FEEDER_STAT_S;
+
+/* SAMPLE_COMM_VDEC_BenchStart keeps this much of a stream file in memory at most */
+#define SAMPLE_VDEC_BENCH_MAX_BYTES     (64 * 1024 * 1024)
+
+/* what a channel of SAMPLE_COMM_VDEC_BenchStart sent and got since it started */
+typedef struct sample_vdec_bench_stat_s
+{
+    HI_U64 u64Sends;
+    HI_U64 u64Bytes;
+    HI_U64 u64Retries;                  /* sends the decoder had no room for */
+    HI_U64 u64Pictures;                 /* got from the channel and released */
+    HI_U64 u64Pixels;
+}SAMPLE_VDEC_BENCH_STAT_S;
+
+/* SAMPLE_COMM_VDEC_BenchReport, over the time since the report before */
+typedef struct sample_vdec_bench_report_s
+{
+    HI_U32 u32IntervalMs;
+    HI_FLOAT afFps[VDEC_MAX_CHN_NUM];   /* decoded pictures a second, by channel id */
+    HI_FLOAT fFps;                      /* of all channels */
+    HI_FLOAT fMPixels;                  /* million decoded pixels a second */
+    HI_FLOAT fMbps;                     /* stream sent */
+    HI_FLOAT fCpuLoad;                  /* percent of the time of all cpus they were busy */
+    HI_FLOAT fProcessLoad;              /* percent of one cpu this process used */
+    HI_U32 u32RssKB;                    /* of this process, the streams in memory included */
+    HI_U32 u32MemFreeKB;
+    HI_U32 u32MmzUsedKB;                /* 0 without /proc/media-mem */
+}SAMPLE_VDEC_BENCH_REPORT_S;
+
 
 
 /*******************************************************
@@ -238,6 +304,34 @@ HI_VOID SAMPLE_COMM_VDEC_CmdCtrl(HI_S32 s32ChnNum,VdecThreadParam *pstVdecSend);
 HI_VOID SAMPLE_COMM_VDEC_StartSendStream(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend, pthread_t *pVdecThread);
 HI_VOID SAMPLE_COMM_VDEC_StopSendStream(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend, pthread_t *pVdecThread);
 HI_VOID* SAMPLE_COMM_VDEC_SendStream(HI_VOID *pArgs);
+HI_U32 SAMPLE_COMM_VDEC_FindStartCode(const HI_U8 *pu8Data, HI_U32 u32Len);
+HI_S32 SAMPLE_COMM_VDEC_BuildIndex(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Data, HI_U32 u32Len,
+                                   SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Frames);
+HI_S32 SAMPLE_COMM_VDEC_IndexCreate(const HI_CHAR *pszStream, PAYLOAD_TYPE_E enType, FILE **ppFile);
+HI_S32 SAMPLE_COMM_VDEC_IndexAppend(FILE *pFile, const SAMPLE_VDEC_FRAME_S *pstFrame);
+HI_S32 SAMPLE_COMM_VDEC_SourceOpen(VDEC_CHN VdChn, const HI_CHAR *pszFile, PAYLOAD_TYPE_E enType, HI_U64 u64PtsStep);
+HI_S32 SAMPLE_COMM_VDEC_SourceGetIndex(VDEC_CHN VdChn, const SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Frames);
+HI_S32 SAMPLE_COMM_VDEC_SourceGetFrame(VDEC_CHN VdChn, HI_U32 u32Frame, VDEC_STREAM_S *pstStream);
+HI_S32 SAMPLE_COMM_VDEC_SourceFindKey(VDEC_CHN VdChn, HI_U32 u32Frame, HI_U32 *pu32Key);
+HI_S32 SAMPLE_COMM_VDEC_SourceSeek(VDEC_CHN VdChn, HI_U64 u64Pts, HI_U32 *pu32Frame);
+HI_S32 SAMPLE_COMM_VDEC_SourceSetSpeed(VDEC_CHN VdChn, HI_U32 u32Speed);
+HI_S32 SAMPLE_COMM_VDEC_SourceClose(VDEC_CHN VdChn);
+HI_VOID* SAMPLE_COMM_VDEC_SendStreamMmap(HI_VOID *pArgs);
+SAMPLE_VDEC_CONTAINER_E SAMPLE_COMM_VDEC_DemuxProbe(const HI_U8 *pu8Data, HI_U32 u32Len);
+HI_S32 SAMPLE_COMM_VDEC_DemuxOpen(VDEC_CHN VdChn, HI_U8 *pu8Map, HI_U32 u32Size, HI_U64 u64PtsStep,
+                                  PAYLOAD_TYPE_E *penType, SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Frames);
+HI_S32 SAMPLE_COMM_VDEC_DemuxGetFrame(VDEC_CHN VdChn, HI_U32 u32Frame, VDEC_STREAM_S *pstStream);
+HI_VOID SAMPLE_COMM_VDEC_DemuxClose(VDEC_CHN VdChn);
+HI_S32 SAMPLE_COMM_VDEC_FeederStart(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend, HI_S32 s32Threads);
+HI_S32 SAMPLE_COMM_VDEC_FeederPause(VDEC_CHN VdChn, HI_BOOL bPause);
+HI_S32 SAMPLE_COMM_VDEC_FeederStep(VDEC_CHN VdChn);
+HI_S32 SAMPLE_COMM_VDEC_FeederSetSpeed(VDEC_CHN VdChn, HI_U32 u32Percent);
+HI_S32 SAMPLE_COMM_VDEC_FeederGetStat(VDEC_CHN VdChn, SAMPLE_VDEC_FEEDER_STAT_S *pstStat);
+HI_VOID SAMPLE_COMM_VDEC_FeederStop(HI_VOID);
+HI_S32 SAMPLE_COMM_VDEC_BenchStart(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend);
+HI_S32 SAMPLE_COMM_VDEC_BenchGetStat(VDEC_CHN VdChn, SAMPLE_VDEC_BENCH_STAT_S *pstStat);
+HI_S32 SAMPLE_COMM_VDEC_BenchReport(SAMPLE_VDEC_BENCH_REPORT_S *pstReport);
+HI_VOID SAMPLE_COMM_VDEC_BenchStop(HI_VOID);
 HI_VOID SAMPLE_COMM_VDEC_StartGetLuma(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend, pthread_t *pVdecThread);
 HI_VOID SAMPLE_COMM_VDEC_StopGetLuma(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend, pthread_t *pVdecThread);
 HI_VOID* SAMPLE_COMM_VDEC_GetChnLuma(HI_VOID *pArgs);
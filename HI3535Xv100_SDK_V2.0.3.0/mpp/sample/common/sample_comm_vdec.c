@@ -541,13 +541,21 @@ HI_VOID * SAMPLE_COMM_VDEC_GetChnLuma(HI_VOID *pArgs)
 
 
 
+/* streams SAMPLE_COMM_VDEC_SourceOpen indexes, sent by SAMPLE_COMM_VDEC_SendStreamMmap */
+static HI_BOOL SAMPLE_COMM_VDEC_Indexed(PAYLOAD_TYPE_E enType)
+{
+    return ((PT_H264 == enType) || (SAMPLE_PT_H265 == enType) || (PT_MP4VIDEO == enType)) ? HI_TRUE : HI_FALSE;
+}
+
 HI_VOID SAMPLE_COMM_VDEC_CmdCtrl(HI_S32 s32ChnNum,VdecThreadParam *pstVdecSend)
 {
 	HI_S32 i;
     VDEC_CHN_STAT_S stStat;
 	char c=0;
+    HI_U32 u32Speed = 1;
 
     printf("\nSAMPLE_TEST:press 'e' to exit; 'p' to pause; 'r' to resume; 'q' to query!\n"); 
+    printf("SAMPLE_TEST:h264/h265/mpeg4: 'f' for 2x/4x/8x/1x (frame mode); 's' to play from the start!\n"); 
 
     while(1)    
     {
@@ -573,6 +581,19 @@ HI_VOID SAMPLE_COMM_VDEC_CmdCtrl(HI_S32 s32ChnNum,VdecThreadParam *pstVdecSend)
                 PRINTF_VDEC_CHN_STATE(pstVdecSend[i].s32ChnId, stStat);
             }
         }
+        else if (c == 'f')
+        {
+            u32Speed = (u32Speed >= SAMPLE_VDEC_SPEED_MAX) ? 1 : u32Speed * 2;
+            for (i=0; i<s32ChnNum; i++)
+                if (HI_TRUE == SAMPLE_COMM_VDEC_Indexed(pstVdecSend[i].enType))
+                    SAMPLE_COMM_VDEC_SourceSetSpeed(pstVdecSend[i].s32ChnId, u32Speed);
+        }
+        else if (c == 's')
+        {
+            for (i=0; i<s32ChnNum; i++)
+                if (HI_TRUE == SAMPLE_COMM_VDEC_Indexed(pstVdecSend[i].enType))
+                    SAMPLE_COMM_VDEC_SourceSeek(pstVdecSend[i].s32ChnId, 0, HI_NULL);
+        }
     }
 }
 
@@ -581,9 +602,13 @@ HI_VOID SAMPLE_COMM_VDEC_StartSendStream(HI_S32 s32ChnNum, VdecThreadParam *pstV
 {
 	HI_S32  i;
 	
+	/* indexed streams seek and play fast from the mapping, jpeg is read as before */
 	for(i=0; i<s32ChnNum; i++)
 	{
-	    pthread_create(&pVdecThread[i], 0, SAMPLE_COMM_VDEC_SendStream, (HI_VOID *)&pstVdecSend[i]);
+	    pthread_create(&pVdecThread[i], 0,
+	                   (HI_TRUE == SAMPLE_COMM_VDEC_Indexed(pstVdecSend[i].enType)) ? SAMPLE_COMM_VDEC_SendStreamMmap
+	                                                                                 : SAMPLE_COMM_VDEC_SendStream,
+	                   (HI_VOID *)&pstVdecSend[i]);
 	}
 }
 
@@ -0,0 +1,538 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: vdec bench, channels fed from memory as fast as they decode.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-6 Created
+******************************************************************************/
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "sample_comm.h"
+
+/*
+ * To measure what the decoder sustains, nothing else may hold it back: every
+ * stream file is read once through SAMPLE_COMM_VDEC_SourceOpen (so an mp4 or
+ * ts works as well) into one buffer of the frames as they are sent, locked in
+ * memory where the system allows, and shared by the channels that play it.
+ * Every channel has a thread sending it without pacing, looping the stream,
+ * and one taking its pictures with HI_MPI_VDEC_GetImage and releasing them at
+ * once, so it never waits for a display. The channels must not be bound.
+ *
+ * In frame mode a send is a frame, in stream mode s32MinBufSize bytes of the
+ * buffer that do not keep to frames, as SAMPLE_COMM_VDEC_SendStream reads them.
+ */
+#define SAMPLE_VDEC_BENCH_SEND_MS       100
+#define SAMPLE_VDEC_BENCH_GET_MS        100
+#define SAMPLE_VDEC_BENCH_RETRY_US      1000
+#define SAMPLE_VDEC_BENCH_CHUNK         (64 * 1024)
+
+/* a stream file in memory */
+typedef struct sample_vdec_bench_image_s
+{
+    HI_CHAR cFileName[100];
+    PAYLOAD_TYPE_E enType;
+    HI_U8 *pu8Data;
+    HI_U32 u32Len;
+    HI_U32 u32Size;
+    HI_U32 *pu32Offset;                 /* where frame i starts, u32Frames + 1 entries */
+    HI_U32 u32Frames;
+    HI_BOOL bLocked;
+}SAMPLE_VDEC_BENCH_IMAGE_S;
+
+typedef struct sample_vdec_bench_chn_s
+{
+    HI_BOOL bUsed;
+    VdecThreadParam *pstParam;
+    SAMPLE_VDEC_BENCH_IMAGE_S *pstImage;
+    pthread_t SendTid;
+    pthread_t GetTid;
+    SAMPLE_VDEC_BENCH_STAT_S stStat;
+    SAMPLE_VDEC_BENCH_STAT_S stLast;    /* at the report before */
+}SAMPLE_VDEC_BENCH_CHN_S;
+
+/* what the system counters were at the report before */
+typedef struct sample_vdec_bench_sys_s
+{
+    HI_U64 u64Us;
+    HI_U64 u64CpuBusy;                  /* jiffies of /proc/stat */
+    HI_U64 u64CpuTotal;
+    HI_U64 u64ProcessUs;
+}SAMPLE_VDEC_BENCH_SYS_S;
+
+static SAMPLE_VDEC_BENCH_IMAGE_S gs_astVdecBenchImage[VDEC_MAX_CHN_NUM];
+static SAMPLE_VDEC_BENCH_CHN_S gs_astVdecBenchChn[VDEC_MAX_CHN_NUM];
+static SAMPLE_VDEC_BENCH_SYS_S gs_stVdecBenchSys;
+static HI_BOOL gs_bVdecBenchRun = HI_FALSE;
+static HI_BOOL gs_bVdecBenchGet = HI_FALSE;    /* the get threads outlive the send threads */
+static pthread_mutex_t gs_VdecBenchMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static HI_U64 SAMPLE_COMM_VDEC_BenchUs(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+static HI_BOOL SAMPLE_COMM_VDEC_BenchRunning(const HI_BOOL *pbRun)
+{
+    HI_BOOL bRun;
+
+    pthread_mutex_lock(&gs_VdecBenchMutex);
+    bRun = *pbRun;
+    pthread_mutex_unlock(&gs_VdecBenchMutex);
+    return bRun;
+}
+
+/* the image of the file for the channel, read when no channel before plays it */
+static SAMPLE_VDEC_BENCH_IMAGE_S *SAMPLE_COMM_VDEC_BenchLoad(VDEC_CHN VdChn, const VdecThreadParam *pstParam)
+{
+    SAMPLE_VDEC_BENCH_IMAGE_S *pstImage = NULL;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    VDEC_STREAM_S stStream;
+    HI_U8 *pu8Data;
+    HI_U32 u32Frames = 0;
+    HI_U32 i;
+
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        if (NULL == gs_astVdecBenchImage[i].pu8Data)
+        {
+            pstImage = (NULL == pstImage) ? &gs_astVdecBenchImage[i] : pstImage;
+        }
+        else if ((0 == strcmp(gs_astVdecBenchImage[i].cFileName, pstParam->cFileName))
+                 && (gs_astVdecBenchImage[i].enType == pstParam->enType))
+        {
+            return &gs_astVdecBenchImage[i];
+        }
+    }
+    if (NULL == pstImage)
+    {
+        return NULL;
+    }
+
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceOpen(VdChn, pstParam->cFileName, pstParam->enType,
+                                                  pstParam->u64PtsIncrease))
+    {
+        return NULL;
+    }
+    if ((HI_SUCCESS != SAMPLE_COMM_VDEC_SourceGetIndex(VdChn, &pstFrame, &u32Frames)) || (0 == u32Frames))
+    {
+        SAMPLE_PRT("chn %d: no access units in %s\n", VdChn, pstParam->cFileName);
+        SAMPLE_COMM_VDEC_SourceClose(VdChn);
+        return NULL;
+    }
+    pstImage->pu32Offset = (HI_U32 *)malloc(sizeof(HI_U32) * (u32Frames + 1));
+    if (NULL == pstImage->pu32Offset)
+    {
+        SAMPLE_COMM_VDEC_SourceClose(VdChn);
+        return NULL;
+    }
+    for (i = 0; i < u32Frames; i++)
+    {
+        if (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceGetFrame(VdChn, i, &stStream))
+        {
+            continue;
+        }
+        if (pstImage->u32Len + stStream.u32Len > SAMPLE_VDEC_BENCH_MAX_BYTES)
+        {
+            SAMPLE_PRT("chn %d: only the first %u frames of %s are kept\n", VdChn, pstImage->u32Frames,
+                       pstParam->cFileName);
+            break;
+        }
+        if (pstImage->u32Len + stStream.u32Len > pstImage->u32Size)
+        {
+            pu8Data = (HI_U8 *)realloc(pstImage->pu8Data,
+                                       MIN2((pstImage->u32Len + stStream.u32Len) * 2, SAMPLE_VDEC_BENCH_MAX_BYTES));
+            if (NULL == pu8Data)
+            {
+                SAMPLE_PRT("chn %d: only the first %u frames of %s fit in memory\n", VdChn, pstImage->u32Frames,
+                           pstParam->cFileName);
+                break;
+            }
+            pstImage->pu8Data = pu8Data;
+            pstImage->u32Size = MIN2((pstImage->u32Len + stStream.u32Len) * 2, SAMPLE_VDEC_BENCH_MAX_BYTES);
+        }
+        pstImage->pu32Offset[pstImage->u32Frames++] = pstImage->u32Len;
+        memcpy(pstImage->pu8Data + pstImage->u32Len, stStream.pu8Addr, stStream.u32Len);
+        pstImage->u32Len += stStream.u32Len;
+    }
+    SAMPLE_COMM_VDEC_SourceClose(VdChn);
+    if ((NULL == pstImage->pu8Data) || (0 == pstImage->u32Frames))
+    {
+        free(pstImage->pu8Data);
+        free(pstImage->pu32Offset);
+        memset(pstImage, 0, sizeof(SAMPLE_VDEC_BENCH_IMAGE_S));
+        return NULL;
+    }
+    pstImage->pu32Offset[pstImage->u32Frames] = pstImage->u32Len;
+    snprintf(pstImage->cFileName, sizeof(pstImage->cFileName), "%s", pstParam->cFileName);
+    pstImage->enType = pstParam->enType;
+    /* no page faults while sending, it is fine to go without where the limit is low */
+    pstImage->bLocked = (0 == mlock(pstImage->pu8Data, pstImage->u32Len)) ? HI_TRUE : HI_FALSE;
+    return pstImage;
+}
+
+static HI_VOID SAMPLE_COMM_VDEC_BenchFree(HI_VOID)
+{
+    HI_S32 i;
+
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        if (HI_TRUE == gs_astVdecBenchImage[i].bLocked)
+        {
+            munlock(gs_astVdecBenchImage[i].pu8Data, gs_astVdecBenchImage[i].u32Len);
+        }
+        free(gs_astVdecBenchImage[i].pu8Data);
+        free(gs_astVdecBenchImage[i].pu32Offset);
+    }
+    memset(gs_astVdecBenchImage, 0, sizeof(gs_astVdecBenchImage));
+}
+
+static HI_VOID * SAMPLE_COMM_VDEC_BenchSendProc(HI_VOID *pArgs)
+{
+    SAMPLE_VDEC_BENCH_CHN_S *pstChn = (SAMPLE_VDEC_BENCH_CHN_S *)pArgs;
+    VdecThreadParam *pstParam = pstChn->pstParam;
+    SAMPLE_VDEC_BENCH_IMAGE_S *pstImage = pstChn->pstImage;
+    VDEC_STREAM_S stStream;
+    HI_U32 u32Chunk = (pstParam->s32MinBufSize > 0) ? (HI_U32)pstParam->s32MinBufSize : SAMPLE_VDEC_BENCH_CHUNK;
+    HI_U32 u32Frame = 0;
+    HI_U32 u32Pos = 0;
+    HI_U64 u64Sends = 0;
+
+    memset(&stStream, 0, sizeof(VDEC_STREAM_S));
+    while ((HI_TRUE == SAMPLE_COMM_VDEC_BenchRunning(&gs_bVdecBenchRun)) && (VDEC_CTRL_STOP != pstParam->eCtrlSinal))
+    {
+        if (VDEC_CTRL_PAUSE == pstParam->eCtrlSinal)
+        {
+            usleep(SAMPLE_VDEC_BENCH_SEND_MS * 1000);
+            continue;
+        }
+        if (VIDEO_MODE_FRAME == pstParam->s32StreamMode)
+        {
+            stStream.pu8Addr = pstImage->pu8Data + pstImage->pu32Offset[u32Frame];
+            stStream.u32Len = pstImage->pu32Offset[u32Frame + 1] - pstImage->pu32Offset[u32Frame];
+            stStream.bEndOfFrame = HI_TRUE;
+        }
+        else
+        {
+            stStream.pu8Addr = pstImage->pu8Data + u32Pos;
+            stStream.u32Len = MIN2(u32Chunk, pstImage->u32Len - u32Pos);
+            stStream.bEndOfFrame = HI_FALSE;
+        }
+        stStream.u64PTS = pstParam->u64PtsInit + u64Sends * pstParam->u64PtsIncrease;
+
+        if (HI_SUCCESS != HI_MPI_VDEC_SendStream(pstParam->s32ChnId, &stStream, SAMPLE_VDEC_BENCH_SEND_MS))
+        {
+            pthread_mutex_lock(&gs_VdecBenchMutex);
+            pstChn->stStat.u64Retries++;
+            pthread_mutex_unlock(&gs_VdecBenchMutex);
+            usleep(SAMPLE_VDEC_BENCH_RETRY_US);
+            continue;
+        }
+        u64Sends++;
+        pthread_mutex_lock(&gs_VdecBenchMutex);
+        pstChn->stStat.u64Sends++;
+        pstChn->stStat.u64Bytes += stStream.u32Len;
+        pthread_mutex_unlock(&gs_VdecBenchMutex);
+
+        u32Frame = (u32Frame + 1 < pstImage->u32Frames) ? u32Frame + 1 : 0;
+        u32Pos = (u32Pos + stStream.u32Len < pstImage->u32Len) ? u32Pos + stStream.u32Len : 0;
+        if ((!pstParam->bLoopSend) && (0 == ((VIDEO_MODE_FRAME == pstParam->s32StreamMode) ? u32Frame : u32Pos)))
+        {
+            break;
+        }
+    }
+
+    memset(&stStream, 0, sizeof(VDEC_STREAM_S));
+    stStream.bEndOfStream = HI_TRUE;
+    HI_MPI_VDEC_SendStream(pstParam->s32ChnId, &stStream, -1);
+    return NULL;
+}
+
+static HI_VOID * SAMPLE_COMM_VDEC_BenchGetProc(HI_VOID *pArgs)
+{
+    SAMPLE_VDEC_BENCH_CHN_S *pstChn = (SAMPLE_VDEC_BENCH_CHN_S *)pArgs;
+    VIDEO_FRAME_INFO_S stFrameInfo;
+    HI_U64 u64Pixels;
+
+    while (HI_TRUE == SAMPLE_COMM_VDEC_BenchRunning(&gs_bVdecBenchGet))
+    {
+        if (HI_SUCCESS != HI_MPI_VDEC_GetImage(pstChn->pstParam->s32ChnId, &stFrameInfo, SAMPLE_VDEC_BENCH_GET_MS))
+        {
+            continue;
+        }
+        u64Pixels = (HI_U64)stFrameInfo.stVFrame.u32Width * stFrameInfo.stVFrame.u32Height;
+        HI_MPI_VDEC_ReleaseImage(pstChn->pstParam->s32ChnId, &stFrameInfo);
+        pthread_mutex_lock(&gs_VdecBenchMutex);
+        pstChn->stStat.u64Pictures++;
+        pstChn->stStat.u64Pixels += u64Pixels;
+        pthread_mutex_unlock(&gs_VdecBenchMutex);
+    }
+    return NULL;
+}
+
+/* cpu jiffies busy and in all since boot, 0 where there is no /proc/stat */
+static HI_VOID SAMPLE_COMM_VDEC_BenchCpu(HI_U64 *pu64Busy, HI_U64 *pu64Total)
+{
+    unsigned long long aullJiffies[7] = {0};
+    FILE *pFile = fopen("/proc/stat", "r");
+    HI_U32 i;
+
+    *pu64Busy = 0;
+    *pu64Total = 0;
+    if (NULL == pFile)
+    {
+        return;
+    }
+    /* user nice system idle iowait irq softirq */
+    if (7 == fscanf(pFile, "cpu %llu %llu %llu %llu %llu %llu %llu", &aullJiffies[0], &aullJiffies[1],
+                    &aullJiffies[2], &aullJiffies[3], &aullJiffies[4], &aullJiffies[5], &aullJiffies[6]))
+    {
+        for (i = 0; i < 7; i++)
+        {
+            *pu64Total += aullJiffies[i];
+        }
+        *pu64Busy = *pu64Total - aullJiffies[3] - aullJiffies[4];
+    }
+    fclose(pFile);
+}
+
+/* the number after pszKey on a line of the file, 0 if there is none */
+static HI_U32 SAMPLE_COMM_VDEC_BenchProcValue(const HI_CHAR *pszFile, const HI_CHAR *pszKey)
+{
+    HI_CHAR acLine[256];
+    HI_CHAR *pcKey;
+    FILE *pFile = fopen(pszFile, "r");
+    HI_U32 u32Value = 0;
+
+    if (NULL == pFile)
+    {
+        return 0;
+    }
+    while (NULL != fgets(acLine, sizeof(acLine), pFile))
+    {
+        pcKey = strstr(acLine, pszKey);
+        if ((NULL != pcKey) && (1 == sscanf(pcKey + strlen(pszKey), " %u", &u32Value)))
+        {
+            break;
+        }
+    }
+    fclose(pFile);
+    return u32Value;
+}
+
+static HI_VOID SAMPLE_COMM_VDEC_BenchSys(SAMPLE_VDEC_BENCH_SYS_S *pstSys)
+{
+    struct rusage stUsage;
+
+    pstSys->u64Us = SAMPLE_COMM_VDEC_BenchUs();
+    SAMPLE_COMM_VDEC_BenchCpu(&pstSys->u64CpuBusy, &pstSys->u64CpuTotal);
+    getrusage(RUSAGE_SELF, &stUsage);
+    pstSys->u64ProcessUs = (HI_U64)stUsage.ru_utime.tv_sec * 1000000 + stUsage.ru_utime.tv_usec
+                           + (HI_U64)stUsage.ru_stime.tv_sec * 1000000 + stUsage.ru_stime.tv_usec;
+}
+
+/******************************************************************************
+* funciton : load the streams of s32ChnNum channels into memory and send them
+*            to the channels as fast as they take them, taking and releasing
+*            their pictures. Takes the VdecThreadParam of
+*            SAMPLE_COMM_VDEC_StartSendStream, files are opened with
+*            SAMPLE_COMM_VDEC_SourceOpen and must be h264, h265 or mpeg4, or
+*            an mp4 / ts of them. The channels must be started and not bound
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_BenchStart(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend)
+{
+    SAMPLE_VDEC_BENCH_CHN_S *pstChn;
+    VDEC_CHN VdChn;
+    HI_S32 i;
+
+    if ((s32ChnNum <= 0) || (s32ChnNum > VDEC_MAX_CHN_NUM) || (NULL == pstVdecSend))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    if (HI_TRUE == gs_bVdecBenchRun)
+    {
+        SAMPLE_PRT("bench is running already\n");
+        return HI_FAILURE;
+    }
+
+    memset(gs_astVdecBenchChn, 0, sizeof(gs_astVdecBenchChn));
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        VdChn = pstVdecSend[i].s32ChnId;
+        if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE == gs_astVdecBenchChn[VdChn].bUsed))
+        {
+            SAMPLE_PRT("chn %d: the bench needs distinct channels\n", VdChn);
+            SAMPLE_COMM_VDEC_BenchFree();
+            return HI_FAILURE;
+        }
+        pstChn = &gs_astVdecBenchChn[VdChn];
+        pstChn->pstImage = SAMPLE_COMM_VDEC_BenchLoad(VdChn, &pstVdecSend[i]);
+        if (NULL == pstChn->pstImage)
+        {
+            SAMPLE_PRT("chn %d: can't load %s\n", VdChn, pstVdecSend[i].cFileName);
+            SAMPLE_COMM_VDEC_BenchFree();
+            return HI_FAILURE;
+        }
+        pstChn->bUsed = HI_TRUE;
+        pstChn->pstParam = &pstVdecSend[i];
+    }
+
+    SAMPLE_COMM_VDEC_BenchSys(&gs_stVdecBenchSys);
+    pthread_mutex_lock(&gs_VdecBenchMutex);
+    gs_bVdecBenchRun = HI_TRUE;
+    gs_bVdecBenchGet = HI_TRUE;
+    pthread_mutex_unlock(&gs_VdecBenchMutex);
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        pstChn = &gs_astVdecBenchChn[i];
+        if (HI_TRUE == pstChn->bUsed)
+        {
+            pthread_create(&pstChn->GetTid, 0, SAMPLE_COMM_VDEC_BenchGetProc, (HI_VOID *)pstChn);
+            pthread_create(&pstChn->SendTid, 0, SAMPLE_COMM_VDEC_BenchSendProc, (HI_VOID *)pstChn);
+        }
+    }
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : what a channel of the bench sent and got since it started
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_BenchGetStat(VDEC_CHN VdChn, SAMPLE_VDEC_BENCH_STAT_S *pstStat)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE != gs_astVdecBenchChn[VdChn].bUsed)
+        || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecBenchMutex);
+    memcpy(pstStat, &gs_astVdecBenchChn[VdChn].stStat, sizeof(SAMPLE_VDEC_BENCH_STAT_S));
+    pthread_mutex_unlock(&gs_VdecBenchMutex);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : measure and print decoded fps by channel, pixel and stream rate,
+*            cpu load and memory since the report before (or the start)
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_BenchReport(SAMPLE_VDEC_BENCH_REPORT_S *pstReport)
+{
+    SAMPLE_VDEC_BENCH_CHN_S *pstChn;
+    SAMPLE_VDEC_BENCH_SYS_S stSys;
+    SAMPLE_VDEC_BENCH_STAT_S stStat;
+    HI_U64 u64Pictures = 0;
+    HI_U64 u64Pixels = 0;
+    HI_U64 u64Bytes = 0;
+    HI_U64 u64Us;
+    HI_S32 i;
+
+    if ((HI_TRUE != gs_bVdecBenchRun) || (NULL == pstReport))
+    {
+        return HI_FAILURE;
+    }
+    memset(pstReport, 0, sizeof(SAMPLE_VDEC_BENCH_REPORT_S));
+    SAMPLE_COMM_VDEC_BenchSys(&stSys);
+    u64Us = MAX2(stSys.u64Us - gs_stVdecBenchSys.u64Us, 1);
+    pstReport->u32IntervalMs = (HI_U32)(u64Us / 1000);
+
+    printf("---- vdec bench, %u ms ----\n", pstReport->u32IntervalMs);
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        pstChn = &gs_astVdecBenchChn[i];
+        if (HI_TRUE != pstChn->bUsed)
+        {
+            continue;
+        }
+        pthread_mutex_lock(&gs_VdecBenchMutex);
+        memcpy(&stStat, &pstChn->stStat, sizeof(SAMPLE_VDEC_BENCH_STAT_S));
+        pthread_mutex_unlock(&gs_VdecBenchMutex);
+        pstReport->afFps[i] = (HI_FLOAT)(stStat.u64Pictures - pstChn->stLast.u64Pictures) * 1000000 / u64Us;
+        printf("chn %2d: %7.1f fps  %7.2f Mbps  %llu sends %llu retries\n", i, pstReport->afFps[i],
+               (HI_FLOAT)(stStat.u64Bytes - pstChn->stLast.u64Bytes) * 8 / u64Us,
+               (unsigned long long)(stStat.u64Sends - pstChn->stLast.u64Sends),
+               (unsigned long long)(stStat.u64Retries - pstChn->stLast.u64Retries));
+        u64Pictures += stStat.u64Pictures - pstChn->stLast.u64Pictures;
+        u64Pixels += stStat.u64Pixels - pstChn->stLast.u64Pixels;
+        u64Bytes += stStat.u64Bytes - pstChn->stLast.u64Bytes;
+        memcpy(&pstChn->stLast, &stStat, sizeof(SAMPLE_VDEC_BENCH_STAT_S));
+    }
+    pstReport->fFps = (HI_FLOAT)u64Pictures * 1000000 / u64Us;
+    pstReport->fMPixels = (HI_FLOAT)u64Pixels / u64Us;
+    pstReport->fMbps = (HI_FLOAT)u64Bytes * 8 / u64Us;
+    if (stSys.u64CpuTotal > gs_stVdecBenchSys.u64CpuTotal)
+    {
+        pstReport->fCpuLoad = (HI_FLOAT)(stSys.u64CpuBusy - gs_stVdecBenchSys.u64CpuBusy) * 100
+                              / (stSys.u64CpuTotal - gs_stVdecBenchSys.u64CpuTotal);
+    }
+    pstReport->fProcessLoad = (HI_FLOAT)(stSys.u64ProcessUs - gs_stVdecBenchSys.u64ProcessUs) * 100 / u64Us;
+    pstReport->u32RssKB = SAMPLE_COMM_VDEC_BenchProcValue("/proc/self/status", "VmRSS:");
+    pstReport->u32MemFreeKB = SAMPLE_COMM_VDEC_BenchProcValue("/proc/meminfo", "MemFree:");
+    pstReport->u32MmzUsedKB = SAMPLE_COMM_VDEC_BenchProcValue("/proc/media-mem", "used=");
+    memcpy(&gs_stVdecBenchSys, &stSys, sizeof(SAMPLE_VDEC_BENCH_SYS_S));
+
+    printf("total : %7.1f fps  %7.2f Mpixel/s  %7.2f Mbps\n", pstReport->fFps, pstReport->fMPixels,
+           pstReport->fMbps);
+    printf("cpu %.1f%%, process %.1f%% of a cpu, rss %u KB, free %u KB, mmz used %u KB\n",
+           pstReport->fCpuLoad, pstReport->fProcessLoad, pstReport->u32RssKB, pstReport->u32MemFreeKB,
+           pstReport->u32MmzUsedKB);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop the bench threads, every channel gets the end of stream,
+*            and free the streams in memory. The pictures are taken until the
+*            end of stream is in: the decoder stops when its few picture
+*            buffers are full, and with it the blocking send of the end
+******************************************************************************/
+HI_VOID SAMPLE_COMM_VDEC_BenchStop(HI_VOID)
+{
+    HI_S32 i;
+
+    if (HI_TRUE != gs_bVdecBenchRun)
+    {
+        return;
+    }
+    pthread_mutex_lock(&gs_VdecBenchMutex);
+    gs_bVdecBenchRun = HI_FALSE;
+    pthread_mutex_unlock(&gs_VdecBenchMutex);
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        if (HI_TRUE == gs_astVdecBenchChn[i].bUsed)
+        {
+            pthread_join(gs_astVdecBenchChn[i].SendTid, 0);
+        }
+    }
+    pthread_mutex_lock(&gs_VdecBenchMutex);
+    gs_bVdecBenchGet = HI_FALSE;
+    pthread_mutex_unlock(&gs_VdecBenchMutex);
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        if (HI_TRUE == gs_astVdecBenchChn[i].bUsed)
+        {
+            pthread_join(gs_astVdecBenchChn[i].GetTid, 0);
+        }
+    }
+    SAMPLE_COMM_VDEC_BenchFree();
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
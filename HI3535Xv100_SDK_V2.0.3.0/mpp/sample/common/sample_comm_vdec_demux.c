@@ -0,0 +1,1235 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: mp4 and mpeg-ts demuxer for vdec.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-5 Created
+******************************************************************************/
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "sample_comm.h"
+
+/*
+ * SAMPLE_COMM_VDEC_SourceOpen maps a file and hands mp4 and mpeg-ts files
+ * here. The container is turned into the frame index an elementary stream
+ * gets, so sending, seek, trick play and the feeder work on it as they are.
+ *
+ * mp4: the samples of the first h264 / h265 track, from the stbl of the moov
+ * and the trun of every moof. A sample holds nals with their length in front,
+ * the parameter sets are in the avcC / hvcC of the track. Every sample is
+ * copied into the channel's buffer with start codes for the lengths and the
+ * parameter sets in front of key frames. The mapping stays read-only: pages
+ * written in a private mapping are the channel's own until it is closed, which
+ * grows towards the file size for every channel playing it.
+ *
+ * ts: the pes of the video pid of the first program, one access unit each.
+ * u32Offset is the packet the pes starts in and u32Len the bytes of its
+ * payload, which is spread over the packets and copied together.
+ *
+ * The pts are those of the container in us, counted from the first frame.
+ * A frame shown before the first one (an open gop's leading picture) gets 0.
+ */
+#define SAMPLE_VDEC_FOURCC(a, b, c, d)  (((HI_U32)(a) << 24) | ((HI_U32)(b) << 16) | ((HI_U32)(c) << 8) | (HI_U32)(d))
+
+#define SAMPLE_VDEC_DEMUX_PARAM_MAX     1024    /* parameter sets of a track as start code nals */
+
+#define SAMPLE_VDEC_TS_PACKET           188
+#define SAMPLE_VDEC_TS_SYNC             0x47
+#define SAMPLE_VDEC_TS_NO_PID           0xFFFF
+#define SAMPLE_VDEC_TS_PTS_WRAP         (1ULL << 33)
+
+#define SAMPLE_VDEC_MP4_NON_SYNC        0x00010000      /* sample_is_non_sync_sample of the sample flags */
+
+typedef struct sample_vdec_demux_ctx_s
+{
+    HI_BOOL bOpen;
+    SAMPLE_VDEC_CONTAINER_E enContainer;
+    PAYLOAD_TYPE_E enType;
+    HI_U8 *pu8Map;
+    HI_U32 u32Size;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Frames;
+    HI_U8 *pu8Buf;                      /* frames put together from the mapping */
+    HI_U32 u32BufSize;
+
+    /* mp4 */
+    HI_U32 u32NalLenSize;
+    HI_U8 au8Param[SAMPLE_VDEC_DEMUX_PARAM_MAX];
+    HI_U32 u32ParamLen;
+
+    /* ts */
+    HI_U32 u32PktSize;                  /* 188, or 192 with a 4 byte time code in front */
+    HI_U32 u32PktHead;
+    HI_U32 u32Pid;
+}SAMPLE_VDEC_DEMUX_CTX_S;
+
+/* the track an mp4 index is built for */
+typedef struct sample_vdec_mp4_track_s
+{
+    HI_U32 u32TrackId;
+    HI_U32 u32Timescale;
+    PAYLOAD_TYPE_E enType;
+    HI_U32 u32Stbl;                     /* body of the stbl */
+    HI_U32 u32StblEnd;
+    HI_U32 u32DefDuration;              /* trex of the mvex */
+    HI_U32 u32DefSize;
+    HI_U32 u32DefFlags;
+}SAMPLE_VDEC_MP4_TRACK_S;
+
+/* the frame index as it grows */
+typedef struct sample_vdec_demux_table_s
+{
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Frames;
+    HI_U32 u32Max;
+}SAMPLE_VDEC_DEMUX_TABLE_S;
+
+static SAMPLE_VDEC_DEMUX_CTX_S gs_astVdecDemux[VDEC_MAX_CHN_NUM];
+
+static HI_U32 SAMPLE_COMM_VDEC_Rd16(const HI_U8 *pu8Data)
+{
+    return ((HI_U32)pu8Data[0] << 8) | pu8Data[1];
+}
+
+static HI_U32 SAMPLE_COMM_VDEC_Rd32(const HI_U8 *pu8Data)
+{
+    return ((HI_U32)pu8Data[0] << 24) | ((HI_U32)pu8Data[1] << 16) | ((HI_U32)pu8Data[2] << 8) | pu8Data[3];
+}
+
+static HI_U64 SAMPLE_COMM_VDEC_Rd64(const HI_U8 *pu8Data)
+{
+    return ((HI_U64)SAMPLE_COMM_VDEC_Rd32(pu8Data) << 32) | SAMPLE_COMM_VDEC_Rd32(pu8Data + 4);
+}
+
+static SAMPLE_VDEC_FRAME_S *SAMPLE_COMM_VDEC_DemuxAdd(SAMPLE_VDEC_DEMUX_TABLE_S *pstTable)
+{
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+
+    if (pstTable->u32Frames == pstTable->u32Max)
+    {
+        pstFrame = (SAMPLE_VDEC_FRAME_S *)realloc(pstTable->pstFrame,
+                                                  sizeof(SAMPLE_VDEC_FRAME_S) * (pstTable->u32Max * 2 + 64));
+        if (NULL == pstFrame)
+        {
+            return NULL;
+        }
+        pstTable->pstFrame = pstFrame;
+        pstTable->u32Max = pstTable->u32Max * 2 + 64;
+    }
+    pstFrame = &pstTable->pstFrame[pstTable->u32Frames++];
+    memset(pstFrame, 0, sizeof(SAMPLE_VDEC_FRAME_S));
+    return pstFrame;
+}
+
+/* u64PTS holds signed ticks while indexing: count them in us from the first frame */
+static HI_VOID SAMPLE_COMM_VDEC_DemuxPts(SAMPLE_VDEC_DEMUX_TABLE_S *pstTable, HI_U32 u32Timescale)
+{
+    HI_S64 s64Base;
+    HI_S64 s64Ticks;
+    HI_U32 i;
+
+    if (0 == pstTable->u32Frames)
+    {
+        return;
+    }
+    s64Base = (HI_S64)pstTable->pstFrame[0].u64PTS;
+    for (i = 0; i < pstTable->u32Frames; i++)
+    {
+        s64Ticks = (HI_S64)pstTable->pstFrame[i].u64PTS - s64Base;
+        pstTable->pstFrame[i].u64PTS = (s64Ticks > 0) ? (HI_U64)s64Ticks * 1000000 / u32Timescale : 0;
+    }
+}
+
+/* append the nal as start code, nal to the parameter sets */
+static HI_S32 SAMPLE_COMM_VDEC_DemuxParam(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, const HI_U8 *pu8Nal, HI_U32 u32Len)
+{
+    if (u32Len + 4 > SAMPLE_VDEC_DEMUX_PARAM_MAX - pstCtx->u32ParamLen)
+    {
+        return HI_FAILURE;
+    }
+    memcpy(pstCtx->au8Param + pstCtx->u32ParamLen, "\x00\x00\x00\x01", 4);
+    memcpy(pstCtx->au8Param + pstCtx->u32ParamLen + 4, pu8Nal, u32Len);
+    pstCtx->u32ParamLen += 4 + u32Len;
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : what a file holds, from its first bytes
+******************************************************************************/
+SAMPLE_VDEC_CONTAINER_E SAMPLE_COMM_VDEC_DemuxProbe(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 u32Type;
+    HI_U32 u32Head;
+
+    if (NULL == pu8Data)
+    {
+        return SAMPLE_VDEC_CONTAINER_ES;
+    }
+    if (u32Len >= 8)
+    {
+        u32Type = SAMPLE_COMM_VDEC_Rd32(pu8Data + 4);
+        if ((SAMPLE_VDEC_FOURCC('f', 't', 'y', 'p') == u32Type) || (SAMPLE_VDEC_FOURCC('s', 't', 'y', 'p') == u32Type)
+            || (SAMPLE_VDEC_FOURCC('m', 'o', 'o', 'v') == u32Type))
+        {
+            return SAMPLE_VDEC_CONTAINER_MP4;
+        }
+    }
+    /* two packets in sync, 188 bytes or 192 with the time code of m2ts */
+    for (u32Head = 0; u32Head <= 4; u32Head += 4)
+    {
+        if ((u32Len >= u32Head + SAMPLE_VDEC_TS_PACKET * 2)
+            && (SAMPLE_VDEC_TS_SYNC == pu8Data[u32Head])
+            && (SAMPLE_VDEC_TS_SYNC == pu8Data[u32Head * 2 + SAMPLE_VDEC_TS_PACKET]))
+        {
+            return SAMPLE_VDEC_CONTAINER_TS;
+        }
+    }
+    return SAMPLE_VDEC_CONTAINER_ES;
+}
+
+/* the box at u32Pos: its type, where its body starts and where the next box starts */
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Box(const HI_U8 *pu8Data, HI_U32 u32Pos, HI_U32 u32End,
+                                      HI_U32 *pu32Type, HI_U32 *pu32Body, HI_U32 *pu32Next)
+{
+    HI_U64 u64Size;
+    HI_U32 u32Head = 8;
+
+    if ((u32Pos >= u32End) || (u32End - u32Pos < 8))
+    {
+        return HI_FAILURE;
+    }
+    u64Size = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Pos);
+    *pu32Type = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Pos + 4);
+    if (1 == u64Size)
+    {
+        if (u32End - u32Pos < 16)
+        {
+            return HI_FAILURE;
+        }
+        u64Size = SAMPLE_COMM_VDEC_Rd64(pu8Data + u32Pos + 8);
+        u32Head = 16;
+    }
+    else if (0 == u64Size)
+    {
+        u64Size = u32End - u32Pos;      /* up to the end of the file */
+    }
+    if ((u64Size < u32Head) || (u64Size > u32End - u32Pos))
+    {
+        return HI_FAILURE;
+    }
+    *pu32Body = u32Pos + u32Head;
+    *pu32Next = u32Pos + (HI_U32)u64Size;
+    return HI_SUCCESS;
+}
+
+/* body of the first box of u32Type in [u32Pos, u32End) */
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Find(const HI_U8 *pu8Data, HI_U32 u32Pos, HI_U32 u32End, HI_U32 u32Type,
+                                       HI_U32 *pu32Body, HI_U32 *pu32BodyEnd)
+{
+    HI_U32 u32BoxType;
+    HI_U32 u32Body;
+    HI_U32 u32Next;
+
+    while (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Pos, u32End, &u32BoxType, &u32Body, &u32Next))
+    {
+        if (u32BoxType == u32Type)
+        {
+            *pu32Body = u32Body;
+            *pu32BodyEnd = u32Next;
+            return HI_SUCCESS;
+        }
+        u32Pos = u32Next;
+    }
+    return HI_FAILURE;
+}
+
+/* avcC / hvcC: nal length size and the parameter sets */
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Config(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, HI_U32 u32Body, HI_U32 u32End)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    HI_U32 u32Pos;
+    HI_U32 u32Arrays;
+    HI_U32 u32Nals;
+    HI_U32 u32Len;
+    HI_U32 i;
+
+    pstCtx->u32ParamLen = 0;
+    if (PT_H264 == pstCtx->enType)
+    {
+        if (u32End - u32Body < 7)
+        {
+            return HI_FAILURE;
+        }
+        pstCtx->u32NalLenSize = (pu8Data[u32Body + 4] & 0x3) + 1;
+        u32Pos = u32Body + 5;
+        /* the sps and then the pps, each with their count in front */
+        for (u32Arrays = 0; u32Arrays < 2; u32Arrays++)
+        {
+            if (u32Pos >= u32End)
+            {
+                return HI_FAILURE;
+            }
+            u32Nals = (0 == u32Arrays) ? (pu8Data[u32Pos] & 0x1F) : pu8Data[u32Pos];
+            u32Pos++;
+            for (i = 0; i < u32Nals; i++)
+            {
+                if ((u32End - u32Pos < 2) || (u32End - u32Pos - 2 < SAMPLE_COMM_VDEC_Rd16(pu8Data + u32Pos)))
+                {
+                    return HI_FAILURE;
+                }
+                u32Len = SAMPLE_COMM_VDEC_Rd16(pu8Data + u32Pos);
+                if (HI_SUCCESS != SAMPLE_COMM_VDEC_DemuxParam(pstCtx, pu8Data + u32Pos + 2, u32Len))
+                {
+                    return HI_FAILURE;
+                }
+                u32Pos += 2 + u32Len;
+            }
+        }
+    }
+    else
+    {
+        if (u32End - u32Body < 23)
+        {
+            return HI_FAILURE;
+        }
+        pstCtx->u32NalLenSize = (pu8Data[u32Body + 21] & 0x3) + 1;
+        u32Arrays = pu8Data[u32Body + 22];
+        u32Pos = u32Body + 23;
+        while (u32Arrays-- > 0)
+        {
+            if (u32End - u32Pos < 3)
+            {
+                return HI_FAILURE;
+            }
+            u32Nals = SAMPLE_COMM_VDEC_Rd16(pu8Data + u32Pos + 1);
+            u32Pos += 3;
+            for (i = 0; i < u32Nals; i++)
+            {
+                if ((u32End - u32Pos < 2) || (u32End - u32Pos - 2 < SAMPLE_COMM_VDEC_Rd16(pu8Data + u32Pos)))
+                {
+                    return HI_FAILURE;
+                }
+                u32Len = SAMPLE_COMM_VDEC_Rd16(pu8Data + u32Pos);
+                if (HI_SUCCESS != SAMPLE_COMM_VDEC_DemuxParam(pstCtx, pu8Data + u32Pos + 2, u32Len))
+                {
+                    return HI_FAILURE;
+                }
+                u32Pos += 2 + u32Len;
+            }
+        }
+    }
+    return (3 == pstCtx->u32NalLenSize) ? HI_FAILURE : HI_SUCCESS;
+}
+
+/* the first h264 / h265 video track of the moov */
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Track(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, HI_U32 u32Moov, HI_U32 u32MoovEnd,
+                                        SAMPLE_VDEC_MP4_TRACK_S *pstTrack)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    HI_U32 u32Pos = u32Moov;
+    HI_U32 u32Type;
+    HI_U32 u32Trak, u32TrakEnd, u32Next;
+    HI_U32 u32Body, u32End;
+    HI_U32 u32Mdia, u32MdiaEnd;
+    HI_U32 u32Entry, u32EntryEnd;
+    HI_U32 u32Config, u32ConfigEnd;
+
+    while (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Pos, u32MoovEnd, &u32Type, &u32Trak, &u32Next))
+    {
+        u32Pos = u32Next;
+        u32TrakEnd = u32Next;
+        if ((SAMPLE_VDEC_FOURCC('t', 'r', 'a', 'k') != u32Type)
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Trak, u32TrakEnd, SAMPLE_VDEC_FOURCC('t', 'k', 'h', 'd'), &u32Body, &u32End))
+            || (u32End - u32Body < 24))
+        {
+            continue;
+        }
+        pstTrack->u32TrackId = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + ((1 == pu8Data[u32Body]) ? 20 : 12));
+
+        if ((HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Trak, u32TrakEnd, SAMPLE_VDEC_FOURCC('m', 'd', 'i', 'a'), &u32Mdia, &u32MdiaEnd))
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Mdia, u32MdiaEnd, SAMPLE_VDEC_FOURCC('h', 'd', 'l', 'r'), &u32Body, &u32End))
+            || (u32End - u32Body < 12) || (SAMPLE_VDEC_FOURCC('v', 'i', 'd', 'e') != SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 8))
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Mdia, u32MdiaEnd, SAMPLE_VDEC_FOURCC('m', 'd', 'h', 'd'), &u32Body, &u32End))
+            || (u32End - u32Body < 24))
+        {
+            continue;
+        }
+        pstTrack->u32Timescale = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + ((1 == pu8Data[u32Body]) ? 20 : 12));
+
+        if ((0 == pstTrack->u32Timescale)
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Mdia, u32MdiaEnd, SAMPLE_VDEC_FOURCC('m', 'i', 'n', 'f'), &u32Body, &u32End))
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Body, u32End, SAMPLE_VDEC_FOURCC('s', 't', 'b', 'l'), &pstTrack->u32Stbl, &pstTrack->u32StblEnd))
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('s', 't', 's', 'd'), &u32Body, &u32End))
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Body + 8, u32End, &u32Type, &u32Entry, &u32EntryEnd)))
+        {
+            continue;
+        }
+        if ((SAMPLE_VDEC_FOURCC('a', 'v', 'c', '1') == u32Type) || (SAMPLE_VDEC_FOURCC('a', 'v', 'c', '3') == u32Type))
+        {
+            pstCtx->enType = PT_H264;
+            u32Type = SAMPLE_VDEC_FOURCC('a', 'v', 'c', 'C');
+        }
+        else if ((SAMPLE_VDEC_FOURCC('h', 'v', 'c', '1') == u32Type) || (SAMPLE_VDEC_FOURCC('h', 'e', 'v', '1') == u32Type))
+        {
+            pstCtx->enType = SAMPLE_PT_H265;
+            u32Type = SAMPLE_VDEC_FOURCC('h', 'v', 'c', 'C');
+        }
+        else
+        {
+            continue;
+        }
+        /* the boxes of a visual sample entry follow 78 bytes of its own */
+        if ((u32EntryEnd - u32Entry < 78)
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Entry + 78, u32EntryEnd, u32Type, &u32Config, &u32ConfigEnd))
+            || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Config(pstCtx, u32Config, u32ConfigEnd)))
+        {
+            SAMPLE_PRT("track %u: bad decoder config\n", pstTrack->u32TrackId);
+            continue;
+        }
+        pstTrack->enType = pstCtx->enType;
+        return HI_SUCCESS;
+    }
+    return HI_FAILURE;
+}
+
+/* the defaults of the track's fragments, from the trex of the mvex */
+static HI_VOID SAMPLE_COMM_VDEC_Mp4Trex(const HI_U8 *pu8Data, HI_U32 u32Moov, HI_U32 u32MoovEnd,
+                                        SAMPLE_VDEC_MP4_TRACK_S *pstTrack)
+{
+    HI_U32 u32Mvex, u32MvexEnd;
+    HI_U32 u32Pos, u32Type, u32Body, u32Next;
+
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, u32Moov, u32MoovEnd, SAMPLE_VDEC_FOURCC('m', 'v', 'e', 'x'), &u32Mvex, &u32MvexEnd))
+    {
+        return;
+    }
+    u32Pos = u32Mvex;
+    while (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Pos, u32MvexEnd, &u32Type, &u32Body, &u32Next))
+    {
+        if ((SAMPLE_VDEC_FOURCC('t', 'r', 'e', 'x') == u32Type) && (u32Next - u32Body >= 24)
+            && (SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 4) == pstTrack->u32TrackId))
+        {
+            pstTrack->u32DefDuration = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 12);
+            pstTrack->u32DefSize = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 16);
+            pstTrack->u32DefFlags = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 20);
+            return;
+        }
+        u32Pos = u32Next;
+    }
+}
+
+/* the samples of the stbl, a sample cut off by the end of the file ends the index */
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Stbl(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, const SAMPLE_VDEC_MP4_TRACK_S *pstTrack,
+                                       SAMPLE_VDEC_DEMUX_TABLE_S *pstTable, HI_U64 *pu64Dts)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Stsz, u32StszEnd, u32Stsc, u32StscEnd, u32Stco, u32StcoEnd;
+    HI_U32 u32Stts = 0, u32SttsEnd = 0, u32Ctts = 0, u32CttsEnd = 0, u32Stss = 0, u32StssEnd = 0;
+    HI_BOOL bCo64 = HI_FALSE;
+    HI_BOOL bCtts, bStss;
+    HI_U32 u32FixedSize, u32Samples, u32Chunks, u32StscCnt, u32SttsCnt, u32CttsCnt, u32StssCnt;
+    HI_U32 u32Sample = 0;
+    HI_U32 u32Entry, u32Chunk, u32ChunkEnd, u32PerChunk, k;
+    HI_U32 u32SttsIdx = 0, u32SttsLeft = 0, u32Delta = 0;
+    HI_U32 u32CttsIdx = 0, u32CttsLeft = 0;
+    HI_S32 s32Cto = 0;
+    HI_U32 u32StssIdx = 0;
+    HI_U64 u64Offset;
+    HI_U32 u32Len;
+
+    if ((HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('s', 't', 's', 'z'), &u32Stsz, &u32StszEnd))
+        || (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('s', 't', 's', 'c'), &u32Stsc, &u32StscEnd))
+        || (u32StszEnd - u32Stsz < 12) || (u32StscEnd - u32Stsc < 8))
+    {
+        /* a fragmented file's moov may have no samples */
+        return HI_SUCCESS;
+    }
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('s', 't', 'c', 'o'), &u32Stco, &u32StcoEnd))
+    {
+        if (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('c', 'o', '6', '4'), &u32Stco, &u32StcoEnd))
+        {
+            return HI_FAILURE;
+        }
+        bCo64 = HI_TRUE;
+    }
+    (HI_VOID)SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('s', 't', 't', 's'), &u32Stts, &u32SttsEnd);
+    bCtts = (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('c', 't', 't', 's'), &u32Ctts, &u32CttsEnd)) ? HI_TRUE : HI_FALSE;
+    bStss = (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Find(pu8Data, pstTrack->u32Stbl, pstTrack->u32StblEnd, SAMPLE_VDEC_FOURCC('s', 't', 's', 's'), &u32Stss, &u32StssEnd)) ? HI_TRUE : HI_FALSE;
+
+    /* the counts of the tables, cut down to what the boxes hold */
+    u32FixedSize = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsz + 4);
+    u32Samples = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsz + 8);
+    if ((0 == u32FixedSize) && (u32Samples > (u32StszEnd - u32Stsz - 12) / 4))
+    {
+        u32Samples = (u32StszEnd - u32Stsz - 12) / 4;
+    }
+    u32StscCnt = MIN2(SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsc + 4), (u32StscEnd - u32Stsc - 8) / 12);
+    u32Chunks = (u32StcoEnd - u32Stco < 8) ? 0
+                : MIN2(SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stco + 4), (u32StcoEnd - u32Stco - 8) / (bCo64 ? 8 : 4));
+    u32SttsCnt = (u32SttsEnd - u32Stts < 8) ? 0 : MIN2(SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stts + 4), (u32SttsEnd - u32Stts - 8) / 8);
+    u32CttsCnt = (!bCtts || (u32CttsEnd - u32Ctts < 8)) ? 0 : MIN2(SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Ctts + 4), (u32CttsEnd - u32Ctts - 8) / 8);
+    u32StssCnt = (!bStss || (u32StssEnd - u32Stss < 8)) ? 0 : MIN2(SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stss + 4), (u32StssEnd - u32Stss - 8) / 4);
+
+    for (u32Entry = 0; (u32Entry < u32StscCnt) && (u32Sample < u32Samples); u32Entry++)
+    {
+        u32Chunk = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsc + 8 + u32Entry * 12);
+        u32PerChunk = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsc + 8 + u32Entry * 12 + 4);
+        u32ChunkEnd = (u32Entry + 1 < u32StscCnt) ? SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsc + 8 + (u32Entry + 1) * 12) : u32Chunks + 1;
+        for (; (u32Chunk < u32ChunkEnd) && (u32Chunk >= 1) && (u32Chunk <= u32Chunks) && (u32Sample < u32Samples); u32Chunk++)
+        {
+            u64Offset = bCo64 ? SAMPLE_COMM_VDEC_Rd64(pu8Data + u32Stco + 8 + (u32Chunk - 1) * 8)
+                        : SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stco + 8 + (u32Chunk - 1) * 4);
+            for (k = 0; (k < u32PerChunk) && (u32Sample < u32Samples); k++, u32Sample++)
+            {
+                u32Len = (0 != u32FixedSize) ? u32FixedSize : SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stsz + 12 + u32Sample * 4);
+                if ((u64Offset > pstCtx->u32Size) || (u32Len > pstCtx->u32Size - u64Offset))
+                {
+                    SAMPLE_PRT("sample %u is cut off, %u samples indexed\n", u32Sample, pstTable->u32Frames);
+                    return HI_SUCCESS;
+                }
+                while ((0 == u32SttsLeft) && (u32SttsIdx < u32SttsCnt))
+                {
+                    u32SttsLeft = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stts + 8 + u32SttsIdx * 8);
+                    u32Delta = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stts + 12 + u32SttsIdx * 8);
+                    u32SttsIdx++;
+                }
+                while ((0 == u32CttsLeft) && (u32CttsIdx < u32CttsCnt))
+                {
+                    /* version 0 offsets are unsigned, but writers put negative ones in as well */
+                    u32CttsLeft = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Ctts + 8 + u32CttsIdx * 8);
+                    s32Cto = (HI_S32)SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Ctts + 12 + u32CttsIdx * 8);
+                    u32CttsIdx++;
+                }
+
+                pstFrame = SAMPLE_COMM_VDEC_DemuxAdd(pstTable);
+                if (NULL == pstFrame)
+                {
+                    return HI_FAILURE;
+                }
+                pstFrame->u32Offset = (HI_U32)u64Offset;
+                pstFrame->u32Len = u32Len;
+                pstFrame->u64PTS = (HI_U64)((HI_S64)*pu64Dts + ((u32CttsLeft > 0) ? s32Cto : 0));
+                pstFrame->bKey = HI_TRUE;
+                if (HI_TRUE == bStss)
+                {
+                    pstFrame->bKey = HI_FALSE;
+                    if ((u32StssIdx < u32StssCnt) && (SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Stss + 8 + u32StssIdx * 4) == u32Sample + 1))
+                    {
+                        pstFrame->bKey = HI_TRUE;
+                        u32StssIdx++;
+                    }
+                }
+
+                *pu64Dts += u32Delta;
+                u32SttsLeft = (u32SttsLeft > 0) ? u32SttsLeft - 1 : 0;
+                u32CttsLeft = (u32CttsLeft > 0) ? u32CttsLeft - 1 : 0;
+                u64Offset += u32Len;
+            }
+        }
+    }
+    return HI_SUCCESS;
+}
+
+/* the samples of the track in one traf of the moof at u32Moof */
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Traf(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, const SAMPLE_VDEC_MP4_TRACK_S *pstTrack,
+                                       HI_U32 u32Moof, HI_U32 u32Traf, HI_U32 u32TrafEnd,
+                                       SAMPLE_VDEC_DEMUX_TABLE_S *pstTable, HI_U64 *pu64Dts, HI_BOOL *pbCut)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Pos = u32Traf;
+    HI_U32 u32Type, u32Body, u32Next, u32Field;
+    HI_U32 u32Flags, u32Samples, i;
+    HI_U32 u32Duration = pstTrack->u32DefDuration;
+    HI_U32 u32Size = pstTrack->u32DefSize;
+    HI_U32 u32SampleFlags = pstTrack->u32DefFlags;
+    HI_U32 u32FirstFlags = 0;
+    HI_U32 u32Len, u32Dur, u32SmpFlags;
+    HI_S32 s32Cto;
+    HI_BOOL bTrack = HI_FALSE;
+    HI_BOOL bFirstFlags;
+    HI_U64 u64Base = u32Moof;
+    HI_U64 u64Data = u32Moof;
+
+    while (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Pos, u32TrafEnd, &u32Type, &u32Body, &u32Next))
+    {
+        u32Pos = u32Next;
+        if (SAMPLE_VDEC_FOURCC('t', 'f', 'h', 'd') == u32Type)
+        {
+            if ((u32Next - u32Body < 8) || (SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 4) != pstTrack->u32TrackId))
+            {
+                return HI_SUCCESS;
+            }
+            bTrack = HI_TRUE;
+            u32Flags = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body) & 0xFFFFFF;
+            /* base data offset, sample description index, default duration, size and flags */
+            u32Len = 8 + ((u32Flags & 0x01) ? 8 : 0) + ((u32Flags & 0x02) ? 4 : 0) + ((u32Flags & 0x08) ? 4 : 0)
+                     + ((u32Flags & 0x10) ? 4 : 0) + ((u32Flags & 0x20) ? 4 : 0);
+            if (u32Next - u32Body < u32Len)
+            {
+                /* shorter than its flags say, take it as the end of the recording */
+                SAMPLE_PRT("tfhd of the moof at %u is %u bytes, needs %u\n", u32Moof, u32Next - u32Body, u32Len);
+                *pbCut = HI_TRUE;
+                return HI_SUCCESS;
+            }
+            u32Field = u32Body + 8;
+            if (u32Flags & 0x01)
+            {
+                u64Base = SAMPLE_COMM_VDEC_Rd64(pu8Data + u32Field);
+                u32Field += 8;
+            }
+            u32Field += (u32Flags & 0x02) ? 4 : 0;
+            if (u32Flags & 0x08)
+            {
+                u32Duration = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                u32Field += 4;
+            }
+            if (u32Flags & 0x10)
+            {
+                u32Size = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                u32Field += 4;
+            }
+            if (u32Flags & 0x20)
+            {
+                u32SampleFlags = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+            }
+            u64Data = u64Base;
+        }
+        else if ((SAMPLE_VDEC_FOURCC('t', 'f', 'd', 't') == u32Type) && (HI_TRUE == bTrack))
+        {
+            /* version 1 has a 64 bit decode time */
+            u32Len = ((u32Next - u32Body >= 1) && (1 == pu8Data[u32Body])) ? 12 : 8;
+            if (u32Next - u32Body < u32Len)
+            {
+                SAMPLE_PRT("tfdt of the moof at %u is %u bytes, needs %u\n", u32Moof, u32Next - u32Body, u32Len);
+                *pbCut = HI_TRUE;
+                return HI_SUCCESS;
+            }
+            *pu64Dts = (12 == u32Len) ? SAMPLE_COMM_VDEC_Rd64(pu8Data + u32Body + 4)
+                       : SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 4);
+        }
+        else if ((SAMPLE_VDEC_FOURCC('t', 'r', 'u', 'n') == u32Type) && (HI_TRUE == bTrack) && (u32Next - u32Body >= 8))
+        {
+            u32Flags = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body) & 0xFFFFFF;
+            u32Samples = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Body + 4);
+            u32Field = u32Body + 8;
+            if ((u32Flags & 0x001) && (u32Next - u32Field >= 4))
+            {
+                u64Data = u64Base + (HI_S64)(HI_S32)SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                u32Field += 4;
+            }
+            bFirstFlags = ((u32Flags & 0x004) && (u32Next - u32Field >= 4)) ? HI_TRUE : HI_FALSE;
+            if (HI_TRUE == bFirstFlags)
+            {
+                u32FirstFlags = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                u32Field += 4;
+            }
+            for (i = 0; i < u32Samples; i++)
+            {
+                u32Dur = u32Duration;
+                u32Len = u32Size;
+                u32SmpFlags = ((0 == i) && (HI_TRUE == bFirstFlags)) ? u32FirstFlags : u32SampleFlags;
+                s32Cto = 0;
+                if (((u32Flags & 0x100) ? 4 : 0) + ((u32Flags & 0x200) ? 4 : 0) + ((u32Flags & 0x400) ? 4 : 0)
+                    + ((u32Flags & 0x800) ? 4 : 0) > u32Next - u32Field)
+                {
+                    break;
+                }
+                if (u32Flags & 0x100)
+                {
+                    u32Dur = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                    u32Field += 4;
+                }
+                if (u32Flags & 0x200)
+                {
+                    u32Len = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                    u32Field += 4;
+                }
+                if (u32Flags & 0x400)
+                {
+                    u32SmpFlags = SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                    u32Field += 4;
+                }
+                if (u32Flags & 0x800)
+                {
+                    s32Cto = (HI_S32)SAMPLE_COMM_VDEC_Rd32(pu8Data + u32Field);
+                    u32Field += 4;
+                }
+                if ((u64Data > pstCtx->u32Size) || (u32Len > pstCtx->u32Size - u64Data))
+                {
+                    /* a recording that stopped in the middle of a fragment */
+                    *pbCut = HI_TRUE;
+                    return HI_SUCCESS;
+                }
+                pstFrame = SAMPLE_COMM_VDEC_DemuxAdd(pstTable);
+                if (NULL == pstFrame)
+                {
+                    return HI_FAILURE;
+                }
+                pstFrame->u32Offset = (HI_U32)u64Data;
+                pstFrame->u32Len = u32Len;
+                pstFrame->u64PTS = (HI_U64)((HI_S64)*pu64Dts + s32Cto);
+                pstFrame->bKey = (u32SmpFlags & SAMPLE_VDEC_MP4_NON_SYNC) ? HI_FALSE : HI_TRUE;
+                *pu64Dts += u32Dur;
+                u64Data += u32Len;
+            }
+        }
+    }
+    return HI_SUCCESS;
+}
+
+static HI_S32 SAMPLE_COMM_VDEC_Mp4Index(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, SAMPLE_VDEC_DEMUX_TABLE_S *pstTable)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    SAMPLE_VDEC_MP4_TRACK_S stTrack;
+    HI_U32 u32Pos = 0;
+    HI_U32 u32Type, u32Body, u32Next;
+    HI_U32 u32Moov = 0, u32MoovEnd = 0;
+    HI_U32 u32Traf, u32TrafEnd, u32TrafNext, u32TrafType;
+    HI_U64 u64Dts = 0;
+    HI_BOOL bCut = HI_FALSE;
+
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Find(pu8Data, 0, pstCtx->u32Size, SAMPLE_VDEC_FOURCC('m', 'o', 'o', 'v'), &u32Moov, &u32MoovEnd))
+    {
+        SAMPLE_PRT("no moov\n");
+        return HI_FAILURE;
+    }
+    memset(&stTrack, 0, sizeof(stTrack));
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Track(pstCtx, u32Moov, u32MoovEnd, &stTrack))
+    {
+        SAMPLE_PRT("no h264 / h265 video track\n");
+        return HI_FAILURE;
+    }
+    SAMPLE_COMM_VDEC_Mp4Trex(pu8Data, u32Moov, u32MoovEnd, &stTrack);
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Stbl(pstCtx, &stTrack, pstTable, &u64Dts))
+    {
+        return HI_FAILURE;
+    }
+
+    /* the fragments follow the moov, each moof followed by its mdat */
+    while ((HI_TRUE != bCut) && (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Pos, pstCtx->u32Size, &u32Type, &u32Body, &u32Next)))
+    {
+        if (SAMPLE_VDEC_FOURCC('m', 'o', 'o', 'f') == u32Type)
+        {
+            u32Traf = u32Body;
+            while ((HI_TRUE != bCut)
+                   && (HI_SUCCESS == SAMPLE_COMM_VDEC_Mp4Box(pu8Data, u32Traf, u32Next, &u32TrafType, &u32TrafEnd, &u32TrafNext)))
+            {
+                if ((SAMPLE_VDEC_FOURCC('t', 'r', 'a', 'f') == u32TrafType)
+                    && (HI_SUCCESS != SAMPLE_COMM_VDEC_Mp4Traf(pstCtx, &stTrack, u32Pos, u32TrafEnd, u32TrafNext,
+                                                               pstTable, &u64Dts, &bCut)))
+                {
+                    return HI_FAILURE;
+                }
+                u32Traf = u32TrafNext;
+            }
+        }
+        u32Pos = u32Next;
+    }
+    SAMPLE_COMM_VDEC_DemuxPts(pstTable, stTrack.u32Timescale);
+    return HI_SUCCESS;
+}
+
+/* the first packet in sync at or after u32Pos, u32Size if there is none */
+static HI_U32 SAMPLE_COMM_VDEC_TsSync(const SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, HI_U32 u32Pos)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    HI_U32 u32Size = pstCtx->u32Size;
+
+    for (; (u32Pos < u32Size) && (u32Size - u32Pos >= pstCtx->u32PktSize); u32Pos++)
+    {
+        if ((SAMPLE_VDEC_TS_SYNC == pu8Data[u32Pos + pstCtx->u32PktHead])
+            && ((u32Size - u32Pos < pstCtx->u32PktSize * 2)
+                || (SAMPLE_VDEC_TS_SYNC == pu8Data[u32Pos + pstCtx->u32PktSize + pstCtx->u32PktHead])))
+        {
+            return u32Pos;
+        }
+    }
+    return u32Size;
+}
+
+/* the packet after the one at u32Pos, mostly right behind it. A sync byte there alone is not
+   enough after bytes were lost, the search goes on from u32Pos then */
+static HI_U32 SAMPLE_COMM_VDEC_TsNext(const SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, HI_U32 u32Pos)
+{
+    HI_U32 u32Next = u32Pos + pstCtx->u32PktSize;
+    HI_U32 u32Left = pstCtx->u32Size - u32Next;
+
+    if ((pstCtx->u32Size >= u32Next) && (u32Left >= pstCtx->u32PktSize)
+        && (SAMPLE_VDEC_TS_SYNC == pstCtx->pu8Map[u32Next + pstCtx->u32PktHead])
+        && ((u32Left < pstCtx->u32PktSize * 2)
+            || (SAMPLE_VDEC_TS_SYNC == pstCtx->pu8Map[u32Next + pstCtx->u32PktSize + pstCtx->u32PktHead])))
+    {
+        return u32Next;
+    }
+    return SAMPLE_COMM_VDEC_TsSync(pstCtx, u32Pos + 1);
+}
+
+/* pid, payload_unit_start_indicator, random_access_indicator, continuity counter and the payload
+   of a packet, HI_FAILURE for a packet with errors */
+static HI_S32 SAMPLE_COMM_VDEC_TsPacket(const HI_U8 *pu8Pkt, HI_U32 *pu32Pid, HI_BOOL *pbStart, HI_BOOL *pbRai,
+                                        HI_U32 *pu32Cc, HI_U32 *pu32Payload, HI_U32 *pu32Len)
+{
+    HI_U32 u32Afc = (pu8Pkt[3] >> 4) & 0x3;
+    HI_U32 u32Pos = 4;
+
+    if (pu8Pkt[1] & 0x80)
+    {
+        return HI_FAILURE;
+    }
+    *pu32Pid = ((pu8Pkt[1] & 0x1F) << 8) | pu8Pkt[2];
+    *pbStart = (pu8Pkt[1] & 0x40) ? HI_TRUE : HI_FALSE;
+    *pbRai = HI_FALSE;
+    *pu32Cc = pu8Pkt[3] & 0xF;
+    if (u32Afc & 0x2)
+    {
+        if ((pu8Pkt[4] > 0) && (pu8Pkt[5] & 0x40))
+        {
+            *pbRai = HI_TRUE;
+        }
+        u32Pos = 5 + pu8Pkt[4];
+        if (u32Pos > SAMPLE_VDEC_TS_PACKET)
+        {
+            return HI_FAILURE;
+        }
+    }
+    *pu32Payload = u32Pos;
+    *pu32Len = (u32Afc & 0x1) ? SAMPLE_VDEC_TS_PACKET - u32Pos : 0;
+    return HI_SUCCESS;
+}
+
+/* crc32 of mpeg-2 sections, 0 over a whole section with its crc */
+static HI_U32 SAMPLE_COMM_VDEC_TsCrc(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 u32Crc = 0xFFFFFFFF;
+    HI_U32 i, j;
+
+    for (i = 0; i < u32Len; i++)
+    {
+        u32Crc ^= (HI_U32)pu8Data[i] << 24;
+        for (j = 0; j < 8; j++)
+        {
+            u32Crc = (u32Crc & 0x80000000) ? (u32Crc << 1) ^ 0x04C11DB7 : (u32Crc << 1);
+        }
+    }
+    return u32Crc;
+}
+
+/* the section a psi packet starts, NULL if it does not fit the packet or its crc is wrong */
+static const HI_U8 *SAMPLE_COMM_VDEC_TsSection(const HI_U8 *pu8Payload, HI_U32 u32Len, HI_U32 u32TableId, HI_U32 *pu32SecLen)
+{
+    const HI_U8 *pu8Sec;
+    HI_U32 u32SecLen;
+
+    if ((u32Len < 1) || (u32Len - 1 < pu8Payload[0] + 3U))
+    {
+        return NULL;
+    }
+    pu8Sec = pu8Payload + 1 + pu8Payload[0];
+    u32Len -= 1 + pu8Payload[0];
+    u32SecLen = 3 + (((pu8Sec[1] & 0xF) << 8) | pu8Sec[2]);
+    if ((pu8Sec[0] != u32TableId) || (u32SecLen > u32Len) || (u32SecLen < 12)
+        || (0 != SAMPLE_COMM_VDEC_TsCrc(pu8Sec, u32SecLen)))
+    {
+        return NULL;
+    }
+    *pu32SecLen = u32SecLen;
+    return pu8Sec;
+}
+
+/* the start of a pes: the payload after its header and the pts, HI_FAILURE if it is none */
+static HI_S32 SAMPLE_COMM_VDEC_TsPes(const HI_U8 *pu8Payload, HI_U32 u32Len, HI_U32 *pu32Head,
+                                     HI_BOOL *pbPts, HI_U64 *pu64Pts)
+{
+    if ((u32Len < 9) || (0 != pu8Payload[0]) || (0 != pu8Payload[1]) || (1 != pu8Payload[2])
+        || (9 + pu8Payload[8] > u32Len))
+    {
+        return HI_FAILURE;
+    }
+    *pu32Head = 9 + pu8Payload[8];
+    *pbPts = ((pu8Payload[7] & 0x80) && (pu8Payload[8] >= 5)) ? HI_TRUE : HI_FALSE;
+    if (HI_TRUE == *pbPts)
+    {
+        *pu64Pts = ((HI_U64)((pu8Payload[9] >> 1) & 0x7) << 30) | ((HI_U64)pu8Payload[10] << 22)
+                   | ((HI_U64)(pu8Payload[11] >> 1) << 15) | ((HI_U64)pu8Payload[12] << 7) | (pu8Payload[13] >> 1);
+    }
+    return HI_SUCCESS;
+}
+
+/* a key picture or parameter sets among the first bytes of a pes, and the nal type of its first slice */
+static HI_VOID SAMPLE_COMM_VDEC_TsKey(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Data, HI_U32 u32Len, SAMPLE_VDEC_FRAME_S *pstFrame)
+{
+    HI_U32 u32Pos = SAMPLE_COMM_VDEC_FindStartCode(pu8Data, u32Len);
+    HI_U32 u32NalType;
+
+    while (u32Pos + 4 < u32Len)
+    {
+        if (PT_H264 == enType)
+        {
+            u32NalType = pu8Data[u32Pos + 3] & 0x1F;
+            pstFrame->bKey = ((5 == u32NalType) || (7 == u32NalType)) ? HI_TRUE : pstFrame->bKey;
+            if ((1 == u32NalType) || (5 == u32NalType))
+            {
+                pstFrame->u32Type = u32NalType;
+                return;
+            }
+        }
+        else if (SAMPLE_PT_H265 == enType)
+        {
+            u32NalType = (pu8Data[u32Pos + 3] >> 1) & 0x3F;
+            pstFrame->bKey = (((u32NalType >= 16) && (u32NalType <= 23)) || ((u32NalType >= 32) && (u32NalType <= 34)))
+                             ? HI_TRUE : pstFrame->bKey;
+            if (u32NalType < 32)
+            {
+                pstFrame->u32Type = u32NalType;
+                return;
+            }
+        }
+        else
+        {
+            if (0xB6 == pu8Data[u32Pos + 3])
+            {
+                pstFrame->u32Type = pu8Data[u32Pos + 4] >> 6;
+                pstFrame->bKey = (0 == pstFrame->u32Type) ? HI_TRUE : pstFrame->bKey;
+                return;
+            }
+        }
+        u32Pos += 3 + SAMPLE_COMM_VDEC_FindStartCode(pu8Data + u32Pos + 3, u32Len - u32Pos - 3);
+    }
+}
+
+static HI_S32 SAMPLE_COMM_VDEC_TsIndex(SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, SAMPLE_VDEC_DEMUX_TABLE_S *pstTable,
+                                       HI_U64 u64PtsStep)
+{
+    const HI_U8 *pu8Data = pstCtx->pu8Map;
+    const HI_U8 *pu8Pkt;
+    const HI_U8 *pu8Sec;
+    SAMPLE_VDEC_FRAME_S *pstFrame = NULL;
+    HI_U32 u32PmtPid = SAMPLE_VDEC_TS_NO_PID;
+    HI_U32 u32LastCc = 0xFF;
+    HI_U32 u32Pos;
+    HI_U32 u32Pid, u32Cc, u32Payload, u32Len, u32SecLen, u32Head, i;
+    HI_BOOL bStart, bRai, bPts;
+    HI_U64 u64Pts = 0;
+    HI_U64 u64Last = 0;
+    HI_S64 s64Diff;
+
+    pstCtx->u32Pid = SAMPLE_VDEC_TS_NO_PID;
+    for (u32Pos = SAMPLE_COMM_VDEC_TsSync(pstCtx, 0); u32Pos < pstCtx->u32Size; u32Pos = SAMPLE_COMM_VDEC_TsNext(pstCtx, u32Pos))
+    {
+        pu8Pkt = pu8Data + u32Pos + pstCtx->u32PktHead;
+        if (HI_SUCCESS != SAMPLE_COMM_VDEC_TsPacket(pu8Pkt, &u32Pid, &bStart, &bRai, &u32Cc, &u32Payload, &u32Len))
+        {
+            continue;
+        }
+        if (u32Pid == pstCtx->u32Pid)
+        {
+            /* a packet may come twice, with the same continuity counter */
+            if ((0 == u32Len) || (u32Cc == u32LastCc))
+            {
+                continue;
+            }
+            u32LastCc = u32Cc;
+            if (HI_TRUE == bStart)
+            {
+                pstFrame = NULL;
+                if (HI_SUCCESS != SAMPLE_COMM_VDEC_TsPes(pu8Pkt + u32Payload, u32Len, &u32Head, &bPts, &u64Pts))
+                {
+                    continue;
+                }
+                pstFrame = SAMPLE_COMM_VDEC_DemuxAdd(pstTable);
+                if (NULL == pstFrame)
+                {
+                    return HI_FAILURE;
+                }
+                pstFrame->u32Offset = u32Pos;
+                pstFrame->u32Len = u32Len - u32Head;
+                /* 33 bit pts, ahead of or a little behind the last one (b frames) */
+                if (HI_TRUE == bPts)
+                {
+                    if (pstTable->u32Frames > 1)
+                    {
+                        s64Diff = (HI_S64)((u64Pts - u64Last) & (SAMPLE_VDEC_TS_PTS_WRAP - 1));
+                        s64Diff = (s64Diff >= (HI_S64)(SAMPLE_VDEC_TS_PTS_WRAP / 2)) ? s64Diff - (HI_S64)SAMPLE_VDEC_TS_PTS_WRAP : s64Diff;
+                        pstFrame->u64PTS = (HI_U64)((HI_S64)pstFrame[-1].u64PTS + s64Diff);
+                    }
+                    else
+                    {
+                        pstFrame->u64PTS = u64Pts;
+                    }
+                    u64Last = u64Pts;
+                }
+                else
+                {
+                    pstFrame->u64PTS = (pstTable->u32Frames > 1) ? pstFrame[-1].u64PTS + u64PtsStep * 9 / 100 : 0;
+                    u64Last = (u64Last + u64PtsStep * 9 / 100) & (SAMPLE_VDEC_TS_PTS_WRAP - 1);
+                }
+                pstFrame->bKey = bRai;
+                SAMPLE_COMM_VDEC_TsKey(pstCtx->enType, pu8Pkt + u32Payload + u32Head, u32Len - u32Head, pstFrame);
+            }
+            else if (NULL != pstFrame)
+            {
+                pstFrame->u32Len += u32Len;
+                pstFrame->bKey = (HI_TRUE == bRai) ? HI_TRUE : pstFrame->bKey;
+            }
+        }
+        else if ((0 == u32Pid) && (HI_TRUE == bStart) && (SAMPLE_VDEC_TS_NO_PID == u32PmtPid))
+        {
+            pu8Sec = SAMPLE_COMM_VDEC_TsSection(pu8Pkt + u32Payload, u32Len, 0x00, &u32SecLen);
+            /* the first program that is not the network pid */
+            for (i = 8; (NULL != pu8Sec) && (i + 4 + 4 <= u32SecLen); i += 4)
+            {
+                if (0 != SAMPLE_COMM_VDEC_Rd16(pu8Sec + i))
+                {
+                    u32PmtPid = SAMPLE_COMM_VDEC_Rd16(pu8Sec + i + 2) & 0x1FFF;
+                    break;
+                }
+            }
+        }
+        else if ((u32Pid == u32PmtPid) && (HI_TRUE == bStart) && (SAMPLE_VDEC_TS_NO_PID == pstCtx->u32Pid))
+        {
+            pu8Sec = SAMPLE_COMM_VDEC_TsSection(pu8Pkt + u32Payload, u32Len, 0x02, &u32SecLen);
+            if (NULL == pu8Sec)
+            {
+                continue;
+            }
+            /* stream loop after program_info, stream_type 0x1b h264, 0x24 h265, 0x10 mpeg4 */
+            for (i = 12 + (SAMPLE_COMM_VDEC_Rd16(pu8Sec + 10) & 0xFFF); i + 5 + 4 <= u32SecLen;
+                 i += 5 + (SAMPLE_COMM_VDEC_Rd16(pu8Sec + i + 3) & 0xFFF))
+            {
+                if ((0x1B == pu8Sec[i]) || (0x24 == pu8Sec[i]) || (0x10 == pu8Sec[i]))
+                {
+                    pstCtx->enType = (0x1B == pu8Sec[i]) ? PT_H264 : ((0x24 == pu8Sec[i]) ? SAMPLE_PT_H265 : PT_MP4VIDEO);
+                    pstCtx->u32Pid = SAMPLE_COMM_VDEC_Rd16(pu8Sec + i + 1) & 0x1FFF;
+                    break;
+                }
+            }
+        }
+    }
+    if (SAMPLE_VDEC_TS_NO_PID == pstCtx->u32Pid)
+    {
+        SAMPLE_PRT("no h264 / h265 / mpeg4 stream in the pmt\n");
+        return HI_FAILURE;
+    }
+    SAMPLE_COMM_VDEC_DemuxPts(pstTable, 90000);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : index the mp4 or ts file mapped at pu8Map (from mmap) for a channel.
+*            *penType is the payload of the video track or stream, *ppstFrame
+*            its access units, malloced and freed by the caller after
+*            SAMPLE_COMM_VDEC_DemuxClose. u64PtsStep stands in for a missing pts
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_DemuxOpen(VDEC_CHN VdChn, HI_U8 *pu8Map, HI_U32 u32Size, HI_U64 u64PtsStep,
+                                  PAYLOAD_TYPE_E *penType, SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Frames)
+{
+    SAMPLE_VDEC_DEMUX_CTX_S *pstCtx;
+    SAMPLE_VDEC_DEMUX_TABLE_S stTable;
+    HI_U32 u32MaxLen = 0;
+    HI_S32 s32Ret;
+    HI_U32 i;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pu8Map) || (NULL == penType)
+        || (NULL == ppstFrame) || (NULL == pu32Frames) || (HI_TRUE == gs_astVdecDemux[VdChn].bOpen))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astVdecDemux[VdChn];
+    memset(pstCtx, 0, sizeof(SAMPLE_VDEC_DEMUX_CTX_S));
+    memset(&stTable, 0, sizeof(stTable));
+    pstCtx->enContainer = SAMPLE_COMM_VDEC_DemuxProbe(pu8Map, u32Size);
+    pstCtx->pu8Map = pu8Map;
+    pstCtx->u32Size = u32Size;
+
+    if (SAMPLE_VDEC_CONTAINER_MP4 == pstCtx->enContainer)
+    {
+        s32Ret = SAMPLE_COMM_VDEC_Mp4Index(pstCtx, &stTable);
+    }
+    else if (SAMPLE_VDEC_CONTAINER_TS == pstCtx->enContainer)
+    {
+        pstCtx->u32PktHead = (SAMPLE_VDEC_TS_SYNC == pu8Map[0]) ? 0 : 4;
+        pstCtx->u32PktSize = SAMPLE_VDEC_TS_PACKET + pstCtx->u32PktHead;
+        (HI_VOID)madvise(pu8Map, u32Size, MADV_SEQUENTIAL);
+        s32Ret = SAMPLE_COMM_VDEC_TsIndex(pstCtx, &stTable, u64PtsStep);
+        (HI_VOID)madvise(pu8Map, u32Size, MADV_NORMAL);
+    }
+    else
+    {
+        SAMPLE_PRT("neither mp4 nor ts\n");
+        return HI_FAILURE;
+    }
+    if ((HI_SUCCESS != s32Ret) || (0 == stTable.u32Frames))
+    {
+        free(stTable.pstFrame);
+        return HI_FAILURE;
+    }
+
+    for (i = 0; i < stTable.u32Frames; i++)
+    {
+        u32MaxLen = MAX2(u32MaxLen, stTable.pstFrame[i].u32Len);
+    }
+    if (SAMPLE_VDEC_CONTAINER_MP4 == pstCtx->enContainer)
+    {
+        /* 4 byte lengths keep the size, 1 byte ones grow most: a nal of a byte becomes 5, empty ones are left out */
+        pstCtx->u32BufSize = pstCtx->u32ParamLen + ((4 == pstCtx->u32NalLenSize) ? u32MaxLen : u32MaxLen * 3);
+    }
+    else
+    {
+        pstCtx->u32BufSize = u32MaxLen;
+    }
+    pstCtx->pu8Buf = (HI_U8 *)malloc(pstCtx->u32BufSize);
+    if (NULL == pstCtx->pu8Buf)
+    {
+        SAMPLE_PRT("malloc demux buffer failed!\n");
+        free(stTable.pstFrame);
+        return HI_FAILURE;
+    }
+
+    pstCtx->pstFrame = stTable.pstFrame;
+    pstCtx->u32Frames = stTable.u32Frames;
+    pstCtx->bOpen = HI_TRUE;
+    *penType = pstCtx->enType;
+    *ppstFrame = stTable.pstFrame;
+    *pu32Frames = stTable.u32Frames;
+    return HI_SUCCESS;
+}
+
+/* a sample as start code nals, copied behind what is in the buffer */
+static HI_U32 SAMPLE_COMM_VDEC_Mp4Sample(const SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, HI_U32 u32Frame, HI_U8 *pu8Out)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame = &pstCtx->pstFrame[u32Frame];
+    const HI_U8 *pu8Src = pstCtx->pu8Map + pstFrame->u32Offset;
+    HI_U32 u32Size = pstCtx->u32NalLenSize;
+    HI_U32 u32Pos = 0;
+    HI_U32 u32Out = 0;
+    HI_U32 u32Nal;
+    HI_U32 i;
+
+    while (pstFrame->u32Len - u32Pos >= u32Size)
+    {
+        for (u32Nal = 0, i = 0; i < u32Size; i++)
+        {
+            u32Nal = (u32Nal << 8) | pu8Src[u32Pos + i];
+        }
+        if (u32Nal > pstFrame->u32Len - u32Pos - u32Size)
+        {
+            break;
+        }
+        if (0 != u32Nal)
+        {
+            memcpy(pu8Out + u32Out, "\x00\x00\x00\x01", 4);
+            memcpy(pu8Out + u32Out + 4, pu8Src + u32Pos + u32Size, u32Nal);
+            u32Out += 4 + u32Nal;
+        }
+        u32Pos += u32Size + u32Nal;
+    }
+    return u32Out;
+}
+
+/* the payload of a pes from the packets it is spread over */
+static HI_U32 SAMPLE_COMM_VDEC_TsFrame(const SAMPLE_VDEC_DEMUX_CTX_S *pstCtx, HI_U32 u32Frame, HI_U8 *pu8Out)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame = &pstCtx->pstFrame[u32Frame];
+    const HI_U8 *pu8Pkt;
+    HI_U32 u32Pos = pstFrame->u32Offset;
+    HI_U32 u32Out = 0;
+    HI_U32 u32LastCc = 0xFF;
+    HI_U32 u32Pid, u32Cc, u32Payload, u32Len, u32Head;
+    HI_BOOL bStart, bRai, bPts;
+    HI_U64 u64Pts;
+
+    for (; (u32Out < pstFrame->u32Len) && (u32Pos < pstCtx->u32Size); u32Pos = SAMPLE_COMM_VDEC_TsNext(pstCtx, u32Pos))
+    {
+        pu8Pkt = pstCtx->pu8Map + u32Pos + pstCtx->u32PktHead;
+        if ((HI_SUCCESS != SAMPLE_COMM_VDEC_TsPacket(pu8Pkt, &u32Pid, &bStart, &bRai, &u32Cc, &u32Payload, &u32Len))
+            || (u32Pid != pstCtx->u32Pid) || (0 == u32Len) || (u32Cc == u32LastCc))
+        {
+            continue;
+        }
+        u32LastCc = u32Cc;
+        if (0 == u32Out)
+        {
+            (HI_VOID)SAMPLE_COMM_VDEC_TsPes(pu8Pkt + u32Payload, u32Len, &u32Head, &bPts, &u64Pts);
+            u32Payload += u32Head;
+            u32Len -= u32Head;
+        }
+        else if (HI_TRUE == bStart)
+        {
+            break;
+        }
+        u32Len = MIN2(u32Len, pstFrame->u32Len - u32Out);
+        memcpy(pu8Out + u32Out, pu8Pkt + u32Payload, u32Len);
+        u32Out += u32Len;
+    }
+    return u32Out;
+}
+
+/******************************************************************************
+* funciton : access unit u32Frame as start code nals in a frame mode
+*            VDEC_STREAM_S. It points into the channel's buffer until the
+*            next call, the mapping is only read
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_DemuxGetFrame(VDEC_CHN VdChn, HI_U32 u32Frame, VDEC_STREAM_S *pstStream)
+{
+    SAMPLE_VDEC_DEMUX_CTX_S *pstCtx;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Param;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstStream)
+        || (HI_TRUE != gs_astVdecDemux[VdChn].bOpen) || (u32Frame >= gs_astVdecDemux[VdChn].u32Frames))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astVdecDemux[VdChn];
+    pstFrame = &pstCtx->pstFrame[u32Frame];
+
+    if (SAMPLE_VDEC_CONTAINER_MP4 == pstCtx->enContainer)
+    {
+        u32Param = (HI_TRUE == pstFrame->bKey) ? pstCtx->u32ParamLen : 0;
+        pstStream->u32Len = SAMPLE_COMM_VDEC_Mp4Sample(pstCtx, u32Frame, pstCtx->pu8Buf + u32Param) + u32Param;
+        memcpy(pstCtx->pu8Buf, pstCtx->au8Param, u32Param);
+        pstStream->pu8Addr = pstCtx->pu8Buf;
+    }
+    else
+    {
+        pstStream->u32Len = SAMPLE_COMM_VDEC_TsFrame(pstCtx, u32Frame, pstCtx->pu8Buf);
+        pstStream->pu8Addr = pstCtx->pu8Buf;
+    }
+    pstStream->u64PTS = pstFrame->u64PTS;
+    pstStream->bEndOfFrame = HI_TRUE;
+    pstStream->bEndOfStream = HI_FALSE;
+    return HI_SUCCESS;
+}
+
+HI_VOID SAMPLE_COMM_VDEC_DemuxClose(VDEC_CHN VdChn)
+{
+    SAMPLE_VDEC_DEMUX_CTX_S *pstCtx;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE != gs_astVdecDemux[VdChn].bOpen))
+    {
+        return;
+    }
+    pstCtx = &gs_astVdecDemux[VdChn];
+    free(pstCtx->pu8Buf);
+    pstCtx->pu8Buf = NULL;
+    pstCtx->pstFrame = NULL;
+    pstCtx->bOpen = HI_FALSE;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,503 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: vdec feeder, a few threads sending the streams of all channels.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-5 Created
+******************************************************************************/
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "sample_comm.h"
+
+/*
+ * SAMPLE_COMM_VDEC_StartSendStream gives every channel a thread that sleeps
+ * 20ms a frame and spins on usleep(100) while the decoder is full. Here a
+ * channel is a frame index from the mmap stream source and the time its next
+ * frame is due: u64PtsInit + the pts of the frame, played from when it was
+ * started, resumed or its speed changed. A feeder thread sends what is due on
+ * its channels and sleeps on its condition until the next frame is due or a
+ * control wakes it.
+ *
+ * The decoder gives no event when it has room again, so a channel it has no
+ * room for is tried again after SAMPLE_VDEC_FEEDER_RETRY_US. The threads also
+ * wake every SAMPLE_VDEC_FEEDER_MAX_WAIT_US to see eCtrlSinal of
+ * VdecThreadParam, so SAMPLE_COMM_VDEC_CmdCtrl works as with the send threads.
+ */
+#define SAMPLE_VDEC_FEEDER_RETRY_US     5000
+#define SAMPLE_VDEC_FEEDER_MAX_WAIT_US  100000
+/* frames the decoder may have waiting before it is fed more */
+#define SAMPLE_VDEC_FEEDER_LEFT_FRAMES  8
+
+typedef struct sample_vdec_feeder_chn_s
+{
+    HI_BOOL bUsed;
+    HI_S32 s32Thread;
+    VdecThreadParam *pstParam;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Frames;
+    HI_U32 u32BufSize;                  /* stream buffer of the channel, 0 if unknown */
+    HI_U64 u64FrameUs;                  /* average frame time of the stream */
+
+    HI_U32 u32Next;                     /* frame to send next */
+    HI_U64 u64LoopBase;                 /* stream time of frame 0 in this loop */
+    HI_U64 u64AnchorUs;                 /* clock and stream time the pacing counts from */
+    HI_U64 u64AnchorPts;
+    HI_U64 u64PacePts;                  /* latest stream time sent up to, see SAMPLE_COMM_VDEC_FeederSetDue */
+    HI_U64 u64DueUs;
+
+    HI_BOOL bPause;
+    HI_BOOL bPaused;                    /* by bPause or VDEC_CTRL_PAUSE */
+    HI_BOOL bRetime;
+    HI_U32 u32Step;
+    HI_U32 u32Percent;
+
+    SAMPLE_VDEC_FEEDER_STAT_S stStat;
+}SAMPLE_VDEC_FEEDER_CHN_S;
+
+typedef struct sample_vdec_feeder_thread_s
+{
+    pthread_t tid;
+    HI_S32 s32Index;
+    pthread_cond_t cond;
+}SAMPLE_VDEC_FEEDER_THREAD_S;
+
+static SAMPLE_VDEC_FEEDER_CHN_S gs_astVdecFeederChn[VDEC_MAX_CHN_NUM];
+static SAMPLE_VDEC_FEEDER_THREAD_S gs_astVdecFeederThread[SAMPLE_VDEC_FEEDER_MAX_THREAD];
+static HI_S32 gs_s32VdecFeederThreads = 0;
+static HI_BOOL gs_bVdecFeederRun = HI_FALSE;
+static pthread_mutex_t gs_VdecFeederMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static HI_U64 SAMPLE_COMM_VDEC_FeederUs(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+/* time of frame u32Frame in the stream as played, loops included */
+static HI_U64 SAMPLE_COMM_VDEC_FeederStreamUs(const SAMPLE_VDEC_FEEDER_CHN_S *pstChn, HI_U32 u32Frame)
+{
+    return pstChn->u64LoopBase + pstChn->pstFrame[u32Frame].u64PTS - pstChn->pstFrame[0].u64PTS;
+}
+
+/* pts in decode order go back at b frames: they are due with the frame before them that is shown after them */
+static HI_VOID SAMPLE_COMM_VDEC_FeederSetDue(SAMPLE_VDEC_FEEDER_CHN_S *pstChn)
+{
+    pstChn->u64PacePts = MAX2(pstChn->u64PacePts, SAMPLE_COMM_VDEC_FeederStreamUs(pstChn, pstChn->u32Next));
+    pstChn->u64DueUs = pstChn->u64AnchorUs + (pstChn->u64PacePts - pstChn->u64AnchorPts) * 100 / pstChn->u32Percent;
+}
+
+/* the decoder takes a frame of u32Len if it has few frames waiting and the bytes fit its buffer */
+static HI_BOOL SAMPLE_COMM_VDEC_FeederRoom(VDEC_CHN VdChn, HI_U32 u32BufSize, HI_U32 u32Len)
+{
+    VDEC_CHN_STAT_S stStat;
+
+    if (HI_SUCCESS != HI_MPI_VDEC_Query(VdChn, &stStat))
+    {
+        return HI_TRUE;
+    }
+    if (stStat.u32LeftStreamFrames >= SAMPLE_VDEC_FEEDER_LEFT_FRAMES)
+    {
+        return HI_FALSE;
+    }
+    if ((0 != u32BufSize) && (stStat.u32LeftStreamBytes + u32Len > u32BufSize))
+    {
+        return HI_FALSE;
+    }
+    return HI_TRUE;
+}
+
+/* called with gs_VdecFeederMutex held, returns it held */
+static HI_VOID SAMPLE_COMM_VDEC_FeederEnd(SAMPLE_VDEC_FEEDER_CHN_S *pstChn)
+{
+    VDEC_STREAM_S stStream;
+
+    pstChn->stStat.bEnd = HI_TRUE;
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+    memset(&stStream, 0, sizeof(VDEC_STREAM_S));
+    stStream.bEndOfStream = HI_TRUE;
+    HI_MPI_VDEC_SendStream(pstChn->pstParam->s32ChnId, &stStream, -1);
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+}
+
+/* sends what is due on one channel, returns how long it may sleep for it */
+static HI_U64 SAMPLE_COMM_VDEC_FeederService(SAMPLE_VDEC_FEEDER_CHN_S *pstChn)
+{
+    VdecThreadParam *pstParam = pstChn->pstParam;
+    VDEC_STREAM_S stStream;
+    HI_BOOL bPause;
+    HI_BOOL bStep;
+    HI_BOOL bSent;
+    HI_U64 u64Now;
+    HI_U64 u64Late;
+    HI_U32 u32Frame;
+
+    while (1)
+    {
+        if (HI_TRUE == pstChn->stStat.bEnd)
+        {
+            return SAMPLE_VDEC_FEEDER_MAX_WAIT_US;
+        }
+        if (VDEC_CTRL_STOP == pstParam->eCtrlSinal)
+        {
+            SAMPLE_COMM_VDEC_FeederEnd(pstChn);
+            return SAMPLE_VDEC_FEEDER_MAX_WAIT_US;
+        }
+
+        u64Now = SAMPLE_COMM_VDEC_FeederUs();
+        bPause = ((HI_TRUE == pstChn->bPause) || (VDEC_CTRL_PAUSE == pstParam->eCtrlSinal)) ? HI_TRUE : HI_FALSE;
+        if (HI_TRUE == bPause)
+        {
+            pstChn->bPaused = HI_TRUE;
+            if (0 == pstChn->u32Step)
+            {
+                return SAMPLE_VDEC_FEEDER_MAX_WAIT_US;
+            }
+        }
+        else if (HI_TRUE == pstChn->bPaused)
+        {
+            pstChn->bPaused = HI_FALSE;
+            pstChn->bRetime = HI_TRUE;
+        }
+        if (HI_TRUE == pstChn->bRetime)
+        {
+            pstChn->u64AnchorUs = u64Now;
+            pstChn->u64PacePts = MAX2(pstChn->u64PacePts, SAMPLE_COMM_VDEC_FeederStreamUs(pstChn, pstChn->u32Next));
+            pstChn->u64AnchorPts = pstChn->u64PacePts;
+            pstChn->u64DueUs = u64Now;
+            pstChn->bRetime = HI_FALSE;
+        }
+        bStep = bPause;
+        if ((HI_TRUE != bStep) && (pstChn->u64DueUs > u64Now))
+        {
+            return pstChn->u64DueUs - u64Now;
+        }
+
+        u32Frame = pstChn->u32Next;
+        (HI_VOID)SAMPLE_COMM_VDEC_SourceGetFrame(pstParam->s32ChnId, u32Frame, &stStream);
+        stStream.u64PTS = pstParam->u64PtsInit + SAMPLE_COMM_VDEC_FeederStreamUs(pstChn, u32Frame);
+
+        /* no lock around the mpi calls, the controls only set flags this thread looks at */
+        pthread_mutex_unlock(&gs_VdecFeederMutex);
+        bSent = SAMPLE_COMM_VDEC_FeederRoom(pstParam->s32ChnId, pstChn->u32BufSize, stStream.u32Len);
+        if (HI_TRUE == bSent)
+        {
+            bSent = (HI_SUCCESS == HI_MPI_VDEC_SendStream(pstParam->s32ChnId, &stStream, 0)) ? HI_TRUE : HI_FALSE;
+        }
+        pthread_mutex_lock(&gs_VdecFeederMutex);
+        u64Now = SAMPLE_COMM_VDEC_FeederUs();
+
+        if (HI_TRUE != bSent)
+        {
+            pstChn->stStat.u32Overflow++;
+            return SAMPLE_VDEC_FEEDER_RETRY_US;
+        }
+        pstChn->stStat.u64Frames++;
+        pstChn->stStat.u64Bytes += stStream.u32Len;
+        if (HI_TRUE == bStep)
+        {
+            /* a resume while the lock was let go has dropped the steps */
+            pstChn->u32Step = (pstChn->u32Step > 0) ? pstChn->u32Step - 1 : 0;
+        }
+        else if (u64Now > pstChn->u64DueUs)
+        {
+            u64Late = u64Now - pstChn->u64DueUs;
+            pstChn->stStat.u32MaxLateUs = MAX2(pstChn->stStat.u32MaxLateUs, (HI_U32)u64Late);
+            if (u64Late * pstChn->u32Percent > pstChn->u64FrameUs * 100)
+            {
+                pstChn->stStat.u32Underflow++;
+            }
+        }
+
+        pstChn->u32Next++;
+        if (pstChn->u32Next >= pstChn->u32Frames)
+        {
+            if (!pstParam->bLoopSend)
+            {
+                SAMPLE_COMM_VDEC_FeederEnd(pstChn);
+                return SAMPLE_VDEC_FEEDER_MAX_WAIT_US;
+            }
+            pstChn->u64LoopBase = pstChn->u64PacePts + pstChn->u64FrameUs;
+            pstChn->u32Next = 0;
+        }
+        SAMPLE_COMM_VDEC_FeederSetDue(pstChn);
+    }
+}
+
+static HI_VOID * SAMPLE_COMM_VDEC_FeederProc(HI_VOID *pArgs)
+{
+    SAMPLE_VDEC_FEEDER_THREAD_S *pstThread = (SAMPLE_VDEC_FEEDER_THREAD_S *)pArgs;
+    struct timespec stTs;
+    HI_U64 u64Wait;
+    HI_U64 u64Until;
+    HI_S32 i;
+
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+    while (HI_TRUE == gs_bVdecFeederRun)
+    {
+        u64Wait = SAMPLE_VDEC_FEEDER_MAX_WAIT_US;
+        for (i = pstThread->s32Index; i < VDEC_MAX_CHN_NUM; i += gs_s32VdecFeederThreads)
+        {
+            if (HI_TRUE == gs_astVdecFeederChn[i].bUsed)
+            {
+                u64Wait = MIN2(u64Wait, SAMPLE_COMM_VDEC_FeederService(&gs_astVdecFeederChn[i]));
+            }
+        }
+        if (HI_TRUE != gs_bVdecFeederRun)
+        {
+            break;
+        }
+        u64Until = SAMPLE_COMM_VDEC_FeederUs() + u64Wait;
+        stTs.tv_sec = u64Until / 1000000;
+        stTs.tv_nsec = (u64Until % 1000000) * 1000;
+        (HI_VOID)pthread_cond_timedwait(&pstThread->cond, &gs_VdecFeederMutex, &stTs);
+    }
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+
+    return NULL;
+}
+
+static HI_VOID SAMPLE_COMM_VDEC_FeederWake(VDEC_CHN VdChn)
+{
+    pthread_cond_signal(&gs_astVdecFeederThread[gs_astVdecFeederChn[VdChn].s32Thread].cond);
+}
+
+/******************************************************************************
+* funciton : send the streams of s32ChnNum channels from s32Threads threads,
+*            paced by the pts of their frames. Takes the VdecThreadParam of
+*            SAMPLE_COMM_VDEC_StartSendStream in frame mode, the files are
+*            opened with SAMPLE_COMM_VDEC_SourceOpen and must be h264, h265
+*            or mpeg4, or an mp4 / ts of them. s32MilliSec is not used, sends
+*            never block
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_FeederStart(HI_S32 s32ChnNum, VdecThreadParam *pstVdecSend, HI_S32 s32Threads)
+{
+    SAMPLE_VDEC_FEEDER_CHN_S *pstChn;
+    VDEC_CHN_ATTR_S stAttr;
+    pthread_condattr_t condattr;
+    VDEC_CHN VdChn;
+    HI_S32 i;
+
+    if ((s32ChnNum <= 0) || (s32ChnNum > VDEC_MAX_CHN_NUM) || (NULL == pstVdecSend)
+        || (s32Threads <= 0) || (s32Threads > SAMPLE_VDEC_FEEDER_MAX_THREAD))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    if (HI_TRUE == gs_bVdecFeederRun)
+    {
+        SAMPLE_PRT("feeder is running already\n");
+        return HI_FAILURE;
+    }
+    s32Threads = MIN2(s32Threads, s32ChnNum);
+
+    memset(gs_astVdecFeederChn, 0, sizeof(gs_astVdecFeederChn));
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        VdChn = pstVdecSend[i].s32ChnId;
+        if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE == gs_astVdecFeederChn[VdChn].bUsed)
+            || (VIDEO_MODE_FRAME != pstVdecSend[i].s32StreamMode))
+        {
+            SAMPLE_PRT("chn %d: the feeder needs distinct channels in frame mode\n", VdChn);
+            goto FAIL;
+        }
+        pstChn = &gs_astVdecFeederChn[VdChn];
+        if (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceOpen(VdChn, pstVdecSend[i].cFileName, pstVdecSend[i].enType,
+                                                      pstVdecSend[i].u64PtsIncrease))
+        {
+            goto FAIL;
+        }
+        pstChn->bUsed = HI_TRUE;
+        if ((HI_SUCCESS != SAMPLE_COMM_VDEC_SourceGetIndex(VdChn, &pstChn->pstFrame, &pstChn->u32Frames))
+            || (0 == pstChn->u32Frames))
+        {
+            SAMPLE_PRT("chn %d: no access units in %s\n", VdChn, pstVdecSend[i].cFileName);
+            goto FAIL;
+        }
+        pstChn->s32Thread = VdChn % s32Threads;
+        pstChn->pstParam = &pstVdecSend[i];
+        pstChn->u32BufSize = (HI_SUCCESS == HI_MPI_VDEC_GetChnAttr(VdChn, &stAttr)) ? stAttr.u32BufSize : 0;
+        pstChn->u64FrameUs = (pstChn->u32Frames > 1)
+                             ? (pstChn->pstFrame[pstChn->u32Frames - 1].u64PTS - pstChn->pstFrame[0].u64PTS)
+                               / (pstChn->u32Frames - 1)
+                             : pstVdecSend[i].u64PtsIncrease;
+        pstChn->u32Percent = 100;
+        pstChn->bRetime = HI_TRUE;
+    }
+
+    pthread_condattr_init(&condattr);
+    pthread_condattr_setclock(&condattr, CLOCK_MONOTONIC);
+    gs_s32VdecFeederThreads = s32Threads;
+    gs_bVdecFeederRun = HI_TRUE;
+    for (i = 0; i < s32Threads; i++)
+    {
+        gs_astVdecFeederThread[i].s32Index = i;
+        pthread_cond_init(&gs_astVdecFeederThread[i].cond, &condattr);
+    }
+    pthread_condattr_destroy(&condattr);
+    for (i = 0; i < s32Threads; i++)
+    {
+        pthread_create(&gs_astVdecFeederThread[i].tid, 0, SAMPLE_COMM_VDEC_FeederProc,
+                       (HI_VOID *)&gs_astVdecFeederThread[i]);
+    }
+    return HI_SUCCESS;
+
+FAIL:
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        if (HI_TRUE == gs_astVdecFeederChn[i].bUsed)
+        {
+            SAMPLE_COMM_VDEC_SourceClose(i);
+            gs_astVdecFeederChn[i].bUsed = HI_FALSE;
+        }
+    }
+    return HI_FAILURE;
+}
+
+static SAMPLE_VDEC_FEEDER_CHN_S *SAMPLE_COMM_VDEC_FeederChn(VDEC_CHN VdChn)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE != gs_astVdecFeederChn[VdChn].bUsed))
+    {
+        SAMPLE_PRT("chn %d is not fed\n", VdChn);
+        return NULL;
+    }
+    return &gs_astVdecFeederChn[VdChn];
+}
+
+/******************************************************************************
+* funciton : pause or resume a channel, it goes on at the pace of its pts
+*            from where it was
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_FeederPause(VDEC_CHN VdChn, HI_BOOL bPause)
+{
+    SAMPLE_VDEC_FEEDER_CHN_S *pstChn = SAMPLE_COMM_VDEC_FeederChn(VdChn);
+
+    if (NULL == pstChn)
+    {
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+    pstChn->bPause = bPause;
+    pstChn->u32Step = 0;
+    SAMPLE_COMM_VDEC_FeederWake(VdChn);
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : send the next frame of a paused channel
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_FeederStep(VDEC_CHN VdChn)
+{
+    SAMPLE_VDEC_FEEDER_CHN_S *pstChn = SAMPLE_COMM_VDEC_FeederChn(VdChn);
+
+    if (NULL == pstChn)
+    {
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+    if (HI_TRUE != pstChn->bPause)
+    {
+        pthread_mutex_unlock(&gs_VdecFeederMutex);
+        SAMPLE_PRT("chn %d: pause it before stepping\n", VdChn);
+        return HI_FAILURE;
+    }
+    pstChn->u32Step++;
+    SAMPLE_COMM_VDEC_FeederWake(VdChn);
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : play a channel at u32Percent of its pts pace, 25 to 800
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_FeederSetSpeed(VDEC_CHN VdChn, HI_U32 u32Percent)
+{
+    SAMPLE_VDEC_FEEDER_CHN_S *pstChn = SAMPLE_COMM_VDEC_FeederChn(VdChn);
+
+    if ((NULL == pstChn) || (u32Percent < 25) || (u32Percent > 100 * SAMPLE_VDEC_SPEED_MAX))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+    pstChn->u32Percent = u32Percent;
+    pstChn->bRetime = HI_TRUE;
+    SAMPLE_COMM_VDEC_FeederWake(VdChn);
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+    return HI_SUCCESS;
+}
+
+HI_S32 SAMPLE_COMM_VDEC_FeederGetStat(VDEC_CHN VdChn, SAMPLE_VDEC_FEEDER_STAT_S *pstStat)
+{
+    SAMPLE_VDEC_FEEDER_CHN_S *pstChn = SAMPLE_COMM_VDEC_FeederChn(VdChn);
+
+    if ((NULL == pstChn) || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+    memcpy(pstStat, &pstChn->stStat, sizeof(SAMPLE_VDEC_FEEDER_STAT_S));
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : stop the feeder threads, channels not at their end get the end of
+*            stream as with SAMPLE_COMM_VDEC_StopSendStream
+******************************************************************************/
+HI_VOID SAMPLE_COMM_VDEC_FeederStop(HI_VOID)
+{
+    VDEC_STREAM_S stStream;
+    HI_S32 i;
+
+    if (HI_TRUE != gs_bVdecFeederRun)
+    {
+        return;
+    }
+    pthread_mutex_lock(&gs_VdecFeederMutex);
+    gs_bVdecFeederRun = HI_FALSE;
+    for (i = 0; i < gs_s32VdecFeederThreads; i++)
+    {
+        pthread_cond_signal(&gs_astVdecFeederThread[i].cond);
+    }
+    pthread_mutex_unlock(&gs_VdecFeederMutex);
+    for (i = 0; i < gs_s32VdecFeederThreads; i++)
+    {
+        pthread_join(gs_astVdecFeederThread[i].tid, 0);
+        pthread_cond_destroy(&gs_astVdecFeederThread[i].cond);
+    }
+
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        if (HI_TRUE != gs_astVdecFeederChn[i].bUsed)
+        {
+            continue;
+        }
+        if (HI_TRUE != gs_astVdecFeederChn[i].stStat.bEnd)
+        {
+            memset(&stStream, 0, sizeof(VDEC_STREAM_S));
+            stStream.bEndOfStream = HI_TRUE;
+            HI_MPI_VDEC_SendStream(i, &stStream, -1);
+            gs_astVdecFeederChn[i].stStat.bEnd = HI_TRUE;
+        }
+        SAMPLE_COMM_VDEC_SourceClose(i);
+    }
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
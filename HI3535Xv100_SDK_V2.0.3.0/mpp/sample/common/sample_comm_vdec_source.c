@@ -0,0 +1,920 @@
+/******************************************************************************
+  Hisilicon Hi35xx sample programs: memory mapped elementary stream source for vdec.
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+ ******************************************************************************
+    Modification:  2016-5 Created
+******************************************************************************/
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "sample_comm.h"
+
+/*
+ * The stream file is mapped once and split into access units in one pass
+ * over the mapping. Frames are then sent straight from the mapping, nothing
+ * is read twice or copied before HI_MPI_VDEC_SendStream.
+ *
+ * A start code needs a zero byte, so the scanner skips words (NEON: 16 byte
+ * vectors) with no zero byte in them and only looks at the bytes of the
+ * others.
+ *
+ * The index is kept in "<stream>.idx" next to the stream: a head and one
+ * SAMPLE_VDEC_FRAME_S per access unit, in the byte order of the board. The
+ * recorder appends to it as it writes the stream, SAMPLE_COMM_VDEC_SourceOpen
+ * reads it instead of scanning and writes it when it had to scan. For seek
+ * and trick play every frame knows how many key frames are up to it, so the
+ * key frame before or after a frame is one lookup.
+ *
+ * An mp4 or ts file is indexed by sample_comm_vdec_demux.c instead, from
+ * the container, and its frames are fetched from there as start code nals.
+ */
+#define SAMPLE_VDEC_NAL_OTHER       0   /* stays in the access unit it is in */
+#define SAMPLE_VDEC_NAL_PREFIX      1   /* parameter set, sei, aud ...: opens a new access unit after a picture */
+#define SAMPLE_VDEC_NAL_PIC         2   /* a slice, opens a new access unit if it is the first of its picture */
+
+#define SAMPLE_VDEC_INDEX_MAGIC     0x58444948      /* "HIDX" */
+#define SAMPLE_VDEC_INDEX_VERSION   1
+#define SAMPLE_VDEC_INDEX_NAME_LEN  256
+/* wait between frames when sending, as SAMPLE_COMM_VDEC_SendStream */
+#define SAMPLE_VDEC_SEND_INTERVAL   20000
+
+typedef struct sample_vdec_index_head_s
+{
+    HI_U32 u32Magic;
+    HI_U32 u32Version;
+    HI_U32 u32Type;                     /* PAYLOAD_TYPE_E of the stream */
+    HI_U32 u32RecordLen;                /* sizeof(SAMPLE_VDEC_FRAME_S) of the writer */
+}SAMPLE_VDEC_INDEX_HEAD_S;
+
+typedef struct sample_vdec_source_ctx_s
+{
+    HI_BOOL bOpen;
+    PAYLOAD_TYPE_E enType;
+    HI_U8 *pu8Map;
+    HI_U32 u32Size;
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Frames;
+    HI_U32 *pu32KeyCnt;                 /* per frame: key frames up to and with it */
+    HI_U32 *pu32Key;                    /* frame numbers of the key frames */
+    HI_U32 u32Keys;
+    HI_BOOL bSidecar;                   /* the index came from the .idx file */
+    HI_BOOL bDemux;                     /* an mp4 or ts, SAMPLE_COMM_VDEC_DemuxGetFrame gives the frames */
+    HI_BOOL bSeek;                      /* u32SeekFrame is where the sender goes on, under gs_VdecSourceMutex */
+    HI_U32 u32SeekFrame;
+    HI_U32 u32Speed;
+}SAMPLE_VDEC_SOURCE_CTX_S;
+
+static SAMPLE_VDEC_SOURCE_CTX_S gs_astVdecSource[VDEC_MAX_CHN_NUM];
+static pthread_mutex_t gs_VdecSourceMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static HI_U32 SAMPLE_COMM_VDEC_ByteStartCode(const HI_U8 *pu8Data, HI_U32 u32From, HI_U32 u32To, HI_U32 u32Len)
+{
+    HI_U32 i;
+
+    for (i = u32From; (i < u32To) && (i + 2 < u32Len); i++)
+    {
+        if ((0 == pu8Data[i]) && (0 == pu8Data[i + 1]) && (1 == pu8Data[i + 2]))
+        {
+            return i;
+        }
+    }
+    return u32Len;
+}
+
+/******************************************************************************
+* funciton : offset of the first 00 00 01 in the data, u32Len if there is none
+******************************************************************************/
+HI_U32 SAMPLE_COMM_VDEC_FindStartCode(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 i = 0;
+    HI_U32 u32Pos;
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+    uint8x16_t vData;
+    uint8x8_t vOr;
+
+    for (; i + 16 <= u32Len; i += 16)
+    {
+        vData = vceqq_u8(vld1q_u8(pu8Data + i), vdupq_n_u8(0));
+        vOr = vorr_u8(vget_low_u8(vData), vget_high_u8(vData));
+        if (0 == vget_lane_u64(vreinterpret_u64_u8(vOr), 0))
+        {
+            continue;
+        }
+        u32Pos = SAMPLE_COMM_VDEC_ByteStartCode(pu8Data, i, i + 16, u32Len);
+        if (u32Pos < u32Len)
+        {
+            return u32Pos;
+        }
+    }
+#else
+    HI_U32 au32Word[2];
+
+    /* two words a step, a word has a zero byte when (w - 0x01..) & ~w & 0x80.. is not 0 */
+    for (; i + 8 <= u32Len; i += 8)
+    {
+        memcpy(au32Word, pu8Data + i, 8);
+        if (0 == ((((au32Word[0] - 0x01010101) & ~au32Word[0]) | ((au32Word[1] - 0x01010101) & ~au32Word[1]))
+                  & 0x80808080))
+        {
+            continue;
+        }
+        u32Pos = SAMPLE_COMM_VDEC_ByteStartCode(pu8Data, i, i + 8, u32Len);
+        if (u32Pos < u32Len)
+        {
+            return u32Pos;
+        }
+    }
+#endif
+    return SAMPLE_COMM_VDEC_ByteStartCode(pu8Data, i, u32Len, u32Len);
+}
+
+/* what the nal after a start code does to access units */
+static HI_S32 SAMPLE_COMM_VDEC_NalKind(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Nal, HI_U32 u32Len,
+                                       HI_BOOL *pbFirst, HI_BOOL *pbKey, HI_U32 *pu32Type)
+{
+    HI_U32 u32NalType;
+
+    *pbFirst = HI_FALSE;
+    *pbKey = HI_FALSE;
+    *pu32Type = 0;
+    if (PT_H264 == enType)
+    {
+        if (u32Len < 2)
+        {
+            return SAMPLE_VDEC_NAL_OTHER;
+        }
+        u32NalType = pu8Nal[0] & 0x1F;
+        if ((1 == u32NalType) || (2 == u32NalType) || (5 == u32NalType))
+        {
+            /* first_mb_in_slice is ue(v), 0 is a single 1 bit */
+            *pbFirst = (pu8Nal[1] & 0x80) ? HI_TRUE : HI_FALSE;
+            *pbKey = (5 == u32NalType) ? HI_TRUE : HI_FALSE;
+            *pu32Type = u32NalType;
+            return SAMPLE_VDEC_NAL_PIC;
+        }
+        if (((u32NalType >= 6) && (u32NalType <= 9)) || ((u32NalType >= 14) && (u32NalType <= 18)))
+        {
+            return SAMPLE_VDEC_NAL_PREFIX;
+        }
+    }
+    else if (SAMPLE_PT_H265 == enType)
+    {
+        if (u32Len < 3)
+        {
+            return SAMPLE_VDEC_NAL_OTHER;
+        }
+        u32NalType = (pu8Nal[0] >> 1) & 0x3F;
+        if (u32NalType < 32)
+        {
+            *pbFirst = (pu8Nal[2] & 0x80) ? HI_TRUE : HI_FALSE;     /* first_slice_segment_in_pic_flag */
+            *pbKey = ((u32NalType >= 16) && (u32NalType <= 23)) ? HI_TRUE : HI_FALSE;
+            *pu32Type = u32NalType;
+            return SAMPLE_VDEC_NAL_PIC;
+        }
+        if (((u32NalType >= 32) && (u32NalType <= 35)) || (39 == u32NalType)
+            || ((u32NalType >= 41) && (u32NalType <= 44)) || ((u32NalType >= 48) && (u32NalType <= 55)))
+        {
+            return SAMPLE_VDEC_NAL_PREFIX;
+        }
+    }
+    else if (PT_MP4VIDEO == enType)
+    {
+        if (u32Len < 2)
+        {
+            return SAMPLE_VDEC_NAL_OTHER;
+        }
+        if (0xB6 == pu8Nal[0])
+        {
+            *pbFirst = HI_TRUE;
+            *pbKey = (0 == (pu8Nal[1] >> 6)) ? HI_TRUE : HI_FALSE;     /* vop_coding_type */
+            *pu32Type = pu8Nal[1] >> 6;
+            return SAMPLE_VDEC_NAL_PIC;
+        }
+        if ((pu8Nal[0] <= 0x2F) || (0xB0 == pu8Nal[0]) || (0xB3 == pu8Nal[0]) || (0xB5 == pu8Nal[0]))
+        {
+            return SAMPLE_VDEC_NAL_PREFIX;
+        }
+    }
+    return SAMPLE_VDEC_NAL_OTHER;
+}
+
+static HI_S32 SAMPLE_COMM_VDEC_AddFrame(SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Max, HI_U32 *pu32Frames,
+                                        HI_U32 u32Offset, HI_U32 u32Len, HI_U32 u32Type, HI_BOOL bKey)
+{
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+
+    if (*pu32Frames == *pu32Max)
+    {
+        pstFrame = (SAMPLE_VDEC_FRAME_S *)realloc(*ppstFrame, sizeof(SAMPLE_VDEC_FRAME_S) * (*pu32Max) * 2);
+        if (NULL == pstFrame)
+        {
+            return HI_FAILURE;
+        }
+        *ppstFrame = pstFrame;
+        *pu32Max *= 2;
+    }
+    pstFrame = &(*ppstFrame)[*pu32Frames];
+    pstFrame->u32Offset = u32Offset;
+    pstFrame->u32Len = u32Len;
+    pstFrame->u64PTS = 0;
+    pstFrame->u32Type = u32Type;
+    pstFrame->bKey = bKey;
+    (*pu32Frames)++;
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : split an h264, h265 or mpeg4 elementary stream into access units,
+*            *ppstFrame is malloced and freed by the caller. There are no pts
+*            in an elementary stream, u64PTS is left 0
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_BuildIndex(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Data, HI_U32 u32Len,
+                                   SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Frames)
+{
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Max = u32Len / 4096 + 64;
+    HI_U32 u32Frames = 0;
+    HI_U32 u32Pos;
+    HI_U32 u32Next;
+    HI_U32 u32Start;
+    HI_U32 u32AuStart = 0;
+    HI_BOOL bInAu = HI_FALSE;
+    HI_BOOL bHavePic = HI_FALSE;
+    HI_BOOL bAuKey = HI_FALSE;
+    HI_U32 u32AuType = 0;
+    HI_BOOL bFirst;
+    HI_BOOL bKey;
+    HI_U32 u32Type;
+    HI_S32 s32Kind;
+
+    if ((NULL == pu8Data) || (NULL == ppstFrame) || (NULL == pu32Frames)
+        || ((PT_H264 != enType) && (SAMPLE_PT_H265 != enType) && (PT_MP4VIDEO != enType)))
+    {
+        return HI_FAILURE;
+    }
+    pstFrame = (SAMPLE_VDEC_FRAME_S *)malloc(sizeof(SAMPLE_VDEC_FRAME_S) * u32Max);
+    if (NULL == pstFrame)
+    {
+        return HI_FAILURE;
+    }
+
+    u32Pos = SAMPLE_COMM_VDEC_FindStartCode(pu8Data, u32Len);
+    while (u32Pos < u32Len)
+    {
+        u32Next = u32Pos + 3 + SAMPLE_COMM_VDEC_FindStartCode(pu8Data + u32Pos + 3, u32Len - u32Pos - 3);
+        u32Start = ((u32Pos > 0) && (0 == pu8Data[u32Pos - 1])) ? u32Pos - 1 : u32Pos;
+        s32Kind = SAMPLE_COMM_VDEC_NalKind(enType, pu8Data + u32Pos + 3, u32Next - u32Pos - 3, &bFirst, &bKey, &u32Type);
+        if ((HI_TRUE == bHavePic)
+            && ((SAMPLE_VDEC_NAL_PREFIX == s32Kind) || ((SAMPLE_VDEC_NAL_PIC == s32Kind) && (HI_TRUE == bFirst))))
+        {
+            if (HI_SUCCESS != SAMPLE_COMM_VDEC_AddFrame(&pstFrame, &u32Max, &u32Frames, u32AuStart,
+                                                        u32Start - u32AuStart, u32AuType, bAuKey))
+            {
+                free(pstFrame);
+                return HI_FAILURE;
+            }
+            bInAu = HI_FALSE;
+            bHavePic = HI_FALSE;
+            bAuKey = HI_FALSE;
+        }
+        if (HI_TRUE != bInAu)
+        {
+            u32AuStart = u32Start;
+            bInAu = HI_TRUE;
+        }
+        if (SAMPLE_VDEC_NAL_PIC == s32Kind)
+        {
+            u32AuType = (HI_TRUE == bHavePic) ? u32AuType : u32Type;
+            bHavePic = HI_TRUE;
+            bAuKey = (HI_TRUE == bKey) ? HI_TRUE : bAuKey;
+        }
+        u32Pos = u32Next;
+    }
+    /* a trailing access unit without a picture is not one */
+    if ((HI_TRUE == bHavePic)
+        && (HI_SUCCESS != SAMPLE_COMM_VDEC_AddFrame(&pstFrame, &u32Max, &u32Frames, u32AuStart,
+                                                    u32Len - u32AuStart, u32AuType, bAuKey)))
+    {
+        free(pstFrame);
+        return HI_FAILURE;
+    }
+
+    *ppstFrame = pstFrame;
+    *pu32Frames = u32Frames;
+    return HI_SUCCESS;
+}
+/******************************************************************************
+* funciton : start the .idx sidecar of a stream file that is being written,
+*            SAMPLE_COMM_VDEC_IndexAppend adds its frames, fclose ends it
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_IndexCreate(const HI_CHAR *pszStream, PAYLOAD_TYPE_E enType, FILE **ppFile)
+{
+    SAMPLE_VDEC_INDEX_HEAD_S stHead;
+    HI_CHAR acFile[SAMPLE_VDEC_INDEX_NAME_LEN];
+    FILE *pFile;
+
+    if ((NULL == pszStream) || (NULL == ppFile))
+    {
+        return HI_FAILURE;
+    }
+    snprintf(acFile, sizeof(acFile), "%s.idx", pszStream);
+    pFile = fopen(acFile, "wb");
+    if (NULL == pFile)
+    {
+        SAMPLE_PRT("open file[%s] failed!\n", acFile);
+        return HI_FAILURE;
+    }
+    stHead.u32Magic = SAMPLE_VDEC_INDEX_MAGIC;
+    stHead.u32Version = SAMPLE_VDEC_INDEX_VERSION;
+    stHead.u32Type = (HI_U32)enType;
+    stHead.u32RecordLen = sizeof(SAMPLE_VDEC_FRAME_S);
+    if (1 != fwrite(&stHead, sizeof(stHead), 1, pFile))
+    {
+        SAMPLE_PRT("write file[%s] failed!\n", acFile);
+        fclose(pFile);
+        return HI_FAILURE;
+    }
+    *ppFile = pFile;
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : add a frame to a sidecar, after the frame is in the stream file
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_IndexAppend(FILE *pFile, const SAMPLE_VDEC_FRAME_S *pstFrame)
+{
+    if ((NULL == pFile) || (NULL == pstFrame))
+    {
+        return HI_FAILURE;
+    }
+    if (1 != fwrite(pstFrame, sizeof(SAMPLE_VDEC_FRAME_S), 1, pFile))
+    {
+        return HI_FAILURE;
+    }
+    fflush(pFile);
+    return HI_SUCCESS;
+}
+
+/* the sidecar of the mapped stream if it is whole and still matches the stream, else HI_FAILURE */
+static HI_S32 SAMPLE_COMM_VDEC_IndexLoad(SAMPLE_VDEC_SOURCE_CTX_S *pstCtx, const HI_CHAR *pszStream)
+{
+    SAMPLE_VDEC_INDEX_HEAD_S stHead;
+    SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_CHAR acFile[SAMPLE_VDEC_INDEX_NAME_LEN];
+    struct stat stStat;
+    HI_U32 u32Frames;
+    HI_U32 u32End = 0;
+    HI_U32 i;
+    FILE *pFile;
+
+    snprintf(acFile, sizeof(acFile), "%s.idx", pszStream);
+    pFile = fopen(acFile, "rb");
+    if (NULL == pFile)
+    {
+        return HI_FAILURE;
+    }
+    if ((0 != fstat(fileno(pFile), &stStat)) || (stStat.st_size <= (off_t)sizeof(stHead))
+        || (1 != fread(&stHead, sizeof(stHead), 1, pFile))
+        || (SAMPLE_VDEC_INDEX_MAGIC != stHead.u32Magic) || (SAMPLE_VDEC_INDEX_VERSION != stHead.u32Version)
+        || ((HI_U32)pstCtx->enType != stHead.u32Type) || (sizeof(SAMPLE_VDEC_FRAME_S) != stHead.u32RecordLen)
+        || (0 != (stStat.st_size - sizeof(stHead)) % sizeof(SAMPLE_VDEC_FRAME_S)))
+    {
+        fclose(pFile);
+        return HI_FAILURE;
+    }
+    u32Frames = (stStat.st_size - sizeof(stHead)) / sizeof(SAMPLE_VDEC_FRAME_S);
+    pstFrame = (SAMPLE_VDEC_FRAME_S *)malloc(sizeof(SAMPLE_VDEC_FRAME_S) * u32Frames);
+    if ((NULL == pstFrame) || (u32Frames != fread(pstFrame, sizeof(SAMPLE_VDEC_FRAME_S), u32Frames, pFile)))
+    {
+        free(pstFrame);
+        fclose(pFile);
+        return HI_FAILURE;
+    }
+    fclose(pFile);
+
+    /* frames in order, each at a start code, the last one ending with the stream: a stream that
+       grew or was cut after its sidecar was written has to be scanned again */
+    for (i = 0; i < u32Frames; i++)
+    {
+        if ((pstFrame[i].u32Offset < u32End) || (pstFrame[i].u32Len < 4)
+            || (pstFrame[i].u32Len > pstCtx->u32Size - pstFrame[i].u32Offset)
+            || (pstCtx->u32Size - pstFrame[i].u32Offset < 4)
+            || (SAMPLE_COMM_VDEC_FindStartCode(pstCtx->pu8Map + pstFrame[i].u32Offset, 4) > 1))
+        {
+            break;
+        }
+        u32End = pstFrame[i].u32Offset + pstFrame[i].u32Len;
+    }
+    if ((i != u32Frames) || (u32End != pstCtx->u32Size))
+    {
+        SAMPLE_PRT("%s does not match its stream, rebuild it\n", acFile);
+        free(pstFrame);
+        return HI_FAILURE;
+    }
+    pstCtx->pstFrame = pstFrame;
+    pstCtx->u32Frames = u32Frames;
+    return HI_SUCCESS;
+}
+
+static HI_VOID SAMPLE_COMM_VDEC_IndexSave(SAMPLE_VDEC_SOURCE_CTX_S *pstCtx, const HI_CHAR *pszStream)
+{
+    HI_CHAR acFile[SAMPLE_VDEC_INDEX_NAME_LEN];
+    FILE *pFile;
+
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_IndexCreate(pszStream, pstCtx->enType, &pFile))
+    {
+        return;
+    }
+    if (pstCtx->u32Frames != fwrite(pstCtx->pstFrame, sizeof(SAMPLE_VDEC_FRAME_S), pstCtx->u32Frames, pFile))
+    {
+        snprintf(acFile, sizeof(acFile), "%s.idx", pszStream);
+        SAMPLE_PRT("write file[%s] failed!\n", acFile);
+        fclose(pFile);
+        remove(acFile);
+        return;
+    }
+    fclose(pFile);
+}
+
+/* the key frame table that makes seek and trick play one lookup */
+static HI_S32 SAMPLE_COMM_VDEC_IndexKeys(SAMPLE_VDEC_SOURCE_CTX_S *pstCtx)
+{
+    HI_U32 i;
+
+    pstCtx->pu32KeyCnt = (HI_U32 *)malloc(sizeof(HI_U32) * (pstCtx->u32Frames + 1));
+    pstCtx->pu32Key = (HI_U32 *)malloc(sizeof(HI_U32) * (pstCtx->u32Frames + 1));
+    if ((NULL == pstCtx->pu32KeyCnt) || (NULL == pstCtx->pu32Key))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx->u32Keys = 0;
+    for (i = 0; i < pstCtx->u32Frames; i++)
+    {
+        if (HI_TRUE == pstCtx->pstFrame[i].bKey)
+        {
+            pstCtx->pu32Key[pstCtx->u32Keys++] = i;
+        }
+        pstCtx->pu32KeyCnt[i] = pstCtx->u32Keys;
+    }
+    return HI_SUCCESS;
+}
+
+static HI_VOID SAMPLE_COMM_VDEC_SourceFree(VDEC_CHN VdChn)
+{
+    SAMPLE_VDEC_SOURCE_CTX_S *pstCtx = &gs_astVdecSource[VdChn];
+
+    if (HI_TRUE == pstCtx->bDemux)
+    {
+        SAMPLE_COMM_VDEC_DemuxClose(VdChn);
+    }
+    munmap(pstCtx->pu8Map, pstCtx->u32Size);
+    free(pstCtx->pstFrame);
+    free(pstCtx->pu32KeyCnt);
+    free(pstCtx->pu32Key);
+    pstCtx->pu8Map = NULL;
+    pstCtx->pstFrame = NULL;
+    pstCtx->pu32KeyCnt = NULL;
+    pstCtx->pu32Key = NULL;
+}
+
+/* open as seen from a thread other than the sender's */
+static HI_BOOL SAMPLE_COMM_VDEC_SourceIsOpen(VDEC_CHN VdChn)
+{
+    HI_BOOL bOpen;
+
+    pthread_mutex_lock(&gs_VdecSourceMutex);
+    bOpen = gs_astVdecSource[VdChn].bOpen;
+    pthread_mutex_unlock(&gs_VdecSourceMutex);
+    return bOpen;
+}
+
+/******************************************************************************
+* funciton : map a stream file for a channel, h264 / h265 / mpeg4 files are
+*            indexed by access unit, from "<file>.idx" if it is there and
+*            matches, else by scanning the file and saving the index to it.
+*            A scanned index counts its pts in u64PtsStep from 0,
+*            others can only be sent in pieces. An mp4 or ts file is indexed
+*            from the container and has to hold enType
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_SourceOpen(VDEC_CHN VdChn, const HI_CHAR *pszFile, PAYLOAD_TYPE_E enType, HI_U64 u64PtsStep)
+{
+    SAMPLE_VDEC_SOURCE_CTX_S *pstCtx;
+    PAYLOAD_TYPE_E enFileType;
+    struct stat stStat;
+    HI_S32 s32Fd;
+    HI_U32 i;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pszFile))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astVdecSource[VdChn];
+    if (HI_TRUE == pstCtx->bOpen)
+    {
+        SAMPLE_PRT("source of chn[%d] is open already\n", VdChn);
+        return HI_FAILURE;
+    }
+
+    s32Fd = open(pszFile, O_RDONLY);
+    if (s32Fd < 0)
+    {
+        SAMPLE_PRT("open file[%s] failed!\n", pszFile);
+        return HI_FAILURE;
+    }
+    if ((0 != fstat(s32Fd, &stStat)) || (0 == stStat.st_size) || ((HI_U64)stStat.st_size >= 0xFFFFFFFFULL))
+    {
+        SAMPLE_PRT("file[%s] is empty or too big!\n", pszFile);
+        close(s32Fd);
+        return HI_FAILURE;
+    }
+    memset(pstCtx, 0, sizeof(SAMPLE_VDEC_SOURCE_CTX_S));
+    pstCtx->enType = enType;
+    pstCtx->u32Speed = 1;
+    pstCtx->u32Size = (HI_U32)stStat.st_size;
+    pstCtx->pu8Map = (HI_U8 *)mmap(NULL, pstCtx->u32Size, PROT_READ, MAP_PRIVATE, s32Fd, 0);
+    close(s32Fd);
+    if (MAP_FAILED == pstCtx->pu8Map)
+    {
+        SAMPLE_PRT("mmap file[%s] failed!\n", pszFile);
+        return HI_FAILURE;
+    }
+
+    if (SAMPLE_VDEC_CONTAINER_ES != SAMPLE_COMM_VDEC_DemuxProbe(pstCtx->pu8Map, pstCtx->u32Size))
+    {
+        if (HI_SUCCESS != SAMPLE_COMM_VDEC_DemuxOpen(VdChn, pstCtx->pu8Map, pstCtx->u32Size, u64PtsStep,
+                                                     &enFileType, &pstCtx->pstFrame, &pstCtx->u32Frames))
+        {
+            SAMPLE_PRT("demux file[%s] failed!\n", pszFile);
+            SAMPLE_COMM_VDEC_SourceFree(VdChn);
+            return HI_FAILURE;
+        }
+        pstCtx->bDemux = HI_TRUE;
+        if (enFileType != enType)
+        {
+            SAMPLE_PRT("file[%s] holds payload %d, chn %d decodes %d\n", pszFile, enFileType, VdChn, enType);
+            SAMPLE_COMM_VDEC_SourceFree(VdChn);
+            return HI_FAILURE;
+        }
+    }
+    else if ((PT_H264 == enType) || (SAMPLE_PT_H265 == enType) || (PT_MP4VIDEO == enType))
+    {
+        if (HI_SUCCESS == SAMPLE_COMM_VDEC_IndexLoad(pstCtx, pszFile))
+        {
+            pstCtx->bSidecar = HI_TRUE;
+        }
+        else
+        {
+            (HI_VOID)madvise(pstCtx->pu8Map, pstCtx->u32Size, MADV_SEQUENTIAL);
+            if (HI_SUCCESS != SAMPLE_COMM_VDEC_BuildIndex(enType, pstCtx->pu8Map, pstCtx->u32Size,
+                                                          &pstCtx->pstFrame, &pstCtx->u32Frames))
+            {
+                SAMPLE_PRT("index file[%s] failed!\n", pszFile);
+                SAMPLE_COMM_VDEC_SourceFree(VdChn);
+                return HI_FAILURE;
+            }
+            (HI_VOID)madvise(pstCtx->pu8Map, pstCtx->u32Size, MADV_NORMAL);
+            for (i = 0; i < pstCtx->u32Frames; i++)
+            {
+                pstCtx->pstFrame[i].u64PTS = i * u64PtsStep;
+            }
+            if (pstCtx->u32Frames > 0)
+            {
+                SAMPLE_COMM_VDEC_IndexSave(pstCtx, pszFile);
+            }
+        }
+    }
+    if ((NULL != pstCtx->pstFrame) && (HI_SUCCESS != SAMPLE_COMM_VDEC_IndexKeys(pstCtx)))
+    {
+        SAMPLE_PRT("malloc key table failed!\n");
+        SAMPLE_COMM_VDEC_SourceFree(VdChn);
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecSourceMutex);
+    pstCtx->bOpen = HI_TRUE;
+    pthread_mutex_unlock(&gs_VdecSourceMutex);
+
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : the access units of a channel's file, valid until it is closed
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_SourceGetIndex(VDEC_CHN VdChn, const SAMPLE_VDEC_FRAME_S **ppstFrame, HI_U32 *pu32Frames)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == ppstFrame) || (NULL == pu32Frames)
+        || (HI_TRUE != SAMPLE_COMM_VDEC_SourceIsOpen(VdChn)))
+    {
+        return HI_FAILURE;
+    }
+    *ppstFrame = gs_astVdecSource[VdChn].pstFrame;
+    *pu32Frames = gs_astVdecSource[VdChn].u32Frames;
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : point a frame mode VDEC_STREAM_S at access unit u32Frame in the
+*            mapping, or in the demuxer's buffer for what it put together
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_SourceGetFrame(VDEC_CHN VdChn, HI_U32 u32Frame, VDEC_STREAM_S *pstStream)
+{
+    SAMPLE_VDEC_SOURCE_CTX_S *pstCtx;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstStream)
+        || (HI_TRUE != gs_astVdecSource[VdChn].bOpen) || (u32Frame >= gs_astVdecSource[VdChn].u32Frames))
+    {
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astVdecSource[VdChn];
+    if (HI_TRUE == pstCtx->bDemux)
+    {
+        return SAMPLE_COMM_VDEC_DemuxGetFrame(VdChn, u32Frame, pstStream);
+    }
+
+    pstStream->pu8Addr = pstCtx->pu8Map + pstCtx->pstFrame[u32Frame].u32Offset;
+    pstStream->u32Len = pstCtx->pstFrame[u32Frame].u32Len;
+    pstStream->u64PTS = pstCtx->pstFrame[u32Frame].u64PTS;
+    pstStream->bEndOfFrame = HI_TRUE;
+    pstStream->bEndOfStream = HI_FALSE;
+    return HI_SUCCESS;
+}
+
+/* key frame at or before u32Frame, the first one if the stream does not start with one */
+static HI_U32 SAMPLE_COMM_VDEC_KeyBefore(const SAMPLE_VDEC_SOURCE_CTX_S *pstCtx, HI_U32 u32Frame)
+{
+    HI_U32 u32Cnt = pstCtx->pu32KeyCnt[u32Frame];
+
+    return pstCtx->pu32Key[(u32Cnt > 0) ? u32Cnt - 1 : 0];
+}
+
+/* key frame at or after u32Frame, u32Frames if there is none */
+static HI_U32 SAMPLE_COMM_VDEC_KeyAfter(const SAMPLE_VDEC_SOURCE_CTX_S *pstCtx, HI_U32 u32Frame)
+{
+    HI_U32 u32Cnt;
+
+    if (u32Frame >= pstCtx->u32Frames)
+    {
+        return pstCtx->u32Frames;
+    }
+    u32Cnt = pstCtx->pu32KeyCnt[u32Frame];
+    if ((u32Cnt > 0) && (pstCtx->pu32Key[u32Cnt - 1] == u32Frame))
+    {
+        return u32Frame;
+    }
+    return (u32Cnt < pstCtx->u32Keys) ? pstCtx->pu32Key[u32Cnt] : pstCtx->u32Frames;
+}
+
+/******************************************************************************
+* funciton : the key frame decoding of frame u32Frame has to start from
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_SourceFindKey(VDEC_CHN VdChn, HI_U32 u32Frame, HI_U32 *pu32Key)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pu32Key)
+        || (HI_TRUE != gs_astVdecSource[VdChn].bOpen) || (u32Frame >= gs_astVdecSource[VdChn].u32Frames)
+        || (0 == gs_astVdecSource[VdChn].u32Keys))
+    {
+        return HI_FAILURE;
+    }
+    *pu32Key = SAMPLE_COMM_VDEC_KeyBefore(&gs_astVdecSource[VdChn], u32Frame);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : go on sending from the key frame before u64Pts, counted from the
+*            pts of the first frame. The frame is found by the average frame
+*            distance and corrected by the pts around it, so it takes a step
+*            or two on a stream with a steady frame rate
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_SourceSeek(VDEC_CHN VdChn, HI_U64 u64Pts, HI_U32 *pu32Frame)
+{
+    SAMPLE_VDEC_SOURCE_CTX_S *pstCtx;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U64 u64Span;
+    HI_U32 u32Frame;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE != SAMPLE_COMM_VDEC_SourceIsOpen(VdChn))
+        || (0 == gs_astVdecSource[VdChn].u32Keys))
+    {
+        SAMPLE_PRT("chn %d has no indexed stream to seek in\n", VdChn);
+        return HI_FAILURE;
+    }
+    pstCtx = &gs_astVdecSource[VdChn];
+    pstFrame = pstCtx->pstFrame;
+
+    u64Span = pstFrame[pstCtx->u32Frames - 1].u64PTS - pstFrame[0].u64PTS;
+    if ((0 == u64Span) || (u64Pts >= u64Span))
+    {
+        u32Frame = (0 == u64Span) ? 0 : pstCtx->u32Frames - 1;
+    }
+    else
+    {
+        u32Frame = (HI_U32)(u64Pts * (pstCtx->u32Frames - 1) / u64Span);
+    }
+    while ((u32Frame + 1 < pstCtx->u32Frames) && (pstFrame[u32Frame + 1].u64PTS - pstFrame[0].u64PTS <= u64Pts))
+    {
+        u32Frame++;
+    }
+    while ((u32Frame > 0) && (pstFrame[u32Frame].u64PTS - pstFrame[0].u64PTS > u64Pts))
+    {
+        u32Frame--;
+    }
+    u32Frame = SAMPLE_COMM_VDEC_KeyBefore(pstCtx, u32Frame);
+
+    pthread_mutex_lock(&gs_VdecSourceMutex);
+    pstCtx->u32SeekFrame = u32Frame;
+    pstCtx->bSeek = HI_TRUE;
+    pthread_mutex_unlock(&gs_VdecSourceMutex);
+    if (NULL != pu32Frame)
+    {
+        *pu32Frame = u32Frame;
+    }
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : trick play, 2, 4 or 8 send key frames only, as many as the
+*            frames they stand for would take at that speed. 1 is normal play
+******************************************************************************/
+HI_S32 SAMPLE_COMM_VDEC_SourceSetSpeed(VDEC_CHN VdChn, HI_U32 u32Speed)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE != SAMPLE_COMM_VDEC_SourceIsOpen(VdChn))
+        || (0 == u32Speed) || (u32Speed > SAMPLE_VDEC_SPEED_MAX) || (0 != (u32Speed & (u32Speed - 1))))
+    {
+        SAMPLE_PRT("input param invaild\n");
+        return HI_FAILURE;
+    }
+    if ((u32Speed > 1) && (0 == gs_astVdecSource[VdChn].u32Keys))
+    {
+        SAMPLE_PRT("chn %d has no key frames for trick play\n", VdChn);
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&gs_VdecSourceMutex);
+    gs_astVdecSource[VdChn].u32Speed = u32Speed;
+    pthread_mutex_unlock(&gs_VdecSourceMutex);
+    return HI_SUCCESS;
+}
+
+HI_S32 SAMPLE_COMM_VDEC_SourceClose(VDEC_CHN VdChn)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (HI_TRUE != gs_astVdecSource[VdChn].bOpen))
+    {
+        return HI_FAILURE;
+    }
+
+    pthread_mutex_lock(&gs_VdecSourceMutex);
+    gs_astVdecSource[VdChn].bOpen = HI_FALSE;
+    pthread_mutex_unlock(&gs_VdecSourceMutex);
+    SAMPLE_COMM_VDEC_SourceFree(VdChn);
+    return HI_SUCCESS;
+}
+
+/******************************************************************************
+* funciton : SAMPLE_COMM_VDEC_SendStream from a mapped and indexed file, what
+*            SAMPLE_COMM_VDEC_StartSendStream runs for h264, h265 and mpeg4
+*            channels. Frame mode sends
+*            an access unit at a time with the pts of the index from
+*            u64PtsInit on, and follows SAMPLE_COMM_VDEC_SourceSeek and
+*            SAMPLE_COMM_VDEC_SourceSetSpeed. Stream mode sends
+*            s32MinBufSize pieces and only follows seeks, the frames of an mp4
+*            or ts go a frame at a time in either mode, without bEndOfFrame
+*            in stream mode
+******************************************************************************/
+HI_VOID * SAMPLE_COMM_VDEC_SendStreamMmap(HI_VOID *pArgs)
+{
+    VdecThreadParam *pstVdecThreadParam = (VdecThreadParam *)pArgs;
+    SAMPLE_VDEC_SOURCE_CTX_S *pstCtx;
+    VDEC_STREAM_S stStream;
+    HI_BOOL bFrameMode = (VIDEO_MODE_FRAME == pstVdecThreadParam->s32StreamMode) ? HI_TRUE : HI_FALSE;
+    HI_BOOL bByFrame;
+    HI_U32 u32Frame = 0;
+    HI_U32 u32Next = 0;
+    HI_U32 u32Offset = 0;
+    HI_U32 u32Speed = 1;
+    HI_U32 u32Wait = SAMPLE_VDEC_SEND_INTERVAL;
+    HI_U64 u64LoopBase = 0;
+    HI_U64 u64pts;
+    HI_S32 s32Ret;
+
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceOpen(pstVdecThreadParam->s32ChnId, pstVdecThreadParam->cFileName,
+                                                  pstVdecThreadParam->enType, pstVdecThreadParam->u64PtsIncrease))
+    {
+        return (HI_VOID *)(HI_FAILURE);
+    }
+    pstCtx = &gs_astVdecSource[pstVdecThreadParam->s32ChnId];
+    bByFrame = ((HI_TRUE == bFrameMode) || (HI_TRUE == pstCtx->bDemux)) ? HI_TRUE : HI_FALSE;
+    if ((HI_TRUE == bFrameMode) && (0 == pstCtx->u32Frames))
+    {
+        SAMPLE_PRT("chn %d: no access units in %s, frame mode needs h264, h265 or mpeg4\n",
+                   pstVdecThreadParam->s32ChnId, pstVdecThreadParam->cFileName);
+        SAMPLE_COMM_VDEC_SourceClose(pstVdecThreadParam->s32ChnId);
+        return (HI_VOID *)(HI_FAILURE);
+    }
+
+    u64pts = pstVdecThreadParam->u64PtsInit;
+    while (1)
+    {
+        if (pstVdecThreadParam->eCtrlSinal == VDEC_CTRL_STOP)
+        {
+            break;
+        }
+        else if (pstVdecThreadParam->eCtrlSinal == VDEC_CTRL_PAUSE)
+        {
+            sleep(MIN2(pstVdecThreadParam->s32IntervalTime,1000));
+            continue;
+        }
+
+        pthread_mutex_lock(&gs_VdecSourceMutex);
+        if (HI_TRUE == pstCtx->bSeek)
+        {
+            u32Frame = pstCtx->u32SeekFrame;
+            u32Offset = pstCtx->pstFrame[u32Frame].u32Offset;
+            pstCtx->bSeek = HI_FALSE;
+        }
+        u32Speed = pstCtx->u32Speed;
+        pthread_mutex_unlock(&gs_VdecSourceMutex);
+
+        if (HI_TRUE == bByFrame)
+        {
+            if (u32Speed > 1)
+            {
+                u32Frame = SAMPLE_COMM_VDEC_KeyAfter(pstCtx, u32Frame);
+            }
+            if (u32Frame >= pstCtx->u32Frames)
+            {
+                if (!pstVdecThreadParam->bLoopSend)
+                {
+                    break;
+                }
+                u64LoopBase += pstCtx->pstFrame[pstCtx->u32Frames - 1].u64PTS - pstCtx->pstFrame[0].u64PTS
+                               + pstVdecThreadParam->u64PtsIncrease;
+                u32Frame = 0;
+                continue;
+            }
+            (HI_VOID)SAMPLE_COMM_VDEC_SourceGetFrame(pstVdecThreadParam->s32ChnId, u32Frame, &stStream);
+            stStream.bEndOfFrame = bFrameMode;
+            stStream.u64PTS = pstVdecThreadParam->u64PtsInit + u64LoopBase
+                              + pstCtx->pstFrame[u32Frame].u64PTS - pstCtx->pstFrame[0].u64PTS;
+            /* trick play: the next key frame u32Speed frames on, after the time the frames up to it take at that speed */
+            u32Next = (u32Speed > 1) ? SAMPLE_COMM_VDEC_KeyAfter(pstCtx, u32Frame + u32Speed) : u32Frame + 1;
+            u32Wait = (u32Next - u32Frame) * SAMPLE_VDEC_SEND_INTERVAL / u32Speed;
+        }
+        else
+        {
+            if (u32Offset >= pstCtx->u32Size)
+            {
+                if (!pstVdecThreadParam->bLoopSend)
+                {
+                    break;
+                }
+                u32Offset = 0;
+            }
+            stStream.pu8Addr = pstCtx->pu8Map + u32Offset;
+            stStream.u32Len = MIN2((HI_U32)pstVdecThreadParam->s32MinBufSize, pstCtx->u32Size - u32Offset);
+            stStream.u64PTS = u64pts;
+            stStream.bEndOfFrame = HI_FALSE;
+            stStream.bEndOfStream = HI_FALSE;
+        }
+        s32Ret = HI_MPI_VDEC_SendStream(pstVdecThreadParam->s32ChnId, &stStream, pstVdecThreadParam->s32MilliSec);
+        if (HI_SUCCESS != s32Ret)
+        {
+            usleep(100);
+            continue;
+        }
+        u32Frame = u32Next;
+        u32Offset += stStream.u32Len;
+        u64pts += pstVdecThreadParam->u64PtsIncrease;
+        usleep(u32Wait);
+    }
+
+    /* send the flag of stream end */
+    memset(&stStream, 0, sizeof(VDEC_STREAM_S));
+    stStream.bEndOfStream = HI_TRUE;
+    HI_MPI_VDEC_SendStream(pstVdecThreadParam->s32ChnId, &stStream, -1);
+
+    SAMPLE_COMM_VDEC_SourceClose(pstVdecThreadParam->s32ChnId);
+    return (HI_VOID *)HI_SUCCESS;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -851,12 +851,16 @@ HI_VOID* SAMPLE_COMM_VENC_GetVencStreamProc(HI_VOID *p)
     HI_S32 VencFd[VENC_MAX_CHN_NUM];
     HI_CHAR aszFileName[VENC_MAX_CHN_NUM][64];
     FILE *pFile[VENC_MAX_CHN_NUM];
+    FILE *pIdxFile[VENC_MAX_CHN_NUM];
+    HI_U32 au32FileLen[VENC_MAX_CHN_NUM];
+    SAMPLE_VDEC_FRAME_S stFrame;
     char szFilePostfix[10];
     VENC_CHN_STAT_S stStat;
     VENC_STREAM_S stStream;
     HI_S32 s32Ret;
     VENC_CHN VencChn;
     PAYLOAD_TYPE_E enPayLoadType[VENC_MAX_CHN_NUM];
+    HI_U32 j;
     
     pstPara = (SAMPLE_VENC_GETSTREAM_PARA_S*)p;
     s32ChnTotal = pstPara->s32Cnt;
@@ -897,6 +901,14 @@ HI_VOID* SAMPLE_COMM_VENC_GetVencStreamProc(HI_VOID *p)
                    aszFileName[i]);
             return NULL;
         }
+        /* h264 gets a frame index next to it for vdec seek and trick play, a stream without one is scanned */
+        pIdxFile[i] = NULL;
+        au32FileLen[i] = 0;
+        if ((PT_H264 == enPayLoadType[i])
+            && (HI_SUCCESS != SAMPLE_COMM_VDEC_IndexCreate(aszFileName[i], enPayLoadType[i], &pIdxFile[i])))
+        {
+            pIdxFile[i] = NULL;
+        }
 
         /* Set Venc Fd. */
         VencFd[i] = HI_MPI_VENC_GetFd(i);
@@ -988,6 +1000,24 @@ HI_VOID* SAMPLE_COMM_VENC_GetVencStreamProc(HI_VOID *p)
                         SAMPLE_PRT("save stream failed!\n");
                         break;
                     }
+                    if (NULL != pIdxFile[i])
+                    {
+                        memset(&stFrame, 0, sizeof(stFrame));
+                        stFrame.u32Offset = au32FileLen[i];
+                        stFrame.u64PTS = stStream.pstPack[0].u64PTS;
+                        stFrame.u32Type = H264E_NALU_PSLICE;
+                        for (j = 0; j < stStream.u32PackCount; j++)
+                        {
+                            stFrame.u32Len += stStream.pstPack[j].u32Len - stStream.pstPack[j].u32Offset;
+                            if (H264E_NALU_ISLICE == stStream.pstPack[j].DataType.enH264EType)
+                            {
+                                stFrame.u32Type = H264E_NALU_ISLICE;
+                                stFrame.bKey = HI_TRUE;
+                            }
+                        }
+                        au32FileLen[i] += stFrame.u32Len;
+                        (HI_VOID)SAMPLE_COMM_VDEC_IndexAppend(pIdxFile[i], &stFrame);
+                    }
                     /*******************************************************
                      step 2.5 : release stream
                     *******************************************************/
@@ -1014,6 +1044,10 @@ HI_VOID* SAMPLE_COMM_VENC_GetVencStreamProc(HI_VOID *p)
     for (i = 0; i < s32ChnTotal; i++)
     {
         fclose(pFile[i]);
+        if (NULL != pIdxFile[i])
+        {
+            fclose(pIdxFile[i]);
+        }
     }
 
     return NULL;
@@ -0,0 +1,292 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_bench_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/06/06
+  Description   : checks the vdec bench against the vdec stub: the fps, pixel
+                  rate and system figures it reports for channels decoding
+                  at known rates and sizes in frame and stream mode, that
+                  every picture is got and released and every byte of the
+                  streams sent, and that it stops while the decoders wait
+                  for picture buffers with a full stream buffer. Then how
+                  many pictures a second the bench itself moves on 16
+                  channels of a decoder that takes no time.
+                  usage: ./vdec_bench_test [dir]
+  History       :
+  1.Date        : 2016/06/06
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sample_comm.h"
+#include "vdec_stub.h"
+
+#define TEST_FRAMES         100
+#define TEST_CHN_MAX        16
+#define TEST_PIC_BUFFERS    4
+
+static HI_S32 s_s32Fail = 0;
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d %s\n", __FUNCTION__, __LINE__, #cond); \
+            s_s32Fail++; \
+        } \
+    } while (0)
+
+/* a channel of a test: the stub decoder it has and how it is fed */
+typedef struct test_chn_s
+{
+    PAYLOAD_TYPE_E enType;
+    VIDEO_MODE_E enMode;
+    HI_U32 u32Fps;
+    HI_U32 u32Width;
+    HI_U32 u32Height;
+}TEST_CHN_S;
+
+static HI_U8 s_au8Es[4 * 1024 * 1024];
+static HI_CHAR s_acH264[90];
+static HI_CHAR s_acMpeg4[90];
+static HI_U32 s_u32H264Len;
+static HI_U32 s_u32H264Hash;
+static VdecThreadParam s_astParam[TEST_CHN_MAX];
+
+static HI_BOOL TEST_Near(HI_FLOAT fValue, HI_FLOAT fExpect, HI_FLOAT fPercent)
+{
+    return ((fValue >= fExpect * (100 - fPercent) / 100) && (fValue <= fExpect * (100 + fPercent) / 100))
+           ? HI_TRUE : HI_FALSE;
+}
+
+static HI_U32 TEST_WriteEs(const HI_CHAR *pszFile, PAYLOAD_TYPE_E enType)
+{
+    VDEC_STUB_ES_CFG_S stCfg = {TEST_FRAMES, 25, 20000, 4000, 2, HI_FALSE};
+    HI_U32 u32Len = VDEC_STUB_MakeEs(enType, &stCfg, s_au8Es, sizeof(s_au8Es), NULL, NULL, NULL);
+    FILE *pFile = fopen(pszFile, "wb");
+
+    if (NULL == pFile)
+    {
+        printf("can't write %s\n", pszFile);
+        return 0;
+    }
+    fwrite(s_au8Es, 1, u32Len, pFile);
+    fclose(pFile);
+    return u32Len;
+}
+
+static HI_VOID TEST_Setup(HI_S32 s32ChnNum, const TEST_CHN_S *pstChn, HI_U32 u32Buffers)
+{
+    HI_S32 i;
+
+    VDEC_STUB_Reset();
+    memset(s_astParam, 0, sizeof(s_astParam));
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        s_astParam[i].s32ChnId = i;
+        s_astParam[i].enType = pstChn[i].enType;
+        snprintf(s_astParam[i].cFileName, sizeof(s_astParam[i].cFileName), "%s",
+                 (PT_H264 == pstChn[i].enType) ? s_acH264 : s_acMpeg4);
+        s_astParam[i].s32StreamMode = pstChn[i].enMode;
+        s_astParam[i].s32MinBufSize = 8192;
+        s_astParam[i].s32IntervalTime = 1;
+        s_astParam[i].eCtrlSinal = VDEC_CTRL_START;
+        s_astParam[i].u64PtsIncrease = 40000;
+        s_astParam[i].bLoopSend = HI_TRUE;
+        VDEC_STUB_SetDecoder(i, pstChn[i].u32Fps, 4 * 1024 * 1024);
+        VDEC_STUB_SetPicture(i, pstChn[i].u32Width, pstChn[i].u32Height, u32Buffers);
+    }
+}
+
+/* what the bench counted against what the stub saw, after the bench stopped */
+static HI_VOID TEST_CheckCounts(HI_S32 s32ChnNum)
+{
+    SAMPLE_VDEC_BENCH_STAT_S stStat;
+    VDEC_STUB_STAT_S stStubStat;
+    HI_S32 i;
+
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchGetStat(i, &stStat));
+        TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(i, &stStubStat));
+        TEST_CHECK(stStat.u64Sends == stStubStat.u64Sends);
+        TEST_CHECK(stStat.u64Bytes == stStubStat.u64Bytes);
+        TEST_CHECK(stStat.u64Retries == stStubStat.u64Rejected);
+        TEST_CHECK(stStat.u64Pictures == stStubStat.u64Got);
+        TEST_CHECK(stStubStat.u64Got == stStubStat.u64Released);
+        TEST_CHECK(stStubStat.u64Pictures - stStubStat.u64Got <= TEST_PIC_BUFFERS);
+        TEST_CHECK(HI_TRUE == stStubStat.bEndOfStream);
+    }
+}
+
+/* the rates reported for decoders of known speed and picture size */
+static HI_VOID TEST_Rates(HI_VOID)
+{
+    static const TEST_CHN_S s_astChn[] =
+    {
+        {PT_H264, VIDEO_MODE_FRAME, 200, 1920, 1080},
+        {PT_H264, VIDEO_MODE_FRAME, 100, 1280, 720},
+        {PT_MP4VIDEO, VIDEO_MODE_FRAME, 50, 720, 576},
+        {PT_H264, VIDEO_MODE_STREAM, 300, 704, 576},
+    };
+    HI_S32 s32ChnNum = sizeof(s_astChn) / sizeof(s_astChn[0]);
+    SAMPLE_VDEC_BENCH_REPORT_S stReport;
+    HI_FLOAT fMPixels = 0;
+    HI_S32 i;
+
+    TEST_Setup(s32ChnNum, s_astChn, TEST_PIC_BUFFERS);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchStart(s32ChnNum, s_astParam));
+    usleep(300000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchReport(&stReport));
+    usleep(1000000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchReport(&stReport));
+    SAMPLE_COMM_VDEC_BenchStop();
+
+    TEST_CHECK((stReport.u32IntervalMs >= 1000) && (stReport.u32IntervalMs < 1100));
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        TEST_CHECK(HI_TRUE == TEST_Near(stReport.afFps[i], s_astChn[i].u32Fps, 5));
+        fMPixels += (HI_FLOAT)s_astChn[i].u32Fps * s_astChn[i].u32Width * s_astChn[i].u32Height / 1000000;
+    }
+    TEST_CHECK(HI_TRUE == TEST_Near(stReport.fFps, 650, 5));
+    TEST_CHECK(HI_TRUE == TEST_Near(stReport.fMPixels, fMPixels, 5));
+    TEST_CHECK(stReport.fMbps > 0);
+    TEST_CHECK((stReport.fCpuLoad >= 0) && (stReport.fCpuLoad <= 100));
+    TEST_CHECK(stReport.fProcessLoad >= 0);
+    TEST_CHECK(stReport.u32RssKB > 0);
+    TEST_CHECK(stReport.u32MemFreeKB > 0);
+    TEST_CheckCounts(s32ChnNum);
+}
+
+/* without loop every byte of the stream once, in frames or in chunks, then the end of stream */
+static HI_VOID TEST_Content(VIDEO_MODE_E enMode)
+{
+    TEST_CHN_S stChn = {PT_H264, enMode, 0, 0, 0};
+    VDEC_STUB_STAT_S stStubStat;
+    SAMPLE_VDEC_BENCH_STAT_S stStat;
+    HI_S32 s32Wait;
+
+    TEST_Setup(1, &stChn, 0);
+    s_astParam[0].bLoopSend = HI_FALSE;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchStart(1, s_astParam));
+    for (s32Wait = 0; s32Wait < 500; s32Wait++)
+    {
+        (HI_VOID)VDEC_STUB_GetStat(0, &stStubStat);
+        if (HI_TRUE == stStubStat.bEndOfStream)
+        {
+            break;
+        }
+        usleep(10000);
+    }
+    usleep(20000);
+    SAMPLE_COMM_VDEC_BenchStop();
+
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStubStat));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchGetStat(0, &stStat));
+    TEST_CHECK(s_u32H264Len == stStubStat.u64Bytes);
+    TEST_CHECK(s_u32H264Hash == stStubStat.u32Hash);
+    if (VIDEO_MODE_FRAME == enMode)
+    {
+        TEST_CHECK(TEST_FRAMES == stStubStat.u64Frames);
+    }
+    else
+    {
+        TEST_CHECK((s_u32H264Len + 8191) / 8192 == stStubStat.u64Sends);
+        TEST_CHECK(0 == stStubStat.u64Frames);
+    }
+    TEST_CHECK(stStat.u64Pictures == stStubStat.u64Pictures);
+}
+
+static HI_VOID TEST_Errors(HI_VOID)
+{
+    TEST_CHN_S astChn[2] = {{PT_H264, VIDEO_MODE_FRAME, 0, 0, 0}, {PT_H264, VIDEO_MODE_FRAME, 0, 0, 0}};
+    SAMPLE_VDEC_BENCH_REPORT_S stReport;
+
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BenchReport(&stReport));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BenchStart(0, s_astParam));
+
+    TEST_Setup(2, astChn, 0);
+    snprintf(s_astParam[1].cFileName, sizeof(s_astParam[1].cFileName), "%s.none", s_acH264);
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BenchStart(2, s_astParam));
+    s_astParam[1].s32ChnId = 0;
+    snprintf(s_astParam[1].cFileName, sizeof(s_astParam[1].cFileName), "%s", s_acH264);
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BenchStart(2, s_astParam));
+    /* a wrong payload type: the h264 file holds no vop */
+    s_astParam[1].s32ChnId = 1;
+    s_astParam[1].enType = PT_MP4VIDEO;
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BenchStart(2, s_astParam));
+
+    s_astParam[1].enType = PT_H264;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchStart(2, s_astParam));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BenchStart(2, s_astParam));
+    SAMPLE_COMM_VDEC_BenchStop();
+    SAMPLE_COMM_VDEC_BenchStop();
+}
+
+/* what the harness moves when the decoder takes no time, the limit of what it can measure */
+static HI_VOID TEST_Overhead(HI_VOID)
+{
+    TEST_CHN_S astChn[TEST_CHN_MAX];
+    SAMPLE_VDEC_BENCH_REPORT_S stReport;
+    HI_S32 i;
+
+    for (i = 0; i < TEST_CHN_MAX; i++)
+    {
+        astChn[i].enType = PT_H264;
+        astChn[i].enMode = VIDEO_MODE_FRAME;
+        astChn[i].u32Fps = 0;
+        astChn[i].u32Width = 1920;
+        astChn[i].u32Height = 1080;
+    }
+    TEST_Setup(TEST_CHN_MAX, astChn, TEST_PIC_BUFFERS);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchStart(TEST_CHN_MAX, s_astParam));
+    usleep(200000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchReport(&stReport));
+    usleep(1000000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BenchReport(&stReport));
+    SAMPLE_COMM_VDEC_BenchStop();
+    TEST_CheckCounts(TEST_CHN_MAX);
+    printf("bench on %d channels of a decoder taking no time: %.0f pictures/s, %.0f Mbps, %.1f%% of a cpu\n",
+           TEST_CHN_MAX, stReport.fFps, stReport.fMbps, stReport.fProcessLoad);
+}
+
+int main(int argc, char *argv[])
+{
+    const HI_CHAR *pszDir = (argc > 1) ? argv[1] : "/tmp";
+    HI_CHAR acIdx[96];
+
+    snprintf(s_acH264, sizeof(s_acH264), "%s/vdec_bench_test.h264", pszDir);
+    snprintf(s_acMpeg4, sizeof(s_acMpeg4), "%s/vdec_bench_test.m4v", pszDir);
+    s_u32H264Len = TEST_WriteEs(s_acH264, PT_H264);
+    s_u32H264Hash = VDEC_STUB_Hash(0x811C9DC5, s_au8Es, s_u32H264Len);
+    if ((0 == s_u32H264Len) || (0 == TEST_WriteEs(s_acMpeg4, PT_MP4VIDEO)))
+    {
+        return 1;
+    }
+
+    TEST_Rates();
+    TEST_Content(VIDEO_MODE_FRAME);
+    TEST_Content(VIDEO_MODE_STREAM);
+    TEST_Errors();
+    TEST_Overhead();
+
+    remove(s_acH264);
+    remove(s_acMpeg4);
+    snprintf(acIdx, sizeof(acIdx), "%s.idx", s_acH264);
+    remove(acIdx);
+    snprintf(acIdx, sizeof(acIdx), "%s.idx", s_acMpeg4);
+    remove(acIdx);
+    printf("%s\n", (0 == s_s32Fail) ? "PASS" : "FAIL");
+    return (0 == s_s32Fail) ? 0 : 1;
+}
@@ -0,0 +1,1146 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_demux_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/05/30
+  Description   : checks the mp4 and ts demuxer of the vdec stream source on
+                  files muxed here from generated h264 / h265: plain mp4 with
+                  stco or co64, fragmented mp4 cut in its last fragment or
+                  ending in a short tfhd or tfdt, 2 byte nal lengths, b frames, ts
+                  and m2ts with a pts wrap, a doubled packet and bytes out of
+                  sync. Every frame has to
+                  come out as the start code stream with the pts it was
+                  muxed with, through SAMPLE_COMM_VDEC_SendStreamMmap and the
+                  feeder too. Then times indexing and getting the frames of
+                  an elementary stream, an mp4 and a ts of the same 1080p
+                  sized stream.
+                  usage: ./vdec_demux_test [dir]
+  History       :
+  1.Date        : 2016/05/30
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "sample_comm.h"
+#include "vdec_stub.h"
+
+#define TEST_FRAMES         100
+#define TEST_GOP            25
+#define TEST_TIMESCALE      90000
+#define TEST_TICKS          3600        /* 40ms */
+#define TEST_BENCH_FRAMES   1500
+#define TEST_MAX_FRAMES     TEST_BENCH_FRAMES
+
+static HI_S32 s_s32Fail = 0;
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d %s\n", __FUNCTION__, __LINE__, #cond); \
+            s_s32Fail++; \
+        } \
+    } while (0)
+
+/* a growing file image */
+typedef struct test_buf_s
+{
+    HI_U8 *pu8Data;
+    HI_U32 u32Len;
+    HI_U32 u32Size;
+}TEST_BUF_S;
+
+/* how a file is muxed */
+typedef struct test_mux_s
+{
+    PAYLOAD_TYPE_E enType;
+    HI_BOOL bFragment;
+    HI_BOOL bCo64;
+    HI_U32 u32NalLenSize;
+    HI_BOOL bBFrames;
+    HI_U32 u32CutBytes;                 /* taken off the end of the file */
+    HI_BOOL bM2ts;
+    HI_BOOL bDamage;                    /* ts: a doubled packet and bytes out of sync */
+    HI_U64 u64FirstPts;                 /* ts, 90kHz */
+    HI_BOOL bShortTfhd;                 /* fragmented: a last moof whose tfhd is shorter than its flags */
+    HI_BOOL bShortTfdt;                 /* fragmented: a last moof whose version 1 tfdt has 32 bits only */
+}TEST_MUX_S;
+
+/* the elementary stream and what the demuxer has to give for it */
+static HI_U8 *s_pu8Es;
+static HI_U32 s_u32EsLen;
+static HI_U32 s_au32Offset[TEST_MAX_FRAMES];
+static HI_U32 s_au32Len[TEST_MAX_FRAMES];
+static HI_BOOL s_abKey[TEST_MAX_FRAMES];
+static HI_U32 s_u32Frames;
+
+static TEST_BUF_S s_stExpect;
+static HI_U32 s_au32ExpOffset[TEST_MAX_FRAMES];
+static HI_U32 s_au32ExpLen[TEST_MAX_FRAMES];
+static HI_U64 s_au64ExpPts[TEST_MAX_FRAMES];
+static HI_U32 s_u32ExpFrames;
+
+static HI_CHAR s_acDir[64];
+
+static HI_U64 TEST_Us(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+/* anonymous resident memory of the process in KB, pages written in a private file mapping included */
+static HI_U32 TEST_RssAnonKb(HI_VOID)
+{
+    FILE *pFile = fopen("/proc/self/status", "r");
+    HI_CHAR acLine[128];
+    HI_U32 u32Kb = 0;
+
+    if (NULL == pFile)
+    {
+        return 0;
+    }
+    while (NULL != fgets(acLine, sizeof(acLine), pFile))
+    {
+        if (1 == sscanf(acLine, "RssAnon: %u", &u32Kb))
+        {
+            break;
+        }
+    }
+    fclose(pFile);
+    return u32Kb;
+}
+
+static HI_VOID TEST_Put(TEST_BUF_S *pstBuf, const HI_VOID *pData, HI_U32 u32Len)
+{
+    if (pstBuf->u32Len + u32Len > pstBuf->u32Size)
+    {
+        pstBuf->u32Size = (pstBuf->u32Len + u32Len) * 2;
+        pstBuf->pu8Data = (HI_U8 *)realloc(pstBuf->pu8Data, pstBuf->u32Size);
+    }
+    memcpy(pstBuf->pu8Data + pstBuf->u32Len, pData, u32Len);
+    pstBuf->u32Len += u32Len;
+}
+
+static HI_VOID TEST_PutN(TEST_BUF_S *pstBuf, HI_U64 u64Val, HI_U32 u32Bytes)
+{
+    HI_U8 au8Val[8];
+    HI_U32 i;
+
+    for (i = 0; i < u32Bytes; i++)
+    {
+        au8Val[i] = (HI_U8)(u64Val >> (8 * (u32Bytes - 1 - i)));
+    }
+    TEST_Put(pstBuf, au8Val, u32Bytes);
+}
+
+static HI_VOID TEST_Zero(TEST_BUF_S *pstBuf, HI_U32 u32Len)
+{
+    while (u32Len-- > 0)
+    {
+        TEST_PutN(pstBuf, 0, 1);
+    }
+}
+
+static HI_U32 TEST_BoxStart(TEST_BUF_S *pstBuf, const HI_CHAR *pszType)
+{
+    HI_U32 u32Pos = pstBuf->u32Len;
+
+    TEST_PutN(pstBuf, 0, 4);
+    TEST_Put(pstBuf, pszType, 4);
+    return u32Pos;
+}
+
+static HI_VOID TEST_BoxEnd(TEST_BUF_S *pstBuf, HI_U32 u32Pos)
+{
+    HI_U32 u32Size = pstBuf->u32Len - u32Pos;
+
+    pstBuf->pu8Data[u32Pos] = (HI_U8)(u32Size >> 24);
+    pstBuf->pu8Data[u32Pos + 1] = (HI_U8)(u32Size >> 16);
+    pstBuf->pu8Data[u32Pos + 2] = (HI_U8)(u32Size >> 8);
+    pstBuf->pu8Data[u32Pos + 3] = (HI_U8)u32Size;
+}
+
+static HI_VOID TEST_FullBox(TEST_BUF_S *pstBuf, const HI_CHAR *pszType, HI_U32 u32VerFlags, HI_U32 *pu32Pos)
+{
+    *pu32Pos = TEST_BoxStart(pstBuf, pszType);
+    TEST_PutN(pstBuf, u32VerFlags, 4);
+}
+
+static HI_U32 TEST_NalType(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Nal)
+{
+    return (PT_H264 == enType) ? (pu8Nal[0] & 0x1F) : ((pu8Nal[0] >> 1) & 0x3F);
+}
+
+static HI_BOOL TEST_IsParam(PAYLOAD_TYPE_E enType, const HI_U8 *pu8Nal)
+{
+    HI_U32 u32Type = TEST_NalType(enType, pu8Nal);
+
+    if (PT_H264 == enType)
+    {
+        return ((7 == u32Type) || (8 == u32Type)) ? HI_TRUE : HI_FALSE;
+    }
+    return ((u32Type >= 32) && (u32Type <= 34)) ? HI_TRUE : HI_FALSE;
+}
+
+/* the nals of access unit u32Frame, without their start codes */
+static HI_U32 TEST_Nals(HI_U32 u32Frame, const HI_U8 **ppu8Nal, HI_U32 *pu32NalLen, HI_U32 u32Max)
+{
+    const HI_U8 *pu8Au = s_pu8Es + s_au32Offset[u32Frame];
+    HI_U32 u32Len = s_au32Len[u32Frame];
+    HI_U32 u32Pos = SAMPLE_COMM_VDEC_FindStartCode(pu8Au, u32Len);
+    HI_U32 u32Next;
+    HI_U32 u32Nals = 0;
+
+    while ((u32Pos < u32Len) && (u32Nals < u32Max))
+    {
+        u32Next = u32Pos + 3 + SAMPLE_COMM_VDEC_FindStartCode(pu8Au + u32Pos + 3, u32Len - u32Pos - 3);
+        ppu8Nal[u32Nals] = pu8Au + u32Pos + 3;
+        pu32NalLen[u32Nals] = u32Next - u32Pos - 3;
+        u32Nals++;
+        u32Pos = u32Next;
+    }
+    return u32Nals;
+}
+
+static HI_VOID TEST_MakeStream(PAYLOAD_TYPE_E enType, HI_U32 u32Frames, HI_U32 u32Gop, HI_U32 u32ILen, HI_U32 u32PLen)
+{
+    VDEC_STUB_ES_CFG_S stCfg = {0, 0, 0, 0, 2, HI_FALSE};
+    HI_U32 u32Size = u32Frames * (u32ILen + 512) + 1024;
+
+    stCfg.u32Frames = u32Frames;
+    stCfg.u32Gop = u32Gop;
+    stCfg.u32IFrameLen = u32ILen;
+    stCfg.u32PFrameLen = u32PLen;
+    free(s_pu8Es);
+    s_pu8Es = (HI_U8 *)malloc(u32Size);
+    s_u32EsLen = VDEC_STUB_MakeEs(enType, &stCfg, s_pu8Es, u32Size, s_au32Offset, s_au32Len, s_abKey);
+    s_u32Frames = u32Frames;
+}
+
+/* display order of the frames muxed in decode order I P B B P B B ..., the gop of 25 is I and 8 P B B */
+static HI_U32 TEST_Display(HI_U32 u32Frame, HI_BOOL bBFrames)
+{
+    HI_U32 u32InGop = u32Frame % TEST_GOP;
+
+    if ((HI_TRUE != bBFrames) || (0 == u32InGop))
+    {
+        return u32Frame;
+    }
+    return (0 == (u32InGop - 1) % 3) ? u32Frame + 2 : u32Frame - 1;
+}
+
+static HI_VOID TEST_ExpectFrame(const HI_U8 *pu8Data, HI_U32 u32Len, HI_U64 u64Pts)
+{
+    s_au32ExpOffset[s_u32ExpFrames] = s_stExpect.u32Len;
+    s_au32ExpLen[s_u32ExpFrames] = u32Len;
+    s_au64ExpPts[s_u32ExpFrames] = u64Pts;
+    s_u32ExpFrames++;
+    TEST_Put(&s_stExpect, pu8Data, u32Len);
+}
+
+/* avcC or hvcC of the parameter sets of frame 0, which also go in front of every key frame */
+static HI_VOID TEST_Mp4Config(TEST_BUF_S *pstBuf, const TEST_MUX_S *pstMux, TEST_BUF_S *pstParam)
+{
+    const HI_U8 *apu8Nal[16];
+    HI_U32 au32NalLen[16];
+    HI_U32 u32Nals = TEST_Nals(0, apu8Nal, au32NalLen, 16);
+    HI_U32 u32Box;
+    HI_U32 u32Type;
+    HI_U32 u32Cnt;
+    HI_U32 i, j;
+
+    pstParam->u32Len = 0;
+    for (i = 0; i < u32Nals; i++)
+    {
+        if (HI_TRUE == TEST_IsParam(pstMux->enType, apu8Nal[i]))
+        {
+            TEST_PutN(pstParam, 1, 4);
+            TEST_Put(pstParam, apu8Nal[i], au32NalLen[i]);
+        }
+    }
+    if (PT_H264 == pstMux->enType)
+    {
+        u32Box = TEST_BoxStart(pstBuf, "avcC");
+        TEST_PutN(pstBuf, 1, 1);
+        for (i = 0; (i < u32Nals) && (7 != TEST_NalType(PT_H264, apu8Nal[i])); i++)
+        {
+        }
+        TEST_Put(pstBuf, apu8Nal[i] + 1, 3);
+        TEST_PutN(pstBuf, 0xFC | (pstMux->u32NalLenSize - 1), 1);
+        for (u32Type = 7; u32Type <= 8; u32Type++)
+        {
+            for (u32Cnt = 0, i = 0; i < u32Nals; i++)
+            {
+                u32Cnt += (u32Type == TEST_NalType(PT_H264, apu8Nal[i])) ? 1 : 0;
+            }
+            TEST_PutN(pstBuf, (7 == u32Type) ? (0xE0 | u32Cnt) : u32Cnt, 1);
+            for (i = 0; i < u32Nals; i++)
+            {
+                if (u32Type == TEST_NalType(PT_H264, apu8Nal[i]))
+                {
+                    TEST_PutN(pstBuf, au32NalLen[i], 2);
+                    TEST_Put(pstBuf, apu8Nal[i], au32NalLen[i]);
+                }
+            }
+        }
+    }
+    else
+    {
+        u32Box = TEST_BoxStart(pstBuf, "hvcC");
+        TEST_PutN(pstBuf, 1, 1);
+        TEST_Zero(pstBuf, 20);
+        TEST_PutN(pstBuf, 0x0C | (pstMux->u32NalLenSize - 1), 1);
+        TEST_PutN(pstBuf, 3, 1);
+        for (u32Type = 32; u32Type <= 34; u32Type++)
+        {
+            for (u32Cnt = 0, i = 0; i < u32Nals; i++)
+            {
+                u32Cnt += (u32Type == TEST_NalType(pstMux->enType, apu8Nal[i])) ? 1 : 0;
+            }
+            TEST_PutN(pstBuf, 0x80 | u32Type, 1);
+            TEST_PutN(pstBuf, u32Cnt, 2);
+            for (j = 0; j < u32Nals; j++)
+            {
+                if (u32Type == TEST_NalType(pstMux->enType, apu8Nal[j]))
+                {
+                    TEST_PutN(pstBuf, au32NalLen[j], 2);
+                    TEST_Put(pstBuf, apu8Nal[j], au32NalLen[j]);
+                }
+            }
+        }
+    }
+    TEST_BoxEnd(pstBuf, u32Box);
+}
+
+/* a sample: the nals without the parameter sets, with their lengths in front */
+static HI_VOID TEST_Mp4Sample(TEST_BUF_S *pstBuf, const TEST_MUX_S *pstMux, HI_U32 u32Frame, const TEST_BUF_S *pstParam)
+{
+    const HI_U8 *apu8Nal[16];
+    HI_U32 au32NalLen[16];
+    HI_U32 u32Nals = TEST_Nals(u32Frame, apu8Nal, au32NalLen, 16);
+    HI_U32 u32Start = s_stExpect.u32Len;
+    HI_U32 i;
+
+    if (HI_TRUE == s_abKey[u32Frame])
+    {
+        TEST_Put(&s_stExpect, pstParam->pu8Data, pstParam->u32Len);
+    }
+    for (i = 0; i < u32Nals; i++)
+    {
+        if (HI_TRUE == TEST_IsParam(pstMux->enType, apu8Nal[i]))
+        {
+            continue;
+        }
+        TEST_PutN(pstBuf, au32NalLen[i], pstMux->u32NalLenSize);
+        TEST_Put(pstBuf, apu8Nal[i], au32NalLen[i]);
+        TEST_PutN(&s_stExpect, 1, 4);
+        TEST_Put(&s_stExpect, apu8Nal[i], au32NalLen[i]);
+    }
+    s_au32ExpOffset[s_u32ExpFrames] = u32Start;
+    s_au32ExpLen[s_u32ExpFrames] = s_stExpect.u32Len - u32Start;
+    s_au64ExpPts[s_u32ExpFrames] = (HI_U64)TEST_Display(u32Frame, pstMux->bBFrames) * 40000;
+    s_u32ExpFrames++;
+}
+
+static HI_VOID TEST_Mp4Trak(TEST_BUF_S *pstBuf, const TEST_MUX_S *pstMux, const HI_U32 *pu32Chunk, HI_U32 u32Chunks,
+                            const HI_U32 *pu32SampleLen, TEST_BUF_S *pstParam)
+{
+    HI_U32 u32Trak, u32Mdia, u32Minf, u32Stbl, u32Box, u32Entry;
+    HI_U32 u32Samples = (HI_TRUE == pstMux->bFragment) ? 0 : s_u32Frames;
+    HI_U32 u32Keys = 0;
+    HI_U32 i;
+
+    u32Trak = TEST_BoxStart(pstBuf, "trak");
+    TEST_FullBox(pstBuf, "tkhd", 3, &u32Box);
+    TEST_PutN(pstBuf, 0, 8);
+    TEST_PutN(pstBuf, 1, 4);            /* track_ID */
+    TEST_Zero(pstBuf, 68);
+    TEST_BoxEnd(pstBuf, u32Box);
+
+    u32Mdia = TEST_BoxStart(pstBuf, "mdia");
+    TEST_FullBox(pstBuf, "mdhd", 0, &u32Box);
+    TEST_PutN(pstBuf, 0, 8);
+    TEST_PutN(pstBuf, TEST_TIMESCALE, 4);
+    TEST_PutN(pstBuf, (HI_U64)u32Samples * TEST_TICKS, 4);
+    TEST_PutN(pstBuf, 0x55C40000, 4);
+    TEST_BoxEnd(pstBuf, u32Box);
+    TEST_FullBox(pstBuf, "hdlr", 0, &u32Box);
+    TEST_PutN(pstBuf, 0, 4);
+    TEST_Put(pstBuf, "vide", 4);
+    TEST_Zero(pstBuf, 13);
+    TEST_BoxEnd(pstBuf, u32Box);
+
+    u32Minf = TEST_BoxStart(pstBuf, "minf");
+    u32Stbl = TEST_BoxStart(pstBuf, "stbl");
+    TEST_FullBox(pstBuf, "stsd", 0, &u32Box);
+    TEST_PutN(pstBuf, 1, 4);
+    u32Entry = TEST_BoxStart(pstBuf, (PT_H264 == pstMux->enType) ? "avc1" : "hvc1");
+    TEST_Zero(pstBuf, 6);
+    TEST_PutN(pstBuf, 1, 2);
+    TEST_Zero(pstBuf, 16);
+    TEST_PutN(pstBuf, 1920, 2);
+    TEST_PutN(pstBuf, 1080, 2);
+    TEST_PutN(pstBuf, 0x00480000, 4);
+    TEST_PutN(pstBuf, 0x00480000, 4);
+    TEST_PutN(pstBuf, 0, 4);
+    TEST_PutN(pstBuf, 1, 2);
+    TEST_Zero(pstBuf, 32);
+    TEST_PutN(pstBuf, 0x18, 2);
+    TEST_PutN(pstBuf, 0xFFFF, 2);
+    TEST_Mp4Config(pstBuf, pstMux, pstParam);
+    TEST_BoxEnd(pstBuf, u32Entry);
+    TEST_BoxEnd(pstBuf, u32Box);
+
+    TEST_FullBox(pstBuf, "stts", 0, &u32Box);
+    TEST_PutN(pstBuf, (0 == u32Samples) ? 0 : 1, 4);
+    if (0 != u32Samples)
+    {
+        TEST_PutN(pstBuf, u32Samples, 4);
+        TEST_PutN(pstBuf, TEST_TICKS, 4);
+    }
+    TEST_BoxEnd(pstBuf, u32Box);
+    if ((0 != u32Samples) && (HI_TRUE == pstMux->bBFrames))
+    {
+        /* an offset per sample, one tick of shift so that none is negative */
+        TEST_FullBox(pstBuf, "ctts", 0, &u32Box);
+        TEST_PutN(pstBuf, u32Samples, 4);
+        for (i = 0; i < u32Samples; i++)
+        {
+            TEST_PutN(pstBuf, 1, 4);
+            TEST_PutN(pstBuf, (TEST_Display(i, HI_TRUE) + 1 - i) * TEST_TICKS, 4);
+        }
+        TEST_BoxEnd(pstBuf, u32Box);
+    }
+    if (0 != u32Samples)
+    {
+        TEST_FullBox(pstBuf, "stss", 0, &u32Box);
+        for (i = 0; i < u32Samples; i++)
+        {
+            u32Keys += s_abKey[i] ? 1 : 0;
+        }
+        TEST_PutN(pstBuf, u32Keys, 4);
+        for (i = 0; i < u32Samples; i++)
+        {
+            if (s_abKey[i])
+            {
+                TEST_PutN(pstBuf, i + 1, 4);
+            }
+        }
+        TEST_BoxEnd(pstBuf, u32Box);
+    }
+    TEST_FullBox(pstBuf, "stsz", 0, &u32Box);
+    TEST_PutN(pstBuf, 0, 4);
+    TEST_PutN(pstBuf, u32Samples, 4);
+    for (i = 0; i < u32Samples; i++)
+    {
+        TEST_PutN(pstBuf, pu32SampleLen[i], 4);
+    }
+    TEST_BoxEnd(pstBuf, u32Box);
+    /* chunks of 4 samples up to sample 40, of 6 after */
+    TEST_FullBox(pstBuf, "stsc", 0, &u32Box);
+    TEST_PutN(pstBuf, (0 == u32Samples) ? 0 : 2, 4);
+    if (0 != u32Samples)
+    {
+        TEST_PutN(pstBuf, 1, 4);
+        TEST_PutN(pstBuf, 4, 4);
+        TEST_PutN(pstBuf, 1, 4);
+        TEST_PutN(pstBuf, 11, 4);
+        TEST_PutN(pstBuf, 6, 4);
+        TEST_PutN(pstBuf, 1, 4);
+    }
+    TEST_BoxEnd(pstBuf, u32Box);
+    TEST_FullBox(pstBuf, pstMux->bCo64 ? "co64" : "stco", 0, &u32Box);
+    TEST_PutN(pstBuf, u32Chunks, 4);
+    for (i = 0; i < u32Chunks; i++)
+    {
+        TEST_PutN(pstBuf, pu32Chunk[i], pstMux->bCo64 ? 8 : 4);
+    }
+    TEST_BoxEnd(pstBuf, u32Box);
+    TEST_BoxEnd(pstBuf, u32Stbl);
+    TEST_BoxEnd(pstBuf, u32Minf);
+    TEST_BoxEnd(pstBuf, u32Mdia);
+    TEST_BoxEnd(pstBuf, u32Trak);
+}
+
+/* plain: ftyp, mdat with 16 bytes between the chunks, moov at the end as a recorder writes it.
+   fragmented: ftyp, moov with mvex, a moof and mdat per gop */
+static HI_VOID TEST_MakeMp4(const TEST_MUX_S *pstMux, TEST_BUF_S *pstFile)
+{
+    static HI_U32 s_au32Chunk[TEST_MAX_FRAMES];
+    static HI_U32 s_au32SampleLen[TEST_MAX_FRAMES];
+    TEST_BUF_S stParam = {NULL, 0, 0};
+    TEST_BUF_S stMoov = {NULL, 0, 0};
+    HI_U32 u32Chunks = 0;
+    HI_U32 u32Box, u32Moof, u32Traf, u32Trun, u32Mdat, u32Mvex;
+    HI_U32 u32Pos, u32Gop, u32Frame, u32End;
+    HI_U32 i;
+
+    pstFile->u32Len = 0;
+    s_stExpect.u32Len = 0;
+    s_u32ExpFrames = 0;
+    u32Box = TEST_BoxStart(pstFile, "ftyp");
+    TEST_Put(pstFile, "isom\0\0\x02\0isomiso2avc1mp41", 24);
+    TEST_BoxEnd(pstFile, u32Box);
+
+    /* the config first, the samples need the parameter sets it holds */
+    TEST_Mp4Config(&stMoov, pstMux, &stParam);
+
+    if (HI_TRUE != pstMux->bFragment)
+    {
+        u32Mdat = TEST_BoxStart(pstFile, "mdat");
+        for (i = 0; i < s_u32Frames; i++)
+        {
+            if ((i < 40) ? (0 == i % 4) : (0 == (i - 40) % 6))
+            {
+                TEST_Put(pstFile, "----------------", 16);
+                s_au32Chunk[u32Chunks++] = pstFile->u32Len;
+            }
+            u32Pos = pstFile->u32Len;
+            TEST_Mp4Sample(pstFile, pstMux, i, &stParam);
+            s_au32SampleLen[i] = pstFile->u32Len - u32Pos;
+        }
+        TEST_BoxEnd(pstFile, u32Mdat);
+        u32Box = TEST_BoxStart(pstFile, "moov");
+        TEST_Mp4Trak(pstFile, pstMux, s_au32Chunk, u32Chunks, s_au32SampleLen, &stParam);
+        TEST_BoxEnd(pstFile, u32Box);
+    }
+    else
+    {
+        u32Box = TEST_BoxStart(pstFile, "moov");
+        TEST_Mp4Trak(pstFile, pstMux, NULL, 0, NULL, &stParam);
+        u32Mvex = TEST_BoxStart(pstFile, "mvex");
+        TEST_FullBox(pstFile, "trex", 0, &u32Pos);
+        TEST_PutN(pstFile, 1, 4);
+        TEST_PutN(pstFile, 1, 4);
+        TEST_PutN(pstFile, TEST_TICKS, 4);
+        TEST_PutN(pstFile, 0, 4);
+        TEST_PutN(pstFile, 0x01010000, 4);  /* non sync, depends on others */
+        TEST_BoxEnd(pstFile, u32Pos);
+        TEST_BoxEnd(pstFile, u32Mvex);
+        TEST_BoxEnd(pstFile, u32Box);
+
+        for (u32Gop = 0; u32Gop * TEST_GOP < s_u32Frames; u32Gop++)
+        {
+            u32Frame = u32Gop * TEST_GOP;
+            u32End = MIN2(u32Frame + TEST_GOP, s_u32Frames);
+            u32Moof = TEST_BoxStart(pstFile, "moof");
+            TEST_FullBox(pstFile, "mfhd", 0, &u32Box);
+            TEST_PutN(pstFile, u32Gop + 1, 4);
+            TEST_BoxEnd(pstFile, u32Box);
+            u32Traf = TEST_BoxStart(pstFile, "traf");
+            TEST_FullBox(pstFile, "tfhd", 0x020000, &u32Box);  /* default-base-is-moof */
+            TEST_PutN(pstFile, 1, 4);
+            TEST_BoxEnd(pstFile, u32Box);
+            TEST_FullBox(pstFile, "tfdt", 0x01000000, &u32Box);
+            TEST_PutN(pstFile, (HI_U64)u32Frame * TEST_TICKS, 8);
+            TEST_BoxEnd(pstFile, u32Box);
+            /* data offset, first sample flags, sizes and composition offsets */
+            TEST_FullBox(pstFile, "trun", 0x000A05, &u32Trun);
+            TEST_PutN(pstFile, u32End - u32Frame, 4);
+            u32Pos = pstFile->u32Len;
+            TEST_PutN(pstFile, 0, 4);
+            TEST_PutN(pstFile, 0x02000000, 4);
+            for (i = u32Frame; i < u32End; i++)
+            {
+                TEST_PutN(pstFile, 0, 4);
+                TEST_PutN(pstFile, (TEST_Display(i, pstMux->bBFrames) + 1 - i) * TEST_TICKS, 4);
+            }
+            TEST_BoxEnd(pstFile, u32Trun);
+            TEST_BoxEnd(pstFile, u32Traf);
+            TEST_BoxEnd(pstFile, u32Moof);
+
+            u32Mdat = TEST_BoxStart(pstFile, "mdat");
+            pstFile->pu8Data[u32Pos] = (HI_U8)((pstFile->u32Len - u32Moof) >> 24);
+            pstFile->pu8Data[u32Pos + 1] = (HI_U8)((pstFile->u32Len - u32Moof) >> 16);
+            pstFile->pu8Data[u32Pos + 2] = (HI_U8)((pstFile->u32Len - u32Moof) >> 8);
+            pstFile->pu8Data[u32Pos + 3] = (HI_U8)(pstFile->u32Len - u32Moof);
+            for (i = u32Frame; i < u32End; i++)
+            {
+                u32Box = pstFile->u32Len;
+                TEST_Mp4Sample(pstFile, pstMux, i, &stParam);
+                u32Box = pstFile->u32Len - u32Box;
+                /* the size of the sample in its trun entry */
+                u32Trun = u32Pos + 8 + (i - u32Frame) * 8;
+                pstFile->pu8Data[u32Trun] = (HI_U8)(u32Box >> 24);
+                pstFile->pu8Data[u32Trun + 1] = (HI_U8)(u32Box >> 16);
+                pstFile->pu8Data[u32Trun + 2] = (HI_U8)(u32Box >> 8);
+                pstFile->pu8Data[u32Trun + 3] = (HI_U8)u32Box;
+            }
+            TEST_BoxEnd(pstFile, u32Mdat);
+        }
+        if (HI_TRUE == pstMux->bShortTfhd)
+        {
+            /* sample description index, default duration, size and flags announced, none there;
+               a free box puts the end of the tfhd, and of the file, on a page boundary */
+            u32Pos = TEST_BoxStart(pstFile, "free");
+            TEST_Zero(pstFile, (4096 - (pstFile->u32Len + 32) % 4096) % 4096);
+            TEST_BoxEnd(pstFile, u32Pos);
+            u32Moof = TEST_BoxStart(pstFile, "moof");
+            u32Traf = TEST_BoxStart(pstFile, "traf");
+            TEST_FullBox(pstFile, "tfhd", 0x00003A, &u32Box);
+            TEST_PutN(pstFile, 1, 4);
+            TEST_BoxEnd(pstFile, u32Box);
+            TEST_BoxEnd(pstFile, u32Traf);
+            TEST_BoxEnd(pstFile, u32Moof);
+        }
+        if (HI_TRUE == pstMux->bShortTfdt)
+        {
+            /* a whole tfhd, then a version 1 tfdt ending after 4 of its 8 time bytes, on a page boundary */
+            u32Pos = TEST_BoxStart(pstFile, "free");
+            TEST_Zero(pstFile, (4096 - (pstFile->u32Len + 48) % 4096) % 4096);
+            TEST_BoxEnd(pstFile, u32Pos);
+            u32Moof = TEST_BoxStart(pstFile, "moof");
+            u32Traf = TEST_BoxStart(pstFile, "traf");
+            TEST_FullBox(pstFile, "tfhd", 0, &u32Box);
+            TEST_PutN(pstFile, 1, 4);
+            TEST_BoxEnd(pstFile, u32Box);
+            TEST_FullBox(pstFile, "tfdt", 0x01000000, &u32Box);
+            TEST_PutN(pstFile, 0, 4);
+            TEST_BoxEnd(pstFile, u32Box);
+            TEST_BoxEnd(pstFile, u32Traf);
+            TEST_BoxEnd(pstFile, u32Moof);
+        }
+    }
+
+    /* a cut file keeps the samples that are whole, the caller expects fewer frames */
+    pstFile->u32Len -= pstMux->u32CutBytes;
+    free(stParam.pu8Data);
+    free(stMoov.pu8Data);
+}
+
+static HI_U32 TEST_Crc(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 u32Crc = 0xFFFFFFFF;
+    HI_U32 i, j;
+
+    for (i = 0; i < u32Len; i++)
+    {
+        u32Crc ^= (HI_U32)pu8Data[i] << 24;
+        for (j = 0; j < 8; j++)
+        {
+            u32Crc = (u32Crc & 0x80000000) ? (u32Crc << 1) ^ 0x04C11DB7 : (u32Crc << 1);
+        }
+    }
+    return u32Crc;
+}
+
+static HI_VOID TEST_TsPacket(TEST_BUF_S *pstFile, const TEST_MUX_S *pstMux, const HI_U8 *pu8Pkt)
+{
+    if (HI_TRUE == pstMux->bM2ts)
+    {
+        TEST_PutN(pstFile, 0x12345678, 4);
+    }
+    TEST_Put(pstFile, pu8Pkt, 188);
+}
+
+static HI_VOID TEST_TsSection(TEST_BUF_S *pstFile, const TEST_MUX_S *pstMux, HI_U32 u32Pid, HI_U32 *pu32Cc,
+                              const HI_U8 *pu8Sec, HI_U32 u32Len)
+{
+    HI_U8 au8Pkt[188];
+    HI_U32 u32Crc = TEST_Crc(pu8Sec, u32Len);
+
+    memset(au8Pkt, 0xFF, sizeof(au8Pkt));
+    au8Pkt[0] = 0x47;
+    au8Pkt[1] = 0x40 | (u32Pid >> 8);
+    au8Pkt[2] = u32Pid & 0xFF;
+    au8Pkt[3] = 0x10 | ((*pu32Cc)++ & 0xF);
+    au8Pkt[4] = 0;
+    memcpy(au8Pkt + 5, pu8Sec, u32Len);
+    au8Pkt[5 + u32Len] = (HI_U8)(u32Crc >> 24);
+    au8Pkt[6 + u32Len] = (HI_U8)(u32Crc >> 16);
+    au8Pkt[7 + u32Len] = (HI_U8)(u32Crc >> 8);
+    au8Pkt[8 + u32Len] = (HI_U8)u32Crc;
+    TEST_TsPacket(pstFile, pstMux, au8Pkt);
+}
+
+static HI_VOID TEST_TsPts(HI_U8 *pu8Out, HI_U32 u32Prefix, HI_U64 u64Pts)
+{
+    u64Pts &= (1ULL << 33) - 1;
+    pu8Out[0] = (HI_U8)((u32Prefix << 4) | ((u64Pts >> 29) & 0x0E) | 1);
+    pu8Out[1] = (HI_U8)(u64Pts >> 22);
+    pu8Out[2] = (HI_U8)(((u64Pts >> 14) & 0xFE) | 1);
+    pu8Out[3] = (HI_U8)(u64Pts >> 7);
+    pu8Out[4] = (HI_U8)(((u64Pts << 1) & 0xFE) | 1);
+}
+
+/* pat and pmt before every key frame, an audio stream first in the pmt and a few of its packets,
+   every access unit a pes with pts (and dts with b frames) */
+static HI_VOID TEST_MakeTs(const TEST_MUX_S *pstMux, TEST_BUF_S *pstFile)
+{
+    static const HI_U8 au8Pat[] = {0x00, 0xB0, 0x0D, 0x00, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x10};
+    HI_U8 au8Pmt[] = {0x02, 0xB0, 0x17, 0x00, 0x01, 0xC1, 0x00, 0x00, 0xE1, 0x00, 0xF0, 0x00,
+                      0x0F, 0xE1, 0x01, 0xF0, 0x00, 0x1B, 0xE1, 0x00, 0xF0, 0x00};
+    HI_U8 au8Pkt[188];
+    HI_U8 au8Pes[19];
+    HI_U32 u32PatCc = 0, u32PmtCc = 0, u32VidCc = 0, u32AudCc = 0;
+    HI_U32 u32Frame, u32PesHead, u32Pos, u32Left, u32Room, u32Af, u32Take;
+    HI_U32 u32Pkts = 0;
+    HI_U64 u64Pts, u64Dts;
+    HI_BOOL bFirst;
+
+    pstFile->u32Len = 0;
+    s_stExpect.u32Len = 0;
+    s_u32ExpFrames = 0;
+    au8Pmt[17] = (PT_H264 == pstMux->enType) ? 0x1B : 0x24;
+    for (u32Frame = 0; u32Frame < s_u32Frames; u32Frame++)
+    {
+        if (s_abKey[u32Frame])
+        {
+            TEST_TsSection(pstFile, pstMux, 0, &u32PatCc, au8Pat, sizeof(au8Pat));
+            TEST_TsSection(pstFile, pstMux, 0x10, &u32PmtCc, au8Pmt, sizeof(au8Pmt));
+            /* audio, not for the demuxer */
+            memset(au8Pkt, 0xAA, sizeof(au8Pkt));
+            au8Pkt[0] = 0x47;
+            au8Pkt[1] = 0x41;
+            au8Pkt[2] = 0x01;
+            au8Pkt[3] = 0x10 | (u32AudCc++ & 0xF);
+            memcpy(au8Pkt + 4, "\x00\x00\x01\xC0\x00\xB4\x80\x80\x05", 9);
+            TEST_TsPts(au8Pkt + 13, 2, pstMux->u64FirstPts + u32Frame * TEST_TICKS);
+            TEST_TsPacket(pstFile, pstMux, au8Pkt);
+        }
+
+        u64Dts = pstMux->u64FirstPts + (HI_U64)u32Frame * TEST_TICKS;
+        u64Pts = pstMux->u64FirstPts + (HI_U64)(TEST_Display(u32Frame, pstMux->bBFrames) + 1) * TEST_TICKS;
+        memcpy(au8Pes, "\x00\x00\x01\xE0\x00\x00\x80", 7);
+        au8Pes[7] = (HI_TRUE == pstMux->bBFrames) ? 0xC0 : 0x80;
+        au8Pes[8] = (HI_TRUE == pstMux->bBFrames) ? 10 : 5;
+        TEST_TsPts(au8Pes + 9, (HI_TRUE == pstMux->bBFrames) ? 3 : 2, u64Pts);
+        TEST_TsPts(au8Pes + 14, 1, u64Dts);
+        u32PesHead = 9 + au8Pes[8];
+
+        TEST_ExpectFrame(s_pu8Es + s_au32Offset[u32Frame], s_au32Len[u32Frame],
+                         (HI_U64)TEST_Display(u32Frame, pstMux->bBFrames) * 40000);
+        u32Pos = 0;
+        u32Left = u32PesHead + s_au32Len[u32Frame];
+        bFirst = HI_TRUE;
+        while (u32Left > 0)
+        {
+            memset(au8Pkt, 0xFF, sizeof(au8Pkt));
+            au8Pkt[0] = 0x47;
+            au8Pkt[1] = (bFirst ? 0x40 : 0x00) | 0x01;
+            au8Pkt[2] = 0x00;
+            u32Af = 0;
+            if (bFirst && s_abKey[u32Frame])
+            {
+                /* random access with a pcr */
+                au8Pkt[4] = 7;
+                au8Pkt[5] = 0x50;
+                memset(au8Pkt + 6, 0, 6);
+                u32Af = 8;
+            }
+            u32Room = 184 - u32Af;
+            if (u32Left < u32Room)
+            {
+                /* stuffing in the adaptation field to fill the packet */
+                if ((0 == u32Af) && (u32Left < 183))
+                {
+                    au8Pkt[5] = 0x00;
+                }
+                u32Af = 184 - u32Left;
+                au8Pkt[4] = (HI_U8)(u32Af - 1);
+                u32Room = u32Left;
+            }
+            au8Pkt[3] = ((u32Af > 0) ? 0x30 : 0x10) | (u32VidCc++ & 0xF);
+            u32Take = 0;
+            if (bFirst)
+            {
+                memcpy(au8Pkt + 4 + u32Af, au8Pes, u32PesHead);
+                u32Take = u32PesHead;
+            }
+            memcpy(au8Pkt + 4 + u32Af + u32Take, s_pu8Es + s_au32Offset[u32Frame] + u32Pos, u32Room - u32Take);
+            u32Pos += u32Room - u32Take;
+            u32Left -= u32Room;
+            TEST_TsPacket(pstFile, pstMux, au8Pkt);
+            u32Pkts++;
+            if ((HI_TRUE == pstMux->bDamage) && (7 == u32Pkts))
+            {
+                /* the same packet again, as a mux may send it */
+                TEST_TsPacket(pstFile, pstMux, au8Pkt);
+            }
+            if ((HI_TRUE == pstMux->bDamage) && (41 == u32Pkts))
+            {
+                TEST_Put(pstFile, "\x47\x00\x47\x13\x47", 5);
+            }
+            bFirst = HI_FALSE;
+        }
+    }
+}
+
+static HI_VOID TEST_Path(HI_CHAR *pszFile, HI_U32 u32Size, const HI_CHAR *pszName)
+{
+    snprintf(pszFile, u32Size, "%s/%s", s_acDir, pszName);
+}
+
+static HI_S32 TEST_Write(const HI_CHAR *pszFile, const TEST_BUF_S *pstFile)
+{
+    FILE *pFile = fopen(pszFile, "wb");
+
+    if (NULL == pFile)
+    {
+        printf("can't write %s\n", pszFile);
+        return HI_FAILURE;
+    }
+    fwrite(pstFile->pu8Data, 1, pstFile->u32Len, pFile);
+    fclose(pFile);
+    return HI_SUCCESS;
+}
+
+/* the demuxer on the file mapped right in front of an inaccessible page: reading past the end faults */
+static HI_VOID TEST_Guarded(const HI_CHAR *pszName, const HI_CHAR *pszFile, PAYLOAD_TYPE_E enType, HI_U32 u32Expect)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    SAMPLE_VDEC_FRAME_S *pstIndex = NULL;
+    PAYLOAD_TYPE_E enFileType;
+    VDEC_STREAM_S stStream;
+    HI_U32 u32Page = (HI_U32)sysconf(_SC_PAGESIZE);
+    HI_U32 u32Size, u32Area;
+    HI_U32 u32Frames = 0;
+    HI_U32 u32Bad = 0;
+    HI_U8 *pu8Area;
+    FILE *pFile;
+    HI_U32 i;
+
+    pFile = fopen(pszFile, "rb");
+    if (NULL == pFile)
+    {
+        TEST_CHECK(0);
+        return;
+    }
+    fseek(pFile, 0, SEEK_END);
+    u32Size = (HI_U32)ftell(pFile);
+    u32Area = (u32Size + u32Page - 1) / u32Page * u32Page + u32Page;
+    pu8Area = (HI_U8 *)mmap(NULL, u32Area, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((MAP_FAILED == pu8Area)
+        || (MAP_FAILED == mmap(pu8Area, u32Size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fileno(pFile), 0)))
+    {
+        TEST_CHECK(0);
+        fclose(pFile);
+        return;
+    }
+    fclose(pFile);
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_DemuxOpen(1, pu8Area, u32Size, 40000, &enFileType, &pstIndex, &u32Frames));
+    TEST_CHECK((enType == enFileType) && (u32Expect == u32Frames));
+    pstFrame = pstIndex;
+    for (i = 0; (NULL != pstFrame) && (i < u32Frames) && (i < u32Expect); i++)
+    {
+        if ((HI_SUCCESS != SAMPLE_COMM_VDEC_DemuxGetFrame(1, i, &stStream)) || (stStream.u32Len != s_au32ExpLen[i])
+            || (0 != memcmp(stStream.pu8Addr, s_stExpect.pu8Data + s_au32ExpOffset[i], s_au32ExpLen[i])))
+        {
+            u32Bad++;
+        }
+    }
+    if (0 != u32Bad)
+    {
+        printf("%s: %u frames differ on the guarded mapping\n", pszName, u32Bad);
+    }
+    TEST_CHECK(0 == u32Bad);
+    SAMPLE_COMM_VDEC_DemuxClose(1);
+    free(pstIndex);
+    munmap(pu8Area, u32Area);
+}
+
+/* every frame twice (the second time after the lengths became start codes) and through the send thread */
+static HI_VOID TEST_CheckFile(const HI_CHAR *pszName, const HI_CHAR *pszFile, PAYLOAD_TYPE_E enType, HI_U32 u32Expect)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    VdecThreadParam stParam;
+    VDEC_STUB_STAT_S stStat;
+    VDEC_STREAM_S stStream;
+    HI_U64 au64Pts[TEST_FRAMES];
+    HI_U32 u32Frames = 0;
+    HI_U32 u32Keys = 0;
+    HI_U32 u32Bad = 0;
+    HI_U32 u32Pass, i;
+
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceOpen(0, pszFile,
+                                                         (PT_H264 == enType) ? SAMPLE_PT_H265 : PT_H264, 40000));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceOpen(0, pszFile, enType, 40000));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetIndex(0, &pstFrame, &u32Frames));
+    TEST_CHECK(u32Expect == u32Frames);
+    for (u32Pass = 0; u32Pass < 2; u32Pass++)
+    {
+        for (i = 0; (i < u32Frames) && (i < u32Expect); i++)
+        {
+            u32Keys += ((0 == u32Pass) && (HI_TRUE == pstFrame[i].bKey)) ? 1 : 0;
+            if ((HI_SUCCESS != SAMPLE_COMM_VDEC_SourceGetFrame(0, i, &stStream))
+                || (stStream.u32Len != s_au32ExpLen[i])
+                || (0 != memcmp(stStream.pu8Addr, s_stExpect.pu8Data + s_au32ExpOffset[i], s_au32ExpLen[i]))
+                || (stStream.u64PTS != s_au64ExpPts[i]) || (pstFrame[i].bKey != s_abKey[i]))
+            {
+                if (0 == u32Bad++)
+                {
+                    printf("%s: frame %u len %u/%u pts %llu/%llu key %d/%d\n", pszName, i, stStream.u32Len,
+                           s_au32ExpLen[i], (unsigned long long)stStream.u64PTS,
+                           (unsigned long long)s_au64ExpPts[i], pstFrame[i].bKey, s_abKey[i]);
+                }
+            }
+        }
+    }
+    TEST_CHECK(0 == u32Bad);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    memset(&stParam, 0, sizeof(stParam));
+    stParam.s32ChnId = 0;
+    stParam.enType = enType;
+    snprintf(stParam.cFileName, sizeof(stParam.cFileName), "%s", pszFile);
+    stParam.s32StreamMode = VIDEO_MODE_FRAME;
+    stParam.s32IntervalTime = 1;
+    stParam.eCtrlSinal = VDEC_CTRL_START;
+    stParam.u64PtsInit = 1000;
+    stParam.u64PtsIncrease = 40000;
+    VDEC_STUB_Reset();
+    VDEC_STUB_SetDecoder(0, 0, 64 * 1024 * 1024);
+    SAMPLE_COMM_VDEC_SendStreamMmap(&stParam);
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStat));
+    TEST_CHECK(u32Expect == stStat.u64Frames);
+    TEST_CHECK(VDEC_STUB_Hash(0x811C9DC5, s_stExpect.pu8Data,
+                              s_au32ExpOffset[u32Expect - 1] + s_au32ExpLen[u32Expect - 1]) == stStat.u32Hash);
+    u32Frames = VDEC_STUB_GetPts(0, au64Pts, TEST_FRAMES);
+    for (i = 0; (i < u32Frames) && (i < u32Expect); i++)
+    {
+        TEST_CHECK(1000 + s_au64ExpPts[i] == au64Pts[i]);
+    }
+    printf("%-40s %3u frames %2u key, %7u bytes out\n", pszName, u32Expect, u32Keys,
+           s_au32ExpOffset[u32Expect - 1] + s_au32ExpLen[u32Expect - 1]);
+}
+
+static HI_VOID TEST_Case(const HI_CHAR *pszName, const TEST_MUX_S *pstMux, HI_BOOL bTs, HI_U32 u32Expect)
+{
+    TEST_BUF_S stFile = {NULL, 0, 0};
+    HI_CHAR acFile[96];
+
+    if (HI_TRUE == bTs)
+    {
+        TEST_MakeTs(pstMux, &stFile);
+    }
+    else
+    {
+        TEST_MakeMp4(pstMux, &stFile);
+    }
+    TEST_Path(acFile, sizeof(acFile), "vdec_demux_test.bin");
+    if (HI_SUCCESS == TEST_Write(acFile, &stFile))
+    {
+        TEST_Guarded(pszName, acFile, pstMux->enType, u32Expect);
+        TEST_CheckFile(pszName, acFile, pstMux->enType, u32Expect);
+        remove(acFile);
+    }
+    free(stFile.pu8Data);
+}
+
+/* b frames in decode order paced by the feeder: every frame, on time */
+static HI_VOID TEST_Feeder(HI_VOID)
+{
+    TEST_MUX_S stMux = {PT_H264, HI_TRUE, HI_FALSE, 4, HI_TRUE, 0, HI_FALSE, HI_FALSE, 0};
+    SAMPLE_VDEC_FEEDER_STAT_S stStat;
+    VDEC_STUB_STAT_S stStubStat;
+    VdecThreadParam stParam;
+    TEST_BUF_S stFile = {NULL, 0, 0};
+    HI_U64 u64Us;
+    HI_U64 u64Until;
+
+    TEST_MakeMp4(&stMux, &stFile);
+    memset(&stParam, 0, sizeof(stParam));
+    TEST_Path(stParam.cFileName, sizeof(stParam.cFileName), "vdec_demux_test.mp4");
+    if (HI_SUCCESS != TEST_Write(stParam.cFileName, &stFile))
+    {
+        free(stFile.pu8Data);
+        return;
+    }
+    stParam.enType = PT_H264;
+    stParam.s32StreamMode = VIDEO_MODE_FRAME;
+    stParam.s32IntervalTime = 1;
+    stParam.eCtrlSinal = VDEC_CTRL_START;
+    stParam.u64PtsIncrease = 40000;
+    VDEC_STUB_Reset();
+
+    u64Us = TEST_Us();
+    u64Until = u64Us + 10000000;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStart(1, &stParam, 1));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederSetSpeed(0, 400));
+    do
+    {
+        usleep(10000);
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederGetStat(0, &stStat));
+    } while ((HI_TRUE != stStat.bEnd) && (TEST_Us() < u64Until));
+    u64Us = TEST_Us() - u64Us;
+    SAMPLE_COMM_VDEC_FeederStop();
+
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStubStat));
+    TEST_CHECK(TEST_FRAMES == stStubStat.u64Frames);
+    TEST_CHECK(VDEC_STUB_Hash(0x811C9DC5, s_stExpect.pu8Data, s_stExpect.u32Len) == stStubStat.u32Hash);
+    TEST_CHECK(stStat.u32Underflow <= 2);
+    /* the last frame is shown at 101 * 40ms, sent at 99 * 40ms */
+    TEST_CHECK((u64Us > 950000) && (u64Us < 1500000));
+    printf("fragmented mp4 with b frames fed at 4x: %llu ms for 1000 ms of frames, %u underflows\n",
+           (unsigned long long)u64Us / 1000, stStat.u32Underflow);
+    remove(stParam.cFileName);
+    free(stFile.pu8Data);
+}
+
+/* open, and every frame twice: the first time page faults count too. The mapping has to stay
+   clean: what the channel keeps in memory may not grow with the file */
+static HI_VOID TEST_BenchFile(const HI_CHAR *pszName, const HI_CHAR *pszFile, PAYLOAD_TYPE_E enType, HI_U32 u32Bytes)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    VDEC_STREAM_S stStream;
+    HI_U64 u64Open, u64Cold, u64Warm;
+    HI_U64 u64Out = 0;
+    HI_U32 u32Frames = 0;
+    HI_U32 u32Sum = 0;
+    HI_U32 u32AnonKb;
+    HI_U32 i;
+
+    u32AnonKb = TEST_RssAnonKb();
+    u64Open = TEST_Us();
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceOpen(0, pszFile, enType, 40000))
+    {
+        TEST_CHECK(0);
+        return;
+    }
+    u64Open = TEST_Us() - u64Open;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetIndex(0, &pstFrame, &u32Frames));
+    TEST_CHECK(TEST_BENCH_FRAMES == u32Frames);
+
+    u64Cold = TEST_Us();
+    for (i = 0; i < u32Frames; i++)
+    {
+        (HI_VOID)SAMPLE_COMM_VDEC_SourceGetFrame(0, i, &stStream);
+        u64Out += stStream.u32Len;
+        u32Sum += stStream.pu8Addr[stStream.u32Len - 1];
+    }
+    u64Cold = TEST_Us() - u64Cold;
+    u64Warm = TEST_Us();
+    for (i = 0; i < u32Frames; i++)
+    {
+        (HI_VOID)SAMPLE_COMM_VDEC_SourceGetFrame(0, i, &stStream);
+        u32Sum += stStream.pu8Addr[stStream.u32Len - 1];
+    }
+    u64Warm = TEST_Us() - u64Warm;
+    u32AnonKb = MAX2(TEST_RssAnonKb(), u32AnonKb) - u32AnonKb;
+    SAMPLE_COMM_VDEC_SourceClose(0);
+
+    printf("%-16s %6.1f MB  open %7.2f ms  frames %7.2f ms first / %7.2f ms again  %7.0f MB/s  +%5u KB anon  (%u)\n",
+           pszName, u32Bytes / 1048576.0, u64Open / 1000.0, u64Cold / 1000.0, u64Warm / 1000.0,
+           (double)u64Out / (double)(u64Open + u64Cold + 1), u32AnonKb, u32Sum & 0xF);
+    /* the index and one frame buffer, a few hundred KB here */
+    TEST_CHECK(u32AnonKb < 4096);
+}
+
+static HI_VOID TEST_Bench(HI_VOID)
+{
+    TEST_MUX_S stMux = {PT_H264, HI_FALSE, HI_FALSE, 4, HI_FALSE, 0, HI_FALSE, HI_FALSE, 0};
+    TEST_BUF_S stFile = {NULL, 0, 0};
+    HI_CHAR acFile[96];
+
+    /* 1080p at about 8Mbps: 150KB key frames every 50, 30KB others, 60s */
+    TEST_MakeStream(PT_H264, TEST_BENCH_FRAMES, 50, 150000, 30000);
+    printf("h264 of %u frames, indexing and getting every frame:\n", TEST_BENCH_FRAMES);
+
+    TEST_Path(acFile, sizeof(acFile), "vdec_demux_bench.h264");
+    stFile.pu8Data = s_pu8Es;
+    stFile.u32Len = s_u32EsLen;
+    if (HI_SUCCESS == TEST_Write(acFile, &stFile))
+    {
+        TEST_BenchFile("elementary", acFile, PT_H264, s_u32EsLen);
+        remove(acFile);
+        strcat(acFile, ".idx");
+        remove(acFile);
+    }
+
+    stFile.pu8Data = NULL;
+    stFile.u32Len = 0;
+    stFile.u32Size = 0;
+    TEST_MakeMp4(&stMux, &stFile);
+    TEST_Path(acFile, sizeof(acFile), "vdec_demux_bench.mp4");
+    if (HI_SUCCESS == TEST_Write(acFile, &stFile))
+    {
+        TEST_BenchFile("mp4", acFile, PT_H264, stFile.u32Len);
+        remove(acFile);
+    }
+
+    stMux.bFragment = HI_TRUE;
+    TEST_MakeMp4(&stMux, &stFile);
+    TEST_Path(acFile, sizeof(acFile), "vdec_demux_bench.mp4");
+    if (HI_SUCCESS == TEST_Write(acFile, &stFile))
+    {
+        TEST_BenchFile("fragmented mp4", acFile, PT_H264, stFile.u32Len);
+        remove(acFile);
+    }
+
+    TEST_MakeTs(&stMux, &stFile);
+    TEST_Path(acFile, sizeof(acFile), "vdec_demux_bench.ts");
+    if (HI_SUCCESS == TEST_Write(acFile, &stFile))
+    {
+        TEST_BenchFile("ts", acFile, PT_H264, stFile.u32Len);
+        remove(acFile);
+    }
+    free(stFile.pu8Data);
+}
+
+int main(int argc, char *argv[])
+{
+    TEST_MUX_S stMux;
+
+    snprintf(s_acDir, sizeof(s_acDir), "%s", (argc > 1) ? argv[1] : "/tmp");
+
+    TEST_MakeStream(PT_H264, TEST_FRAMES, TEST_GOP, 20000, 4000);
+    memset(&stMux, 0, sizeof(stMux));
+    stMux.enType = PT_H264;
+    stMux.u32NalLenSize = 4;
+    TEST_Case("mp4 h264", &stMux, HI_FALSE, TEST_FRAMES);
+    stMux.u32NalLenSize = 2;
+    TEST_Case("mp4 h264, 2 byte nal lengths", &stMux, HI_FALSE, TEST_FRAMES);
+    stMux.u32NalLenSize = 4;
+    stMux.bBFrames = HI_TRUE;
+    TEST_Case("mp4 h264, b frames", &stMux, HI_FALSE, TEST_FRAMES);
+    stMux.bFragment = HI_TRUE;
+    TEST_Case("fragmented mp4 h264, b frames", &stMux, HI_FALSE, TEST_FRAMES);
+    /* into the last sample: the other 99 are whole */
+    stMux.u32CutBytes = 100;
+    TEST_Case("fragmented mp4 h264, cut", &stMux, HI_FALSE, TEST_FRAMES - 1);
+    stMux.u32CutBytes = 0;
+    stMux.bShortTfhd = HI_TRUE;
+    TEST_Case("fragmented mp4 h264, short tfhd", &stMux, HI_FALSE, TEST_FRAMES);
+    stMux.bShortTfhd = HI_FALSE;
+    stMux.bShortTfdt = HI_TRUE;
+    TEST_Case("fragmented mp4 h264, short tfdt", &stMux, HI_FALSE, TEST_FRAMES);
+    stMux.bShortTfdt = HI_FALSE;
+    TEST_Case("ts h264, b frames", &stMux, HI_TRUE, TEST_FRAMES);
+    stMux.bBFrames = HI_FALSE;
+    stMux.bDamage = HI_TRUE;
+    stMux.bM2ts = HI_TRUE;
+    stMux.u64FirstPts = (1ULL << 33) - 50 * TEST_TICKS;
+    TEST_Case("m2ts h264, pts wrap, damaged", &stMux, HI_TRUE, TEST_FRAMES);
+    TEST_Feeder();
+
+    TEST_MakeStream(SAMPLE_PT_H265, TEST_FRAMES, TEST_GOP, 20000, 4000);
+    memset(&stMux, 0, sizeof(stMux));
+    stMux.enType = SAMPLE_PT_H265;
+    stMux.u32NalLenSize = 4;
+    stMux.bCo64 = HI_TRUE;
+    TEST_Case("mp4 h265, co64", &stMux, HI_FALSE, TEST_FRAMES);
+    stMux.bDamage = HI_TRUE;
+    TEST_Case("ts h265, damaged", &stMux, HI_TRUE, TEST_FRAMES);
+
+    TEST_Bench();
+
+    free(s_pu8Es);
+    free(s_stExpect.pu8Data);
+    printf("%s\n", (0 == s_s32Fail) ? "PASS" : "FAIL");
+    return (0 == s_s32Fail) ? 0 : 1;
+}
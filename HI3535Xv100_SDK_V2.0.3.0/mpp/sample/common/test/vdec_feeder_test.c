@@ -0,0 +1,338 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_feeder_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/05/23
+  Description   : checks the vdec feeder against the vdec stub: every frame
+                  of every channel in order and on time, pause / step /
+                  speed, overflow and underflow counts against a decoder
+                  slower than the stream. Then 64 channels fed by 64
+                  SAMPLE_COMM_VDEC_SendStreamMmap threads and by 2 feeder
+                  threads, with the context switches and cpu time of each.
+                  usage: ./vdec_feeder_test [dir]
+  History       :
+  1.Date        : 2016/05/23
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "sample_comm.h"
+#include "vdec_stub.h"
+
+#define TEST_FRAMES         100
+#define TEST_CHN_MAX        64
+
+static HI_S32 s_s32Fail = 0;
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d %s\n", __FUNCTION__, __LINE__, #cond); \
+            s_s32Fail++; \
+        } \
+    } while (0)
+
+static HI_U8 s_au8Es[4 * 1024 * 1024];
+static HI_U32 s_u32EsLen;
+static HI_U32 s_u32EsHash;
+static HI_CHAR s_acFile[96];
+static HI_CHAR s_acIdx[112];
+static VdecThreadParam s_astParam[TEST_CHN_MAX];
+
+static HI_U64 TEST_Us(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+static HI_VOID TEST_Params(HI_S32 s32ChnNum, HI_U64 u64PtsStep)
+{
+    HI_S32 i;
+
+    memset(s_astParam, 0, sizeof(s_astParam));
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        s_astParam[i].s32ChnId = i;
+        s_astParam[i].enType = PT_H264;
+        snprintf(s_astParam[i].cFileName, sizeof(s_astParam[i].cFileName), "%s", s_acFile);
+        s_astParam[i].s32StreamMode = VIDEO_MODE_FRAME;
+        s_astParam[i].s32MilliSec = 0;
+        s_astParam[i].s32MinBufSize = 64 * 1024;
+        s_astParam[i].s32IntervalTime = 1;
+        s_astParam[i].eCtrlSinal = VDEC_CTRL_START;
+        s_astParam[i].u64PtsInit = 0;
+        s_astParam[i].u64PtsIncrease = u64PtsStep;
+        s_astParam[i].bLoopSend = HI_FALSE;
+    }
+    VDEC_STUB_Reset();
+}
+
+static HI_VOID TEST_WaitEnd(HI_S32 s32ChnNum)
+{
+    SAMPLE_VDEC_FEEDER_STAT_S stStat;
+    HI_U64 u64Until = TEST_Us() + 30000000;
+    HI_S32 i = 0;
+
+    while ((i < s32ChnNum) && (TEST_Us() < u64Until))
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederGetStat(i, &stStat));
+        if (HI_TRUE == stStat.bEnd)
+        {
+            i++;
+            continue;
+        }
+        usleep(10000);
+    }
+    TEST_CHECK(i == s32ChnNum);
+}
+
+/* every frame in order with the pts from u64PtsInit on, end of stream last */
+static HI_VOID TEST_CheckChn(VDEC_CHN VdChn, HI_U64 u64PtsStep)
+{
+    VDEC_STUB_STAT_S stStat;
+    HI_U64 au64Pts[TEST_FRAMES];
+    HI_U32 u32Cnt;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(VdChn, &stStat));
+    TEST_CHECK(TEST_FRAMES == stStat.u64Frames);
+    TEST_CHECK(s_u32EsHash == stStat.u32Hash);
+    TEST_CHECK(HI_TRUE == stStat.bEndOfStream);
+    u32Cnt = VDEC_STUB_GetPts(VdChn, au64Pts, TEST_FRAMES);
+    for (i = 0; i < u32Cnt; i++)
+    {
+        TEST_CHECK(i * u64PtsStep == au64Pts[i]);
+    }
+}
+
+static HI_VOID TEST_Pace(HI_VOID)
+{
+    SAMPLE_VDEC_FEEDER_STAT_S stStat;
+    HI_U32 u32Underflow = 0;
+    HI_U32 u32MaxLate = 0;
+    HI_U64 u64Us;
+    HI_S32 i;
+
+    TEST_Params(16, 40000);
+    u64Us = TEST_Us();
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStart(16, s_astParam, 2));
+    for (i = 0; i < 16; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederSetSpeed(i, 400));
+    }
+    TEST_WaitEnd(16);
+    u64Us = TEST_Us() - u64Us;
+    SAMPLE_COMM_VDEC_FeederStop();
+
+    for (i = 0; i < 16; i++)
+    {
+        TEST_CheckChn(i, 40000);
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederGetStat(i, &stStat));
+        TEST_CHECK((TEST_FRAMES == stStat.u64Frames) && (0 == stStat.u32Overflow));
+        u32Underflow += stStat.u32Underflow;
+        u32MaxLate = MAX2(u32MaxLate, stStat.u32MaxLateUs);
+    }
+    /* 100 frames of 40ms at 4x */
+    TEST_CHECK((u64Us > 950000) && (u64Us < 1500000));
+    TEST_CHECK(u32Underflow <= 16 * TEST_FRAMES / 20);
+    printf("16 chn 25fps at 4x on 2 threads: %llu ms for 1000 ms of frames, %u underflows, max %u us late\n",
+           (unsigned long long)u64Us / 1000, u32Underflow, u32MaxLate);
+}
+
+static HI_VOID TEST_PauseStep(HI_VOID)
+{
+    VDEC_STUB_STAT_S stStat;
+    HI_U64 u64Frames;
+
+    TEST_Params(1, 40000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStart(1, s_astParam, 1));
+    usleep(200000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederPause(0, HI_TRUE));
+    usleep(50000);
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStat));
+    u64Frames = stStat.u64Frames;
+    TEST_CHECK((u64Frames >= 4) && (u64Frames <= 10));
+    usleep(200000);
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStat));
+    TEST_CHECK(u64Frames == stStat.u64Frames);
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStep(0));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStep(0));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStep(0));
+    usleep(50000);
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStat));
+    TEST_CHECK(u64Frames + 3 == stStat.u64Frames);
+
+    /* pause by VdecThreadParam as SAMPLE_COMM_VDEC_CmdCtrl does */
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederPause(0, HI_FALSE));
+    s_astParam[0].eCtrlSinal = VDEC_CTRL_PAUSE;
+    usleep(150000);
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStat));
+    u64Frames = stStat.u64Frames;
+    usleep(200000);
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStat));
+    TEST_CHECK(u64Frames == stStat.u64Frames);
+    s_astParam[0].eCtrlSinal = VDEC_CTRL_START;
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederSetSpeed(0, 800));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_FeederSetSpeed(0, 900));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_FeederStep(0));
+    TEST_WaitEnd(1);
+    SAMPLE_COMM_VDEC_FeederStop();
+    TEST_CheckChn(0, 40000);
+    printf("pause, step 3 and resume on 1 chn: %llu frames held while paused, all %u sent\n",
+           (unsigned long long)u64Frames, TEST_FRAMES);
+}
+
+/* a decoder at 50 fps fed 100 fps: the feeder waits for room and falls behind */
+static HI_VOID TEST_SlowDecoder(HI_VOID)
+{
+    SAMPLE_VDEC_FEEDER_STAT_S stStat;
+    VDEC_STUB_STAT_S stStubStat;
+    HI_U64 u64Us;
+
+    TEST_Params(1, 40000);
+    VDEC_STUB_SetDecoder(0, 50, 0);
+    u64Us = TEST_Us();
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStart(1, s_astParam, 1));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederSetSpeed(0, 400));
+    TEST_WaitEnd(1);
+    u64Us = TEST_Us() - u64Us;
+    SAMPLE_COMM_VDEC_FeederStop();
+
+    TEST_CheckChn(0, 40000);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederGetStat(0, &stStat));
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(0, &stStubStat));
+    TEST_CHECK(stStat.u32Overflow > 0);
+    TEST_CHECK(stStat.u32Underflow > 0);
+    /* room is asked for, not found by failing sends */
+    TEST_CHECK(0 == stStubStat.u64Rejected);
+    TEST_CHECK(u64Us > 1700000);
+    printf("decoder at 50 fps fed 100 fps: %llu ms, %u overflows, %u underflows, max %u us late, %llu queries\n",
+           (unsigned long long)u64Us / 1000, stStat.u32Overflow, stStat.u32Underflow, stStat.u32MaxLateUs,
+           (unsigned long long)stStubStat.u64Queries);
+}
+
+static HI_U64 TEST_RusageUs(const struct rusage *pstUsage)
+{
+    return (HI_U64)(pstUsage->ru_utime.tv_sec + pstUsage->ru_stime.tv_sec) * 1000000
+           + pstUsage->ru_utime.tv_usec + pstUsage->ru_stime.tv_usec;
+}
+
+static HI_VOID TEST_Print(const HI_CHAR *pszName, HI_S32 s32Threads, HI_U64 u64Us,
+                          const struct rusage *pstBefore, const struct rusage *pstAfter)
+{
+    printf("%-34s %2d threads %5llu ms  %7ld context switches  %5llu ms cpu\n", pszName, s32Threads,
+           (unsigned long long)u64Us / 1000,
+           (pstAfter->ru_nvcsw + pstAfter->ru_nivcsw) - (pstBefore->ru_nvcsw + pstBefore->ru_nivcsw),
+           (unsigned long long)(TEST_RusageUs(pstAfter) - TEST_RusageUs(pstBefore)) / 1000);
+}
+
+/* 64 channels at 50 fps: the per channel send threads pace 20ms a frame, the feeder by pts of 20ms */
+static HI_VOID TEST_Scale(HI_VOID)
+{
+    pthread_t aTid[TEST_CHN_MAX];
+    struct rusage stBefore, stAfter;
+    HI_U64 u64Us;
+    HI_S32 i;
+
+    /* the sidecar keeps the 40ms pts it was first scanned with */
+    remove(s_acIdx);
+    TEST_Params(TEST_CHN_MAX, 20000);
+    getrusage(RUSAGE_SELF, &stBefore);
+    u64Us = TEST_Us();
+    for (i = 0; i < TEST_CHN_MAX; i++)
+    {
+        pthread_create(&aTid[i], NULL, SAMPLE_COMM_VDEC_SendStreamMmap, &s_astParam[i]);
+    }
+    for (i = 0; i < TEST_CHN_MAX; i++)
+    {
+        pthread_join(aTid[i], NULL);
+    }
+    u64Us = TEST_Us() - u64Us;
+    getrusage(RUSAGE_SELF, &stAfter);
+    for (i = 0; i < TEST_CHN_MAX; i++)
+    {
+        TEST_CheckChn(i, 20000);
+    }
+    TEST_Print("64 chn SAMPLE_COMM_VDEC_SendStreamMmap", TEST_CHN_MAX, u64Us, &stBefore, &stAfter);
+
+    TEST_Params(TEST_CHN_MAX, 20000);
+    getrusage(RUSAGE_SELF, &stBefore);
+    u64Us = TEST_Us();
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStart(TEST_CHN_MAX, s_astParam, 2));
+    TEST_WaitEnd(TEST_CHN_MAX);
+    u64Us = TEST_Us() - u64Us;
+    SAMPLE_COMM_VDEC_FeederStop();
+    getrusage(RUSAGE_SELF, &stAfter);
+    for (i = 0; i < TEST_CHN_MAX; i++)
+    {
+        TEST_CheckChn(i, 20000);
+    }
+    TEST_Print("64 chn SAMPLE_COMM_VDEC_FeederStart", 2, u64Us, &stBefore, &stAfter);
+}
+
+static HI_VOID TEST_Errors(HI_VOID)
+{
+    SAMPLE_VDEC_FEEDER_STAT_S stStat;
+
+    TEST_Params(2, 40000);
+    s_astParam[1].s32ChnId = 0;
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_FeederStart(2, s_astParam, 1));
+    TEST_Params(1, 40000);
+    s_astParam[0].s32StreamMode = VIDEO_MODE_STREAM;
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_FeederStart(1, s_astParam, 1));
+    TEST_Params(1, 40000);
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_FeederStart(1, s_astParam, SAMPLE_VDEC_FEEDER_MAX_THREAD + 1));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_FeederGetStat(5, &stStat));
+    /* the sources of a failed start are closed again */
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_FeederStart(1, s_astParam, 1));
+    SAMPLE_COMM_VDEC_FeederStop();
+}
+
+int main(int argc, char *argv[])
+{
+    const HI_CHAR *pszDir = (argc > 1) ? argv[1] : "/tmp";
+    VDEC_STUB_ES_CFG_S stCfg = {TEST_FRAMES, 25, 20000, 4000, 1, HI_FALSE};
+    FILE *pFile;
+
+    s_u32EsLen = VDEC_STUB_MakeEs(PT_H264, &stCfg, s_au8Es, sizeof(s_au8Es), NULL, NULL, NULL);
+    s_u32EsHash = VDEC_STUB_Hash(0x811C9DC5, s_au8Es, s_u32EsLen);
+    snprintf(s_acFile, sizeof(s_acFile), "%s/vdec_feeder_test.h264", pszDir);
+    snprintf(s_acIdx, sizeof(s_acIdx), "%s.idx", s_acFile);
+    pFile = fopen(s_acFile, "wb");
+    if (NULL == pFile)
+    {
+        printf("can't write %s\n", s_acFile);
+        return 1;
+    }
+    fwrite(s_au8Es, 1, s_u32EsLen, pFile);
+    fclose(pFile);
+    remove(s_acIdx);
+
+    TEST_Errors();
+    TEST_Pace();
+    TEST_PauseStep();
+    TEST_SlowDecoder();
+    TEST_Scale();
+
+    remove(s_acFile);
+    remove(s_acIdx);
+    printf("%s\n", (0 == s_s32Fail) ? "PASS" : "FAIL");
+    return (0 == s_s32Fail) ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_index_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/05/16
+  Description   : checks the .idx sidecar of the vdec stream source: written
+                  as the recorder does, loaded instead of a scan, rebuilt
+                  and rewritten when it is missing or does not match the
+                  stream, key frame seek and 2x/4x/8x trick play through the
+                  vdec stub. Times a rescan against a sidecar load, 1080P.h264
+                  and CIF.h264 are copied to the directory for it.
+                  usage: ./vdec_index_test [dir]
+  History       :
+  1.Date        : 2016/05/16
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sample_comm.h"
+#include "vdec_stub.h"
+
+#define TEST_FRAMES         300
+#define TEST_GOP            25
+#define TEST_PTS_STEP       40000
+#define TEST_SEEKS          1000000
+
+static HI_S32 s_s32Fail = 0;
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d %s\n", __FUNCTION__, __LINE__, #cond); \
+            s_s32Fail++; \
+        } \
+    } while (0)
+
+static HI_U8 s_au8Es[16 * 1024 * 1024];
+static HI_U32 s_au32Offset[TEST_FRAMES];
+static HI_U32 s_au32Len[TEST_FRAMES];
+static HI_BOOL s_abKey[TEST_FRAMES];
+
+static HI_U64 TEST_Us(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+static HI_S32 TEST_WriteFile(const HI_CHAR *pszFile, const HI_U8 *pu8Data, HI_U32 u32Len, const HI_CHAR *pszMode)
+{
+    FILE *pFile = fopen(pszFile, pszMode);
+
+    if (NULL == pFile)
+    {
+        printf("can't write %s\n", pszFile);
+        return HI_FAILURE;
+    }
+    fwrite(pu8Data, 1, u32Len, pFile);
+    fclose(pFile);
+    return HI_SUCCESS;
+}
+
+/* the recorder's way: a record for every frame after the frame is written, encoder pts with jitter */
+static HI_U64 TEST_RecPts(HI_U32 u32Frame)
+{
+    return 5000000 + (HI_U64)u32Frame * 33367 + (u32Frame % 3);
+}
+
+static HI_VOID TEST_Record(const HI_CHAR *pszStream)
+{
+    SAMPLE_VDEC_FRAME_S stFrame;
+    FILE *pIdx;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == TEST_WriteFile(pszStream, s_au8Es, 0, "wb"));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_IndexCreate(pszStream, PT_H264, &pIdx));
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == TEST_WriteFile(pszStream, s_au8Es + s_au32Offset[i], s_au32Len[i], "ab"));
+        memset(&stFrame, 0, sizeof(stFrame));
+        stFrame.u32Offset = s_au32Offset[i];
+        stFrame.u32Len = s_au32Len[i];
+        stFrame.u64PTS = TEST_RecPts(i);
+        stFrame.u32Type = s_abKey[i] ? 5 : 1;
+        stFrame.bKey = s_abKey[i];
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_IndexAppend(pIdx, &stFrame));
+    }
+    fclose(pIdx);
+}
+
+/* opens the stream on chn 0 and tells whether its index has the recorder's pts, i.e. came from the sidecar */
+static HI_BOOL TEST_OpenFromSidecar(const HI_CHAR *pszStream, HI_U32 u32ExpFrames)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Frames = 0;
+    HI_BOOL bSidecar;
+    HI_U32 i;
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceOpen(0, pszStream, PT_H264, TEST_PTS_STEP));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetIndex(0, &pstFrame, &u32Frames));
+    TEST_CHECK(u32ExpFrames == u32Frames);
+    bSidecar = (u32Frames > 0) && (TEST_RecPts(0) == pstFrame[0].u64PTS) ? HI_TRUE : HI_FALSE;
+    for (i = 0; (i < u32Frames) && (i < TEST_FRAMES); i++)
+    {
+        TEST_CHECK((pstFrame[i].u32Offset == s_au32Offset[i]) && (pstFrame[i].bKey == s_abKey[i]));
+        TEST_CHECK(pstFrame[i].u32Type == (s_abKey[i] ? 5 : 1));
+        TEST_CHECK(pstFrame[i].u64PTS == (bSidecar ? TEST_RecPts(i) : (HI_U64)i * TEST_PTS_STEP));
+    }
+    return bSidecar;
+}
+
+static HI_VOID TEST_Sidecar(const HI_CHAR *pszDir)
+{
+    HI_CHAR acStream[128];
+    HI_CHAR acIdx[160];
+    const HI_U8 au8Tail[] = {0x00, 0x00, 0x00, 0x01, 0x09, 0xF0};
+    FILE *pFile;
+
+    snprintf(acStream, sizeof(acStream), "%s/vdec_index_test.h264", pszDir);
+    snprintf(acIdx, sizeof(acIdx), "%s.idx", acStream);
+
+    /* recorded with its sidecar: loaded, not scanned */
+    TEST_Record(acStream);
+    TEST_CHECK(HI_TRUE == TEST_OpenFromSidecar(acStream, TEST_FRAMES));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    /* no sidecar: scanned, and the scan leaves one */
+    remove(acIdx);
+    TEST_CHECK(HI_FALSE == TEST_OpenFromSidecar(acStream, TEST_FRAMES));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+    TEST_CHECK(0 == access(acIdx, F_OK));
+    TEST_CHECK(HI_FALSE == TEST_OpenFromSidecar(acStream, TEST_FRAMES));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    /* the recording went on after the sidecar was written: rescanned */
+    TEST_Record(acStream);
+    TEST_CHECK(HI_SUCCESS == TEST_WriteFile(acStream, au8Tail, sizeof(au8Tail), "ab"));
+    TEST_CHECK(HI_FALSE == TEST_OpenFromSidecar(acStream, TEST_FRAMES));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    /* a record cut short by a crash of the recorder: rescanned */
+    TEST_Record(acStream);
+    pFile = fopen(acIdx, "ab");
+    fwrite(au8Tail, 1, sizeof(au8Tail), pFile);
+    fclose(pFile);
+    TEST_CHECK(HI_FALSE == TEST_OpenFromSidecar(acStream, TEST_FRAMES));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    /* the sidecar of another codec: rescanned */
+    TEST_Record(acStream);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_IndexCreate(acStream, PT_MP4VIDEO, &pFile));
+    fclose(pFile);
+    TEST_CHECK(HI_FALSE == TEST_OpenFromSidecar(acStream, TEST_FRAMES));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    remove(acStream);
+    remove(acIdx);
+}
+
+static HI_VOID TEST_Seek(const HI_CHAR *pszDir)
+{
+    HI_CHAR acStream[128];
+    HI_CHAR acIdx[160];
+    HI_U32 u32Key;
+    HI_U32 u32Frame;
+    HI_U32 u32Sum = 0;
+    HI_U32 i;
+    HI_U64 u64Us;
+
+    snprintf(acStream, sizeof(acStream), "%s/vdec_index_test.h264", pszDir);
+    snprintf(acIdx, sizeof(acIdx), "%s.idx", acStream);
+    TEST_Record(acStream);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceOpen(0, acStream, PT_H264, TEST_PTS_STEP));
+
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceFindKey(0, i, &u32Key));
+        TEST_CHECK(i / TEST_GOP * TEST_GOP == u32Key);
+        /* pts just before frame i's own is still frame i - 1 */
+        TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceSeek(0, TEST_RecPts(i) - TEST_RecPts(0), &u32Frame));
+        TEST_CHECK(i / TEST_GOP * TEST_GOP == u32Frame);
+        if (i > 0)
+        {
+            TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceSeek(0, TEST_RecPts(i) - TEST_RecPts(0) - 1, &u32Frame));
+            TEST_CHECK((i - 1) / TEST_GOP * TEST_GOP == u32Frame);
+        }
+    }
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceSeek(0, 1ULL << 40, &u32Frame));
+    TEST_CHECK((TEST_FRAMES - 1) / TEST_GOP * TEST_GOP == u32Frame);
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceFindKey(0, TEST_FRAMES, &u32Key));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceSetSpeed(0, 3));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceSetSpeed(0, 16));
+    TEST_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceSeek(1, 0, &u32Frame));
+
+    u64Us = TEST_Us();
+    for (i = 0; i < TEST_SEEKS; i++)
+    {
+        (HI_VOID)SAMPLE_COMM_VDEC_SourceSeek(0, (HI_U64)(i * 2654435761U) % (TEST_RecPts(TEST_FRAMES) - TEST_RecPts(0)),
+                                             &u32Frame);
+        u32Sum += u32Frame;
+    }
+    u64Us = TEST_Us() - u64Us;
+    printf("seek to the key frame before a pts: %.1f ns (%u)\n", u64Us * 1000.0 / TEST_SEEKS, u32Sum % 7);
+
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+    remove(acStream);
+    remove(acIdx);
+}
+
+/* feeder at u32Speed from the start, the stub gets key frames only, u32Speed or more frames apart */
+static HI_VOID TEST_Trick(const HI_CHAR *pszDir, HI_U32 u32Speed)
+{
+    VdecThreadParam stParam;
+    VDEC_STUB_STAT_S stStat;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U64 au64Pts[TEST_FRAMES];
+    HI_U32 u32Frames;
+    HI_U32 u32Cnt;
+    HI_U32 u32Frame;
+    HI_U32 u32Last = 0;
+    HI_U32 u32Keys = 0;
+    HI_U32 i;
+    HI_U64 u64Us;
+    pthread_t tid;
+
+    memset(&stParam, 0, sizeof(stParam));
+    snprintf(stParam.cFileName, sizeof(stParam.cFileName), "%s/vdec_index_test.h264", pszDir);
+    TEST_Record(stParam.cFileName);
+
+    VDEC_STUB_Reset();
+    stParam.s32ChnId = 2;
+    stParam.enType = PT_H264;
+    stParam.s32StreamMode = VIDEO_MODE_FRAME;
+    stParam.s32MinBufSize = 64 * 1024;
+    stParam.s32IntervalTime = 1;
+    stParam.eCtrlSinal = VDEC_CTRL_PAUSE;
+    stParam.u64PtsInit = 0;
+    stParam.u64PtsIncrease = TEST_PTS_STEP;
+    stParam.bLoopSend = HI_FALSE;
+    pthread_create(&tid, NULL, SAMPLE_COMM_VDEC_SendStreamMmap, &stParam);
+    /* set the speed while it is open and paused, then let it go */
+    while (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceGetIndex(2, &pstFrame, &u32Frames))
+    {
+        usleep(1000);
+    }
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceSetSpeed(2, u32Speed));
+    u64Us = TEST_Us();
+    stParam.eCtrlSinal = VDEC_CTRL_START;
+    pthread_join(tid, NULL);
+    u64Us = TEST_Us() - u64Us;
+
+    TEST_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(2, &stStat));
+    TEST_CHECK(HI_TRUE == stStat.bEndOfStream);
+    u32Cnt = VDEC_STUB_GetPts(2, au64Pts, TEST_FRAMES);
+    for (i = 0; i < u32Cnt; i++)
+    {
+        /* the pts are the recorder's from u64PtsInit on */
+        for (u32Frame = 0; (u32Frame < TEST_FRAMES) && (TEST_RecPts(u32Frame) - TEST_RecPts(0) != au64Pts[i]); u32Frame++)
+        {
+        }
+        TEST_CHECK((u32Frame < TEST_FRAMES) && (HI_TRUE == s_abKey[u32Frame]));
+        TEST_CHECK((0 == i) || (u32Frame >= u32Last + u32Speed));
+        u32Last = u32Frame;
+    }
+    for (i = 0; i < TEST_FRAMES; i++)
+    {
+        u32Keys += s_abKey[i] ? 1 : 0;
+    }
+    /* 8x still has a key frame for every gop of 25 */
+    TEST_CHECK(u32Keys == u32Cnt);
+    /* the sender sleeps up to a second in pause before it sees the start */
+    printf("%ux: %u key frames sent of %u frames in %llu ms with the end of the pause, %u ms at 1x\n", u32Speed,
+           u32Cnt, TEST_FRAMES, (unsigned long long)u64Us / 1000, TEST_FRAMES * 20);
+
+    remove(stParam.cFileName);
+    strcat(stParam.cFileName, ".idx");
+    remove(stParam.cFileName);
+}
+
+/* rescan against sidecar on the sample streams, copied so their directory is left alone */
+static HI_VOID TEST_OpenTime(const HI_CHAR *pszDir, const HI_CHAR *pszSample)
+{
+    HI_CHAR acStream[128];
+    HI_CHAR acIdx[160];
+    FILE *pIn;
+    HI_U8 *pu8Buf = malloc(8 * 1024 * 1024);
+    HI_U32 u32Len;
+    HI_U64 u64Scan, u64Load;
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    HI_U32 u32Frames;
+    HI_U32 u32ScanFrames;
+
+    pIn = fopen(pszSample, "rb");
+    if (NULL == pIn)
+    {
+        printf("%s not there, skipped\n", pszSample);
+        free(pu8Buf);
+        return;
+    }
+    u32Len = fread(pu8Buf, 1, 8 * 1024 * 1024, pIn);
+    fclose(pIn);
+    snprintf(acStream, sizeof(acStream), "%s/vdec_index_test_sample.h264", pszDir);
+    snprintf(acIdx, sizeof(acIdx), "%s.idx", acStream);
+    TEST_CHECK(HI_SUCCESS == TEST_WriteFile(acStream, pu8Buf, u32Len, "wb"));
+    remove(acIdx);
+
+    u64Scan = TEST_Us();
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceOpen(0, acStream, PT_H264, TEST_PTS_STEP));
+    u64Scan = TEST_Us() - u64Scan;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetIndex(0, &pstFrame, &u32ScanFrames));
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    u64Load = TEST_Us();
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceOpen(0, acStream, PT_H264, TEST_PTS_STEP));
+    u64Load = TEST_Us() - u64Load;
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetIndex(0, &pstFrame, &u32Frames));
+    TEST_CHECK(u32ScanFrames == u32Frames);
+    TEST_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+
+    printf("%-14s %4u frames: open with scan %6llu us, open with sidecar %5llu us\n", pszSample, u32Frames,
+           (unsigned long long)u64Scan, (unsigned long long)u64Load);
+    remove(acStream);
+    remove(acIdx);
+    free(pu8Buf);
+}
+
+int main(int argc, char *argv[])
+{
+    const HI_CHAR *pszDir = (argc > 1) ? argv[1] : "/tmp";
+    VDEC_STUB_ES_CFG_S stCfg = {TEST_FRAMES, TEST_GOP, 30000, 6000, 2, HI_FALSE};
+
+    TEST_CHECK(0 != VDEC_STUB_MakeEs(PT_H264, &stCfg, s_au8Es, sizeof(s_au8Es), s_au32Offset, s_au32Len, s_abKey));
+
+    TEST_Sidecar(pszDir);
+    TEST_Seek(pszDir);
+    TEST_Trick(pszDir, 2);
+    TEST_Trick(pszDir, 8);
+    TEST_OpenTime(pszDir, "../1080P.h264");
+    TEST_OpenTime(pszDir, "../CIF.h264");
+
+    printf("%s\n", (0 == s_s32Fail) ? "PASS" : "FAIL");
+    return (0 == s_s32Fail) ? 0 : 1;
+}
@@ -0,0 +1,382 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_source_bench.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/05/09
+  Description   : checks the access unit index of the mmap stream source on
+                  generated h264 / h265 / mpeg4 and on the sample streams,
+                  measures the start code scanner against a byte loop and
+                  the index against the fseek / fread loop of
+                  SAMPLE_COMM_VDEC_SendStream, then feeds the vdec stub
+                  through SAMPLE_COMM_VDEC_SendStreamMmap.
+                  usage: ./vdec_source_bench [dir]
+  History       :
+  1.Date        : 2016/05/09
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sample_comm.h"
+#include "vdec_stub.h"
+
+#define BENCH_FRAMES        600
+#define BENCH_LOOPS         20
+
+static HI_S32 s_s32Fail = 0;
+
+#define BENCH_CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL %s:%d %s\n", __FUNCTION__, __LINE__, #cond); \
+            s_s32Fail++; \
+        } \
+    } while (0)
+
+static HI_U64 BENCH_Us(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+static HI_U32 BENCH_ByteStartCodes(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 i;
+    HI_U32 u32Cnt = 0;
+
+    for (i = 0; i + 2 < u32Len; i++)
+    {
+        if ((0 == pu8Data[i]) && (0 == pu8Data[i + 1]) && (1 == pu8Data[i + 2]))
+        {
+            u32Cnt++;
+        }
+    }
+    return u32Cnt;
+}
+
+static HI_U32 BENCH_WordStartCodes(const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 u32Pos = 0;
+    HI_U32 u32Cnt = 0;
+
+    while (1)
+    {
+        u32Pos += SAMPLE_COMM_VDEC_FindStartCode(pu8Data + u32Pos, u32Len - u32Pos);
+        if (u32Pos >= u32Len)
+        {
+            return u32Cnt;
+        }
+        u32Cnt++;
+        u32Pos += 3;
+    }
+}
+
+static const HI_CHAR *BENCH_Name(PAYLOAD_TYPE_E enType)
+{
+    return (PT_H264 == enType) ? "h264" : ((SAMPLE_PT_H265 == enType) ? "h265" : "mpeg4");
+}
+
+/* index of a generated stream against what the generator wrote, scanner speed */
+static HI_VOID BENCH_Generated(PAYLOAD_TYPE_E enType)
+{
+    VDEC_STUB_ES_CFG_S stCfg = {BENCH_FRAMES, 30, 80000, 16000, 4, HI_FALSE};
+    HI_U32 u32Size = 64 * 1024 * 1024;
+    HI_U8 *pu8Buf = malloc(u32Size);
+    HI_U32 au32Offset[BENCH_FRAMES];
+    HI_U32 au32Len[BENCH_FRAMES];
+    HI_BOOL abKey[BENCH_FRAMES];
+    SAMPLE_VDEC_FRAME_S *pstFrame = NULL;
+    HI_U32 u32Frames = 0;
+    HI_U32 u32Len;
+    HI_U32 u32Byte = 0;
+    HI_U32 u32Word = 0;
+    HI_U32 i;
+    HI_U64 u64Byte, u64Word, u64Index;
+
+    stCfg.bAud = (SAMPLE_PT_H265 == enType) ? HI_TRUE : HI_FALSE;
+    u32Len = VDEC_STUB_MakeEs(enType, &stCfg, pu8Buf, u32Size, au32Offset, au32Len, abKey);
+    BENCH_CHECK(0 != u32Len);
+
+    u64Byte = BENCH_Us();
+    for (i = 0; i < BENCH_LOOPS; i++)
+    {
+        u32Byte += BENCH_ByteStartCodes(pu8Buf, u32Len);
+    }
+    u64Byte = BENCH_Us() - u64Byte;
+    u64Word = BENCH_Us();
+    for (i = 0; i < BENCH_LOOPS; i++)
+    {
+        u32Word += BENCH_WordStartCodes(pu8Buf, u32Len);
+    }
+    u64Word = BENCH_Us() - u64Word;
+    BENCH_CHECK(u32Byte == u32Word);
+
+    u64Index = BENCH_Us();
+    for (i = 0; i < BENCH_LOOPS; i++)
+    {
+        free(pstFrame);
+        pstFrame = NULL;
+        BENCH_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BuildIndex(enType, pu8Buf, u32Len, &pstFrame, &u32Frames));
+    }
+    u64Index = BENCH_Us() - u64Index;
+
+    BENCH_CHECK(BENCH_FRAMES == u32Frames);
+    for (i = 0; (i < u32Frames) && (i < BENCH_FRAMES); i++)
+    {
+        BENCH_CHECK((pstFrame[i].u32Offset == au32Offset[i]) && (pstFrame[i].u32Len == au32Len[i])
+                    && (pstFrame[i].bKey == abKey[i]));
+    }
+    printf("%-6s %6.1f MB  %6u start codes  byte loop %7.1f MB/s  scanner %7.1f MB/s  index %7.1f MB/s  %u frames\n",
+           BENCH_Name(enType), u32Len / 1048576.0, u32Word / BENCH_LOOPS,
+           (double)u32Len * BENCH_LOOPS / u64Byte, (double)u32Len * BENCH_LOOPS / u64Word,
+           (double)u32Len * BENCH_LOOPS / u64Index, u32Frames);
+
+    free(pstFrame);
+    free(pu8Buf);
+}
+
+/* the h264 frame mode loop of SAMPLE_COMM_VDEC_SendStream without the sending */
+static HI_U32 BENCH_FreadFrames(const HI_CHAR *pszFile, HI_S32 s32MinBufSize, HI_U64 *pu64Read)
+{
+    FILE *fpStrm = fopen(pszFile, "rb");
+    HI_U8 *pu8Buf = malloc(s32MinBufSize);
+    HI_S32 s32UsedBytes = 0;
+    HI_S32 s32ReadLen;
+    HI_BOOL bFindStart;
+    HI_BOOL bFindEnd;
+    HI_U32 u32Frames = 0;
+    HI_S32 i;
+
+    *pu64Read = 0;
+    while (NULL != fpStrm)
+    {
+        bFindStart = HI_FALSE;
+        bFindEnd = HI_FALSE;
+        fseek(fpStrm, s32UsedBytes, SEEK_SET);
+        s32ReadLen = fread(pu8Buf, 1, s32MinBufSize, fpStrm);
+        if (0 == s32ReadLen)
+        {
+            break;
+        }
+        *pu64Read += s32ReadLen;
+        for (i = 0; i < s32ReadLen - 5; i++)
+        {
+            if ((0 == pu8Buf[i]) && (0 == pu8Buf[i + 1]) && (1 == pu8Buf[i + 2])
+                && (((pu8Buf[i + 3] & 0x1F) == 0x5) || ((pu8Buf[i + 3] & 0x1F) == 0x1))
+                && ((pu8Buf[i + 4] & 0x80) == 0x80))
+            {
+                bFindStart = HI_TRUE;
+                i += 4;
+                break;
+            }
+        }
+        for (; i < s32ReadLen - 5; i++)
+        {
+            if ((0 == pu8Buf[i]) && (0 == pu8Buf[i + 1]) && (1 == pu8Buf[i + 2])
+                && (((pu8Buf[i + 3] & 0x1F) == 0x7) || ((pu8Buf[i + 3] & 0x1F) == 0x8) || ((pu8Buf[i + 3] & 0x1F) == 0x6)
+                    || ((((pu8Buf[i + 3] & 0x1F) == 0x5) || ((pu8Buf[i + 3] & 0x1F) == 0x1))
+                        && ((pu8Buf[i + 4] & 0x80) == 0x80))))
+            {
+                bFindEnd = HI_TRUE;
+                break;
+            }
+        }
+        if (i > 0)
+        {
+            s32ReadLen = i;
+        }
+        if ((HI_TRUE == bFindStart) && (HI_TRUE != bFindEnd))
+        {
+            s32ReadLen = i + 5;
+        }
+        s32UsedBytes += s32ReadLen;
+        u32Frames++;
+    }
+    if (NULL != fpStrm)
+    {
+        fclose(fpStrm);
+    }
+    free(pu8Buf);
+    return u32Frames;
+}
+
+static HI_VOID BENCH_SampleFile(const HI_CHAR *pszFile, HI_U32 u32Width, HI_U32 u32Height,
+                                HI_U32 u32ExpFrames, HI_U32 u32ExpKeys)
+{
+    const SAMPLE_VDEC_FRAME_S *pstFrame;
+    VDEC_STREAM_S stStream;
+    HI_U32 u32Frames = 0;
+    HI_U32 u32Keys = 0;
+    HI_U32 u32Fread;
+    HI_U64 u64Read;
+    HI_U64 u64Bytes = 0;
+    HI_U64 u64Fread, u64Mmap;
+    HI_CHAR acIdx[256];
+    HI_BOOL bHadIdx;
+    HI_U32 i;
+
+    /* time the scan, leave the sample directory as it was */
+    snprintf(acIdx, sizeof(acIdx), "%s.idx", pszFile);
+    bHadIdx = (0 == access(acIdx, F_OK)) ? HI_TRUE : HI_FALSE;
+    if (HI_TRUE == bHadIdx)
+    {
+        printf("%s has a sidecar, the mmap figure is loading it\n", pszFile);
+    }
+
+    u64Fread = BENCH_Us();
+    u32Fread = BENCH_FreadFrames(pszFile, u32Width * u32Height * 3 / 2, &u64Read);
+    u64Fread = BENCH_Us() - u64Fread;
+
+    u64Mmap = BENCH_Us();
+    if (HI_SUCCESS != SAMPLE_COMM_VDEC_SourceOpen(0, pszFile, PT_H264, 40000))
+    {
+        printf("%s not there, skipped\n", pszFile);
+        return;
+    }
+    BENCH_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetIndex(0, &pstFrame, &u32Frames));
+    for (i = 0; i < u32Frames; i++)
+    {
+        BENCH_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceGetFrame(0, i, &stStream));
+        u64Bytes += stStream.u32Len;
+        u32Keys += pstFrame[i].bKey ? 1 : 0;
+        /* touch it as the decoder would */
+        (HI_VOID)VDEC_STUB_Hash(0, stStream.pu8Addr, stStream.u32Len);
+    }
+    u64Mmap = BENCH_Us() - u64Mmap;
+    BENCH_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceGetFrame(0, u32Frames, &stStream));
+    BENCH_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_SourceClose(0));
+    if (HI_TRUE != bHadIdx)
+    {
+        remove(acIdx);
+    }
+
+    BENCH_CHECK(u32ExpFrames == u32Frames);
+    BENCH_CHECK(u32ExpKeys == u32Keys);
+    printf("%-14s %4u frames %2u idr | fread loop %4u frames %7.1f MB read %6llu us | mmap index %7.1f MB %6llu us\n",
+           pszFile, u32Frames, u32Keys, u32Fread, u64Read / 1048576.0, (unsigned long long)u64Fread,
+           u64Bytes / 1048576.0, (unsigned long long)u64Mmap);
+}
+
+static HI_VOID BENCH_Send(const HI_CHAR *pszDir, PAYLOAD_TYPE_E enType, HI_S32 s32Mode)
+{
+    VDEC_STUB_ES_CFG_S stCfg = {30, 10, 40000, 9000, 2, HI_TRUE};
+    HI_U32 u32Size = 4 * 1024 * 1024;
+    HI_U8 *pu8Buf = malloc(u32Size);
+    HI_U32 u32Len;
+    VdecThreadParam stParam;
+    VDEC_STUB_STAT_S stStat;
+    pthread_t tid;
+    HI_VOID *pRet;
+    FILE *pFile;
+
+    u32Len = VDEC_STUB_MakeEs(enType, &stCfg, pu8Buf, u32Size, NULL, NULL, NULL);
+    memset(&stParam, 0, sizeof(stParam));
+    snprintf(stParam.cFileName, sizeof(stParam.cFileName), "%s/vdec_source_bench.es", pszDir);
+    pFile = fopen(stParam.cFileName, "wb");
+    if (NULL == pFile)
+    {
+        printf("can't write %s\n", stParam.cFileName);
+        s_s32Fail++;
+        free(pu8Buf);
+        return;
+    }
+    fwrite(pu8Buf, 1, u32Len, pFile);
+    fclose(pFile);
+
+    VDEC_STUB_Reset();
+    VDEC_STUB_SetReject(3, 4);
+    stParam.s32ChnId = 3;
+    stParam.enType = enType;
+    stParam.s32StreamMode = s32Mode;
+    stParam.s32MilliSec = 0;
+    stParam.s32MinBufSize = 64 * 1024;
+    stParam.s32IntervalTime = 1;
+    stParam.eCtrlSinal = VDEC_CTRL_START;
+    stParam.u64PtsInit = 1000;
+    stParam.u64PtsIncrease = 40000;
+    stParam.bLoopSend = HI_FALSE;
+    pthread_create(&tid, NULL, SAMPLE_COMM_VDEC_SendStreamMmap, &stParam);
+    pthread_join(tid, &pRet);
+    remove(stParam.cFileName);
+    strcat(stParam.cFileName, ".idx");
+    remove(stParam.cFileName);
+
+    BENCH_CHECK(HI_SUCCESS == (HI_S32)(long)pRet);
+    BENCH_CHECK(HI_SUCCESS == VDEC_STUB_GetStat(3, &stStat));
+    BENCH_CHECK(stStat.bEndOfStream);
+    BENCH_CHECK(u32Len == stStat.u64Bytes);
+    BENCH_CHECK(VDEC_STUB_Hash(0x811C9DC5, pu8Buf, u32Len) == stStat.u32Hash);
+    BENCH_CHECK(1000 + (stStat.u64Sends - 1) * 40000 == stStat.u64LastPts);
+    if (VIDEO_MODE_FRAME == s32Mode)
+    {
+        BENCH_CHECK(30 == stStat.u64Frames);
+    }
+    else
+    {
+        BENCH_CHECK((u32Len + 65535) / 65536 == stStat.u64Sends);
+    }
+    printf("send %-5s %s mode: %llu sends %llu retried, %llu bytes\n", BENCH_Name(enType),
+           (VIDEO_MODE_FRAME == s32Mode) ? "frame " : "stream", (unsigned long long)stStat.u64Sends,
+           (unsigned long long)stStat.u64Rejected, (unsigned long long)stStat.u64Bytes);
+    free(pu8Buf);
+}
+
+static HI_VOID BENCH_Errors(HI_VOID)
+{
+    SAMPLE_VDEC_FRAME_S *pstFrame = NULL;
+    HI_U32 u32Frames = 7;
+    const HI_U8 au8Sc[] = {0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01};
+    const HI_U8 au8None[] = {0x00, 0x00, 0x02, 0x00, 0x00};
+    VDEC_STREAM_S stStream;
+
+    BENCH_CHECK(2 == SAMPLE_COMM_VDEC_FindStartCode(au8Sc, sizeof(au8Sc)));
+    BENCH_CHECK(2 == SAMPLE_COMM_VDEC_FindStartCode(au8Sc + 3, sizeof(au8Sc) - 3));
+    BENCH_CHECK(sizeof(au8None) == SAMPLE_COMM_VDEC_FindStartCode(au8None, sizeof(au8None)));
+    BENCH_CHECK(0 == SAMPLE_COMM_VDEC_FindStartCode(au8Sc, 0));
+
+    /* no picture, no access unit */
+    BENCH_CHECK(HI_SUCCESS == SAMPLE_COMM_VDEC_BuildIndex(PT_H264, au8Sc, sizeof(au8Sc), &pstFrame, &u32Frames));
+    BENCH_CHECK(0 == u32Frames);
+    free(pstFrame);
+    BENCH_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_BuildIndex(PT_MJPEG, au8Sc, sizeof(au8Sc), &pstFrame, &u32Frames));
+
+    BENCH_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceOpen(0, "/nonexistent/x.h264", PT_H264, 0));
+    BENCH_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceOpen(VDEC_MAX_CHN_NUM, "x", PT_H264, 0));
+    BENCH_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceGetFrame(0, 0, &stStream));
+    BENCH_CHECK(HI_FAILURE == SAMPLE_COMM_VDEC_SourceClose(0));
+}
+
+int main(int argc, char *argv[])
+{
+    const HI_CHAR *pszDir = (argc > 1) ? argv[1] : "/tmp";
+
+    BENCH_Errors();
+
+    BENCH_Generated(PT_H264);
+    BENCH_Generated(SAMPLE_PT_H265);
+    BENCH_Generated(PT_MP4VIDEO);
+
+    BENCH_SampleFile("../1080P.h264", 1920, 1080, 150, 5);
+    BENCH_SampleFile("../CIF.h264", 352, 288, 1725, 18);
+
+    BENCH_Send(pszDir, PT_H264, VIDEO_MODE_FRAME);
+    BENCH_Send(pszDir, SAMPLE_PT_H265, VIDEO_MODE_FRAME);
+    BENCH_Send(pszDir, PT_MP4VIDEO, VIDEO_MODE_FRAME);
+    BENCH_Send(pszDir, PT_H264, VIDEO_MODE_STREAM);
+
+    printf("%s\n", (0 == s_s32Fail) ? "PASS" : "FAIL");
+    return (0 == s_s32Fail) ? 0 : 1;
+}
@@ -0,0 +1,474 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_stub.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/05/09
+  Description   : host stand-in for the vdec mpi. Sent streams are counted
+                  and hashed per channel, every one decoded is a picture for
+                  HI_MPI_VDEC_GetImage. Generated streams hold valid start
+                  codes and nal / vop headers, payload bytes are never zero
+                  so they never form a start code.
+  History       :
+  1.Date        : 2016/05/09
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mpi_vdec.h"
+#include "vdec_stub.h"
+
+#define VDEC_STUB_FNV_INIT      0x811C9DC5
+#define VDEC_STUB_PTS_LOG       4096
+#define VDEC_STUB_QUEUE         256
+#define VDEC_STUB_BUF_SIZE      (1024 * 1024)
+#define VDEC_STUB_PIC_WIDTH     1920
+#define VDEC_STUB_PIC_HEIGHT    1080
+
+typedef struct hiVDEC_STUB_CHN_S
+{
+    VDEC_STUB_STAT_S stStat;
+    HI_U32 u32RejectEvery;
+    HI_U32 u32Calls;
+    HI_U64 au64Pts[VDEC_STUB_PTS_LOG];
+    HI_U32 u32PtsCnt;
+    HI_U32 u32Fps;
+    HI_U32 u32BufSize;
+    HI_U32 au32Queue[VDEC_STUB_QUEUE];  /* lengths of the frames waiting for decode */
+    HI_U32 u32QueueHead;
+    HI_U32 u32QueueCnt;
+    HI_U32 u32QueueBytes;
+    HI_U64 u64DoneUs;                   /* when the frame at the head is decoded */
+    HI_U32 u32PicWidth;
+    HI_U32 u32PicHeight;
+    HI_U32 u32PicBuffers;
+    HI_U32 u32Ready;                    /* decoded pictures not got yet */
+    HI_U32 u32Held;                     /* got and not released */
+}VDEC_STUB_CHN_S;
+
+static VDEC_STUB_CHN_S s_astVdecStubChn[VDEC_MAX_CHN_NUM];
+static pthread_mutex_t s_VdecStubMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static HI_U64 VDEC_STUB_Us(HI_VOID)
+{
+    struct timespec stTs;
+
+    clock_gettime(CLOCK_MONOTONIC, &stTs);
+    return (HI_U64)stTs.tv_sec * 1000000 + stTs.tv_nsec / 1000;
+}
+
+/* takes the frames off the queue the decoder is done with by now */
+static HI_VOID VDEC_STUB_Decode(VDEC_STUB_CHN_S *pstChn, HI_U64 u64Now)
+{
+    while ((pstChn->u32QueueCnt > 0) && ((0 == pstChn->u32Fps) || (u64Now >= pstChn->u64DoneUs)))
+    {
+        if ((0 != pstChn->u32PicBuffers) && (pstChn->u32Ready + pstChn->u32Held >= pstChn->u32PicBuffers))
+        {
+            /* no buffer to decode into, the frame at the head takes its time from when there is one */
+            pstChn->u64DoneUs = u64Now + ((0 != pstChn->u32Fps) ? 1000000 / pstChn->u32Fps : 0);
+            break;
+        }
+        pstChn->u32Ready++;
+        pstChn->stStat.u64Pictures++;
+        pstChn->u32QueueBytes -= pstChn->au32Queue[pstChn->u32QueueHead];
+        pstChn->u32QueueHead = (pstChn->u32QueueHead + 1) % VDEC_STUB_QUEUE;
+        pstChn->u32QueueCnt--;
+        if (0 != pstChn->u32Fps)
+        {
+            pstChn->u64DoneUs += 1000000 / pstChn->u32Fps;
+        }
+    }
+}
+
+HI_U32 VDEC_STUB_Hash(HI_U32 u32Hash, const HI_U8 *pu8Data, HI_U32 u32Len)
+{
+    HI_U32 i;
+
+    for (i = 0; i < u32Len; i++)
+    {
+        u32Hash = (u32Hash ^ pu8Data[i]) * 16777619;
+    }
+    return u32Hash;
+}
+
+HI_VOID VDEC_STUB_Reset(HI_VOID)
+{
+    HI_S32 i;
+
+    pthread_mutex_lock(&s_VdecStubMutex);
+    memset(s_astVdecStubChn, 0, sizeof(s_astVdecStubChn));
+    for (i = 0; i < VDEC_MAX_CHN_NUM; i++)
+    {
+        s_astVdecStubChn[i].stStat.u32Hash = VDEC_STUB_FNV_INIT;
+    }
+    pthread_mutex_unlock(&s_VdecStubMutex);
+}
+
+HI_VOID VDEC_STUB_SetDecoder(VDEC_CHN VdChn, HI_U32 u32Fps, HI_U32 u32BufSize)
+{
+    pthread_mutex_lock(&s_VdecStubMutex);
+    s_astVdecStubChn[VdChn].u32Fps = u32Fps;
+    s_astVdecStubChn[VdChn].u32BufSize = u32BufSize;
+    pthread_mutex_unlock(&s_VdecStubMutex);
+}
+
+HI_VOID VDEC_STUB_SetPicture(VDEC_CHN VdChn, HI_U32 u32Width, HI_U32 u32Height, HI_U32 u32Buffers)
+{
+    pthread_mutex_lock(&s_VdecStubMutex);
+    s_astVdecStubChn[VdChn].u32PicWidth = u32Width;
+    s_astVdecStubChn[VdChn].u32PicHeight = u32Height;
+    s_astVdecStubChn[VdChn].u32PicBuffers = u32Buffers;
+    pthread_mutex_unlock(&s_VdecStubMutex);
+}
+
+HI_VOID VDEC_STUB_SetReject(VDEC_CHN VdChn, HI_U32 u32Every)
+{
+    pthread_mutex_lock(&s_VdecStubMutex);
+    s_astVdecStubChn[VdChn].u32RejectEvery = u32Every;
+    pthread_mutex_unlock(&s_VdecStubMutex);
+}
+
+HI_S32 VDEC_STUB_GetStat(VDEC_CHN VdChn, VDEC_STUB_STAT_S *pstStat)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM))
+    {
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&s_VdecStubMutex);
+    *pstStat = s_astVdecStubChn[VdChn].stStat;
+    pthread_mutex_unlock(&s_VdecStubMutex);
+    return HI_SUCCESS;
+}
+
+HI_U32 VDEC_STUB_GetPts(VDEC_CHN VdChn, HI_U64 *pu64Pts, HI_U32 u32Max)
+{
+    HI_U32 u32Cnt;
+
+    pthread_mutex_lock(&s_VdecStubMutex);
+    u32Cnt = (s_astVdecStubChn[VdChn].u32PtsCnt < u32Max) ? s_astVdecStubChn[VdChn].u32PtsCnt : u32Max;
+    memcpy(pu64Pts, s_astVdecStubChn[VdChn].au64Pts, sizeof(HI_U64) * u32Cnt);
+    pthread_mutex_unlock(&s_VdecStubMutex);
+    return u32Cnt;
+}
+
+HI_S32 HI_MPI_VDEC_SendStream(VDEC_CHN VdChn, const VDEC_STREAM_S *pstStream, HI_S32 s32MilliSec)
+{
+    VDEC_STUB_CHN_S *pstChn;
+    HI_U64 u64Now;
+    HI_S32 s32Waited = 0;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstStream))
+    {
+        return HI_FAILURE;
+    }
+    pstChn = &s_astVdecStubChn[VdChn];
+
+    pthread_mutex_lock(&s_VdecStubMutex);
+    while (HI_TRUE == pstStream->bEndOfStream)
+    {
+        /* with few picture buffers the frames before it have to be decoded, in steps of 1ms */
+        VDEC_STUB_Decode(pstChn, VDEC_STUB_Us());
+        if ((0 == pstChn->u32PicBuffers) || (0 == pstChn->u32QueueCnt))
+        {
+            pstChn->stStat.bEndOfStream = HI_TRUE;
+            pthread_mutex_unlock(&s_VdecStubMutex);
+            return HI_SUCCESS;
+        }
+        pthread_mutex_unlock(&s_VdecStubMutex);
+        if ((s32MilliSec >= 0) && (s32Waited >= s32MilliSec))
+        {
+            return HI_ERR_VDEC_BUF_FULL;
+        }
+        usleep(1000);
+        s32Waited++;
+        pthread_mutex_lock(&s_VdecStubMutex);
+    }
+    pstChn->u32Calls++;
+    u64Now = VDEC_STUB_Us();
+    VDEC_STUB_Decode(pstChn, u64Now);
+    if (((0 != pstChn->u32RejectEvery) && (0 == pstChn->u32Calls % pstChn->u32RejectEvery))
+        || (pstChn->u32QueueCnt == VDEC_STUB_QUEUE)
+        || (pstChn->u32QueueBytes + pstStream->u32Len
+            > ((0 != pstChn->u32BufSize) ? pstChn->u32BufSize : VDEC_STUB_BUF_SIZE)))
+    {
+        pstChn->stStat.u64Rejected++;
+        pthread_mutex_unlock(&s_VdecStubMutex);
+        return HI_FAILURE;
+    }
+    if ((0 == pstChn->u32QueueCnt) && (0 != pstChn->u32Fps))
+    {
+        pstChn->u64DoneUs = u64Now + 1000000 / pstChn->u32Fps;
+    }
+    pstChn->au32Queue[(pstChn->u32QueueHead + pstChn->u32QueueCnt) % VDEC_STUB_QUEUE] = pstStream->u32Len;
+    pstChn->u32QueueCnt++;
+    pstChn->u32QueueBytes += pstStream->u32Len;
+    VDEC_STUB_Decode(pstChn, u64Now);
+    pstChn->stStat.u64Sends++;
+    pstChn->stStat.u64Frames += (HI_TRUE == pstStream->bEndOfFrame) ? 1 : 0;
+    pstChn->stStat.u64Bytes += pstStream->u32Len;
+    pstChn->stStat.u32Hash = VDEC_STUB_Hash(pstChn->stStat.u32Hash, pstStream->pu8Addr, pstStream->u32Len);
+    pstChn->stStat.u64LastPts = pstStream->u64PTS;
+    if ((HI_TRUE == pstStream->bEndOfFrame) && (pstChn->u32PtsCnt < VDEC_STUB_PTS_LOG))
+    {
+        pstChn->au64Pts[pstChn->u32PtsCnt++] = pstStream->u64PTS;
+    }
+    pthread_mutex_unlock(&s_VdecStubMutex);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VDEC_Query(VDEC_CHN VdChn, VDEC_CHN_STAT_S *pstStat)
+{
+    VDEC_STUB_CHN_S *pstChn;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstStat))
+    {
+        return HI_FAILURE;
+    }
+    memset(pstStat, 0, sizeof(VDEC_CHN_STAT_S));
+    pthread_mutex_lock(&s_VdecStubMutex);
+    pstChn = &s_astVdecStubChn[VdChn];
+    VDEC_STUB_Decode(pstChn, VDEC_STUB_Us());
+    pstChn->stStat.u64Queries++;
+    pstStat->bStartRecvStream = HI_TRUE;
+    pstStat->u32LeftStreamBytes = pstChn->u32QueueBytes;
+    pstStat->u32LeftStreamFrames = pstChn->u32QueueCnt;
+    pstStat->u32RecvStreamFrames = (HI_U32)pstChn->stStat.u64Frames;
+    pstStat->u32DecodeStreamFrames = (HI_U32)pstChn->stStat.u64Frames - pstChn->u32QueueCnt;
+    pthread_mutex_unlock(&s_VdecStubMutex);
+    return HI_SUCCESS;
+}
+
+HI_S32 HI_MPI_VDEC_GetChnAttr(VDEC_CHN VdChn, VDEC_CHN_ATTR_S *pstAttr)
+{
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstAttr))
+    {
+        return HI_FAILURE;
+    }
+    memset(pstAttr, 0, sizeof(VDEC_CHN_ATTR_S));
+    pthread_mutex_lock(&s_VdecStubMutex);
+    pstAttr->enType = PT_H264;
+    pstAttr->u32BufSize = (0 != s_astVdecStubChn[VdChn].u32BufSize) ? s_astVdecStubChn[VdChn].u32BufSize
+                                                                    : VDEC_STUB_BUF_SIZE;
+    pstAttr->u32PicWidth = 1920;
+    pstAttr->u32PicHeight = 1088;
+    pthread_mutex_unlock(&s_VdecStubMutex);
+    return HI_SUCCESS;
+}
+
+/* waits for a decoded picture in steps of 1ms, s32MilliSec -1 for ever */
+HI_S32 HI_MPI_VDEC_GetImage(VDEC_CHN VdChn, VIDEO_FRAME_INFO_S *pstFrameInfo, HI_S32 s32MilliSec)
+{
+    VDEC_STUB_CHN_S *pstChn;
+    HI_S32 s32Waited = 0;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstFrameInfo))
+    {
+        return HI_FAILURE;
+    }
+    pstChn = &s_astVdecStubChn[VdChn];
+    while (1)
+    {
+        pthread_mutex_lock(&s_VdecStubMutex);
+        VDEC_STUB_Decode(pstChn, VDEC_STUB_Us());
+        if (pstChn->u32Ready > 0)
+        {
+            pstChn->u32Ready--;
+            pstChn->u32Held++;
+            pstChn->stStat.u64Got++;
+            memset(pstFrameInfo, 0, sizeof(VIDEO_FRAME_INFO_S));
+            pstFrameInfo->stVFrame.u32Width = (0 != pstChn->u32PicWidth) ? pstChn->u32PicWidth : VDEC_STUB_PIC_WIDTH;
+            pstFrameInfo->stVFrame.u32Height = (0 != pstChn->u32PicHeight) ? pstChn->u32PicHeight
+                                                                             : VDEC_STUB_PIC_HEIGHT;
+            pstFrameInfo->stVFrame.u32Field = VIDEO_FIELD_FRAME;
+            pstFrameInfo->stVFrame.enPixelFormat = PIXEL_FORMAT_YUV_SEMIPLANAR_420;
+            pstFrameInfo->stVFrame.u32Stride[0] = pstFrameInfo->stVFrame.u32Width;
+            pstFrameInfo->stVFrame.u32Stride[1] = pstFrameInfo->stVFrame.u32Width;
+            pstFrameInfo->stVFrame.u32TimeRef = (HI_U32)pstChn->stStat.u64Got * 2;
+            pthread_mutex_unlock(&s_VdecStubMutex);
+            return HI_SUCCESS;
+        }
+        pthread_mutex_unlock(&s_VdecStubMutex);
+        if ((s32MilliSec >= 0) && (s32Waited >= s32MilliSec))
+        {
+            return HI_ERR_VDEC_BUF_EMPTY;
+        }
+        usleep(1000);
+        s32Waited++;
+    }
+}
+
+HI_S32 HI_MPI_VDEC_ReleaseImage(VDEC_CHN VdChn, VIDEO_FRAME_INFO_S *pstFrameInfo)
+{
+    HI_S32 s32Ret = HI_FAILURE;
+
+    if ((VdChn < 0) || (VdChn >= VDEC_MAX_CHN_NUM) || (NULL == pstFrameInfo))
+    {
+        return HI_FAILURE;
+    }
+    pthread_mutex_lock(&s_VdecStubMutex);
+    if (s_astVdecStubChn[VdChn].u32Held > 0)
+    {
+        s_astVdecStubChn[VdChn].u32Held--;
+        s_astVdecStubChn[VdChn].stStat.u64Released++;
+        s32Ret = HI_SUCCESS;
+    }
+    pthread_mutex_unlock(&s_VdecStubMutex);
+    return s32Ret;
+}
+
+/* one nal / vop: start code, header bytes, u32Payload non zero bytes */
+static HI_U32 VDEC_STUB_PutUnit(HI_U8 *pu8Buf, HI_U32 u32Pos, HI_U32 u32Size, HI_BOOL bLong,
+                                const HI_U8 *pu8Hdr, HI_U32 u32HdrLen, HI_U32 u32Payload, HI_U32 u32Seed)
+{
+    HI_U32 u32Len = (bLong ? 4 : 3) + u32HdrLen + u32Payload;
+    HI_U32 i;
+
+    if (u32Pos + u32Len > u32Size)
+    {
+        return 0;
+    }
+    if (bLong)
+    {
+        pu8Buf[u32Pos++] = 0;
+    }
+    pu8Buf[u32Pos++] = 0;
+    pu8Buf[u32Pos++] = 0;
+    pu8Buf[u32Pos++] = 1;
+    memcpy(pu8Buf + u32Pos, pu8Hdr, u32HdrLen);
+    u32Pos += u32HdrLen;
+    for (i = 0; i < u32Payload; i++)
+    {
+        pu8Buf[u32Pos + i] = (HI_U8)((i * 7 + u32Seed) % 255 + 1);
+    }
+    return u32Len;
+}
+
+HI_U32 VDEC_STUB_MakeEs(PAYLOAD_TYPE_E enType, const VDEC_STUB_ES_CFG_S *pstCfg, HI_U8 *pu8Buf, HI_U32 u32Size,
+                        HI_U32 *pu32Offset, HI_U32 *pu32Len, HI_BOOL *pbKey)
+{
+    static const HI_U8 au8H264Aud[] = {0x09, 0xF0};
+    static const HI_U8 au8H264Sps[] = {0x67, 0x64, 0x00, 0x28};
+    static const HI_U8 au8H264Pps[] = {0x68};
+    static const HI_U8 au8H264Sei[] = {0x06, 0x05};
+    static const HI_U8 au8H265Aud[] = {0x46, 0x01, 0x50};
+    static const HI_U8 au8H265Vps[] = {0x40, 0x01};
+    static const HI_U8 au8H265Sps[] = {0x42, 0x01};
+    static const HI_U8 au8H265Pps[] = {0x44, 0x01};
+    static const HI_U8 au8H265Sei[] = {0x4E, 0x01};
+    static const HI_U8 au8Mp4Vos[] = {0xB0, 0xF5};
+    static const HI_U8 au8Mp4Vo[] = {0xB5, 0x09};
+    static const HI_U8 au8Mp4Vid[] = {0x00};
+    static const HI_U8 au8Mp4Vol[] = {0x20};
+    HI_U8 au8Slice[3];
+    HI_U32 u32Pos = 0;
+    HI_U32 u32Start = 0;
+    HI_U32 u32Unit;
+    HI_U32 u32Frame;
+    HI_U32 u32Slice;
+    HI_U32 u32Slices;
+    HI_U32 u32SliceLen;
+    HI_BOOL bKey;
+    HI_BOOL bLong;
+
+/* the first nal of an access unit gets a zero_byte, mpeg4 start codes never do */
+#define VDEC_STUB_PUT(hdr, hdrlen, payload, seed) \
+    do { \
+        u32Unit = VDEC_STUB_PutUnit(pu8Buf, u32Pos, u32Size, bLong, hdr, hdrlen, payload, seed); \
+        if (0 == u32Unit) return 0; \
+        u32Pos += u32Unit; \
+        bLong = HI_FALSE; \
+    } while (0)
+
+    u32Slices = ((PT_MP4VIDEO == enType) || (0 == pstCfg->u32Slices)) ? 1 : pstCfg->u32Slices;
+    for (u32Frame = 0; u32Frame < pstCfg->u32Frames; u32Frame++)
+    {
+        bKey = (0 == u32Frame % pstCfg->u32Gop) ? HI_TRUE : HI_FALSE;
+        u32Start = u32Pos;
+        bLong = (PT_MP4VIDEO == enType) ? HI_FALSE : HI_TRUE;
+        u32SliceLen = ((bKey ? pstCfg->u32IFrameLen : pstCfg->u32PFrameLen) + u32Slices - 1) / u32Slices;
+
+        if (PT_H264 == enType)
+        {
+            if (pstCfg->bAud)
+            {
+                VDEC_STUB_PUT(au8H264Aud, sizeof(au8H264Aud), 0, 0);
+            }
+            if (bKey)
+            {
+                VDEC_STUB_PUT(au8H264Sps, sizeof(au8H264Sps), 12, u32Frame);
+                VDEC_STUB_PUT(au8H264Pps, sizeof(au8H264Pps), 4, u32Frame);
+                VDEC_STUB_PUT(au8H264Sei, sizeof(au8H264Sei), 24, u32Frame);
+            }
+            for (u32Slice = 0; u32Slice < u32Slices; u32Slice++)
+            {
+                au8Slice[0] = bKey ? 0x65 : 0x41;
+                au8Slice[1] = (0 == u32Slice) ? 0x88 : 0x40 | (u32Slice & 0x3F);    /* first_mb_in_slice 0 or not */
+                VDEC_STUB_PUT(au8Slice, 2, u32SliceLen - 2, u32Frame + u32Slice);
+            }
+        }
+        else if ((PAYLOAD_TYPE_E)265 == enType)
+        {
+            if (pstCfg->bAud)
+            {
+                VDEC_STUB_PUT(au8H265Aud, sizeof(au8H265Aud), 0, 0);
+            }
+            if (bKey)
+            {
+                VDEC_STUB_PUT(au8H265Vps, sizeof(au8H265Vps), 20, u32Frame);
+                VDEC_STUB_PUT(au8H265Sps, sizeof(au8H265Sps), 36, u32Frame);
+                VDEC_STUB_PUT(au8H265Pps, sizeof(au8H265Pps), 6, u32Frame);
+                VDEC_STUB_PUT(au8H265Sei, sizeof(au8H265Sei), 24, u32Frame);
+            }
+            for (u32Slice = 0; u32Slice < u32Slices; u32Slice++)
+            {
+                au8Slice[0] = bKey ? (19 << 1) : (1 << 1);                          /* IDR_W_RADL or TRAIL_R */
+                au8Slice[1] = 0x01;
+                au8Slice[2] = (0 == u32Slice) ? 0xAC : 0x2C;                        /* first_slice_segment_in_pic_flag */
+                VDEC_STUB_PUT(au8Slice, 3, u32SliceLen - 3, u32Frame + u32Slice);
+            }
+        }
+        else if (PT_MP4VIDEO == enType)
+        {
+            if (bKey)
+            {
+                VDEC_STUB_PUT(au8Mp4Vos, sizeof(au8Mp4Vos), 0, 0);
+                VDEC_STUB_PUT(au8Mp4Vo, sizeof(au8Mp4Vo), 0, 0);
+                VDEC_STUB_PUT(au8Mp4Vid, sizeof(au8Mp4Vid), 4, u32Frame);
+                VDEC_STUB_PUT(au8Mp4Vol, sizeof(au8Mp4Vol), 14, u32Frame);
+            }
+            au8Slice[0] = 0xB6;
+            au8Slice[1] = bKey ? 0x10 : 0x50;                                       /* vop_coding_type I or P */
+            VDEC_STUB_PUT(au8Slice, 2, u32SliceLen - 2, u32Frame);
+        }
+        else
+        {
+            return 0;
+        }
+
+        if (NULL != pu32Offset)
+        {
+            pu32Offset[u32Frame] = u32Start;
+        }
+        if (NULL != pu32Len)
+        {
+            pu32Len[u32Frame] = u32Pos - u32Start;
+        }
+        if (NULL != pbKey)
+        {
+            pbKey[u32Frame] = bKey;
+        }
+    }
+#undef VDEC_STUB_PUT
+    return u32Pos;
+}
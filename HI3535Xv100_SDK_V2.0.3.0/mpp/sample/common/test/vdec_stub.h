@@ -0,0 +1,72 @@
+/******************************************************************************
+
+  Copyright (C), 2010-2016, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : vdec_stub.h
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/05/09
+  Description   : host stand-in for the vdec mpi, takes what the sample layer
+                  sends and makes elementary streams to send, so the feeding
+                  side can be measured without a board
+  History       :
+  1.Date        : 2016/05/09
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#ifndef __VDEC_STUB_H__
+#define __VDEC_STUB_H__
+
+#include "hi_type.h"
+#include "hi_common.h"
+#include "hi_comm_vdec.h"
+
+typedef struct hiVDEC_STUB_STAT_S
+{
+    HI_U64 u64Sends;            /* accepted HI_MPI_VDEC_SendStream calls, end of stream not counted */
+    HI_U64 u64Frames;           /* of them with bEndOfFrame */
+    HI_U64 u64Bytes;
+    HI_U64 u64Rejected;                 /* by VDEC_STUB_SetReject or a full stream buffer */
+    HI_U64 u64Queries;
+    HI_U32 u32Hash;             /* fnv-1a over all accepted bytes */
+    HI_U64 u64LastPts;
+    HI_BOOL bEndOfStream;
+    HI_U64 u64Pictures;         /* decoded, every accepted send makes one */
+    HI_U64 u64Got;              /* by HI_MPI_VDEC_GetImage */
+    HI_U64 u64Released;
+}VDEC_STUB_STAT_S;
+
+typedef struct hiVDEC_STUB_ES_CFG_S
+{
+    HI_U32 u32Frames;
+    HI_U32 u32Gop;
+    HI_U32 u32IFrameLen;        /* bytes of the slices of a key picture, parameter sets come on top */
+    HI_U32 u32PFrameLen;
+    HI_U32 u32Slices;           /* slices a picture is split into, mpeg4 has one vop */
+    HI_BOOL bAud;               /* h264 / h265: access unit delimiter in front of every picture */
+}VDEC_STUB_ES_CFG_S;
+
+HI_VOID VDEC_STUB_Reset(HI_VOID);
+/* HI_MPI_VDEC_SendStream refuses every u32Every-th call of the channel, 0 never */
+HI_VOID VDEC_STUB_SetReject(VDEC_CHN VdChn, HI_U32 u32Every);
+HI_S32 VDEC_STUB_GetStat(VDEC_CHN VdChn, VDEC_STUB_STAT_S *pstStat);
+/* the channel decodes u32Fps frames a second (0: at once) from a stream buffer of u32BufSize
+   bytes (0: 1MB), HI_MPI_VDEC_Query shows what is waiting, a frame that does not fit is refused */
+HI_VOID VDEC_STUB_SetDecoder(VDEC_CHN VdChn, HI_U32 u32Fps, HI_U32 u32BufSize);
+/* decoded pictures are u32Width x u32Height (0: 1920x1080), with u32Buffers (0: no limit) the
+   decoder stops while that many are decoded and not released yet. The end of stream then goes in
+   only behind the frames before it, HI_MPI_VDEC_SendStream waits for them to be decoded */
+HI_VOID VDEC_STUB_SetPicture(VDEC_CHN VdChn, HI_U32 u32Width, HI_U32 u32Height, HI_U32 u32Buffers);
+/* pts of the first frames the channel took since VDEC_STUB_Reset, returns how many */
+HI_U32 VDEC_STUB_GetPts(VDEC_CHN VdChn, HI_U64 *pu64Pts, HI_U32 u32Max);
+HI_U32 VDEC_STUB_Hash(HI_U32 u32Hash, const HI_U8 *pu8Data, HI_U32 u32Len);
+
+/* PT_H264, 265 (h265) or PT_MP4VIDEO into pu8Buf, returns its length or 0 if it does not fit,
+   the arrays of u32Frames entries (may be NULL) get where every access unit is */
+HI_U32 VDEC_STUB_MakeEs(PAYLOAD_TYPE_E enType, const VDEC_STUB_ES_CFG_S *pstCfg, HI_U8 *pu8Buf, HI_U32 u32Size,
+                        HI_U32 *pu32Offset, HI_U32 *pu32Len, HI_BOOL *pbKey);
+
+#endif /* End of #ifndef __VDEC_STUB_H__ */
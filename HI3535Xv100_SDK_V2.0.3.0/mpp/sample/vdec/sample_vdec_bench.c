@@ -0,0 +1,277 @@
+/******************************************************************************
+
+  Copyright (C), 2011-2021, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : sample_vdec_bench.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/6/6
+  Description   : decoder throughput benchmark. Starts N vdec channels of one
+                  codec, size and mode, feeds them from streams in memory as
+                  fast as they decode, takes their pictures without display
+                  and reports decoded fps by channel, pixel rate, cpu load
+                  and memory every interval.
+  History       :
+  1.Date        : 2016/6/6
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <signal.h>
+
+#include "sample_comm.h"
+
+/* pictures a channel decodes into: reference, the one decoding and the one got */
+#define SAMPLE_VDEC_BENCH_PIC_BLK   4
+
+static volatile HI_BOOL gs_bBenchQuit = HI_FALSE;
+
+HI_VOID SAMPLE_VDEC_BENCH_HandleSig(HI_S32 signo)
+{
+    if (SIGINT == signo || SIGTERM == signo)
+    {
+        gs_bBenchQuit = HI_TRUE;
+    }
+}
+
+HI_VOID SAMPLE_VDEC_BENCH_Usage(HI_CHAR *sPrgNm)
+{
+    printf("Usage : %s [-n chn] [-t codec] [-s size] [-m mode] [-f file] [-d sec] [-i sec]\n", sPrgNm);
+    printf("\t-n: channels, 1 - %d, default 1\n", VDEC_MAX_CHN_NUM);
+    printf("\t-t: h264 or mpeg4, default h264\n");
+    printf("\t-s: d1, 720p, 1080p or WxH, default 1080p\n");
+    printf("\t-m: frame or stream, default frame\n");
+    printf("\t-f: stream file, an elementary stream or an mp4 / ts of it, default %s or %s\n",
+           SAMPLE_1080P_H264_PATH, SAMPLE_1080P_MPEG4_PATH);
+    printf("\t-d: seconds to run, 0 until ctrl-c, default 30\n");
+    printf("\t-i: seconds between reports, default 5\n");
+    printf("e.g : %s -n 16 -t h264 -s 720p -m stream\n", sPrgNm);
+}
+
+static HI_S32 SAMPLE_VDEC_BENCH_ParseSize(const HI_CHAR *pszSize, SIZE_S *pstSize)
+{
+    if (0 == strcmp(pszSize, "d1"))
+    {
+        pstSize->u32Width = 720;
+        pstSize->u32Height = 576;
+    }
+    else if (0 == strcmp(pszSize, "720p"))
+    {
+        pstSize->u32Width = 1280;
+        pstSize->u32Height = 720;
+    }
+    else if (0 == strcmp(pszSize, "1080p"))
+    {
+        pstSize->u32Width = HD_WIDTH;
+        pstSize->u32Height = HD_HEIGHT;
+    }
+    else if ((2 != sscanf(pszSize, "%ux%u", &pstSize->u32Width, &pstSize->u32Height))
+             || (0 == pstSize->u32Width) || (0 == pstSize->u32Height))
+    {
+        return HI_FAILURE;
+    }
+    return HI_SUCCESS;
+}
+
+/* average fps of every channel over the whole run */
+static HI_VOID SAMPLE_VDEC_BENCH_Summary(HI_S32 s32ChnNum, HI_U32 u32Seconds, const SIZE_S *pstSize)
+{
+    SAMPLE_VDEC_BENCH_STAT_S stStat;
+    HI_U64 u64Pictures = 0;
+    HI_FLOAT fMinFps = 0;
+    HI_FLOAT fFps;
+    HI_S32 i;
+
+    if (0 == u32Seconds)
+    {
+        return;
+    }
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        if (HI_SUCCESS != SAMPLE_COMM_VDEC_BenchGetStat(i, &stStat))
+        {
+            continue;
+        }
+        fFps = (HI_FLOAT)stStat.u64Pictures / u32Seconds;
+        fMinFps = ((0 == i) || (fFps < fMinFps)) ? fFps : fMinFps;
+        u64Pictures += stStat.u64Pictures;
+    }
+    printf("==== %d chn of %ux%u in %u s: %.1f fps in all, %.1f fps on the slowest chn, %.2f Mpixel/s ====\n",
+           s32ChnNum, pstSize->u32Width, pstSize->u32Height, u32Seconds, (HI_FLOAT)u64Pictures / u32Seconds,
+           fMinFps, (HI_FLOAT)u64Pictures * pstSize->u32Width * pstSize->u32Height / u32Seconds / 1000000);
+}
+
+/******************************************************************************
+* function    : main()
+* Description : vdec throughput benchmark
+******************************************************************************/
+int main(int argc, char *argv[])
+{
+    VB_CONF_S stVbConf, stModVbConf;
+    VDEC_CHN_ATTR_S stVdecChnAttr[VDEC_MAX_CHN_NUM];
+    VdecThreadParam stVdecSend[VDEC_MAX_CHN_NUM];
+    SAMPLE_VDEC_BENCH_REPORT_S stReport;
+    PAYLOAD_TYPE_E enType = PT_H264;
+    VIDEO_MODE_E enMode = VIDEO_MODE_FRAME;
+    SIZE_S stSize = {HD_WIDTH, HD_HEIGHT};
+    HI_CHAR *pszFile = NULL;
+    HI_S32 s32ChnNum = 1;
+    HI_U32 u32Duration = 30;
+    HI_U32 u32Interval = 5;
+    HI_U32 u32Elapsed = 0;
+    HI_U32 u32Slept;
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_S32 s32Opt;
+    HI_S32 i;
+
+    while (-1 != (s32Opt = getopt(argc, argv, "n:t:s:m:f:d:i:h")))
+    {
+        switch (s32Opt)
+        {
+            case 'n':
+                s32ChnNum = atoi(optarg);
+                break;
+            case 't':
+                if (0 == strcmp(optarg, "h264"))
+                {
+                    enType = PT_H264;
+                }
+                else if (0 == strcmp(optarg, "mpeg4"))
+                {
+                    enType = PT_MP4VIDEO;
+                }
+                else
+                {
+                    s32ChnNum = 0;
+                }
+                break;
+            case 's':
+                if (HI_SUCCESS != SAMPLE_VDEC_BENCH_ParseSize(optarg, &stSize))
+                {
+                    s32ChnNum = 0;
+                }
+                break;
+            case 'm':
+                if (0 == strcmp(optarg, "frame"))
+                {
+                    enMode = VIDEO_MODE_FRAME;
+                }
+                else if (0 == strcmp(optarg, "stream"))
+                {
+                    enMode = VIDEO_MODE_STREAM;
+                }
+                else
+                {
+                    s32ChnNum = 0;
+                }
+                break;
+            case 'f':
+                pszFile = optarg;
+                break;
+            case 'd':
+                u32Duration = (HI_U32)atoi(optarg);
+                break;
+            case 'i':
+                u32Interval = (HI_U32)atoi(optarg);
+                break;
+            default:
+                s32ChnNum = 0;
+                break;
+        }
+    }
+    if ((s32ChnNum <= 0) || (s32ChnNum > VDEC_MAX_CHN_NUM) || (0 == u32Interval))
+    {
+        SAMPLE_VDEC_BENCH_Usage(argv[0]);
+        return HI_FAILURE;
+    }
+    if (NULL == pszFile)
+    {
+        pszFile = (PT_H264 == enType) ? SAMPLE_1080P_H264_PATH : SAMPLE_1080P_MPEG4_PATH;
+    }
+
+    signal(SIGINT, SAMPLE_VDEC_BENCH_HandleSig);
+    signal(SIGTERM, SAMPLE_VDEC_BENCH_HandleSig);
+
+    /************************************************
+       step1:  init SYS and common VB
+    *************************************************/
+    SAMPLE_COMM_VDEC_Sysconf(&stVbConf, &stSize);
+    s32Ret = SAMPLE_COMM_SYS_Init(&stVbConf);
+    if (s32Ret != HI_SUCCESS)
+    {
+        SAMPLE_PRT("init sys fail for %#x!\n", s32Ret);
+        goto END1;
+    }
+
+    /************************************************
+      step2:  init mod common VB, pictures for every channel
+    *************************************************/
+    SAMPLE_COMM_VDEC_ModCommPoolConf(&stModVbConf, enType, &stSize);
+    stModVbConf.astCommPool[0].u32BlkCnt = MAX2(stModVbConf.astCommPool[0].u32BlkCnt,
+                                                (HI_U32)s32ChnNum * SAMPLE_VDEC_BENCH_PIC_BLK);
+    s32Ret = SAMPLE_COMM_VDEC_InitModCommVb(&stModVbConf);
+    if (s32Ret != HI_SUCCESS)
+    {
+        SAMPLE_PRT("init mod common vb fail for %#x!\n", s32Ret);
+        goto END1;
+    }
+
+    /************************************************
+      step3:  start VDEC, not bound: the bench takes the pictures
+    *************************************************/
+    SAMPLE_COMM_VDEC_ChnAttr(s32ChnNum, &stVdecChnAttr[0], enType, &stSize);
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        stVdecChnAttr[i].stVdecVideoAttr.enMode = enMode;
+    }
+    s32Ret = SAMPLE_COMM_VDEC_Start(s32ChnNum, &stVdecChnAttr[0]);
+    if (s32Ret != HI_SUCCESS)
+    {
+        SAMPLE_PRT("start VDEC fail for %#x!\n", s32Ret);
+        goto END2;
+    }
+
+    /************************************************
+      step4:  feed from memory and report
+    *************************************************/
+    SAMPLE_COMM_VDEC_ThreadParam(s32ChnNum, &stVdecSend[0], &stVdecChnAttr[0], pszFile);
+    for (i = 0; i < s32ChnNum; i++)
+    {
+        stVdecSend[i].u64PtsIncrease = 40000;
+    }
+    s32Ret = SAMPLE_COMM_VDEC_BenchStart(s32ChnNum, &stVdecSend[0]);
+    if (s32Ret != HI_SUCCESS)
+    {
+        SAMPLE_PRT("start bench fail for %#x!\n", s32Ret);
+        goto END2;
+    }
+    printf("%d chn of %s %ux%u in %s mode from %s, ctrl-c to stop\n", s32ChnNum,
+           (PT_H264 == enType) ? "h264" : "mpeg4", stSize.u32Width, stSize.u32Height,
+           (VIDEO_MODE_FRAME == enMode) ? "frame" : "stream", pszFile);
+
+    while ((HI_TRUE != gs_bBenchQuit) && ((0 == u32Duration) || (u32Elapsed < u32Duration)))
+    {
+        for (u32Slept = 0; (u32Slept < u32Interval) && (HI_TRUE != gs_bBenchQuit); u32Slept++)
+        {
+            sleep(1);
+        }
+        u32Elapsed += u32Slept;
+        SAMPLE_COMM_VDEC_BenchReport(&stReport);
+    }
+    SAMPLE_VDEC_BENCH_Summary(s32ChnNum, u32Elapsed, &stSize);
+    SAMPLE_COMM_VDEC_BenchStop();
+
+END2:
+    SAMPLE_COMM_VDEC_Stop(s32ChnNum);
+
+END1:
+    SAMPLE_COMM_SYS_Exit();
+
+    return s32Ret;
+}
@@ -0,0 +1,369 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2011, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : zone_stat_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/14
+  Description   : unit test and benchmark of the zone statistics helpers.
+                  Every kernel is checked against a plain reference on random
+                  AE/AWB statistics (and the NEON backend against the scalar
+                  one when built for NEON), then timed against the reference.
+  History       :
+  1.Date        : 2016/03/14
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "hi_comm_isp.h"
+#include "zone_stat.h"
+
+#define TEST_AE_ZONE_NUM    (AE_ZONE_ROW * AE_ZONE_COLUMN)
+#define TEST_AWB_ZONE_NUM   (AWB_ZONE_ROW * AWB_ZONE_COLUMN)
+#define TEST_ITER           (2000)
+#define TEST_BENCH_LOOP     (20000)
+
+static HI_U16 s_au16AeZone[AE_ZONE_ROW][AE_ZONE_COLUMN][ISP_BAYER_CHN_NUM];
+static HI_U8  s_au8Weight[AE_ZONE_ROW][AE_ZONE_COLUMN];
+static HI_U32 s_au32Hist[HIST_1024_NUM];
+static HI_U32 s_au32Cum[HIST_1024_NUM];
+static HI_U32 s_au32CumC[HIST_1024_NUM];
+static HI_U16 s_au16R[TEST_AWB_ZONE_NUM];
+static HI_U16 s_au16G[TEST_AWB_ZONE_NUM];
+static HI_U16 s_au16B[TEST_AWB_ZONE_NUM];
+static HI_U16 s_au16Rg[TEST_AWB_ZONE_NUM];
+static HI_U16 s_au16Bg[TEST_AWB_ZONE_NUM];
+static HI_U16 s_au16RgRef[TEST_AWB_ZONE_NUM];
+static HI_U16 s_au16BgRef[TEST_AWB_ZONE_NUM];
+static HI_U8  s_au8Mask[TEST_AWB_ZONE_NUM];
+static HI_U8  s_au8MaskRef[TEST_AWB_ZONE_NUM];
+
+static HI_S32 s_s32Fail = 0;
+
+#define TEST_CHECK(cond, ...)\
+do {\
+    if (!(cond))\
+    {\
+        printf("FAIL %s:%d: ", __FUNCTION__, __LINE__);\
+        printf(__VA_ARGS__);\
+        printf("\n");\
+        s_s32Fail++;\
+    }\
+}while(0)
+
+static HI_U64 TEST_GetTimeUs(HI_VOID)
+{
+    struct timeval stTime;
+
+    gettimeofday(&stTime, NULL);
+    return (HI_U64)stTime.tv_sec * 1000000 + stTime.tv_usec;
+}
+
+/****************************************************************************
+ * reference implementations, written the way the sample 3A libs do it      *
+ ****************************************************************************/
+
+static HI_U16 REF_WeightedAvg(HI_U32 u32Chn)
+{
+    HI_U32 i, j;
+    HI_U64 u64Sum = 0;
+    HI_U32 u32WeightSum = 0;
+
+    for (i = 0; i < AE_ZONE_ROW; i++)
+    {
+        for (j = 0; j < AE_ZONE_COLUMN; j++)
+        {
+            u64Sum       += s_au16AeZone[i][j][u32Chn] * s_au8Weight[i][j];
+            u32WeightSum += s_au8Weight[i][j];
+        }
+    }
+
+    return u32WeightSum ? (HI_U16)((u64Sum + u32WeightSum / 2) / u32WeightSum) : 0;
+}
+
+static HI_U32 REF_Percentile(HI_U32 u32Permille)
+{
+    HI_U32 i;
+    HI_U64 u64Total = 0, u64Cum = 0;
+
+    for (i = 0; i < HIST_1024_NUM; i++)
+    {
+        u64Total += s_au32Hist[i];
+    }
+    for (i = 0; i < HIST_1024_NUM; i++)
+    {
+        u64Cum += s_au32Hist[i];
+        if (u64Cum * 1000 >= u64Total * u32Permille)
+        {
+            return i;
+        }
+    }
+
+    return HIST_1024_NUM - 1;
+}
+
+static HI_U32 REF_HistMean(HI_VOID)
+{
+    HI_U32 i;
+    HI_DOUBLE dSum = 0, dTotal = 0;
+
+    for (i = 0; i < HIST_1024_NUM; i++)
+    {
+        dSum   += (HI_DOUBLE)s_au32Hist[i] * i;
+        dTotal += s_au32Hist[i];
+    }
+
+    return dTotal ? (HI_U32)(dSum * 256 / dTotal + 0.5) : 0;
+}
+
+static HI_VOID REF_Ratio(HI_VOID)
+{
+    HI_U32 i, u32Rg, u32Bg;
+
+    for (i = 0; i < TEST_AWB_ZONE_NUM; i++)
+    {
+        u32Rg = s_au16G[i] ? ((HI_U32)s_au16R[i] * 256 / s_au16G[i]) : 0xFFF;
+        u32Bg = s_au16G[i] ? ((HI_U32)s_au16B[i] * 256 / s_au16G[i]) : 0xFFF;
+        s_au16RgRef[i] = (u32Rg > 0xFFF) ? 0xFFF : u32Rg;
+        s_au16BgRef[i] = (u32Bg > 0xFFF) ? 0xFFF : u32Bg;
+    }
+}
+
+static HI_U32 REF_Grey(const ZONE_STAT_GREY_CFG_S *pstCfg, ZONE_STAT_GREY_SUM_S *pstSum)
+{
+    HI_U32 i;
+
+    memset(pstSum, 0, sizeof(*pstSum));
+    for (i = 0; i < TEST_AWB_ZONE_NUM; i++)
+    {
+        s_au8MaskRef[i] = 0;
+        if (s_au16G[i] < pstCfg->u16BlackLevel || s_au16G[i] > pstCfg->u16WhiteLevel)
+        {
+            continue;
+        }
+        if (s_au16RgRef[i] < pstCfg->u16RgMin || s_au16RgRef[i] > pstCfg->u16RgMax
+            || s_au16BgRef[i] < pstCfg->u16BgMin || s_au16BgRef[i] > pstCfg->u16BgMax)
+        {
+            continue;
+        }
+        s_au8MaskRef[i] = 1;
+        pstSum->u32Count++;
+        pstSum->u32SumR += s_au16R[i];
+        pstSum->u32SumG += s_au16G[i];
+        pstSum->u32SumB += s_au16B[i];
+    }
+
+    return pstSum->u32Count;
+}
+
+/****************************************************************************
+ * random statistics                                                        *
+ ****************************************************************************/
+
+static HI_U16 TEST_Rand16(HI_VOID)
+{
+    /* mostly mid-tones, with some black, saturated and extreme zones */
+    switch (rand() % 8)
+    {
+        case 0 : return 0;
+        case 1 : return 0xFFFF;
+        case 2 : return (HI_U16)(rand() % 16);
+        default: return (HI_U16)(rand() & 0xFFFF);
+    }
+}
+
+static HI_VOID TEST_GenStat(HI_VOID)
+{
+    HI_U32 i, j, k;
+
+    for (i = 0; i < AE_ZONE_ROW; i++)
+    {
+        for (j = 0; j < AE_ZONE_COLUMN; j++)
+        {
+            s_au8Weight[i][j] = (HI_U8)((rand() % 4) ? (rand() % 16) : (rand() & 0xFF));
+            for (k = 0; k < ISP_BAYER_CHN_NUM; k++)
+            {
+                s_au16AeZone[i][j][k] = TEST_Rand16();
+            }
+        }
+    }
+
+    for (i = 0; i < HIST_1024_NUM; i++)
+    {
+        s_au32Hist[i] = (rand() % 3) ? (HI_U32)(rand() % 4000) : 0;
+    }
+
+    for (i = 0; i < TEST_AWB_ZONE_NUM; i++)
+    {
+        s_au16G[i] = TEST_Rand16();
+        /* R and B near G so that the ratios hit the grey box */
+        s_au16R[i] = (rand() % 2) ? TEST_Rand16() : (HI_U16)(s_au16G[i] / 2 + rand() % 256);
+        s_au16B[i] = (rand() % 2) ? TEST_Rand16() : (HI_U16)(s_au16G[i] / 2 + rand() % 256);
+    }
+}
+
+/****************************************************************************
+ * tests                                                                    *
+ ****************************************************************************/
+
+static HI_VOID TEST_Kernels(HI_VOID)
+{
+    HI_U32 u32Iter, u32Chn, u32Permille, u32Total, i;
+    HI_U16 au16Clip[TEST_AWB_ZONE_NUM], au16ClipRef[TEST_AWB_ZONE_NUM];
+    ZONE_STAT_GREY_CFG_S stCfg;
+    ZONE_STAT_GREY_SUM_S stSum, stSumRef;
+
+    for (u32Iter = 0; u32Iter < TEST_ITER; u32Iter++)
+    {
+        TEST_GenStat();
+
+        for (u32Chn = 0; u32Chn < ISP_BAYER_CHN_NUM; u32Chn++)
+        {
+            HI_U16 u16Ref = REF_WeightedAvg(u32Chn);
+            HI_U16 u16Avg = ZONE_STAT_WeightedAvg(&s_au16AeZone[0][0][u32Chn], ISP_BAYER_CHN_NUM,
+                &s_au8Weight[0][0], TEST_AE_ZONE_NUM);
+
+            TEST_CHECK(u16Avg == u16Ref, "weighted avg chn %u: %u != %u", u32Chn, u16Avg, u16Ref);
+            TEST_CHECK(ZONE_STAT_WeightedAvgC(&s_au16AeZone[0][0][u32Chn], ISP_BAYER_CHN_NUM,
+                &s_au8Weight[0][0], TEST_AE_ZONE_NUM) == u16Ref, "weighted avg C chn %u", u32Chn);
+        }
+
+        u32Total = ZONE_STAT_HistCumSum(s_au32Hist, HIST_1024_NUM, s_au32Cum);
+        TEST_CHECK(ZONE_STAT_HistCumSumC(s_au32Hist, HIST_1024_NUM, s_au32CumC) == u32Total, "cum sum total");
+        TEST_CHECK(0 == memcmp(s_au32Cum, s_au32CumC, sizeof(s_au32Cum)), "cum sum");
+        for (u32Permille = 0; u32Permille <= 1000; u32Permille += 50)
+        {
+            HI_U32 u32Ref = REF_Percentile(u32Permille);
+            HI_U32 u32Bin = ZONE_STAT_HistPercentile(s_au32Cum, HIST_1024_NUM, u32Permille);
+
+            TEST_CHECK(u32Bin == u32Ref, "percentile %u: %u != %u", u32Permille, u32Bin, u32Ref);
+        }
+        TEST_CHECK(ZONE_STAT_HistMean(s_au32Hist, HIST_1024_NUM) == REF_HistMean(), "hist mean %u != %u",
+            ZONE_STAT_HistMean(s_au32Hist, HIST_1024_NUM), REF_HistMean());
+
+        REF_Ratio();
+        ZONE_STAT_CalcRatio(s_au16R, s_au16G, s_au16B, TEST_AWB_ZONE_NUM, s_au16Rg, s_au16Bg);
+        for (i = 0; i < TEST_AWB_ZONE_NUM; i++)
+        {
+            TEST_CHECK(s_au16Rg[i] == s_au16RgRef[i] && s_au16Bg[i] == s_au16BgRef[i],
+                "ratio zone %u: R %u G %u B %u -> %u/%u, ref %u/%u", i, s_au16R[i], s_au16G[i], s_au16B[i],
+                s_au16Rg[i], s_au16Bg[i], s_au16RgRef[i], s_au16BgRef[i]);
+        }
+
+        stCfg.u16BlackLevel = (HI_U16)(rand() % 0x1000);
+        stCfg.u16WhiteLevel = (HI_U16)(0xF000 + rand() % 0x1000);
+        stCfg.u16RgMin      = (HI_U16)(0x40 + rand() % 0x40);
+        stCfg.u16RgMax      = (HI_U16)(0x100 + rand() % 0x100);
+        stCfg.u16BgMin      = (HI_U16)(0x40 + rand() % 0x40);
+        stCfg.u16BgMax      = (HI_U16)(0x100 + rand() % 0x100);
+        REF_Grey(&stCfg, &stSumRef);
+        TEST_CHECK(ZONE_STAT_GreyFilter(s_au16R, s_au16G, s_au16B, s_au16Rg, s_au16Bg, TEST_AWB_ZONE_NUM,
+            &stCfg, s_au8Mask, &stSum) == stSumRef.u32Count, "grey count");
+        TEST_CHECK(0 == memcmp(&stSum, &stSumRef, sizeof(stSum)), "grey sums");
+        TEST_CHECK(0 == memcmp(s_au8Mask, s_au8MaskRef, sizeof(s_au8Mask)), "grey mask");
+
+        memcpy(au16Clip, s_au16G, sizeof(au16Clip));
+        for (i = 0; i < TEST_AWB_ZONE_NUM; i++)
+        {
+            au16ClipRef[i] = (s_au16G[i] < stCfg.u16BlackLevel) ? stCfg.u16BlackLevel
+                           : (s_au16G[i] > stCfg.u16WhiteLevel) ? stCfg.u16WhiteLevel : s_au16G[i];
+        }
+        ZONE_STAT_Clip(au16Clip, TEST_AWB_ZONE_NUM, stCfg.u16BlackLevel, stCfg.u16WhiteLevel);
+        TEST_CHECK(0 == memcmp(au16Clip, au16ClipRef, sizeof(au16Clip)), "clip");
+
+#ifdef ZONE_STAT_NEON
+        /* odd lengths exercise the tails of the NEON loops */
+        {
+            HI_U32 u32Num = 1 + rand() % TEST_AE_ZONE_NUM;
+
+            TEST_CHECK(ZONE_STAT_WeightedAvgNeon(&s_au16AeZone[0][0][3], 4, &s_au8Weight[0][0], u32Num)
+                == ZONE_STAT_WeightedAvgC(&s_au16AeZone[0][0][3], 4, &s_au8Weight[0][0], u32Num),
+                "neon weighted avg num %u", u32Num);
+            TEST_CHECK(ZONE_STAT_HistCumSumNeon(s_au32Hist, u32Num, s_au32Cum)
+                == ZONE_STAT_HistCumSumC(s_au32Hist, u32Num, s_au32CumC), "neon cum sum num %u", u32Num);
+            TEST_CHECK(0 == memcmp(s_au32Cum, s_au32CumC, u32Num * sizeof(HI_U32)), "neon cum sum num %u", u32Num);
+            TEST_CHECK(ZONE_STAT_HistMeanNeon(s_au32Hist, u32Num) == ZONE_STAT_HistMeanC(s_au32Hist, u32Num),
+                "neon hist mean num %u", u32Num);
+        }
+#endif
+    }
+}
+
+/****************************************************************************
+ * benchmark                                                                *
+ ****************************************************************************/
+
+#define TEST_BENCH(name, ref, lib)\
+do {\
+    HI_U64 u64Start, u64Ref, u64Lib;\
+    HI_U32 u32Loop;\
+    u64Start = TEST_GetTimeUs();\
+    for (u32Loop = 0; u32Loop < TEST_BENCH_LOOP; u32Loop++) { ref; }\
+    u64Ref = TEST_GetTimeUs() - u64Start;\
+    u64Start = TEST_GetTimeUs();\
+    for (u32Loop = 0; u32Loop < TEST_BENCH_LOOP; u32Loop++) { lib; }\
+    u64Lib = TEST_GetTimeUs() - u64Start;\
+    printf("%-24s reference %8.1f ns  zone_stat %8.1f ns  x%.2f\n", name,\
+        u64Ref * 1000.0 / TEST_BENCH_LOOP, u64Lib * 1000.0 / TEST_BENCH_LOOP,\
+        u64Lib ? (HI_DOUBLE)u64Ref / u64Lib : 0.0);\
+}while(0)
+
+static HI_VOID TEST_Benchmark(HI_VOID)
+{
+    volatile HI_U32 u32Sink = 0;
+    ZONE_STAT_GREY_CFG_S stCfg = {0xF000, 0x100, 0x80, 0x180, 0x80, 0x180};
+    ZONE_STAT_GREY_SUM_S stSum;
+
+    TEST_GenStat();
+    printf("backend: %s, %u loops\n",
+#ifdef ZONE_STAT_NEON
+        "NEON",
+#else
+        "scalar",
+#endif
+        TEST_BENCH_LOOP);
+
+    TEST_BENCH("weighted avg (4 chn)",
+        u32Sink += REF_WeightedAvg(0) + REF_WeightedAvg(1) + REF_WeightedAvg(2) + REF_WeightedAvg(3),
+        u32Sink += ZONE_STAT_WeightedAvg(&s_au16AeZone[0][0][0], 4, &s_au8Weight[0][0], TEST_AE_ZONE_NUM)
+                 + ZONE_STAT_WeightedAvg(&s_au16AeZone[0][0][1], 4, &s_au8Weight[0][0], TEST_AE_ZONE_NUM)
+                 + ZONE_STAT_WeightedAvg(&s_au16AeZone[0][0][2], 4, &s_au8Weight[0][0], TEST_AE_ZONE_NUM)
+                 + ZONE_STAT_WeightedAvg(&s_au16AeZone[0][0][3], 4, &s_au8Weight[0][0], TEST_AE_ZONE_NUM));
+    TEST_BENCH("hist percentile x4",
+        u32Sink += REF_Percentile(10) + REF_Percentile(500) + REF_Percentile(900) + REF_Percentile(990),
+        ZONE_STAT_HistCumSum(s_au32Hist, HIST_1024_NUM, s_au32Cum);
+        u32Sink += ZONE_STAT_HistPercentile(s_au32Cum, HIST_1024_NUM, 10)
+                 + ZONE_STAT_HistPercentile(s_au32Cum, HIST_1024_NUM, 500)
+                 + ZONE_STAT_HistPercentile(s_au32Cum, HIST_1024_NUM, 900)
+                 + ZONE_STAT_HistPercentile(s_au32Cum, HIST_1024_NUM, 990));
+    TEST_BENCH("hist mean",
+        u32Sink += REF_HistMean(),
+        u32Sink += ZONE_STAT_HistMean(s_au32Hist, HIST_1024_NUM));
+    TEST_BENCH("R/G B/G ratio",
+        REF_Ratio(),
+        ZONE_STAT_CalcRatio(s_au16R, s_au16G, s_au16B, TEST_AWB_ZONE_NUM, s_au16Rg, s_au16Bg));
+    TEST_BENCH("grey filter",
+        u32Sink += REF_Grey(&stCfg, &stSum),
+        u32Sink += ZONE_STAT_GreyFilter(s_au16R, s_au16G, s_au16B, s_au16Rg, s_au16Bg, TEST_AWB_ZONE_NUM,
+            &stCfg, s_au8Mask, &stSum));
+}
+
+int main(int argc, char *argv[])
+{
+    srand(1);
+
+    TEST_Kernels();
+    printf("%u random AE/AWB statistics sets checked, %d failures\n", TEST_ITER, s_s32Fail);
+
+    TEST_Benchmark();
+
+    printf("%s\n", (0 == s_s32Fail) ? "PASS" : "FAIL");
+    return (0 == s_s32Fail) ? 0 : 1;
+}
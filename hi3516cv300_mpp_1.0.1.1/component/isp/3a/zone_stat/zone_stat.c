@@ -0,0 +1,258 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2011, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : zone_stat.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/14
+  Description   : zone statistics helpers, scalar backend and dispatch
+  History       :
+  1.Date        : 2016/03/14
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#include "zone_stat.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+/****************************************************************************
+ * SCALAR BACKEND                                                           *
+ ****************************************************************************/
+
+HI_U16 ZONE_STAT_WeightedAvgC(const HI_U16 *pu16Zone, HI_U32 u32Stride,
+    const HI_U8 *pu8Weight, HI_U32 u32Num)
+{
+    HI_U32 i;
+    HI_U64 u64Sum = 0;
+    HI_U32 u32WeightSum = 0;
+
+    for (i = 0; i < u32Num; i++)
+    {
+        u64Sum       += (HI_U32)pu16Zone[i * u32Stride] * pu8Weight[i];
+        u32WeightSum += pu8Weight[i];
+    }
+
+    if (0 == u32WeightSum)
+    {
+        return 0;
+    }
+
+    return (HI_U16)((u64Sum + (u32WeightSum >> 1)) / u32WeightSum);
+}
+
+HI_U32 ZONE_STAT_HistCumSumC(const HI_U32 *pu32Hist, HI_U32 u32Bins, HI_U32 *pu32Cum)
+{
+    HI_U32 i;
+    HI_U32 u32Sum = 0;
+
+    for (i = 0; i < u32Bins; i++)
+    {
+        u32Sum    += pu32Hist[i];
+        pu32Cum[i] = u32Sum;
+    }
+
+    return u32Sum;
+}
+
+HI_U32 ZONE_STAT_HistMeanC(const HI_U32 *pu32Hist, HI_U32 u32Bins)
+{
+    HI_U32 i;
+    HI_U64 u64Sum = 0, u64Total = 0;
+
+    for (i = 0; i < u32Bins; i++)
+    {
+        u64Sum   += (HI_U64)pu32Hist[i] * i;
+        u64Total += pu32Hist[i];
+    }
+
+    if (0 == u64Total)
+    {
+        return 0;
+    }
+
+    return (HI_U32)(((u64Sum << 8) + (u64Total >> 1)) / u64Total);
+}
+
+static __inline HI_U16 ZoneStatRatio(HI_U16 u16Num, HI_U16 u16Den)
+{
+    HI_U32 u32Ratio;
+
+    if (0 == u16Den)
+    {
+        return ZONE_STAT_RATIO_MAX;
+    }
+
+    u32Ratio = ((HI_U32)u16Num << ZONE_STAT_RATIO_SHIFT) / u16Den;
+
+    return (u32Ratio > ZONE_STAT_RATIO_MAX) ? ZONE_STAT_RATIO_MAX : (HI_U16)u32Ratio;
+}
+
+HI_VOID ZONE_STAT_CalcRatioC(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    HI_U32 u32Num, HI_U16 *pu16Rg, HI_U16 *pu16Bg)
+{
+    HI_U32 i;
+
+    for (i = 0; i < u32Num; i++)
+    {
+        pu16Rg[i] = ZoneStatRatio(pu16R[i], pu16G[i]);
+        pu16Bg[i] = ZoneStatRatio(pu16B[i], pu16G[i]);
+    }
+}
+
+HI_U32 ZONE_STAT_GreyFilterC(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    const HI_U16 *pu16Rg, const HI_U16 *pu16Bg, HI_U32 u32Num,
+    const ZONE_STAT_GREY_CFG_S *pstCfg, HI_U8 *pu8Mask, ZONE_STAT_GREY_SUM_S *pstSum)
+{
+    HI_U32 i;
+    HI_BOOL bGrey;
+    ZONE_STAT_GREY_SUM_S stSum = {0};
+
+    for (i = 0; i < u32Num; i++)
+    {
+        bGrey = (pu16G[i] >= pstCfg->u16BlackLevel) && (pu16G[i] <= pstCfg->u16WhiteLevel)
+             && (pu16Rg[i] >= pstCfg->u16RgMin) && (pu16Rg[i] <= pstCfg->u16RgMax)
+             && (pu16Bg[i] >= pstCfg->u16BgMin) && (pu16Bg[i] <= pstCfg->u16BgMax);
+
+        if (HI_NULL != pu8Mask)
+        {
+            pu8Mask[i] = bGrey ? 1 : 0;
+        }
+
+        if (bGrey)
+        {
+            stSum.u32Count++;
+            stSum.u32SumR += pu16R[i];
+            stSum.u32SumG += pu16G[i];
+            stSum.u32SumB += pu16B[i];
+        }
+    }
+
+    if (HI_NULL != pstSum)
+    {
+        *pstSum = stSum;
+    }
+
+    return stSum.u32Count;
+}
+
+HI_VOID ZONE_STAT_ClipC(HI_U16 *pu16Data, HI_U32 u32Num, HI_U16 u16Min, HI_U16 u16Max)
+{
+    HI_U32 i;
+
+    for (i = 0; i < u32Num; i++)
+    {
+        if (pu16Data[i] < u16Min)
+        {
+            pu16Data[i] = u16Min;
+        }
+        if (pu16Data[i] > u16Max)
+        {
+            pu16Data[i] = u16Max;
+        }
+    }
+}
+
+/****************************************************************************
+ * API                                                                      *
+ ****************************************************************************/
+
+HI_U16 ZONE_STAT_WeightedAvg(const HI_U16 *pu16Zone, HI_U32 u32Stride,
+    const HI_U8 *pu8Weight, HI_U32 u32Num)
+{
+#ifdef ZONE_STAT_NEON
+    return ZONE_STAT_WeightedAvgNeon(pu16Zone, u32Stride, pu8Weight, u32Num);
+#else
+    return ZONE_STAT_WeightedAvgC(pu16Zone, u32Stride, pu8Weight, u32Num);
+#endif
+}
+
+HI_U32 ZONE_STAT_HistCumSum(const HI_U32 *pu32Hist, HI_U32 u32Bins, HI_U32 *pu32Cum)
+{
+#ifdef ZONE_STAT_NEON
+    return ZONE_STAT_HistCumSumNeon(pu32Hist, u32Bins, pu32Cum);
+#else
+    return ZONE_STAT_HistCumSumC(pu32Hist, u32Bins, pu32Cum);
+#endif
+}
+
+HI_U32 ZONE_STAT_HistPercentile(const HI_U32 *pu32Cum, HI_U32 u32Bins, HI_U32 u32Permille)
+{
+    HI_U32 u32Low = 0, u32High, u32Mid;
+    HI_U32 u32Target;
+
+    if (0 == u32Bins)
+    {
+        return 0;
+    }
+
+    u32Target = (HI_U32)(((HI_U64)pu32Cum[u32Bins - 1] * u32Permille + 999) / 1000);
+
+    /* the cumulative histogram is sorted, binary search the first bin >= target */
+    u32High = u32Bins - 1;
+    while (u32Low < u32High)
+    {
+        u32Mid = (u32Low + u32High) >> 1;
+        if (pu32Cum[u32Mid] >= u32Target)
+        {
+            u32High = u32Mid;
+        }
+        else
+        {
+            u32Low = u32Mid + 1;
+        }
+    }
+
+    return u32Low;
+}
+
+HI_U32 ZONE_STAT_HistMean(const HI_U32 *pu32Hist, HI_U32 u32Bins)
+{
+#ifdef ZONE_STAT_NEON
+    return ZONE_STAT_HistMeanNeon(pu32Hist, u32Bins);
+#else
+    return ZONE_STAT_HistMeanC(pu32Hist, u32Bins);
+#endif
+}
+
+HI_VOID ZONE_STAT_CalcRatio(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    HI_U32 u32Num, HI_U16 *pu16Rg, HI_U16 *pu16Bg)
+{
+#ifdef ZONE_STAT_NEON
+    ZONE_STAT_CalcRatioNeon(pu16R, pu16G, pu16B, u32Num, pu16Rg, pu16Bg);
+#else
+    ZONE_STAT_CalcRatioC(pu16R, pu16G, pu16B, u32Num, pu16Rg, pu16Bg);
+#endif
+}
+
+HI_U32 ZONE_STAT_GreyFilter(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    const HI_U16 *pu16Rg, const HI_U16 *pu16Bg, HI_U32 u32Num,
+    const ZONE_STAT_GREY_CFG_S *pstCfg, HI_U8 *pu8Mask, ZONE_STAT_GREY_SUM_S *pstSum)
+{
+#ifdef ZONE_STAT_NEON
+    return ZONE_STAT_GreyFilterNeon(pu16R, pu16G, pu16B, pu16Rg, pu16Bg, u32Num, pstCfg, pu8Mask, pstSum);
+#else
+    return ZONE_STAT_GreyFilterC(pu16R, pu16G, pu16B, pu16Rg, pu16Bg, u32Num, pstCfg, pu8Mask, pstSum);
+#endif
+}
+
+HI_VOID ZONE_STAT_Clip(HI_U16 *pu16Data, HI_U32 u32Num, HI_U16 u16Min, HI_U16 u16Max)
+{
+#ifdef ZONE_STAT_NEON
+    ZONE_STAT_ClipNeon(pu16Data, u32Num, u16Min, u16Max);
+#else
+    ZONE_STAT_ClipC(pu16Data, u32Num, u16Min, u16Max);
+#endif
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,130 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2011, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : zone_stat.h
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/14
+  Description   : zone statistics helpers for user 3A libraries
+  History       :
+  1.Date        : 2016/03/14
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#ifndef __ZONE_STAT_H__
+#define __ZONE_STAT_H__
+
+#include "hi_type.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+/* The NEON backend is used when the toolchain targets NEON (-mfpu=neon*),
+ * otherwise the scalar backend. Both backends give identical results; the
+ * ...C and ...Neon entries are exported so that they can be compared.
+ */
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define ZONE_STAT_NEON
+#endif
+
+#define ZONE_STAT_RATIO_SHIFT   (8)         /* R/G and B/G are 4.8-bit fix-point */
+#define ZONE_STAT_RATIO_MAX     (0xFFF)
+
+typedef struct hiZONE_STAT_GREY_CFG_S
+{
+    HI_U16  u16WhiteLevel;      /* zones with G above are not grey candidates */
+    HI_U16  u16BlackLevel;      /* zones with G below are not grey candidates */
+    HI_U16  u16RgMin;           /* R/G box of grey zones, 4.8-bit fix-point */
+    HI_U16  u16RgMax;
+    HI_U16  u16BgMin;           /* B/G box of grey zones, 4.8-bit fix-point */
+    HI_U16  u16BgMax;
+} ZONE_STAT_GREY_CFG_S;
+
+typedef struct hiZONE_STAT_GREY_SUM_S
+{
+    HI_U32  u32Count;           /* number of grey zones */
+    HI_U32  u32SumR;            /* grey-world sums over the grey zones */
+    HI_U32  u32SumG;
+    HI_U32  u32SumB;
+} ZONE_STAT_GREY_SUM_S;
+
+/*
+ * Weighted average of u32Num zone values, rounded to nearest. The zone values
+ * are read every u32Stride elements, so the AE zone average of one bayer
+ * channel is &au16ZoneAvg[0][0][chn] with stride ISP_BAYER_CHN_NUM and the
+ * weights &au8WeightTable[0][0]. Returns 0 when all weights are 0.
+ */
+HI_U16 ZONE_STAT_WeightedAvg(const HI_U16 *pu16Zone, HI_U32 u32Stride,
+    const HI_U8 *pu8Weight, HI_U32 u32Num);
+
+/*
+ * Cumulative histogram: pu32Cum[i] = pu32Hist[0] + ... + pu32Hist[i].
+ * Returns the total count, which must fit in 32 bits (pixel counts do).
+ */
+HI_U32 ZONE_STAT_HistCumSum(const HI_U32 *pu32Hist, HI_U32 u32Bins, HI_U32 *pu32Cum);
+
+/* First bin whose cumulative count reaches u32Permille/1000 of the total. */
+HI_U32 ZONE_STAT_HistPercentile(const HI_U32 *pu32Cum, HI_U32 u32Bins, HI_U32 u32Permille);
+
+/* Mean bin index of the histogram, 8-bit fraction. Returns 0 when empty. */
+HI_U32 ZONE_STAT_HistMean(const HI_U32 *pu32Hist, HI_U32 u32Bins);
+
+/*
+ * Per-zone R/G and B/G in 4.8-bit fix-point, truncated and clipped to
+ * ZONE_STAT_RATIO_MAX; zones with G == 0 get ZONE_STAT_RATIO_MAX.
+ */
+HI_VOID ZONE_STAT_CalcRatio(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    HI_U32 u32Num, HI_U16 *pu16Rg, HI_U16 *pu16Bg);
+
+/*
+ * Grey-zone filtering: a zone is grey when its G is within the black and
+ * white levels and its R/G, B/G are within the box (bounds inclusive).
+ * pu8Mask (may be HI_NULL) receives 1 for grey zones and 0 otherwise, pstSum
+ * the grey-world sums. u32Num must not exceed 65536. Returns the grey count.
+ */
+HI_U32 ZONE_STAT_GreyFilter(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    const HI_U16 *pu16Rg, const HI_U16 *pu16Bg, HI_U32 u32Num,
+    const ZONE_STAT_GREY_CFG_S *pstCfg, HI_U8 *pu8Mask, ZONE_STAT_GREY_SUM_S *pstSum);
+
+/* Clip u32Num values to [u16Min, u16Max] in place, u16Min <= u16Max. */
+HI_VOID ZONE_STAT_Clip(HI_U16 *pu16Data, HI_U32 u32Num, HI_U16 u16Min, HI_U16 u16Max);
+
+/* scalar backend */
+HI_U16 ZONE_STAT_WeightedAvgC(const HI_U16 *pu16Zone, HI_U32 u32Stride,
+    const HI_U8 *pu8Weight, HI_U32 u32Num);
+HI_U32 ZONE_STAT_HistCumSumC(const HI_U32 *pu32Hist, HI_U32 u32Bins, HI_U32 *pu32Cum);
+HI_U32 ZONE_STAT_HistMeanC(const HI_U32 *pu32Hist, HI_U32 u32Bins);
+HI_VOID ZONE_STAT_CalcRatioC(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    HI_U32 u32Num, HI_U16 *pu16Rg, HI_U16 *pu16Bg);
+HI_U32 ZONE_STAT_GreyFilterC(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    const HI_U16 *pu16Rg, const HI_U16 *pu16Bg, HI_U32 u32Num,
+    const ZONE_STAT_GREY_CFG_S *pstCfg, HI_U8 *pu8Mask, ZONE_STAT_GREY_SUM_S *pstSum);
+HI_VOID ZONE_STAT_ClipC(HI_U16 *pu16Data, HI_U32 u32Num, HI_U16 u16Min, HI_U16 u16Max);
+
+#ifdef ZONE_STAT_NEON
+/* NEON backend */
+HI_U16 ZONE_STAT_WeightedAvgNeon(const HI_U16 *pu16Zone, HI_U32 u32Stride,
+    const HI_U8 *pu8Weight, HI_U32 u32Num);
+HI_U32 ZONE_STAT_HistCumSumNeon(const HI_U32 *pu32Hist, HI_U32 u32Bins, HI_U32 *pu32Cum);
+HI_U32 ZONE_STAT_HistMeanNeon(const HI_U32 *pu32Hist, HI_U32 u32Bins);
+HI_VOID ZONE_STAT_CalcRatioNeon(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    HI_U32 u32Num, HI_U16 *pu16Rg, HI_U16 *pu16Bg);
+HI_U32 ZONE_STAT_GreyFilterNeon(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    const HI_U16 *pu16Rg, const HI_U16 *pu16Bg, HI_U32 u32Num,
+    const ZONE_STAT_GREY_CFG_S *pstCfg, HI_U8 *pu8Mask, ZONE_STAT_GREY_SUM_S *pstSum);
+HI_VOID ZONE_STAT_ClipNeon(HI_U16 *pu16Data, HI_U32 u32Num, HI_U16 u16Min, HI_U16 u16Max);
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#endif /* __ZONE_STAT_H__ */
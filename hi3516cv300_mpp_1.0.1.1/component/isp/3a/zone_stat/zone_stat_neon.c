@@ -0,0 +1,294 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2011, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : zone_stat_neon.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/14
+  Description   : zone statistics helpers, NEON backend
+  History       :
+  1.Date        : 2016/03/14
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#include "zone_stat.h"
+
+#ifdef ZONE_STAT_NEON
+
+#include <arm_neon.h>
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+HI_U16 ZONE_STAT_WeightedAvgNeon(const HI_U16 *pu16Zone, HI_U32 u32Stride,
+    const HI_U8 *pu8Weight, HI_U32 u32Num)
+{
+    HI_U32 i = 0;
+    HI_U64 u64Sum;
+    HI_U32 u32WeightSum;
+    uint64x2_t vSum  = vdupq_n_u64(0);
+    uint32x4_t vWSum = vdupq_n_u32(0);
+    uint32x4_t vProd;
+    uint16x8_t vZone, vWeight;
+
+    if ((1 != u32Stride) && (4 != u32Stride))
+    {
+        return ZONE_STAT_WeightedAvgC(pu16Zone, u32Stride, pu8Weight, u32Num);
+    }
+
+    /* with stride 4 the 32-element load must stay inside the last zone */
+    for ( ; (1 == u32Stride) ? (i + 8 <= u32Num) : (i + 8 < u32Num); i += 8)
+    {
+        if (1 == u32Stride)
+        {
+            vZone = vld1q_u16(pu16Zone + i);
+        }
+        else
+        {
+            vZone = vld4q_u16(pu16Zone + 4 * i).val[0];
+        }
+        vWeight = vmovl_u8(vld1_u8(pu8Weight + i));
+
+        vProd = vmull_u16(vget_low_u16(vZone), vget_low_u16(vWeight));
+        vSum  = vpadalq_u32(vSum, vProd);
+        vProd = vmull_u16(vget_high_u16(vZone), vget_high_u16(vWeight));
+        vSum  = vpadalq_u32(vSum, vProd);
+        vWSum = vpadalq_u16(vWSum, vWeight);
+    }
+
+    u64Sum       = vgetq_lane_u64(vSum, 0) + vgetq_lane_u64(vSum, 1);
+    u32WeightSum = vgetq_lane_u32(vWSum, 0) + vgetq_lane_u32(vWSum, 1)
+                 + vgetq_lane_u32(vWSum, 2) + vgetq_lane_u32(vWSum, 3);
+
+    for ( ; i < u32Num; i++)
+    {
+        u64Sum       += (HI_U32)pu16Zone[i * u32Stride] * pu8Weight[i];
+        u32WeightSum += pu8Weight[i];
+    }
+
+    if (0 == u32WeightSum)
+    {
+        return 0;
+    }
+
+    return (HI_U16)((u64Sum + (u32WeightSum >> 1)) / u32WeightSum);
+}
+
+HI_U32 ZONE_STAT_HistCumSumNeon(const HI_U32 *pu32Hist, HI_U32 u32Bins, HI_U32 *pu32Cum)
+{
+    HI_U32 i = 0;
+    HI_U32 u32Sum;
+    uint32x4_t vZero  = vdupq_n_u32(0);
+    uint32x4_t vCarry = vZero;
+    uint32x4_t vHist;
+
+    /* in-register prefix sum of four bins, plus the carry of the bins before */
+    for ( ; i + 4 <= u32Bins; i += 4)
+    {
+        vHist  = vld1q_u32(pu32Hist + i);
+        vHist  = vaddq_u32(vHist, vextq_u32(vZero, vHist, 3));
+        vHist  = vaddq_u32(vHist, vextq_u32(vZero, vHist, 2));
+        vHist  = vaddq_u32(vHist, vCarry);
+        vst1q_u32(pu32Cum + i, vHist);
+        vCarry = vdupq_n_u32(vgetq_lane_u32(vHist, 3));
+    }
+
+    u32Sum = vgetq_lane_u32(vCarry, 0);
+    for ( ; i < u32Bins; i++)
+    {
+        u32Sum     += pu32Hist[i];
+        pu32Cum[i]  = u32Sum;
+    }
+
+    return u32Sum;
+}
+
+HI_U32 ZONE_STAT_HistMeanNeon(const HI_U32 *pu32Hist, HI_U32 u32Bins)
+{
+    static const HI_U32 au32Index[4] = {0, 1, 2, 3};
+    HI_U32 i = 0;
+    HI_U64 u64Sum, u64Total;
+    uint64x2_t vSum   = vdupq_n_u64(0);
+    uint64x2_t vTotal = vdupq_n_u64(0);
+    uint32x4_t vIndex = vld1q_u32(au32Index);
+    uint32x4_t vStep  = vdupq_n_u32(4);
+    uint32x4_t vHist;
+
+    for ( ; i + 4 <= u32Bins; i += 4)
+    {
+        vHist  = vld1q_u32(pu32Hist + i);
+        vSum   = vmlal_u32(vSum, vget_low_u32(vHist), vget_low_u32(vIndex));
+        vSum   = vmlal_u32(vSum, vget_high_u32(vHist), vget_high_u32(vIndex));
+        vTotal = vpadalq_u32(vTotal, vHist);
+        vIndex = vaddq_u32(vIndex, vStep);
+    }
+
+    u64Sum   = vgetq_lane_u64(vSum, 0) + vgetq_lane_u64(vSum, 1);
+    u64Total = vgetq_lane_u64(vTotal, 0) + vgetq_lane_u64(vTotal, 1);
+
+    for ( ; i < u32Bins; i++)
+    {
+        u64Sum   += (HI_U64)pu32Hist[i] * i;
+        u64Total += pu32Hist[i];
+    }
+
+    if (0 == u64Total)
+    {
+        return 0;
+    }
+
+    return (HI_U32)(((u64Sum << 8) + (u64Total >> 1)) / u64Total);
+}
+
+/* (vNum << 8) / vDen, clipped, computed with a float reciprocal estimate */
+static __inline uint16x4_t ZoneStatRatioNeon(uint16x4_t vNum16, uint16x4_t vDen16)
+{
+    uint32x4_t vNum = vshll_n_u16(vNum16, ZONE_STAT_RATIO_SHIFT);
+    uint32x4_t vDen = vmovl_u16(vDen16);
+    uint32x4_t vMax = vdupq_n_u32(ZONE_STAT_RATIO_MAX);
+    uint32x4_t vOne = vdupq_n_u32(1);
+    float32x4_t vDenF = vcvtq_f32_u32(vDen);
+    float32x4_t vRecip;
+    uint32x4_t vQuot, vFix;
+
+    vRecip = vrecpeq_f32(vDenF);
+    vRecip = vmulq_f32(vRecip, vrecpsq_f32(vDenF, vRecip));
+    vRecip = vmulq_f32(vRecip, vrecpsq_f32(vDenF, vRecip));
+    vQuot  = vcvtq_u32_f32(vmulq_f32(vcvtq_f32_u32(vNum), vRecip));
+
+    /* bound the estimate so the products below stay in 32 bits, then make */
+    /* it exact: the estimate is off by at most one from the true quotient  */
+    vQuot = vminq_u32(vQuot, vaddq_u32(vMax, vOne));
+    vFix  = vcgtq_u32(vmulq_u32(vQuot, vDen), vNum);
+    vQuot = vaddq_u32(vQuot, vFix);
+    vFix  = vcleq_u32(vmulq_u32(vaddq_u32(vQuot, vOne), vDen), vNum);
+    vQuot = vsubq_u32(vQuot, vFix);
+    vQuot = vminq_u32(vQuot, vMax);
+
+    vQuot = vbslq_u32(vceqq_u32(vDen, vdupq_n_u32(0)), vMax, vQuot);
+
+    return vmovn_u32(vQuot);
+}
+
+HI_VOID ZONE_STAT_CalcRatioNeon(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    HI_U32 u32Num, HI_U16 *pu16Rg, HI_U16 *pu16Bg)
+{
+    HI_U32 i = 0;
+    uint16x4_t vR, vG, vB;
+
+    for ( ; i + 4 <= u32Num; i += 4)
+    {
+        vR = vld1_u16(pu16R + i);
+        vG = vld1_u16(pu16G + i);
+        vB = vld1_u16(pu16B + i);
+        vst1_u16(pu16Rg + i, ZoneStatRatioNeon(vR, vG));
+        vst1_u16(pu16Bg + i, ZoneStatRatioNeon(vB, vG));
+    }
+
+    if (i < u32Num)
+    {
+        ZONE_STAT_CalcRatioC(pu16R + i, pu16G + i, pu16B + i, u32Num - i, pu16Rg + i, pu16Bg + i);
+    }
+}
+
+HI_U32 ZONE_STAT_GreyFilterNeon(const HI_U16 *pu16R, const HI_U16 *pu16G, const HI_U16 *pu16B,
+    const HI_U16 *pu16Rg, const HI_U16 *pu16Bg, HI_U32 u32Num,
+    const ZONE_STAT_GREY_CFG_S *pstCfg, HI_U8 *pu8Mask, ZONE_STAT_GREY_SUM_S *pstSum)
+{
+    HI_U32 i = 0;
+    ZONE_STAT_GREY_SUM_S stSum, stTail;
+    uint16x8_t vBlack = vdupq_n_u16(pstCfg->u16BlackLevel);
+    uint16x8_t vWhite = vdupq_n_u16(pstCfg->u16WhiteLevel);
+    uint16x8_t vRgMin = vdupq_n_u16(pstCfg->u16RgMin);
+    uint16x8_t vRgMax = vdupq_n_u16(pstCfg->u16RgMax);
+    uint16x8_t vBgMin = vdupq_n_u16(pstCfg->u16BgMin);
+    uint16x8_t vBgMax = vdupq_n_u16(pstCfg->u16BgMax);
+    uint16x8_t vCount = vdupq_n_u16(0);
+    uint32x4_t vSumR  = vdupq_n_u32(0);
+    uint32x4_t vSumG  = vdupq_n_u32(0);
+    uint32x4_t vSumB  = vdupq_n_u32(0);
+    uint16x8_t vG, vRg, vBg, vGrey;
+
+    for ( ; i + 8 <= u32Num; i += 8)
+    {
+        vG  = vld1q_u16(pu16G + i);
+        vRg = vld1q_u16(pu16Rg + i);
+        vBg = vld1q_u16(pu16Bg + i);
+
+        vGrey = vandq_u16(vcgeq_u16(vG, vBlack), vcleq_u16(vG, vWhite));
+        vGrey = vandq_u16(vGrey, vandq_u16(vcgeq_u16(vRg, vRgMin), vcleq_u16(vRg, vRgMax)));
+        vGrey = vandq_u16(vGrey, vandq_u16(vcgeq_u16(vBg, vBgMin), vcleq_u16(vBg, vBgMax)));
+
+        if (HI_NULL != pu8Mask)
+        {
+            vst1_u8(pu8Mask + i, vand_u8(vmovn_u16(vGrey), vdup_n_u8(1)));
+        }
+
+        /* the mask is all ones (-1) in grey lanes */
+        vCount = vsubq_u16(vCount, vGrey);
+        vSumR  = vpadalq_u16(vSumR, vandq_u16(vld1q_u16(pu16R + i), vGrey));
+        vSumG  = vpadalq_u16(vSumG, vandq_u16(vG, vGrey));
+        vSumB  = vpadalq_u16(vSumB, vandq_u16(vld1q_u16(pu16B + i), vGrey));
+    }
+
+    {
+        uint32x4_t vCount32 = vpaddlq_u16(vCount);
+
+        stSum.u32Count = vgetq_lane_u32(vCount32, 0) + vgetq_lane_u32(vCount32, 1)
+                       + vgetq_lane_u32(vCount32, 2) + vgetq_lane_u32(vCount32, 3);
+        stSum.u32SumR  = vgetq_lane_u32(vSumR, 0) + vgetq_lane_u32(vSumR, 1)
+                       + vgetq_lane_u32(vSumR, 2) + vgetq_lane_u32(vSumR, 3);
+        stSum.u32SumG  = vgetq_lane_u32(vSumG, 0) + vgetq_lane_u32(vSumG, 1)
+                       + vgetq_lane_u32(vSumG, 2) + vgetq_lane_u32(vSumG, 3);
+        stSum.u32SumB  = vgetq_lane_u32(vSumB, 0) + vgetq_lane_u32(vSumB, 1)
+                       + vgetq_lane_u32(vSumB, 2) + vgetq_lane_u32(vSumB, 3);
+    }
+
+    if (i < u32Num)
+    {
+        ZONE_STAT_GreyFilterC(pu16R + i, pu16G + i, pu16B + i, pu16Rg + i, pu16Bg + i, u32Num - i,
+            pstCfg, (HI_NULL != pu8Mask) ? (pu8Mask + i) : HI_NULL, &stTail);
+        stSum.u32Count += stTail.u32Count;
+        stSum.u32SumR  += stTail.u32SumR;
+        stSum.u32SumG  += stTail.u32SumG;
+        stSum.u32SumB  += stTail.u32SumB;
+    }
+
+    if (HI_NULL != pstSum)
+    {
+        *pstSum = stSum;
+    }
+
+    return stSum.u32Count;
+}
+
+HI_VOID ZONE_STAT_ClipNeon(HI_U16 *pu16Data, HI_U32 u32Num, HI_U16 u16Min, HI_U16 u16Max)
+{
+    HI_U32 i = 0;
+    uint16x8_t vMin = vdupq_n_u16(u16Min);
+    uint16x8_t vMax = vdupq_n_u16(u16Max);
+
+    for ( ; i + 8 <= u32Num; i += 8)
+    {
+        vst1q_u16(pu16Data + i, vminq_u16(vmaxq_u16(vld1q_u16(pu16Data + i), vMin), vMax));
+    }
+
+    if (i < u32Num)
+    {
+        ZONE_STAT_ClipC(pu16Data + i, u32Num - i, u16Min, u16Max);
+    }
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#endif /* ZONE_STAT_NEON */
@@ -20,6 +20,7 @@
 #include "isp_config.h"
 #include "isp_proc.h"
 #include "isp_ext_config.h"
+#include "isp_flicker_wave.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -345,237 +346,34 @@ static HI_VOID FlickerDetectResult(ISP_DEV IspDev)
 
 static HI_VOID FlickerDetect(ISP_DEV IspDev)
 {
-	HI_U16 u16Inx;
-	HI_U32 i, j;
-	HI_S32 s32Cnt, s32Grindx, s32Gbindx, s32Tmp1, s32Tmp2;
-	HI_S32 *pS32GrCros0, *pS32GbCros0, *pS32GrCnt, *pS32GbCnt;	
-	HI_S32 s32GrDiff3cnt, s32GbDiff3cnt, s32GrAvgcnt, s32GbAvgcnt;
-	HI_S32 s32GrAvg, s32GbAvg, s32GrPat, s32GbPat, s32GrflickerThd, s32GbflickerThd;
-
+	ISP_FLICKER_WAVE_PARAM_S stParam;
+	ISP_FLICKER_WAVE_BUF_S stBuf;
+	ISP_FLICKER_WAVE_RESULT_S stResult;
 	ISP_FLICKER_EXTERN_REG_S *pstExtReg = HI_NULL;
 	ISP_FLICKER_ATTR *pstFlickerCtx = HI_NULL;  
 	
     	FLICKER_GET_CTX(IspDev, pstFlickerCtx);	
 	pstExtReg = &pstFlickerCtx->stFckExtReg;
-		
-	u16Inx = pstFlickerCtx->u16FckInx;
-		
-	pS32GrCros0 = pstFlickerCtx->stFckPoint.ps32GrCros0;
-	pS32GbCros0 = pstFlickerCtx->stFckPoint.ps32GbCros0;
-
-	pS32GrCnt   = pstFlickerCtx->stFckPoint.ps32GrCnt;
-	pS32GbCnt   = pstFlickerCtx->stFckPoint.ps32GbCnt;
-
-	/* previous frame-based mean is the zero-value axis.                */
-	/* if group mean value is above this zero-value, it is marked as 1; */
-	/* otherwise, it is marked as 0.                                    */
-	for (i = 0; i < u16Inx; i++) 
-	{
-		if(pstFlickerCtx->stFckStatInfo.ps32GrMean[i] >= pstFlickerCtx->s32PreFrameAvgGr)
-		{
-			*(pS32GrCros0 + i) = 1;
-		}
-		else
-		{
-		       *(pS32GrCros0 + i) = 0;
-		}
-
-		if(pstFlickerCtx->stFckStatInfo.ps32GbMean[i] >= pstFlickerCtx->s32PreFrameAvgGb)
-		{
-			*(pS32GbCros0 + i) = 1;
-		}
-		else
-		{
-		       *(pS32GbCros0 + i) = 0;
-		}
-	}
 
-	/* pGr_cnt, pGb_cnt: the width of each wave                              */
-	/* pGr_avg, pGb_avg: the average width of wave                           */
-	/* Gr_pat, Gb_pat: the total number of valid wave                        */
-	/* Gr/Gbflicker_thd: min. number of valid wave to indicate flickering    */
-	/* Comparing the wave's avg. width with each wave's width,               */
-	/* if the difference is less than 2, this wave is valid flicker wave.    */
-	/* We allow one time of difference being 3 (from the video we have had.) */
-	s32Cnt    = 1;			
-	s32Grindx  = 0;
-	j      = 1;
-	for(i = 0; i < u16Inx; ) 
-	{
-		s32Tmp1 = *(pS32GrCros0 + i);
-		for ( ; j < u16Inx; )	
-		{
-			s32Tmp2 = *(pS32GrCros0 + j);
-			if (s32Tmp1 == s32Tmp2) 
-			{				
-				s32Cnt++;  
-				j++;
-			}
-			else
-			{
-				break;
-			}
-		}
-		
-		if (i == u16Inx - 1)
-		{				
-			*(pS32GrCnt + s32Grindx) = s32Cnt;
-			break;
-		}
-		else if (j == u16Inx)	
-		{
-			*(pS32GrCnt + s32Grindx) = s32Cnt;
-			i = u16Inx;
-		}
-		else 
-		{
-			*(pS32GrCnt + s32Grindx) = s32Cnt;
-			s32Cnt = 1;				
-			i   = j;
-			j++;				
-			s32Grindx++;
-		}			
-	}
-	s32Cnt     = 1;			
-	s32Gbindx  = 0;
-	j       = 1;
-	for(i = 0; i < u16Inx; ) 
-	{
-		s32Tmp1 = *(pS32GbCros0 + i);
-		for ( ; j < u16Inx; )	
-		{
-			s32Tmp2 = *(pS32GbCros0 + j);
-			if (s32Tmp1 == s32Tmp2) 
-			{					
-				s32Cnt++;  
-				j++;
-			}
-			else
-			{
-				break;
-			}
-		}
-		if (i == u16Inx - 1)
-		{				
-			*(pS32GbCnt + s32Gbindx) = s32Cnt;
-			break;
-		}
-		else if (j == u16Inx)	
-		{				
-			*(pS32GbCnt + s32Gbindx) = s32Cnt;
-			i = u16Inx;
-		}
-		else 
-		{
-			*(pS32GbCnt + s32Gbindx) = s32Cnt;
-			s32Cnt = 1;			
-			i   = j;
-			j++;
-			s32Gbindx++;
-		}			
-	}	
-	/**********Gr avg************/
-	//remove first and last wave
-	s32GrDiff3cnt = s32GbDiff3cnt = 0;
-	s32GrAvgcnt   = s32GbAvgcnt   = 0;
-	if (s32Grindx  > pstExtReg->u8MinBandNum && s32Gbindx > pstExtReg->u8MinBandNum)	
-	{
-		s32GrAvg = 0;
-		for (i = 1; i < s32Grindx ; i++)
-		{
-			if ( *(pS32GrCnt + i) > 2 ) 
-			{
-				s32GrAvg += *(pS32GrCnt + i);
-				s32GrAvgcnt++;
-			}
-		}
-		if (s32GrAvgcnt)
-		{
-			s32GrAvg = ( s32GrAvg + (s32GrAvgcnt >> 1) ) / s32GrAvgcnt;
-		}
-		else
-		{
-			s32GrAvg = -1;
-		}				
-		/********* Gb avg *******************/
-		s32GbAvg = 0;
-		//for (i = 0; i < s32Gbindx + 1; i++)
-		for (i = 1; i < s32Gbindx; i++)
-		{
-			if ( *(pS32GbCnt + i) > 2 )
-			{
-				s32GbAvg += *(pS32GbCnt + i);
-				s32GbAvgcnt++;
-			}
-		}
-		if (s32GbAvgcnt)
-		{
-			s32GbAvg = ( s32GbAvg + (s32GbAvgcnt >> 1) ) / s32GbAvgcnt;
-		}
-		else
-		{
-			s32GbAvg = -1;
-		}
-		/**************end ****************/					
-		s32GrPat = 0;
-		for (i = 1; i < s32Grindx  ; i++) 
-		{
-			if ( abs(s32GrAvg - *(pS32GrCnt + i)) <= pstExtReg->u8WaveDiff1)
-			{
-				s32GrPat++;
-			}
-			else if ( abs(s32GrAvg - *(pS32GrCnt + i)) == pstExtReg->u8WaveDiff2)
-			{
-				s32GrDiff3cnt++;
-			}
-		}
-
-		s32GbPat = 0;
-		for (i = 1; i < s32Gbindx ; i++)
-		{
-			if (abs(s32GbAvg - *(pS32GbCnt + i)) <= pstExtReg->u8WaveDiff1)
-			{
-				s32GbPat++;
-			}
-			else if (abs(s32GbAvg - *(pS32GbCnt + i)) == pstExtReg->u8WaveDiff2)	
-			{
-				s32GbDiff3cnt++;
-			}
-		}
-		if (s32GrDiff3cnt == 1)
-		{
-			s32GrPat++;
-		}
-
-		if (s32GbDiff3cnt == 1)
-		{
-			s32GbPat++;
-		}
-
-		if (s32GrAvg == -1 || s32GbAvg == -1)
-		{
-			s32GrPat = -1;  
-			s32GbPat = -1;
-		}
-	}
-	else
-	{
-		s32GrPat = -1;  
-		s32GbPat = -1;
-	}
-	s32GrflickerThd = ((s32Grindx * pstExtReg->u8MinValidBandPcnt) + 5) / 10;
-	s32GbflickerThd = ((s32Gbindx * pstExtReg->u8MinValidBandPcnt) + 5) / 10;
-	// result
-	if( s32GrPat >= s32GrflickerThd && s32GbPat >= s32GbflickerThd )	
-	{
-		pstFlickerCtx->s32CurFlicker = 1;
-	}
-	else		
-	{
-		pstFlickerCtx->s32CurFlicker = 0;
-	}
-	pstExtReg->s32GbAvgcnt	=	s32GbAvgcnt;
-	pstExtReg->s32GrAvgcnt	=	s32GrAvgcnt;
+	stParam.u8MinBandNum       = pstExtReg->u8MinBandNum;
+	stParam.u8MinValidBandPcnt = pstExtReg->u8MinValidBandPcnt;
+	stParam.u8WaveDiff1        = pstExtReg->u8WaveDiff1;
+	stParam.u8WaveDiff2        = pstExtReg->u8WaveDiff2;
+
+	stBuf.ps32GrCros0 = pstFlickerCtx->stFckPoint.ps32GrCros0;
+	stBuf.ps32GbCros0 = pstFlickerCtx->stFckPoint.ps32GbCros0;
+	stBuf.ps32GrCnt   = pstFlickerCtx->stFckPoint.ps32GrCnt;
+	stBuf.ps32GbCnt   = pstFlickerCtx->stFckPoint.ps32GbCnt;
+
+	/* scalar or packed-mask path, selected by ENABLE_FLICKER_SIMD */
+	ISP_FlickerWaveDetect(&stParam,
+		pstFlickerCtx->stFckStatInfo.ps32GrMean, pstFlickerCtx->stFckStatInfo.ps32GbMean,
+		pstFlickerCtx->s32PreFrameAvgGr, pstFlickerCtx->s32PreFrameAvgGb,
+		pstFlickerCtx->u16FckInx, &stBuf, &stResult);
+
+	pstFlickerCtx->s32CurFlicker = stResult.s32CurFlicker;
+	pstExtReg->s32GbAvgcnt	=	stResult.s32GbAvgcnt;
+	pstExtReg->s32GrAvgcnt	=	stResult.s32GrAvgcnt;
 
 	FlickerDetectResult( IspDev);
 }
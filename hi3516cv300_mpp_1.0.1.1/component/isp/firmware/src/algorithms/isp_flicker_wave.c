@@ -0,0 +1,278 @@
+/******************************************************************************
+
+  Copyright (C), 20015-2025, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : isp_flicker_wave.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/10
+  Description   : flicker band (wave) splitting and detection kernels
+  History       :
+  1.Date        : 2016/03/10
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include "isp_flicker_wave.h"
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+HI_S32 ISP_FlickerWaveSplit(const HI_S32 *ps32Mean, HI_S32 s32Axis, HI_U16 u16Num,
+    HI_S32 *ps32Cros0, HI_S32 *ps32Cnt)
+{
+    HI_U32 i, j;
+    HI_S32 s32Cnt, s32Indx, s32Tmp1, s32Tmp2;
+
+    /* previous frame-based mean is the zero-value axis.                */
+    /* if group mean value is above this zero-value, it is marked as 1; */
+    /* otherwise, it is marked as 0.                                    */
+    for (i = 0; i < u16Num; i++)
+    {
+        ps32Cros0[i] = (ps32Mean[i] >= s32Axis) ? 1 : 0;
+    }
+
+    s32Cnt  = 1;
+    s32Indx = 0;
+    j       = 1;
+    for (i = 0; i < u16Num; )
+    {
+        s32Tmp1 = ps32Cros0[i];
+        for ( ; j < u16Num; )
+        {
+            s32Tmp2 = ps32Cros0[j];
+            if (s32Tmp1 == s32Tmp2)
+            {
+                s32Cnt++;
+                j++;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (i == u16Num - 1)
+        {
+            ps32Cnt[s32Indx] = s32Cnt;
+            break;
+        }
+        else if (j == u16Num)
+        {
+            ps32Cnt[s32Indx] = s32Cnt;
+            i = u16Num;
+        }
+        else
+        {
+            ps32Cnt[s32Indx] = s32Cnt;
+            s32Cnt = 1;
+            i = j;
+            j++;
+            s32Indx++;
+        }
+    }
+
+    return s32Indx;
+}
+
+/* bit k of the result is set when ps32Mean[k] >= s32Axis, k < u32Len <= 32 */
+static __inline HI_U32 FlickerWaveMask(const HI_S32 *ps32Mean, HI_S32 s32Axis, HI_U32 u32Len)
+{
+    HI_U32 k = 0;
+    HI_U32 u32Mask = 0;
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+    static const HI_U32 au32Weight[4] = {1, 2, 4, 8};
+    int32x4_t  vAxis   = vdupq_n_s32(s32Axis);
+    uint32x4_t vWeight = vld1q_u32(au32Weight);
+    uint32x4_t vGe;
+    uint32x2_t vSum;
+
+    for ( ; k + 4 <= u32Len; k += 4)
+    {
+        vGe  = vandq_u32(vcgeq_s32(vld1q_s32(ps32Mean + k), vAxis), vWeight);
+        vSum = vadd_u32(vget_low_u32(vGe), vget_high_u32(vGe));
+        vSum = vpadd_u32(vSum, vSum);
+        u32Mask |= vget_lane_u32(vSum, 0) << k;
+    }
+#else
+    for ( ; k + 4 <= u32Len; k += 4)
+    {
+        u32Mask |= ((HI_U32)(ps32Mean[k]     >= s32Axis) << k)
+                |  ((HI_U32)(ps32Mean[k + 1] >= s32Axis) << (k + 1))
+                |  ((HI_U32)(ps32Mean[k + 2] >= s32Axis) << (k + 2))
+                |  ((HI_U32)(ps32Mean[k + 3] >= s32Axis) << (k + 3));
+    }
+#endif
+
+    for ( ; k < u32Len; k++)
+    {
+        u32Mask |= (HI_U32)(ps32Mean[k] >= s32Axis) << k;
+    }
+
+    return u32Mask;
+}
+
+HI_S32 ISP_FlickerWaveSplitFast(const HI_S32 *ps32Mean, HI_S32 s32Axis, HI_U16 u16Num,
+    HI_S32 *ps32Cnt)
+{
+    HI_U32 u32Base, u32Len, u32Mask, u32Edge, u32PrevBit;
+    HI_U32 u32Start = 0;
+    HI_S32 s32Indx  = 0;
+
+    if (0 == u16Num)
+    {
+        return 0;
+    }
+
+    /* the first group never starts a new wave */
+    u32PrevBit = (ps32Mean[0] >= s32Axis) ? 1 : 0;
+
+    for (u32Base = 0; u32Base < u16Num; u32Base += 32)
+    {
+        u32Len  = (u16Num - u32Base < 32) ? (u16Num - u32Base) : 32;
+        u32Mask = FlickerWaveMask(ps32Mean + u32Base, s32Axis, u32Len);
+
+        /* a set bit marks a group whose side differs from the one before */
+        u32Edge = u32Mask ^ ((u32Mask << 1) | u32PrevBit);
+        if (u32Len < 32)
+        {
+            u32Edge &= (1U << u32Len) - 1;
+        }
+        u32PrevBit = (u32Mask >> (u32Len - 1)) & 0x1;
+
+        while (u32Edge)
+        {
+            HI_U32 u32Pos = u32Base + __builtin_ctz(u32Edge);
+
+            ps32Cnt[s32Indx++] = (HI_S32)(u32Pos - u32Start);
+            u32Start = u32Pos;
+            u32Edge &= u32Edge - 1;
+        }
+    }
+
+    ps32Cnt[s32Indx] = (HI_S32)(u16Num - u32Start);
+
+    return s32Indx;
+}
+
+static HI_S32 FlickerWaveAvg(const HI_S32 *ps32Cnt, HI_S32 s32Indx, HI_S32 *ps32Avgcnt)
+{
+    HI_S32 i;
+    HI_S32 s32Avg = 0, s32Avgcnt = 0;
+
+    /* remove first and last wave */
+    for (i = 1; i < s32Indx; i++)
+    {
+        if (ps32Cnt[i] > 2)
+        {
+            s32Avg += ps32Cnt[i];
+            s32Avgcnt++;
+        }
+    }
+
+    *ps32Avgcnt = s32Avgcnt;
+
+    if (s32Avgcnt)
+    {
+        return (s32Avg + (s32Avgcnt >> 1)) / s32Avgcnt;
+    }
+
+    return -1;
+}
+
+static HI_S32 FlickerWavePat(const ISP_FLICKER_WAVE_PARAM_S *pstParam,
+    const HI_S32 *ps32Cnt, HI_S32 s32Indx, HI_S32 s32Avg)
+{
+    HI_S32 i;
+    HI_S32 s32Pat = 0, s32Diff3cnt = 0;
+
+    for (i = 1; i < s32Indx; i++)
+    {
+        if (abs(s32Avg - ps32Cnt[i]) <= pstParam->u8WaveDiff1)
+        {
+            s32Pat++;
+        }
+        else if (abs(s32Avg - ps32Cnt[i]) == pstParam->u8WaveDiff2)
+        {
+            s32Diff3cnt++;
+        }
+    }
+
+    /* We allow one time of difference being 3 (from the video we have had.) */
+    if (s32Diff3cnt == 1)
+    {
+        s32Pat++;
+    }
+
+    return s32Pat;
+}
+
+HI_VOID ISP_FlickerWaveDetect(const ISP_FLICKER_WAVE_PARAM_S *pstParam,
+    const HI_S32 *ps32GrMean, const HI_S32 *ps32GbMean,
+    HI_S32 s32GrAxis, HI_S32 s32GbAxis, HI_U16 u16Num,
+    ISP_FLICKER_WAVE_BUF_S *pstBuf, ISP_FLICKER_WAVE_RESULT_S *pstResult)
+{
+    HI_S32 s32Grindx, s32Gbindx;
+    HI_S32 s32GrAvgcnt = 0, s32GbAvgcnt = 0;
+    HI_S32 s32GrAvg, s32GbAvg, s32GrPat, s32GbPat, s32GrflickerThd, s32GbflickerThd;
+
+#ifdef ENABLE_FLICKER_SIMD
+    s32Grindx = ISP_FlickerWaveSplitFast(ps32GrMean, s32GrAxis, u16Num, pstBuf->ps32GrCnt);
+    s32Gbindx = ISP_FlickerWaveSplitFast(ps32GbMean, s32GbAxis, u16Num, pstBuf->ps32GbCnt);
+#else
+    s32Grindx = ISP_FlickerWaveSplit(ps32GrMean, s32GrAxis, u16Num, pstBuf->ps32GrCros0, pstBuf->ps32GrCnt);
+    s32Gbindx = ISP_FlickerWaveSplit(ps32GbMean, s32GbAxis, u16Num, pstBuf->ps32GbCros0, pstBuf->ps32GbCnt);
+#endif
+
+    /* pGr_cnt, pGb_cnt: the width of each wave                              */
+    /* Gr_avg, Gb_avg: the average width of wave                             */
+    /* Gr_pat, Gb_pat: the total number of valid wave                        */
+    /* Gr/Gbflicker_thd: min. number of valid wave to indicate flickering    */
+    /* Comparing the wave's avg. width with each wave's width,               */
+    /* if the difference is less than 2, this wave is valid flicker wave.    */
+    if (s32Grindx > pstParam->u8MinBandNum && s32Gbindx > pstParam->u8MinBandNum)
+    {
+        s32GrAvg = FlickerWaveAvg(pstBuf->ps32GrCnt, s32Grindx, &s32GrAvgcnt);
+        s32GbAvg = FlickerWaveAvg(pstBuf->ps32GbCnt, s32Gbindx, &s32GbAvgcnt);
+
+        if (s32GrAvg == -1 || s32GbAvg == -1)
+        {
+            s32GrPat = -1;
+            s32GbPat = -1;
+        }
+        else
+        {
+            s32GrPat = FlickerWavePat(pstParam, pstBuf->ps32GrCnt, s32Grindx, s32GrAvg);
+            s32GbPat = FlickerWavePat(pstParam, pstBuf->ps32GbCnt, s32Gbindx, s32GbAvg);
+        }
+    }
+    else
+    {
+        s32GrPat = -1;
+        s32GbPat = -1;
+    }
+
+    s32GrflickerThd = ((s32Grindx * pstParam->u8MinValidBandPcnt) + 5) / 10;
+    s32GbflickerThd = ((s32Gbindx * pstParam->u8MinValidBandPcnt) + 5) / 10;
+
+    pstResult->s32CurFlicker = (s32GrPat >= s32GrflickerThd && s32GbPat >= s32GbflickerThd) ? 1 : 0;
+    pstResult->s32GrAvgcnt   = s32GrAvgcnt;
+    pstResult->s32GbAvgcnt   = s32GbAvgcnt;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
@@ -0,0 +1,81 @@
+/******************************************************************************
+
+  Copyright (C), 20015-2025, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : isp_flicker_wave.h
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/10
+  Description   : flicker band (wave) splitting and detection kernels
+  History       :
+  1.Date        : 2016/03/10
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#ifndef __ISP_FLICKER_WAVE_H__
+#define __ISP_FLICKER_WAVE_H__
+
+#include "hi_type.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C"{
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+typedef struct hiISP_FLICKER_WAVE_PARAM_S
+{
+    HI_U8   u8MinBandNum;
+    HI_U8   u8MinValidBandPcnt;
+    HI_U8   u8WaveDiff1;
+    HI_U8   u8WaveDiff2;
+} ISP_FLICKER_WAVE_PARAM_S;
+
+typedef struct hiISP_FLICKER_WAVE_RESULT_S
+{
+    HI_S32  s32CurFlicker;      /* u1.0, 1 is flicker, 0 is no flicker */
+    HI_S32  s32GrAvgcnt;        /* number of valid inner Gr waves */
+    HI_S32  s32GbAvgcnt;        /* number of valid inner Gb waves */
+} ISP_FLICKER_WAVE_RESULT_S;
+
+/* Work buffers of u16Num entries each, owned by the caller. */
+typedef struct hiISP_FLICKER_WAVE_BUF_S
+{
+    HI_S32 *ps32GrCros0;
+    HI_S32 *ps32GbCros0;
+    HI_S32 *ps32GrCnt;
+    HI_S32 *ps32GbCnt;
+} ISP_FLICKER_WAVE_BUF_S;
+
+/*
+ * Split the group means into waves around s32Axis: ps32Cnt[k] receives the
+ * width (in groups) of the k-th run of means on the same side of the axis.
+ * Returns the index of the last wave; nothing is written when u16Num is 0.
+ */
+HI_S32 ISP_FlickerWaveSplit(const HI_S32 *ps32Mean, HI_S32 s32Axis, HI_U16 u16Num,
+    HI_S32 *ps32Cros0, HI_S32 *ps32Cnt);
+
+/*
+ * Same result as ISP_FlickerWaveSplit, bit-exact. The comparisons are packed
+ * into 32-group bit masks (four groups per NEON compare when available) and
+ * the waves are read from the mask edges, so no per-group flag array is used.
+ */
+HI_S32 ISP_FlickerWaveSplitFast(const HI_S32 *ps32Mean, HI_S32 s32Axis, HI_U16 u16Num,
+    HI_S32 *ps32Cnt);
+
+/* Per-frame flicker decision over the Gr and Gb group means. */
+HI_VOID ISP_FlickerWaveDetect(const ISP_FLICKER_WAVE_PARAM_S *pstParam,
+    const HI_S32 *ps32GrMean, const HI_S32 *ps32GbMean,
+    HI_S32 s32GrAxis, HI_S32 s32GbAxis, HI_U16 u16Num,
+    ISP_FLICKER_WAVE_BUF_S *pstBuf, ISP_FLICKER_WAVE_RESULT_S *pstResult);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif /* End of #ifdef __cplusplus */
+
+#endif /* __ISP_FLICKER_WAVE_H__ */
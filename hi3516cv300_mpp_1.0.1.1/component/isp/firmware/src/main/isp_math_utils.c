@@ -23,7 +23,7 @@ extern "C"{
 #endif
 #endif /* End of #ifdef __cplusplus */
 
-HI_U8 sqrt16(HI_U32 arg)
+HI_U8 sqrt16_calc(HI_U32 arg)
 {
     HI_U8 mask = 128;
     HI_U8 res  = 0;
@@ -37,7 +37,7 @@ HI_U8 sqrt16(HI_U32 arg)
     return res;
 }
 
-HI_U8 log16(HI_U32 arg)
+HI_U8 log16_calc(HI_U32 arg)
 {
     HI_U8  k = 0;
     HI_U8  res = 0;
@@ -52,7 +52,7 @@ HI_U8 log16(HI_U32 arg)
     return res;
 }
 
-HI_U16 Sqrt32(HI_U32 u32Arg)
+HI_U16 Sqrt32_calc(HI_U32 u32Arg)
 {
     HI_U32 u32Mask = (HI_U32)1 << 15;
     HI_U16 u16Res  = 0;
@@ -97,7 +97,7 @@ static HI_U8 leading_one_position(const HI_U32 in)
 
 
 
-HI_U32 log2_int_to_fixed(const HI_U32 val, const HI_U8 out_precision, const HI_U8 shift_out)
+HI_U32 log2_int_to_fixed_calc(const HI_U32 val, const HI_U8 out_precision, const HI_U8 shift_out)
 {
 	int i;
 	HI_U8 pos = 0;
@@ -256,7 +256,7 @@ HI_S32 solving_lin_equation_b(HI_S32 y1, HI_S32 a, HI_S32 x1, HI_S16 a_fraction_
  *	a: fixed xxx.fraction_size
  *	b: fixed xxx.fraction_size
  */
-HI_U32 div_fixed(HI_U32 a, HI_U32 b, const HI_U16 fraction_size)
+HI_U32 div_fixed_calc(HI_U32 a, HI_U32 b, const HI_U16 fraction_size)
 {
 	return (a << fraction_size) / b;
 }
@@ -339,6 +339,310 @@ HI_U32 transition(HI_U32 *lut_in, HI_U32 *lut_out, HI_U32 lut_size, HI_U32 value
 #endif
 
 
+/****************************************************************************
+ * TABLE-DRIVEN PRIMITIVES                                                  *
+ ****************************************************************************/
+
+#if defined(__GNUC__)
+#define MATH_CLZ(x)     ((HI_U32)__builtin_clz(x))     /* x != 0, one CLZ on ARMv5 */
+#else
+#define MATH_CLZ(x)     (31 - (HI_U32)leading_one_position(x))
+#endif
+
+/* round(sqrt(i) * 4096) - 32768, i = 64..256 */
+static const HI_U16 s_au16SqrtLut[193] = {
+    0, 255, 508, 759, 1008, 1256, 1502, 1746, 1988, 2228, 2467, 2704,
+    2940, 3174, 3407, 3638, 3868, 4096, 4323, 4548, 4772, 4995, 5217, 5437,
+    5656, 5874, 6090, 6305, 6519, 6732, 6944, 7155, 7364, 7573, 7780, 7987,
+    8192, 8396, 8600, 8802, 9003, 9204, 9403, 9601, 9799, 9995, 10191, 10386,
+    10580, 10773, 10965, 11157, 11347, 11537, 11726, 11914, 12101, 12288, 12474, 12659,
+    12843, 13027, 13209, 13392, 13573, 13754, 13934, 14113, 14291, 14469, 14647, 14823,
+    14999, 15174, 15349, 15523, 15697, 15869, 16041, 16213, 16384, 16554, 16724, 16893,
+    17062, 17230, 17398, 17564, 17731, 17897, 18062, 18227, 18391, 18555, 18718, 18881,
+    19043, 19204, 19366, 19526, 19686, 19846, 20005, 20164, 20322, 20480, 20637, 20794,
+    20951, 21106, 21262, 21417, 21572, 21726, 21879, 22033, 22186, 22338, 22490, 22642,
+    22793, 22944, 23094, 23244, 23394, 23543, 23691, 23840, 23988, 24135, 24283, 24430,
+    24576, 24722, 24868, 25013, 25158, 25303, 25447, 25591, 25735, 25878, 26021, 26163,
+    26305, 26447, 26589, 26730, 26871, 27011, 27151, 27291, 27431, 27570, 27709, 27847,
+    27985, 28123, 28261, 28398, 28535, 28672, 28808, 28944, 29080, 29216, 29351, 29486,
+    29620, 29755, 29889, 30022, 30156, 30289, 30422, 30555, 30687, 30819, 30951, 31082,
+    31214, 31345, 31475, 31606, 31736, 31866, 31995, 32125, 32254, 32383, 32511, 32640,
+    32768
+};
+
+/* round(log2(1 + i / 128) * 65536), i = 0..128 */
+static const HI_U32 s_au32Log2Lut[129] = {
+    0, 736, 1466, 2190, 2909, 3623, 4331, 5034, 5732, 6425,
+    7112, 7795, 8473, 9146, 9814, 10477, 11136, 11791, 12440, 13086,
+    13727, 14363, 14996, 15624, 16248, 16868, 17484, 18096, 18704, 19308,
+    19909, 20505, 21098, 21687, 22272, 22854, 23433, 24007, 24579, 25146,
+    25711, 26272, 26830, 27384, 27936, 28484, 29029, 29571, 30109, 30645,
+    31178, 31707, 32234, 32758, 33279, 33797, 34312, 34825, 35334, 35841,
+    36346, 36847, 37346, 37842, 38336, 38827, 39316, 39802, 40286, 40767,
+    41246, 41722, 42196, 42667, 43137, 43603, 44068, 44530, 44990, 45448,
+    45904, 46357, 46809, 47258, 47705, 48150, 48593, 49034, 49472, 49909,
+    50344, 50776, 51207, 51636, 52063, 52488, 52911, 53332, 53751, 54169,
+    54584, 54998, 55410, 55820, 56229, 56635, 57040, 57443, 57845, 58245,
+    58643, 59039, 59434, 59827, 60219, 60609, 60997, 61384, 61769, 62152,
+    62534, 62915, 63294, 63671, 64047, 64421, 64794, 65166, 65536
+};
+
+/* round(2^24 / (i + 256.5)): 1/d in Q15 for the divisor mantissa d = (i + 256.5) / 512 */
+static const HI_U16 s_au16RecipLut[256] = {
+    65408, 65154, 64902, 64652, 64404, 64158, 63913, 63671, 63430, 63191, 62954, 62719,
+    62485, 62253, 62023, 61795, 61568, 61343, 61119, 60897, 60677, 60458, 60241, 60026,
+    59812, 59599, 59388, 59179, 58971, 58764, 58559, 58356, 58153, 57952, 57753, 57555,
+    57358, 57163, 56968, 56776, 56584, 56394, 56205, 56017, 55831, 55646, 55462, 55279,
+    55098, 54917, 54738, 54560, 54383, 54207, 54033, 53859, 53687, 53516, 53346, 53177,
+    53009, 52842, 52676, 52511, 52347, 52184, 52022, 51862, 51702, 51543, 51385, 51228,
+    51072, 50917, 50763, 50610, 50458, 50306, 50156, 50007, 49858, 49710, 49563, 49417,
+    49272, 49128, 48985, 48842, 48700, 48559, 48419, 48280, 48141, 48003, 47867, 47730,
+    47595, 47460, 47326, 47193, 47061, 46929, 46798, 46668, 46539, 46410, 46282, 46155,
+    46028, 45902, 45777, 45652, 45528, 45405, 45283, 45161, 45040, 44919, 44799, 44680,
+    44561, 44443, 44326, 44209, 44093, 43977, 43862, 43748, 43634, 43521, 43408, 43296,
+    43185, 43074, 42963, 42854, 42744, 42636, 42528, 42420, 42313, 42207, 42101, 41996,
+    41891, 41786, 41683, 41579, 41476, 41374, 41272, 41171, 41070, 40970, 40870, 40771,
+    40672, 40574, 40476, 40378, 40281, 40185, 40089, 39993, 39898, 39804, 39709, 39616,
+    39522, 39429, 39337, 39245, 39153, 39062, 38971, 38881, 38791, 38702, 38613, 38524,
+    38436, 38348, 38260, 38173, 38087, 38000, 37915, 37829, 37744, 37659, 37575, 37491,
+    37407, 37324, 37241, 37159, 37077, 36995, 36914, 36833, 36752, 36672, 36592, 36512,
+    36433, 36354, 36275, 36197, 36119, 36041, 35964, 35887, 35810, 35734, 35658, 35583,
+    35507, 35432, 35358, 35283, 35209, 35136, 35062, 34989, 34916, 34844, 34771, 34700,
+    34628, 34557, 34486, 34415, 34344, 34274, 34204, 34135, 34065, 33996, 33928, 33859,
+    33791, 33723, 33655, 33588, 33521, 33454, 33387, 33321, 33255, 33189, 33124, 33059,
+    32994, 32929, 32864, 32800
+};
+
+/* floor(sqrt(x)) for the whole 32-bit range */
+static HI_U32 math_isqrt_lut(HI_U32 x)
+{
+    HI_U32 u32Even, u32M, u32Idx, u32Fract;
+    HI_U32 a, b, r;
+
+    if (0 == x)
+    {
+        return 0;
+    }
+
+    /* x = m / 4^k with m in [2^30, 2^32), sqrt(m) interpolated from the table */
+    u32Even  = (31 - MATH_CLZ(x)) & ~1U;
+    u32M     = x << (30 - u32Even);
+    u32Idx   = u32M >> 24;
+    u32Fract = (u32M >> 16) & 0xFF;
+    a = s_au16SqrtLut[u32Idx - 64] + 32768;
+    b = s_au16SqrtLut[u32Idx - 63] + 32768;
+    r = (a + (((b - a) * u32Fract) >> 8)) >> ((30 - u32Even) >> 1);
+
+    /* the estimate is at most 1 off, settle it exactly */
+    if (r > 0xFFFF)
+    {
+        r = 0xFFFF;
+    }
+    while (r * r > x)
+    {
+        r--;
+    }
+    while ((r < 0xFFFF) && ((r + 1) * (r + 1) <= x))
+    {
+        r++;
+    }
+
+    return r;
+}
+
+/* identical to sqrt16_calc */
+HI_U8 sqrt16_lut(HI_U32 arg)
+{
+    HI_U32 res = math_isqrt_lut(arg);
+
+    return (res > 255) ? 255 : (HI_U8)res;
+}
+
+/* identical to log16_calc: k is the position of the leading one of arg - 1 */
+HI_U8 log16_lut(HI_U32 arg)
+{
+    HI_U32 k;
+
+    if (arg <= 1)
+    {
+        return 0;
+    }
+
+    k = 31 - MATH_CLZ(arg - 1);
+    if (k > 15)
+    {
+        k = 15;
+    }
+
+    return (HI_U8)((k << 4) + ((arg << 4) >> k));
+}
+
+/* identical to Sqrt32_calc, including the wrap around to 0 for
+ * u32Arg > 0xFFFF0000 */
+HI_U16 Sqrt32_lut(HI_U32 u32Arg)
+{
+    HI_U32 u32Res = math_isqrt_lut(u32Arg);
+
+    /* rounding */
+    if (u32Res * u32Res + u32Res < u32Arg)
+    {
+        ++u32Res;
+    }
+
+    return (HI_U16)u32Res;
+}
+
+/* log2 mantissa from the table, rounded to out_precision + shift_out
+ * fraction bits; within 1 LSB of the exact log2 for up to 12 bits */
+HI_U32 log2_int_to_fixed_lut(const HI_U32 val, const HI_U8 out_precision, const HI_U8 shift_out)
+{
+    HI_U32 u32Pos, u32M, u32Idx, u32Fract, u32Log;
+    HI_U32 u32Bits = out_precision + shift_out;
+    HI_U32 a, b;
+
+    if (0 == val)
+    {
+        return 0;
+    }
+
+    u32Pos   = 31 - MATH_CLZ(val);
+    u32M     = val << (31 - u32Pos);
+    u32Idx   = (u32M >> 24) & 0x7F;
+    u32Fract = (u32M >> 8) & 0xFFFF;
+    a = s_au32Log2Lut[u32Idx];
+    b = s_au32Log2Lut[u32Idx + 1];
+    u32Log = a + (((b - a) * u32Fract) >> 16);
+
+    if (u32Bits >= 16)
+    {
+        return (u32Pos << u32Bits) + (u32Log << (u32Bits - 16));
+    }
+
+    return (u32Pos << u32Bits) + ((u32Log + (1 << (15 - u32Bits))) >> (16 - u32Bits));
+}
+
+/* identical to div_fixed_calc for b != 0, returns 0xFFFFFFFF for b == 0 */
+HI_U32 div_fixed_lut(HI_U32 a, HI_U32 b, const HI_U16 fraction_size)
+{
+    HI_U32 u32Num = a << fraction_size;
+    HI_U32 u32Shift, u32Den, u32Recip, u32Quot;
+    HI_S32 s32Err;
+    HI_U64 u64Prod;
+    HI_U32 i;
+
+    if (0 == b)
+    {
+        return 0xFFFFFFFF;
+    }
+
+    /* b = d * 2^(32 - u32Shift) with d = u32Den / 2^32 in [0.5, 1) */
+    u32Shift = MATH_CLZ(b);
+    u32Den   = b << u32Shift;
+    if (0x80000000 == u32Den)
+    {
+        return u32Num >> (31 - u32Shift);
+    }
+
+    /* 1/d in Q31 from the table, two Newton-Raphson steps x = x * (2 - d * x);
+     * the steps approach 1/d from below, so u32Recip stays below 2^32 */
+    u32Recip = (HI_U32)s_au16RecipLut[(u32Den >> 23) & 0xFF] << 16;
+    for (i = 0; i < 2; i++)
+    {
+        s32Err    = (HI_S32)((HI_S64)(0x8000000000000000ULL - (HI_U64)u32Den * u32Recip) >> 32);
+        u32Recip += (HI_S32)(((HI_S64)u32Recip * s32Err) >> 31);
+    }
+
+    /* the estimate is a few below the quotient at most, settle it exactly */
+    u32Quot = (HI_U32)(((HI_U64)u32Num * u32Recip) >> (63 - u32Shift));
+    u64Prod = (HI_U64)u32Quot * b;
+    while (u64Prod > u32Num)
+    {
+        u32Quot--;
+        u64Prod -= b;
+    }
+    while (u32Num - u64Prod >= b)
+    {
+        u32Quot++;
+        u64Prod += b;
+    }
+
+    return u32Quot;
+}
+
+/*	nth root finding y = x^0.45 = 2^(0.45 * log2(x))
+ *	x and y: fixed xxx.fraction_size
+ *	log2 from the table, 2^x from math_exp2: relative error below 2^-12
+ */
+HI_S32 solving_nth_root_045(HI_S32 x, const HI_U16 fraction_size)
+{
+    HI_S32 s32Log;
+
+    if (x <= 0)
+    {
+        return 0;
+    }
+
+    /* log2 of the fixed-point output, Q16; 0.45 = 29491 / 2^16 */
+    s32Log = (HI_S32)log2_int_to_fixed_lut((HI_U32)x, 16, 0) - ((HI_S32)fraction_size << 16);
+    s32Log = (HI_S32)(((HI_S64)s32Log * 29491) >> 16) + ((HI_S32)fraction_size << 16);
+    if (s32Log < 0)
+    {
+        return 0;
+    }
+
+    return (HI_S32)((math_exp2((HI_U32)s32Log, 16, 1) + 1) >> 1);
+}
+
+/****************************************************************************
+ * API                                                                      *
+ ****************************************************************************/
+
+HI_U8 sqrt16(HI_U32 arg)
+{
+#if ISP_MATH_LUT_SQRT16
+    return sqrt16_lut(arg);
+#else
+    return sqrt16_calc(arg);
+#endif
+}
+
+HI_U8 log16(HI_U32 arg)
+{
+#if ISP_MATH_LUT_LOG16
+    return log16_lut(arg);
+#else
+    return log16_calc(arg);
+#endif
+}
+
+HI_U16 Sqrt32(HI_U32 u32Arg)
+{
+#if ISP_MATH_LUT_SQRT32
+    return Sqrt32_lut(u32Arg);
+#else
+    return Sqrt32_calc(u32Arg);
+#endif
+}
+
+HI_U32 log2_int_to_fixed(const HI_U32 val, const HI_U8 out_precision, const HI_U8 shift_out)
+{
+#if ISP_MATH_LUT_LOG2
+    return log2_int_to_fixed_lut(val, out_precision, shift_out);
+#else
+    return log2_int_to_fixed_calc(val, out_precision, shift_out);
+#endif
+}
+
+HI_U32 div_fixed(HI_U32 a, HI_U32 b, const HI_U16 fraction_size)
+{
+#if ISP_MATH_LUT_DIV
+    return div_fixed_lut(a, b, fraction_size);
+#else
+    return div_fixed_calc(a, b, fraction_size);
+#endif
+}
+
+
 #ifdef __cplusplus
 #if __cplusplus
 }
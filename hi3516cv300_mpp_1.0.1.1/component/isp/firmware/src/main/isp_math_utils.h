@@ -30,6 +30,50 @@ extern "C"{
 #define ISP_BITFIX(bit)       ((1 << (bit)))
 #define ISP_SQR(x)            ((x) * (x))
 
+/* Table-driven (LUT plus interpolation) versions of the primitives are used
+ * when ENABLE_ISP_MATH_LUT is defined (CONFIG_ISP_MATH_LUT in Makefile.param).
+ * Only the bit-exact ones follow it; each primitive can be selected on its
+ * own, e.g. -DISP_MATH_LUT_LOG2=1. The ..._calc and ..._lut variants are
+ * exported for comparison.
+ *
+ * error bounds of the table versions:
+ *   sqrt16, log16, Sqrt32, div_fixed  identical to the _calc versions
+ *                                     (see isp_math_utils.c for edge cases)
+ *   log2_int_to_fixed                 within 1 LSB of the exact log2 for
+ *                                     out_precision + shift_out <= 12,
+ *                                     2.1 LSB for 16
+ *   math_exp2 (table only)            2^-14 relative for shift_in > 5
+ *   solving_nth_root_045 (table only) 2^-12 relative or 1 LSB
+ *
+ * div_fixed_lut replaces the division by a reciprocal table and two
+ * Newton-Raphson steps on 64-bit products; it is off by default as it is
+ * only a gain where the divide library call is slower than that.
+ * log2_int_to_fixed_lut is closer to the exact log2 than the bit-serial
+ * version but not identical to it, so it would change the output of
+ * existing tunings; it is off by default too.
+ */
+#ifdef ENABLE_ISP_MATH_LUT
+#define ISP_MATH_LUT_DEFAULT    1
+#else
+#define ISP_MATH_LUT_DEFAULT    0
+#endif
+
+#ifndef ISP_MATH_LUT_SQRT16
+#define ISP_MATH_LUT_SQRT16     ISP_MATH_LUT_DEFAULT
+#endif
+#ifndef ISP_MATH_LUT_LOG16
+#define ISP_MATH_LUT_LOG16      ISP_MATH_LUT_DEFAULT
+#endif
+#ifndef ISP_MATH_LUT_SQRT32
+#define ISP_MATH_LUT_SQRT32     ISP_MATH_LUT_DEFAULT
+#endif
+#ifndef ISP_MATH_LUT_LOG2
+#define ISP_MATH_LUT_LOG2       0
+#endif
+#ifndef ISP_MATH_LUT_DIV
+#define ISP_MATH_LUT_DIV        0
+#endif
+
 HI_U8 sqrt16(HI_U32 arg);
 HI_U8 log16(HI_U32 arg);
 HI_U16 Sqrt32(HI_U32 u32Arg);
@@ -39,7 +83,19 @@ HI_U32 math_exp2(HI_U32 val, const unsigned char shift_in, const unsigned char s
 HI_S32 solving_lin_equation_a(HI_S32 y1, HI_S32 y2, HI_S32 x1, HI_S32 x2, HI_S16 a_fraction_size);
 HI_S32 solving_lin_equation_b(HI_S32 y1, HI_S32 a, HI_S32 x1, HI_S16 a_fraction_size);
 HI_U32 div_fixed(HI_U32 a, HI_U32 b, const HI_U16 fraction_size);
-//HI_S32 solving_nth_root_045(HI_S32 x, const HI_U16 fraction_size);
+HI_S32 solving_nth_root_045(HI_S32 x, const HI_U16 fraction_size);
+
+HI_U8 sqrt16_calc(HI_U32 arg);
+HI_U8 log16_calc(HI_U32 arg);
+HI_U16 Sqrt32_calc(HI_U32 u32Arg);
+HI_U32 log2_int_to_fixed_calc(const HI_U32 val, const HI_U8 out_precision, const HI_U8 shift_out);
+HI_U32 div_fixed_calc(HI_U32 a, HI_U32 b, const HI_U16 fraction_size);
+
+HI_U8 sqrt16_lut(HI_U32 arg);
+HI_U8 log16_lut(HI_U32 arg);
+HI_U16 Sqrt32_lut(HI_U32 u32Arg);
+HI_U32 log2_int_to_fixed_lut(const HI_U32 val, const HI_U8 out_precision, const HI_U8 shift_out);
+HI_U32 div_fixed_lut(HI_U32 a, HI_U32 b, const HI_U16 fraction_size);
 //HI_U32 transition(HI_U32 *lut_in, HI_U32 *lut_out, HI_U32 lut_size, HI_U32 value, HI_U32 value_fraction_size);
 
 #ifdef __cplusplus
@@ -0,0 +1,188 @@
+/******************************************************************************
+
+  Copyright (C), 20015-2025, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : isp_flicker_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/10
+  Description   : host test of the flicker wave kernels: bit-exactness of the
+                  scalar and packed-mask paths, 50Hz/60Hz detection on
+                  synthetic row means, and throughput of both paths.
+  History       :
+  1.Date        : 2016/03/10
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+
+#include "isp_flicker_wave.h"
+
+/* same defaults as isp_flicker.c */
+#define TEST_MINBANDNUM         (3)
+#define TEST_MINVALIDBANDPCNT   (6)
+#define TEST_WAVEDIFF1          (3)
+#define TEST_WAVEDIFF2          (4)
+#define TEST_GRCNT              (5)
+#define TEST_GBCNT              (5)
+
+#define TEST_MAX_GROUP          (512)
+#define TEST_LOOP               (200000)
+
+static HI_S32 s_as32GrMean[TEST_MAX_GROUP];
+static HI_S32 s_as32GbMean[TEST_MAX_GROUP];
+static HI_S32 s_as32Cros0[TEST_MAX_GROUP];
+static HI_S32 s_as32Cnt[TEST_MAX_GROUP];
+static HI_S32 s_as32CntFast[TEST_MAX_GROUP];
+
+static HI_U64 TEST_GetTimeUs(HI_VOID)
+{
+    struct timeval stTime;
+
+    gettimeofday(&stTime, NULL);
+    return (HI_U64)stTime.tv_sec * 1000000 + stTime.tv_usec;
+}
+
+/* group means of one frame (s11 range): a vertical scene gradient of s32Ramp */
+/* plus the banding of a lamp driven by u32MainsHz with amplitude s32Amp      */
+static HI_VOID TEST_GenFrame(HI_S32 *ps32Mean, HI_U16 u16Num, HI_U32 u32Lines,
+    HI_U32 u32Fps, HI_U32 u32MainsHz, HI_S32 s32Amp, HI_S32 s32Ramp, HI_DOUBLE dPhase)
+{
+    HI_U32 i;
+    HI_DOUBLE dTime;
+
+    for (i = 0; i < u16Num; i++)
+    {
+        dTime = (HI_DOUBLE)(i * 16 + 8) / ((HI_DOUBLE)u32Lines * u32Fps);
+        ps32Mean[i] = (HI_S32)(s32Amp * sin(2 * M_PI * 2 * u32MainsHz * dTime + dPhase))
+                    + s32Ramp * (2 * (HI_S32)i - u16Num) / u16Num + (rand() % 9) - 4;
+    }
+}
+
+static HI_S32 TEST_BitExact(HI_VOID)
+{
+    HI_U32 u32Iter, i;
+    HI_U16 u16Num;
+    HI_S32 s32Axis, s32Indx, s32IndxFast;
+
+    for (u32Iter = 0; u32Iter < 20000; u32Iter++)
+    {
+        u16Num  = (HI_U16)(rand() % TEST_MAX_GROUP);
+        s32Axis = (rand() % 64) - 32;
+        for (i = 0; i < u16Num; i++)
+        {
+            /* mix long runs and single-group noise */
+            s_as32GrMean[i] = (u32Iter & 1) ? ((rand() % 2048) - 1024)
+                            : (HI_S32)(300 * sin(i * 0.05 * (1 + u32Iter % 7))) + (rand() % 5) - 2;
+        }
+
+        memset(s_as32Cnt, 0, sizeof(s_as32Cnt));
+        memset(s_as32CntFast, 0, sizeof(s_as32CntFast));
+        s32Indx     = ISP_FlickerWaveSplit(s_as32GrMean, s32Axis, u16Num, s_as32Cros0, s_as32Cnt);
+        s32IndxFast = ISP_FlickerWaveSplitFast(s_as32GrMean, s32Axis, u16Num, s_as32CntFast);
+
+        if (s32Indx != s32IndxFast || memcmp(s_as32Cnt, s_as32CntFast, sizeof(s_as32Cnt)))
+        {
+            printf("bit-exact FAIL: iter %u num %u indx %d/%d\n", u32Iter, u16Num, s32Indx, s32IndxFast);
+            return HI_FAILURE;
+        }
+    }
+
+    printf("bit-exact: %u random sequences OK\n", u32Iter);
+    return HI_SUCCESS;
+}
+
+static HI_S32 TEST_Detect(const HI_CHAR *pszName, HI_U32 u32MainsHz, HI_S32 s32Amp,
+    HI_S32 s32Ramp, HI_S32 s32ExpFlicker, HI_S32 s32ExpFreq)
+{
+    /* 1080p30 sensor timing: 1125 total lines, groups of 16 lines */
+    HI_U32 u32Lines = 1125, u32Fps = 30;
+    HI_U16 u16Num = u32Lines >> 4;
+    HI_S32 s32Freq;
+    ISP_FLICKER_WAVE_PARAM_S stParam;
+    ISP_FLICKER_WAVE_RESULT_S stResult;
+    ISP_FLICKER_WAVE_BUF_S stBuf;
+    HI_S32 as32GbCros0[TEST_MAX_GROUP], as32GbCnt[TEST_MAX_GROUP];
+
+    stParam.u8MinBandNum       = TEST_MINBANDNUM;
+    stParam.u8MinValidBandPcnt = TEST_MINVALIDBANDPCNT;
+    stParam.u8WaveDiff1        = TEST_WAVEDIFF1;
+    stParam.u8WaveDiff2        = TEST_WAVEDIFF2;
+    stBuf.ps32GrCros0 = s_as32Cros0;
+    stBuf.ps32GrCnt   = s_as32Cnt;
+    stBuf.ps32GbCros0 = as32GbCros0;
+    stBuf.ps32GbCnt   = as32GbCnt;
+
+    TEST_GenFrame(s_as32GrMean, u16Num, u32Lines, u32Fps, u32MainsHz, s32Amp, s32Ramp, 0.3);
+    TEST_GenFrame(s_as32GbMean, u16Num, u32Lines, u32Fps, u32MainsHz, s32Amp, s32Ramp, 0.3);
+
+    ISP_FlickerWaveDetect(&stParam, s_as32GrMean, s_as32GbMean, 0, 0, u16Num, &stBuf, &stResult);
+
+    /* 50Hz/60Hz decision as in FlickerDetectResult */
+    if (1 == stResult.s32CurFlicker)
+    {
+        s32Freq = (stResult.s32GrAvgcnt <= TEST_GRCNT && stResult.s32GbAvgcnt <= TEST_GBCNT) ? 50 : 60;
+    }
+    else
+    {
+        s32Freq = 0;
+    }
+
+    printf("%-10s flicker %d freq %d (GrAvgcnt %d GbAvgcnt %d) ... %s\n", pszName,
+        stResult.s32CurFlicker, s32Freq, stResult.s32GrAvgcnt, stResult.s32GbAvgcnt,
+        (stResult.s32CurFlicker == s32ExpFlicker && s32Freq == s32ExpFreq) ? "OK" : "FAIL");
+
+    return (stResult.s32CurFlicker == s32ExpFlicker && s32Freq == s32ExpFreq) ? HI_SUCCESS : HI_FAILURE;
+}
+
+static HI_VOID TEST_Throughput(HI_VOID)
+{
+    HI_U32 i;
+    HI_U16 u16Num = 1125 >> 4;
+    HI_U64 u64Start, u64Scalar, u64Fast;
+    volatile HI_S32 s32Sink = 0;
+
+    TEST_GenFrame(s_as32GrMean, u16Num, 1125, 30, 50, 200, 0, 0.0);
+
+    u64Start = TEST_GetTimeUs();
+    for (i = 0; i < TEST_LOOP; i++)
+    {
+        s32Sink += ISP_FlickerWaveSplit(s_as32GrMean, (HI_S32)(i & 1), u16Num, s_as32Cros0, s_as32Cnt);
+    }
+    u64Scalar = TEST_GetTimeUs() - u64Start;
+
+    u64Start = TEST_GetTimeUs();
+    for (i = 0; i < TEST_LOOP; i++)
+    {
+        s32Sink += ISP_FlickerWaveSplitFast(s_as32GrMean, (HI_S32)(i & 1), u16Num, s_as32CntFast);
+    }
+    u64Fast = TEST_GetTimeUs() - u64Start;
+
+    printf("throughput (%u groups, %u frames): scalar %.1f ns/frame, fast %.1f ns/frame, x%.2f\n",
+        u16Num, TEST_LOOP, u64Scalar * 1000.0 / TEST_LOOP, u64Fast * 1000.0 / TEST_LOOP,
+        u64Fast ? (HI_DOUBLE)u64Scalar / u64Fast : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+
+    srand(1);
+
+    s32Ret |= TEST_BitExact();
+    s32Ret |= TEST_Detect("50Hz", 50, 200, 0, 1, 50);
+    s32Ret |= TEST_Detect("60Hz", 60, 200, 0, 1, 60);
+    s32Ret |= TEST_Detect("steady", 50, 0, 300, 0, 0);
+
+    TEST_Throughput();
+
+    printf("%s\n", (HI_SUCCESS == s32Ret) ? "PASS" : "FAIL");
+    return (HI_SUCCESS == s32Ret) ? 0 : 1;
+}
@@ -0,0 +1,305 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2011, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : isp_math_test.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/03/16
+  Description   : host test of the isp math primitives: sweeps the input
+                  domain, compares the table versions with the _calc
+                  versions and double-precision references, and reports the
+                  speedup of the table versions.
+  History       :
+  1.Date        : 2016/03/16
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/time.h>
+
+#include "isp_math_utils.h"
+
+#define TEST_LOOP           (4000000)
+
+static HI_U32 s_u32Seed = 0x12345678;
+static HI_U32 s_u32Fail = 0;
+
+static HI_U32 TEST_Rand(HI_VOID)
+{
+    /* xorshift32, full 32-bit range */
+    s_u32Seed ^= s_u32Seed << 13;
+    s_u32Seed ^= s_u32Seed >> 17;
+    s_u32Seed ^= s_u32Seed << 5;
+    return s_u32Seed;
+}
+
+/* random value with a random number of significant bits */
+static HI_U32 TEST_RandBits(HI_VOID)
+{
+    HI_U32 u32Bits = TEST_Rand() % 33;
+
+    return (32 == u32Bits) ? TEST_Rand() : (TEST_Rand() & ((1U << u32Bits) - 1));
+}
+
+static HI_U64 TEST_GetTimeUs(HI_VOID)
+{
+    struct timeval stTime;
+
+    gettimeofday(&stTime, NULL);
+    return (HI_U64)stTime.tv_sec * 1000000 + stTime.tv_usec;
+}
+
+static HI_VOID TEST_Result(const HI_CHAR *pszName, HI_U32 u32Checked, HI_U32 u32Diff, const HI_CHAR *pszErr)
+{
+    printf("%-22s %10u inputs, %u mismatches%s ... %s\n", pszName, u32Checked, u32Diff,
+        pszErr, u32Diff ? "FAIL" : "OK");
+    s_u32Fail += u32Diff;
+}
+
+static HI_U32 TEST_Isqrt(HI_U32 x)
+{
+    HI_U64 r = (HI_U64)sqrt((HI_DOUBLE)x);
+
+    while (r * r > x)
+    {
+        r--;
+    }
+    while ((r + 1) * (r + 1) <= x)
+    {
+        r++;
+    }
+    return (HI_U32)r;
+}
+
+/* whole 16-bit range, then the neighbourhood of every square and root midpoint */
+static HI_VOID TEST_Sqrt(HI_VOID)
+{
+    HI_U64 x;
+    HI_U32 r, k, u32Checked = 0, u32Diff16 = 0, u32Diff32 = 0, u32DiffRef = 0;
+    HI_U32 u32Ref;
+    HI_U32 au32Pt[6];
+
+    for (x = 0; x < (1 << 20); x++)
+    {
+        u32Ref = TEST_Isqrt((HI_U32)x);
+        u32Diff16 += (sqrt16_lut((HI_U32)x) != sqrt16_calc((HI_U32)x));
+        u32DiffRef += (sqrt16_lut((HI_U32)x) != ((u32Ref > 255) ? 255 : u32Ref));
+        u32Diff32 += (Sqrt32_lut((HI_U32)x) != Sqrt32_calc((HI_U32)x));
+        u32Checked++;
+    }
+
+    for (r = 1024; r < 65536; r++)
+    {
+        au32Pt[0] = r * r - 1;
+        au32Pt[1] = r * r;
+        au32Pt[2] = r * r + r - 1;
+        au32Pt[3] = r * r + r;
+        au32Pt[4] = r * r + r + 1;
+        au32Pt[5] = r * r + 2 * r;
+        for (k = 0; k < 6; k++)
+        {
+            /* rounded to nearest, wraps around to 0 above 0xFFFF0000 */
+            u32Ref = TEST_Isqrt(au32Pt[k]);
+            u32Ref += ((HI_U64)u32Ref * u32Ref + u32Ref < au32Pt[k]);
+            u32DiffRef += (Sqrt32_lut(au32Pt[k]) != (u32Ref & 0xFFFF));
+            u32Diff32 += (Sqrt32_lut(au32Pt[k]) != Sqrt32_calc(au32Pt[k]));
+            u32Checked++;
+        }
+    }
+
+    for (x = 0xFFFF0000; x <= 0xFFFFFFFF; x++)
+    {
+        u32DiffRef += (Sqrt32_lut((HI_U32)x) != ((x > 0xFFFF0000) ? 0 : 0xFFFF));
+        u32Diff32 += (Sqrt32_lut((HI_U32)x) != Sqrt32_calc((HI_U32)x));
+        u32Checked++;
+    }
+
+    TEST_Result("sqrt16 lut/calc", 1 << 20, u32Diff16, "");
+    TEST_Result("sqrt lut/integer ref", u32Checked, u32DiffRef, "");
+    TEST_Result("Sqrt32 lut/calc", u32Checked, u32Diff32, "");
+}
+
+static HI_VOID TEST_Log16(HI_VOID)
+{
+    HI_U32 x, i, u32Diff = 0;
+
+    for (x = 0; x < (1 << 22); x++)
+    {
+        u32Diff += (log16_lut(x) != log16_calc(x));
+    }
+    for (i = 0; i < 4000000; i++)
+    {
+        x = TEST_RandBits();
+        u32Diff += (log16_lut(x) != log16_calc(x));
+    }
+
+    TEST_Result("log16 lut/calc", (1 << 22) + i, u32Diff, "");
+}
+
+static HI_VOID TEST_Log2(HI_VOID)
+{
+    static const HI_U8 au8Prec[][2] = {{4, 0}, {8, 0}, {6, 2}, {10, 0}, {12, 0}, {8, 8}, {16, 0}};
+    HI_U32 i, j, x, u32Diff = 0;
+    HI_U32 u32Bits;
+    HI_DOUBLE dRef, dErr, dMaxLut, dMaxCalc;
+    HI_CHAR szErr[96];
+
+    for (j = 0; j < sizeof(au8Prec) / sizeof(au8Prec[0]); j++)
+    {
+        u32Bits  = au8Prec[j][0] + au8Prec[j][1];
+        dMaxLut  = 0;
+        dMaxCalc = 0;
+        for (i = 0; i < 2000000; i++)
+        {
+            x = (i < (1 << 16)) ? i + 1 : TEST_RandBits();
+            if (0 == x)
+            {
+                continue;
+            }
+            dRef = log2((HI_DOUBLE)x) * (1 << u32Bits);
+            dErr = fabs(log2_int_to_fixed_lut(x, au8Prec[j][0], au8Prec[j][1]) - dRef);
+            dMaxLut = (dErr > dMaxLut) ? dErr : dMaxLut;
+            dErr = fabs(log2_int_to_fixed_calc(x, au8Prec[j][0], au8Prec[j][1]) - dRef);
+            dMaxCalc = (dErr > dMaxCalc) ? dErr : dMaxCalc;
+        }
+        u32Diff = (dMaxLut > ((u32Bits <= 12) ? 1.0 : 2.1));
+        snprintf(szErr, sizeof(szErr), ", max err (LSB) lut %.3f calc %.3f", dMaxLut, dMaxCalc);
+        printf("log2 %2u.%-2u", au8Prec[j][0], au8Prec[j][1]);
+        TEST_Result(" lut/double", i, u32Diff, szErr);
+    }
+}
+
+static HI_VOID TEST_Exp2(HI_VOID)
+{
+    static const HI_U8 au8Shift[][2] = {{4, 8}, {8, 8}, {10, 10}, {12, 12}, {16, 8}};
+    HI_U32 i, j, x, u32Max, u32Diff;
+    HI_DOUBLE dRef, dErr, dMax;
+    HI_CHAR szErr[96];
+
+    for (j = 0; j < sizeof(au8Shift) / sizeof(au8Shift[0]); j++)
+    {
+        /* keep the result within 30 bits */
+        u32Max = (30 - au8Shift[j][1] - 1) << au8Shift[j][0];
+        dMax = 0;
+        for (i = 0; i < u32Max; i++)
+        {
+            x = (i < (1 << 16)) ? i : TEST_Rand() % u32Max;
+            dRef = pow(2.0, (HI_DOUBLE)x / (1 << au8Shift[j][0]) + au8Shift[j][1]);
+            dErr = fabs(math_exp2(x, au8Shift[j][0], au8Shift[j][1]) - dRef);
+            /* relative error, or the truncation to an integer for small results */
+            dErr = (dErr <= 1.0) ? 0 : dErr / dRef;
+            dMax = (dErr > dMax) ? dErr : dMax;
+            if (i >= 2000000)
+            {
+                break;
+            }
+        }
+        u32Diff = (dMax > 1.0 / (1 << 14));
+        snprintf(szErr, sizeof(szErr), ", max rel err %.2e", dMax);
+        printf("exp2 %2u->%-2u", au8Shift[j][0], au8Shift[j][1]);
+        TEST_Result("lut/double", i, u32Diff, szErr);
+    }
+}
+
+static HI_VOID TEST_Div(HI_VOID)
+{
+    HI_U32 i, a, b, f, u32Diff = 0;
+
+    for (i = 0; i < 8000000; i++)
+    {
+        a = TEST_RandBits();
+        b = TEST_RandBits();
+        f = TEST_Rand() % 16;
+        switch (i & 7)
+        {
+            case 0 : b = 1U << (TEST_Rand() % 32); break;
+            case 1 : b = 0xFFFFFFFF - (TEST_Rand() & 0xF); break;
+            case 2 : b = (1U << (TEST_Rand() % 32)) + 1; break;
+            case 3 : a = 0xFFFFFFFF; f = 0; break;
+            default : break;
+        }
+        if (0 == b)
+        {
+            b = 1;
+        }
+        u32Diff += (div_fixed_lut(a, b, f) != div_fixed_calc(a, b, f));
+    }
+
+    TEST_Result("div_fixed lut/calc", i, u32Diff, "");
+}
+
+static HI_VOID TEST_Root045(HI_VOID)
+{
+    static const HI_U16 au16Frac[] = {8, 10, 12, 16};
+    HI_U32 i, j, u32Diff;
+    HI_S32 x;
+    HI_DOUBLE dRef, dErr, dMax;
+    HI_CHAR szErr[96];
+
+    for (j = 0; j < sizeof(au16Frac) / sizeof(au16Frac[0]); j++)
+    {
+        dMax = 0;
+        for (i = 0; i < 2000000; i++)
+        {
+            x = (i < (1 << 16)) ? (HI_S32)i : (HI_S32)(TEST_RandBits() >> 1);
+            dRef = pow((HI_DOUBLE)x / (1 << au16Frac[j]), 0.45) * (1 << au16Frac[j]);
+            dErr = fabs(solving_nth_root_045(x, au16Frac[j]) - dRef);
+            dErr = (dErr <= 1.0) ? 0 : dErr / dRef;
+            dMax = (dErr > dMax) ? dErr : dMax;
+        }
+        u32Diff = (dMax > 1.0 / (1 << 12));
+        snprintf(szErr, sizeof(szErr), ", max rel err %.2e", dMax);
+        printf("root045 .%-2u ", au16Frac[j]);
+        TEST_Result("lut/double", i, u32Diff, szErr);
+    }
+}
+
+#define TEST_BENCH(name, calc, lut)                                             \
+do {                                                                            \
+    HI_U64 u64Start, u64Calc, u64Lut;                                           \
+    s_u32Seed = 1;                                                              \
+    u64Start = TEST_GetTimeUs();                                                \
+    for (i = 0; i < TEST_LOOP; i++) { x = TEST_Rand() >> (i & 15); u32Sink += calc; } \
+    u64Calc = TEST_GetTimeUs() - u64Start;                                      \
+    s_u32Seed = 1;                                                              \
+    u64Start = TEST_GetTimeUs();                                                \
+    for (i = 0; i < TEST_LOOP; i++) { x = TEST_Rand() >> (i & 15); u32Sink += lut; } \
+    u64Lut = TEST_GetTimeUs() - u64Start;                                       \
+    printf("%-18s calc %6.1f ns  lut %6.1f ns  x%.2f\n", name,                  \
+        u64Calc * 1000.0 / TEST_LOOP, u64Lut * 1000.0 / TEST_LOOP,              \
+        u64Lut ? (HI_DOUBLE)u64Calc / u64Lut : 0.0);                            \
+} while (0)
+
+static HI_VOID TEST_Speed(HI_VOID)
+{
+    HI_U32 i, x;
+    volatile HI_U32 u32Sink = 0;
+
+    printf("speed (%u calls, includes the input generation):\n", TEST_LOOP);
+    TEST_BENCH("sqrt16", sqrt16_calc(x >> 16), sqrt16_lut(x >> 16));
+    TEST_BENCH("log16", log16_calc(x), log16_lut(x));
+    TEST_BENCH("Sqrt32", Sqrt32_calc(x), Sqrt32_lut(x));
+    TEST_BENCH("log2_int_to_fixed", log2_int_to_fixed_calc(x | 1, 8, 0), log2_int_to_fixed_lut(x | 1, 8, 0));
+    TEST_BENCH("div_fixed", div_fixed_calc(x >> 8, (x & 0xFFFF) | 1, 8), div_fixed_lut(x >> 8, (x & 0xFFFF) | 1, 8));
+}
+
+int main(int argc, char *argv[])
+{
+    TEST_Sqrt();
+    TEST_Log16();
+    TEST_Log2();
+    TEST_Exp2();
+    TEST_Div();
+    TEST_Root045();
+
+    TEST_Speed();
+
+    printf("%s\n", (0 == s_u32Fail) ? "PASS" : "FAIL");
+    return (0 == s_u32Fail) ? 0 : 1;
+}
@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hi_type.h"
+#include "hi_sceneauto_define_ext.h"
+#include "hi_sceneauto_ext.h"
+
+/* compile a sceneauto ini into the blob HI_SCENEAUTO_Init maps at boot */
+int main(int argc, char* argv[])
+{
+    int ret;
+    char bin_name[256];
+
+    if ((argc < 2) || (!strcmp(argv[1], "-h")))
+    {
+        printf("/***************************************************************/\n\n");
+        printf("usage: ./sceneauto_bin ini_path [bin_path].\n\n");
+        printf("bin_path defaults to ini_path.bin, which is what sample_scene looks for.\n\n");
+        printf("for example: ./sceneauto_bin ini/IPC/sceneauto_imx290.ini\n\n");
+        printf("/***************************************************************/\n\n");
+        return 0;
+    }
+
+    if (argc > 2)
+    {
+        snprintf(bin_name, sizeof(bin_name), "%s", argv[2]);
+    }
+    else
+    {
+        snprintf(bin_name, sizeof(bin_name), "%s.bin", argv[1]);
+    }
+
+    ret = HI_SCENEAUTO_CompileBin(argv[1], bin_name);
+    if (HI_SUCCESS != ret)
+    {
+        printf("HI_SCENEAUTO_CompileBin failed\n");
+        return -1;
+    }
+
+    /* time the boot path the way sample_scene takes it */
+    ret = HI_SCENEAUTO_Init(argv[1]);
+    if (HI_SUCCESS != ret)
+    {
+        printf("HI_SCENEAUTO_Init failed\n");
+        return -1;
+    }
+    (void)HI_SCENEAUTO_DeInit();
+
+    return 0;
+}
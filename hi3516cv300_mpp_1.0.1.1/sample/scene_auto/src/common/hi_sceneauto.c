@@ -8,6 +8,7 @@
 
 //#include "iniparser.h"
 #include "hi_sceneauto_comm.h"
+#include "hi_sceneauto_binpara.h"
 #include "hi_sceneauto_define_ext.h"
 #include "hi_sceneauto_ext.h"
 #include "hi_common.h"
@@ -2918,37 +2919,114 @@ HI_S32 HI_SCENEAUTO_DeInit()
     return HI_SUCCESS;
 }
 
-HI_S32 HI_SCENEAUTO_Init(const HI_CHAR* pszFileName)
+HI_S32 HI_SCENEAUTO_CompileBin(const HI_CHAR* pszIniFile, const HI_CHAR* pszBinFile)
 {
     HI_S32 s32Ret = HI_SUCCESS;
+    HI_U64 u64IniTime;
+    HI_U64 u64BinTime;
+    SCENEAUTO_INIPARA_S stBinPara;
 
-    CHECK_NULL_PTR(pszFileName);
+    CHECK_NULL_PTR(pszIniFile);
+    CHECK_NULL_PTR(pszBinFile);
 
     MUTEX_LOCK(g_stSceneautoLock);
     if (HI_TRUE == g_bSceneautoInit)
     {
-        printf("SCENEAUTO Module has been inited already\n");
+        printf("SCENEAUTO Module is inited, deinit it before compiling\n");
         MUTEX_UNLOCK(g_stSceneautoLock);
-        return HI_SUCCESS;
+        return HI_FAILURE;
     }
 
-    s32Ret = Sceneauto_LoadFile(pszFileName);
+    u64IniTime = Sceneauto_GetTimeUs();
+    s32Ret = Sceneauto_LoadFile(pszIniFile);
+    if (HI_SUCCESS == s32Ret)
+    {
+        s32Ret = Sceneauto_LoadINIPara();
+    }
+    u64IniTime = Sceneauto_GetTimeUs() - u64IniTime;
+    Sceneauto_FreeDict();
     if (HI_SUCCESS != s32Ret)
     {
-        printf("Sceneauto_LoadFile failed\n");
-        Sceneauto_FreeDict();
+        printf("Sceneauto_LoadINIPara failed\n");
+        Sceneauto_FreeMem();
         MUTEX_UNLOCK(g_stSceneautoLock);
         return HI_FAILURE;
     }
 
-    s32Ret = Sceneauto_LoadINIPara();
-    if (HI_SUCCESS != s32Ret)
+    s32Ret = Sceneauto_SaveBinPara(&g_stINIPara, pszIniFile, pszBinFile);
+    if (HI_SUCCESS == s32Ret)
     {
-        printf("Sceneauto_LoadCommonPara failed\n");
-        Sceneauto_FreeDict();
-        Sceneauto_FreeMem();
+        /* read the blob back and check it reproduces what the ini parser built */
+        memset(&stBinPara, 0, sizeof(stBinPara));
+        u64BinTime = Sceneauto_GetTimeUs();
+        s32Ret = Sceneauto_MapBinPara(&stBinPara, pszIniFile, pszBinFile);
+        u64BinTime = Sceneauto_GetTimeUs() - u64BinTime;
+        if (HI_SUCCESS == s32Ret)
+        {
+            s32Ret = Sceneauto_CompareBinPara(&g_stINIPara, &stBinPara);
+            Sceneauto_UnmapBinPara(&stBinPara);
+        }
+        if (HI_SUCCESS == s32Ret)
+        {
+            printf("%s -> %s: ini load %llu us, bin load %llu us\n", pszIniFile, pszBinFile, u64IniTime, u64BinTime);
+        }
+        else
+        {
+            printf("verify %s failed\n", pszBinFile);
+            (HI_VOID)unlink(pszBinFile);
+        }
+    }
+
+    Sceneauto_FreeMem();
+    MUTEX_UNLOCK(g_stSceneautoLock);
+
+    return s32Ret;
+}
+
+HI_S32 HI_SCENEAUTO_Init(const HI_CHAR* pszFileName)
+{
+    HI_S32 s32Ret = HI_SUCCESS;
+    HI_U64 u64LoadTime;
+    HI_CHAR szBinFile[256];
+
+    CHECK_NULL_PTR(pszFileName);
+
+    MUTEX_LOCK(g_stSceneautoLock);
+    if (HI_TRUE == g_bSceneautoInit)
+    {
+        printf("SCENEAUTO Module has been inited already\n");
         MUTEX_UNLOCK(g_stSceneautoLock);
-        return HI_FAILURE;
+        return HI_SUCCESS;
+    }
+
+    u64LoadTime = Sceneauto_GetTimeUs();
+    snprintf(szBinFile, sizeof(szBinFile), "%s%s", pszFileName, SCENEAUTO_BINPARA_SUFFIX);
+    s32Ret = Sceneauto_MapBinPara(&g_stINIPara, pszFileName, szBinFile);
+    if (HI_SUCCESS == s32Ret)
+    {
+        printf("sceneauto para mapped from %s in %llu us\n", szBinFile, Sceneauto_GetTimeUs() - u64LoadTime);
+    }
+    else
+    {
+        s32Ret = Sceneauto_LoadFile(pszFileName);
+        if (HI_SUCCESS != s32Ret)
+        {
+            printf("Sceneauto_LoadFile failed\n");
+            Sceneauto_FreeDict();
+            MUTEX_UNLOCK(g_stSceneautoLock);
+            return HI_FAILURE;
+        }
+
+        s32Ret = Sceneauto_LoadINIPara();
+        if (HI_SUCCESS != s32Ret)
+        {
+            printf("Sceneauto_LoadCommonPara failed\n");
+            Sceneauto_FreeDict();
+            Sceneauto_FreeMem();
+            MUTEX_UNLOCK(g_stSceneautoLock);
+            return HI_FAILURE;
+        }
+        printf("sceneauto para parsed from %s in %llu us\n", pszFileName, Sceneauto_GetTimeUs() - u64LoadTime);
     }
 
     g_bSceneautoInit = HI_TRUE;
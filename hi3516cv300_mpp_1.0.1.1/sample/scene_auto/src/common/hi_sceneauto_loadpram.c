@@ -5,6 +5,7 @@
 
 #include "iniparser.h"
 #include "hi_sceneauto_comm.h"
+#include "hi_sceneauto_binpara.h"
 #include "hi_math.h"
 
 
@@ -4253,6 +4254,13 @@ HI_VOID Sceneauto_FreeDict()
 
 HI_VOID Sceneauto_FreeMem()
 {
+    /* the arrays point into the blob mapping, nothing was malloc'd */
+    if (HI_TRUE == Sceneauto_IsBinParaMapped(&g_stINIPara))
+    {
+        Sceneauto_UnmapBinPara(&g_stINIPara);
+        return;
+    }
+
     if (NULL != g_stINIPara.stIniAE.pu32BitrateThresh)
     {
         free(g_stINIPara.stIniAE.pu32BitrateThresh);
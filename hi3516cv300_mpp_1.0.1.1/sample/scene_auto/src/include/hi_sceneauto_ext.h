@@ -35,6 +35,20 @@ extern "C" {
 ******************************************************************************/
 HI_S32 HI_SCENEAUTO_Init(const HI_CHAR* pszFileName);
 
+/*****************************************************************************
+\brief SCENEAUTO compile ini to binary parameter file
+\attention \n
+Init maps pszFileName.bin directly when it is newer than the ini, and parses
+the ini otherwise. Must be called before init or after deinit.
+\param[in]	const HI_CHAR *pszIniFile
+\param[in]	const HI_CHAR *pszBinFile
+\retval ::HI_SUCCESS
+\retval ::HI_FAILURE
+\see \n
+:: \n
+******************************************************************************/
+HI_S32 HI_SCENEAUTO_CompileBin(const HI_CHAR* pszIniFile, const HI_CHAR* pszBinFile);
+
 /*****************************************************************************
 \brief SCENEAUTO deinit
 \attention \n
@@ -76,6 +76,126 @@ void * mem_double(void * ptr, int size)
 }
 
 
+/* Index buckets hold the key[] slot + 1 of an entry, 0 for a never used
+   bucket and DICT_INDEX_DELETED once the entry has been unset. Lookups probe
+   linearly from (hash & mask), the index is at most 3/4 full so an empty
+   bucket always ends the probe. */
+#define DICT_INDEX_DELETED  (-1)
+
+/* Smallest power of two index able to hold 'size' entries at half load */
+static int dictionary_index_size(int size)
+{
+    int     isize = 1 ;
+
+    while (isize < 2*size)
+        isize <<= 1 ;
+    return isize ;
+}
+
+/* Slot of 'key' in key[], -1 when not in the dictionary */
+static int dictionary_lookup(const dictionary * d, const char * key, unsigned hash)
+{
+    unsigned    mask ;
+    unsigned    b ;
+    int         e ;
+
+    if (d->index==NULL)
+        return -1 ;
+    mask = (unsigned)d->indexSize - 1 ;
+    for (b=hash&mask ; ; b=(b+1)&mask) {
+        e = d->index[b] ;
+        if (e==0)
+            return -1 ;
+        /* Compare hash, then string to avoid hash collisions */
+        if (e>0 && hash==d->hash[e-1] && !strcmp(key, d->key[e-1]))
+            return e-1 ;
+    }
+}
+
+static void dictionary_index_put(dictionary * d, unsigned hash, int slot)
+{
+    unsigned    mask ;
+    unsigned    b ;
+
+    mask = (unsigned)d->indexSize - 1 ;
+    for (b=hash&mask ; d->index[b]>0 ; b=(b+1)&mask)
+        ;
+    if (d->index[b]==0)
+        d->indexFill ++ ;
+    d->index[b] = slot+1 ;
+}
+
+/* Rebuild the index from key[], dropping the deleted buckets */
+static int dictionary_index_rebuild(dictionary * d, int isize)
+{
+    int     *   index ;
+    int         i ;
+
+    index = (int*)calloc(isize, sizeof(int));
+    if (index==NULL)
+        return -1 ;
+    free(d->index);
+    d->index = index ;
+    d->indexSize = isize ;
+    d->indexFill = 0 ;
+    for (i=0 ; i<d->size ; i++) {
+        if (d->key[i]!=NULL)
+            dictionary_index_put(d, d->hash[i], i);
+    }
+    return 0 ;
+}
+
+/* Store a key known not to be in the dictionary, in the first empty slot */
+static int dictionary_insert(dictionary * d, const char * key, const char * val, unsigned hash)
+{
+    int         i ;
+
+    /* See if dictionary needs to grow */
+    if (d->n==d->size) {
+
+        /* Reached maximum size: reallocate blackboard */
+        d->val  = (char**)mem_double(d->val,  d->size * sizeof(char*)) ;
+        if (NULL == d->val)
+        {
+            return -1;
+        }
+        d->key  = (char**)mem_double(d->key,  d->size * sizeof(char*)) ;
+        if (NULL == d->key)
+        {
+            return -1;
+        }
+        d->hash = (unsigned int*)mem_double(d->hash, d->size * sizeof(unsigned)) ;
+        if (NULL == d->hash)
+        {
+            return -1;
+        }
+
+        /* Double size */
+        d->size *= 2 ;
+    }
+    if (d->index==NULL || d->indexSize < 2*d->size || 4*(d->indexFill+1) > 3*d->indexSize) {
+        if (0 != dictionary_index_rebuild(d, dictionary_index_size(d->size)))
+            return -1 ;
+    }
+
+    /* Insert key in the first empty slot, every slot below freeSlot is used */
+    for (i=d->freeSlot ; i<d->size ; i++) {
+        if (d->key[i]==NULL) {
+            /* Add key here */
+            break ;
+        }
+    }
+    /* Copy key */
+    d->key[i]  = strdup(key);
+    d->val[i]  = val ? strdup(val) : NULL ;
+    d->hash[i] = hash;
+    d->n ++ ;
+    d->freeSlot = i+1 ;
+    dictionary_index_put(d, hash, i);
+    return 0;
+}
+
+
 /*---------------------------------------------------------------------------
                               Function codes
  ---------------------------------------------------------------------------*/
@@ -184,6 +304,9 @@ dictionary * dictionary_new(int size)
 	}
     memset(d->commPlace, 0, size*sizeof(unsigned char));
 
+    d->indexSize = dictionary_index_size(d->size);
+    d->index = (int*)calloc(d->indexSize, sizeof(int));
+
     return d ;
 }
 
@@ -231,6 +354,7 @@ void dictionary_del(dictionary * d)
 	d->commHash = NULL;
     free(d->commPlace);
     d->commPlace = NULL;
+    free(d->index);
     free(d->val);
 	d->val = NULL;
     free(d->key);
@@ -260,22 +384,12 @@ void dictionary_del(dictionary * d)
 /*--------------------------------------------------------------------------*/
 char * dictionary_get(const dictionary * d, const char * key, char * def)
 {
-    unsigned    hash ;
-    int            i ;
+    int         i ;
 
-    hash = dictionary_hash(key);
-    for (i=0 ; i<d->size ; i++) {
-        if (d->key==NULL)
-            continue ;
-        /* Compare hash */
-        if (hash==d->hash[i]) {
-            /* Compare string, to avoid hash collisions */
-            if (!strcmp(key, d->key[i])) {
-                return d->val[i] ;
-            }
-        }
-    }
-    return def ;
+    i = dictionary_lookup(d, key, dictionary_hash(key));
+    if (i<0)
+        return def ;
+    return d->val[i] ;
 }
 
 /*-------------------------------------------------------------------------*/
@@ -379,165 +493,65 @@ double dictionary_getdouble(const dictionary * d, const char * key, const double
   if not exist then return 1;*/
 int dictionary_set(const dictionary * d, const char * key, const char * val)
 {
-    int            i ;
-    unsigned    hash ;
+    int         i ;
 
     if (d==NULL || key==NULL) return -1;
-    
-    /* Compute hash for this key */
-    hash = dictionary_hash(key) ;
-    /* Find if value is already in blackboard */
-    if (d->n>0) {
-        for (i=0 ; i<d->size ; i++) {
-            if (d->key[i]==NULL)
-                continue ;
-            if (hash==d->hash[i]) { /* Same hash value */
-                if (!strcmp(key, d->key[i])) {     /* Same key */
-                    /* Found a value: modify and return */
-                    if (d->val[i]!=NULL)
-                        free(d->val[i]);
-                    d->val[i] = val ? strdup(val) : NULL ;
-                    /* Value has been modified: return */
-                    return 0;
-                }
-            }
-        }
-    }
 
-    return -1;
+    /* Find if value is already in blackboard */
+    i = dictionary_lookup(d, key, dictionary_hash(key));
+    if (i<0)
+        return -1;
 
+    /* Found a value: modify and return */
+    if (d->val[i]!=NULL)
+        free(d->val[i]);
+    d->val[i] = val ? strdup(val) : NULL ;
+    /* Value has been modified: return */
+    return 0;
 }
 
 /*if exist then return 1;
   if not exist then add and return 0;*/
 int dictionary_add(dictionary * d, const char * key, const char * val)
 {
-    int            i ;
     unsigned    hash ;
 
     if (d==NULL || key==NULL) return -1;
-    
+
     /* Compute hash for this key */
     hash = dictionary_hash(key) ;
     /* Find if value is already in blackboard */
-    if (d->n>0) {
-        for (i=0 ; i<d->size ; i++) {
-            if (d->key[i]==NULL)
-                continue ;
-            if (hash==d->hash[i]) { /* Same hash value */
-                if (!strcmp(key, d->key[i])) {     /* Same key */
-                    /* Found a value: return 1*/
-                    return -1;
-                }
-            }
-        }
-    }
-    /* Add a new value */
-    /* See if dictionary needs to grow */
-    if (d->n==d->size) {
-
-        /* Reached maximum size: reallocate blackboard */
-        d->val  = (char**)mem_double(d->val,  d->size * sizeof(char*)) ;
-		if(NULL == d->val )
-		{
-           return -1;
-		}
-        d->key  = (char**)mem_double(d->key,  d->size * sizeof(char*)) ;
-		if(NULL == d->key)
-		{
-           return -1;
-		}
-        d->hash = (unsigned int*)mem_double(d->hash, d->size * sizeof(unsigned)) ;
-		if(NULL == d->hash)
-		{
-            return -1;
-		}
+    if (dictionary_lookup(d, key, hash)>=0)
+        return -1;
 
-        /* Double size */
-        d->size *= 2 ;
-    }
-
-    /* Insert key in the first empty slot */
-    for (i=0 ; i<d->size ; i++) {
-        if (d->key[i]==NULL) {
-            /* Add key here */
-            break ;
-        }
-    }
-    /* Copy key */
-    d->key[i]  = strdup(key);
-    d->val[i]  = val ? strdup(val) : NULL ;
-    d->hash[i] = hash;
-    d->n ++ ;
-    return 0;
+    /* Add a new value */
+    return dictionary_insert(d, key, val, hash);
 }
 
 /*if exist then set and return 0;
   if not exist then add and return 0;*/
 int dictionary_modify(dictionary * d, const char * key, const char * val)
 {
-    int            i ;
+    int         i ;
     unsigned    hash ;
 
     if (d==NULL || key==NULL) return -1;
-    
+
     /* Compute hash for this key */
     hash = dictionary_hash(key) ;
     /* Find if value is already in blackboard */
-    if (d->n>0) {
-        for (i=0 ; i<d->size ; i++) {
-            if (d->key[i]==NULL)
-                continue ;
-            if (hash==d->hash[i]) { /* Same hash value */
-                if (!strcmp(key, d->key[i])) {     /* Same key */
-                    /* Found a value: modify and return */
-                    if (d->val[i]!=NULL)
-                        free(d->val[i]);
-                    d->val[i] = val ? strdup(val) : NULL ;
-                    /* Value has been modified: return */
-                    return 0;
-                }
-            }
-        }
-    }
-    /* Add a new value */
-    /* See if dictionary needs to grow */
-    if (d->n==d->size) {
-
-        /* Reached maximum size: reallocate blackboard */
-        d->val  = (char**)mem_double(d->val,  d->size * sizeof(char*)) ;
-		if(NULL == d->val )
-		{
-           return -1;
-		}
-        d->key  = (char**)mem_double(d->key,  d->size * sizeof(char*)) ;
-		if(NULL == d->key)
-		{
-           return -1;
-		}
-        d->hash = (unsigned int*)mem_double(d->hash, d->size * sizeof(unsigned)) ;
-		if(NULL == d->hash)
-		{
-			return -1;
-		}
-
-        /* Double size */
-        d->size *= 2 ;
+    i = dictionary_lookup(d, key, hash);
+    if (i>=0) {
+        /* Found a value: modify and return */
+        if (d->val[i]!=NULL)
+            free(d->val[i]);
+        d->val[i] = val ? strdup(val) : NULL ;
+        /* Value has been modified: return */
+        return 0;
     }
 
-    /* Insert key in the first empty slot */
-    for (i=0 ; i<d->size ; i++) {
-        if (d->key[i]==NULL) {
-            /* Add key here */
-            break ;
-        }
-    }
-    /* Copy key */
-    d->key[i]  = strdup(key);
-    d->val[i]  = val ? strdup(val) : NULL ;
-    d->hash[i] = hash;
-    d->n ++ ;
-    return 0;
+    /* Add a new value */
+    return dictionary_insert(d, key, val, hash);
 }
 /*-------------------------------------------------------------------------*/
 /**
@@ -553,25 +567,22 @@ int dictionary_modify(dictionary * d, const char * key, const char * val)
 void dictionary_unset(dictionary * d, const char * key)
 {
     unsigned    hash ;
-    int            i ;
+    unsigned    mask ;
+    unsigned    b ;
+    int         i ;
 
     hash = dictionary_hash(key);
-    for (i=0 ; i<d->size ; i++) {
-        if (d->key[i]==NULL)
-            continue ;
-        /* Compare hash */
-        if (hash==d->hash[i]) {
-            /* Compare string, to avoid hash collisions */
-            if (!strcmp(key, d->key[i])) {
-                /* Found key */
-                break ;
-            }
-        }
-    }
-    if (i>=d->size)
+    i = dictionary_lookup(d, key, hash);
+    if (i<0)
         /* Key not found */
         return ;
 
+    /* Mark the bucket deleted so the probe chains through it stay intact */
+    mask = (unsigned)d->indexSize - 1 ;
+    for (b=hash&mask ; d->index[b]!=i+1 ; b=(b+1)&mask)
+        ;
+    d->index[b] = DICT_INDEX_DELETED ;
+
     free(d->key[i]);
     d->key[i] = NULL ;
     if (d->val[i]!=NULL) {
@@ -580,6 +591,8 @@ void dictionary_unset(dictionary * d, const char * key)
     }
     d->hash[i] = 0 ;
     d->n -- ;
+    if (i<d->freeSlot)
+        d->freeSlot = i ;
     return ;
 }
 
@@ -802,15 +802,8 @@ int iniparser_add_comment(
         d->commSize *= 2 ;
     }
 
-    /* Insert comment in the first empty slot */
-    for (i=0 ; i<d->commSize ; i++)
-    {
-        if (d->commPlace[i] == 0)
-        {
-            /* Add comment here */
-            break ;
-        }
-    }
+    /* Insert comment in the first empty slot, comments are never removed so it is commN */
+    i = d->commN ;
     d->commHash[i] = hash;
     d->commPlace[i]= place;
     d->comment[i] ? free(d->comment[i]),d->comment[i]=NULL: NULL;
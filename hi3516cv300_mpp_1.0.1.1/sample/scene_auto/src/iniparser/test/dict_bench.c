@@ -0,0 +1,212 @@
+/******************************************************************************
+
+  Copyright (C), 2001-2011, Hisilicon Tech. Co., Ltd.
+
+ ******************************************************************************
+  File Name     : dict_bench.c
+  Version       : Initial Draft
+  Author        : Hisilicon multimedia software group
+  Created       : 2016/06/20
+  Description   : host check and timing of the hashed iniparser dictionary
+  History       :
+  1.Date        : 2016/06/20
+    Author      :
+    Modification: Created file
+
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <sys/time.h>
+
+#include "iniparser.h"
+
+/* not exported by dictionary.h */
+extern int dictionary_modify(dictionary *d, const char *key, const char *val);
+
+#define LOAD_LOOP       20
+#define LOOKUP_LOOP     20
+#define LINE_SIZE       4096
+#define UNSET_KEYS      4000
+
+static int s_s32Fail = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+    printf(__VA_ARGS__); printf("\n"); s_s32Fail++; } } while (0)
+
+static double now_us(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+/* sections must come back from the dictionary in file order */
+static void check_section_order(const dictionary *d, const char *pszFile)
+{
+    FILE *fp;
+    char szLine[LINE_SIZE];
+    char *p, *q;
+    int i = 0;
+    char *pszSec;
+
+    fp = fopen(pszFile, "r");
+    if (NULL == fp)
+    {
+        return;
+    }
+
+    while (fgets(szLine, sizeof(szLine), fp))
+    {
+        for (p = szLine; isspace((unsigned char)*p); p++)
+        {
+        }
+        if ('[' != *p || NULL == (q = strchr(p, ']')))
+        {
+            continue;
+        }
+        *q = '\0';
+        for (q = p + 1; *q; q++)
+        {
+            *q = tolower((unsigned char)*q);
+        }
+
+        pszSec = iniparser_getsecname(d, i++);
+        CHECK(NULL != pszSec && 0 == strcmp(pszSec, p + 1), "%s: section %d is %s, file has %s",
+            pszFile, i - 1, pszSec ? pszSec : "(null)", p + 1);
+    }
+    CHECK(i == iniparser_getnsec(d), "%s: %d sections in file, %d in dictionary",
+        pszFile, i, iniparser_getnsec(d));
+
+    fclose(fp);
+}
+
+static void bench_file(const char *pszFile)
+{
+    dictionary *d = NULL;
+    double dStart, dLoad, dLookup;
+    int i, j, s32Keys = 0;
+    volatile int s32Sum = 0;
+
+    dStart = now_us();
+    for (i = 0; i < LOAD_LOOP; i++)
+    {
+        if (NULL != d)
+        {
+            iniparser_freedict(d);
+        }
+        d = iniparser_load(pszFile);
+        if (NULL == d)
+        {
+            CHECK(0, "cannot load %s", pszFile);
+            return;
+        }
+    }
+    dLoad = (now_us() - dStart) / LOAD_LOOP;
+
+    for (i = 0; i < d->size; i++)
+    {
+        if (NULL == d->key[i])
+        {
+            continue;
+        }
+        s32Keys++;
+        CHECK(iniparser_getstring(d, d->key[i], NULL) == d->val[i], "%s: lookup of %s", pszFile, d->key[i]);
+    }
+    CHECK(s32Keys == d->n, "%s: %d keys in slots, n is %d", pszFile, s32Keys, d->n);
+    CHECK(NULL == iniparser_getstring(d, "common:no_such_key", NULL), "%s: missing key found", pszFile);
+    check_section_order(d, pszFile);
+
+    /* the way Sceneauto_LoadINIPara reads it: one getint per key, section entries have no value */
+    s32Keys = 0;
+    for (i = 0; i < d->size; i++)
+    {
+        if (NULL != d->key[i] && NULL != d->val[i])
+        {
+            s32Keys++;
+        }
+    }
+    dStart = now_us();
+    for (j = 0; j < LOOKUP_LOOP; j++)
+    {
+        for (i = 0; i < d->size; i++)
+        {
+            if (NULL != d->key[i] && NULL != d->val[i])
+            {
+                s32Sum += iniparser_getint(d, d->key[i], 0);
+            }
+        }
+    }
+    dLookup = (now_us() - dStart) / LOOKUP_LOOP;
+
+    printf("%-40s keys %5d  load %9.1f us  %5d getint %9.1f us (%.3f us each)\n",
+        pszFile, d->n, dLoad, s32Keys, dLookup, dLookup / (s32Keys ? s32Keys : 1));
+
+    iniparser_freedict(d);
+}
+
+/* unset entries leave holes, new keys must fill them lowest slot first */
+static void check_unset_reuse(void)
+{
+    dictionary *d;
+    char szKey[32];
+    int i, s32Slot;
+
+    d = dictionary_new(0);
+    for (i = 0; i < UNSET_KEYS; i++)
+    {
+        snprintf(szKey, sizeof(szKey), "sec:%d", i);
+        CHECK(0 == dictionary_add(d, szKey, szKey), "add %s", szKey);
+    }
+    CHECK(0 != dictionary_add(d, "sec:7", "x"), "duplicate add accepted");
+
+    for (i = 0; i < UNSET_KEYS; i += 3)
+    {
+        snprintf(szKey, sizeof(szKey), "sec:%d", i);
+        dictionary_unset(d, szKey);
+    }
+    CHECK(d->n == UNSET_KEYS - (UNSET_KEYS + 2) / 3, "n is %d after unset", d->n);
+
+    for (i = 0; i < UNSET_KEYS; i++)
+    {
+        snprintf(szKey, sizeof(szKey), "sec:%d", i);
+        CHECK((0 == i % 3) == (NULL == dictionary_get(d, szKey, NULL)), "get %s after unset", szKey);
+    }
+
+    for (i = 0; i < 10; i++)
+    {
+        snprintf(szKey, sizeof(szKey), "new:%d", i);
+        CHECK(0 == dictionary_modify(d, szKey, "v"), "modify-add %s", szKey);
+        for (s32Slot = 0; s32Slot < d->size; s32Slot++)
+        {
+            if (d->key[s32Slot] && 0 == strcmp(d->key[s32Slot], szKey))
+            {
+                break;
+            }
+        }
+        CHECK(s32Slot == i * 3, "%s went to slot %d, expected %d", szKey, s32Slot, i * 3);
+    }
+
+    CHECK(0 == dictionary_set(d, "new:3", "w"), "set existing");
+    CHECK(0 == strcmp(dictionary_get(d, "new:3", ""), "w"), "set value");
+    CHECK(0 != dictionary_set(d, "sec:0", "w"), "set of unset key accepted");
+
+    dictionary_del(d);
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    check_unset_reuse();
+
+    for (i = 1; i < argc; i++)
+    {
+        bench_file(argv[i]);
+    }
+
+    printf("%s\n", s_s32Fail ? "FAILED" : "PASSED");
+    return s_s32Fail ? 1 : 0;
+}